@@ -129,6 +129,19 @@ class AmsBackend {
      */
     [[nodiscard]] virtual AmsSystemInfo get_system_info() const = 0;
 
+    /**
+     * @brief Get the most recently published system snapshot
+     *
+     * Lock-free alternative to get_system_info() for frequent readers
+     * (AmsState syncs on every backend event). Backends publish a new
+     * immutable snapshot whenever they emit an event, so the snapshot is never
+     * older than the last event delivered. Falls back to a fresh
+     * get_system_info() copy until the first publish.
+     *
+     * @return Shared immutable snapshot (never nullptr)
+     */
+    [[nodiscard]] std::shared_ptr<const AmsSystemInfo> get_system_snapshot() const;
+
     /**
      * @brief Get the detected AMS type
      * @return AmsType enum value
@@ -684,4 +697,19 @@ class AmsBackend {
      * @return Unique pointer to mock backend instance
      */
     static std::unique_ptr<AmsBackend> create_mock(int slot_count = 4);
+
+  protected:
+    /**
+     * @brief Publish an immutable copy of the current state
+     *
+     * Call while holding the state lock, before emitting an event, so
+     * listeners see the state that caused it.
+     *
+     * @param info Current system state to copy into the new snapshot
+     */
+    void publish_snapshot(const AmsSystemInfo& info);
+
+  private:
+    /// Latest published state; only accessed via std::atomic_load/atomic_store
+    std::shared_ptr<const AmsSystemInfo> snapshot_;
 };
@@ -253,8 +253,9 @@ class AmsState {
     /**
      * @brief Get slots version subject
      *
-     * Incremented whenever slot data changes. UI can observe this
-     * to know when to refresh slot displays.
+     * Incremented when the slot count or any slot's displayed data changes.
+     * Syncs that change nothing leave it alone. Use get_slot_version_subject()
+     * to find out which slots changed.
      *
      * @return Subject holding version counter
      */
@@ -515,6 +516,18 @@ class AmsState {
      */
     [[nodiscard]] lv_subject_t* get_slot_status_subject(int slot_index);
 
+    /**
+     * @brief Get slot version subject for a specific slot
+     *
+     * Incremented only when this slot's displayed data (color, status,
+     * material, tool mapping, weights) changes, so widgets can skip
+     * slots that a status update did not touch.
+     *
+     * @param slot_index Slot index (0 to MAX_SLOTS-1)
+     * @return Subject pointer or nullptr if out of range
+     */
+    [[nodiscard]] lv_subject_t* get_slot_version_subject(int slot_index);
+
     // ========================================================================
     // Direct State Update (called by backend event handler)
     // ========================================================================
@@ -522,15 +535,17 @@ class AmsState {
     /**
      * @brief Update state from backend system info
      *
-     * Called internally when backend emits STATE_CHANGED event.
-     * Updates all subjects from the current backend state.
+     * Reads the live backend state (copied under the backend's lock), so it
+     * also picks up changes the backend has not emitted an event for.
+     * Backend events go through the lock-free snapshot path instead.
      */
     void sync_from_backend();
 
     /**
      * @brief Update a single slot's subjects
      *
-     * Called when backend emits SLOT_CHANGED event.
+     * Called when backend emits SLOT_CHANGED event. Does nothing if the
+     * slot's displayed data is unchanged.
      *
      * @param slot_index Slot that changed
      */
@@ -618,6 +633,29 @@ class AmsState {
      */
     void bump_slots_version();
 
+    /**
+     * @brief Update state from the backend's last published snapshot
+     *
+     * Event path for STATE_CHANGED and friends: takes the snapshot without
+     * locking the backend.
+     */
+    void sync_from_snapshot();
+
+    /**
+     * @brief Push system info into all subjects, diffing slots
+     * @param info System state to apply
+     */
+    void apply_system_info(const AmsSystemInfo& info);
+
+    /**
+     * @brief Diff one slot against what was last applied and notify if changed
+     *
+     * @param slot_index Slot index (0 to MAX_SLOTS-1)
+     * @param slot New slot state (default SlotInfo for an absent slot)
+     * @return true if the slot's displayed data changed
+     */
+    bool apply_slot(int slot_index, const SlotInfo& slot);
+
     /**
      * @brief Probe for ValgACE via REST endpoint
      *
@@ -715,9 +753,13 @@ class AmsState {
     lv_subject_t current_has_weight_;
     lv_subject_t current_color_;
 
-    // Per-slot subjects (color and status)
+    // Per-slot subjects (color, status, change counter)
     lv_subject_t slot_colors_[MAX_SLOTS];
     lv_subject_t slot_statuses_[MAX_SLOTS];
+    lv_subject_t slot_versions_[MAX_SLOTS];
+
+    // Slot state last pushed to the per-slot subjects (diff baseline)
+    SlotInfo applied_slots_[MAX_SLOTS];
 
     // Observer for print state changes to auto-refresh Spoolman weights
     ObserverGuard print_state_observer_;
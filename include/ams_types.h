@@ -563,6 +563,26 @@ struct SlotInfo {
     [[nodiscard]] bool is_multi_color() const {
         return !multi_color_hexes.empty();
     }
+
+    /**
+     * @brief Check if another slot would look the same in the UI
+     *
+     * Compares everything slot widgets display (color, status, material, tool
+     * mapping, Spoolman weights). Used by AmsState to skip notifications for
+     * slots a status update did not change.
+     *
+     * @param other Slot to compare against
+     * @return true if no displayed field differs
+     */
+    [[nodiscard]] bool same_display_state(const SlotInfo& other) const {
+        return status == other.status && color_rgb == other.color_rgb &&
+               color_name == other.color_name && multi_color_hexes == other.multi_color_hexes &&
+               material == other.material && brand == other.brand &&
+               mapped_tool == other.mapped_tool && spoolman_id == other.spoolman_id &&
+               spool_name == other.spool_name && remaining_weight_g == other.remaining_weight_g &&
+               total_weight_g == other.total_weight_g &&
+               endless_spool_group == other.endless_spool_group;
+    }
 };
 
 /**
@@ -109,6 +109,7 @@ class Application {
     std::unique_ptr<MoonrakerManager> m_moonraker;
     std::unique_ptr<PrintHistoryManager> m_history_manager;
     std::unique_ptr<TemperatureHistoryManager> m_temp_history_manager;
+    std::string m_temp_history_snapshot_path; ///< Empty when persistence is disabled
     std::unique_ptr<PanelFactory> m_panels;
     std::unique_ptr<helix::plugin::PluginManager> m_plugin_manager;
 
@@ -128,6 +129,9 @@ class Application {
     lv_obj_t* m_screen = nullptr;
     lv_obj_t* m_app_layout = nullptr;
 
+    // Cold overlay eviction check (deleted in shutdown())
+    lv_timer_t* m_evict_overlays_timer = nullptr;
+
     // Overlay panels (for lifecycle management)
     struct OverlayPanels {
         lv_obj_t* motion = nullptr;
@@ -5,6 +5,8 @@
 
 #include "bed_mesh_renderer.h" // For bed_mesh_renderer_t, bed_mesh_quad_3d_t
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 /**
@@ -12,7 +14,7 @@
  * @brief 3D geometry generation for bed mesh visualization
  *
  * Provides functions for generating 3D mesh quads from height data and
- * sorting them for proper depth ordering (painter's algorithm).
+ * ordering them back-to-front for the painter's algorithm.
  *
  * All functions operate on an existing bed_mesh_renderer_t instance in
  * the helix::mesh namespace.
@@ -24,12 +26,15 @@ namespace mesh {
 /**
  * @brief Generate 3D quads from mesh height data
  *
- * Creates a quad (4 vertices) for each mesh cell with:
- * - World-space 3D positions computed from mesh indices and Z values
+ * Fills the renderer's shared float vertex arrays (mesh grid, then zero plane
+ * grid) and creates a quad for each cell with:
+ * - Indices of its 4 corners in the vertex arrays
  * - Per-vertex colors mapped from height (via gradient module)
  * - Center color for fast solid rendering during drag
+ * - World-space centroid (renderer->quad_center_x/y/z) for depth ordering
  *
- * Quads are stored in renderer->quads vector. Number of quads = (rows-1) × (cols-1).
+ * Quads are stored in renderer->quads vector. Number of mesh quads = (rows-1) × (cols-1).
+ * Invalidates renderer->draw_order.
  *
  * Quad vertex layout (view from above, looking down -Z axis):
  *
@@ -47,16 +52,38 @@ namespace mesh {
 void generate_mesh_quads(bed_mesh_renderer_t* renderer);
 
 /**
- * @brief Sort quads by average depth (painter's algorithm)
+ * @brief Bring a back-to-front draw order up to date for a view direction
  *
- * Sorts quads in descending depth order (furthest first) to ensure
- * correct occlusion when rendering without a Z-buffer.
+ * Camera-space depth is linear in world position, so a quad's average vertex
+ * depth is its centroid dotted with the view direction - no projection needed.
+ * A small rotation only swaps neighbouring quads, so an existing order is
+ * repaired with an insertion sort (O(n) per drag step) instead of re-sorted.
  *
- * Uses quad.avg_depth which must be computed during projection.
+ * @param center_x Quad centroid X coordinates (world space)
+ * @param center_y Quad centroid Y coordinates
+ * @param center_z Quad centroid Z coordinates
+ * @param count Number of quads
+ * @param dir View direction (toward the camera); larger dot product = nearer
+ * @param full_sort Rebuild from scratch instead of repairing (large view change)
+ * @param[in,out] keys Scratch buffer for per-quad keys
+ * @param[in,out] order Quad indices, furthest first
+ */
+void update_draw_order(const float* center_x, const float* center_y, const float* center_z,
+                       size_t count, const float dir[3], bool full_sort, std::vector<float>& keys,
+                       std::vector<uint32_t>& order);
+
+/**
+ * @brief Update renderer->draw_order for the current view (painter's algorithm)
+ *
+ * Skipped entirely when the view direction hasn't changed (e.g. redraws during
+ * panel animations). Falls back to a full sort when the Z rotation crosses into
+ * a new quadrant, where most of the order flips at once.
+ *
+ * Requires a valid trig cache in renderer->view_state.
  *
- * @param quads Vector of quads to sort (modified in-place)
+ * @param renderer Renderer with generated quads
  */
-void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads);
+void update_quad_draw_order(bed_mesh_renderer_t* renderer);
 
 /**
  * @brief Interpolate coordinate from mesh index to printer coordinate
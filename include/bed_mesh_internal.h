@@ -6,6 +6,8 @@
 #include "bed_mesh_renderer.h"
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 /**
@@ -46,8 +48,8 @@ struct bed_mesh_renderer {
     // State machine
     RendererState state;
 
-    // Mesh data storage
-    std::vector<std::vector<double>> mesh; // mesh[row][col] = Z height
+    // Mesh data storage (row-major, contiguous)
+    std::vector<float> mesh; // mesh[row * cols + col] = Z height
     int rows;
     int cols;
     double mesh_min_z;
@@ -86,12 +88,36 @@ struct bed_mesh_renderer {
     // Computed rendering state
     std::vector<bed_mesh_quad_3d_t> quads; // Generated geometry
 
-    // Cached projected screen coordinates (SOA layout for better cache efficiency)
-    // Only stores screen_x/screen_y - no unused fields (world x/y/z, depth)
-    // Old AOS: 40 bytes/point (5 doubles + 2 ints), New SOA: 8 bytes/point (2 ints)
-    // Memory savings: 80% reduction (16 KB → 3.2 KB for 20×20 mesh)
-    std::vector<std::vector<int>> projected_screen_x; // [row][col] → screen X coordinate
-    std::vector<std::vector<int>> projected_screen_y; // [row][col] → screen Y coordinate
+    // World-space vertices (SOA, float) shared by all quads.
+    // The first mesh_vertex_count entries are the mesh grid (index = row * cols + col),
+    // followed by the zero plane grid. Projected in one contiguous pass per frame.
+    std::vector<float> vertex_x;
+    std::vector<float> vertex_y;
+    std::vector<float> vertex_z;
+    size_t mesh_vertex_count = 0;
+
+    // Cached projected screen coordinates, same indexing as vertex_x/y/z
+    std::vector<int> projected_screen_x;
+    std::vector<int> projected_screen_y;
+
+    // Per-quad world-space centroids (SOA) - depth along the view axis is linear in
+    // world position, so a quad's average vertex depth is its centroid's depth
+    std::vector<float> quad_center_x;
+    std::vector<float> quad_center_y;
+    std::vector<float> quad_center_z;
+
+    // Back-to-front draw order (indices into quads), kept across frames and repaired
+    // incrementally as the view rotates. Cleared whenever quads are regenerated.
+    std::vector<uint32_t> draw_order;
+    std::vector<float> draw_order_keys;    // Scratch: per-quad depth key
+    std::array<float, 3> draw_order_dir{}; // View direction the order was built for
+    int draw_order_quadrant = -1;          // angle_z quadrant of draw_order_dir (-1 = none)
+
+    /// Z height at mesh point (row, col)
+    float z_at(int row, int col) const {
+        return mesh[static_cast<size_t>(row) * static_cast<size_t>(cols) +
+                    static_cast<size_t>(col)];
+    }
 
     // ===== Adaptive Render Mode (Phase 4) =====
 
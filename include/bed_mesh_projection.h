@@ -5,6 +5,8 @@
 
 #include "bed_mesh_renderer.h" // For bed_mesh_point_3d_t, bed_mesh_view_state_t
 
+#include <stddef.h>
+
 /**
  * @file bed_mesh_projection.h
  * @brief 3D to 2D projection for bed mesh visualization
@@ -32,3 +34,26 @@
 bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, double z,
                                                          int canvas_width, int canvas_height,
                                                          const bed_mesh_view_state_t* view);
+
+/**
+ * @brief Project a batch of world-space points to screen space
+ *
+ * Same math as bed_mesh_projection_project_3d_to_2d() in single precision over
+ * contiguous (SoA) arrays. The loop body is branch-free so GCC/Clang can
+ * auto-vectorize it (NEON on ARM, SSE on x86). Depth is not produced; draw order
+ * is derived from world-space centroids instead (see bed_mesh_geometry.h).
+ *
+ * @param x World X coordinates
+ * @param y World Y coordinates
+ * @param z World Z coordinates
+ * @param count Number of points
+ * @param canvas_width Canvas width in pixels
+ * @param canvas_height Canvas height in pixels
+ * @param view View/camera state (trig cache must be valid)
+ * @param[out] out_screen_x Screen X coordinates (count entries)
+ * @param[out] out_screen_y Screen Y coordinates (count entries)
+ */
+void bed_mesh_projection_project_batch(const float* x, const float* y, const float* z, size_t count,
+                                       int canvas_width, int canvas_height,
+                                       const bed_mesh_view_state_t* view, int* out_screen_x,
+                                       int* out_screen_y);
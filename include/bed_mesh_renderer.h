@@ -10,6 +10,7 @@ extern "C" {
 #include "lvgl/lvgl.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @file bed_mesh_renderer.h
@@ -62,7 +63,8 @@ extern "C" {
  * algorithm details.
  *
  * Performance target: 20×20 mesh at 30+ FPS on embedded hardware
- * Rendering complexity: O(n log n) for sorting + O(pixels) for rasterization
+ * Rendering complexity: O(n) projection + O(n) incremental depth ordering while rotating
+ * (O(n log n) only on quadrant changes) + O(pixels) for rasterization
  */
 
 // Rendering configuration constants
@@ -113,22 +115,16 @@ struct bed_mesh_point_3d_t {
     double depth;           // Z-depth from camera (for sorting)
 };
 
-// 3D vertex with color information
-struct bed_mesh_vertex_3d_t {
-    double x, y, z;   // 3D position in world space
-    lv_color_t color; // Vertex color for gradient interpolation
-};
-
 // Quad surface (4 vertices) representing one mesh cell
+// World positions live in the renderer's shared float vertex arrays (SoA); quads only index them
 struct bed_mesh_quad_3d_t {
-    bed_mesh_vertex_3d_t vertices[4]; // Four corners in WORLD space: [0]=BL, [1]=BR, [2]=TL, [3]=TR
+    uint32_t vertex[4];   // Vertex indices for the four corners: [0]=BL, [1]=BR, [2]=TL, [3]=TR
+    lv_color_t colors[4]; // Vertex colors for gradient interpolation
 
-    // Cached screen-space projections (computed once per frame, reused for rendering)
-    int screen_x[4];  // Screen X coordinates for vertices[0..3]
-    int screen_y[4];  // Screen Y coordinates for vertices[0..3]
-    double depths[4]; // Z-depths for vertices[0..3] (for sorting/debugging)
+    // Cached screen-space projections (gathered from projected vertices once per frame)
+    int screen_x[4]; // Screen X coordinates for vertex[0..3]
+    int screen_y[4]; // Screen Y coordinates for vertex[0..3]
 
-    double avg_depth;        // Average depth for back-to-front sorting (computed from depths[])
     lv_color_t center_color; // Fallback solid color for fast rendering (drag mode)
     lv_opa_t opacity;        // Quad opacity (LV_OPA_COVER for mesh, lower for zero plane)
 };
@@ -210,8 +206,10 @@ bool bed_mesh_renderer_set_mesh_data(bed_mesh_renderer_t* renderer, const float*
  * @param mesh_x_max Mesh probe area maximum X coordinate
  * @param mesh_y_min Mesh probe area minimum Y coordinate
  * @param mesh_y_max Mesh probe area maximum Y coordinate
+ * @return true if the bounds changed (geometry rebuilt, view re-fit); false if
+ *         they match the current bounds, which leaves the renderer untouched
  */
-void bed_mesh_renderer_set_bounds(bed_mesh_renderer_t* renderer, double bed_x_min, double bed_x_max,
+bool bed_mesh_renderer_set_bounds(bed_mesh_renderer_t* renderer, double bed_x_min, double bed_x_max,
                                   double bed_y_min, double bed_y_max, double mesh_x_min,
                                   double mesh_x_max, double mesh_y_min, double mesh_y_max);
 
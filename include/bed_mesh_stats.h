@@ -0,0 +1,55 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <vector>
+
+/**
+ * @file bed_mesh_stats.h
+ * @brief Summary statistics for a probed bed mesh
+ *
+ * Computed once when a distinct mesh is parsed (see MoonrakerAPI::update_bed_mesh)
+ * and stored on its BedMeshProfile, so the bed mesh panel, its profile list and
+ * anything else showing min/max/range read the same numbers without rescanning
+ * the grid.
+ */
+
+namespace helix {
+
+struct BedMeshStats {
+    bool valid = false; ///< False for an empty mesh or one not yet analyzed
+
+    float min_z = 0.0f;
+    float max_z = 0.0f;
+    float range = 0.0f;    ///< max_z - min_z (what Klipper UIs call "variance")
+    float mean = 0.0f;     ///< Mean Z over all probe points
+    float variance = 0.0f; ///< Statistical (population) variance of Z, mm^2
+
+    int min_row = 0; ///< Grid index of the lowest point
+    int min_col = 0;
+    int max_row = 0; ///< Grid index of the highest point
+    int max_col = 0;
+
+    float min_x = 0.0f; ///< Printer coordinates of the lowest point
+    float min_y = 0.0f;
+    float max_x = 0.0f; ///< Printer coordinates of the highest point
+    float max_y = 0.0f;
+};
+
+/**
+ * @brief Analyze a probed Z grid
+ *
+ * Probe coordinates are interpolated across mesh_min..mesh_max (Klipper's
+ * probed_matrix: row 0 = mesh_min Y, column 0 = mesh_min X). Ragged rows are
+ * tolerated; each point is placed by its own row/column index.
+ *
+ * @param matrix   Z heights, row-major
+ * @param mesh_min Probe area minimum {x, y}
+ * @param mesh_max Probe area maximum {x, y}
+ * @return Stats with valid == false if the matrix has no points
+ */
+BedMeshStats compute_bed_mesh_stats(const std::vector<std::vector<float>>& matrix,
+                                    const float mesh_min[2], const float mesh_max[2]);
+
+} // namespace helix
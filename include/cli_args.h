@@ -111,6 +111,10 @@ struct CliArgs {
     bool memory_report = false; // --memory-report: log memory every 30s
     bool show_memory = false;   // --show-memory: display memory overlay (M key toggle)
 
+    // Scoped tracing (see scoped_trace.h)
+    bool trace = false;     // --trace: record trace events from startup
+    std::string trace_path; // --trace=<path>: dump location (empty = /tmp/helix-trace-<pid>.json)
+
     // Moonraker override (for testing/development)
     std::string moonraker_url; // --moonraker: override config URL (e.g., ws://192.168.1.112:7125)
 
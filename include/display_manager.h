@@ -11,6 +11,8 @@
 #include <memory>
 #include <vector>
 
+class Config;
+
 /**
  * @brief Manages LVGL display initialization and lifecycle
  *
@@ -49,11 +51,12 @@ class DisplayManager {
      * @brief Display configuration options
      */
     struct Config {
-        int width = 0;               ///< Display width in pixels (0 = auto-detect)
-        int height = 0;              ///< Display height in pixels (0 = auto-detect)
-        int scroll_throw = 25;       ///< Scroll momentum decay (1-99, higher = faster decay)
-        int scroll_limit = 5;        ///< Pixels before scrolling starts
-        bool require_pointer = true; ///< Fail init if no pointer device (embedded only)
+        int width = 0;                ///< Display width in pixels (0 = auto-detect)
+        int height = 0;               ///< Display height in pixels (0 = auto-detect)
+        int scroll_throw = 25;        ///< Scroll momentum decay (1-99, higher = faster decay)
+        int scroll_limit = 5;         ///< Pixels before scrolling starts
+        bool require_pointer = true;  ///< Fail init if no pointer device (embedded only)
+        ::Config* settings = nullptr; ///< Holds the saved render profile (null = not persisted)
     };
 
     DisplayManager();
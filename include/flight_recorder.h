@@ -0,0 +1,95 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace helix {
+namespace logging {
+
+/**
+ * @brief Crash-surviving ring buffer of recent log lines
+ *
+ * The buffer is a MAP_SHARED mapping of a file on tmpfs (/dev/shm when
+ * available), so its contents outlive the process: after helix-screen
+ * crashes, helix-watchdog reads the file with read_file() and logs the last
+ * few KB of trace output, even though production logging runs at WARN.
+ *
+ * Writers reserve space with a single atomic add and memcpy their line in,
+ * so logging from the LVGL and libhv threads never takes a lock or touches
+ * the SD card. A line still being copied when the process dies may be
+ * truncated; read_file() drops the partial oldest line.
+ */
+class FlightRecorder {
+  public:
+    /// Smallest and largest supported capacities (bytes)
+    static constexpr size_t MIN_CAPACITY = 4 * 1024;
+    static constexpr size_t MAX_CAPACITY = 16 * 1024 * 1024;
+
+    /**
+     * @brief Create (or truncate) the recorder file and map it
+     *
+     * @param path File to map, normally default_flight_recorder_path()
+     * @param capacity Ring size in bytes, rounded up to a power of two
+     * @return nullptr if the file cannot be created or mapped
+     */
+    static std::unique_ptr<FlightRecorder> create(const std::string& path, size_t capacity);
+
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * @brief Append a line (caller includes the trailing newline)
+     *
+     * Lock-free and safe from any thread. Lines longer than a quarter of
+     * the capacity are truncated.
+     */
+    void write(std::string_view line) noexcept;
+
+    /// Ring size in bytes
+    [[nodiscard]] size_t capacity() const {
+        return capacity_;
+    }
+
+    /// Current contents, oldest line first
+    [[nodiscard]] std::string snapshot() const;
+
+    /**
+     * @brief Read a recorder file left behind by another (crashed) process
+     *
+     * @param path Recorder file
+     * @param out Recorded lines, oldest first
+     * @param pid Process that wrote the file (optional)
+     * @return false if the file is missing or not a flight recorder
+     */
+    static bool read_file(const std::string& path, std::string& out, uint32_t* pid = nullptr);
+
+  private:
+    struct Header;
+
+    FlightRecorder(void* mapping, size_t mapping_size);
+
+    /// Unroll the ring into chronological text
+    static std::string extract(const Header* header, const char* data);
+
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    size_t capacity_ = 0;
+    Header* header_ = nullptr;
+    char* data_ = nullptr;
+};
+
+/**
+ * @brief Default recorder location: /dev/shm (RAM) if present, else /tmp
+ */
+std::string default_flight_recorder_path();
+
+} // namespace logging
+} // namespace helix
@@ -0,0 +1,138 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "gcode_layer_index.h"
+#include "gcode_ops_detector.h"
+#include "gcode_parser.h"
+#include "gcode_time_model.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @file gcode_analysis.h
+ * @brief Everything the app derives from a G-code file, from a single pass
+ *
+ * The layer index, object table, pre-print operations, slicer metadata and
+ * per-layer extrusion stats used to come from separate scans (GCodeLayerIndex,
+ * GCodeOpsDetector, extract_header_metadata), each repeated whenever the file
+ * was opened. analyze_gcode_file() reads the file once and feeds every line to
+ * all of them, plus a kinematic print time estimate (gcode_time_model.h). The
+ * result is small enough to persist (see GCodeAnalysisService), so reopening a
+ * known file is a cache read.
+ */
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Identity of a file on disk: a cached analysis is valid while this matches
+ */
+struct GCodeFileKey {
+    std::string path;
+    uint64_t file_size = 0;
+    int64_t mtime_ns = 0; ///< Last write time, nanoseconds since the filesystem epoch
+
+    bool operator==(const GCodeFileKey& other) const {
+        return file_size == other.file_size && mtime_ns == other.mtime_ns && path == other.path;
+    }
+    bool operator!=(const GCodeFileKey& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Stat a file for use as an analysis cache key
+ * @return Key, or nullopt if the file does not exist
+ */
+std::optional<GCodeFileKey> stat_gcode_file(const std::string& path);
+
+/**
+ * @brief Extrusion statistics for one layer
+ *
+ * A move is extruding when it changes X/Y and pushes filament (E increases);
+ * moves that change X/Y without extruding are travels. Z-only moves, retracts
+ * and unretracts count as neither.
+ */
+struct LayerExtrusionStats {
+    uint32_t extrusion_moves = 0;
+    uint32_t travel_moves = 0;
+    float filament_mm = 0.0f;      ///< Filament length extruded by extruding moves
+    float path_length_mm = 0.0f;   ///< XY length of extruding moves
+    float travel_length_mm = 0.0f; ///< XY length of travel moves
+    float duration_s = 0.0f;       ///< Estimated time to print the layer (see gcode_time_model.h)
+    AABB bounds;                   ///< Extent of extruding moves (empty if none)
+};
+
+/**
+ * @brief Result of analyze_gcode_file()
+ */
+struct GCodeAnalysis {
+    GCodeFileKey key; ///< File this was computed from
+
+    // Layer index (restorable into GCodeLayerIndex without rescanning)
+    std::vector<StreamingLayerEntry> layers;
+    LayerIndexStats index_stats;
+    std::map<std::string, GCodeObject> objects; ///< From EXCLUDE_OBJECT_DEFINE
+
+    ScanResult operations;        ///< Pre-print operations in the preamble
+    GCodeHeaderMetadata metadata; ///< Slicer header/footer metadata
+
+    /// Per-layer extrusion stats, parallel to layers
+    std::vector<LayerExtrusionStats> layer_stats;
+
+    /// Extent of all extruding moves: coarse preview geometry for fitting the
+    /// camera (and, with each layer's bounds, a stacked-box preview) before any
+    /// layer has been parsed
+    AABB extrusion_bounds;
+
+    /// Elapsed print time by file position, planned with @ref limits
+    PrintTimeTable time_table;
+    MachineLimits limits; ///< Printer limits the time estimate used (zero = defaults)
+
+    double analysis_time_ms = 0.0; ///< Time the pass took (not the cache read)
+
+    /// Copy the layer index into @p index
+    void restore_index(GCodeLayerIndex& index) const;
+};
+
+/**
+ * @brief Analyze a G-code file in one streaming pass
+ *
+ * @param path Path to the G-code file
+ * @param limits Printer limits for the print time estimate; zero fields use
+ *               PrintTimeEstimator::default_limits()
+ * @param cancel Polled between lines; once true the pass stops early
+ * @return Analysis, or nullopt if the file cannot be read or the pass was cancelled
+ */
+std::optional<GCodeAnalysis> analyze_gcode_file(const std::string& path,
+                                                const MachineLimits& limits = {},
+                                                const std::atomic<bool>* cancel = nullptr);
+
+/**
+ * @brief Write an analysis to a cache file
+ *
+ * Binary, versioned, host byte order (the cache never leaves the device).
+ * Writes to a temporary file and renames it into place, so readers never see
+ * a partial file.
+ *
+ * @return false on I/O error
+ */
+bool save_gcode_analysis(const GCodeAnalysis& analysis, const std::string& cache_path);
+
+/**
+ * @brief Read an analysis written by save_gcode_analysis()
+ *
+ * @return Analysis, or nullopt if the file is missing, truncated or from a
+ *         different format version (callers re-analyze)
+ */
+std::optional<GCodeAnalysis> load_gcode_analysis(const std::string& cache_path);
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,188 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "gcode_analysis.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Shared, persistent G-code analysis (see gcode_analysis.h)
+ *
+ * Runs analyze_gcode_file() at most once per file version and keeps the
+ * result in two tiers: a few recent analyses in memory, and every analysis
+ * on disk under get_helix_cache_dir("gcode_analysis"), keyed by path, size
+ * and mtime. Opening a file seen before (even in a previous session) costs a
+ * cache read; an edited or re-uploaded file is re-analyzed.
+ *
+ * Only the print time estimate (time table and layer durations) depends on
+ * the printer's limits. A cached analysis planned with other limits than
+ * set_machine_limits() still serves the layer index, objects and metadata;
+ * it is re-planned only for callers that ask for Freshness::TIME_TABLE.
+ *
+ * Concurrent requests for the same file share one pass.
+ *
+ * Usage:
+ * @code
+ *   auto& service = GCodeAnalysisService::instance();
+ *
+ *   // Already on a worker thread: analyze (or load) inline
+ *   auto analysis = service.analyze(path);
+ *   if (analysis) {
+ *       analysis->restore_index(index);
+ *   }
+ *
+ *   // From the UI: warm the cache on the low-priority worker
+ *   service.request(path, [](std::shared_ptr<const GCodeAnalysis> a) {
+ *       // Runs on the worker thread - marshal to UI with ui_queue_update()
+ *   }, GCodeAnalysisService::Freshness::TIME_TABLE);
+ * @endcode
+ *
+ * @threading All public methods are thread-safe. Callbacks run on the worker.
+ */
+class GCodeAnalysisService {
+  public:
+    using AnalysisPtr = std::shared_ptr<const GCodeAnalysis>;
+    using Callback = std::function<void(AnalysisPtr)>;
+
+    /// What a cached analysis must match to be reused
+    enum class Freshness {
+        FILE,       ///< Same file version: layer index, objects, metadata, extrusion stats
+        TIME_TABLE, ///< Also planned with machine_limits(): time table, layer durations
+    };
+
+    /// Analyses kept in memory (most recently used)
+    static constexpr size_t MEMORY_ENTRIES = 4;
+
+    /// Cache files kept on disk; the least recently written are pruned
+    static constexpr size_t MAX_CACHE_FILES = 64;
+
+    /// Process-wide service caching under get_helix_cache_dir("gcode_analysis")
+    static GCodeAnalysisService& instance();
+
+    /**
+     * @brief Construct a service with its own cache directory
+     * @param cache_dir Directory for cache files; empty keeps results in memory only
+     */
+    explicit GCodeAnalysisService(std::string cache_dir);
+    ~GCodeAnalysisService();
+
+    GCodeAnalysisService(const GCodeAnalysisService&) = delete;
+    GCodeAnalysisService& operator=(const GCodeAnalysisService&) = delete;
+
+    /**
+     * @brief Cached analysis of the file's current version, without analyzing
+     * @return Analysis from memory or disk, or nullptr if none is cached
+     */
+    AnalysisPtr get_cached(const std::string& path, Freshness freshness = Freshness::FILE);
+
+    /**
+     * @brief Analysis of the file's current version, analyzing inline if needed
+     *
+     * Blocks the calling thread; meant for code already on a worker thread.
+     *
+     * @return Analysis, or nullptr if the file cannot be read
+     */
+    AnalysisPtr analyze(const std::string& path, Freshness freshness = Freshness::FILE);
+
+    /**
+     * @brief Analyze in the background on a low-priority worker
+     *
+     * Queued requests for the same path are merged (at the stricter
+     * freshness). A cached file is answered by the worker without a pass.
+     *
+     * @param path G-code file path
+     * @param callback Called on the worker with the result (nullptr on
+     *                 failure); may be empty to just warm the cache
+     * @param freshness What a cached result must match
+     */
+    void request(const std::string& path, Callback callback = nullptr,
+                 Freshness freshness = Freshness::FILE);
+
+    /// Block until every queued request has been answered
+    void wait_for_idle();
+
+    /**
+     * @brief Stop the worker; queued requests are answered with nullptr
+     *
+     * A pass in progress (on the worker or in analyze()) is abandoned, and
+     * later analyze() calls return nullptr instead of reading the file. Call
+     * before tearing down whatever the callbacks post to (the UI queue).
+     */
+    void shutdown();
+
+    /**
+     * @brief Set the printer limits used for print time estimates
+     *
+     * Use the configured limits (configfile.settings.printer), not the live
+     * toolhead values: M204 and SET_VELOCITY_LIMIT change those during every
+     * print, and each change would make cached time tables stale. Affects
+     * analyses started afterwards; cached results planned with other limits
+     * are re-planned when next requested with Freshness::TIME_TABLE.
+     */
+    void set_machine_limits(const MachineLimits& limits);
+
+    /// Limits new analyses are planned with
+    MachineLimits machine_limits() const;
+
+    /// Number of analysis passes run (cache misses), for diagnostics and tests
+    size_t analysis_count() const;
+
+    /// Cache file used for @p path (empty if there is no cache directory)
+    std::string cache_path_for(const std::string& path) const;
+
+  private:
+    struct Job {
+        std::string path;
+        Freshness freshness = Freshness::FILE;
+        std::vector<Callback> callbacks;
+    };
+
+    /// Whether a cached analysis satisfies @p freshness under @p limits
+    static bool usable(const GCodeAnalysis& analysis, Freshness freshness,
+                       const MachineLimits& limits);
+
+    AnalysisPtr find_in_memory(const GCodeFileKey& key, Freshness freshness,
+                               const MachineLimits& limits);
+    void remember(const AnalysisPtr& analysis);
+    AnalysisPtr load_from_disk(const GCodeFileKey& key, Freshness freshness,
+                               const MachineLimits& limits);
+    void store_to_disk(const GCodeAnalysis& analysis);
+    void prune_disk_cache();
+    void start_worker_locked();
+    void worker_loop();
+
+    const std::string cache_dir_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable in_flight_cv_; ///< Signalled when a path leaves in_flight_
+    std::condition_variable queue_cv_;     ///< Signalled on new jobs / shutdown
+    std::condition_variable idle_cv_;      ///< Signalled when the worker drains the queue
+    std::list<AnalysisPtr> memory_;        ///< Most recently used first
+    std::set<std::string> in_flight_;      ///< Paths being analyzed or loaded right now
+    std::deque<Job> queue_;
+    MachineLimits limits_;
+    bool worker_busy_ = false;
+    bool shutdown_ = false;
+    std::atomic<bool> cancel_{false}; ///< Set by shutdown(), polled by analysis passes
+    size_t analysis_count_ = 0;
+    std::thread worker_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -7,8 +7,8 @@
 
 #include <filesystem>
 #include <functional>
+#include <iosfwd>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace helix {
@@ -17,11 +17,8 @@ namespace gcode {
 /**
  * @brief Maximum file size (in bytes) to load entirely into memory
  *
- * @deprecated Use StreamingPolicy::should_stream() instead.
- * This constant is retained for backward compatibility with tests.
- * The actual streaming decision is now controlled by StreamingPolicy,
- * which auto-detects based on available RAM or can be configured in
- * helixconfig.json.
+ * @deprecated GCodeFileModifier always streams with a fixed-size buffer now;
+ * this constant is retained for backward compatibility with tests.
  *
  * Default: 5MB (safe for most embedded targets)
  */
@@ -41,10 +38,14 @@ enum class ModificationType {
 /**
  * @brief A single modification to apply to a G-code file
  *
- * Modifications are applied in order from last line to first to preserve
- * line numbers during multi-edit operations.
+ * Line numbers always refer to the original file. When several COMMENT_OUT,
+ * DELETE or REPLACE modifications cover the same line, the one added first
+ * wins; injections at the same line are emitted in the order they were added.
  */
 struct Modification {
+    /// byte_offset value meaning "not known"
+    static constexpr size_t NO_BYTE_OFFSET = static_cast<size_t>(-1);
+
     ModificationType type;
 
     /// For COMMENT_OUT, DELETE, REPLACE: the line number (1-indexed)
@@ -59,6 +60,11 @@ struct Modification {
     /// Optional comment explaining the modification (for debugging)
     std::string comment;
 
+    /// Byte offset of line_number in the original file, if known (e.g. from
+    /// DetectedOperation::byte_offset). Checked while streaming to catch scan
+    /// results that no longer match the file.
+    size_t byte_offset = NO_BYTE_OFFSET;
+
     /// Create a COMMENT_OUT modification for a single line
     static Modification comment_out(size_t line, const std::string& reason = "") {
         return {ModificationType::COMMENT_OUT, line, 0, "", reason};
@@ -125,9 +131,15 @@ struct ModificationResult {
  * **Design philosophy:**
  * - Prefer G-code injection (execute_gcode) over file modification
  * - Only modify files when disabling operations already in the G-code
- * - Create temp files, never modify originals in place
+ * - Create temp files, never modify originals in place (apply_in_place() is
+ *   for local copies the caller owns, such as a freshly downloaded file)
  * - Use Moonraker's file upload to replace the file for printing
  *
+ * **Streaming:** all modes read through a fixed-size buffer. Lines are only
+ * split up to the last modified line (operations sit in the start G-code);
+ * everything after it is copied in large blocks, so memory use is constant
+ * and a 200MB file costs one sequential read and write.
+ *
  * @code
  * GCodeFileModifier modifier;
  *
@@ -163,9 +175,9 @@ class GCodeFileModifier {
     /**
      * @brief Add a modification to the pending list
      *
-     * Modifications are stored and applied when apply() is called.
-     * Order of additions doesn't matter - they're sorted by line number
-     * and applied from last to first to preserve line numbers.
+     * Modifications are stored and applied when apply() is called. They are
+     * matched against original line numbers in a single forward pass; see
+     * Modification for how overlapping modifications are resolved.
      */
     void add_modification(Modification mod);
 
@@ -186,6 +198,8 @@ class GCodeFileModifier {
      *
      * Creates a modified copy in a temp location. The original file is never
      * modified. Use result.modified_path to access the modified file.
+     * Bytes outside modified lines (including line endings and a missing
+     * final newline) are copied unchanged.
      *
      * @param filepath Path to the source G-code file
      * @return ModificationResult with success status and modified file path
@@ -201,28 +215,37 @@ class GCodeFileModifier {
     [[nodiscard]] std::string apply_to_content(const std::string& content);
 
     /**
-     * @brief Apply modifications using streaming (for large files)
+     * @brief Apply modifications to a temp copy with constant memory
      *
-     * This method processes the file line-by-line without loading it entirely
-     * into memory. Critical for embedded devices with limited RAM where G-code
-     * files can be 100MB+.
-     *
-     * **Limitations of streaming mode:**
-     * - DELETE modifications skip lines (work correctly)
-     * - COMMENT_OUT modifications work on single lines
-     * - INJECT_BEFORE/AFTER work correctly
-     * - REPLACE works for single lines
-     * - Multi-line ranges (end_line_number > 0) are NOT supported and will
-     *   be handled as single-line operations with a warning
+     * Same as apply(); kept as the explicit entry point for callers that
+     * handle very large files. All modification types, including multi-line
+     * ranges, are supported.
      *
      * @param filepath Path to the source G-code file
      * @return ModificationResult with success status and modified file path
-     *
-     * @note This method is automatically called by apply() for files larger
-     *       than MAX_BUFFERED_FILE_SIZE.
      */
     [[nodiscard]] ModificationResult apply_streaming(const std::filesystem::path& filepath);
 
+    /**
+     * @brief Patch the file itself without changing its size
+     *
+     * Avoids copying the whole file when only a few lines change. Supported
+     * modifications:
+     * - COMMENT_OUT (single or range): the first character of each line is
+     *   overwritten with ';' (the reason is not recorded)
+     * - REPLACE of a single line with single-line G-code no longer than the
+     *   original line; the remainder is padded with spaces
+     *
+     * Nothing is written unless every modification qualifies and every known
+     * byte_offset matches the file. On failure the caller can fall back to
+     * apply_streaming(). Only use this on a copy the caller owns.
+     *
+     * @param filepath File to patch; result.modified_path is set to it
+     * @return ModificationResult; success is false if the modifications
+     *         cannot be applied in place
+     */
+    [[nodiscard]] ModificationResult apply_in_place(const std::filesystem::path& filepath);
+
     // =========================================================================
     // Convenience methods for common operations
     // =========================================================================
@@ -297,40 +320,17 @@ class GCodeFileModifier {
 
   private:
     /**
-     * @brief Sort modifications by line number (descending)
-     *
-     * Processing from end to start preserves line numbers for earlier mods.
-     */
-    void sort_modifications();
-
-    /**
-     * @brief Apply a single modification to content lines
-     */
-    void apply_single_modification(std::vector<std::string>& lines, const Modification& mod,
-                                   ModificationResult& result);
-
-    /**
-     * @brief Comment out a single line
+     * @brief Comment out a single line (a trailing '\r' is kept at the end)
      */
     static std::string comment_out_line(const std::string& line, const std::string& reason);
 
     /**
-     * @brief Build line-number-indexed lookup map for streaming mode
-     *
-     * Creates a map where keys are line numbers (1-indexed) and values are
-     * the modifications to apply. For COMMENT_OUT/DELETE with ranges, creates
-     * entries for each line in the range.
-     *
-     * @return Map of line_number -> Modification for O(1) lookup during streaming
-     */
-    [[nodiscard]] std::unordered_map<size_t, Modification> build_streaming_lookup() const;
-
-    /**
-     * @brief Apply buffered mode (loads file into memory)
+     * @brief Single-pass engine shared by apply_streaming() and apply_to_content()
      *
-     * The original implementation, now factored out for clarity.
+     * @return false if writing to `out` failed
      */
-    [[nodiscard]] ModificationResult apply_buffered(const std::filesystem::path& filepath);
+    bool stream_modifications(std::istream& in, std::ostream& out,
+                              ModificationResult& result) const;
 
     std::vector<Modification> modifications_;
 };
@@ -13,6 +13,7 @@
 #include <glm/glm.hpp>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -171,6 +172,16 @@ struct RibbonGeometry {
     // Per-layer bounding boxes for frustum culling (indexed by layer)
     std::vector<AABB> layer_bboxes; ///< AABB per layer for frustum culling
 
+    // Object tracking so highlight/exclude/recolor are render-time palette changes.
+    // Vertex colors are the object-independent base colors; the renderer picks a
+    // palette per object slot instead of rebuilding the geometry.
+    static constexpr uint16_t NO_OBJECT = UINT16_MAX; ///< Slot for strips outside any object
+    std::vector<std::string> object_names;            ///< Object slot -> EXCLUDE_OBJECT name
+    std::vector<uint16_t> strip_object_index;         ///< Object slot per strip (parallels strips)
+    /// Object strip ranges: [object_slot] -> runs of (first_strip_idx, strip_count)
+    std::vector<std::vector<std::pair<size_t, size_t>>> object_strip_ranges;
+    int filament_color_slot{-1}; ///< Palette slot of the default filament color (-1 = unused)
+
     // Palette lookup caches (O(1) lookup instead of O(N) linear search)
     std::unique_ptr<NormalCache> normal_cache; ///< Cache for normal palette lookups
     std::unique_ptr<ColorCache> color_cache;   ///< Cache for color palette lookups
@@ -183,14 +194,7 @@ struct RibbonGeometry {
     /**
      * @brief Calculate total memory usage in bytes
      */
-    size_t memory_usage() const {
-        return vertices.size() * sizeof(RibbonVertex) + indices.size() * sizeof(TriangleIndices) +
-               strips.size() * sizeof(TriangleStrip) + normal_palette.size() * sizeof(glm::vec3) +
-               color_palette.size() * sizeof(uint32_t) +
-               strip_layer_index.size() * sizeof(uint16_t) +
-               layer_strip_ranges.size() * sizeof(std::pair<size_t, size_t>) +
-               layer_bboxes.size() * sizeof(AABB);
-    }
+    size_t memory_usage() const;
 
     /**
      * @brief Clear all geometry data
@@ -330,17 +334,6 @@ class GeometryBuilder {
         layer_height_mm_ = height_mm;
     }
 
-    /**
-     * @brief Set highlighted object names for visual emphasis
-     * @param object_names Names of objects to highlight (empty to clear)
-     *
-     * Highlighted segments will be rendered with brightened color (1.8x multiplier)
-     * to make them stand out from the rest of the model.
-     */
-    void set_highlighted_objects(const std::unordered_set<std::string>& object_names) {
-        highlighted_objects_ = object_names;
-    }
-
     /**
      * @brief Enable/disable per-face debug coloring
      * @param enable true to assign distinct colors to each face for debugging
@@ -429,8 +422,6 @@ class GeometryBuilder {
     uint8_t filament_r_ = 0x26;        ///< Filament color red component
     uint8_t filament_g_ = 0xA6;        ///< Filament color green component
     uint8_t filament_b_ = 0x9A;        ///< Filament color blue component
-    std::unordered_set<std::string>
-        highlighted_objects_;                     ///< Object names to highlight (empty = none)
     bool debug_face_colors_ = false;              ///< Enable per-face debug coloring
     std::vector<std::string> tool_color_palette_; ///< Hex colors per tool (multi-color prints)
 
@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include "gcode_parser.h"
+
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -92,6 +97,38 @@ class GCodeLayerIndex {
      */
     bool build_from_file(const std::string& filepath);
 
+    /**
+     * @brief Start an incremental build
+     *
+     * For callers that already stream the file for other reasons (see
+     * analyze_gcode_file()): begin_build(), then add_line() for every line in
+     * order, then finish_build(). build_from_file() is exactly this over std::getline.
+     *
+     * @param filepath Path recorded as the index source
+     * @param file_size Total file size in bytes (bounds the last layer)
+     */
+    void begin_build(const std::string& filepath, size_t file_size);
+
+    /**
+     * @brief Feed the next line of the file
+     * @param line Line content without its trailing newline
+     */
+    void add_line(const std::string& line);
+
+    /**
+     * @brief Close the last layer and finalize statistics
+     * @return true if at least one layer was found
+     */
+    bool finish_build();
+
+    /**
+     * @brief Replace the index with one built earlier
+     *
+     * Used to reopen a file from the G-code analysis cache without scanning it.
+     */
+    void restore(const std::string& filepath, std::vector<StreamingLayerEntry> entries,
+                 const LayerIndexStats& stats, std::map<std::string, GCodeObject> objects);
+
     /**
      * @brief Get entry for a specific layer
      *
@@ -100,6 +137,13 @@ class GCodeLayerIndex {
      */
     StreamingLayerEntry get_entry(size_t layer_index) const;
 
+    /**
+     * @brief All layer entries, in file order
+     */
+    const std::vector<StreamingLayerEntry>& get_entries() const {
+        return entries_;
+    }
+
     /**
      * @brief Get total number of layers
      * @return Layer count
@@ -148,6 +192,16 @@ class GCodeLayerIndex {
      */
     float get_layer_z(size_t layer_index) const;
 
+    /**
+     * @brief Objects from EXCLUDE_OBJECT_DEFINE lines seen while indexing
+     *
+     * Name, center and polygon only (no bounding box: segments are not parsed).
+     * Lets streaming mode pick objects without loading any layer.
+     */
+    const std::map<std::string, GCodeObject>& get_objects() const {
+        return objects_;
+    }
+
     /**
      * @brief Get memory usage of this index
      * @return Approximate bytes used
@@ -163,6 +217,7 @@ class GCodeLayerIndex {
         entries_.clear();
         entries_.shrink_to_fit();
         stats_ = LayerIndexStats{};
+        objects_.clear();
         source_path_.clear();
     }
 
@@ -175,9 +230,23 @@ class GCodeLayerIndex {
     }
 
   private:
+    /// Scan state carried between add_line() calls
+    struct BuildState {
+        float current_z = -std::numeric_limits<float>::infinity();
+        uint64_t current_layer_start = 0;
+        uint64_t current_offset = 0;
+        uint16_t current_layer_lines = 0;
+        bool use_layer_markers = false;
+        bool pending_layer_start = false;
+        bool first_layer_started = false;
+        std::chrono::steady_clock::time_point start_time;
+    };
+
     std::vector<StreamingLayerEntry> entries_;
     LayerIndexStats stats_;
+    std::map<std::string, GCodeObject> objects_;
     std::string source_path_;
+    BuildState build_;
 };
 
 } // namespace gcode
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "gcode_object_picker.h"
 #include "gcode_parser.h"
 #include "gcode_streaming_controller.h"
 
@@ -11,6 +12,8 @@
 #include <atomic>
 #include <glm/glm.hpp>
 #include <memory>
+#include <optional>
+#include <string>
 #include <thread>
 
 namespace helix {
@@ -271,6 +274,20 @@ class GCodeLayerRenderer {
         return view_mode_;
     }
 
+    // =========================================================================
+    // Object Picking
+    // =========================================================================
+
+    /**
+     * @brief Pick object at canvas coordinates
+     * @param canvas_pos Position relative to the widget's top-left corner (pixels)
+     * @return Object name if picked, nullopt otherwise
+     *
+     * Works in both data source modes: object definitions come from the parsed
+     * file or, when streaming, from the layer index, so no layer is loaded.
+     */
+    std::optional<std::string> pick_object(const glm::vec2& canvas_pos) const;
+
     // =========================================================================
     // Colors
     // =========================================================================
@@ -424,6 +441,17 @@ class GCodeLayerRenderer {
     static glm::ivec2 world_to_screen_raw(const TransformParams& params, float x, float y,
                                           float z = 0.0f);
 
+    /**
+     * @brief world_to_screen_raw() as an orthographic view-projection matrix
+     *
+     * NDC follows the GCodeCamera convention (y up, smaller z nearer), so the
+     * result can be handed to ObjectPicker::pick() with the canvas size.
+     *
+     * @param params Captured transformation parameters
+     * @return World → clip space matrix
+     */
+    static glm::mat4 view_projection_raw(const TransformParams& params);
+
     /**
      * @brief Check if a segment is a support structure
      * @param seg Segment to check
@@ -485,6 +513,11 @@ class GCodeLayerRenderer {
     float bounds_max_z_ = 0.0f;
     bool bounds_valid_ = false;
 
+    // Object picking index, rebuilt when the object map changes
+    mutable ObjectPicker object_picker_;
+    mutable const std::map<std::string, GCodeObject>* picker_objects_ = nullptr;
+    mutable size_t picker_object_count_ = 0;
+
     // Widget screen offset (set during render())
     int widget_offset_x_ = 0;
     int widget_offset_y_ = 0;
@@ -0,0 +1,156 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "gcode_parser.h"
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Spatial index over object footprints for tap-to-object picking
+ *
+ * Built once per file from the EXCLUDE_OBJECT_DEFINE polygons (falling back to
+ * each object's bounding box), so picking never touches toolpath segments:
+ * it keeps working after ParsedGCodeFile::clear_segments() and in streaming
+ * mode, where the layer index supplies the object definitions. Objects that
+ * are only named by EXCLUDE_OBJECT_START (ParsedGCodeFile::segment_objects)
+ * are indexed by the extent of their extrusions.
+ *
+ * Each object is a vertical prism (footprint x Z range). Footprints are
+ * bucketed in a uniform XY grid; a tap unprojects to a ray, and only objects
+ * in the grid cells under the ray's XY shadow are tested exactly. If the ray
+ * misses everything, the nearest projected footprint edge within a pixel
+ * threshold wins, matching the tolerance of the old segment-based picking.
+ *
+ * Usage:
+ * @code
+ *   ObjectPicker picker;
+ *   picker.build(gcode.objects, 0.0f, gcode.global_bounding_box.max.z);
+ *   auto name = picker.pick(tap, camera.get_view_projection_matrix(),
+ *                           glm::vec2(width, height), z_min, z_max);
+ * @endcode
+ */
+class ObjectPicker {
+  public:
+    /// Pixels between a tap and an object's outline that still count as a hit
+    static constexpr float DEFAULT_PICK_THRESHOLD_PX = 15.0f;
+
+    /**
+     * @brief Index object definitions
+     * @param objects Objects by name (ParsedGCodeFile::objects or layer index objects)
+     * @param default_z_min Z range for objects without a bounding box
+     * @param default_z_max Z range for objects without a bounding box
+     *
+     * Objects with neither a polygon nor a bounding box are skipped.
+     */
+    void build(const std::map<std::string, GCodeObject>& objects, float default_z_min,
+               float default_z_max);
+
+    /**
+     * @brief Index a parsed file's objects unless already indexed
+     * @param gcode Parsed file (segments may already be cleared)
+     * @return true if the index was (re)built
+     *
+     * Indexes both gcode.objects and gcode.segment_objects.
+     *
+     * Cheap to call before every pick: rebuilds only when the file changes.
+     */
+    bool sync(const ParsedGCodeFile& gcode);
+
+    /**
+     * @brief Remove all objects
+     */
+    void clear();
+
+    /**
+     * @brief Number of indexed objects
+     */
+    size_t size() const {
+        return entries_.size();
+    }
+
+    bool empty() const {
+        return entries_.empty();
+    }
+
+    /**
+     * @brief Pick the object under a screen position
+     *
+     * @param screen_pos Position in viewport pixels (origin top-left)
+     * @param view_projection Matrix the scene was rendered with
+     * @param viewport_size Viewport size in pixels
+     * @param z_min Lowest visible Z (objects are clipped to the visible layers)
+     * @param z_max Highest visible Z
+     * @param threshold_px Fallback distance to an object outline
+     * @return Name of the nearest hit object, or nullopt
+     */
+    std::optional<std::string> pick(const glm::vec2& screen_pos, const glm::mat4& view_projection,
+                                    const glm::vec2& viewport_size, float z_min, float z_max,
+                                    float threshold_px = DEFAULT_PICK_THRESHOLD_PX) const;
+
+    /**
+     * @brief Object whose footprint contains a bed position (top-down views)
+     * @param bed_xy Position in printer XY coordinates (mm)
+     * @return Object name, or nullopt if no footprint contains the point
+     */
+    std::optional<std::string> pick_at(const glm::vec2& bed_xy) const;
+
+    /**
+     * @brief Z range spanned by a layer range (for pick()'s z_min/z_max)
+     * @param gcode Parsed file
+     * @param layer_start First visible layer
+     * @param layer_end Last visible layer (-1 = last layer)
+     * @param[out] z_min Top of the layer below layer_start (bed level for layer 0)
+     * @param[out] z_max Top of layer_end
+     * @return false if the range contains no layers
+     */
+    static bool visible_z_range(const ParsedGCodeFile& gcode, int layer_start, int layer_end,
+                                float& z_min, float& z_max);
+
+  private:
+    struct Entry {
+        std::string name;
+        std::vector<glm::vec2> footprint; ///< Closed polygon (last point connects to first)
+        glm::vec2 min{0.0f};              ///< Footprint XY bounds
+        glm::vec2 max{0.0f};
+        float z_min{0.0f};
+        float z_max{0.0f};
+    };
+
+    /**
+     * @brief Ray parameter where the ray enters an object's prism
+     * @return Entry t within [t_min, t_max], or nullopt if the ray misses
+     */
+    std::optional<float> intersect(const Entry& entry, const glm::vec3& origin,
+                                   const glm::vec3& dir, float z_min, float z_max) const;
+
+    /// Grid cell index range covering an XY box, clamped to the grid
+    void cell_range(const glm::vec2& min, const glm::vec2& max, int& x0, int& y0, int& x1,
+                    int& y1) const;
+
+    std::vector<Entry> entries_;
+
+    // File the index was synced from (pointer alone can be reused by the next file)
+    const ParsedGCodeFile* source_{nullptr};
+    std::string source_filename_;
+    size_t source_object_count_{0};
+
+    // Uniform grid over all footprints: [row * grid_cols_ + col] -> entry indices
+    std::vector<std::vector<uint16_t>> cells_;
+    glm::vec2 grid_min_{0.0f};
+    glm::vec2 cell_size_{1.0f};
+    int grid_cols_{0};
+    int grid_rows_{0};
+};
+
+} // namespace gcode
+} // namespace helix
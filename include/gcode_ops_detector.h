@@ -58,6 +58,7 @@ struct DetectedOperation {
 struct DetectionConfig {
     size_t max_scan_bytes = 50 * 1024;   ///< Stop scanning after this many bytes (50KB)
     int max_scan_lines = 500;            ///< Stop scanning after this many lines
+                                         ///< (embedded thumbnail blocks count towards neither)
     bool stop_at_first_extrusion = true; ///< Stop when G1 with positive E detected
     bool stop_at_layer_marker = true;    ///< Stop when ;LAYER_CHANGE detected
 };
@@ -92,6 +93,7 @@ struct ScanResult {
     size_t lines_scanned = 0;
     size_t bytes_scanned = 0;
     bool reached_limit = false;     ///< True if scan stopped due to limits
+    bool reached_end = false;       ///< Input ran out before any stop condition (may be truncated)
     PrintStartCallInfo print_start; ///< Info about PRINT_START call (if found)
 
     /**
@@ -123,6 +123,10 @@ struct ParsedGCodeFile {
     std::map<std::string, GCodeObject> objects; ///< Object metadata (name → object)
     AABB global_bounding_box;                   ///< Bounds of entire model
 
+    /// Objects named by segments but never defined (EXCLUDE_OBJECT_START without
+    /// EXCLUDE_OBJECT_DEFINE, wipe tower); bounds from their extrusions
+    std::map<std::string, GCodeObject> segment_objects;
+
     // Statistics
     size_t total_segments{0};                 ///< Total segment count
     float estimated_print_time_minutes{0.0f}; ///< From metadata (if available)
@@ -170,7 +174,7 @@ struct ParsedGCodeFile {
      *
      * After geometry is built, the raw segment data is no longer needed.
      * This frees the segment vectors while preserving metadata (bounding box,
-     * statistics, slicer info, etc.). Call this after geometry building to
+     * object definitions, statistics, slicer info, etc.). Call this after geometry building to
      * reduce memory usage by 40-160MB on large files.
      *
      * @return Bytes freed (approximate)
@@ -183,12 +187,8 @@ struct ParsedGCodeFile {
             layer.segments.clear();
             layer.segments.shrink_to_fit();
         }
-        // Also clear the objects polygon data (rarely used after geometry build)
-        for (auto& [name, obj] : objects) {
-            freed += obj.polygon.size() * sizeof(glm::vec2);
-            obj.polygon.clear();
-            obj.polygon.shrink_to_fit();
-        }
+        // Object polygons are kept: they are a few points per object and back
+        // object picking (ObjectPicker) once the segments are gone
         return freed;
     }
 };
@@ -240,6 +240,16 @@ class GCodeParser {
      */
     void reset();
 
+    /**
+     * @brief Parse an EXCLUDE_OBJECT_DEFINE line without a parser instance
+     * @param line Trimmed G-code line
+     * @param out Object with name, center and polygon (bounding box left empty)
+     * @return true if the line was a definition with a NAME
+     *
+     * Shared with GCodeLayerIndex, which collects object definitions in streaming mode.
+     */
+    static bool parse_object_definition(const std::string& line, GCodeObject& out);
+
     // Progress tracking
 
     /**
@@ -346,8 +356,8 @@ class GCodeParser {
      * @param out_value Output string
      * @return true if parameter found
      */
-    bool extract_string_param(const std::string& line, const std::string& param,
-                              std::string& out_value);
+    static bool extract_string_param(const std::string& line, const std::string& param,
+                                     std::string& out_value);
 
     /**
      * @brief Add toolpath segment to current layer
@@ -385,9 +395,10 @@ class GCodeParser {
     bool in_wipe_tower_{false};                   ///< True when inside wipe tower section
 
     // Accumulated data
-    std::vector<Layer> layers_;                  ///< All parsed layers
-    std::map<std::string, GCodeObject> objects_; ///< Object metadata
-    AABB global_bounds_;                         ///< Global bounding box
+    std::vector<Layer> layers_;                          ///< All parsed layers
+    std::map<std::string, GCodeObject> objects_;         ///< Object metadata
+    std::map<std::string, GCodeObject> segment_objects_; ///< Undefined objects seen in segments
+    AABB global_bounds_;                                 ///< Global bounding box
 
     // Parsed metadata (transferred to ParsedGCodeFile on finalize())
     std::string metadata_slicer_name_;
@@ -525,6 +536,18 @@ struct GCodeHeaderMetadata {
     std::vector<std::string> tool_colors; ///< Hex colors per tool (e.g., ["#ED1C24", "#00C1AE"])
 };
 
+/**
+ * @brief Parse one slicer metadata comment into a GCodeHeaderMetadata
+ *
+ * The per-line step of extract_header_metadata(), for callers that already
+ * read the file themselves (see analyze_gcode_file()).
+ *
+ * @param line Comment line starting with ';'
+ * @param metadata Metadata struct to update
+ * @return true if line was a valid metadata comment
+ */
+bool parse_header_metadata_line(const std::string& line, GCodeHeaderMetadata& metadata);
+
 /**
  * @brief Quick metadata extraction from G-code header only
  *
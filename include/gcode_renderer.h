@@ -4,6 +4,7 @@
 #pragma once
 
 #include "gcode_camera.h"
+#include "gcode_object_picker.h"
 #include "gcode_parser.h"
 
 #include <lvgl/lvgl.h>
@@ -293,7 +294,8 @@ class GCodeRenderer {
      * @return Object name if picked, nullopt otherwise
      *
      * Used for touch/click interaction. Casts ray from screen position
-     * through camera and tests intersection with object polygons.
+     * through camera and tests intersection with object polygons
+     * (see ObjectPicker), limited to the visible layer range.
      */
     std::optional<std::string> pick_object(const glm::vec2& screen_pos,
                                            const ParsedGCodeFile& gcode,
@@ -435,6 +437,9 @@ class GCodeRenderer {
     float z_min_{0.0f};       // Minimum Z-height for color gradient
     float z_max_{1.0f};       // Maximum Z-height for color gradient
 
+    // Object footprint index for pick_object() (synced lazily per file)
+    mutable ObjectPicker object_picker_;
+
     // Statistics (updated each frame)
     size_t segments_rendered_{0};
     size_t segments_culled_{0};
@@ -0,0 +1,174 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file gcode_response_dispatcher.h
+ * @brief Shared classifier and router for notify_gcode_response console lines
+ *
+ * Calibration collectors used to register their own notify_gcode_response
+ * callback and run substring checks and std::regex searches on every console
+ * line while active. During calibration several collectors can be active at
+ * once, so each line was scanned many times.
+ *
+ * The dispatcher registers a single callback with MoonrakerClient, scans each
+ * line once with a hand-written scanner that sets gcode_line kind bits, and
+ * only invokes subscribers whose interest mask intersects those bits. Values
+ * are extracted by the parse_* helpers below with std::from_chars instead of
+ * regex captures and std::stof.
+ *
+ * Thread safety: subscribe()/unsubscribe() may be called from any thread,
+ * including from inside a subscriber callback.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class MoonrakerClient;
+
+namespace helix {
+
+/**
+ * @brief Kind bits set by classify_gcode_line()
+ *
+ * Each bit mirrors the substring check a collector used to do itself, so
+ * routing by bit keeps the collectors' existing semantics.
+ */
+namespace gcode_line {
+constexpr uint32_t ACK = 1u << 0;                ///< Exactly "ok"
+constexpr uint32_t KLIPPER_ERROR = 1u << 1;      ///< "!! " / "Error:" prefix, or "error:"
+constexpr uint32_t MENTIONS_ERROR = 1u << 2;     ///< Contains "Error" or "error"
+constexpr uint32_t UNKNOWN_COMMAND = 1u << 3;    ///< Contains "Unknown command"
+constexpr uint32_t COMMENT = 1u << 4;            ///< Starts with "//"
+constexpr uint32_t FITTED_SHAPER = 1u << 5;      ///< "Fitted shaper '...' frequency = ..."
+constexpr uint32_t RECOMMENDED_SHAPER = 1u << 6; ///< "Recommended shaper is ..."
+constexpr uint32_t AXES_NOISE = 1u << 7;         ///< "axes_noise = ..."
+constexpr uint32_t RAW_DATA_FILE = 1u << 8;      ///< "Writing raw accelerometer data to ..."
+constexpr uint32_t PROBE_PROGRESS = 1u << 9;     ///< "Probing point N/M" or "Probe point N of M"
+constexpr uint32_t MESH_COMPLETE = 1u << 10;     ///< "Mesh bed leveling complete" (either case)
+constexpr uint32_t HELIX_PHASE = 1u << 11;       ///< Contains "HELIX:PHASE:"
+constexpr uint32_t ANY = 0xFFFFFFFFu;            ///< Subscribe to every line
+} // namespace gcode_line
+
+/**
+ * @brief Scan a console line once and return its gcode_line kind bits
+ */
+uint32_t classify_gcode_line(std::string_view line);
+
+/**
+ * @brief A console line as delivered to subscribers
+ *
+ * `text` is only valid for the duration of the callback.
+ */
+struct GCodeResponseLine {
+    std::string_view text;
+    uint32_t kinds = 0;
+
+    [[nodiscard]] bool is(uint32_t kind) const {
+        return (kinds & kind) != 0;
+    }
+};
+
+/**
+ * @brief Values from a SHAPER_CALIBRATE "Fitted shaper" line
+ */
+struct FittedShaperLine {
+    std::string type;
+    float frequency = 0.0f;
+    float vibrations = 0.0f;
+    float smoothing = 0.0f;
+};
+
+/**
+ * @brief Parse an unsigned decimal ("36.7", "0.012345", "5") with std::from_chars
+ *
+ * Consumes the longest run of digits and dots like the `[\d.]+` captures it
+ * replaces; anything after a second dot is ignored, as std::stof did.
+ *
+ * @param text Input; advanced past the consumed characters on success
+ * @param out Parsed value
+ * @return false if no digit was found
+ */
+bool parse_decimal(std::string_view& text, float& out);
+
+/// "Fitted shaper 'mzv' frequency = 36.7 Hz (vibrations = 7.2%, smoothing ~= 0.140)"
+bool parse_fitted_shaper(std::string_view line, FittedShaperLine& out);
+
+/// "Recommended shaper is mzv @ 36.7 Hz"
+bool parse_recommended_shaper(std::string_view line, std::string& type, float& frequency);
+
+/// "axes_noise = 0.012345"
+bool parse_axes_noise(std::string_view line, float& noise);
+
+/// "Probing point 5/25" or "Probe point 5 of 25"
+bool parse_probe_progress(std::string_view line, int& current, int& total);
+
+/// "Writing raw accelerometer data to /tmp/raw_data_x_helix.csv file"
+bool parse_raw_data_path(std::string_view line, std::string& path);
+
+/**
+ * @brief Routes classified console lines to interested subscribers
+ *
+ * Owned by MoonrakerClient (see MoonrakerClient::gcode_responses()). The
+ * client callback is only registered while there is at least one subscriber.
+ */
+class GCodeResponseDispatcher {
+  public:
+    using Handler = std::function<void(const GCodeResponseLine& line)>;
+    using SubscriptionId = uint64_t;
+
+    /**
+     * @param client Client to register with, or nullptr to drive dispatch() directly
+     */
+    explicit GCodeResponseDispatcher(MoonrakerClient* client = nullptr);
+
+    // The client's registered callback refers back to this object
+    GCodeResponseDispatcher(const GCodeResponseDispatcher&) = delete;
+    GCodeResponseDispatcher& operator=(const GCodeResponseDispatcher&) = delete;
+
+    /**
+     * @brief Receive lines whose kinds intersect `kinds`
+     *
+     * @param kinds gcode_line bits of interest (gcode_line::ANY for all lines)
+     * @param handler Called on the thread delivering notifications
+     * @return Subscription ID (> 0) for unsubscribe()
+     */
+    SubscriptionId subscribe(uint32_t kinds, Handler handler);
+
+    /**
+     * @brief Remove a subscription; safe from inside a handler
+     * @return true if the subscription existed
+     */
+    bool unsubscribe(SubscriptionId id);
+
+    /**
+     * @brief Classify one line and invoke matching subscribers
+     *
+     * Called from the client's notify_gcode_response callback; public for
+     * tests and benchmarks.
+     */
+    void dispatch(std::string_view line);
+
+    [[nodiscard]] size_t subscriber_count() const;
+
+  private:
+    struct Subscription {
+        SubscriptionId id;
+        uint32_t kinds;
+        Handler handler;
+    };
+
+    MoonrakerClient* client_;
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<const Subscription>> subscriptions_;
+    uint32_t interest_ = 0; ///< Union of subscribers' kinds
+    SubscriptionId next_id_ = 1;
+};
+
+} // namespace helix
@@ -13,6 +13,7 @@
 #include <chrono>
 #include <functional>
 #include <future>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -346,6 +347,12 @@ class GCodeStreamingController {
      */
     const LayerIndexStats& get_index_stats() const;
 
+    /**
+     * @brief Get object definitions found while indexing
+     * @return Objects by name (empty until indexing completes)
+     */
+    const std::map<std::string, GCodeObject>& get_objects() const;
+
     /**
      * @brief Get file size
      * @return File size in bytes, or 0 if not open
@@ -454,6 +461,7 @@ class GCodeStreamingController {
 
     // Empty stats for when not open
     static const LayerIndexStats empty_stats_;
+    static const std::map<std::string, GCodeObject> empty_objects_;
 };
 
 } // namespace gcode
@@ -0,0 +1,169 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "calibration_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file gcode_time_model.h
+ * @brief Offline print time estimate from the moves in a G-code file
+ *
+ * PrintTimeEstimator replays the moves with Klipper's motion model: feedrate
+ * capped by max_velocity, trapezoidal acceleration, and junction speeds from
+ * square_corner_velocity, planned with a lookahead window like the toolhead's.
+ * The result is a PrintTimeTable (elapsed time by file position) plus a
+ * duration per layer.
+ *
+ * Klipper's minimum_cruise_ratio (max_accel_to_decel) smoothing is left out;
+ * it only trims the peak speed of short moves.
+ *
+ * Only motion and dwells are modeled. Homing, probing and heat-up inside
+ * macros take time the file does not describe; PrinterPrintState corrects for
+ * them by comparing the table against print_stats.print_duration.
+ */
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Cumulative print time by file position
+ *
+ * Elapsed time is sampled every bucket_bytes of the file, so mapping
+ * virtual_sdcard.file_position to elapsed or remaining time is a division and
+ * a linear interpolation - cheap enough to run on every status update.
+ */
+struct PrintTimeTable {
+    uint64_t bucket_bytes = 0;    ///< File bytes between samples
+    std::vector<float> elapsed_s; ///< Elapsed time at byte k * bucket_bytes; last is the total
+
+    [[nodiscard]] bool empty() const {
+        return elapsed_s.empty();
+    }
+
+    /// Estimated total print time in seconds
+    [[nodiscard]] float total_s() const {
+        return elapsed_s.empty() ? 0.0f : elapsed_s.back();
+    }
+
+    /// Estimated time to reach @p file_position from the start of the file
+    [[nodiscard]] float elapsed_at(uint64_t file_position) const;
+
+    /// Estimated time from @p file_position to the end of the file
+    [[nodiscard]] float remaining_at(uint64_t file_position) const;
+};
+
+/**
+ * @brief Streaming print time estimator
+ *
+ * Fed one move at a time in file order (see analyze_gcode_file()); moves are
+ * buffered and planned in batches, with a tail carried over so speeds through
+ * batch boundaries match an unbroken plan.
+ *
+ * Planning works on per-move arrays (distance, acceleration, speed limits)
+ * with branch-free inner loops the compiler can vectorize.
+ */
+class PrintTimeEstimator {
+  public:
+    /// Layer index for moves before the first layer (not counted in any layer)
+    static constexpr uint32_t NO_LAYER = UINT32_MAX;
+
+    /// Maximum samples in a PrintTimeTable (bucket size grows with the file)
+    static constexpr size_t MAX_TABLE_SAMPLES = 4096;
+
+    /// Limits used in place of missing (zero) printer limits
+    static MachineLimits default_limits();
+
+    /**
+     * @param limits Printer limits from the toolhead; zero fields use default_limits()
+     * @param file_size Size of the file, for the table's sample spacing
+     */
+    PrintTimeEstimator(const MachineLimits& limits, uint64_t file_size);
+
+    /**
+     * @brief Add a move
+     *
+     * @param dx,dy,dz Toolhead displacement in mm
+     * @param de Extruder displacement in mm (extrude-only moves use it as distance)
+     * @param feedrate Requested speed in mm/s
+     * @param file_offset Byte offset of the move's line
+     * @param layer Layer the move belongs to, or NO_LAYER
+     */
+    void add_move(float dx, float dy, float dz, float de, float feedrate, uint64_t file_offset,
+                  uint32_t layer);
+
+    /// G4: the toolhead stops, then waits
+    void add_dwell(float seconds, uint64_t file_offset, uint32_t layer);
+
+    /// M204 / SET_VELOCITY_LIMIT ACCEL=
+    void set_accel(float accel);
+
+    /// SET_VELOCITY_LIMIT VELOCITY=
+    void set_max_velocity(float velocity);
+
+    /// SET_VELOCITY_LIMIT SQUARE_CORNER_VELOCITY=
+    void set_square_corner_velocity(float scv);
+
+    /// Plan the remaining moves (ending at rest) and close the table
+    void finish();
+
+    [[nodiscard]] const PrintTimeTable& table() const {
+        return table_;
+    }
+
+    /// Estimated seconds per layer, indexed by layer
+    [[nodiscard]] const std::vector<float>& layer_durations() const {
+        return layer_durations_;
+    }
+
+  private:
+    /// Moves planned per batch, and moves held back for the next batch
+    static constexpr size_t LOOKAHEAD_MOVES = 1024;
+    static constexpr size_t LOOKAHEAD_TAIL = 64;
+
+    void plan(bool final_stop);
+    void commit(float seconds, uint64_t file_offset, uint32_t layer);
+    void update_junction_deviation();
+
+    float max_velocity_;
+    float max_accel_;
+    float max_z_velocity_;
+    float max_z_accel_;
+    float square_corner_velocity_;
+    float junction_deviation_ = 0.0f;
+
+    // Buffered moves, one entry per move in each array
+    std::vector<float> distance_;
+    std::vector<float> accel_;
+    std::vector<float> cruise_v2_;   ///< Square of the move's top speed
+    std::vector<float> junction_v2_; ///< Square of the top speed entering the move
+    std::vector<uint64_t> offset_;
+    std::vector<uint32_t> layer_;
+
+    // Planning scratch, sized with the buffer
+    std::vector<float> start_v2_;
+    std::vector<float> end_v2_;
+    std::vector<float> time_s_;
+
+    float carry_v2_ = 0.0f; ///< Square of the speed entering the first buffered move
+
+    // Previous move, for the junction with the next one
+    bool have_prev_ = false;
+    float prev_dir_[3] = {0.0f, 0.0f, 0.0f};
+    float prev_cruise_v2_ = 0.0f;
+    float prev_accel_ = 0.0f;
+    float prev_distance_ = 0.0f;
+    float prev_junction_deviation_ = 0.0f;
+
+    double elapsed_ = 0.0; ///< Double: hours of millisecond moves would lose float precision
+    uint64_t file_size_;
+    PrintTimeTable table_;
+    std::vector<float> layer_durations_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -8,6 +8,7 @@
 
 #include "gcode_camera.h"
 #include "gcode_geometry_builder.h"
+#include "gcode_object_picker.h"
 #include "gcode_parser.h"
 
 #include <lvgl/lvgl.h>
@@ -17,6 +18,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 namespace helix {
 namespace gcode {
@@ -98,6 +100,9 @@ class GCodeTinyGLRenderer {
     /**
      * @brief Set filament color from hex string
      * @param hex_color Color in hex format (e.g., "#26A69A")
+     *
+     * Recolors loaded geometry through its palette (no rebuild) and is kept
+     * for geometry loaded later.
      */
     void set_filament_color(const std::string& hex_color);
 
@@ -189,6 +194,9 @@ class GCodeTinyGLRenderer {
      * @param gcode Parsed G-code file
      * @param camera Current camera
      * @return Object name if picked, nullopt otherwise
+     *
+     * Uses an ObjectPicker built from the file's object definitions, so it
+     * does not walk segments and still works after clear_segments().
      */
     std::optional<std::string> pick_object(const glm::vec2& screen_pos,
                                            const ParsedGCodeFile& gcode,
@@ -222,6 +230,8 @@ class GCodeTinyGLRenderer {
     /**
      * @brief Set highlighted object names (multi-select support)
      * @param names Set of objects to highlight (empty to clear all)
+     *
+     * Applied as a per-object palette at render time; geometry is not rebuilt.
      */
     void set_highlighted_objects(const std::unordered_set<std::string>& names);
 
@@ -229,8 +239,8 @@ class GCodeTinyGLRenderer {
      * @brief Set excluded objects
      * @param names Set of object names that are excluded from print
      *
-     * Excluded objects are rendered with a red/orange color at reduced opacity
-     * to indicate they won't be printed.
+     * Excluded objects are rendered dimmed and tinted red to indicate they
+     * won't be printed. Like highlighting, this is a render-time palette change.
      */
     void set_excluded_objects(const std::unordered_set<std::string>& names);
 
@@ -407,6 +417,36 @@ class GCodeTinyGLRenderer {
      */
     void render_layer_range(int start_layer, int end_layer, float dim_factor);
 
+    // ==============================================
+    // Per-Object Palettes
+    // ==============================================
+
+    /**
+     * @brief Render-time colors for one RibbonGeometry
+     *
+     * Vertices keep the base color index baked at build time. Each object slot
+     * selects one of the tinted copies of the color palette, so highlight,
+     * exclude and filament recolor cost O(objects + palette entries) instead of
+     * a full GeometryBuilder::build().
+     */
+    struct ObjectPalettes {
+        enum Tint : uint8_t { NORMAL = 0, HIGHLIGHTED, EXCLUDED, TINT_COUNT };
+
+        std::array<std::vector<uint32_t>, TINT_COUNT> tinted; ///< color_palette per tint
+        std::vector<uint8_t> object_tint; ///< Tint per object slot (parallel to object_names)
+        bool dirty{true};                 ///< Rebuild before next render
+    };
+
+    /**
+     * @brief Rebuild palettes from the highlight/exclude sets and filament color
+     */
+    void update_object_palettes(const RibbonGeometry& geometry, ObjectPalettes& palettes) const;
+
+    /**
+     * @brief Mark both geometries' palettes stale and force a re-render
+     */
+    void invalidate_object_palettes();
+
     // ==============================================
     // Frustum Culling
     // ==============================================
@@ -436,6 +476,9 @@ class GCodeTinyGLRenderer {
      */
     bool is_aabb_visible(const AABB& bbox) const;
 
+    /// Object footprint index for pick_object() (synced lazily per file)
+    mutable ObjectPicker object_picker_;
+
     /// Frustum culling statistics (for logging)
     mutable size_t frustum_culled_layers_{0};
     mutable size_t frustum_visible_layers_{0};
@@ -504,6 +547,10 @@ class GCodeTinyGLRenderer {
     std::optional<RibbonGeometry> geometry_;        ///< Full detail geometry (for static view)
     std::optional<RibbonGeometry> coarse_geometry_; ///< Coarse LOD (for interaction)
     RibbonGeometry* active_geometry_{nullptr}; ///< Currently rendering geometry (set per-frame)
+    ObjectPalettes palettes_;                  ///< Object palettes for geometry_
+    ObjectPalettes coarse_palettes_;           ///< Object palettes for coarse_geometry_
+    const ObjectPalettes* active_palettes_{nullptr}; ///< Palettes of active_geometry_
+    std::optional<uint32_t> filament_color_override_; ///< From set_filament_color()
     std::string current_gcode_filename_;       // Track if we need to rebuild
 
     /// Use LOD geometry during interaction (Phase 6 optimization)
@@ -15,12 +15,22 @@
  *
  * This is a state machine that coordinates MoonrakerAPI calls and
  * provides progress/error callbacks to the UI layer.
+ *
+ * When helix-screen runs on the printer itself, resonance tests record raw
+ * accelerometer data and are analyzed on-device (see shaper_analysis.h),
+ * which keeps the full spectrum for charting and re-fitting.
  */
 
 #include "calibration_types.h"
+#include "shaper_analysis.h"
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Forward declaration
 class MoonrakerAPI;
@@ -129,15 +139,15 @@ class InputShaperCalibrator {
     explicit InputShaperCalibrator(MoonrakerAPI* api);
 
     /**
-     * @brief Destructor
+     * @brief Destructor - waits for a running on-device analysis
      */
-    ~InputShaperCalibrator() = default;
+    ~InputShaperCalibrator();
 
-    // Non-copyable, movable
+    // Non-copyable, movable (an in-flight analysis stays with the moved-from object)
     InputShaperCalibrator(const InputShaperCalibrator&) = delete;
     InputShaperCalibrator& operator=(const InputShaperCalibrator&) = delete;
-    InputShaperCalibrator(InputShaperCalibrator&&) = default;
-    InputShaperCalibrator& operator=(InputShaperCalibrator&&) = default;
+    InputShaperCalibrator(InputShaperCalibrator&& other) noexcept;
+    InputShaperCalibrator& operator=(InputShaperCalibrator&& other) noexcept;
 
     /**
      * @brief Get current calibrator state
@@ -158,11 +168,28 @@ class InputShaperCalibrator {
      */
     void check_accelerometer(AccelCheckCallback on_complete, ErrorCallback on_error = nullptr);
 
+    /**
+     * @brief Analyze resonance tests on-device instead of via SHAPER_CALIBRATE
+     *
+     * Unless overridden here, enabled when Moonraker is on localhost, since
+     * Klipper's raw data files must be readable from this process.
+     */
+    void set_local_analysis(bool enabled) {
+        local_analysis_override_ = enabled;
+    }
+
+    /**
+     * @brief Whether the next run_calibration() analyzes on-device
+     */
+    [[nodiscard]] bool local_analysis() const;
+
     /**
      * @brief Run resonance calibration on specified axis
      *
      * Executes SHAPER_CALIBRATE for the specified axis, collecting
      * frequency response data and all fitted shaper alternatives.
+     * With local analysis, runs TEST_RESONANCES OUTPUT=raw_data and fits the
+     * shapers here on a worker thread; callbacks still arrive on the UI thread.
      *
      * @param axis Axis to test ('X' or 'Y')
      * @param on_progress Called with percentage (0-100) during test
@@ -190,6 +217,18 @@ class InputShaperCalibrator {
         return results_;
     }
 
+    /**
+     * @brief Re-fit a stored axis result with different options
+     *
+     * Uses the spectrum kept in the result's freq_response, so no new test is
+     * needed. Results parsed from SHAPER_CALIBRATE output carry no spectrum.
+     *
+     * @param axis Axis to re-fit ('X' or 'Y')
+     * @param options Fit options (e.g. max_smoothing)
+     * @return true if the stored result was updated
+     */
+    bool refit(char axis, const ShaperFitOptions& options);
+
     /**
      * @brief Apply input shaper settings to printer
      *
@@ -213,9 +252,23 @@ class InputShaperCalibrator {
     void save_to_config(SuccessCallback on_success, ErrorCallback on_error);
 
   private:
+    /// Store an axis result and advance the state machine
+    void store_result(char axis, const InputShaperResult& result);
+
+    /// Fit captured raw data on analysis_thread_ and report on the UI thread
+    void analyze_captured_data(char axis, const std::vector<std::string>& csv_paths,
+                               ResultCallback on_complete, ErrorCallback on_error);
+
+    void join_analysis();
+
     MoonrakerAPI* api_ = nullptr; ///< Non-owning pointer to API
     State state_ = State::IDLE;
     CalibrationResults results_;
+    std::optional<bool> local_analysis_override_;
+
+    /// Cleared on destruction so queued analysis results are dropped [L012]
+    std::shared_ptr<std::atomic<bool>> alive_ = std::make_shared<std::atomic<bool>>(true);
+    std::thread analysis_thread_;
 };
 
 } // namespace calibration
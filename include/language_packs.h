@@ -0,0 +1,113 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "translation_catalog.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file language_packs.h
+ * @brief Loads the active UI language on demand and hot-swaps it
+ *
+ * Only the active language's catalog is mapped (see translation_catalog.h).
+ * Its translated strings are registered with LVGL as a single-language static
+ * pack that points straight into the mapping, and switching language repoints
+ * that pack at the new catalog before unmapping the old one. English is never
+ * loaded: translation tags are the English text, which LVGL returns for any
+ * tag a pack does not translate, so identity entries are left out entirely.
+ *
+ * When no catalog is found for a language (development runs from the source
+ * tree, where catalogs are not generated) this falls back to registering
+ * ui_xml/translations/translations.xml, which holds every language.
+ *
+ * HELIX_TRANSLATION_CATALOGS=0 forces the XML fallback; any other value
+ * overrides the catalog directory.
+ *
+ * ## Usage:
+ * @code
+ * LanguagePacks::instance().set_language("de"); // also sends LVGL's change event
+ * @endcode
+ *
+ * @threading Main thread only (LVGL translation state is not thread-safe)
+ */
+
+namespace helix {
+
+class LanguagePacks {
+  public:
+    /// Default install-relative catalog directory (<dir>/<locale>.bin)
+    static constexpr const char* DEFAULT_DIR = "assets/translations";
+
+    /// LVGL path of the all-languages fallback
+    static constexpr const char* FALLBACK_XML = "A:ui_xml/translations/translations.xml";
+
+    static LanguagePacks& instance();
+
+    LanguagePacks(const LanguagePacks&) = delete;
+    LanguagePacks& operator=(const LanguagePacks&) = delete;
+
+    /**
+     * @brief Load a language and make it LVGL's active language
+     *
+     * Maps the language's catalog (falling back to translations.xml if it has
+     * none), then calls lv_translation_set_language() so every widget with a
+     * translation tag refreshes.
+     *
+     * @param lang Language code (e.g. "de")
+     * @return false if neither a catalog nor the XML fallback could be loaded
+     *         (the UI then shows English)
+     */
+    bool set_language(const std::string& lang);
+
+    /// Language passed to the last set_language()
+    [[nodiscard]] const std::string& language() const {
+        return language_;
+    }
+
+    /// True when the active language comes from a mapped catalog
+    [[nodiscard]] bool using_catalog() const {
+        return catalog_.is_open();
+    }
+
+    /// Unregister (as far as LVGL allows) and unmap the active catalog
+    void unload();
+
+  private:
+    LanguagePacks() = default;
+    ~LanguagePacks();
+
+    /**
+     * @brief Pointer arrays handed to lv_translation_add_static()
+     *
+     * LVGL keeps these pointers, so the vectors are sized once and refilled in
+     * place on every swap. LVGL has no API to remove a pack; one that is too
+     * small for a new catalog is retired by blanking its language name, which
+     * no longer matches any lookup.
+     */
+    struct StaticPack {
+        char language[16] = {};
+        const char* languages[2] = {language, nullptr};
+        std::vector<const char*> tags;
+        std::vector<const char*> translations;
+    };
+
+    [[nodiscard]] std::string catalog_path(const std::string& lang) const;
+    void install_catalog(TranslationCatalog&& catalog, const std::string& lang);
+    void blank_pack();
+    bool ensure_fallback_xml();
+
+    TranslationCatalog catalog_;
+    std::unique_ptr<StaticPack> pack_;
+    std::vector<std::unique_ptr<StaticPack>> retired_packs_;
+    std::string language_;
+    bool env_checked_ = false;
+    bool catalogs_disabled_ = false;
+    std::string catalog_dir_ = DEFAULT_DIR;
+    bool fallback_xml_loaded_ = false;
+};
+
+} // namespace helix
@@ -35,6 +35,16 @@ struct LogConfig {
     bool enable_console = true;         ///< Always show console output
     LogTarget target = LogTarget::Auto; ///< System log destination
     std::string file_path;              ///< Override file path (empty = auto)
+
+    /// Hand console/system output to a writer thread via a bounded queue.
+    /// When full, the oldest queued message is dropped rather than blocking.
+    bool async = false;
+    size_t async_queue_size = 8192; ///< Queued messages (async only)
+
+    /// Flight recorder ring size in KB (0 = disabled). See FlightRecorder.
+    size_t flight_recorder_kb = 0;
+    spdlog::level::level_enum flight_recorder_level = spdlog::level::trace;
+    std::string flight_recorder_path; ///< Empty = default_flight_recorder_path()
 };
 
 /**
@@ -52,10 +62,32 @@ void init_early();
  * Call once at startup before any log calls. Creates a multi-sink logger
  * that writes to both console (if enabled) and the selected system target.
  *
+ * With a flight recorder, the logger itself runs at flight_recorder_level and
+ * the console/system sinks filter at config.level, so trace lines reach only
+ * the in-memory ring. With async, console/system sinks run on a dedicated
+ * writer thread; the flight recorder is always written inline so nothing
+ * queued is lost on a crash.
+ *
  * @param config Logging configuration
  */
 void init(const LogConfig& config);
 
+/**
+ * @brief Flush and drain the async writer queue before exit
+ *
+ * Waits up to ~1 s for queued messages to be written. The writer thread
+ * stays alive, so logging afterwards still works. Safe to call twice.
+ */
+void shutdown();
+
+/**
+ * @brief Level of the console/system output
+ *
+ * Use this instead of spdlog::get_level() to decide whether the user asked
+ * for verbose output: the logger level may be lower to feed the flight recorder.
+ */
+spdlog::level::level_enum output_level();
+
 /**
  * @brief Parse log target from string
  *
@@ -654,6 +654,7 @@ class MoonrakerAPI {
      *
      * Uses HTTP Range request to fetch only the beginning of a file.
      * Ideal for scanning G-code files where operations are in the preamble.
+     * The content never exceeds max_bytes, even if the server ignores Range.
      *
      * @param root Root directory ("gcodes", "config", etc.)
      * @param path File path relative to root
@@ -896,6 +897,8 @@ class MoonrakerAPI {
      *
      * Called by MoonrakerClient when bed_mesh data is received from
      * Moonraker subscriptions. Parses the JSON and updates local storage.
+     * Meshes whose content hash matches what is already stored are not
+     * re-parsed, and their BedMeshProfile (including stats) stays in place.
      *
      * Thread-safe: Uses internal mutex for synchronization.
      *
@@ -932,6 +935,15 @@ class MoonrakerAPI {
      */
     const BedMeshProfile* get_bed_mesh_profile(const std::string& profile_name) const;
 
+    /**
+     * @brief Number of meshes parsed from bed_mesh updates so far
+     *
+     * update_bed_mesh() only parses a mesh (and computes its stats) when its
+     * content hash changes; repeats of known meshes do not count. For
+     * diagnostics and tests.
+     */
+    size_t bed_mesh_parse_count() const;
+
     /**
      * @brief Get set of currently excluded object names (async)
      *
@@ -1085,6 +1097,24 @@ class MoonrakerAPI {
     virtual void start_resonance_test(char axis, AdvancedProgressCallback on_progress,
                                       InputShaperCallback on_complete, ErrorCallback on_error);
 
+    /// Callback with the raw accelerometer CSV files written by TEST_RESONANCES
+    using ResonanceDataCallback = std::function<void(const std::vector<std::string>& csv_paths)>;
+
+    /**
+     * @brief Record raw accelerometer data for on-device analysis
+     *
+     * Executes TEST_RESONANCES AXIS=<axis> OUTPUT=raw_data NAME=helix and
+     * reports the CSV files Klipper wrote. The paths are on the Klipper host,
+     * so they are only readable when helix-screen runs on the printer; analyze
+     * them with helix::calibration::analyze_resonance_files().
+     *
+     * @param axis Axis to test ('X' or 'Y')
+     * @param on_complete Called with the CSV paths once the test finishes
+     * @param on_error Called on failure
+     */
+    virtual void capture_resonance_data(char axis, ResonanceDataCallback on_complete,
+                                        ErrorCallback on_error);
+
     /**
      * @brief Start Klippain Shake&Tune calibration
      *
@@ -1244,6 +1274,19 @@ class MoonrakerAPI {
      */
     virtual void get_machine_limits(MachineLimitsCallback on_success, ErrorCallback on_error);
 
+    /**
+     * @brief Get the machine limits from the [printer] config section
+     *
+     * Unlike get_machine_limits(), not affected by M204 or SET_VELOCITY_LIMIT,
+     * so it suits values that are cached, such as print time estimates.
+     * Limits missing from the config are left at 0.
+     *
+     * @param on_success Called with configured limits
+     * @param on_error Called on failure
+     */
+    virtual void get_configured_machine_limits(MachineLimitsCallback on_success,
+                                               ErrorCallback on_error);
+
     /**
      * @brief Set machine limits (temporary, not saved to config)
      *
@@ -1316,6 +1359,7 @@ class MoonrakerAPI {
     BedMeshProfile active_bed_mesh_;
     std::vector<std::string> bed_mesh_profiles_;
     std::map<std::string, BedMeshProfile> stored_bed_mesh_profiles_; // All profiles with mesh data
+    size_t bed_mesh_parse_count_ = 0; ///< Cache misses in update_bed_mesh()
     mutable std::mutex bed_mesh_mutex_;
 
     // Track pending HTTP request threads to ensure clean shutdown
@@ -36,19 +36,24 @@
 
 #pragma once
 
+#include "gcode_response_dispatcher.h"
 #include "hv/WebSocketClient.h"
 #include "moonraker_domain_service.h"
 #include "moonraker_error.h"
 #include "moonraker_events.h"
 #include "moonraker_request.h"
+#include "moonraker_traffic_recorder.h"
 #include "printer_detector.h" // For BuildVolume struct
 #include "printer_discovery.h"
 #include "spdlog/spdlog.h"
+#include "status_delta.h"
+#include "subscription_profile.h"
 
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -60,11 +65,15 @@ using json = nlohmann::json;
 /**
  * @brief Unique identifier for notification subscriptions
  *
- * Used to track and remove subscriptions registered via register_notify_update().
+ * Used to track and remove subscriptions registered via register_notify_update()
+ * or register_status_update().
  * Valid IDs are always > 0; ID 0 indicates invalid/unsubscribed.
  */
 using SubscriptionId = uint64_t;
 
+/** @brief Receives decoded notify_status_update deltas (shared, never modified) */
+using StatusUpdateCallback = std::function<void(const std::shared_ptr<const helix::StatusDelta>&)>;
+
 /** @brief Invalid subscription ID constant */
 constexpr SubscriptionId INVALID_SUBSCRIPTION_ID = 0;
 
@@ -180,13 +189,28 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     SubscriptionId register_notify_update(std::function<void(json)> cb);
 
+    /**
+     * @brief Register callback for decoded status updates
+     *
+     * Preferred over register_notify_update() for status consumers: frames are
+     * decoded into a helix::StatusDelta without building a JSON DOM, and the
+     * notification JSON is only rebuilt while JSON subscribers exist. The
+     * delta is shared between subscribers and can be handed to another thread
+     * as is.
+     *
+     * @param cb Callback receiving the decoded delta
+     * @return Subscription ID for unsubscribe_notify_update() (0 = invalid/failed)
+     */
+    SubscriptionId register_status_update(StatusUpdateCallback cb);
+
     /**
      * @brief Unsubscribe from status update notifications
      *
      * Removes a previously registered notification callback.
      * Safe to call with invalid IDs (no-op).
      *
-     * @param id Subscription ID returned by register_notify_update()
+     * @param id Subscription ID returned by register_notify_update() or
+     *           register_status_update()
      * @return true if subscription was found and removed, false otherwise
      */
     bool unsubscribe_notify_update(SubscriptionId id);
@@ -216,6 +240,24 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     bool unregister_method_callback(const std::string& method, const std::string& handler_name);
 
+    /**
+     * @brief Shared router for notify_gcode_response console lines
+     *
+     * Collectors that look for specific console output subscribe here instead
+     * of registering their own method callback, so each line is classified
+     * once however many collectors are active.
+     */
+    helix::GCodeResponseDispatcher& gcode_responses() {
+        return gcode_responses_;
+    }
+
+    /**
+     * @brief printer.objects.subscribe profile and status traffic counters
+     */
+    helix::SubscriptionManager& subscriptions() {
+        return subscriptions_;
+    }
+
     /**
      * @brief Send JSON-RPC request without parameters
      *
@@ -526,6 +568,21 @@ class MoonrakerClient : public hv::WebSocketClient {
         check_request_timeouts();
     }
 
+    /**
+     * @brief Record every websocket frame sent and received to a file
+     *
+     * Recordings replay through MoonrakerReplayServer for load benchmarks.
+     *
+     * @param path Output file (truncated)
+     * @return false if the file could not be created
+     */
+    bool start_traffic_recording(const std::string& path);
+
+    /**
+     * @brief Stop recording and close the file
+     */
+    void stop_traffic_recording();
+
     // ========== Simulation Methods (for testing) ==========
 
     /**
@@ -560,6 +617,20 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     void dispatch_status_update(const json& status);
 
+    /**
+     * @brief Deliver a status delta to typed and JSON subscribers
+     *
+     * Parses bed mesh data first, like the websocket handler always has. JSON
+     * subscribers get `notification` if given, otherwise JSON rebuilt from the
+     * delta (only when there are any).
+     *
+     * @param delta Decoded status update
+     * @param notification Original notification JSON, if the caller has one
+     * @return Number of callbacks invoked
+     */
+    size_t dispatch_status_delta(const std::shared_ptr<const helix::StatusDelta>& delta,
+                                 const json* notification = nullptr);
+
     /**
      * @brief Emit event to registered handler
      *
@@ -574,6 +645,11 @@ class MoonrakerClient : public hv::WebSocketClient {
                     const std::string& details = "");
 
   private:
+    /**
+     * @brief Send a frame on the websocket, recording it if enabled
+     */
+    int send_frame(const std::string& frame);
+
     /**
      * @brief Check for timed out requests and invoke error callbacks
      */
@@ -606,6 +682,14 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     void complete_discovery_subscription(std::function<void()> on_complete);
 
+    /**
+     * @brief Base subscription profile for the discovered objects
+     *
+     * Objects whose consumers are known get explicit field lists; everything
+     * else subscribes to all fields.
+     */
+    [[nodiscard]] helix::SubscriptionProfile build_base_subscription_profile() const;
+
   protected:
     // Auto-discovered printer objects (protected to allow mock access)
     std::vector<std::string> heaters_;     // Controllable heaters (extruders, bed, etc.)
@@ -630,13 +714,22 @@ class MoonrakerClient : public hv::WebSocketClient {
     // Notification callbacks (protected to allow mock to trigger notifications)
     // Map of subscription ID -> callback for O(1) unsubscription
     std::map<SubscriptionId, std::function<void(json)>> notify_callbacks_;
+    // Decoded status subscribers; IDs shared with notify_callbacks_
+    std::map<SubscriptionId, StatusUpdateCallback> status_callbacks_;
     std::atomic<SubscriptionId> next_subscription_id_{1}; // Start at 1 (0 = invalid)
-    std::mutex callbacks_mutex_; // Protect notify_callbacks_ and method_callbacks_
+    std::mutex callbacks_mutex_; // Protect the callback maps
 
     // Persistent method-specific callbacks (protected to allow mock to dispatch)
     // method_name : { handler_name : callback }
     std::map<std::string, std::map<std::string, std::function<void(json)>>> method_callbacks_;
 
+    // Registers itself in method_callbacks_ while it has subscribers; declared
+    // after the callback maps so it is destroyed before them
+    helix::GCodeResponseDispatcher gcode_responses_{this};
+
+    // Field-level subscription profile installed at discovery
+    helix::SubscriptionManager subscriptions_;
+
   private:
     // Pending requests keyed by request ID
     std::map<uint64_t, PendingRequest> pending_requests_;
@@ -673,6 +766,10 @@ class MoonrakerClient : public hv::WebSocketClient {
     std::function<void()> last_discovery_complete_; // Callback from last discover_printer()
     mutable std::mutex reconnect_mutex_;            // Protect stored connection info
 
+    // Traffic capture for replay benchmarks (flag avoids the recorder lock when off)
+    helix::TrafficRecorder traffic_recorder_;
+    std::atomic_bool recording_traffic_{false};
+
     // Event handler for transport events (decouples from UI layer)
     MoonrakerEventCallback event_handler_;
     mutable std::mutex event_handler_mutex_;
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include "bed_mesh_stats.h"
+
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -22,6 +25,8 @@ struct BedMeshProfile {
     int x_count;                                   ///< Probes per row
     int y_count;                                   ///< Number of rows
     std::string algo;                              ///< Interpolation algorithm
+    helix::BedMeshStats stats;                     ///< Computed once per distinct mesh
+    uint64_t content_hash = 0;                     ///< Source JSON hash (0 = built locally)
 
     BedMeshProfile() : mesh_min{0, 0}, mesh_max{0, 0}, x_count(0), y_count(0) {}
 };
@@ -188,8 +188,13 @@ class MoonrakerManager {
     std::unique_ptr<MoonrakerClient> m_client;
     std::unique_ptr<MoonrakerAPI> m_api;
 
-    // Thread-safe notification queue
-    std::queue<nlohmann::json> m_notification_queue;
+    // Thread-safe notification queue: connection state changes and decoded
+    // status updates, in arrival order
+    struct QueuedNotification {
+        nlohmann::json connection_state;
+        std::shared_ptr<const helix::StatusDelta> status;
+    };
+    std::queue<QueuedNotification> m_notification_queue;
     mutable std::mutex m_notification_mutex;
 
     // Print start collector (monitors PRINT_START macro progress)
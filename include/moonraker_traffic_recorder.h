@@ -0,0 +1,109 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file moonraker_traffic_recorder.h
+ * @brief Capture of Moonraker websocket traffic for replay benchmarks
+ *
+ * MoonrakerClientMock synthesises printer state, but it does not reproduce
+ * what a busy Klipper actually sends: bursts of status updates, large
+ * gcode_response floods, proc_stat ticks. TrafficRecorder writes every frame
+ * MoonrakerClient sends and receives, with a timestamp, so a session can be
+ * replayed later (see tests/mocks/moonraker_replay_server.h).
+ *
+ * File format (little endian):
+ * @code
+ *   "HXTR" magic, uint16 version
+ *   per frame: varint delta_us since previous frame, uint8 direction,
+ *              varint payload length, payload bytes
+ * @endcode
+ *
+ * Enable in the app with HELIX_RECORD_TRAFFIC=/path/to/session.hxtr.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace helix {
+
+/**
+ * @brief One recorded websocket frame
+ */
+struct TrafficFrame {
+    enum class Direction : uint8_t {
+        RECEIVED = 0, ///< Moonraker -> client (responses and notifications)
+        SENT = 1,     ///< Client -> Moonraker (JSON-RPC requests)
+    };
+
+    uint64_t timestamp_us = 0; ///< Microseconds since recording started
+    Direction direction = Direction::RECEIVED;
+    std::string payload;
+};
+
+/**
+ * @brief Thread-safe writer for traffic recordings
+ *
+ * record() is called from the libhv event loop (received frames) and from
+ * whichever thread sends a request, so writes are serialised by a mutex.
+ */
+class TrafficRecorder {
+  public:
+    static constexpr char MAGIC[4] = {'H', 'X', 'T', 'R'};
+    static constexpr uint16_t VERSION = 1;
+
+    TrafficRecorder() = default;
+    ~TrafficRecorder();
+
+    TrafficRecorder(const TrafficRecorder&) = delete;
+    TrafficRecorder& operator=(const TrafficRecorder&) = delete;
+
+    /**
+     * @brief Start a new recording, truncating any existing file
+     * @param path Output file
+     * @return false if the file could not be created
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Flush and close the recording
+     */
+    void close();
+
+    bool is_open() const;
+
+    /**
+     * @brief Append a frame (no-op when not open)
+     */
+    void record(TrafficFrame::Direction direction, const std::string& payload);
+
+    /**
+     * @brief Frames written since open()
+     */
+    size_t frame_count() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::ofstream out_;
+    std::string path_;
+    std::chrono::steady_clock::time_point start_;
+    uint64_t last_timestamp_us_ = 0;
+    size_t frame_count_ = 0;
+};
+
+/**
+ * @brief Read a recording written by TrafficRecorder
+ *
+ * @param path Recording file
+ * @param[out] frames Frames in recorded order
+ * @return false if the file is missing, has a bad header, or is truncated
+ *         (frames read before the truncation are kept)
+ */
+bool load_traffic_recording(const std::string& path, std::vector<TrafficFrame>& frames);
+
+} // namespace helix
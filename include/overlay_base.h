@@ -164,6 +164,28 @@ class OverlayBase : public IPanelLifecycle {
      */
     virtual void cleanup();
 
+    /**
+     * @brief Whether the widget tree may be destroyed while hidden
+     *
+     * Evictable overlays opened through lazy_create_and_push_overlay() are
+     * registered with NavigationManager::evict_cold_overlays(). Subjects and
+     * callbacks survive eviction; create() rebuilds the widgets on the next
+     * navigation. Overrides must also implement on_evict().
+     *
+     * @return false by default
+     */
+    virtual bool is_evictable() const {
+        return false;
+    }
+
+    /**
+     * @brief Destroy the widget tree, keeping subjects and callbacks
+     *
+     * Calls on_evict(), unregisters from NavigationManager and deletes
+     * overlay_root_. The overlay must not be in the navigation stack.
+     */
+    void evict();
+
     //
     // === State Queries ===
     //
@@ -231,6 +253,13 @@ class OverlayBase : public IPanelLifecycle {
      */
     lv_obj_t* create_overlay_from_xml(lv_obj_t* parent, const char* component_name);
 
+    /**
+     * @brief Drop cached widget pointers before the tree is evicted
+     *
+     * Called by evict() while the widgets still exist. Default does nothing.
+     */
+    virtual void on_evict() {}
+
     //
     // === Protected State ===
     //
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "print_history_data.h"
+#include "print_history_rollups.h"
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -42,9 +44,10 @@ using HistoryChangedCallback = std::function<void()>;
  *
  * ## Data Views
  *
- * Two views of the same cached data:
- * 1. **Raw jobs list** (`get_jobs()`) - For HistoryDashboardPanel, HistoryListPanel
+ * Three views of the same cached data:
+ * 1. **Raw jobs list** (`get_jobs()`) - For HistoryListPanel
  * 2. **Filename stats map** (`get_filename_stats()`) - For PrintSelectPanel status indicators
+ * 3. **Time-bucketed rollups** (`get_rollups()`) - For HistoryDashboardPanel stats and charts
  *
  * ## Usage Example
  *
@@ -63,16 +66,30 @@ using HistoryChangedCallback = std::function<void()>;
  * update_from_history();
  * ```
  *
- * ## Cache Invalidation
+ * ## Incremental Sync
  *
- * The manager subscribes to Moonraker's `notify_history_changed` notification
- * and automatically invalidates + re-fetches when a print completes.
+ * The first fetch downloads up to `limit` jobs. Later fetches (including the
+ * automatic one on Moonraker's `notify_history_changed`) only request jobs
+ * started since the newest cached job, or the oldest one still in progress,
+ * and merge them by job_id. Rollups and filename stats are updated from the
+ * merged jobs instead of being rebuilt from scratch.
+ *
+ * Incremental fetches never see jobs deleted by other clients (Mainsail,
+ * Fluidd) or while the screen was offline. The first fetch, fetches after
+ * request_full_sync() (called on every (re)connect) and the first fetch after
+ * FULL_SYNC_INTERVAL replace the cache with a full download instead.
+ *
+ * With set_cache_file(), the job cache is persisted locally so history is
+ * available immediately after a restart, before the first full sync.
  *
  * @see PrintHistoryStats for per-file aggregation structure
  * @see PrintHistoryJob for raw job data structure
  */
 class PrintHistoryManager {
   public:
+    /// Longest time between full downloads, which drop jobs deleted elsewhere
+    static constexpr std::chrono::hours FULL_SYNC_INTERVAL{6};
+
     /**
      * @brief Construct PrintHistoryManager with API and client references
      *
@@ -116,11 +133,18 @@ class PrintHistoryManager {
         return is_loaded_;
     }
 
+    /**
+     * @brief Get pre-aggregated counts, durations and filament by time bucket
+     */
+    [[nodiscard]] const PrintHistoryRollups& get_rollups() const {
+        return rollups_;
+    }
+
     /**
      * @brief Get jobs filtered by start time
      *
      * Returns jobs where `start_time >= since`. Used by HistoryDashboardPanel
-     * for time-based filtering (TODAY, WEEK, MONTH, etc.).
+     * to hand the filtered list to HistoryListPanel.
      *
      * @param since Unix timestamp threshold (jobs before this are excluded)
      * @return Vector of matching jobs (by value, allows filtering)
@@ -134,8 +158,12 @@ class PrintHistoryManager {
     /**
      * @brief Fetch history from Moonraker asynchronously
      *
-     * Calls `get_history_list()` and populates both `cached_jobs_` and
-     * `filename_stats_`. Notifies all observers when complete.
+     * A full sync (empty cache, request_full_sync() or FULL_SYNC_INTERVAL
+     * elapsed) replaces the cache with the newest `limit` jobs from
+     * `get_history_list()`. Otherwise only jobs newer than sync_since() are
+     * requested and merged into the cache; if that returns a full page the gap
+     * is too large and a full sync follows. Notifies all observers when
+     * complete.
      *
      * Concurrent calls are ignored (only one fetch in progress at a time).
      *
@@ -143,6 +171,43 @@ class PrintHistoryManager {
      */
     void fetch(int limit = 500);
 
+    /**
+     * @brief Remove a job that was deleted from Moonraker's history
+     *
+     * Moonraker does not announce deletions, so callers that delete a job
+     * via MoonrakerAPI::delete_history_job() report it here.
+     */
+    void remove_job(const std::string& job_id);
+
+    /**
+     * @brief Make the next fetch() a full sync
+     *
+     * Call on (re)connect: jobs deleted by other clients or while disconnected
+     * are only noticed by a full download.
+     */
+    void request_full_sync();
+
+    /**
+     * @brief Persist the job cache to a local file and restore it now
+     *
+     * @param path File to read/write (written via temp file + rename)
+     * @param source Identifies the Moonraker instance; a cache written for a
+     *               different source is discarded
+     * @return true if cached jobs were restored
+     */
+    bool set_cache_file(const std::string& path, const std::string& source);
+
+    /**
+     * @brief Start time used for the next incremental fetch
+     *
+     * Newest cached start_time, or the oldest in-progress job's start_time so
+     * its final status is picked up. Slightly earlier than either to avoid
+     * missing jobs on timestamp rounding (duplicates merge by job_id).
+     *
+     * @return 0 if the cache is empty (full fetch)
+     */
+    [[nodiscard]] double sync_since() const;
+
     /**
      * @brief Mark cache as stale
      *
@@ -160,7 +225,8 @@ class PrintHistoryManager {
      *
      * Callback is invoked (on main thread) when:
      * - fetch() completes successfully
-     * - Cache is invalidated and re-fetched (via notify_history_changed)
+     * - New or updated jobs are synced (via notify_history_changed)
+     * - A job is removed via remove_job()
      *
      * IMPORTANT: Pass the address of a member variable, not a temporary.
      * The pointer must remain valid until remove_observer() is called.
@@ -180,10 +246,23 @@ class PrintHistoryManager {
     void remove_observer(HistoryChangedCallback* cb);
 
   private:
+    /**
+     * @brief Request jobs started after since (0 = newest limit jobs, replacing the cache)
+     */
+    void request_history(int limit, double since);
+
     /**
      * @brief Handle completed fetch (runs on main thread)
+     *
+     * @param incremental true if jobs are a delta to merge, false to replace the cache
+     */
+    void on_history_fetched(std::vector<PrintHistoryJob>&& jobs, bool incremental);
+
+    /**
+     * @brief Merge fetched jobs into cached_jobs_ by job_id
+     * @return true if anything changed
      */
-    void on_history_fetched(std::vector<PrintHistoryJob>&& jobs);
+    bool merge_jobs(std::vector<PrintHistoryJob>&& jobs);
 
     /**
      * @brief Build filename_stats_ from cached_jobs_
@@ -193,6 +272,12 @@ class PrintHistoryManager {
      */
     void build_filename_stats();
 
+    /// Add one job to filename_stats_
+    void add_filename_stats(const PrintHistoryJob& job);
+
+    /// Write cached_jobs_ to cache_path_ (no-op when persistence is disabled)
+    void save_cache() const;
+
     /**
      * @brief Call all registered observers
      */
@@ -201,8 +286,8 @@ class PrintHistoryManager {
     /**
      * @brief Subscribe to Moonraker's notify_history_changed
      *
-     * Called in constructor. When notification fires, invalidates
-     * cache and triggers re-fetch.
+     * Called in constructor. When notification fires, triggers an
+     * incremental fetch.
      */
     void subscribe_to_notifications();
 
@@ -213,6 +298,11 @@ class PrintHistoryManager {
     // Cached data
     std::vector<PrintHistoryJob> cached_jobs_;
     std::unordered_map<std::string, PrintHistoryStats> filename_stats_;
+    PrintHistoryRollups rollups_;
+
+    // Persistence (empty path = disabled)
+    std::string cache_path_;
+    std::string cache_source_;
 
     // Observers (stored as pointers for reliable removal)
     std::vector<HistoryChangedCallback*> observers_;
@@ -220,6 +310,8 @@ class PrintHistoryManager {
     // State
     bool is_loaded_ = false;
     bool is_fetching_ = false;
+    bool full_sync_requested_ = true; ///< Next fetch replaces the cache (first one always does)
+    std::chrono::steady_clock::time_point last_full_sync_;
 
     /// Guard for async callback safety [L012]
     /// Prevents use-after-free when callbacks fire after destruction
@@ -0,0 +1,106 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "print_history_data.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Granularity of a history rollup bucket
+ *
+ * Days, weeks and months follow the local calendar (weeks start on Monday);
+ * hours are fixed 3600 s slots.
+ */
+enum class HistoryRollupPeriod { HOUR, DAY, WEEK, MONTH };
+
+/**
+ * @brief Aggregated print history for one time bucket (or a range of them)
+ */
+struct HistoryRollupBucket {
+    uint32_t job_count = 0;
+    uint32_t completed_count = 0;
+    double print_duration = 0.0; ///< Seconds of actual printing
+    double filament_mm = 0.0;
+    std::vector<FilamentUsageByType> filament_by_type; ///< Unordered, one entry per type
+
+    /// Add another bucket's totals into this one
+    void merge(const HistoryRollupBucket& other);
+};
+
+/**
+ * @brief Pre-aggregated print history by hour, day, week and month
+ *
+ * Maintained incrementally by PrintHistoryManager as jobs are added, updated
+ * or deleted, so HistoryDashboardPanel reads O(periods) buckets instead of
+ * scanning every job for each chart.
+ *
+ * Jobs are bucketed by start_time. Multi-extruder filament types
+ * ("PLA;PETG") split the job's filament evenly between the types.
+ *
+ * Keys are consecutive integers per period, so "the last N days" is the key
+ * range [bucket_key(DAY, now) - N + 1, bucket_key(DAY, now)].
+ */
+class PrintHistoryRollups {
+  public:
+    /// Add a job to every period's bucket and the all-time totals
+    void add(const PrintHistoryJob& job);
+
+    /// Remove a job previously passed to add() (same field values)
+    void remove(const PrintHistoryJob& job);
+
+    void clear();
+
+    /// Clear and add all jobs
+    void rebuild(const std::vector<PrintHistoryJob>& jobs);
+
+    /// All-time totals
+    [[nodiscard]] const HistoryRollupBucket& totals() const {
+        return totals_;
+    }
+
+    /**
+     * @brief Sum of buckets in [first_key, last_key]
+     */
+    [[nodiscard]] HistoryRollupBucket sum(HistoryRollupPeriod period, int64_t first_key,
+                                          int64_t last_key) const;
+
+    /**
+     * @brief Per-bucket job counts for count consecutive buckets starting at first_key
+     * @return Vector of size count, oldest first (empty buckets are 0)
+     */
+    [[nodiscard]] std::vector<uint32_t> job_counts(HistoryRollupPeriod period, int64_t first_key,
+                                                   int count) const;
+
+    /**
+     * @brief Key of the oldest non-empty bucket
+     * @return false if there are no jobs
+     */
+    bool oldest_key(HistoryRollupPeriod period, int64_t& key) const;
+
+    /// Bucket key containing a Unix timestamp
+    [[nodiscard]] static int64_t bucket_key(HistoryRollupPeriod period, double timestamp);
+
+    /// Unix timestamp at which a bucket starts
+    [[nodiscard]] static double bucket_start(HistoryRollupPeriod period, int64_t key);
+
+    /**
+     * @brief Split a semicolon-separated filament type list and trim each entry
+     *
+     * OrcaSlicer writes one type per extruder ("PLA;PETG"). Empty input or
+     * only separators yields an empty vector.
+     */
+    [[nodiscard]] static std::vector<std::string> split_filament_types(const std::string& types);
+
+  private:
+    static constexpr size_t PERIOD_COUNT = 4;
+
+    void apply(const PrintHistoryJob& job, int sign);
+
+    std::map<int64_t, HistoryRollupBucket> buckets_[PERIOD_COUNT];
+    HistoryRollupBucket totals_;
+};
@@ -10,9 +10,9 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <regex>
 #include <set>
 #include <string>
+#include <string_view>
 
 /**
  * @file print_start_collector.h
@@ -28,7 +28,8 @@
  * through PrinterState subjects which XML can bind to directly.
  *
  * ## Pattern Detection
- * Uses best-effort regex matching on G-code responses. Not all macros will
+ * Uses best-effort keyword matching on G-code responses (case-insensitive
+ * substring checks that mirror the original regex patterns). Not all macros will
  * output all phases - the progress calculation handles missing phases gracefully.
  *
  * @see PrintStartPhase enum in printer_state.h
@@ -93,13 +94,29 @@ class PrintStartCollector : public std::enable_shared_from_this<PrintStartCollec
      */
     void enable_fallbacks();
 
+    /**
+     * @brief First phase whose keywords appear in a G-code response line
+     * @return Matching phase, or PrintStartPhase::IDLE if none
+     */
+    static PrintStartPhase match_phase(std::string_view line);
+
+    /**
+     * @brief Check for PRINT_START start marker
+     */
+    static bool is_print_start_marker(std::string_view line);
+
+    /**
+     * @brief Check for print start completion (layer 1, etc.)
+     */
+    static bool is_completion_marker(std::string_view line);
+
   private:
     /**
-     * @brief Phase pattern for regex matching
+     * @brief Phase keyword matcher
      */
     struct PhasePattern {
         PrintStartPhase phase;
-        std::regex pattern;
+        bool (*matches)(std::string_view lowered); ///< Line already ASCII-lowercased
         const char* message;
         int weight; // Progress weight (0-100, all phases should sum to 100)
     };
@@ -107,12 +124,12 @@ class PrintStartCollector : public std::enable_shared_from_this<PrintStartCollec
     /**
      * @brief Handle incoming G-code response
      */
-    void on_gcode_response(const nlohmann::json& msg);
+    void on_gcode_response(const helix::GCodeResponseLine& response);
 
     /**
-     * @brief Check line against phase patterns
+     * @brief Check lowercased line against phase patterns
      */
-    void check_phase_patterns(const std::string& line);
+    void check_phase_patterns(std::string_view lowered);
 
     /**
      * @brief Check for HELIX:PHASE:* signals from plugin/macros
@@ -122,7 +139,7 @@ class PrintStartCollector : public std::enable_shared_from_this<PrintStartCollec
      *
      * @return true if a HELIX:PHASE signal was detected and handled
      */
-    bool check_helix_phase_signal(const std::string& line);
+    bool check_helix_phase_signal(std::string_view line);
 
     /**
      * @brief Update phase and recalculate progress
@@ -139,22 +156,12 @@ class PrintStartCollector : public std::enable_shared_from_this<PrintStartCollec
      */
     int calculate_progress_locked() const;
 
-    /**
-     * @brief Check for PRINT_START start marker
-     */
-    bool is_print_start_marker(const std::string& line) const;
-
-    /**
-     * @brief Check for print start completion (layer 1, etc.)
-     */
-    bool is_completion_marker(const std::string& line) const;
-
     // Dependencies
     MoonrakerClient& client_;
     PrinterState& state_;
 
     // Registration state
-    std::string handler_name_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
     std::atomic<bool> active_{false};
     std::atomic<bool> registered_{false};
 
@@ -170,8 +177,6 @@ class PrintStartCollector : public std::enable_shared_from_this<PrintStartCollec
 
     // Static phase patterns (initialized once, immutable after)
     static const std::vector<PhasePattern> phase_patterns_;
-    static const std::regex print_start_pattern_;
-    static const std::regex completion_pattern_;
 
     // Fallback detection constants
     static constexpr auto FALLBACK_TIMEOUT = std::chrono::seconds(45);
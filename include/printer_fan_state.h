@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "status_delta.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
@@ -68,6 +69,12 @@ class PrinterFanState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update fan state from a decoded status update
+     * @param delta Typed fan speeds plus untyped remainder in delta.other
+     */
+    void update_from_delta(const StatusDelta& delta);
+
     /**
      * @brief Reset state for testing - clears subjects and reinitializes
      */
@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "gcode_time_model.h"
+#include "status_delta.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
+#include <memory>
 #include <string>
 
 #include "hv/json.hpp"
@@ -52,6 +55,16 @@ class PrinterPrintState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update print state from a decoded status update
+     *
+     * Applies progress, then delta.other, then durations: the same order as
+     * update_from_status(), which the terminal-state progress guard relies on.
+     *
+     * @param delta Typed progress/durations plus untyped remainder in delta.other
+     */
+    void update_from_delta(const StatusDelta& delta);
+
     /**
      * @brief Reset state for testing - clears subjects and reinitializes
      */
@@ -181,6 +194,20 @@ class PrinterPrintState {
      */
     void set_print_layer_total(int total);
 
+    /**
+     * @brief Estimate time left from a print time table
+     *
+     * While the current print is @p filename, print_time_left follows
+     * virtual_sdcard.file_position through the table (one lookup per update)
+     * instead of print_stats durations, scaled by how fast the print is
+     * actually running against the estimate.
+     *
+     * @param filename Moonraker filename the table was computed for
+     * @param table Table from GCodeAnalysis, or nullptr to drop it
+     */
+    void set_print_time_table(const std::string& filename,
+                              std::shared_ptr<const helix::gcode::PrintTimeTable> table);
+
     /**
      * @brief Set print start phase and update message/progress
      *
@@ -235,6 +262,17 @@ class PrinterPrintState {
     [[nodiscard]] bool is_in_print_start() const;
 
   private:
+    /// virtual_sdcard.progress (0.0-1.0), kept at its value in terminal states
+    void set_progress_from_ratio(double progress);
+    /// print_stats.print_duration in seconds
+    void set_print_duration(double seconds);
+    /// print_stats.total_duration in seconds; updates time left
+    void set_total_duration(double seconds);
+    /// virtual_sdcard.file_position in bytes; updates time left from the time table
+    void set_file_position(double position);
+    /// True when the time table belongs to the file being printed
+    bool time_table_active() const;
+
     /**
      * @brief Update print_show_progress_ combined subject
      *
@@ -279,6 +317,12 @@ class PrinterPrintState {
     // Print workflow in-progress subject
     lv_subject_t print_in_progress_{};
 
+    // Time-left model (see set_print_time_table)
+    std::shared_ptr<const helix::gcode::PrintTimeTable> time_table_;
+    std::string time_table_filename_;
+    double pace_anchor_duration_ = -1.0; // print_duration when the table clock started
+    float pace_anchor_elapsed_ = 0.0f;   // Table time at that point
+
     // String buffers for subject storage
     char print_filename_buf_[256]{};
     char print_display_filename_buf_[128]{};
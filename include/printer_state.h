@@ -22,6 +22,7 @@
 #include "printer_temperature_state.h"
 #include "printer_versions_state.h"
 #include "spdlog/spdlog.h"
+#include "status_delta.h"
 #include "subject_managed_panel.h"
 
 #include <memory>
@@ -227,10 +228,30 @@ class PrinterState {
      */
     void update_from_status(const json& status);
 
+    /**
+     * @brief Update state from a decoded status update
+     *
+     * Deferred to the main thread like update_from_notification(); only the
+     * shared delta crosses threads, no JSON is copied.
+     *
+     * @param delta Decoded notify_status_update (see MoonrakerClient::register_status_update)
+     */
+    void update_from_status_delta(std::shared_ptr<const helix::StatusDelta> delta);
+
+    /**
+     * @brief Update state from a decoded status update (synchronous)
+     *
+     * Same effect as update_from_status() with the equivalent JSON.
+     *
+     * @param delta Typed slots plus untyped remainder in delta.other
+     */
+    void update_from_delta(const helix::StatusDelta& delta);
+
     /**
      * @brief Get raw JSON state for complex queries
      *
-     * Thread-safe access to cached printer state.
+     * Thread-safe access to cached printer state. Fields that arrived in
+     * typed StatusDelta slots are not cached here.
      *
      * @return Reference to JSON state object
      */
@@ -468,6 +489,16 @@ class PrinterState {
         return print_domain_.get_print_time_left_subject();
     }
 
+    /**
+     * @brief Drive print_time_left from a G-code print time table
+     *
+     * @see PrinterPrintState::set_print_time_table
+     */
+    void set_print_time_table(const std::string& filename,
+                              std::shared_ptr<const helix::gcode::PrintTimeTable> table) {
+        print_domain_.set_print_time_table(filename, std::move(table));
+    }
+
     // ========================================================================
     // PRINT START PROGRESS (detected from G-code response during PRINT_START)
     // ========================================================================
@@ -1240,6 +1271,9 @@ class PrinterState {
     const PrintStartCapabilities& get_print_start_capabilities() const;
 
   private:
+    /// Body of update_from_status()/update_from_delta(); delta is null for plain JSON
+    void apply_status_locked(const json& state, const helix::StatusDelta* delta);
+
     /// RAII manager for automatic subject cleanup - deinits all subjects on destruction
     SubjectManager subjects_;
 
@@ -0,0 +1,124 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file render_profile.h
+ * @brief Per-device LVGL rendering budget chosen from the platform tier
+ *
+ * A RenderProfile picks how many software draw units render in parallel and
+ * how much memory the image and image-header caches may use.
+ *
+ * The starting point comes from PlatformTier (an AD5M keeps a minimal footprint,
+ * a Pi 5 gets all its cores). On first boot a ~100 ms micro-benchmark measures
+ * single-thread fill rate and multi-thread scaling, refines the profile and
+ * persists it under /display/render_profile in helixconfig.json. Later boots
+ * load the saved profile unless the CPU count changed.
+ *
+ * LVGL creates its draw units in lv_init() from LV_DRAW_SW_DRAW_UNIT_CNT, so
+ * the build sets a per-target ceiling (HELIX_DRAW_SW_UNITS in lv_conf.h), the
+ * profile is clamped to it and DisplayManager parks the units above the
+ * profile's count. Cache budgets are applied at runtime. Draw buffer size and
+ * render mode stay with lv_conf.h: LVGL's fbdev/DRM/SDL drivers allocate their
+ * own buffers from it.
+ *
+ * Usage:
+ * @code
+ *   auto profile = helix::select_render_profile(PlatformCapabilities::detect(), cfg);
+ *   // after lv_init():
+ *   lv_image_cache_resize(profile.image_cache_bytes, false);
+ * @endcode
+ */
+
+#include "platform_capabilities.h"
+
+#include "hv/json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class Config;
+
+namespace helix {
+
+/**
+ * @brief Result of the first-boot rendering micro-benchmark
+ */
+struct RenderBenchmarkResult {
+    double single_thread_mpix_s = 0.0; ///< Blend throughput of one thread (megapixels/s)
+    double parallel_speedup = 1.0;     ///< Throughput of N threads / one thread
+    int threads_tested = 1;            ///< N used for parallel_speedup
+};
+
+/**
+ * @brief LVGL rendering budget for this device
+ */
+struct RenderProfile {
+    /// Bump when tier defaults or refinement rules change (forces recalibration)
+    static constexpr int VERSION = 2;
+
+    PlatformTier tier = PlatformTier::EMBEDDED;
+    int draw_units = 1;                    ///< Parallel software draw units
+    size_t image_cache_bytes = 0;          ///< Decoded image cache (0 = disabled)
+    uint32_t image_header_cache_count = 0; ///< Image header cache entries (0 = disabled)
+
+    int cpu_cores = 0;       ///< Cores when the profile was chosen
+    bool calibrated = false; ///< Refined by run_render_benchmark()
+    RenderBenchmarkResult benchmark;
+
+    /**
+     * @brief Starting profile for a platform tier
+     *
+     * - EMBEDDED: 1 draw unit, caches off
+     * - BASIC: up to 2 draw units, 2 MB image cache
+     * - STANDARD: up to 4 draw units, 8 MB image cache
+     */
+    static RenderProfile for_tier(const PlatformCapabilities& caps);
+
+    /**
+     * @brief Adjust draw units from measured performance
+     *
+     * Draw units follow the measured speedup (a Pi 5 scaling ~4x keeps 4
+     * units, a throttled board scaling 1.5x drops to 2).
+     */
+    void refine(const RenderBenchmarkResult& result);
+
+    /// Limit draw units to what LVGL was built with
+    void clamp_draw_units(int compiled_units);
+
+    /// Whether a saved profile no longer matches this device
+    bool needs_recalibration(const PlatformCapabilities& caps) const;
+
+    nlohmann::json to_json() const;
+
+    /**
+     * @brief Parse a saved profile
+     * @return false if the JSON is missing fields or has an old VERSION
+     */
+    static bool from_json(const nlohmann::json& j, RenderProfile& out);
+};
+
+/**
+ * @brief Time a software alpha-blend loop on 1 and N threads
+ *
+ * Uses plain C++ (no LVGL) so it can run before lv_init(). Each thread blends
+ * into its own tile so the result reflects CPU and memory bandwidth scaling,
+ * which is what LVGL's draw units compete for.
+ *
+ * @param max_threads Threads for the parallel pass (clamped to 1..8)
+ * @param budget_ms Approximate wall time per pass
+ */
+RenderBenchmarkResult run_render_benchmark(int max_threads, int budget_ms = 40);
+
+/**
+ * @brief Load the saved profile, or calibrate and persist a new one
+ *
+ * @param caps Detected platform capabilities
+ * @param config Config to read/write /display/render_profile (may be null: no persistence)
+ * @return Profile to apply (not yet clamped to the LVGL build)
+ */
+RenderProfile select_render_profile(const PlatformCapabilities& caps, Config* config);
+
+} // namespace helix
@@ -0,0 +1,168 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+#pragma once
+
+/**
+ * @file scoped_trace.h
+ * @brief Low-overhead scoped tracing with Chrome trace / Perfetto export
+ *
+ * Records begin/end timestamps of instrumented scopes into per-thread ring
+ * buffers and dumps them as Chrome trace JSON (open in ui.perfetto.dev or
+ * chrome://tracing) to pin down jank on customer machines.
+ *
+ * Tracing is compiled in and off by default; a disabled scope costs one
+ * relaxed atomic load. Enable it with:
+ *   - `--trace[=path]` on the command line (dumped at exit), or
+ *   - `kill -USR2 $(pidof helix-screen)`: the first signal enables tracing,
+ *     each later signal writes a dump (see poll()).
+ *
+ * Usage:
+ * @code
+ *   void Foo::refresh() {
+ *       HELIX_TRACE_SCOPE("ui", "Foo::refresh");
+ *       ...
+ *   }
+ * @endcode
+ *
+ * Define HELIX_DISABLE_TRACE to compile all trace scopes out.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace helix::trace {
+
+/// Events kept per thread (oldest are overwritten)
+constexpr size_t EVENTS_PER_THREAD = 4096;
+
+namespace detail {
+inline std::atomic<bool> g_enabled{false};
+} // namespace detail
+
+/// Whether scopes are currently being recorded
+inline bool is_enabled() noexcept {
+    return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/// Start or stop recording (buffered events are kept)
+void set_enabled(bool enabled);
+
+/// Microseconds on the trace clock (steady, arbitrary epoch)
+uint64_t now_us() noexcept;
+
+/**
+ * @brief Record a completed span on the calling thread's ring buffer
+ *
+ * @param category Chrome trace category; must outlive the trace (string literal)
+ * @param name Event name; must outlive the trace (string literal or intern())
+ */
+void record(const char* category, const char* name, uint64_t start_us, uint64_t end_us) noexcept;
+
+/**
+ * @brief Stable copy of a runtime string for use as an event name
+ *
+ * Takes a lock; meant for low-frequency events such as panel activation.
+ */
+const char* intern(std::string_view name);
+
+/// Name the calling thread in trace output (copied; no buffer is allocated until tracing)
+void set_thread_name(std::string_view name);
+
+/// Drop all buffered events
+void clear();
+
+/// All buffered events as Chrome trace JSON ("traceEvents" object format)
+std::string to_chrome_json();
+
+/**
+ * @brief Write to_chrome_json() to a file (atomically via .tmp + rename)
+ * @return false on I/O error
+ */
+bool write_chrome_trace(const std::string& path);
+
+/// /tmp/helix-trace-<pid>.json
+std::string default_trace_path();
+
+/**
+ * @brief Set up the dump path and SIGUSR2 handler
+ *
+ * @param enable Start recording immediately (--trace)
+ * @param dump_path Where poll() and shutdown() write; empty = default_trace_path()
+ */
+void init(bool enable, const std::string& dump_path);
+
+/**
+ * @brief Handle a pending SIGUSR2 (call once per main loop iteration)
+ *
+ * First signal enables tracing; later signals write a dump.
+ */
+void poll();
+
+/// Write a final dump if tracing is enabled
+void shutdown();
+
+/**
+ * @brief RAII span: records [construction, destruction) when tracing is enabled
+ */
+class Scope {
+  public:
+    Scope(const char* category, const char* name) noexcept
+        : category_(category), name_(name), active_(is_enabled()) {
+        if (active_) {
+            start_us_ = now_us();
+        }
+    }
+
+    /// Tag for runtime-generated names (interned only while tracing)
+    struct InternName {};
+
+    Scope(const char* category, std::string_view name, InternName) : category_(category) {
+        if (is_enabled()) {
+            name_ = intern(name);
+            active_ = true;
+            start_us_ = now_us();
+        }
+    }
+
+    ~Scope() {
+        end();
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    /// Close the span early (e.g. before an idle sleep)
+    void end() noexcept {
+        if (active_) {
+            record(category_, name_, start_us_, now_us());
+            active_ = false;
+        }
+    }
+
+  private:
+    const char* category_;
+    const char* name_ = nullptr;
+    bool active_ = false;
+    uint64_t start_us_ = 0;
+};
+
+} // namespace helix::trace
+
+#define HELIX_TRACE_CONCAT_INNER(a, b) a##b
+#define HELIX_TRACE_CONCAT(a, b) HELIX_TRACE_CONCAT_INNER(a, b)
+
+#ifdef HELIX_DISABLE_TRACE
+#define HELIX_TRACE_SCOPE(category, name) ((void)0)
+#define HELIX_TRACE_SCOPE_DYNAMIC(category, name) ((void)0)
+#else
+/// Trace the enclosing scope; category and name must be string literals
+#define HELIX_TRACE_SCOPE(category, name)                                                          \
+    ::helix::trace::Scope HELIX_TRACE_CONCAT(helix_trace_scope_, __LINE__)(category, name)
+/// Trace the enclosing scope with a runtime name (copied only while tracing)
+#define HELIX_TRACE_SCOPE_DYNAMIC(category, name)                                                  \
+    ::helix::trace::Scope HELIX_TRACE_CONCAT(helix_trace_scope_, __LINE__)(                        \
+        category, name, ::helix::trace::Scope::InternName{})
+#endif
@@ -338,8 +338,9 @@ class SettingsManager {
     /**
      * @brief Set language and apply translations
      *
-     * Updates subject, calls lv_translation_set_language() for hot-reload,
-     * and persists to Config. UI automatically updates via LVGL events.
+     * Updates subject, hot-swaps the language catalog via LanguagePacks
+     * (which calls lv_translation_set_language()), and persists to Config.
+     * UI automatically updates via LVGL events.
      *
      * @param lang Language code (e.g., "en", "de", "fr", "es", "ru")
      */
@@ -0,0 +1,184 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file shaper_analysis.h
+ * @brief On-device resonance analysis: accelerometer CSV -> PSD -> fitted input shapers
+ *
+ * Native port of Klipper's shaper_calibrate.py. Takes the raw accelerometer
+ * captures written by `TEST_RESONANCES OUTPUT=raw_data`, computes Welch power
+ * spectral densities, and fits zv/mzv/ei/2hump_ei/3hump_ei shapers with
+ * smoothing and max_accel, producing the same recommendation Klipper's
+ * SHAPER_CALIBRATE would, plus the full spectrum for charting and re-fitting
+ * (e.g. with a different max smoothing) without re-running the test.
+ *
+ * Results are validated against a NumPy port of Klipper's implementation on
+ * the sample capture in assets/test_resonances (see
+ * scripts/gen_resonance_reference.py).
+ *
+ * All functions are pure and thread-safe; run them off the UI thread.
+ */
+
+#include "calibration_types.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+namespace calibration {
+
+/**
+ * @brief Raw accelerometer capture (one TEST_RESONANCES raw_data file)
+ *
+ * Only the first/last timestamps are kept: Klipper derives the sample rate
+ * from sample count over duration.
+ */
+struct AccelSamples {
+    double first_time = 0.0;
+    double last_time = 0.0;
+    std::vector<float> x; ///< mm/s²
+    std::vector<float> y;
+    std::vector<float> z;
+
+    [[nodiscard]] size_t size() const {
+        return x.size();
+    }
+};
+
+/**
+ * @brief Power spectral density per frequency bin
+ *
+ * All vectors share the bins in `freqs`. `data_sets` counts the captures
+ * averaged into this spectrum (see merge_spectrum()).
+ */
+struct ResonanceSpectrum {
+    std::vector<float> freqs; ///< Hz
+    std::vector<float> psd_sum;
+    std::vector<float> psd_x;
+    std::vector<float> psd_y;
+    std::vector<float> psd_z;
+    int data_sets = 0;
+
+    [[nodiscard]] bool empty() const {
+        return freqs.empty();
+    }
+};
+
+/**
+ * @brief Tunables for fit_shapers() (defaults match Klipper)
+ */
+struct ShaperFitOptions {
+    float max_smoothing = 0.0f; ///< Upper bound on smoothing (0 = unlimited)
+    float max_freq = 200.0f;    ///< Highest frequency bin considered, Hz
+};
+
+/**
+ * @brief Parse raw accelerometer CSV text ("#time,accel_x,accel_y,accel_z")
+ *
+ * Lines starting with '#' and blank lines are skipped.
+ *
+ * @param text CSV contents
+ * @param out Samples appended to (cleared first)
+ * @param error Reason for failure (optional)
+ * @return false on malformed rows or fewer than two samples
+ */
+bool parse_accel_csv(std::string_view text, AccelSamples& out, std::string* error = nullptr);
+
+/**
+ * @brief Read and parse a raw accelerometer CSV in fixed-size chunks
+ *
+ * Captures of a full sweep are ~20 MB of text; streaming keeps peak memory at
+ * the parsed samples (~5 MB) instead of text + samples.
+ */
+bool load_accel_csv(const std::string& path, AccelSamples& out, std::string* error = nullptr);
+
+/**
+ * @brief Welch PSD of each axis (Kaiser window, 0.5 s segments, 50% overlap)
+ *
+ * The spectrum is not yet normalized; call normalize_spectrum() after merging
+ * all captures.
+ *
+ * @return false if the capture is shorter than one segment
+ */
+bool compute_spectrum(const AccelSamples& samples, ResonanceSpectrum& out);
+
+/**
+ * @brief Average another capture's spectrum into `into`, weighted by data_sets
+ *
+ * `other` is linearly interpolated onto `into`'s bins if they differ.
+ */
+void merge_spectrum(ResonanceSpectrum& into, const ResonanceSpectrum& other);
+
+/**
+ * @brief Scale PSDs by 1/(f + 0.1) and zero bins below 5 Hz (Klipper's normalization)
+ */
+void normalize_spectrum(ResonanceSpectrum& spectrum);
+
+/**
+ * @brief Fit every shaper type and pick the recommendation
+ *
+ * Fills all_shapers (vibrations in %, max_accel rounded to 100 mm/s² as in
+ * Klipper's console output), the recommended shaper's metrics, and
+ * freq_response with the normalized psd_sum up to options.max_freq.
+ *
+ * @param axis 'X' or 'Y'
+ * @param spectrum Normalized spectrum
+ * @param options Fit options
+ * @return Result; is_valid() is false if the spectrum has no usable bins
+ */
+InputShaperResult fit_shapers(char axis, const ResonanceSpectrum& spectrum,
+                              const ShaperFitOptions& options = {});
+
+/**
+ * @brief Rebuild a normalized spectrum from a result's freq_response
+ *
+ * Lets a stored result be re-fitted with different options. Only psd_sum is
+ * recovered, which is all fit_shapers() uses.
+ */
+ResonanceSpectrum spectrum_from_result(const InputShaperResult& result);
+
+/**
+ * @brief Full pipeline: load captures, merge, normalize and fit
+ *
+ * @param axis 'X' or 'Y'
+ * @param csv_paths Raw data files from one TEST_RESONANCES run
+ * @param options Fit options
+ * @param out Result on success
+ * @param error Reason for failure (optional)
+ * @return false if no file could be analyzed
+ */
+bool analyze_resonance_files(char axis, const std::vector<std::string>& csv_paths,
+                             const ShaperFitOptions& options, InputShaperResult& out,
+                             std::string* error = nullptr);
+
+/**
+ * @brief Fraction of vibration a shaper lets through at each frequency
+ *
+ * Worst case over the damping ratios used for fitting, as Klipper plots it;
+ * multiply with a spectrum to chart the vibrations left after shaping.
+ *
+ * @param type Shaper type ("zv", "mzv", "ei", "2hump_ei", "3hump_ei")
+ * @param shaper_freq Shaper frequency, Hz
+ * @param freqs Frequencies to evaluate, Hz
+ * @return Response per entry of freqs (1 = unshaped), empty for an unknown type
+ */
+std::vector<float> shaper_response(const std::string& type, double shaper_freq,
+                                   const std::vector<float>& freqs);
+
+/**
+ * @brief Smoothing of a shaper at the given acceleration (Klipper's metric)
+ *
+ * @param type Shaper type ("zv", "mzv", "ei", "2hump_ei", "3hump_ei")
+ * @param freq Shaper frequency, Hz
+ * @param accel Acceleration, mm/s²
+ * @param scv Square corner velocity, mm/s
+ * @return Smoothing in mm, or a negative value for an unknown type
+ */
+double shaper_smoothing(const std::string& type, double freq, double accel = 5000.0,
+                        double scv = 5.0);
+
+} // namespace calibration
+} // namespace helix
@@ -0,0 +1,168 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file status_delta.h
+ * @brief Typed notify_status_update delta and a SAX decoder that fills it
+ *
+ * Nearly every websocket frame is a notify_status_update carrying a handful of
+ * numbers: temperatures, positions, progress and fan speeds. Parsing those
+ * into a nlohmann DOM allocates a node per key and value, and every consumer
+ * then walks the tree with contains()/operator[].
+ *
+ * decode_status_notification() streams the frame through nlohmann's SAX
+ * interface and writes the hot fields straight into fixed slots of a
+ * StatusDelta. Everything it does not know about is still built as JSON in
+ * StatusDelta::other, in the same shape as the status object, so consumers
+ * apply `other` with their existing update_from_status() code and the typed
+ * slots with update_from_delta().
+ */
+
+#include "hv/json.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+
+/**
+ * @brief Position vector from Klipper ([x, y, z, e])
+ */
+struct StatusPosition {
+    std::array<double, 4> values{};
+    uint8_t size = 0; ///< Number of elements received (Klipper sends 4)
+};
+
+/**
+ * @brief temperature/target/power of one heater or temperature sensor
+ */
+struct ThermalSample {
+    enum Field : uint8_t {
+        TEMPERATURE = 1u << 0,
+        TARGET = 1u << 1,
+        POWER = 1u << 2,
+    };
+
+    std::string object; ///< Full Klipper object name, e.g. "heater_generic chamber"
+    uint8_t fields = 0;
+    double temperature = 0.0;
+    double target = 0.0;
+    double power = 0.0;
+
+    [[nodiscard]] bool has(Field field) const {
+        return (fields & field) != 0;
+    }
+};
+
+/**
+ * @brief speed/rpm of "fan" or a heater_fan/fan_generic/controller_fan object
+ */
+struct FanSample {
+    enum Field : uint8_t {
+        SPEED = 1u << 0,
+        RPM = 1u << 1, ///< Only with a tachometer; null otherwise (kept in `other`)
+    };
+
+    std::string object;
+    uint8_t fields = 0;
+    double speed = 0.0;
+    double rpm = 0.0;
+
+    [[nodiscard]] bool has(Field field) const {
+        return (fields & field) != 0;
+    }
+};
+
+/**
+ * @brief One notify_status_update, decoded
+ *
+ * A field is present when its bit is set in `fields` (or, for thermals and
+ * fans, when a sample for the object exists). Fields of the same object that
+ * have no typed slot are in `other` under the object's name, so one object can
+ * appear in both places.
+ */
+struct StatusDelta {
+    enum Field : uint32_t {
+        TOOLHEAD_POSITION = 1u << 0,      ///< toolhead.position
+        GCODE_POSITION = 1u << 1,         ///< gcode_move.gcode_position
+        SPEED_FACTOR = 1u << 2,           ///< gcode_move.speed_factor
+        EXTRUDE_FACTOR = 1u << 3,         ///< gcode_move.extrude_factor
+        LIVE_POSITION = 1u << 4,          ///< motion_report.live_position
+        LIVE_VELOCITY = 1u << 5,          ///< motion_report.live_velocity
+        LIVE_EXTRUDER_VELOCITY = 1u << 6, ///< motion_report.live_extruder_velocity
+        SDCARD_PROGRESS = 1u << 7,        ///< virtual_sdcard.progress
+        FILE_POSITION = 1u << 8,          ///< virtual_sdcard.file_position
+        PRINT_DURATION = 1u << 9,         ///< print_stats.print_duration
+        TOTAL_DURATION = 1u << 10,        ///< print_stats.total_duration
+        FILAMENT_USED = 1u << 11,         ///< print_stats.filament_used
+        PRINTING_TIME = 1u << 12,         ///< idle_timeout.printing_time
+    };
+
+    uint32_t fields = 0;
+
+    StatusPosition toolhead_position;
+    StatusPosition gcode_position;
+    StatusPosition live_position;
+    double speed_factor = 0.0;
+    double extrude_factor = 0.0;
+    double live_velocity = 0.0;
+    double live_extruder_velocity = 0.0;
+    double sdcard_progress = 0.0;
+    double file_position = 0.0;
+    double print_duration = 0.0;
+    double total_duration = 0.0;
+    double filament_used = 0.0;
+    double printing_time = 0.0;
+
+    /// extruder*, heater_bed, heater_generic, temperature_sensor, temperature_fan
+    std::vector<ThermalSample> thermals;
+    std::vector<FanSample> fans;
+
+    /// Untyped remainder in status-object shape; null when there is none
+    nlohmann::json other;
+
+    double eventtime = 0.0; ///< params[1]
+
+    [[nodiscard]] bool has(Field field) const {
+        return (fields & field) != 0;
+    }
+
+    /**
+     * @brief Sample for a thermal object, or nullptr if not in this update
+     */
+    [[nodiscard]] const ThermalSample* find_thermal(std::string_view object) const;
+
+    /**
+     * @brief Rebuild the status object (params[0]) as JSON
+     *
+     * For subscribers that still consume JSON; equal to what json::parse
+     * would have produced for the status object.
+     */
+    [[nodiscard]] nlohmann::json to_status_json() const;
+
+    /**
+     * @brief Rebuild the full notification ({"method", "params"}) as JSON
+     */
+    [[nodiscard]] nlohmann::json to_notification_json() const;
+};
+
+/**
+ * @brief Decode a notify_status_update frame without building a DOM
+ *
+ * Returns false (leaving `out` unspecified) for any other frame, including
+ * malformed JSON; the caller then falls back to json::parse. Frames whose
+ * method is not near the start are rejected before tokenizing, so responses
+ * are not scanned twice.
+ *
+ * @param frame Raw websocket text frame
+ * @param out Delta to fill; should be default-constructed
+ * @return true if the frame was a notify_status_update and was decoded
+ */
+bool decode_status_notification(std::string_view frame, StatusDelta& out);
+
+} // namespace helix
@@ -0,0 +1,136 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+/**
+ * @file subscription_profile.h
+ * @brief Field-level printer.objects.subscribe profiles
+ *
+ * The discovery subscription used to request every field of every object.
+ * Klipper only sends changed fields, but several objects carry fields that
+ * change on every status batch without anyone reading them
+ * (toolhead.estimated_print_time, gcode_move.speed, motion_report.live_*),
+ * which turned each batch into a full notify_status_update message.
+ *
+ * A SubscriptionProfile lists the fields to request per object. The base
+ * profile is built at discovery and installed in the SubscriptionManager,
+ * which also counts status traffic for benchmark mode.
+ *
+ * Thread safety: all methods may be called from any thread.
+ */
+
+#include "hv/json.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace helix {
+
+/**
+ * @brief Objects to subscribe to and, per object, the fields of interest
+ *
+ * An empty field list subscribes to every field of the object.
+ */
+struct SubscriptionProfile {
+    std::string name;
+    std::map<std::string, std::vector<std::string>> objects;
+
+    /**
+     * @brief Add an object (all fields if `fields` is empty)
+     *
+     * Adding an object that is already present widens its field list.
+     */
+    void add(const std::string& object, const std::vector<std::string>& fields = {});
+
+    /**
+     * @brief The "objects" parameter of printer.objects.subscribe
+     *
+     * Objects with all fields map to null, others to their field list.
+     */
+    [[nodiscard]] nlohmann::json to_objects_json() const;
+};
+
+/**
+ * @brief Status traffic received while one profile was active
+ */
+struct SubscriptionTraffic {
+    std::string profile; ///< "base", or "none" before discovery
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    double seconds = 0.0;
+
+    [[nodiscard]] double messages_per_sec() const {
+        return seconds > 0.0 ? static_cast<double>(messages) / seconds : 0.0;
+    }
+    [[nodiscard]] double bytes_per_sec() const {
+        return seconds > 0.0 ? static_cast<double>(bytes) / seconds : 0.0;
+    }
+};
+
+/**
+ * @brief Holds the active printer.objects.subscribe profile
+ *
+ * Owned by MoonrakerClient (see MoonrakerClient::subscriptions()).
+ */
+class SubscriptionManager {
+  public:
+    SubscriptionManager() = default;
+
+    SubscriptionManager(const SubscriptionManager&) = delete;
+    SubscriptionManager& operator=(const SubscriptionManager&) = delete;
+
+    /**
+     * @brief Install the discovery profile
+     *
+     * Does not send: the caller subscribes with objects() itself so it can
+     * handle the initial status as part of discovery.
+     */
+    void set_base(SubscriptionProfile base);
+
+    /**
+     * @brief Forget the base profile (connection lost)
+     */
+    void clear_base();
+
+    /**
+     * @brief Current "objects" parameter (empty before discovery)
+     */
+    [[nodiscard]] nlohmann::json objects() const;
+
+    /**
+     * @brief Name of the active profile ("base" or "none")
+     */
+    [[nodiscard]] std::string profile_name() const;
+
+    /**
+     * @brief Count one notify_status_update message against the active profile
+     */
+    void record_update(size_t bytes);
+
+    /**
+     * @brief Traffic per profile since the previous call, then reset
+     */
+    std::vector<SubscriptionTraffic> take_traffic();
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    std::string profile_name_locked() const;
+    void close_traffic_period_locked();
+
+    mutable std::mutex mutex_;
+    bool has_base_ = false;
+    SubscriptionProfile base_;
+
+    // Traffic accounting for benchmark mode
+    std::map<std::string, SubscriptionTraffic> traffic_;
+    std::string traffic_profile_;
+    Clock::time_point traffic_since_ = Clock::now();
+};
+
+} // namespace helix
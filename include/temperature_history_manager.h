@@ -6,8 +6,9 @@
 #include "ui_observer_guard.h"
 
 #include "printer_state.h"
+#include "status_delta.h"
+#include "temperature_history_ring.h"
 
-#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -16,17 +17,7 @@
 #include <unordered_map>
 #include <vector>
 
-/**
- * @brief Single temperature sample with timestamp
- *
- * Uses centidegrees (x10) for precision without floating point.
- * Example: 2053 = 205.3°C
- */
-struct TempSample {
-    int temp_centi = 0;       ///< Temperature × 10 (e.g., 2053 = 205.3°C)
-    int target_centi = 0;     ///< Target temperature × 10
-    int64_t timestamp_ms = 0; ///< Unix timestamp in milliseconds
-};
+#include "hv/json.hpp"
 
 /**
  * @brief Heater type classification
@@ -36,12 +27,16 @@ enum class HeaterType { EXTRUDER, BED, CHAMBER };
 /**
  * @brief Manages temperature history collection for all heaters
  *
- * Collects temperature samples from PrinterState subjects at app startup,
- * stores 20 minutes of history (1200 samples @ 1Hz) per heater,
- * and provides observer notifications when new samples arrive.
+ * Collects temperature samples from PrinterState subjects (extruder, bed) and
+ * from raw status updates (every other heater and temperature_sensor found by
+ * PrinterDiscovery). Each heater keeps tiered history - 1 s for 20 minutes,
+ * 10 s for 3 hours, 1 min for 24 hours (see TieredTempHistory) - and the whole
+ * set can be snapshotted to disk so a reboot mid-print keeps the graph.
  *
  * ## Thread Safety
- * - Data reads (get_samples, get_sample_count) are protected by mutex
+ * - Copying reads (get_samples, get_sample_count) are protected by mutex
+ * - Views (get_view, get_view_for_span) point into the rings and are only
+ *   valid on the main thread until the next sample is recorded
  * - Writes are expected from the main thread via subject observers
  *
  * ## Usage Example
@@ -59,12 +54,19 @@ enum class HeaterType { EXTRUDER, BED, CHAMBER };
  * // Query history
  * auto samples = manager.get_samples("extruder");
  * auto recent = manager.get_samples_since("heater_bed", now_ms - 60000); // last minute
+ *
+ * // Zero-copy access for graphs (main thread only)
+ * for (const TempSample& s : manager.get_view_for_span("extruder", 3 * 3600 * 1000)) { ... }
  * ```
  */
 class TemperatureHistoryManager {
   public:
-    static constexpr int HISTORY_SIZE = 1200;           ///< 20 minutes at 1Hz
-    static constexpr int64_t SAMPLE_INTERVAL_MS = 1000; ///< 1 second minimum between samples
+    /// FINE tier: 20 minutes at 1Hz
+    static constexpr int HISTORY_SIZE = static_cast<int>(TieredTempHistory::TIERS[0].capacity);
+    /// 1 second minimum between samples
+    static constexpr int64_t SAMPLE_INTERVAL_MS = TieredTempHistory::TIERS[0].interval_ms;
+    /// Snapshot samples older than this are dropped on load
+    static constexpr int64_t SNAPSHOT_MAX_AGE_MS = 24LL * 60 * 60 * 1000;
     static constexpr int64_t RECENT_SAMPLE_WINDOW_MS =
         100; ///< Window for retroactive target updates
 
@@ -113,10 +115,31 @@ class TemperatureHistoryManager {
     [[nodiscard]] std::vector<TempSample> get_samples_since(const std::string& heater_name,
                                                             int64_t since_ms) const;
 
+    /**
+     * @brief Zero-copy view of one resolution tier
+     *
+     * Main thread only. Valid until the next sample is recorded.
+     *
+     * @param heater_name Heater name
+     * @param tier Resolution tier (FINE is the last 20 minutes at 1Hz)
+     * @return View oldest first, empty if heater unknown
+     */
+    [[nodiscard]] TempSampleView get_view(const std::string& heater_name,
+                                          TempHistoryTier tier = TempHistoryTier::FINE) const;
+
+    /**
+     * @brief Zero-copy view from the finest tier covering span_ms
+     *
+     * Main thread only. Valid until the next sample is recorded.
+     */
+    [[nodiscard]] TempSampleView get_view_for_span(const std::string& heater_name,
+                                                   int64_t span_ms) const;
+
     /**
      * @brief Get list of known heater names
      *
-     * Returns at minimum "extruder" and "heater_bed".
+     * Returns at minimum "extruder" and "heater_bed", plus anything added by
+     * set_tracked_sensors() or restored from a snapshot.
      *
      * @return Vector of heater names
      */
@@ -126,10 +149,65 @@ class TemperatureHistoryManager {
      * @brief Get number of samples stored for a heater
      *
      * @param heater_name Heater name
-     * @return Sample count (0 to HISTORY_SIZE), 0 if heater unknown
+     * @return FINE tier sample count (0 to HISTORY_SIZE), 0 if heater unknown
      */
     [[nodiscard]] int get_sample_count(const std::string& heater_name) const;
 
+    // ========================================================================
+    // Discovered Heaters and Sensors
+    // ========================================================================
+
+    /**
+     * @brief Start tracking heaters and sensors found by PrinterDiscovery
+     *
+     * Full Klipper object names ("heater_generic chamber",
+     * "temperature_sensor mcu_temp"). Extruder and bed keep coming from
+     * PrinterState subjects; everything else is fed by update_from_status().
+     *
+     * @param names Object names from PrinterDiscovery::heaters() and sensors()
+     */
+    void set_tracked_sensors(const std::vector<std::string>& names);
+
+    /**
+     * @brief Record samples for tracked heaters/sensors from a status update
+     *
+     * Call on the main thread with the status object from notify_status_update.
+     *
+     * @param status Klipper status object (params[0])
+     * @param timestamp_ms Sample time in milliseconds
+     */
+    void update_from_status(const nlohmann::json& status, int64_t timestamp_ms);
+
+    /**
+     * @brief Record samples from a decoded status update
+     *
+     * Same as update_from_status() with the equivalent JSON.
+     *
+     * @param delta Typed thermal samples plus untyped remainder in delta.other
+     * @param timestamp_ms Sample time in milliseconds
+     */
+    void update_from_delta(const helix::StatusDelta& delta, int64_t timestamp_ms);
+
+    // ========================================================================
+    // Persistence
+    // ========================================================================
+
+    /**
+     * @brief Write all heater histories to path (atomically via rename)
+     * @return true on success
+     */
+    bool save_snapshot(const std::string& path) const;
+
+    /**
+     * @brief Restore heater histories written by save_snapshot()
+     *
+     * Samples older than SNAPSHOT_MAX_AGE_MS before now_ms are dropped.
+     * Heaters not in the snapshot are left untouched.
+     *
+     * @return true if a valid snapshot was loaded
+     */
+    bool load_snapshot(const std::string& path, int64_t now_ms);
+
     // ========================================================================
     // Observer Pattern
     // ========================================================================
@@ -204,15 +282,6 @@ class TemperatureHistoryManager {
     void update_recent_sample_target(const std::string& heater_name, int target_centi);
 
   private:
-    /**
-     * @brief Per-heater circular buffer for temperature samples
-     */
-    struct HeaterHistory {
-        std::array<TempSample, HISTORY_SIZE> samples{}; ///< Circular buffer
-        int write_index = 0;        ///< Next write position (0 to HISTORY_SIZE-1)
-        int count = 0;              ///< Number of samples stored (0 to HISTORY_SIZE)
-        int64_t last_sample_ms = 0; ///< Timestamp of last stored sample (for throttling)
-    };
 
     /**
      * @brief Add a sample to heater history (internal, must hold mutex)
@@ -262,14 +331,15 @@ class TemperatureHistoryManager {
     // Dependencies
     PrinterState& printer_state_;
 
-    // Per-heater circular buffers
-    std::unordered_map<std::string, HeaterHistory> heaters_;
+    // Per-heater tiered history
+    std::unordered_map<std::string, TieredTempHistory> heaters_;
 
-    // Cached targets (updated by target subject observers)
+    // Cached targets (updated by target subject observers and update_from_status)
     // Thread-safety note: These are only accessed from the main thread via LVGL
     // observer callbacks. No mutex protection needed as LVGL runs single-threaded.
     int cached_extruder_target_ = 0;
     int cached_bed_target_ = 0;
+    std::unordered_map<std::string, int> cached_status_targets_;
 
     // Thread safety
     mutable std::mutex mutex_;
@@ -0,0 +1,231 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @file temperature_history_ring.h
+ * @brief Ring buffers and downsampling tiers backing TemperatureHistoryManager
+ *
+ * Each heater keeps three rings of decreasing resolution:
+ * - FINE:   1 s samples, 20 minutes (what the temperature graphs replay)
+ * - MEDIUM: 10 s averages, 3 hours
+ * - COARSE: 1 min averages, 24 hours
+ *
+ * Readers get a TempSampleView pointing straight into the ring storage, so a
+ * graph redraw no longer copies 1200 samples per heater.
+ *
+ * @threading Not synchronized; TemperatureHistoryManager serializes access.
+ */
+
+/**
+ * @brief Single temperature sample with timestamp
+ *
+ * Uses centidegrees (x10) for precision without floating point.
+ * Example: 2053 = 205.3°C
+ */
+struct TempSample {
+    int temp_centi = 0;       ///< Temperature × 10 (e.g., 2053 = 205.3°C)
+    int target_centi = 0;     ///< Target temperature × 10
+    int64_t timestamp_ms = 0; ///< Unix timestamp in milliseconds
+};
+
+/**
+ * @brief Read-only view over ring contents, oldest first
+ *
+ * A wrapped ring is two contiguous runs; the view stitches them together
+ * without copying. Valid until the next sample is written to the ring.
+ */
+class TempSampleView {
+  public:
+    class const_iterator {
+      public:
+        const_iterator(const TempSampleView* view, size_t index) : view_(view), index_(index) {}
+        const TempSample& operator*() const {
+            return (*view_)[index_];
+        }
+        const TempSample* operator->() const {
+            return &(*view_)[index_];
+        }
+        const_iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const {
+            return index_ == other.index_;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return index_ != other.index_;
+        }
+
+      private:
+        const TempSampleView* view_;
+        size_t index_;
+    };
+
+    TempSampleView() = default;
+    TempSampleView(const TempSample* first, size_t first_size, const TempSample* second,
+                   size_t second_size)
+        : first_(first), first_size_(first_size), second_(second), second_size_(second_size) {}
+
+    [[nodiscard]] size_t size() const {
+        return first_size_ + second_size_;
+    }
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+    const TempSample& operator[](size_t index) const {
+        return index < first_size_ ? first_[index] : second_[index - first_size_];
+    }
+    const TempSample& back() const {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]] const_iterator begin() const {
+        return {this, 0};
+    }
+    [[nodiscard]] const_iterator end() const {
+        return {this, size()};
+    }
+
+    /**
+     * @brief Suffix of the view with timestamp_ms > since_ms
+     *
+     * Samples are stored in time order, so this is a binary search.
+     */
+    [[nodiscard]] TempSampleView since(int64_t since_ms) const;
+
+    /// Copy into a vector (for callers that need to own the data)
+    [[nodiscard]] std::vector<TempSample> to_vector() const;
+
+  private:
+    const TempSample* first_ = nullptr;
+    size_t first_size_ = 0;
+    const TempSample* second_ = nullptr;
+    size_t second_size_ = 0;
+};
+
+/**
+ * @brief Fixed-capacity ring of samples
+ *
+ * Storage grows on demand up to capacity, so heaters that only just appeared
+ * don't pay for a full day of history.
+ */
+class TempSampleRing {
+  public:
+    explicit TempSampleRing(size_t capacity = 0) : capacity_(capacity) {}
+
+    void push(const TempSample& sample);
+    void clear();
+
+    [[nodiscard]] size_t size() const {
+        return samples_.size();
+    }
+    [[nodiscard]] size_t capacity() const {
+        return capacity_;
+    }
+    [[nodiscard]] bool empty() const {
+        return samples_.empty();
+    }
+
+    /// Most recent sample, or nullptr if empty
+    [[nodiscard]] TempSample* latest();
+
+    [[nodiscard]] TempSampleView view() const;
+
+  private:
+    std::vector<TempSample> samples_;
+    size_t capacity_;
+    size_t head_ = 0; ///< Index of oldest sample once the ring is full
+};
+
+/// Resolution tiers, finest first
+enum class TempHistoryTier { FINE = 0, MEDIUM = 1, COARSE = 2 };
+
+/**
+ * @brief One heater's history across all resolution tiers
+ *
+ * Samples go into FINE directly (throttled to one per second) and are
+ * averaged into MEDIUM and COARSE as each bucket closes.
+ */
+class TieredTempHistory {
+  public:
+    struct TierSpec {
+        int64_t interval_ms;
+        size_t capacity;
+    };
+
+    static constexpr size_t TIER_COUNT = 3;
+    static constexpr std::array<TierSpec, TIER_COUNT> TIERS = {{
+        {1000, 1200},  // 1 s for 20 min
+        {10000, 1080}, // 10 s for 3 h
+        {60000, 1440}, // 1 min for 24 h
+    }};
+
+    TieredTempHistory();
+
+    /**
+     * @brief Record a sample
+     * @return false if throttled (within the FINE interval of the previous sample)
+     */
+    bool add(const TempSample& sample);
+
+    [[nodiscard]] TempSampleView view(TempHistoryTier tier) const {
+        return rings_[static_cast<size_t>(tier)].view();
+    }
+
+    /**
+     * @brief View from the finest tier that covers span_ms
+     *
+     * Used by graphs so a 24 h chart reads 1440 points instead of 86400.
+     */
+    [[nodiscard]] TempSampleView view_for_span(int64_t span_ms) const;
+
+    [[nodiscard]] size_t size(TempHistoryTier tier) const {
+        return rings_[static_cast<size_t>(tier)].size();
+    }
+
+    /// Most recent FINE sample, or nullptr if empty
+    [[nodiscard]] TempSample* latest() {
+        return rings_[0].latest();
+    }
+
+    [[nodiscard]] int64_t last_sample_ms() const {
+        return last_sample_ms_;
+    }
+
+    /**
+     * @brief Write all tiers (open buckets are not persisted)
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Replace contents with a stream written by save()
+     *
+     * Samples with timestamp_ms <= drop_before_ms are skipped.
+     *
+     * @return false on truncated or malformed input (history is left empty)
+     */
+    bool load(std::istream& in, int64_t drop_before_ms);
+
+  private:
+    /// Running average for a downsampled tier's current bucket
+    struct Bucket {
+        int64_t index = -1;
+        int64_t temp_sum = 0;
+        int target_centi = 0;
+        int count = 0;
+        int64_t last_timestamp_ms = 0;
+    };
+
+    std::array<TempSampleRing, TIER_COUNT> rings_;
+    std::array<Bucket, TIER_COUNT> buckets_{}; ///< [0] unused (FINE is not averaged)
+    int64_t last_sample_ms_ = 0;
+};
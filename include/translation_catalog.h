@@ -0,0 +1,105 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @file translation_catalog.h
+ * @brief Read-only view of a single-language translation catalog
+ *
+ * Each language is shipped as its own catalog so only the active one is
+ * mapped. Keys are the English source strings (the same tags LVGL's
+ * translation_tag uses). The catalog has no lookup index of its own: all
+ * lookups go through the LVGL static pack that LanguagePacks builds from it.
+ * Strings are NUL-terminated inside the mapping and can be handed to LVGL
+ * without copying.
+ *
+ * Catalogs are generated at build time by:
+ *   - make gen-translation-catalogs (scripts/gen_translation_catalogs.py)
+ *
+ * and deployed as assets/translations/<locale>.bin.
+ *
+ * ## File Layout (little-endian uint32 fields unless noted)
+ * - header:        magic "HXTRNCAT", version, entry_count, locale_offset,
+ *                  strtab_offset, strtab_size, reserved
+ * - entries:       entry_count x {key_offset, key_len, value_offset, value_len},
+ *                  sorted by key bytes
+ * - strtab:        NUL-terminated locale name, keys and values
+ *
+ * @threading Main thread only
+ * @see scripts/gen_translation_catalogs.py
+ */
+
+namespace helix {
+
+class TranslationCatalog {
+  public:
+    static constexpr uint32_t FORMAT_VERSION = 2;
+
+    TranslationCatalog() = default;
+    ~TranslationCatalog();
+
+    TranslationCatalog(const TranslationCatalog&) = delete;
+    TranslationCatalog& operator=(const TranslationCatalog&) = delete;
+
+    TranslationCatalog(TranslationCatalog&& other) noexcept;
+    TranslationCatalog& operator=(TranslationCatalog&& other) noexcept;
+
+    /**
+     * @brief Map and validate a catalog file
+     *
+     * Any previously opened catalog is closed first. On failure (missing file,
+     * bad magic, version mismatch, out-of-range offsets) the catalog stays closed.
+     *
+     * @param path Filesystem path to the catalog
+     * @return true if the catalog was mapped and validated
+     */
+    bool open(const std::string& path);
+
+    /// Unmap the catalog (safe to call when not open)
+    void close();
+
+    [[nodiscard]] bool is_open() const {
+        return base_ != nullptr;
+    }
+
+    /// Locale the catalog was built for (e.g. "de"), empty when closed
+    [[nodiscard]] std::string_view locale() const;
+
+    /// Number of keys in the catalog
+    [[nodiscard]] size_t size() const {
+        return entry_count_;
+    }
+
+    /// Key at index (NUL-terminated, valid until close()), or empty if out of range
+    [[nodiscard]] std::string_view key_at(size_t index) const;
+
+    /// Value at index (NUL-terminated, valid until close()), or empty if out of range.
+    /// Untranslated keys map to themselves.
+    [[nodiscard]] std::string_view value_at(size_t index) const;
+
+  private:
+    struct Entry {
+        uint32_t key_offset;
+        uint32_t key_len;
+        uint32_t value_offset;
+        uint32_t value_len;
+    };
+
+    [[nodiscard]] const Entry* entry(size_t index) const;
+    [[nodiscard]] bool validate();
+
+    const uint8_t* base_ = nullptr;
+    size_t length_ = 0;
+    uint32_t entry_count_ = 0;
+    uint32_t locale_offset_ = 0;
+    uint32_t strtab_offset_ = 0;
+    uint32_t strtab_size_ = 0;
+};
+
+} // namespace helix
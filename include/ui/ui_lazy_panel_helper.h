@@ -12,7 +12,7 @@
  * 3. Initialize subjects if needed
  * 4. Register callbacks
  * 5. Create panel from XML
- * 6. Register with NavigationManager
+ * 6. Register with NavigationManager (and for eviction, if the panel opts in)
  * 7. Push overlay
  *
  * @see AdvancedPanel for usage example
@@ -88,6 +88,16 @@ bool lazy_create_and_push_overlay(Getter getter, lv_obj_t*& cached_panel, lv_obj
 
         // Register with NavigationManager for lifecycle callbacks
         NavigationManager::instance().register_overlay_instance(cached_panel, &panel);
+
+        // Cold overlays can be torn down under memory pressure; clearing the
+        // cache makes the next call rebuild the widget tree from XML
+        if (panel.is_evictable()) {
+            NavigationManager::instance().register_evictable_overlay(
+                cached_panel, [&panel, &cached_panel]() {
+                    panel.evict();
+                    cached_panel = nullptr;
+                });
+        }
         spdlog::info("[{}] {} panel created", caller_name, panel_display_name);
     }
 
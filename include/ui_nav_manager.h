@@ -225,6 +225,29 @@ class NavigationManager {
      */
     void unregister_overlay_close_callback(lv_obj_t* overlay_panel);
 
+    /**
+     * @brief Register an overlay whose widget tree may be destroyed while hidden
+     *
+     * The evict callback must delete the overlay's widgets and clear any cached
+     * pointer to them so the next navigation rebuilds the overlay from XML.
+     * Subjects are left alone, so bindings reconnect when it is recreated.
+     *
+     * @param overlay_panel Root widget of the overlay
+     * @param evict Callback that destroys the widget tree
+     */
+    void register_evictable_overlay(lv_obj_t* overlay_panel, std::function<void()> evict);
+
+    /**
+     * @brief Destroy evictable overlays that have been hidden for a while
+     *
+     * Overlays currently in the panel stack are never evicted. Called under
+     * memory pressure to hand widget memory back to the allocator.
+     *
+     * @param min_idle_ms Minimum time since the overlay was last closed
+     * @return Number of overlays evicted
+     */
+    size_t evict_cold_overlays(uint32_t min_idle_ms);
+
     /**
      * @brief Navigate back to previous panel
      *
@@ -328,6 +351,13 @@ class NavigationManager {
     // Overlay close callbacks (called when overlay is popped from stack)
     std::unordered_map<lv_obj_t*, OverlayCloseCallback> overlay_close_callbacks_;
 
+    // Evictable overlays: evict callback and tick when last closed
+    struct EvictableOverlay {
+        std::function<void()> evict;
+        uint32_t last_hidden_tick = 0;
+    };
+    std::unordered_map<lv_obj_t*, EvictableOverlay> evictable_overlays_;
+
     // Shared overlay backdrop widget (for first overlay)
     lv_obj_t* overlay_backdrop_ = nullptr;
 
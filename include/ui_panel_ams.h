@@ -110,6 +110,10 @@ class AmsPanel : public PanelBase {
         16; ///< Max slots displayed (increased for 8+ gate systems)
     lv_obj_t* slot_widgets_[MAX_VISIBLE_SLOTS] = {nullptr};
     lv_obj_t* label_widgets_[MAX_VISIBLE_SLOTS] = {nullptr}; ///< Separate label layer for z-order
+    /// AmsState slot version each widget last refreshed at (-1 = needs refresh)
+    int refreshed_slot_versions_[MAX_VISIBLE_SLOTS] = {};
+    int refreshed_slot_count_ = -1;           ///< Slot count the versions above refer to
+    AmsBackend* refreshed_backend_ = nullptr; ///< Backend the versions above refer to
     lv_obj_t* labels_layer_ = nullptr; ///< Container for labels (drawn on top of all spools)
 
     // === Extracted UI Modules ===
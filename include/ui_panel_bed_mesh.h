@@ -181,6 +181,13 @@ class BedMeshPanel : public OverlayBase {
     double cached_mesh_max_y_ = 0.0;
     bool has_cached_mesh_bounds_ = false;
 
+    // Stats of the mesh being shown (shared with MoonrakerAPI's cached profile)
+    helix::BedMeshStats mesh_stats_;
+
+    // Mesh on canvas_, so status updates repeating the same bed_mesh are skipped
+    uint64_t shown_mesh_hash_ = 0; ///< BedMeshProfile::content_hash (0 = none shown)
+    std::string shown_mesh_name_;
+
     // Pending mesh data - stored until build_volume is available
     std::vector<std::vector<float>> pending_mesh_data_;
     bool has_pending_mesh_data_ = false;
@@ -195,7 +202,9 @@ class BedMeshPanel : public OverlayBase {
     void refresh_bed_bounds();
     void on_mesh_update_internal(const BedMeshProfile& mesh);
     void update_profile_list_subjects();
-    void update_info_subjects(const std::vector<std::vector<float>>& mesh_data, int cols, int rows);
+    void render_mesh(const std::vector<std::vector<float>>& mesh_data,
+                     const helix::BedMeshStats& stats);
+    void update_info_subjects(const helix::BedMeshStats& stats, int cols, int rows);
 
     // Calculate range (variance) for a profile
     float calculate_profile_range(const std::string& profile_name);
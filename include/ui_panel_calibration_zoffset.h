@@ -218,11 +218,3 @@ void destroy_zoffset_cal_panel();
  * Registers "on_zoffset_row_clicked" callback.
  */
 void init_zoffset_row_handler();
-
-/**
- * @brief Initialize event callbacks for the Z-Offset calibration panel
- *
- * Must be called during app initialization before XML creation.
- * Registers all button click callbacks used by calibration_zoffset_panel.xml.
- */
-void init_zoffset_event_callbacks();
@@ -55,6 +55,11 @@ class ConsolePanel : public OverlayBase {
     void on_activate() override;
     void on_deactivate() override;
 
+    /// History is refetched on every activation, so the tree is cheap to recreate
+    bool is_evictable() const override {
+        return true;
+    }
+
     /**
      * @brief Send the current G-code command from the input field
      *
@@ -71,6 +76,9 @@ class ConsolePanel : public OverlayBase {
      */
     void clear_display();
 
+  protected:
+    void on_evict() override;
+
   private:
     /**
      * @brief Entry in the console history
@@ -30,12 +30,14 @@
  * all displayed statistics. Filter selection is maintained across panel activations.
  *
  * ## Data Flow:
- * 1. On activate, calls MoonrakerAPI::get_history_list() with time filter
- * 2. Parses response to calculate statistics client-side
- * 3. Updates stat labels via direct widget manipulation
+ * 1. On activate, reads PrintHistoryManager's time-bucketed rollups
+ * 2. Sums the buckets covered by the time filter (O(periods), not O(jobs))
+ * 3. Updates stat subjects and charts
+ *
+ * Windows are calendar-aligned: "Last 7 days" is today plus the 6 days before.
  *
  * Note: Moonraker's server.history.totals doesn't provide breakdown counts,
- * so we calculate success/fail/cancelled from the job list.
+ * so success/fail/cancelled come from the client-side rollups.
  *
  * @see print_history_data.h for data structures
  * @see OverlayBase for base class documentation
@@ -107,6 +109,11 @@ class HistoryDashboardPanel : public OverlayBase {
      */
     void on_deactivate() override;
 
+    /// Statistics are recomputed on every activation, so the tree is cheap to recreate
+    bool is_evictable() const override {
+        return true;
+    }
+
     //
     // === Public API ===
     //
@@ -126,14 +133,12 @@ class HistoryDashboardPanel : public OverlayBase {
     }
 
     /**
-     * @brief Get the cached jobs from the last fetch
+     * @brief Get the manager's jobs covered by the current time filter
      *
-     * Returns the jobs retrieved from the API during the last refresh.
-     * Used by HistoryListPanel to avoid redundant API calls.
+     * Used to hand HistoryListPanel the same jobs the dashboard summarizes,
+     * avoiding redundant API calls.
      */
-    const std::vector<PrintHistoryJob>& get_cached_jobs() const {
-        return cached_jobs_;
-    }
+    std::vector<PrintHistoryJob> get_filtered_jobs() const;
 
     //
     // === Static Event Callbacks (registered with lv_xml_register_event_cb) ===
@@ -147,6 +152,9 @@ class HistoryDashboardPanel : public OverlayBase {
     static void on_filter_all_clicked(lv_event_t* e);
     static void on_view_history_clicked(lv_event_t* e);
 
+  protected:
+    void on_evict() override;
+
   private:
     //
     // === Widget References ===
@@ -192,8 +200,7 @@ class HistoryDashboardPanel : public OverlayBase {
     //
 
     HistoryTimeFilter current_filter_ = HistoryTimeFilter::ALL_TIME;
-    std::vector<PrintHistoryJob> cached_jobs_; ///< Time-filtered subset for get_cached_jobs()
-    bool is_active_ = false;                   ///< Track if panel is currently visible
+    bool is_active_ = false; ///< Track if panel is currently visible
 
     // Parent screen reference
     lv_obj_t* parent_screen_ = nullptr;
@@ -244,11 +251,22 @@ class HistoryDashboardPanel : public OverlayBase {
     void refresh_data();
 
     /**
-     * @brief Calculate and display statistics from job list
+     * @brief Rollup buckets shown by the trend chart for the current filter
+     */
+    struct TrendWindow {
+        HistoryRollupPeriod period = HistoryRollupPeriod::DAY;
+        int64_t first_key = 0; ///< Oldest bucket shown
+        int point_count = 1;   ///< Chart points
+        int group = 1;         ///< Buckets merged into each point (ALL_TIME over a year)
+    };
+
+    /**
+     * @brief Display statistics summed over the current window
      *
-     * @param jobs Vector of print history jobs
+     * @param stats Rollup totals for the filter
+     * @param window Buckets the filter covers
      */
-    void update_statistics(const std::vector<PrintHistoryJob>& jobs);
+    void update_statistics(const HistoryRollupBucket& stats, const TrendWindow& window);
 
     //
     // === Formatting Helpers ===
@@ -283,28 +301,28 @@ class HistoryDashboardPanel : public OverlayBase {
     void create_filament_chart();
 
     /**
-     * @brief Update trend chart with prints-per-day data
-     * @param jobs The job list to analyze
+     * @brief Update trend chart with prints per bucket
+     * @param window Buckets to plot
      */
-    void update_trend_chart(const std::vector<PrintHistoryJob>& jobs);
+    void update_trend_chart(const TrendWindow& window);
 
     /**
      * @brief Update filament chart with usage by type
-     * @param jobs The job list to analyze
+     * @param stats Rollup totals for the filter
      */
-    void update_filament_chart(const std::vector<PrintHistoryJob>& jobs);
+    void update_filament_chart(const HistoryRollupBucket& stats);
 
     /**
-     * @brief Get the number of periods for trend based on time filter
-     * @return Number of data points (7 for day/week, more for longer ranges)
+     * @brief Get the rollup buckets for the current time filter
+     *
+     * Day: 24 hours, Week/Month: 7/30 days, Year: 12 months. All time uses
+     * 12 days, weeks or months (whichever first covers the oldest job),
+     * merging months when history spans more than a year.
      */
-    int get_trend_period_count() const;
+    TrendWindow get_trend_window() const;
 
-    /**
-     * @brief Get the seconds per period for trend calculation
-     * @return Seconds per time bucket based on current filter
-     */
-    double get_trend_period_seconds() const;
+    /// Start of the current filter's window (0 for ALL_TIME)
+    double get_filter_since() const;
 };
 
 /**
@@ -17,6 +17,7 @@
 
 class MoonrakerClient;
 class MoonrakerAPI;
+struct ui_frequency_response_chart_t;
 
 /**
  * @file ui_panel_input_shaper.h
@@ -29,7 +30,7 @@ class MoonrakerAPI;
  * ## State Machine:
  * - IDLE: Shows instructions and buttons to start calibration
  * - MEASURING: Calibration running, show spinner and cancel button
- * - RESULTS: Display recommendations, Apply/Dismiss buttons
+ * - RESULTS: Display recommendations, spectrum chart, Apply/Dismiss buttons
  * - ERROR: Something went wrong, retry option
  *
  * ## Klipper Commands Used:
@@ -163,6 +164,7 @@ class InputShaperPanel : public OverlayBase {
     void handle_save_config_clicked();
     void handle_print_test_pattern_clicked();
     void handle_help_clicked();
+    void handle_less_smoothing_clicked();
 
   private:
     // Subject manager for RAII cleanup
@@ -184,10 +186,19 @@ class InputShaperPanel : public OverlayBase {
     void on_calibration_error(const std::string& message);
 
     // UI update helpers
+    void show_result(const InputShaperResult& result);
     void populate_results();
     void clear_results();
+    void update_chart(const InputShaperResult& result);
+    void clear_chart();
     void update_status_label(const std::string& text);
 
+    /// Persist both axes' results (with spectra) in InputShaperCache
+    void store_results();
+
+    /// Each "Less Smoothing" re-fit caps smoothing at this fraction of the current pick's
+    static constexpr float LESS_SMOOTHING_FACTOR = 0.8f;
+
     // Widget/client references (overlay_root_ inherited from OverlayBase)
     lv_obj_t* parent_screen_ = nullptr;
     MoonrakerClient* client_ = nullptr;
@@ -200,6 +211,11 @@ class InputShaperPanel : public OverlayBase {
     lv_obj_t* status_label_ = nullptr;
     lv_obj_t* error_message_ = nullptr;
     lv_obj_t* recommendation_label_ = nullptr;
+    lv_obj_t* chart_container_ = nullptr;
+
+    // Spectrum chart: PSD plus the vibrations left by each fitted shaper
+    ui_frequency_response_chart_t* chart_ = nullptr;
+    std::vector<int> chart_series_;
 
     // Subjects for reactive bindings
     static constexpr size_t MAX_SHAPERS = 5;
@@ -210,6 +226,7 @@ class InputShaperPanel : public OverlayBase {
     std::array<lv_subject_t, MAX_SHAPERS> shaper_type_subjects_;
     std::array<lv_subject_t, MAX_SHAPERS> shaper_freq_subjects_;
     std::array<lv_subject_t, MAX_SHAPERS> shaper_vib_subjects_;
+    lv_subject_t can_refit_subject_; ///< 1 if the result keeps a spectrum to re-fit
 
     // Fixed char arrays for string subjects
     char shaper_type_bufs_[MAX_SHAPERS][SHAPER_TYPE_BUF_SIZE] = {};
@@ -46,6 +46,11 @@ class MacrosPanel : public OverlayBase {
     void on_activate() override;
     void on_deactivate() override;
 
+    /// Macro cards are rebuilt on every activation, so the tree is cheap to recreate
+    bool is_evictable() const override {
+        return true;
+    }
+
     // === Public API ===
     lv_obj_t* get_panel() const {
         return overlay_root_;
@@ -59,6 +64,9 @@ class MacrosPanel : public OverlayBase {
      */
     static void on_macro_card_clicked(lv_event_t* e);
 
+  protected:
+    void on_evict() override;
+
   private:
     /**
      * @brief Information about a displayed macro
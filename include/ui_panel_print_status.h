@@ -24,6 +24,7 @@ class MoonrakerAPI;
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Forward declarations
 class TempControlPanel;
@@ -280,6 +281,7 @@ class PrintStatusPanel : public OverlayBase {
 
     lv_subject_t progress_text_subject_;
     lv_subject_t layer_text_subject_;
+    lv_subject_t layer_time_subject_; ///< Estimated time of the current layer
     lv_subject_t elapsed_subject_;
     lv_subject_t remaining_subject_;
     lv_subject_t nozzle_temp_subject_;
@@ -300,6 +302,7 @@ class PrintStatusPanel : public OverlayBase {
     // Subject storage buffers
     char progress_text_buf_[32] = "0%";
     char layer_text_buf_[64] = "Layer 0 / 0";
+    char layer_time_buf_[32] = "";
     char preparing_operation_buf_[64] = "Preparing...";
     char elapsed_buf_[32] = "0h 00m";
     char remaining_buf_[32] = "0h 00m";
@@ -326,6 +329,7 @@ class PrintStatusPanel : public OverlayBase {
     uint32_t thumbnail_load_generation_ = 0; ///< Generation counter for async callback safety
     int current_layer_ = 0;
     int total_layers_ = 0;
+    std::vector<float> layer_durations_; ///< Estimated seconds per printed layer (analysis)
     int elapsed_seconds_ = 0;
     int remaining_seconds_ = 0;
     int nozzle_current_ = 0;
@@ -363,9 +367,13 @@ class PrintStatusPanel : public OverlayBase {
     // Used to load gcode immediately if already active when print starts
     bool is_active_ = false;
 
-    // Path to temp G-code file downloaded for viewing (cleaned up on print end)
+    // Path to temp G-code file downloaded for analysis and viewing (cleaned up on print end)
     std::string temp_gcode_path_;
 
+    // File being downloaded to temp_gcode_path_, and the file the viewer waits for
+    std::string fetching_gcode_filename_;
+    std::string viewer_waiting_filename_;
+
     // Control buttons (stored for enable/disable on state changes)
     lv_obj_t* btn_timelapse_ = nullptr;
     lv_obj_t* btn_pause_ = nullptr;
@@ -406,6 +414,13 @@ class PrintStatusPanel : public OverlayBase {
     void load_thumbnail_for_file(const std::string& filename); ///< Fetch and display thumbnail
     void
     load_gcode_for_viewing(const std::string& filename); ///< Download and load G-code into viewer
+    std::string gcode_temp_path(const std::string& filename) const;
+    void fetch_print_gcode(const std::string& filename); ///< Local copy for analysis and viewer
+    void on_print_gcode_fetched(const std::string& filename, const std::string& path);
+    void on_print_gcode_unavailable(const std::string& filename);
+    void load_print_time_table(const std::string& filename,
+                               const std::string& path); ///< Time-left model and layer times
+    void update_layer_time_display();
     void update_button_states();    ///< Enable/disable buttons based on current print state
     void animate_print_complete();  ///< Celebratory animation when print finishes
     void animate_print_cancelled(); ///< Warning animation when print is cancelled
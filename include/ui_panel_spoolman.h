@@ -52,6 +52,11 @@ class SpoolmanPanel : public OverlayBase {
     void on_activate() override;
     void on_deactivate() override;
 
+    /// Spools are refetched on every activation, so the tree is cheap to recreate
+    bool is_evictable() const override {
+        return true;
+    }
+
     // === Public API ===
     lv_obj_t* get_panel() const {
         return overlay_root_;
@@ -65,6 +70,9 @@ class SpoolmanPanel : public OverlayBase {
      */
     void refresh_spools();
 
+  protected:
+    void on_evict() override;
+
   private:
     // ========== UI Widget Pointers ==========
     lv_obj_t* spool_list_ = nullptr; // Still needed for populate_spool_list()
@@ -477,6 +477,11 @@ class PrintPreparationManager {
     std::string cached_scan_filename_;
     std::optional<size_t> cached_file_size_; ///< File size from Moonraker metadata
 
+    /// First preamble fetch; covers the thumbnails and START_PRINT of most files
+    static constexpr size_t SCAN_DOWNLOAD_LIMIT = 200 * 1024;
+    /// Preamble fetches double up to this size (1.4 MB transferred at worst)
+    static constexpr size_t SCAN_DOWNLOAD_MAX = 800 * 1024;
+
     /**
      * @brief Get cached printer capabilities from PrinterState
      *
@@ -518,6 +523,15 @@ class PrintPreparationManager {
      */
     [[nodiscard]] std::vector<gcode::OperationType> collect_ops_to_disable() const;
 
+    /**
+     * @brief Fetch and scan the first `window` bytes of a file
+     *
+     * If the preamble does not end within the window (e.g. large embedded
+     * thumbnails), the scan is retried with a doubled window up to
+     * SCAN_DOWNLOAD_MAX, so the whole file is never downloaded for a scan.
+     */
+    void scan_preamble(const std::string& filename, const std::string& file_path, size_t window);
+
     /**
      * @brief Download, modify, and print a G-code file
      *
@@ -28,11 +28,15 @@
  *   - Chamber: 0x4444FF (blue)
  *   - Ambient: 0xFFAA44 (orange)
  *
- * Performance: ~2.4KB per series (300 points × 8 bytes). Update is O(1) circular buffer.
+ * Performance: each series keeps its raw samples (4 bytes × point_count) and the chart holds
+ * a min/max decimated copy of ~2 points per horizontal pixel (see ui_temp_graph_decimation.h),
+ * so redraw cost scales with chart width rather than history length. Updates are O(1).
  */
 
 #pragma once
 
+#include "ui_temp_graph_decimation.h"
+
 #include "lvgl/lvgl.h"
 
 // Default configuration
@@ -65,6 +69,12 @@ struct ui_temp_series_meta_t {
     lv_opa_t gradient_bottom_opa;     // Bottom gradient opacity
     lv_opa_t gradient_top_opa;        // Top gradient opacity
     bool first_value_received;        // True after first real data point (for backfill)
+
+    // Raw samples (ring of graph->point_count), kept so the chart can be re-decimated on resize
+    int32_t* raw_values;           // Heap-allocated ring buffer
+    int raw_head;                  // Index of oldest sample once the ring is full
+    int raw_count;                 // Number of samples in the ring
+    ui_temp_graph_bucket_t bucket; // Min/max of the newest (partial) chart bucket
 };
 
 /**
@@ -77,6 +87,8 @@ struct ui_temp_graph_t {
     int series_count;                                            // Current number of series
     int next_series_id;                                          // Next available series ID
     int point_count;                                             // Number of points per series
+    int bucket_size;       // Raw samples per chart bucket (1 = no decimation)
+    int chart_point_count; // Points per series in the LVGL chart after decimation
     float min_temp;                                              // Y-axis minimum temperature
     float max_temp;                                              // Y-axis maximum temperature
 
@@ -246,6 +258,9 @@ void ui_temp_graph_set_temp_range(ui_temp_graph_t* graph, float min, float max);
 /**
  * Set the number of data points per series (capacity)
  *
+ * This is the number of samples in the time window; the chart itself may hold
+ * fewer points once the series is decimated to its pixel width.
+ *
  * @param graph Graph instance
  * @param count Number of points (e.g., 300 for 5 min @ 1s)
  */
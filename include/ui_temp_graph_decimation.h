@@ -0,0 +1,137 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @file ui_temp_graph_decimation.h
+ * @brief Min/max decimation of temperature series to the chart's pixel width
+ *
+ * A 20-minute series is 1200 samples, but a chart a few hundred pixels wide
+ * can only show ~2 points per column. Samples are grouped into buckets and
+ * each bucket is drawn as its min and max (in time order), so the line keeps
+ * every spike and dip while LVGL only walks ~2 × width points per redraw.
+ *
+ * Min/max is used rather than LTTB because it never drops an extreme (a
+ * thermal runaway spike must stay visible) and a bucket can be updated in
+ * place as samples arrive, without looking at its neighbours.
+ *
+ * Plain C structs and inline helpers so the state can live in the memset-
+ * initialized ui_temp_graph_t structs.
+ */
+
+/**
+ * @brief Running min/max for the bucket currently being filled
+ */
+struct ui_temp_graph_bucket_t {
+    int32_t min;   // Lowest value in bucket
+    int32_t max;   // Highest value in bucket
+    int min_index; // Position of min within bucket (for time ordering)
+    int max_index; // Position of max within bucket
+    int count;     // Samples in bucket (0 = no bucket started)
+};
+
+/**
+ * @brief Samples per bucket for a series of point_count shown in content_width pixels
+ *
+ * @return 1 (no decimation) if the series already fits in ~2 points per pixel
+ *         or the chart has not been laid out yet
+ */
+inline int ui_temp_graph_bucket_size(int point_count, int32_t content_width) {
+    if (content_width <= 0 || point_count <= 2 * content_width) {
+        return 1;
+    }
+    return static_cast<int>((point_count + content_width - 1) / content_width);
+}
+
+/**
+ * @brief Number of chart points needed to show point_count samples
+ *
+ * Each bucket contributes two points (min and max).
+ */
+inline int ui_temp_graph_decimated_point_count(int point_count, int bucket_size) {
+    if (bucket_size <= 1) {
+        return point_count;
+    }
+    return 2 * ((point_count + bucket_size - 1) / bucket_size);
+}
+
+/**
+ * @brief Add a sample to the current bucket
+ *
+ * @return true if the sample started a new bucket (the caller appends two
+ *         chart points), false if it updated the current one (the caller
+ *         rewrites the newest two points)
+ */
+inline bool ui_temp_graph_bucket_push(ui_temp_graph_bucket_t* bucket, int bucket_size,
+                                      int32_t value) {
+    if (bucket->count == 0 || bucket->count >= bucket_size) {
+        bucket->min = value;
+        bucket->max = value;
+        bucket->min_index = 0;
+        bucket->max_index = 0;
+        bucket->count = 1;
+        return true;
+    }
+
+    if (value < bucket->min) {
+        bucket->min = value;
+        bucket->min_index = bucket->count;
+    }
+    if (value > bucket->max) {
+        bucket->max = value;
+        bucket->max_index = bucket->count;
+    }
+    bucket->count++;
+    return false;
+}
+
+/**
+ * @brief The bucket's two chart points, earlier extreme first
+ */
+inline void ui_temp_graph_bucket_points(const ui_temp_graph_bucket_t* bucket, int32_t* first,
+                                        int32_t* second) {
+    if (bucket->max_index < bucket->min_index) {
+        *first = bucket->max;
+        *second = bucket->min;
+    } else {
+        *first = bucket->min;
+        *second = bucket->max;
+    }
+}
+
+/**
+ * @brief Decimate a whole series (used when rebuilding after a resize or bulk load)
+ *
+ * Produces the same points as pushing each sample through
+ * ui_temp_graph_bucket_push(), and leaves @p bucket holding the last (possibly
+ * partial) bucket so incremental updates continue seamlessly.
+ *
+ * @param values Samples, oldest first
+ * @param count Number of samples
+ * @param bucket_size Samples per bucket (1 = copy through)
+ * @param out Output buffer with room for ui_temp_graph_decimated_point_count(count, bucket_size)
+ * @param bucket Bucket state to reset and fill
+ * @return Number of points written to out
+ */
+inline int ui_temp_graph_decimate(const int32_t* values, int count, int bucket_size, int32_t* out,
+                                  ui_temp_graph_bucket_t* bucket) {
+    *bucket = ui_temp_graph_bucket_t{};
+    if (bucket_size <= 1) {
+        for (int i = 0; i < count; i++) {
+            out[i] = values[i];
+        }
+        return count;
+    }
+
+    int written = 0;
+    for (int i = 0; i < count; i++) {
+        if (ui_temp_graph_bucket_push(bucket, bucket_size, values[i])) {
+            written += 2;
+        }
+        ui_temp_graph_bucket_points(bucket, &out[written - 2], &out[written - 1]);
+    }
+    return written;
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @file xml_component_bundle.h
+ * @brief Read-only view of the pre-built XML component bundle
+ *
+ * The bundle packs every component in ui_xml/ into one file so startup does
+ * a single mmap instead of ~130 small reads from SD. Components are stored
+ * minified and NUL-terminated, so the mapped bytes can be handed straight to
+ * lv_xml_component_register_from_data() without copying.
+ *
+ * The bundle is generated at build time by:
+ *   - make gen-xml-bundle (scripts/gen_xml_bundle.py)
+ *
+ * and deployed as assets/ui_xml.bundle. When it is missing (development runs
+ * from the source tree) registration falls back to the raw XML files, so XML
+ * edits are picked up without regenerating anything.
+ *
+ * ## File Layout (little-endian uint32 fields)
+ * - header:  magic "HXMLBNDL", version, entry_count,
+ *            strtab_offset, strtab_size, data_offset, data_size
+ * - entries: entry_count x {name_offset, name_len, data_offset, data_len},
+ *            sorted by name
+ * - strtab:  NUL-terminated component names
+ * - data:    NUL-terminated minified XML
+ *
+ * @threading Main thread only (opened once during XML registration)
+ * @see scripts/gen_xml_bundle.py
+ */
+
+namespace helix {
+
+class XmlComponentBundle {
+  public:
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /// Default install-relative location of the bundle
+    static constexpr const char* DEFAULT_PATH = "assets/ui_xml.bundle";
+
+    XmlComponentBundle() = default;
+    ~XmlComponentBundle();
+
+    XmlComponentBundle(const XmlComponentBundle&) = delete;
+    XmlComponentBundle& operator=(const XmlComponentBundle&) = delete;
+
+    /**
+     * @brief Map and validate a bundle file
+     *
+     * Any previously opened bundle is closed first. On failure (missing file,
+     * bad magic, version mismatch, out-of-range offsets) the bundle stays closed.
+     *
+     * @param path Filesystem path to the bundle
+     * @return true if the bundle was mapped and validated
+     */
+    bool open(const std::string& path);
+
+    /// Unmap the bundle (safe to call when not open)
+    void close();
+
+    [[nodiscard]] bool is_open() const {
+        return base_ != nullptr;
+    }
+
+    /// Number of components in the bundle
+    [[nodiscard]] size_t size() const {
+        return entry_count_;
+    }
+
+    /// Component name at index (sorted order), or empty if out of range
+    [[nodiscard]] std::string_view name_at(size_t index) const;
+
+    /**
+     * @brief Look up a component's XML by name
+     *
+     * @param name Component name (file stem, e.g. "home_panel")
+     * @return Pointer to NUL-terminated XML inside the mapping, or nullptr if
+     *         the bundle is closed or has no such component. Valid until close().
+     */
+    [[nodiscard]] const char* find(std::string_view name) const;
+
+    /**
+     * @brief Derive the component name from an LVGL path
+     *
+     * "A:ui_xml/home_panel.xml" -> "home_panel"
+     */
+    [[nodiscard]] static std::string_view component_name_from_path(std::string_view path);
+
+  private:
+    struct Entry {
+        uint32_t name_offset;
+        uint32_t name_len;
+        uint32_t data_offset;
+        uint32_t data_len;
+    };
+
+    [[nodiscard]] const Entry* entry(size_t index) const;
+    [[nodiscard]] bool validate();
+
+    const uint8_t* base_ = nullptr;
+    size_t length_ = 0;
+    uint32_t entry_count_ = 0;
+    uint32_t strtab_offset_ = 0;
+    uint32_t strtab_size_ = 0;
+    uint32_t data_offset_ = 0;
+    uint32_t data_size_ = 0;
+};
+
+} // namespace helix
@@ -21,9 +21,24 @@ namespace helix {
  */
 void register_xml_components();
 
+/**
+ * @brief Register a single XML component, preferring the pre-built bundle
+ *
+ * Looks the component up in assets/ui_xml.bundle (see XmlComponentBundle) and
+ * registers it from the mapped data. Falls back to reading @p path when the
+ * bundle is missing, disabled (HELIX_XML_BUNDLE=0) or lacks the component, so
+ * development runs keep picking up XML edits directly.
+ *
+ * @param path LVGL path to the XML file (e.g. "A:ui_xml/home_panel.xml");
+ *             the file stem is used as the component name
+ * @return true if the component was registered
+ */
+bool register_xml_component(const char* path);
+
 /**
  * @brief Deinitialize XML-related subjects
  *
+ * Also unmaps the component bundle.
  * Must be called during shutdown before lv_deinit().
  * Called by StaticPanelRegistry.
  */
@@ -158,8 +158,14 @@
 
 	/* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiple threads will render the screen in parallel */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+     * > 1 means multiple threads will render the screen in parallel
+     * HelixScreen: build-time ceiling, overridden per target in mk/cross.mk.
+     * RenderProfile (render_profile.h) picks the count for the device at runtime;
+     * DisplayManager parks the units above it. */
+    #ifndef HELIX_DRAW_SW_UNITS
+        #define HELIX_DRAW_SW_UNITS     4
+    #endif
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    HELIX_DRAW_SW_UNITS
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -59,10 +59,12 @@ else ifeq ($(PLATFORM_TARGET),ad5m)
     # -ffunction-sections/-fdata-sections: Allow linker to remove unused sections
     # -Wno-error=conversion: LVGL headers have int32_t->float conversions that GCC flags
     # -DHELIX_RELEASE_BUILD: Disables debug features like LV_USE_ASSERT_STYLE
+    # -DHELIX_DRAW_SW_UNITS=1: Single LVGL draw thread (no spare stacks on 110MB RAM)
     # NOTE: AD5M framebuffer is 32bpp (ARGB8888), as is lv_conf.h (LV_COLOR_DEPTH=32)
     TARGET_CFLAGS := -march=armv7-a -mfpu=neon-vfpv4 -mfloat-abi=hard -mtune=cortex-a7 \
         -Os -flto -ffunction-sections -fdata-sections \
-        -Wno-error=conversion -Wno-error=sign-conversion -DHELIX_RELEASE_BUILD
+        -Wno-error=conversion -Wno-error=sign-conversion -DHELIX_RELEASE_BUILD \
+        -DHELIX_DRAW_SW_UNITS=1
     # -Wl,--gc-sections: Remove unused sections during linking (works with -ffunction-sections)
     # -flto: Must match compiler flag for LTO to work
     # -static: Fully static binary - no runtime dependencies on system libs
@@ -116,7 +118,8 @@ else ifeq ($(PLATFORM_TARGET),k1)
         -Os -flto=auto -ffunction-sections -fdata-sections \
         -fomit-frame-pointer -fno-unwind-tables -fno-asynchronous-unwind-tables \
         -fmerge-all-constants -fno-ident \
-        -Wno-error=conversion -Wno-error=sign-conversion -DHELIX_RELEASE_BUILD
+        -Wno-error=conversion -Wno-error=sign-conversion -DHELIX_RELEASE_BUILD \
+        -DHELIX_DRAW_SW_UNITS=1
     # Linker flags:
     # -Wl,--gc-sections: Remove unused sections (works with -ffunction-sections)
     # -flto=auto: Match compiler LTO flag, uses all CPUs
@@ -478,6 +481,8 @@ define deploy-common
 		echo "$(DIM)Generating placeholder images...$(RESET)"; \
 		$(MAKE) gen-placeholder-images; \
 	fi
+	@$(MAKE) --no-print-directory gen-xml-bundle
+	@$(MAKE) --no-print-directory gen-translation-catalogs
 	@# Stop running processes and prepare directory
 	ssh $(1) "killall helix-watchdog helix-screen helix-splash 2>/dev/null || true; mkdir -p $(2)"
 	ssh $(1) "rm -f $(2)/*.xml 2>/dev/null || true"
@@ -493,6 +498,14 @@ define deploy-common
 	@if [ -d build/assets/images/printers/prerendered ]; then \
 		rsync $(DEPLOY_RSYNC_FLAGS) build/assets/images/printers/prerendered/ $(1):$(2)/assets/images/printers/prerendered/; \
 	fi
+	@# Sync pre-built XML component bundle
+	@if [ -f build/assets/ui_xml.bundle ]; then \
+		rsync -avz --checksum build/assets/ui_xml.bundle $(1):$(2)/assets/; \
+	fi
+	@# Sync per-language translation catalogs
+	@if [ -d build/assets/translations ]; then \
+		rsync $(DEPLOY_RSYNC_FLAGS) --exclude='.stamp' build/assets/translations/ $(1):$(2)/assets/translations/; \
+	fi
 endef
 
 # =============================================================================
@@ -597,6 +610,8 @@ deploy-ad5m:
 		echo "$(DIM)Generating pre-rendered printer images...$(RESET)"; \
 		$(MAKE) gen-printer-images; \
 	fi
+	@$(MAKE) --no-print-directory gen-xml-bundle
+	@$(MAKE) --no-print-directory gen-translation-catalogs
 	@# Stop running processes and prepare directory
 	ssh $(AD5M_SSH_TARGET) "killall helix-watchdog helix-screen helix-splash 2>/dev/null || true; mkdir -p $(AD5M_DEPLOY_DIR)"
 	@# Transfer binaries via cat/ssh (AD5M has no scp sftp-server)
@@ -618,6 +633,14 @@ deploy-ad5m:
 	@if [ -d build/assets/images/printers/prerendered ] && ls build/assets/images/printers/prerendered/*.bin >/dev/null 2>&1; then \
 		COPYFILE_DISABLE=1 tar -cf - -C build/assets/images/printers prerendered | ssh $(AD5M_SSH_TARGET) "cd $(AD5M_DEPLOY_DIR)/assets/images/printers && tar -xf -"; \
 	fi
+	@if [ -f build/assets/ui_xml.bundle ]; then \
+		echo "$(DIM)Transferring XML component bundle...$(RESET)"; \
+		cat build/assets/ui_xml.bundle | ssh $(AD5M_SSH_TARGET) "cat > $(AD5M_DEPLOY_DIR)/assets/ui_xml.bundle"; \
+	fi
+	@if ls build/assets/translations/*.bin >/dev/null 2>&1; then \
+		echo "$(DIM)Transferring translation catalogs...$(RESET)"; \
+		COPYFILE_DISABLE=1 tar -cf - -C build/assets translations --exclude='.stamp' | ssh $(AD5M_SSH_TARGET) "cd $(AD5M_DEPLOY_DIR)/assets && tar -xf -"; \
+	fi
 	@# AD5M-specific: Update init script in /etc/init.d/ if it differs
 	@echo "$(DIM)Checking init script...$(RESET)"
 	@ssh $(AD5M_SSH_TARGET) '\
@@ -823,7 +846,8 @@ k1-test: k1-docker deploy-k1-fg
 # Release Packaging
 # =============================================================================
 # Creates distributable tar.gz archives for each platform
-# Includes: binaries, ui_xml, config, assets (fonts/images only, no test files)
+# Includes: binaries, ui_xml, config, assets (fonts/images only, no test files),
+# the pre-built XML component bundle and the translation catalogs
 
 RELEASE_DIR := releases
 VERSION := $(shell cat VERSION.txt 2>/dev/null || echo "dev")
@@ -836,6 +860,8 @@ RELEASE_ASSETS := assets/fonts assets/images
 # Package Pi release
 release-pi: | build/pi/bin/helix-screen build/pi/bin/helix-splash
 	@echo "$(CYAN)$(BOLD)Packaging Pi release v$(VERSION)...$(RESET)"
+	@$(MAKE) --no-print-directory gen-xml-bundle
+	@$(MAKE) --no-print-directory gen-translation-catalogs
 	@mkdir -p $(RELEASE_DIR)/helixscreen
 	@cp build/pi/bin/helix-screen build/pi/bin/helix-splash $(RELEASE_DIR)/helixscreen/
 	@cp -r ui_xml config $(RELEASE_DIR)/helixscreen/
@@ -854,6 +880,15 @@ release-pi: | build/pi/bin/helix-screen build/pi/bin/helix-splash
 		mkdir -p $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered; \
 		cp -r build/assets/images/printers/prerendered/* $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered/; \
 	fi
+	@# Copy pre-built XML component bundle
+	@if [ -f build/assets/ui_xml.bundle ]; then \
+		cp build/assets/ui_xml.bundle $(RELEASE_DIR)/helixscreen/assets/; \
+	fi
+	@# Copy generated translation catalogs
+	@if ls build/assets/translations/*.bin >/dev/null 2>&1; then \
+		mkdir -p $(RELEASE_DIR)/helixscreen/assets/translations; \
+		cp build/assets/translations/*.bin $(RELEASE_DIR)/helixscreen/assets/translations/; \
+	fi
 	@find $(RELEASE_DIR)/helixscreen -name '.DS_Store' -delete 2>/dev/null || true
 	@cd $(RELEASE_DIR) && COPYFILE_DISABLE=1 tar -czvf helixscreen-pi-$(VERSION).tar.gz helixscreen
 	@rm -rf $(RELEASE_DIR)/helixscreen
@@ -865,6 +900,8 @@ release-pi: | build/pi/bin/helix-screen build/pi/bin/helix-splash
 # Includes pre-configured helixconfig.json for Adventurer 5M Pro (skips setup wizard)
 release-ad5m: | build/ad5m/bin/helix-screen build/ad5m/bin/helix-splash
 	@echo "$(CYAN)$(BOLD)Packaging AD5M release v$(VERSION)...$(RESET)"
+	@$(MAKE) --no-print-directory gen-xml-bundle
+	@$(MAKE) --no-print-directory gen-translation-catalogs
 	@mkdir -p $(RELEASE_DIR)/helixscreen
 	@cp build/ad5m/bin/helix-screen build/ad5m/bin/helix-splash $(RELEASE_DIR)/helixscreen/
 	@cp -r ui_xml config $(RELEASE_DIR)/helixscreen/
@@ -886,6 +923,15 @@ release-ad5m: | build/ad5m/bin/helix-screen build/ad5m/bin/helix-splash
 		mkdir -p $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered; \
 		cp -r build/assets/images/printers/prerendered/* $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered/; \
 	fi
+	@# Copy pre-built XML component bundle
+	@if [ -f build/assets/ui_xml.bundle ]; then \
+		cp build/assets/ui_xml.bundle $(RELEASE_DIR)/helixscreen/assets/; \
+	fi
+	@# Copy generated translation catalogs
+	@if ls build/assets/translations/*.bin >/dev/null 2>&1; then \
+		mkdir -p $(RELEASE_DIR)/helixscreen/assets/translations; \
+		cp build/assets/translations/*.bin $(RELEASE_DIR)/helixscreen/assets/translations/; \
+	fi
 	@find $(RELEASE_DIR)/helixscreen -name '.DS_Store' -delete 2>/dev/null || true
 	@cd $(RELEASE_DIR) && COPYFILE_DISABLE=1 tar -czvf helixscreen-ad5m-$(VERSION).tar.gz helixscreen
 	@rm -rf $(RELEASE_DIR)/helixscreen
@@ -895,6 +941,8 @@ release-ad5m: | build/ad5m/bin/helix-screen build/ad5m/bin/helix-splash
 # Package K1 release
 release-k1: | build/k1/bin/helix-screen build/k1/bin/helix-splash
 	@echo "$(CYAN)$(BOLD)Packaging K1 release v$(VERSION)...$(RESET)"
+	@$(MAKE) --no-print-directory gen-xml-bundle
+	@$(MAKE) --no-print-directory gen-translation-catalogs
 	@mkdir -p $(RELEASE_DIR)/helixscreen
 	@cp build/k1/bin/helix-screen build/k1/bin/helix-splash $(RELEASE_DIR)/helixscreen/
 	@cp -r ui_xml config $(RELEASE_DIR)/helixscreen/
@@ -912,6 +960,15 @@ release-k1: | build/k1/bin/helix-screen build/k1/bin/helix-splash
 		mkdir -p $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered; \
 		cp -r build/assets/images/printers/prerendered/* $(RELEASE_DIR)/helixscreen/assets/images/printers/prerendered/; \
 	fi
+	@# Copy pre-built XML component bundle
+	@if [ -f build/assets/ui_xml.bundle ]; then \
+		cp build/assets/ui_xml.bundle $(RELEASE_DIR)/helixscreen/assets/; \
+	fi
+	@# Copy generated translation catalogs
+	@if ls build/assets/translations/*.bin >/dev/null 2>&1; then \
+		mkdir -p $(RELEASE_DIR)/helixscreen/assets/translations; \
+		cp build/assets/translations/*.bin $(RELEASE_DIR)/helixscreen/assets/translations/; \
+	fi
 	@find $(RELEASE_DIR)/helixscreen -name '.DS_Store' -delete 2>/dev/null || true
 	@cd $(RELEASE_DIR) && COPYFILE_DISABLE=1 tar -czvf helixscreen-k1-$(VERSION).tar.gz helixscreen
 	@rm -rf $(RELEASE_DIR)/helixscreen
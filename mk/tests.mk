@@ -121,6 +121,7 @@ TEST_APP_OBJS := $(filter-out \
 clean-tests:
 	$(ECHO) "$(YELLOW)Cleaning test artifacts...$(RESET)"
 	$(Q)rm -f $(TEST_BIN) $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) $(LVGL_UI_TEST_FIXTURE_OBJ) $(TEST_OBJS)
+	$(Q)rm -f $(TEST_RENDER_BENCH_BIN) $(TEST_RENDER_BENCH_OBJ)
 	$(ECHO) "$(GREEN)✓ Test artifacts cleaned$(RESET)"
 
 # Build tests in parallel (auto-detects core count like main build target)
@@ -216,6 +217,23 @@ test-moonraker: test-build
 	DURATION=$$((END_TIME - START_TIME)); \
 	echo "$(GREEN)✓ Moonraker tests passed in $${DURATION}s$(RESET)"
 
+# Replay recorded (or synthetic) Moonraker traffic through the client and PrinterState
+# Reports dispatch latency, UI frame times, RSS and heap growth
+# HELIX_REPLAY_FILE=session.hxtr replays a capture made with HELIX_RECORD_TRAFFIC
+test-replay-benchmark: test-build
+	$(ECHO) "$(CYAN)$(BOLD)Running Moonraker replay benchmark...$(RESET)"
+	$(Q)$(TEST_BIN) "[replay][.benchmark]"
+	$(ECHO) "$(GREEN)✓ Replay benchmark complete$(RESET)"
+
+# Render custom canvases and panels offscreen at 480x320/800x480/1024x600
+# Writes per-scene frame time percentiles and allocations per frame as JSON
+# HELIX_RENDER_BENCH_SCENES=bed_mesh_3d,temp_graph limits the scenes
+# Built as its own binary so its malloc interposer stays out of helix-tests
+test-render-benchmark: $(TEST_RENDER_BENCH_BIN)
+	$(ECHO) "$(CYAN)$(BOLD)Running render benchmark...$(RESET)"
+	$(Q)HELIX_RENDER_BENCH_OUT=$(BUILD_DIR)/render_benchmark.json $(TEST_RENDER_BENCH_BIN) "[render][.benchmark]"
+	$(ECHO) "$(GREEN)✓ Render benchmark written to $(BUILD_DIR)/render_benchmark.json$(RESET)"
+
 # Run network-related tests (WiFi, Ethernet)
 test-network: test-build
 	$(ECHO) "$(CYAN)$(BOLD)Running network tests...$(RESET)"
@@ -457,7 +475,6 @@ $(TEST_BIN): $(TEST_CORE_DEPS) \
              $(TEST_APP_OBJS) \
              $(MOCK_OBJS) \
              $(FONT_OBJS) \
-             $(TRANS_OBJS) \
              $(OBJCPP_OBJS) \
              $(TEST_PLATFORM_DEPS)
 	$(Q)mkdir -p $(BIN_DIR)
@@ -475,6 +492,23 @@ endif
 .PHONY: FORCE
 FORCE:
 
+# Render benchmark binary: test infrastructure and app objects, no unit tests
+$(TEST_RENDER_BENCH_BIN): $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(UI_TEST_UTILS_OBJ) \
+                          $(LVGL_TEST_FIXTURE_OBJ) $(TEST_FIXTURES_OBJ) \
+                          $(LVGL_UI_TEST_FIXTURE_OBJ) $(TEST_RENDER_BENCH_OBJ) \
+                          $(TEST_LVGL_DEPS) \
+                          $(TEST_APP_OBJS) \
+                          $(MOCK_OBJS) \
+                          $(FONT_OBJS) \
+                          $(OBJCPP_OBJS) \
+                          $(TEST_PLATFORM_DEPS)
+	$(Q)mkdir -p $(BIN_DIR)
+	$(ECHO) "$(MAGENTA)$(BOLD)[LD]$(RESET) helix-render-benchmark"
+	$(Q)$(CXX) $(CXXFLAGS) $(sort $^) -o $@ $(LDFLAGS) || { \
+		echo "$(RED)$(BOLD)✗ Render benchmark linking failed!$(RESET)"; \
+		exit 1; \
+	}
+
 # Integration test binary (uses mocks instead of real LVGL)
 $(TEST_INTEGRATION_BIN): $(TEST_MAIN_OBJ) $(CATCH2_OBJ) $(TEST_INTEGRATION_OBJS) $(MOCK_OBJS)
 	$(Q)mkdir -p $(BIN_DIR)
@@ -888,6 +922,8 @@ help-test:
 	echo "  $${G}test-gcode$${X}           - G-code parsing and geometry tests"; \
 	echo "  $${G}test-ui$${X}              - UI navigation, theme, wizard tests"; \
 	echo "  $${G}test-moonraker$${X}       - Moonraker client and mock tests"; \
+	echo "  $${G}test-replay-benchmark$${X} - Replay Moonraker traffic, report latencies"; \
+	echo "  $${G}test-render-benchmark$${X} - Widget draw cost per scene and resolution (JSON)"; \
 	echo "  $${G}test-network$${X}         - WiFi and Ethernet tests"; \
 	echo "  $${G}test-security$${X}        - Security and injection tests"; \
 	echo "  $${G}test-config$${X}          - Configuration tests"; \
@@ -8,24 +8,24 @@
 VENV_PYTHON_TRANS := .venv/bin/python3
 
 # Generated translation files
-TRANS_GEN_DIR := src/generated
-TRANS_GEN_C := $(TRANS_GEN_DIR)/lv_i18n_translations.c
-TRANS_GEN_H := $(TRANS_GEN_DIR)/lv_i18n_translations.h
 TRANS_XML := ui_xml/translations/translations.xml
 
 # Source files for translations
 TRANS_YAML := $(wildcard translations/*.yml)
 TRANS_SCRIPT := scripts/generate_translations.py
 
-# Add generated translation source to build
-TRANS_SRCS := $(TRANS_GEN_C)
-TRANS_OBJS := $(patsubst $(TRANS_GEN_DIR)/%.c,$(OBJ_DIR)/generated/%.o,$(TRANS_SRCS))
+# Per-language runtime catalogs (see include/translation_catalog.h)
+# BUILD artifacts (not committed), generated during deploy-* targets and shipped
+# as assets/translations/<locale>.bin. Development runs from the source tree
+# fall back to loading translations.xml (all languages).
+TRANS_CATALOG_DIR := build/assets/translations
+TRANS_CATALOG_SCRIPT := scripts/gen_translation_catalogs.py
+TRANS_CATALOG_STAMP := $(TRANS_CATALOG_DIR)/.stamp
 
 # Generate translations from YAML master files
-# Creates: translations.xml, lv_i18n_translations.c, lv_i18n_translations.h
-$(TRANS_GEN_C) $(TRANS_GEN_H) $(TRANS_XML): $(TRANS_YAML) $(TRANS_SCRIPT)
+# Creates: translations.xml
+$(TRANS_XML): $(TRANS_YAML) $(TRANS_SCRIPT)
 	$(ECHO) "$(CYAN)Generating translations from YAML...$(RESET)"
-	$(Q)mkdir -p $(TRANS_GEN_DIR)
 	$(Q)if [ -x "$(VENV_PYTHON_TRANS)" ]; then \
 		$(VENV_PYTHON_TRANS) $(TRANS_SCRIPT); \
 		echo "$(GREEN)✓ Translations generated$(RESET)"; \
@@ -34,11 +34,27 @@ $(TRANS_GEN_C) $(TRANS_GEN_H) $(TRANS_XML): $(TRANS_YAML) $(TRANS_SCRIPT)
 		exit 1; \
 	fi
 
+# Split translations.xml into one mmap-able catalog per language
+# Stdlib-only script, so it runs without the venv (like gen-xml-bundle)
+$(TRANS_CATALOG_STAMP): $(TRANS_XML) $(TRANS_CATALOG_SCRIPT)
+	$(ECHO) "$(CYAN)Building translation catalogs...$(RESET)"
+	$(Q)mkdir -p $(TRANS_CATALOG_DIR)
+	$(Q)python3 $(TRANS_CATALOG_SCRIPT) --input $(TRANS_XML) --output $(TRANS_CATALOG_DIR)
+	$(Q)touch $@
+
+.PHONY: gen-translation-catalogs
+gen-translation-catalogs: $(TRANS_CATALOG_STAMP)
+
+.PHONY: clean-translation-catalogs
+clean-translation-catalogs:
+	$(ECHO) "$(CYAN)Cleaning translation catalogs...$(RESET)"
+	$(Q)rm -rf $(TRANS_CATALOG_DIR)
+	$(ECHO) "$(GREEN)✓ Cleaned $(TRANS_CATALOG_DIR)$(RESET)"
+
 # Phony target for manual regeneration
 .PHONY: translations
 translations:
 	$(ECHO) "$(CYAN)Regenerating translations...$(RESET)"
-	$(Q)mkdir -p $(TRANS_GEN_DIR)
 	$(Q)if [ -x "$(VENV_PYTHON_TRANS)" ]; then \
 		$(VENV_PYTHON_TRANS) $(TRANS_SCRIPT); \
 		echo "$(GREEN)✓ Translations regenerated$(RESET)"; \
@@ -94,14 +110,3 @@ translation-obsolete:
 		echo "$(RED)✗ Python venv not available - run 'make venv-setup'$(RESET)"; \
 		exit 1; \
 	fi
-
-# Compile generated translation source
-# Uses SUBMODULE_CFLAGS since it's generated code
-$(OBJ_DIR)/generated/%.o: $(TRANS_GEN_DIR)/%.c
-	$(Q)mkdir -p $(dir $@)
-	$(ECHO) "$(GREEN)[TRANS]$(RESET) $<"
-	$(Q)$(CC) $(SUBMODULE_CFLAGS) $(INCLUDES) $(LV_CONF) -c $< -o $@ || { \
-		echo "$(RED)✗ Translation compilation failed:$(RESET) $<"; \
-		exit 1; \
-	}
-	$(call emit-compile-command,$(CC),$(SUBMODULE_CFLAGS) $(INCLUDES) $(LV_CONF),$<,$@)
@@ -54,10 +54,12 @@ $(BUILD_DIR)/watchdog/%.o: src/%.cpp | $(BUILD_DIR)/watchdog
 	$(Q)$(CXX) $(WATCHDOG_CXXFLAGS) $(DEPFLAGS) -c $< -o $@
 
 # Watchdog needs config.o (for reading helixconfig.json), backlight_backend.o,
-# logging_init.o (for spdlog journal/syslog detection), and notification stub
+# logging_init.o (for spdlog journal/syslog detection), flight_recorder.o (to dump
+# the crashed child's recent log lines), and notification stub
 WATCHDOG_EXTRA_OBJS := $(OBJ_DIR)/system/config.o \
                        $(BUILD_DIR)/watchdog/backlight_backend.o \
                        $(BUILD_DIR)/watchdog/logging_init.o \
+                       $(BUILD_DIR)/watchdog/flight_recorder.o \
                        $(BUILD_DIR)/watchdog/ui_notification_stub.o
 
 # Compile backlight backend for watchdog (with HELIX_WATCHDOG to skip runtime_config dependency)
@@ -70,6 +72,11 @@ $(BUILD_DIR)/watchdog/logging_init.o: src/system/logging_init.cpp | $(BUILD_DIR)
 	@echo "[CXX] $< (watchdog)"
 	$(Q)$(CXX) $(WATCHDOG_CXXFLAGS) $(DEPFLAGS) -c $< -o $@
 
+# Compile flight recorder for watchdog (also linked by logging_init)
+$(BUILD_DIR)/watchdog/flight_recorder.o: src/system/flight_recorder.cpp | $(BUILD_DIR)/watchdog
+	@echo "[CXX] $< (watchdog)"
+	$(Q)$(CXX) $(WATCHDOG_CXXFLAGS) $(DEPFLAGS) -c $< -o $@
+
 # Compile notification stub for watchdog (with dependency tracking)
 $(BUILD_DIR)/watchdog/ui_notification_stub.o: tools/ui_notification_stub.cpp | $(BUILD_DIR)/watchdog
 	@echo "[CXX] $< (watchdog stub)"
@@ -0,0 +1,37 @@
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# HelixScreen - XML Component Bundle Module
+#
+# Packs every ui_xml/*.xml component into a single binary bundle that the app
+# mmaps at startup instead of reading ~130 files from SD one at a time.
+#
+# The bundle is a BUILD artifact (not committed). It is generated during
+# deploy-* targets and shipped as assets/ui_xml.bundle. Development runs from
+# the source tree never see it, so they keep loading the raw XML files and
+# pick up edits immediately.
+#
+# Targets:
+#   gen-xml-bundle   - Build build/assets/ui_xml.bundle from ui_xml/*.xml
+#   clean-xml-bundle - Remove the generated bundle
+#
+# See: include/xml_component_bundle.h
+
+# Platform-independent data, so it always lives in build/ (not build/<platform>/)
+XML_BUNDLE := build/assets/ui_xml.bundle
+XML_BUNDLE_SCRIPT := scripts/gen_xml_bundle.py
+XML_BUNDLE_SRCS := $(wildcard ui_xml/*.xml)
+
+$(XML_BUNDLE): $(XML_BUNDLE_SRCS) $(XML_BUNDLE_SCRIPT)
+	$(ECHO) "$(CYAN)Bundling XML components...$(RESET)"
+	$(Q)mkdir -p $(dir $@)
+	$(Q)python3 $(XML_BUNDLE_SCRIPT) --input ui_xml --output $@
+
+# NOTE: Uses mkdir -p instead of $(BUILD_DIR) dependency (see gen-images-ad5m comment)
+.PHONY: gen-xml-bundle
+gen-xml-bundle: $(XML_BUNDLE)
+
+.PHONY: clean-xml-bundle
+clean-xml-bundle:
+	$(ECHO) "$(CYAN)Cleaning XML component bundle...$(RESET)"
+	$(Q)rm -f $(XML_BUNDLE)
+	$(ECHO) "$(GREEN)✓ Cleaned $(XML_BUNDLE)$(RESET)"
@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025-2026 356C LLC
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+"""
+Generate the sample accelerometer capture and reference results used by
+tests/unit/test_shaper_analysis.cpp.
+
+The capture is a synthetic TEST_RESONANCES raw_data file: white-noise
+excitation driving a lightly damped resonance at 42 Hz plus a weaker mode at
+95 Hz, sampled at 3200 Hz like an ADXL345. The reference results come from a
+straight NumPy port of Klipper's shaper_calibrate.py (Welch PSD, shaper fit,
+smoothing, max_accel and recommendation), computed from the values exactly as
+written to the CSV so the C++ engine sees identical input.
+
+Requires numpy (developer machine only; not a runtime dependency).
+
+Usage:
+    python3 scripts/gen_resonance_reference.py [--output-dir assets/test_resonances]
+"""
+
+import argparse
+import json
+import math
+from pathlib import Path
+
+import numpy as np
+
+# ----------------------------------------------------------------------------
+# Klipper shaper_defs.py / shaper_calibrate.py (reference implementation)
+# ----------------------------------------------------------------------------
+
+SHAPER_VIBRATION_REDUCTION = 20.
+DEFAULT_DAMPING_RATIO = 0.1
+MIN_FREQ = 5.
+MAX_FREQ = 200.
+WINDOW_T_SEC = 0.5
+MAX_SHAPER_FREQ = 150.
+TEST_DAMPING_RATIOS = [0.075, 0.1, 0.15]
+TARGET_SMOOTHING = 0.12
+
+
+def get_zv_shaper(shaper_freq, damping_ratio):
+    df = math.sqrt(1. - damping_ratio**2)
+    K = math.exp(-damping_ratio * math.pi / df)
+    t_d = 1. / (shaper_freq * df)
+    return [1., K], [0., .5 * t_d]
+
+
+def get_mzv_shaper(shaper_freq, damping_ratio):
+    df = math.sqrt(1. - damping_ratio**2)
+    K = math.exp(-.75 * damping_ratio * math.pi / df)
+    t_d = 1. / (shaper_freq * df)
+    a1 = 1. - 1. / math.sqrt(2.)
+    a2 = (math.sqrt(2.) - 1.) * K
+    a3 = a1 * K * K
+    return [a1, a2, a3], [0., .375 * t_d, .75 * t_d]
+
+
+def get_ei_shaper(shaper_freq, damping_ratio):
+    v_tol = 1. / SHAPER_VIBRATION_REDUCTION
+    df = math.sqrt(1. - damping_ratio**2)
+    K = math.exp(-damping_ratio * math.pi / df)
+    t_d = 1. / (shaper_freq * df)
+    a1 = .25 * (1. + v_tol)
+    a2 = .5 * (1. - v_tol) * K
+    a3 = a1 * K * K
+    return [a1, a2, a3], [0., .5 * t_d, t_d]
+
+
+def get_2hump_ei_shaper(shaper_freq, damping_ratio):
+    v_tol = 1. / SHAPER_VIBRATION_REDUCTION
+    df = math.sqrt(1. - damping_ratio**2)
+    K = math.exp(-damping_ratio * math.pi / df)
+    t_d = 1. / (shaper_freq * df)
+    V2 = v_tol**2
+    X = pow(V2 * (math.sqrt(1. - V2) + 1.), 1. / 3.)
+    a1 = (3. * X * X + 2. * X + 3. * V2) / (16. * X)
+    a2 = (.5 - a1) * K
+    a3 = a2 * K
+    a4 = a1 * K * K * K
+    return [a1, a2, a3, a4], [0., .5 * t_d, t_d, 1.5 * t_d]
+
+
+def get_3hump_ei_shaper(shaper_freq, damping_ratio):
+    v_tol = 1. / SHAPER_VIBRATION_REDUCTION
+    df = math.sqrt(1. - damping_ratio**2)
+    K = math.exp(-damping_ratio * math.pi / df)
+    t_d = 1. / (shaper_freq * df)
+    K2 = K * K
+    a1 = 0.0625 * (1. + 3. * v_tol + 2. * math.sqrt(2. * (v_tol + 1.) * v_tol))
+    a2 = 0.25 * (1. - v_tol) * K
+    a3 = (0.5 * (1. + v_tol) - 2. * a1) * K2
+    a4 = a2 * K2
+    a5 = a1 * K2 * K2
+    return [a1, a2, a3, a4, a5], [0., .5 * t_d, t_d, 1.5 * t_d, 2. * t_d]
+
+
+SHAPERS = [
+    ('zv', get_zv_shaper, 21.),
+    ('mzv', get_mzv_shaper, 23.),
+    ('ei', get_ei_shaper, 29.),
+    ('2hump_ei', get_2hump_ei_shaper, 39.),
+    ('3hump_ei', get_3hump_ei_shaper, 48.),
+]
+
+
+def psd_welch(x, fs, nfft):
+    window = np.kaiser(nfft, 6.)
+    scale = 1.0 / (window**2).sum()
+    overlap = nfft // 2
+    step = nfft - overlap
+    n_windows = (x.shape[-1] - overlap) // step
+    x = np.lib.stride_tricks.as_strided(x, shape=(nfft, n_windows),
+                                        strides=(x.strides[-1], step * x.strides[-1]),
+                                        writeable=False)
+    x = window[:, None] * (x - np.mean(x, axis=0))
+    result = np.fft.rfft(x, n=nfft, axis=0)
+    result = np.conjugate(result) * result
+    result *= scale / fs
+    result[1:-1, :] *= 2.
+    psd = result.real.mean(axis=-1)
+    freqs = np.fft.rfftfreq(nfft, 1. / fs)
+    return freqs, psd
+
+
+def calc_freq_response(data):
+    N = data.shape[0]
+    T = data[-1, 0] - data[0, 0]
+    fs = N / T
+    M = 1 << int(fs * WINDOW_T_SEC - 1).bit_length()
+    fx, px = psd_welch(data[:, 1], fs, M)
+    _, py = psd_welch(data[:, 2], fs, M)
+    _, pz = psd_welch(data[:, 3], fs, M)
+    return fs, M, fx, px + py + pz, px, py, pz
+
+
+def estimate_shaper(shaper, test_damping_ratio, test_freqs):
+    A, T = np.array(shaper[0]), np.array(shaper[1])
+    inv_D = 1. / A.sum()
+    omega = 2. * math.pi * test_freqs
+    damping = test_damping_ratio * omega
+    omega_d = omega * math.sqrt(1. - test_damping_ratio**2)
+    W = A * np.exp(np.outer(-damping, (T[-1] - T)))
+    S = W * np.sin(np.outer(omega_d, T))
+    C = W * np.cos(np.outer(omega_d, T))
+    return np.sqrt(S.sum(axis=1)**2 + C.sum(axis=1)**2) * inv_D
+
+
+def estimate_remaining_vibrations(shaper, test_damping_ratio, freq_bins, psd):
+    vals = estimate_shaper(shaper, test_damping_ratio, freq_bins)
+    vibr_threshold = psd.max() / SHAPER_VIBRATION_REDUCTION
+    remaining_vibrations = np.maximum(vals * psd - vibr_threshold, 0).sum()
+    all_vibrations = np.maximum(psd - vibr_threshold, 0).sum()
+    return remaining_vibrations / all_vibrations
+
+
+def get_shaper_smoothing(shaper, accel=5000, scv=5.):
+    half_accel = accel * .5
+    A, T = shaper
+    inv_D = 1. / sum(A)
+    n = len(T)
+    ts = sum([A[i] * T[i] for i in range(n)]) * inv_D
+    offset_90 = offset_180 = 0.
+    for i in range(n):
+        if T[i] >= ts:
+            offset_90 += A[i] * (scv + half_accel * (T[i] - ts)) * (T[i] - ts)
+        offset_180 += A[i] * half_accel * (T[i] - ts)**2
+    offset_90 *= inv_D * math.sqrt(2.)
+    offset_180 *= inv_D
+    return max(offset_90, offset_180)
+
+
+def bisect(func):
+    left = right = 1.
+    if not func(1e-9):
+        return 0.
+    while not func(left):
+        right = left
+        left *= .5
+    if right == left:
+        while func(right):
+            right *= 2.
+    while right - left > 1e-8:
+        middle = (left + right) * .5
+        if func(middle):
+            left = middle
+        else:
+            right = middle
+    return left
+
+
+def find_shaper_max_accel(shaper):
+    return bisect(lambda a: get_shaper_smoothing(shaper, a) <= TARGET_SMOOTHING)
+
+
+def fit_shaper(name, init_func, min_freq, freq_bins, psd_sum, max_smoothing):
+    test_freqs = np.arange(min_freq, MAX_SHAPER_FREQ, .2)
+    psd = psd_sum[freq_bins <= MAX_FREQ]
+    freq_bins = freq_bins[freq_bins <= MAX_FREQ]
+    best_res = None
+    results = []
+    for test_freq in test_freqs[::-1]:
+        shaper_vibrations = 0.
+        shaper = init_func(test_freq, DEFAULT_DAMPING_RATIO)
+        shaper_smoothing = get_shaper_smoothing(shaper)
+        if max_smoothing and shaper_smoothing > max_smoothing and best_res:
+            return best_res
+        for dr in TEST_DAMPING_RATIOS:
+            vibrations = estimate_remaining_vibrations(shaper, dr, freq_bins, psd)
+            if vibrations > shaper_vibrations:
+                shaper_vibrations = vibrations
+        max_accel = find_shaper_max_accel(shaper)
+        score = shaper_smoothing * (shaper_vibrations**1.5 + shaper_vibrations * .2 + .01)
+        results.append(dict(type=name, freq=float(test_freq), vibrs=float(shaper_vibrations),
+                            smoothing=float(shaper_smoothing), score=float(score),
+                            max_accel=float(max_accel)))
+        if best_res is None or best_res['vibrs'] > results[-1]['vibrs']:
+            best_res = results[-1]
+    selected = best_res
+    for res in results[::-1]:
+        if res['vibrs'] < best_res['vibrs'] * 1.1 and res['score'] < selected['score']:
+            selected = res
+    return selected
+
+
+def find_best_shaper(freq_bins, psd_sum, max_smoothing):
+    best = None
+    all_shapers = []
+    for name, init_func, min_freq in SHAPERS:
+        shaper = fit_shaper(name, init_func, min_freq, freq_bins, psd_sum, max_smoothing)
+        all_shapers.append(shaper)
+        if (best is None or shaper['score'] * 1.2 < best['score'] or
+                (shaper['score'] * 1.05 < best['score'] and
+                 shaper['smoothing'] * 1.1 < best['smoothing'])):
+            best = shaper
+    return best, all_shapers
+
+# ----------------------------------------------------------------------------
+# Synthetic capture
+# ----------------------------------------------------------------------------
+
+
+def resonator(excitation, fs, freq, damping_ratio):
+    """Acceleration of a damped mass-spring driven by `excitation` (semi-implicit Euler)"""
+    omega = 2. * math.pi * freq
+    dt = 1. / fs
+    pos = vel = 0.
+    out = np.empty_like(excitation)
+    for i, f in enumerate(excitation):
+        acc = f - 2. * damping_ratio * omega * vel - omega * omega * pos
+        vel += acc * dt
+        pos += vel * dt
+        out[i] = acc
+    return out
+
+
+def make_capture(seed, fs=3200., duration=2.0):
+    rng = np.random.default_rng(seed)
+    n = int(fs * duration)
+    t = 1234.5 + np.arange(n) / fs
+    drive = rng.normal(0., 2000., n)
+    x = resonator(drive, fs, 42., 0.08) + 0.35 * resonator(drive, fs, 95., 0.05)
+    y = 0.15 * x + rng.normal(0., 40., n)
+    z = 9810. + 0.05 * x + rng.normal(0., 40., n)
+    return np.column_stack([t, x, y, z])
+
+
+def write_csv(path, data):
+    with open(path, 'w') as f:
+        f.write('#time,accel_x,accel_y,accel_z\n')
+        for t, x, y, z in data:
+            f.write('%.6f,%.3f,%.3f,%.3f\n' % (t, x, y, z))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--output-dir', default='assets/test_resonances')
+    args = parser.parse_args()
+
+    out_dir = Path(args.output_dir)
+    out_dir.mkdir(parents=True, exist_ok=True)
+    csv_path = out_dir / 'raw_data_x_helix.csv'
+    write_csv(csv_path, make_capture(seed=20260314))
+
+    # Analyze the rounded values exactly as the engine will read them
+    data = np.loadtxt(csv_path, comments='#', delimiter=',')
+    fs, M, freqs, psd_sum, psd_x, _, _ = calc_freq_response(data)
+    for psd in (psd_sum, psd_x):
+        psd /= freqs + .1
+        psd[freqs < MIN_FREQ] = 0.
+
+    best, all_shapers = find_best_shaper(freqs, psd_sum, None)
+    limited, _ = find_best_shaper(freqs, psd_sum, 0.1)
+    keep = freqs <= MAX_FREQ
+    reference = {
+        'sample_rate': fs,
+        'window_size': M,
+        'freqs': freqs[keep].tolist(),
+        'psd_sum': psd_sum[keep].tolist(),
+        'psd_x': psd_x[keep].tolist(),
+        'shapers': all_shapers,
+        'recommended': best['type'],
+        'recommended_max_smoothing_0_1': limited['type'],
+    }
+    with open(out_dir / 'raw_data_x_helix.reference.json', 'w') as f:
+        json.dump(reference, f, indent=1)
+        f.write('\n')
+
+    print('%s: %d samples, %.1f Hz, window %d' % (csv_path, data.shape[0], fs, M))
+    for s in all_shapers:
+        print("  %-8s %.1f Hz vibr %.1f%% smoothing %.3f max_accel %.0f" %
+              (s['type'], s['freq'], s['vibrs'] * 100., s['smoothing'], s['max_accel']))
+    print('  recommended %s (max_smoothing=0.1: %s)' % (best['type'], limited['type']))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""
+Build one mmap-able translation catalog per language.
+
+translations.xml carries every language at once, and loading it at startup
+keeps all nine of them in RAM. This script splits it into one small binary
+catalog per language so the app only maps the active one (see
+include/translation_catalog.h). English needs no data at runtime: tags are the
+English text, so any string a catalog does not translate falls back to its tag.
+
+Every catalog holds the same key set. Keys missing from a language map to the
+key itself (the same English fallback LVGL applies), so hot-swapping languages
+never changes which strings are known.
+
+Catalogs carry no lookup index: the app copies the translated entries into
+an LVGL static pack and LVGL does the lookups.
+
+Layout (all integers little-endian; uint32 unless noted):
+
+    header         magic "HXTRNCAT", version, entry_count, locale_offset,
+                   strtab_offset, strtab_size, reserved
+    entries        entry_count x (key_offset, key_len, value_offset, value_len),
+                   sorted by key bytes
+    strtab         NUL-terminated strings (the locale name, keys, values);
+                   values equal to their key share the key's bytes
+
+Usage:
+    python3 scripts/gen_translation_catalogs.py \\
+        [--input ui_xml/translations/translations.xml] [--output build/assets/translations]
+"""
+
+import argparse
+import struct
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).parent.parent
+
+MAGIC = b"HXTRNCAT"
+VERSION = 2
+HEADER_FMT = "<8s6I"
+ENTRY_FMT = "<4I"
+
+
+def build_catalog(locale: str, translations: dict[str, str]) -> bytes:
+    """Serialize {key: value} for one locale into the catalog format."""
+    keys = sorted(translations, key=lambda k: k.encode())
+
+    strtab = bytearray()
+    locale_offset = len(strtab)
+    strtab += locale.encode() + b"\0"
+
+    entries = []
+    for key in keys:
+        raw_key = key.encode()
+        key_offset = len(strtab)
+        strtab += raw_key + b"\0"
+        value = translations[key].encode()
+        if value == raw_key:
+            value_offset = key_offset
+        else:
+            value_offset = len(strtab)
+            strtab += value + b"\0"
+        entries.append((key_offset, len(raw_key), value_offset, len(value)))
+
+    header_size = struct.calcsize(HEADER_FMT)
+    strtab_offset = header_size + struct.calcsize(ENTRY_FMT) * len(entries)
+
+    out = bytearray(
+        struct.pack(
+            HEADER_FMT,
+            MAGIC,
+            VERSION,
+            len(keys),
+            locale_offset,
+            strtab_offset,
+            len(strtab),
+            0,
+        )
+    )
+    for entry in entries:
+        out += struct.pack(ENTRY_FMT, *entry)
+    out += strtab
+    return bytes(out)
+
+
+def load_translations_xml(path: Path) -> dict[str, dict[str, str]]:
+    """Read translations.xml into {locale: {key: value}} with English fallback."""
+    root = ET.parse(path).getroot()
+    languages = root.get("languages", "").split()
+
+    result: dict[str, dict[str, str]] = {lang: {} for lang in languages}
+    for element in root.iter("translation"):
+        tag = element.get("tag")
+        if tag is None:
+            continue
+        for lang in languages:
+            result[lang][tag] = element.get(lang) or tag
+    return result
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument(
+        "--input",
+        type=Path,
+        default=PROJECT_ROOT / "ui_xml" / "translations" / "translations.xml",
+    )
+    parser.add_argument(
+        "--output", type=Path, default=PROJECT_ROOT / "build" / "assets" / "translations"
+    )
+    args = parser.parse_args()
+
+    translations = load_translations_xml(args.input)
+    if not translations:
+        print(f"error: no languages declared in {args.input}", file=sys.stderr)
+        return 1
+
+    args.output.mkdir(parents=True, exist_ok=True)
+    total = 0
+    for locale, strings in sorted(translations.items()):
+        catalog = build_catalog(locale, strings)
+        (args.output / f"{locale}.bin").write_bytes(catalog)
+        total += len(catalog)
+
+    print(
+        f"Built {len(translations)} translation catalogs "
+        f"({total / 1024:.0f} KB total) in {args.output}"
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""
+Pack every ui_xml/*.xml component into a single binary bundle.
+
+At startup HelixScreen registers ~130 XML components one file at a time, which
+means ~1.3 MB of small reads from SD before the splash disappears. This script
+pre-processes all components into one file that the app mmaps and registers
+from directly (see include/xml_component_bundle.h).
+
+Each component is minified (comments and inter-tag whitespace removed) and
+stored NUL-terminated so it can be handed to LVGL without copying. Component
+names live in a shared, sorted string table for O(log n) lookup.
+
+Layout (all integers little-endian uint32):
+
+    header   magic "HXMLBNDL", version, entry_count,
+             strtab_offset, strtab_size, data_offset, data_size
+    entries  entry_count x (name_offset, name_len, data_offset, data_len)
+    strtab   NUL-terminated component names (sorted)
+    data     NUL-terminated minified XML
+
+Usage:
+    python3 scripts/gen_xml_bundle.py [--input ui_xml] [--output build/assets/ui_xml.bundle]
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).parent.parent
+
+MAGIC = b"HXMLBNDL"
+VERSION = 1
+HEADER_FMT = "<8s6I"
+ENTRY_FMT = "<4I"
+
+COMMENT_RE = re.compile(rb"<!--.*?-->", re.DOTALL)
+INTER_TAG_WS_RE = re.compile(rb">\s+<")
+
+
+def minify_xml(data: bytes) -> bytes:
+    """Strip comments and whitespace between tags.
+
+    Text content and attribute values are left untouched, so the result parses
+    identically in LVGL's XML loader.
+    """
+    data = COMMENT_RE.sub(b"", data)
+    data = INTER_TAG_WS_RE.sub(b"><", data)
+    return data.strip()
+
+
+def build_bundle(components: list[tuple[str, bytes]]) -> bytes:
+    """Serialize (name, xml) pairs into the bundle format."""
+    components = sorted(components, key=lambda c: c[0].encode())
+
+    strtab = bytearray()
+    data = bytearray()
+    entries = []
+    for name, xml in components:
+        name_bytes = name.encode()
+        entries.append((len(strtab), len(name_bytes), len(data), len(xml)))
+        strtab += name_bytes + b"\0"
+        data += xml + b"\0"
+
+    header_size = struct.calcsize(HEADER_FMT)
+    entries_size = struct.calcsize(ENTRY_FMT) * len(entries)
+    strtab_offset = header_size + entries_size
+    data_offset = strtab_offset + len(strtab)
+
+    out = bytearray(
+        struct.pack(
+            HEADER_FMT,
+            MAGIC,
+            VERSION,
+            len(entries),
+            strtab_offset,
+            len(strtab),
+            data_offset,
+            len(data),
+        )
+    )
+    for entry in entries:
+        out += struct.pack(ENTRY_FMT, *entry)
+    out += strtab
+    out += data
+    return bytes(out)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--input", type=Path, default=PROJECT_ROOT / "ui_xml")
+    parser.add_argument(
+        "--output", type=Path, default=PROJECT_ROOT / "build" / "assets" / "ui_xml.bundle"
+    )
+    args = parser.parse_args()
+
+    components = []
+    raw_total = 0
+    for path in sorted(args.input.glob("*.xml")):
+        raw = path.read_bytes()
+        raw_total += len(raw)
+        components.append((path.stem, minify_xml(raw)))
+
+    if not components:
+        print(f"error: no XML components found in {args.input}", file=sys.stderr)
+        return 1
+
+    bundle = build_bundle(components)
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_bytes(bundle)
+
+    print(
+        f"Bundled {len(components)} components: {raw_total / 1024:.0f} KB XML -> "
+        f"{len(bundle) / 1024:.0f} KB ({args.output})"
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -5,7 +5,10 @@ Translation generator script for HelixScreen.
 
 This script reads YAML translation files and generates:
 1. LVGL XML files for the declarative UI system
-2. lv_i18n C code for runtime translation lookups
+2. Optionally, lv_i18n C code (--c-dir)
+
+Per-language runtime catalogs are built from the XML by
+scripts/gen_translation_catalogs.py.
 
 Usage:
     python generate_translations.py [--yaml-dir DIR] [--xml-dir DIR] [--c-dir DIR]
@@ -15,7 +18,7 @@ import argparse
 import xml.etree.ElementTree as ET
 from dataclasses import dataclass, field
 from pathlib import Path
-from typing import Any
+from typing import Any, Optional
 
 import yaml
 
@@ -667,7 +670,7 @@ class GenerateResult:
 def generate_all(
     yaml_dir: Path,
     xml_output_dir: Path,
-    c_output_dir: Path,
+    c_output_dir: Optional[Path] = None,
     base_locale: str = "en",
 ) -> GenerateResult:
     """
@@ -676,7 +679,8 @@ def generate_all(
     Args:
         yaml_dir: Directory containing YAML translation files
         xml_output_dir: Directory to write XML output
-        c_output_dir: Directory to write C output
+        c_output_dir: Directory to write lv_i18n C output (skipped if None; the
+            app loads per-language catalogs built from the XML instead)
         base_locale: Base locale for comparison (default: "en")
 
     Returns:
@@ -720,8 +724,9 @@ def generate_all(
     # Generate XML
     write_xml_file(singulars, xml_output_dir / "translations.xml")
 
-    # Generate C code
-    write_lv_i18n_files(singulars, plurals, c_output_dir)
+    # Generate C code (opt-in)
+    if c_output_dir is not None:
+        write_lv_i18n_files(singulars, plurals, c_output_dir)
 
     return result
 
@@ -751,8 +756,8 @@ def main():
     parser.add_argument(
         "--c-dir",
         type=Path,
-        default=Path("src/generated"),
-        help="Output directory for C files",
+        default=None,
+        help="Also write lv_i18n C tables to this directory (not used by the app)",
     )
     parser.add_argument(
         "--base-locale",
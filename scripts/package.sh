@@ -124,10 +124,12 @@ package_platform() {
 
     # Copy assets, excluding development-only files
     # - test_gcodes/: Sample files for mock mode and testing (155MB)
+    # - test_resonances/: Accelerometer capture and reference fit for unit tests
     # - *.gcode: Root-level G-code files for dev testing
     # - .DS_Store: macOS metadata
     mkdir -p "$pkg_dir/assets"
     rsync -a --exclude='test_gcodes' \
+             --exclude='test_resonances' \
              --exclude='*.gcode' \
              --exclude='.DS_Store' \
              "${PROJECT_DIR}/assets/" "$pkg_dir/assets/"
@@ -154,6 +156,21 @@ package_platform() {
         fi
     fi
 
+    # Copy pre-built XML component bundle (platform-independent, lives in build/assets/)
+    # Generated by 'make gen-xml-bundle'; the app falls back to ui_xml/ without it
+    if [ -f "${PROJECT_DIR}/build/assets/ui_xml.bundle" ]; then
+        cp "${PROJECT_DIR}/build/assets/ui_xml.bundle" "$pkg_dir/assets/"
+        log_info "  Included XML component bundle"
+    fi
+
+    # Copy per-language translation catalogs (generated by 'make gen-translation-catalogs');
+    # the app falls back to ui_xml/translations/translations.xml without them
+    if ls "${PROJECT_DIR}/build/assets/translations/"*.bin >/dev/null 2>&1; then
+        mkdir -p "$pkg_dir/assets/translations"
+        cp "${PROJECT_DIR}/build/assets/translations/"*.bin "$pkg_dir/assets/translations/"
+        log_info "  Included translation catalogs"
+    fi
+
     # Copy launcher script to bin/ (lives in scripts/ in repo)
     cp "${PROJECT_DIR}/scripts/helix-launcher.sh" "$pkg_dir/bin/"
     chmod +x "$pkg_dir/bin/helix-launcher.sh"
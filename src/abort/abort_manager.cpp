@@ -7,6 +7,7 @@
 
 #include "moonraker_api.h"
 #include "printer_state.h"
+#include "xml_registration.h"
 
 #include <spdlog/spdlog.h>
 
@@ -39,7 +40,7 @@ void AbortManager::init_subjects() {
     }
 
     // Register XML component for the modal
-    lv_xml_register_component_from_file("A:ui_xml/abort_progress_modal.xml");
+    register_xml_component("A:ui_xml/abort_progress_modal.xml");
 
     // Initialize state subject (default IDLE)
     UI_MANAGED_SUBJECT_INT(abort_state_subject_, static_cast<int>(State::IDLE), "abort_state",
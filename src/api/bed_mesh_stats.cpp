@@ -0,0 +1,64 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bed_mesh_stats.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace helix {
+
+BedMeshStats compute_bed_mesh_stats(const std::vector<std::vector<float>>& matrix,
+                                    const float mesh_min[2], const float mesh_max[2]) {
+    BedMeshStats stats;
+
+    size_t cols = 0;
+    for (const auto& row : matrix) {
+        cols = std::max(cols, row.size());
+    }
+    if (cols == 0) {
+        return stats;
+    }
+
+    // Welford's update keeps the variance stable for tightly clustered heights
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    for (size_t row = 0; row < matrix.size(); row++) {
+        for (size_t col = 0; col < matrix[row].size(); col++) {
+            float z = matrix[row][col];
+            if (count == 0 || z < stats.min_z) {
+                stats.min_z = z;
+                stats.min_row = static_cast<int>(row);
+                stats.min_col = static_cast<int>(col);
+            }
+            if (count == 0 || z > stats.max_z) {
+                stats.max_z = z;
+                stats.max_row = static_cast<int>(row);
+                stats.max_col = static_cast<int>(col);
+            }
+            count++;
+            double delta = z - mean;
+            mean += delta / static_cast<double>(count);
+            m2 += delta * (z - mean);
+        }
+    }
+
+    stats.valid = true;
+    stats.range = stats.max_z - stats.min_z;
+    stats.mean = static_cast<float>(mean);
+    stats.variance = static_cast<float>(m2 / static_cast<double>(count));
+
+    size_t rows = matrix.size();
+    float x_step = (cols > 1) ? (mesh_max[0] - mesh_min[0]) / static_cast<float>(cols - 1) : 0.0f;
+    float y_step = (rows > 1) ? (mesh_max[1] - mesh_min[1]) / static_cast<float>(rows - 1) : 0.0f;
+    stats.min_x = mesh_min[0] + static_cast<float>(stats.min_col) * x_step;
+    stats.min_y = mesh_min[1] + static_cast<float>(stats.min_row) * y_step;
+    stats.max_x = mesh_min[0] + static_cast<float>(stats.max_col) * x_step;
+    stats.max_y = mesh_min[1] + static_cast<float>(stats.max_row) * y_step;
+
+    return stats;
+}
+
+} // namespace helix
@@ -0,0 +1,398 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_response_dispatcher.cpp
+ * @brief Single-pass console line classifier, from_chars value parsers and routing
+ */
+
+#include "gcode_response_dispatcher.h"
+
+#include "moonraker_client.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace helix {
+
+namespace {
+
+constexpr const char* HANDLER_NAME = "gcode_response_dispatcher";
+
+bool starts_at(std::string_view text, size_t pos, std::string_view word) {
+    return pos <= text.size() && text.size() - pos >= word.size() &&
+           text.compare(pos, word.size(), word) == 0;
+}
+
+bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool is_word_char(char c) {
+    return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+void skip_spaces(std::string_view& text) {
+    size_t n = 0;
+    while (n < text.size() && is_space(text[n])) {
+        ++n;
+    }
+    text.remove_prefix(n);
+}
+
+bool skip_literal(std::string_view& text, std::string_view literal) {
+    if (text.substr(0, literal.size()) != literal) {
+        return false;
+    }
+    text.remove_prefix(literal.size());
+    return true;
+}
+
+/// `\w+`
+bool take_word(std::string_view& text, std::string_view& word) {
+    size_t n = 0;
+    while (n < text.size() && is_word_char(text[n])) {
+        ++n;
+    }
+    if (n == 0) {
+        return false;
+    }
+    word = text.substr(0, n);
+    text.remove_prefix(n);
+    return true;
+}
+
+/// `\d+`
+bool take_int(std::string_view& text, int& out) {
+    if (text.empty() || !is_digit(text.front())) {
+        return false; // from_chars would accept a sign
+    }
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    if (ec != std::errc() || ptr == text.data()) {
+        return false;
+    }
+    text.remove_prefix(static_cast<size_t>(ptr - text.data()));
+    return true;
+}
+
+/**
+ * @brief Try `parse` at every occurrence of `anchor`, like regex_search
+ *
+ * `parse` receives the text following the anchor.
+ */
+template <typename Parse> bool search(std::string_view line, std::string_view anchor, Parse parse) {
+    for (size_t pos = line.find(anchor); pos != std::string_view::npos;
+         pos = line.find(anchor, pos + 1)) {
+        if (parse(line.substr(pos + anchor.size()))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// Classification
+// ============================================================================
+
+uint32_t classify_gcode_line(std::string_view line) {
+    using namespace gcode_line;
+
+    if (line == "ok") {
+        return ACK;
+    }
+
+    uint32_t kinds = 0;
+    if (starts_at(line, 0, "//")) {
+        kinds |= COMMENT;
+    }
+    if (starts_at(line, 0, "!! ") || starts_at(line, 0, "Error:")) {
+        kinds |= KLIPPER_ERROR;
+    }
+
+    // One pass; only the first letter of each keyword triggers a comparison
+    const size_t size = line.size();
+    for (size_t i = 0; i < size; ++i) {
+        switch (line[i]) {
+        case 'E':
+        case 'e':
+            if (starts_at(line, i + 1, "rror")) {
+                kinds |= MENTIONS_ERROR;
+                if (line[i] == 'e' && starts_at(line, i + 5, ":")) {
+                    kinds |= KLIPPER_ERROR;
+                }
+            }
+            break;
+        case 'U':
+            if (starts_at(line, i, "Unknown command")) {
+                kinds |= UNKNOWN_COMMAND;
+            }
+            break;
+        case 'F':
+            if (starts_at(line, i, "Fitted shaper")) {
+                kinds |= FITTED_SHAPER;
+            }
+            break;
+        case 'R':
+            if (starts_at(line, i, "Recommended shaper")) {
+                kinds |= RECOMMENDED_SHAPER;
+            }
+            break;
+        case 'a':
+            if (starts_at(line, i, "axes_noise")) {
+                kinds |= AXES_NOISE;
+            }
+            break;
+        case 'W':
+            if (starts_at(line, i, "Writing raw accelerometer data to ")) {
+                kinds |= RAW_DATA_FILE;
+            }
+            break;
+        case 'P':
+            if (starts_at(line, i, "Probing point ") || starts_at(line, i, "Probe point ")) {
+                kinds |= PROBE_PROGRESS;
+            }
+            break;
+        case 'M':
+            if (starts_at(line, i, "Mesh Bed Leveling Complete") ||
+                starts_at(line, i, "Mesh bed leveling complete")) {
+                kinds |= MESH_COMPLETE;
+            }
+            break;
+        case 'H':
+            if (starts_at(line, i, "HELIX:PHASE:")) {
+                kinds |= HELIX_PHASE;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return kinds;
+}
+
+// ============================================================================
+// Value parsers
+// ============================================================================
+
+bool parse_decimal(std::string_view& text, float& out) {
+    size_t end = 0;
+    while (end < text.size() && (is_digit(text[end]) || text[end] == '.')) {
+        ++end;
+    }
+
+    // Integer part, then fraction up to the next dot (std::stof stops there too).
+    // Float from_chars is not available on the GCC 10 cross toolchains.
+    std::string_view run = text.substr(0, end);
+    size_t dot = run.find('.');
+    std::string_view int_part = run.substr(0, dot);
+    std::string_view frac_part;
+    if (dot != std::string_view::npos) {
+        frac_part = run.substr(dot + 1);
+        frac_part = frac_part.substr(0, frac_part.find('.'));
+    }
+    if (int_part.empty() && frac_part.empty()) {
+        return false;
+    }
+
+    uint64_t whole = 0;
+    if (!int_part.empty()) {
+        auto [ptr, ec] = std::from_chars(int_part.data(), int_part.data() + int_part.size(), whole);
+        if (ec != std::errc()) {
+            return false;
+        }
+    }
+
+    double value = static_cast<double>(whole);
+    if (!frac_part.empty()) {
+        // 18 digits is beyond float precision and keeps the mantissa in range
+        frac_part = frac_part.substr(0, 18);
+        uint64_t frac = 0;
+        std::from_chars(frac_part.data(), frac_part.data() + frac_part.size(), frac);
+        double scale = 1.0;
+        for (size_t i = 0; i < frac_part.size(); ++i) {
+            scale *= 10.0;
+        }
+        value += static_cast<double>(frac) / scale;
+    }
+
+    out = static_cast<float>(value);
+    text.remove_prefix(end);
+    return true;
+}
+
+bool parse_fitted_shaper(std::string_view line, FittedShaperLine& out) {
+    return search(line, "Fitted shaper '", [&out](std::string_view rest) {
+        std::string_view type;
+        float frequency = 0.0f;
+        float vibrations = 0.0f;
+        float smoothing = 0.0f;
+        if (!take_word(rest, type) || !skip_literal(rest, "' frequency = ") ||
+            !parse_decimal(rest, frequency) || !skip_literal(rest, " Hz (vibrations = ") ||
+            !parse_decimal(rest, vibrations) || !skip_literal(rest, "%, smoothing ~= ") ||
+            !parse_decimal(rest, smoothing) || !skip_literal(rest, ")")) {
+            return false;
+        }
+        out.type = std::string(type);
+        out.frequency = frequency;
+        out.vibrations = vibrations;
+        out.smoothing = smoothing;
+        return true;
+    });
+}
+
+bool parse_recommended_shaper(std::string_view line, std::string& type, float& frequency) {
+    return search(line, "Recommended shaper is ", [&](std::string_view rest) {
+        std::string_view word;
+        float freq = 0.0f;
+        if (!take_word(rest, word) || !skip_literal(rest, " @ ") || !parse_decimal(rest, freq) ||
+            !skip_literal(rest, " Hz")) {
+            return false;
+        }
+        type = std::string(word);
+        frequency = freq;
+        return true;
+    });
+}
+
+bool parse_axes_noise(std::string_view line, float& noise) {
+    return search(line, "axes_noise", [&noise](std::string_view rest) {
+        skip_spaces(rest);
+        if (!skip_literal(rest, "=")) {
+            return false;
+        }
+        skip_spaces(rest);
+        return parse_decimal(rest, noise);
+    });
+}
+
+bool parse_probe_progress(std::string_view line, int& current, int& total) {
+    // Prob(?:ing point|e point) (\d+)[/\s]+(?:of\s+)?(\d+)
+    auto parse = [&](std::string_view rest) {
+        int cur = 0;
+        if (!take_int(rest, cur)) {
+            return false;
+        }
+        size_t n = 0;
+        while (n < rest.size() && (rest[n] == '/' || is_space(rest[n]))) {
+            ++n;
+        }
+        if (n == 0) {
+            return false;
+        }
+        rest.remove_prefix(n);
+        if (skip_literal(rest, "of")) {
+            std::string_view after_of = rest;
+            skip_spaces(after_of);
+            if (after_of.size() == rest.size()) {
+                return false; // "of" must be followed by whitespace
+            }
+            rest = after_of;
+        }
+        int tot = 0;
+        if (!take_int(rest, tot)) {
+            return false;
+        }
+        current = cur;
+        total = tot;
+        return true;
+    };
+    return search(line, "Probing point ", parse) || search(line, "Probe point ", parse);
+}
+
+bool parse_raw_data_path(std::string_view line, std::string& path) {
+    return search(line, "Writing raw accelerometer data to ", [&path](std::string_view rest) {
+        size_t n = 0;
+        while (n < rest.size() && !is_space(rest[n])) {
+            ++n;
+        }
+        if (n == 0 || !starts_at(rest, n, " file")) {
+            return false;
+        }
+        path = std::string(rest.substr(0, n));
+        return true;
+    });
+}
+
+// ============================================================================
+// GCodeResponseDispatcher
+// ============================================================================
+
+GCodeResponseDispatcher::GCodeResponseDispatcher(MoonrakerClient* client) : client_(client) {}
+
+GCodeResponseDispatcher::SubscriptionId GCodeResponseDispatcher::subscribe(uint32_t kinds,
+                                                                           Handler handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubscriptionId id = next_id_++;
+    subscriptions_.push_back(std::make_shared<const Subscription>(
+        Subscription{id, kinds, std::move(handler)}));
+    interest_ |= kinds;
+
+    // The client never holds its callback lock while invoking callbacks, so
+    // registering under our lock cannot deadlock with dispatch()
+    if (client_ && subscriptions_.size() == 1) {
+        client_->register_method_callback(
+            "notify_gcode_response", HANDLER_NAME, [this](const json& msg) {
+                if (!msg.contains("params") || !msg["params"].is_array() ||
+                    msg["params"].empty() || !msg["params"][0].is_string()) {
+                    return;
+                }
+                dispatch(msg["params"][0].get_ref<const std::string&>());
+            });
+    }
+    return id;
+}
+
+bool GCodeResponseDispatcher::unsubscribe(SubscriptionId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(subscriptions_.begin(), subscriptions_.end(),
+                           [id](const auto& sub) { return sub->id == id; });
+    if (it == subscriptions_.end()) {
+        return false;
+    }
+    subscriptions_.erase(it);
+
+    interest_ = 0;
+    for (const auto& sub : subscriptions_) {
+        interest_ |= sub->kinds;
+    }
+    if (client_ && subscriptions_.empty()) {
+        client_->unregister_method_callback("notify_gcode_response", HANDLER_NAME);
+    }
+    return true;
+}
+
+void GCodeResponseDispatcher::dispatch(std::string_view text) {
+    const GCodeResponseLine line{text, classify_gcode_line(text)};
+
+    // Copy only the matching subscriptions so handlers run without the lock
+    // (they commonly unsubscribe themselves when a sequence completes)
+    std::vector<std::shared_ptr<const Subscription>> matched;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (interest_ != gcode_line::ANY && (interest_ & line.kinds) == 0) {
+            return;
+        }
+        for (const auto& sub : subscriptions_) {
+            if (sub->kinds == gcode_line::ANY || (sub->kinds & line.kinds) != 0) {
+                matched.push_back(sub);
+            }
+        }
+    }
+
+    for (const auto& sub : matched) {
+        sub->handler(line);
+    }
+}
+
+size_t GCodeResponseDispatcher::subscriber_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return subscriptions_.size();
+}
+
+} // namespace helix
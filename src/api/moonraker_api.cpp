@@ -4,6 +4,7 @@
 #include "moonraker_api.h"
 
 #include "moonraker_api_internal.h"
+#include "scoped_trace.h"
 #include "spdlog/spdlog.h"
 
 #include <chrono>
@@ -144,6 +145,8 @@ void MoonrakerAPI::launch_http_thread(std::function<void()> func) {
 
     // Launch the new thread
     http_threads_.emplace_back([func = std::move(func)]() {
+        helix::trace::set_thread_name("http");
+        HELIX_TRACE_SCOPE("http", "http_request");
         func();
         // Thread auto-removed during next launch or destructor
     });
@@ -8,21 +8,123 @@
 #include "moonraker_api_internal.h"
 #include "spdlog/spdlog.h"
 
+#include <cstdint>
 #include <iomanip>
 #include <memory>
-#include <regex>
+#include <mutex>
 #include <set>
 #include <sstream>
 
 using namespace moonraker_internal;
+namespace gcode_line = helix::gcode_line;
 
 // ============================================================================
 // Domain Service Operations - Bed Mesh
 // ============================================================================
 
+namespace {
+
+/**
+ * Structural FNV-1a hash of a JSON value, used as the bed mesh parse-cache key.
+ *
+ * Walks the parsed tree instead of dump()ing it, and folds every number to a
+ * double so 0 and 0.0 hash alike. Objects iterate in key order, so the hash is
+ * independent of the order Moonraker serialized them in.
+ */
+void hash_json(uint64_t& h, const json& value) {
+    auto mix = [&h](const void* data, size_t len) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < len; i++) {
+            h ^= bytes[i];
+            h *= 0x100000001B3ull;
+        }
+    };
+
+    auto type = static_cast<uint8_t>(value.type());
+    if (value.is_number()) {
+        type = static_cast<uint8_t>(json::value_t::number_float);
+    }
+    mix(&type, sizeof(type));
+
+    if (value.is_number()) {
+        double d = value.get<double>();
+        mix(&d, sizeof(d));
+    } else if (value.is_string()) {
+        const auto& str = value.get_ref<const std::string&>();
+        uint64_t len = str.size();
+        mix(&len, sizeof(len));
+        mix(str.data(), str.size());
+    } else if (value.is_boolean()) {
+        uint8_t b = value.get<bool>() ? 1 : 0;
+        mix(&b, sizeof(b));
+    } else if (value.is_array()) {
+        uint64_t len = value.size();
+        mix(&len, sizeof(len));
+        for (const auto& item : value) {
+            hash_json(h, item);
+        }
+    } else if (value.is_object()) {
+        uint64_t len = value.size();
+        mix(&len, sizeof(len));
+        for (auto it = value.begin(); it != value.end(); ++it) {
+            uint64_t key_len = it.key().size();
+            mix(&key_len, sizeof(key_len));
+            mix(it.key().data(), it.key().size());
+            hash_json(h, it.value());
+        }
+    }
+}
+
+uint64_t bed_mesh_content_hash(const json& value) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    hash_json(h, value);
+    return h == 0 ? 1 : h; // 0 is reserved for "not from Moonraker"
+}
+
+/// Parse a JSON matrix of Z heights, dropping non-numeric values and empty rows
+std::vector<std::vector<float>> parse_z_matrix(const json& matrix) {
+    std::vector<std::vector<float>> result;
+    result.reserve(matrix.size());
+    for (const auto& row : matrix) {
+        if (row.is_array()) {
+            std::vector<float> row_vec;
+            row_vec.reserve(row.size());
+            for (const auto& val : row) {
+                if (val.is_number()) {
+                    row_vec.push_back(val.template get<float>());
+                }
+            }
+            if (!row_vec.empty()) {
+                result.push_back(std::move(row_vec));
+            }
+        }
+    }
+    return result;
+}
+
+/// Read a numeric [x, y] pair; false if missing or not numbers (Klipper sends nulls)
+bool parse_xy(const json& bed_mesh, const char* key, float out[2]) {
+    auto it = bed_mesh.find(key);
+    if (it == bed_mesh.end() || !it->is_array() || it->size() < 2 || !(*it)[0].is_number() ||
+        !(*it)[1].is_number()) {
+        return false;
+    }
+    out[0] = (*it)[0].template get<float>();
+    out[1] = (*it)[1].template get<float>();
+    return true;
+}
+
+} // namespace
+
 void MoonrakerAPI::update_bed_mesh(const json& bed_mesh) {
     std::lock_guard<std::mutex> lock(bed_mesh_mutex_);
 
+    // Moonraker repeats the whole bed_mesh object (every profile included) in
+    // status updates, but it rarely changes. Anything whose content hash
+    // matches what is already parsed is kept as-is: no re-parse, no new stats,
+    // and pointers handed out by get_bed_mesh_profile() stay valid.
+    bool active_changed = false;
+
     // Parse active profile name
     if (bed_mesh.contains("profile_name") && !bed_mesh["profile_name"].is_null()) {
         active_bed_mesh_.name = bed_mesh["profile_name"].template get<std::string>();
@@ -30,96 +132,100 @@ void MoonrakerAPI::update_bed_mesh(const json& bed_mesh) {
 
     // Parse probed_matrix (2D array of Z heights)
     if (bed_mesh.contains("probed_matrix") && bed_mesh["probed_matrix"].is_array()) {
-        active_bed_mesh_.probed_matrix.clear();
-        for (const auto& row : bed_mesh["probed_matrix"]) {
-            if (row.is_array()) {
-                std::vector<float> row_vec;
-                for (const auto& val : row) {
-                    if (val.is_number()) {
-                        row_vec.push_back(val.template get<float>());
-                    }
-                }
-                if (!row_vec.empty()) {
-                    active_bed_mesh_.probed_matrix.push_back(row_vec);
-                }
-            }
+        uint64_t hash = bed_mesh_content_hash(bed_mesh["probed_matrix"]);
+        if (hash != active_bed_mesh_.content_hash) {
+            active_bed_mesh_.probed_matrix = parse_z_matrix(bed_mesh["probed_matrix"]);
+            active_bed_mesh_.content_hash = hash;
+            bed_mesh_parse_count_++;
+            active_changed = true;
+
+            // Update dimensions
+            active_bed_mesh_.y_count = static_cast<int>(active_bed_mesh_.probed_matrix.size());
+            active_bed_mesh_.x_count =
+                active_bed_mesh_.probed_matrix.empty()
+                    ? 0
+                    : static_cast<int>(active_bed_mesh_.probed_matrix[0].size());
         }
-
-        // Update dimensions
-        active_bed_mesh_.y_count = static_cast<int>(active_bed_mesh_.probed_matrix.size());
-        active_bed_mesh_.x_count = active_bed_mesh_.probed_matrix.empty()
-                                       ? 0
-                                       : static_cast<int>(active_bed_mesh_.probed_matrix[0].size());
     }
 
     // Parse mesh bounds (check that elements are numbers, not null)
-    if (bed_mesh.contains("mesh_min") && bed_mesh["mesh_min"].is_array() &&
-        bed_mesh["mesh_min"].size() >= 2 && bed_mesh["mesh_min"][0].is_number() &&
-        bed_mesh["mesh_min"][1].is_number()) {
-        active_bed_mesh_.mesh_min[0] = bed_mesh["mesh_min"][0].template get<float>();
-        active_bed_mesh_.mesh_min[1] = bed_mesh["mesh_min"][1].template get<float>();
+    float bounds[2];
+    if (parse_xy(bed_mesh, "mesh_min", bounds) &&
+        (bounds[0] != active_bed_mesh_.mesh_min[0] || bounds[1] != active_bed_mesh_.mesh_min[1])) {
+        active_bed_mesh_.mesh_min[0] = bounds[0];
+        active_bed_mesh_.mesh_min[1] = bounds[1];
+        active_changed = true;
+    }
+    if (parse_xy(bed_mesh, "mesh_max", bounds) &&
+        (bounds[0] != active_bed_mesh_.mesh_max[0] || bounds[1] != active_bed_mesh_.mesh_max[1])) {
+        active_bed_mesh_.mesh_max[0] = bounds[0];
+        active_bed_mesh_.mesh_max[1] = bounds[1];
+        active_changed = true;
     }
 
-    if (bed_mesh.contains("mesh_max") && bed_mesh["mesh_max"].is_array() &&
-        bed_mesh["mesh_max"].size() >= 2 && bed_mesh["mesh_max"][0].is_number() &&
-        bed_mesh["mesh_max"][1].is_number()) {
-        active_bed_mesh_.mesh_max[0] = bed_mesh["mesh_max"][0].template get<float>();
-        active_bed_mesh_.mesh_max[1] = bed_mesh["mesh_max"][1].template get<float>();
+    if (active_changed) {
+        active_bed_mesh_.stats = helix::compute_bed_mesh_stats(
+            active_bed_mesh_.probed_matrix, active_bed_mesh_.mesh_min, active_bed_mesh_.mesh_max);
     }
 
     // Parse available profiles and their mesh data
     if (bed_mesh.contains("profiles") && bed_mesh["profiles"].is_object()) {
         bed_mesh_profiles_.clear();
-        stored_bed_mesh_profiles_.clear();
+        std::map<std::string, BedMeshProfile> profiles;
 
         for (auto& [profile_name, profile_data] : bed_mesh["profiles"].items()) {
             bed_mesh_profiles_.push_back(profile_name);
 
+            if (!profile_data.is_object()) {
+                continue;
+            }
+
+            // Unchanged profile: move the parsed node over as-is
+            uint64_t hash = bed_mesh_content_hash(profile_data);
+            auto cached = stored_bed_mesh_profiles_.find(profile_name);
+            if (cached != stored_bed_mesh_profiles_.end() &&
+                cached->second.content_hash == hash) {
+                profiles.insert(stored_bed_mesh_profiles_.extract(cached));
+                continue;
+            }
+
             // Parse and store mesh data for this profile (if available)
-            if (profile_data.is_object()) {
-                BedMeshProfile profile;
-                profile.name = profile_name;
-
-                // Parse points array (Moonraker calls it "points", not "probed_matrix")
-                if (profile_data.contains("points") && profile_data["points"].is_array()) {
-                    for (const auto& row : profile_data["points"]) {
-                        if (row.is_array()) {
-                            std::vector<float> row_vec;
-                            for (const auto& val : row) {
-                                if (val.is_number()) {
-                                    row_vec.push_back(val.template get<float>());
-                                }
-                            }
-                            if (!row_vec.empty()) {
-                                profile.probed_matrix.push_back(row_vec);
-                            }
-                        }
-                    }
-                }
+            BedMeshProfile profile;
+            profile.name = profile_name;
+            profile.content_hash = hash;
+            bed_mesh_parse_count_++;
+
+            // Parse points array (Moonraker calls it "points", not "probed_matrix")
+            if (profile_data.contains("points") && profile_data["points"].is_array()) {
+                profile.probed_matrix = parse_z_matrix(profile_data["points"]);
+            }
 
-                // Parse mesh bounds
-                if (profile_data.contains("mesh_params") &&
-                    profile_data["mesh_params"].is_object()) {
-                    const auto& params = profile_data["mesh_params"];
-                    if (params.contains("min_x"))
-                        profile.mesh_min[0] = params["min_x"].template get<float>();
-                    if (params.contains("min_y"))
-                        profile.mesh_min[1] = params["min_y"].template get<float>();
-                    if (params.contains("max_x"))
-                        profile.mesh_max[0] = params["max_x"].template get<float>();
-                    if (params.contains("max_y"))
-                        profile.mesh_max[1] = params["max_y"].template get<float>();
-                    if (params.contains("x_count"))
-                        profile.x_count = params["x_count"].template get<int>();
-                    if (params.contains("y_count"))
-                        profile.y_count = params["y_count"].template get<int>();
-                }
+            // Parse mesh bounds
+            if (profile_data.contains("mesh_params") && profile_data["mesh_params"].is_object()) {
+                const auto& params = profile_data["mesh_params"];
+                if (params.contains("min_x"))
+                    profile.mesh_min[0] = params["min_x"].template get<float>();
+                if (params.contains("min_y"))
+                    profile.mesh_min[1] = params["min_y"].template get<float>();
+                if (params.contains("max_x"))
+                    profile.mesh_max[0] = params["max_x"].template get<float>();
+                if (params.contains("max_y"))
+                    profile.mesh_max[1] = params["max_y"].template get<float>();
+                if (params.contains("x_count"))
+                    profile.x_count = params["x_count"].template get<int>();
+                if (params.contains("y_count"))
+                    profile.y_count = params["y_count"].template get<int>();
+            }
 
-                if (!profile.probed_matrix.empty()) {
-                    stored_bed_mesh_profiles_[profile_name] = std::move(profile);
-                }
+            if (!profile.probed_matrix.empty()) {
+                profile.stats = helix::compute_bed_mesh_stats(profile.probed_matrix,
+                                                              profile.mesh_min, profile.mesh_max);
+                profiles[profile_name] = std::move(profile);
             }
         }
+
+        // Profiles that disappeared (deleted in Klipper) drop out here
+        stored_bed_mesh_profiles_ = std::move(profiles);
     }
 
     // Parse algorithm from mesh_params (if available)
@@ -132,11 +238,14 @@ void MoonrakerAPI::update_bed_mesh(const json& bed_mesh) {
 
     if (active_bed_mesh_.probed_matrix.empty()) {
         spdlog::debug("[MoonrakerAPI] Bed mesh data cleared (no probed_matrix)");
-    } else {
+    } else if (active_changed) {
         spdlog::info("[MoonrakerAPI] Bed mesh updated: profile='{}', size={}x{}, "
-                     "profiles={}, algo='{}'",
+                     "profiles={}, algo='{}', range={:.3f}",
                      active_bed_mesh_.name, active_bed_mesh_.x_count, active_bed_mesh_.y_count,
-                     bed_mesh_profiles_.size(), active_bed_mesh_.algo);
+                     bed_mesh_profiles_.size(), active_bed_mesh_.algo,
+                     active_bed_mesh_.stats.range);
+    } else {
+        spdlog::trace("[MoonrakerAPI] Bed mesh unchanged: profile='{}'", active_bed_mesh_.name);
     }
 }
 
@@ -176,6 +285,11 @@ const BedMeshProfile* MoonrakerAPI::get_bed_mesh_profile(const std::string& prof
     return nullptr;
 }
 
+size_t MoonrakerAPI::bed_mesh_parse_count() const {
+    std::lock_guard<std::mutex> lock(bed_mesh_mutex_);
+    return bed_mesh_parse_count_;
+}
+
 void MoonrakerAPI::get_excluded_objects(
     std::function<void(const std::set<std::string>&)> on_success, ErrorCallback on_error) {
     // Query exclude_object state from Klipper
@@ -297,24 +411,21 @@ class ScrewsTiltCollector : public std::enable_shared_from_this<ScrewsTiltCollec
     }
 
     void start() {
-        // Register for gcode_response notifications
-        // Use atomic counter for unique handler names (safer than pointer address reuse)
-        static std::atomic<uint64_t> s_collector_id{0};
-        handler_name_ = "screws_tilt_collector_" + std::to_string(++s_collector_id);
-
         auto self = shared_from_this();
-        client_.register_method_callback("notify_gcode_response", handler_name_,
-                                         [self](const json& msg) { self->on_gcode_response(msg); });
+        subscription_id_ = client_.gcode_responses().subscribe(
+            gcode_line::ACK | gcode_line::MENTIONS_ERROR | gcode_line::KLIPPER_ERROR |
+                gcode_line::UNKNOWN_COMMAND | gcode_line::COMMENT,
+            [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
 
         registered_.store(true);
-        spdlog::debug("[ScrewsTiltCollector] Started collecting responses (handler: {})",
-                      handler_name_);
+        spdlog::debug("[ScrewsTiltCollector] Started collecting responses (subscription {})",
+                      subscription_id_);
     }
 
     void unregister() {
         bool was_registered = registered_.exchange(false);
         if (was_registered) {
-            client_.unregister_method_callback("notify_gcode_response", handler_name_);
+            client_.gcode_responses().unsubscribe(subscription_id_);
             spdlog::debug("[ScrewsTiltCollector] Unregistered callback");
         }
     }
@@ -328,35 +439,30 @@ class ScrewsTiltCollector : public std::enable_shared_from_this<ScrewsTiltCollec
         completed_.store(true);
     }
 
-    void on_gcode_response(const json& msg) {
+    void on_gcode_response(const helix::GCodeResponseLine& response) {
         // Check if already completed (prevent double-invocation)
         if (completed_.load()) {
             return;
         }
 
-        // notify_gcode_response format: {"method": "notify_gcode_response", "params": ["line"]}
-        if (!msg.contains("params") || !msg["params"].is_array() || msg["params"].empty()) {
-            return;
-        }
-
-        const std::string& line = msg["params"][0].get_ref<const std::string&>();
+        const std::string_view line = response.text;
         spdlog::trace("[ScrewsTiltCollector] Received: {}", line);
 
         // Check for unknown command error (screws_tilt_adjust not configured)
-        if (line.find("Unknown command") != std::string::npos &&
+        if (response.is(gcode_line::UNKNOWN_COMMAND) &&
             line.find("SCREWS_TILT_CALCULATE") != std::string::npos) {
             complete_error("SCREWS_TILT_CALCULATE requires [screws_tilt_adjust] in printer.cfg");
             return;
         }
 
         // Parse screw result lines that start with "//"
-        if (line.rfind("//", 0) == 0) {
-            parse_screw_line(line);
+        if (response.is(gcode_line::COMMENT)) {
+            parse_screw_line(std::string(line));
         }
 
         // Check for completion markers
         // Klipper prints "ok" when command completes
-        if (line == "ok") {
+        if (response.is(gcode_line::ACK)) {
             if (!results_.empty()) {
                 complete_success();
             } else {
@@ -365,10 +471,9 @@ class ScrewsTiltCollector : public std::enable_shared_from_this<ScrewsTiltCollec
             return;
         }
 
-        // Broader error detection - catch Klipper errors
-        if (line.find("Error") != std::string::npos || line.find("error") != std::string::npos ||
-            line.rfind("!! ", 0) == 0) { // Emergency/critical errors start with "!! "
-            complete_error(line);
+        // Broader error detection - catch Klipper errors (any "Error"/"error", or "!! ")
+        if (response.is(gcode_line::MENTIONS_ERROR | gcode_line::KLIPPER_ERROR)) {
+            complete_error(std::string(line));
         }
     }
 
@@ -413,22 +518,21 @@ class ScrewsTiltCollector : public std::enable_shared_from_this<ScrewsTiltCollec
 
         // Parse x, y, z values
         // Look for "x=", "y=", "z="
-        auto parse_float = [&line](const std::string& prefix) -> float {
+        auto parse_float = [&line](std::string_view prefix) -> float {
             size_t pos = line.find(prefix);
             if (pos == std::string::npos) {
                 return 0.0f;
             }
-            pos += prefix.length();
-            // Find end of number (next comma, space, or end of line)
-            size_t end = line.find_first_of(", ", pos);
-            if (end == std::string::npos) {
-                end = line.length();
+            std::string_view text = std::string_view(line).substr(pos + prefix.length());
+            bool negative = !text.empty() && text.front() == '-';
+            if (negative) {
+                text.remove_prefix(1);
             }
-            try {
-                return std::stof(line.substr(pos, end - pos));
-            } catch (...) {
+            float value = 0.0f;
+            if (!helix::parse_decimal(text, value)) {
                 return 0.0f;
             }
+            return negative ? -value : value;
         };
 
         result.x_pos = parse_float("x=");
@@ -491,7 +595,7 @@ class ScrewsTiltCollector : public std::enable_shared_from_this<ScrewsTiltCollec
     MoonrakerClient& client_;
     ScrewTiltCallback on_success_;
     MoonrakerAPI::ErrorCallback on_error_;
-    std::string handler_name_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
     std::atomic<bool> registered_{false}; // Thread-safe: accessed from callback and destructor
     std::atomic<bool> completed_{false};  // Thread-safe: prevents double-callback invocation
     std::vector<ScrewTiltResult> results_;
@@ -521,23 +625,22 @@ class InputShaperCollector : public std::enable_shared_from_this<InputShaperColl
     }
 
     void start() {
-        static std::atomic<uint64_t> s_collector_id{0};
-        handler_name_ = "input_shaper_collector_" + std::to_string(++s_collector_id);
-
         auto self = shared_from_this();
-        client_.register_method_callback("notify_gcode_response", handler_name_,
-                                         [self](const json& msg) { self->on_gcode_response(msg); });
+        subscription_id_ = client_.gcode_responses().subscribe(
+            gcode_line::FITTED_SHAPER | gcode_line::RECOMMENDED_SHAPER |
+                gcode_line::UNKNOWN_COMMAND | gcode_line::KLIPPER_ERROR,
+            [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
 
         registered_.store(true);
         spdlog::debug(
-            "[InputShaperCollector] Started collecting responses for axis {} (handler: {})", axis_,
-            handler_name_);
+            "[InputShaperCollector] Started collecting responses for axis {} (subscription {})",
+            axis_, subscription_id_);
     }
 
     void unregister() {
         bool was_registered = registered_.exchange(false);
         if (was_registered) {
-            client_.unregister_method_callback("notify_gcode_response", handler_name_);
+            client_.gcode_responses().unsubscribe(subscription_id_);
             spdlog::debug("[InputShaperCollector] Unregistered callback");
         }
     }
@@ -546,20 +649,16 @@ class InputShaperCollector : public std::enable_shared_from_this<InputShaperColl
         completed_.store(true);
     }
 
-    void on_gcode_response(const json& msg) {
+    void on_gcode_response(const helix::GCodeResponseLine& response) {
         if (completed_.load()) {
             return;
         }
 
-        if (!msg.contains("params") || !msg["params"].is_array() || msg["params"].empty()) {
-            return;
-        }
-
-        const std::string& line = msg["params"][0].get_ref<const std::string&>();
+        const std::string_view line = response.text;
         spdlog::trace("[InputShaperCollector] Received: {}", line);
 
         // Check for unknown command error
-        if (line.find("Unknown command") != std::string::npos &&
+        if (response.is(gcode_line::UNKNOWN_COMMAND) &&
             line.find("SHAPER_CALIBRATE") != std::string::npos) {
             complete_error(
                 "SHAPER_CALIBRATE requires [resonance_tester] and ADXL345 in printer.cfg");
@@ -568,63 +667,40 @@ class InputShaperCollector : public std::enable_shared_from_this<InputShaperColl
 
         // Parse shaper fit lines
         // Format: "Fitted shaper 'mzv' frequency = 36.7 Hz (vibrations = 7.2%, smoothing ~= 0.140)"
-        if (line.find("Fitted shaper") != std::string::npos) {
+        if (response.is(gcode_line::FITTED_SHAPER)) {
             parse_shaper_line(line);
         }
 
         // Parse recommendation line
         // Format: "Recommended shaper is mzv @ 36.7 Hz"
-        if (line.find("Recommended shaper") != std::string::npos) {
+        if (response.is(gcode_line::RECOMMENDED_SHAPER)) {
             parse_recommendation(line);
             // Recommendation marks completion
             complete_success();
             return;
         }
 
-        // Error detection - be specific to avoid false positives
-        if (line.rfind("!! ", 0) == 0 ||                // Klipper emergency errors
-            line.rfind("Error: ", 0) == 0 ||            // Standard errors
-            line.find("error:") != std::string::npos) { // Python traceback
-            complete_error(line);
+        // Error detection ("!! ", "Error:" or a Python traceback's "error:")
+        if (response.is(gcode_line::KLIPPER_ERROR)) {
+            complete_error(std::string(line));
         }
     }
 
   private:
-    void parse_shaper_line(const std::string& line) {
-        // Static regex for performance
-        static const std::regex shaper_regex(
-            R"(Fitted shaper '(\w+)' frequency = ([\d.]+) Hz \(vibrations = ([\d.]+)%, smoothing ~= ([\d.]+)\))");
-
-        std::smatch match;
-        if (std::regex_search(line, match, shaper_regex) && match.size() == 5) {
-            ShaperFitData fit;
-            fit.type = match[1].str();
-            try {
-                fit.frequency = std::stof(match[2].str());
-                fit.vibrations = std::stof(match[3].str());
-                fit.smoothing = std::stof(match[4].str());
-            } catch (const std::exception& e) {
-                spdlog::warn("[InputShaperCollector] Failed to parse values: {}", e.what());
-                return;
-            }
-
-            spdlog::debug("[InputShaperCollector] Parsed: {} @ {:.1f} Hz (vib: {:.1f}%)", fit.type,
-                          fit.frequency, fit.vibrations);
-            shaper_fits_.push_back(fit);
+    void parse_shaper_line(std::string_view line) {
+        helix::FittedShaperLine fit;
+        if (!helix::parse_fitted_shaper(line, fit)) {
+            spdlog::warn("[InputShaperCollector] Failed to parse shaper line: {}", line);
+            return;
         }
-    }
 
-    void parse_recommendation(const std::string& line) {
-        static const std::regex rec_regex(R"(Recommended shaper is (\w+) @ ([\d.]+) Hz)");
+        spdlog::debug("[InputShaperCollector] Parsed: {} @ {:.1f} Hz (vib: {:.1f}%)", fit.type,
+                      fit.frequency, fit.vibrations);
+        shaper_fits_.push_back(std::move(fit));
+    }
 
-        std::smatch match;
-        if (std::regex_search(line, match, rec_regex) && match.size() == 3) {
-            recommended_type_ = match[1].str();
-            try {
-                recommended_freq_ = std::stof(match[2].str());
-            } catch (const std::exception&) {
-                recommended_freq_ = 0.0f;
-            }
+    void parse_recommendation(std::string_view line) {
+        if (helix::parse_recommended_shaper(line, recommended_type_, recommended_freq_)) {
             spdlog::info("[InputShaperCollector] Recommendation: {} @ {:.1f} Hz", recommended_type_,
                          recommended_freq_);
         }
@@ -684,23 +760,15 @@ class InputShaperCollector : public std::enable_shared_from_this<InputShaperColl
         }
     }
 
-    // Internal struct for collecting fits before building final result
-    struct ShaperFitData {
-        std::string type;
-        float frequency = 0.0f;
-        float vibrations = 0.0f;
-        float smoothing = 0.0f;
-    };
-
     MoonrakerClient& client_;
     char axis_;
     InputShaperCallback on_success_;
     MoonrakerAPI::ErrorCallback on_error_;
-    std::string handler_name_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
     std::atomic<bool> registered_{false};
     std::atomic<bool> completed_{false};
 
-    std::vector<ShaperFitData> shaper_fits_;
+    std::vector<helix::FittedShaperLine> shaper_fits_;
     std::string recommended_type_;
     float recommended_freq_ = 0.0f;
 };
@@ -729,22 +797,20 @@ class NoiseCheckCollector : public std::enable_shared_from_this<NoiseCheckCollec
     }
 
     void start() {
-        static std::atomic<uint64_t> s_collector_id{0};
-        handler_name_ = "noise_check_collector_" + std::to_string(++s_collector_id);
-
         auto self = shared_from_this();
-        client_.register_method_callback("notify_gcode_response", handler_name_,
-                                         [self](const json& msg) { self->on_gcode_response(msg); });
+        subscription_id_ = client_.gcode_responses().subscribe(
+            gcode_line::AXES_NOISE | gcode_line::UNKNOWN_COMMAND | gcode_line::KLIPPER_ERROR,
+            [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
 
         registered_.store(true);
-        spdlog::debug("[NoiseCheckCollector] Started collecting responses (handler: {})",
-                      handler_name_);
+        spdlog::debug("[NoiseCheckCollector] Started collecting responses (subscription {})",
+                      subscription_id_);
     }
 
     void unregister() {
         bool was_registered = registered_.exchange(false);
         if (was_registered) {
-            client_.unregister_method_callback("notify_gcode_response", handler_name_);
+            client_.gcode_responses().unsubscribe(subscription_id_);
             spdlog::debug("[NoiseCheckCollector] Unregistered callback");
         }
     }
@@ -753,54 +819,40 @@ class NoiseCheckCollector : public std::enable_shared_from_this<NoiseCheckCollec
         completed_.store(true);
     }
 
-    void on_gcode_response(const json& msg) {
+    void on_gcode_response(const helix::GCodeResponseLine& response) {
         if (completed_.load()) {
             return;
         }
 
-        if (!msg.contains("params") || !msg["params"].is_array() || msg["params"].empty()) {
-            return;
-        }
-
-        const std::string& line = msg["params"][0].get_ref<const std::string&>();
+        const std::string_view line = response.text;
         spdlog::trace("[NoiseCheckCollector] Received: {}", line);
 
         // Check for unknown command error (no accelerometer configured)
-        if (line.find("Unknown command") != std::string::npos &&
+        if (response.is(gcode_line::UNKNOWN_COMMAND) &&
             line.find("MEASURE_AXES_NOISE") != std::string::npos) {
             complete_error("MEASURE_AXES_NOISE requires [adxl345] accelerometer in printer.cfg");
             return;
         }
 
         // Parse noise level line: "axes_noise = 0.012345"
-        if (line.find("axes_noise") != std::string::npos) {
+        if (response.is(gcode_line::AXES_NOISE)) {
             parse_noise_line(line);
             return;
         }
 
-        // Error detection
-        if (line.rfind("!! ", 0) == 0 ||                // Emergency errors
-            line.rfind("Error:", 0) == 0 ||             // Standard errors
-            line.find("error:") != std::string::npos) { // Python traceback
-            complete_error(line);
+        // Error detection ("!! ", "Error:" or a Python traceback's "error:")
+        if (response.is(gcode_line::KLIPPER_ERROR)) {
+            complete_error(std::string(line));
         }
     }
 
   private:
-    void parse_noise_line(const std::string& line) {
+    void parse_noise_line(std::string_view line) {
         // Format: "axes_noise = 0.012345"
-        static const std::regex noise_regex(R"(axes_noise\s*=\s*([\d.]+))");
-
-        std::smatch match;
-        if (std::regex_search(line, match, noise_regex) && match.size() == 2) {
-            try {
-                float noise = std::stof(match[1].str());
-                spdlog::info("[NoiseCheckCollector] Noise level: {:.6f}", noise);
-                complete_success(noise);
-            } catch (const std::exception& e) {
-                spdlog::warn("[NoiseCheckCollector] Failed to parse noise value: {}", e.what());
-                complete_error("Failed to parse noise measurement");
-            }
+        float noise = 0.0f;
+        if (helix::parse_axes_noise(line, noise)) {
+            spdlog::info("[NoiseCheckCollector] Noise level: {:.6f}", noise);
+            complete_success(noise);
         }
     }
 
@@ -837,11 +889,135 @@ class NoiseCheckCollector : public std::enable_shared_from_this<NoiseCheckCollec
     MoonrakerClient& client_;
     MoonrakerAPI::NoiseCheckCallback on_success_;
     MoonrakerAPI::ErrorCallback on_error_;
-    std::string handler_name_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
     std::atomic<bool> registered_{false};
     std::atomic<bool> completed_{false};
 };
 
+/**
+ * @brief Collects the raw data files written by TEST_RESONANCES OUTPUT=raw_data
+ *
+ * Klipper announces each file it writes as a console line:
+ *   Writing raw accelerometer data to /tmp/raw_data_x_helix.csv file
+ *
+ * The test is finished when the G-code request itself completes (see
+ * MoonrakerAPI::capture_resonance_data()).
+ */
+class ResonanceDataCollector : public std::enable_shared_from_this<ResonanceDataCollector> {
+  public:
+    ResonanceDataCollector(MoonrakerClient& client,
+                           MoonrakerAPI::ResonanceDataCallback on_success,
+                           MoonrakerAPI::ErrorCallback on_error)
+        : client_(client), on_success_(std::move(on_success)), on_error_(std::move(on_error)) {}
+
+    ~ResonanceDataCollector() {
+        unregister();
+    }
+
+    void start() {
+        auto self = shared_from_this();
+        subscription_id_ = client_.gcode_responses().subscribe(
+            gcode_line::RAW_DATA_FILE | gcode_line::UNKNOWN_COMMAND | gcode_line::KLIPPER_ERROR,
+            [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
+
+        registered_.store(true);
+        spdlog::debug("[ResonanceDataCollector] Started collecting responses (subscription {})",
+                      subscription_id_);
+    }
+
+    void unregister() {
+        bool was_registered = registered_.exchange(false);
+        if (was_registered) {
+            client_.gcode_responses().unsubscribe(subscription_id_);
+            spdlog::debug("[ResonanceDataCollector] Unregistered callback");
+        }
+    }
+
+    void mark_completed() {
+        completed_.store(true);
+    }
+
+    void on_gcode_response(const helix::GCodeResponseLine& response) {
+        if (completed_.load()) {
+            return;
+        }
+
+        const std::string_view line = response.text;
+        spdlog::trace("[ResonanceDataCollector] Received: {}", line);
+
+        if (response.is(gcode_line::UNKNOWN_COMMAND) &&
+            line.find("TEST_RESONANCES") != std::string::npos) {
+            complete_error(
+                "TEST_RESONANCES requires [resonance_tester] and ADXL345 in printer.cfg");
+            return;
+        }
+
+        // Format: "Writing raw accelerometer data to /tmp/raw_data_x_helix.csv file"
+        std::string path;
+        if (response.is(gcode_line::RAW_DATA_FILE) && helix::parse_raw_data_path(line, path)) {
+            spdlog::debug("[ResonanceDataCollector] Raw data file: {}", path);
+            std::lock_guard<std::mutex> lock(paths_mutex_);
+            paths_.push_back(std::move(path));
+            return;
+        }
+
+        if (response.is(gcode_line::KLIPPER_ERROR)) {
+            complete_error(std::string(line));
+        }
+    }
+
+    void complete_success() {
+        if (completed_.exchange(true)) {
+            return;
+        }
+        unregister();
+
+        std::vector<std::string> paths;
+        {
+            std::lock_guard<std::mutex> lock(paths_mutex_);
+            paths = paths_;
+        }
+        if (paths.empty()) {
+            complete_error_unchecked("TEST_RESONANCES finished without writing accelerometer data");
+            return;
+        }
+
+        spdlog::info("[ResonanceDataCollector] Complete with {} raw data file(s)", paths.size());
+        if (on_success_) {
+            on_success_(paths);
+        }
+    }
+
+  private:
+    void complete_error(const std::string& message) {
+        if (completed_.exchange(true)) {
+            return;
+        }
+        unregister();
+        complete_error_unchecked(message);
+    }
+
+    void complete_error_unchecked(const std::string& message) {
+        spdlog::error("[ResonanceDataCollector] Error: {}", message);
+        if (on_error_) {
+            MoonrakerError err;
+            err.type = MoonrakerErrorType::JSON_RPC_ERROR;
+            err.message = message;
+            err.method = "TEST_RESONANCES";
+            on_error_(err);
+        }
+    }
+
+    MoonrakerClient& client_;
+    MoonrakerAPI::ResonanceDataCallback on_success_;
+    MoonrakerAPI::ErrorCallback on_error_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
+    std::atomic<bool> registered_{false};
+    std::atomic<bool> completed_{false};
+    std::mutex paths_mutex_;
+    std::vector<std::string> paths_;
+};
+
 /**
  * @brief State machine for collecting BED_MESH_CALIBRATE progress
  *
@@ -876,22 +1052,21 @@ class BedMeshProgressCollector : public std::enable_shared_from_this<BedMeshProg
     }
 
     void start() {
-        static std::atomic<uint64_t> s_collector_id{0};
-        handler_name_ = "bed_mesh_collector_" + std::to_string(++s_collector_id);
-
         auto self = shared_from_this();
-        client_.register_method_callback("notify_gcode_response", handler_name_,
-                                         [self](const json& msg) { self->on_gcode_response(msg); });
+        subscription_id_ = client_.gcode_responses().subscribe(
+            gcode_line::PROBE_PROGRESS | gcode_line::MESH_COMPLETE | gcode_line::UNKNOWN_COMMAND |
+                gcode_line::KLIPPER_ERROR,
+            [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
 
         registered_.store(true);
-        spdlog::debug("[BedMeshProgressCollector] Started collecting responses (handler: {})",
-                      handler_name_);
+        spdlog::debug("[BedMeshProgressCollector] Started collecting responses (subscription {})",
+                      subscription_id_);
     }
 
     void unregister() {
         bool was_registered = registered_.exchange(false);
         if (was_registered) {
-            client_.unregister_method_callback("notify_gcode_response", handler_name_);
+            client_.gcode_responses().unsubscribe(subscription_id_);
             spdlog::debug("[BedMeshProgressCollector] Unregistered callback");
         }
     }
@@ -900,71 +1075,57 @@ class BedMeshProgressCollector : public std::enable_shared_from_this<BedMeshProg
         completed_.store(true);
     }
 
-    void on_gcode_response(const json& msg) {
+    void on_gcode_response(const helix::GCodeResponseLine& response) {
         if (completed_.load()) {
             return;
         }
 
-        // notify_gcode_response format: {"method": "notify_gcode_response", "params": ["line"]}
-        if (!msg.contains("params") || !msg["params"].is_array() || msg["params"].empty()) {
-            return;
-        }
-
-        const std::string& line = msg["params"][0].get_ref<const std::string&>();
+        const std::string_view line = response.text;
         spdlog::trace("[BedMeshProgressCollector] Received: {}", line);
 
-        // Check for errors first
-        if (line.rfind("!! ", 0) == 0 ||                // Emergency errors
-            line.rfind("Error:", 0) == 0 ||             // Standard errors
-            line.find("error:") != std::string::npos) { // Python traceback
-            complete_error(line);
+        // Check for errors first ("!! ", "Error:" or a Python traceback's "error:")
+        if (response.is(gcode_line::KLIPPER_ERROR)) {
+            complete_error(std::string(line));
             return;
         }
 
         // Check for unknown command error
-        if (line.find("Unknown command") != std::string::npos &&
+        if (response.is(gcode_line::UNKNOWN_COMMAND) &&
             line.find("BED_MESH_CALIBRATE") != std::string::npos) {
             complete_error("BED_MESH_CALIBRATE requires [bed_mesh] in printer.cfg");
             return;
         }
 
         // Try to parse probe progress
-        parse_probe_line(line);
+        if (response.is(gcode_line::PROBE_PROGRESS)) {
+            parse_probe_line(line);
+        }
 
         // Check for completion markers
-        if (line.find("Mesh Bed Leveling Complete") != std::string::npos ||
-            line.find("Mesh bed leveling complete") != std::string::npos) {
+        if (response.is(gcode_line::MESH_COMPLETE)) {
             complete_success();
             return;
         }
     }
 
   private:
-    void parse_probe_line(const std::string& line) {
-        // Static regex for performance - handles both formats:
-        // "Probing point 5/25" and "Probe point 5 of 25"
-        static const std::regex probe_regex(
-            R"(Prob(?:ing point|e point) (\d+)[/\s]+(?:of\s+)?(\d+))");
-
-        std::smatch match;
-        if (std::regex_search(line, match, probe_regex) && match.size() == 3) {
-            try {
-                int current = std::stoi(match[1].str());
-                int total = std::stoi(match[2].str());
+    void parse_probe_line(std::string_view line) {
+        // Handles both "Probing point 5/25" and "Probe point 5 of 25"
+        int current = 0;
+        int total = 0;
+        if (!helix::parse_probe_progress(line, current, total)) {
+            return;
+        }
 
-                // Update tracked values
-                current_probe_ = current;
-                total_probes_ = total;
+        // Update tracked values
+        current_probe_ = current;
+        total_probes_ = total;
 
-                spdlog::debug("[BedMeshProgressCollector] Progress: {}/{}", current, total);
+        spdlog::debug("[BedMeshProgressCollector] Progress: {}/{}", current, total);
 
-                // Invoke progress callback
-                if (on_progress_) {
-                    on_progress_(current, total);
-                }
-            } catch (const std::exception& e) {
-                spdlog::warn("[BedMeshProgressCollector] Failed to parse values: {}", e.what());
-            }
+        // Invoke progress callback
+        if (on_progress_) {
+            on_progress_(current, total);
         }
     }
 
@@ -1003,7 +1164,7 @@ class BedMeshProgressCollector : public std::enable_shared_from_this<BedMeshProg
     ProgressCallback on_progress_;
     MoonrakerAPI::SuccessCallback on_complete_;
     MoonrakerAPI::ErrorCallback on_error_;
-    std::string handler_name_;
+    helix::GCodeResponseDispatcher::SubscriptionId subscription_id_ = 0;
     std::atomic<bool> registered_{false};
     std::atomic<bool> completed_{false};
 
@@ -1109,6 +1270,34 @@ void MoonrakerAPI::start_resonance_test(char axis, AdvancedProgressCallback /*on
         });
 }
 
+void MoonrakerAPI::capture_resonance_data(char axis, ResonanceDataCallback on_complete,
+                                          ErrorCallback on_error) {
+    spdlog::info("[Moonraker API] Starting TEST_RESONANCES AXIS={} OUTPUT=raw_data", axis);
+
+    auto collector = std::make_shared<ResonanceDataCollector>(client_, on_complete, on_error);
+    collector->start();
+
+    std::string cmd = "TEST_RESONANCES AXIS=";
+    cmd += axis;
+    cmd += " OUTPUT=raw_data NAME=helix ; from helixscreen";
+
+    // The request only returns once the sweep and file writing have finished,
+    // which takes minutes - far beyond the default request timeout
+    constexpr uint32_t RESONANCE_TEST_TIMEOUT_MS = 10 * 60 * 1000;
+    client_.send_jsonrpc(
+        "printer.gcode.script", json{{"script", cmd}},
+        [collector](json) { collector->complete_success(); },
+        [collector, on_error](const MoonrakerError& err) {
+            spdlog::error("[Moonraker API] TEST_RESONANCES failed: {}", err.message);
+            collector->mark_completed();
+            collector->unregister();
+            if (on_error) {
+                on_error(err);
+            }
+        },
+        RESONANCE_TEST_TIMEOUT_MS);
+}
+
 void MoonrakerAPI::start_klippain_shaper_calibration(const std::string& /*axis*/,
                                                      SuccessCallback /*on_success*/,
                                                      ErrorCallback on_error) {
@@ -1469,6 +1658,66 @@ void MoonrakerAPI::get_machine_limits(MachineLimitsCallback on_success, ErrorCal
         on_error);
 }
 
+void MoonrakerAPI::get_configured_machine_limits(MachineLimitsCallback on_success,
+                                                 ErrorCallback on_error) {
+    spdlog::debug("[Moonraker API] Querying configured machine limits");
+
+    json params = {{"objects", json::object({{"configfile", json::array({"settings"})}})}};
+
+    client_.send_jsonrpc(
+        "printer.objects.query", params,
+        [on_success, on_error](json response) {
+            try {
+                const json* printer = nullptr;
+                if (response.contains("result") && response["result"].contains("status")) {
+                    const json& status = response["result"]["status"];
+                    if (status.contains("configfile") &&
+                        status["configfile"].contains("settings") &&
+                        status["configfile"]["settings"].contains("printer")) {
+                        printer = &status["configfile"]["settings"]["printer"];
+                    }
+                }
+                if (!printer) {
+                    spdlog::warn("[Moonraker API] Printer config section not available");
+                    if (on_error) {
+                        MoonrakerError err;
+                        err.type = MoonrakerErrorType::UNKNOWN;
+                        err.message = "Printer config section not available";
+                        on_error(err);
+                    }
+                    return;
+                }
+
+                MachineLimits limits;
+                limits.max_velocity = printer->value("max_velocity", 0.0);
+                limits.max_accel = printer->value("max_accel", 0.0);
+                limits.max_accel_to_decel = printer->value("max_accel_to_decel", 0.0);
+                limits.square_corner_velocity = printer->value("square_corner_velocity", 0.0);
+                limits.max_z_velocity = printer->value("max_z_velocity", 0.0);
+                limits.max_z_accel = printer->value("max_z_accel", 0.0);
+
+                spdlog::debug("[Moonraker API] Configured limits: vel={:.0f} accel={:.0f} "
+                              "scv={:.1f} z_vel={:.0f} z_accel={:.0f}",
+                              limits.max_velocity, limits.max_accel,
+                              limits.square_corner_velocity, limits.max_z_velocity,
+                              limits.max_z_accel);
+
+                if (on_success) {
+                    on_success(limits);
+                }
+            } catch (const std::exception& e) {
+                spdlog::error("[Moonraker API] Failed to parse configured limits: {}", e.what());
+                if (on_error) {
+                    MoonrakerError err;
+                    err.type = MoonrakerErrorType::UNKNOWN;
+                    err.message = std::string("Failed to parse configured limits: ") + e.what();
+                    on_error(err);
+                }
+            }
+        },
+        on_error);
+}
+
 void MoonrakerAPI::set_machine_limits(const MachineLimits& limits, SuccessCallback on_success,
                                       ErrorCallback on_error) {
     spdlog::info("[Moonraker API] Setting machine limits");
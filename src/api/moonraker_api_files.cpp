@@ -12,6 +12,7 @@
 #include "moonraker_api_internal.h"
 #include "spdlog/spdlog.h"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -334,6 +335,17 @@ void MoonrakerAPI::download_file_partial(const std::string& root, const std::str
         std::string range_header = "bytes=0-" + std::to_string(max_bytes - 1);
         req->SetHeader("Range", range_header);
 
+        // A server or proxy that ignores Range answers 200 with the whole file.
+        // Collect the body ourselves so at most max_bytes are ever held in memory.
+        std::string body;
+        req->http_cb = [&body, max_bytes](HttpMessage*, http_parser_state state, const char* data,
+                                          size_t size) {
+            if (state != HP_BODY || data == nullptr || body.size() >= max_bytes) {
+                return;
+            }
+            body.append(data, std::min(size, max_bytes - body.size()));
+        };
+
         auto resp = requests::request(req);
 
         // Accept both 200 (full file) and 206 (partial content)
@@ -342,10 +354,10 @@ void MoonrakerAPI::download_file_partial(const std::string& root, const std::str
         }
 
         spdlog::debug("[Moonraker API] Partial download: {} bytes from {} (status {})",
-                      resp->body.size(), path, static_cast<int>(resp->status_code));
+                      body.size(), path, static_cast<int>(resp->status_code));
 
         if (on_success) {
-            on_success(resp->body);
+            on_success(body);
         }
     });
 }
@@ -20,6 +20,7 @@
 #include "app_globals.h"
 #include "helix_version.h"
 #include "printer_state.h"
+#include "scoped_trace.h"
 
 #include <algorithm> // For std::sort in MCU query handling
 #include <sstream>   // For annotate_gcode()
@@ -352,6 +353,10 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                 return;
             }
 
+            if (recording_traffic_.load(std::memory_order_relaxed)) {
+                traffic_recorder_.record(helix::TrafficFrame::Direction::RECEIVED, msg);
+            }
+
             // Validate message size to prevent memory exhaustion
             static constexpr size_t MAX_MESSAGE_SIZE = 1024 * 1024; // 1 MB
             if (msg.size() > MAX_MESSAGE_SIZE) {
@@ -377,6 +382,18 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                 spdlog::debug("[Moonraker Client] Received large message: {} bytes", msg.size());
             }
 
+            // Status updates are nearly all of the traffic: decode them straight
+            // into typed slots and only build JSON for subscribers that want it
+            {
+                auto delta = std::make_shared<helix::StatusDelta>();
+                if (helix::decode_status_notification(msg, *delta)) {
+                    subscriptions_.record_update(msg.size());
+                    HELIX_TRACE_SCOPE("moonraker", "notify_dispatch");
+                    dispatch_status_delta(delta);
+                    return;
+                }
+            }
+
             // Parse JSON message
             json j;
             try {
@@ -482,14 +499,32 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
 
                 std::string method = j["method"].get<std::string>();
 
+                // Status updates the decoder could not handle: everything is untyped
+                if (method == "notify_status_update") {
+                    auto delta = std::make_shared<helix::StatusDelta>();
+                    auto params = j.find("params");
+                    if (params != j.end() && params->is_array() && !params->empty() &&
+                        (*params)[0].is_object()) {
+                        delta->other = (*params)[0];
+                        if (params->size() > 1 && (*params)[1].is_number()) {
+                            delta->eventtime = (*params)[1].get<double>();
+                        }
+                    }
+                    subscriptions_.record_update(msg.size());
+                    HELIX_TRACE_SCOPE("moonraker", "notify_dispatch");
+                    dispatch_status_delta(delta, &j);
+                    return;
+                }
+
                 // Copy callbacks to invoke (to avoid holding lock during callback execution)
                 std::vector<std::function<void(json)>> callbacks_to_invoke;
 
                 {
                     std::lock_guard<std::mutex> lock(callbacks_mutex_);
 
-                    // Printer status updates (most common)
-                    if (method == "notify_status_update" || method == "notify_filelist_changed") {
+                    // Status updates are dispatched above; file list changes share the
+                    // notify callbacks
+                    if (method == "notify_filelist_changed") {
                         // Copy all notify callbacks from map
                         callbacks_to_invoke.reserve(notify_callbacks_.size());
                         for (const auto& [id, cb] : notify_callbacks_) {
@@ -506,16 +541,8 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                     }
                 } // Release lock
 
-                // Parse bed mesh updates before invoking user callbacks
-                if (method == "notify_status_update" && j.contains("params") &&
-                    j["params"].is_array() && !j["params"].empty()) {
-                    const json& params = j["params"][0];
-                    if (params.contains("bed_mesh") && params["bed_mesh"].is_object()) {
-                        parse_bed_mesh(params["bed_mesh"]);
-                    }
-                }
-
                 // Invoke callbacks outside lock to prevent deadlock
+                HELIX_TRACE_SCOPE("moonraker", "notify_dispatch");
                 for (auto& cb : callbacks_to_invoke) {
                     try {
                         cb(j);
@@ -616,6 +643,7 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                 spdlog::warn("[Moonraker Client] WebSocket connection closed");
                 was_connected_ = false;
                 identified_.store(false); // Reset so re-identification happens on reconnect
+                subscriptions_.clear_base(); // Rebuilt by discovery after reconnecting
 
                 // Emit event with rate limiting to prevent spam during reconnect loop
                 if (!g_already_notified_disconnect.load()) {
@@ -708,6 +736,21 @@ SubscriptionId MoonrakerClient::register_notify_update(std::function<void(json)>
     return id;
 }
 
+SubscriptionId MoonrakerClient::register_status_update(StatusUpdateCallback cb) {
+    if (!cb) {
+        spdlog::warn("[Moonraker Client] register_status_update called with null callback");
+        return INVALID_SUBSCRIPTION_ID;
+    }
+
+    SubscriptionId id = next_subscription_id_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        status_callbacks_.emplace(id, std::move(cb));
+    }
+    spdlog::debug("[Moonraker Client] Registered status callback with ID {}", id);
+    return id;
+}
+
 bool MoonrakerClient::unsubscribe_notify_update(SubscriptionId id) {
     if (id == INVALID_SUBSCRIPTION_ID) {
         return false;
@@ -720,6 +763,10 @@ bool MoonrakerClient::unsubscribe_notify_update(SubscriptionId id) {
         spdlog::debug("[Moonraker Client] Unsubscribed notify callback ID {}", id);
         return true;
     }
+    if (status_callbacks_.erase(id) > 0) {
+        spdlog::debug("[Moonraker Client] Unsubscribed status callback ID {}", id);
+        return true;
+    }
     spdlog::debug("[Moonraker Client] Unsubscribe failed: notify callback ID {} not found", id);
     return false;
 }
@@ -795,26 +842,82 @@ void MoonrakerClient::dispatch_status_update(const json& status) {
         {"params", json::array({status, 0.0})} // [status, eventtime]
     };
 
-    // Dispatch to all registered callbacks
+    // Typed subscribers get the whole status untyped; it did not come off the wire
+    auto delta = std::make_shared<helix::StatusDelta>();
+    delta->other = status;
+    size_t invoked = dispatch_status_delta(delta, &notification);
+
+    spdlog::info(
+        "[Moonraker Client] Dispatched status update to {} callbacks (has print_stats: {})",
+        invoked, status.contains("print_stats"));
+}
+
+size_t MoonrakerClient::dispatch_status_delta(
+    const std::shared_ptr<const helix::StatusDelta>& delta, const json* notification) {
+    // Parse bed mesh updates before invoking user callbacks (bed_mesh is never typed)
+    const json& other = delta->other;
+    if (other.is_object()) {
+        auto mesh = other.find("bed_mesh");
+        if (mesh != other.end() && mesh->is_object()) {
+            parse_bed_mesh(*mesh);
+        }
+    }
+
     // Two-phase: copy under lock, invoke outside to avoid deadlock
-    std::vector<std::function<void(json)>> callbacks_copy;
+    std::vector<StatusUpdateCallback> status_copy;
+    std::vector<std::function<void(json)>> json_copy;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
+        status_copy.reserve(status_callbacks_.size());
+        for (const auto& [id, cb] : status_callbacks_) {
+            status_copy.push_back(cb);
+        }
+        json_copy.reserve(notify_callbacks_.size());
         for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
+            json_copy.push_back(cb);
+        }
+        auto method_it = method_callbacks_.find("notify_status_update");
+        if (method_it != method_callbacks_.end()) {
+            for (const auto& [handler_name, cb] : method_it->second) {
+                json_copy.push_back(cb);
+            }
         }
     }
 
-    for (const auto& cb : callbacks_copy) {
-        if (cb) {
-            cb(notification);
+    for (const auto& cb : status_copy) {
+        try {
+            cb(delta);
+        } catch (const std::exception& e) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Status callback threw exception: {}",
+                               e.what());
+        } catch (...) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Status callback threw unknown exception");
         }
     }
 
-    spdlog::info(
-        "[Moonraker Client] Dispatched status update to {} callbacks (has print_stats: {})",
-        callbacks_copy.size(), status.contains("print_stats"));
+    if (json_copy.empty()) {
+        return status_copy.size();
+    }
+
+    // JSON subscribers (AMS backends, plugins, ...) still get the notification
+    json rebuilt;
+    if (!notification) {
+        rebuilt = delta->to_notification_json();
+        notification = &rebuilt;
+    }
+    for (const auto& cb : json_copy) {
+        try {
+            cb(*notification);
+        } catch (const std::exception& e) {
+            LOG_ERROR_INTERNAL(
+                "[Moonraker Client] Callback for notify_status_update threw exception: {}",
+                e.what());
+        } catch (...) {
+            LOG_ERROR_INTERNAL(
+                "[Moonraker Client] Callback for notify_status_update threw unknown exception");
+        }
+    }
+    return status_copy.size() + json_copy.size();
 }
 
 void MoonrakerClient::register_method_callback(const std::string& method,
@@ -865,6 +968,26 @@ bool MoonrakerClient::unregister_method_callback(const std::string& method,
     return true;
 }
 
+int MoonrakerClient::send_frame(const std::string& frame) {
+    if (recording_traffic_.load(std::memory_order_relaxed)) {
+        traffic_recorder_.record(helix::TrafficFrame::Direction::SENT, frame);
+    }
+    return send(frame);
+}
+
+bool MoonrakerClient::start_traffic_recording(const std::string& path) {
+    if (!traffic_recorder_.open(path)) {
+        return false;
+    }
+    recording_traffic_.store(true);
+    return true;
+}
+
+void MoonrakerClient::stop_traffic_recording() {
+    recording_traffic_.store(false);
+    traffic_recorder_.close();
+}
+
 int MoonrakerClient::send_jsonrpc(const std::string& method) {
     json rpc;
     rpc["jsonrpc"] = "2.0";
@@ -872,7 +995,7 @@ int MoonrakerClient::send_jsonrpc(const std::string& method) {
     rpc["id"] = request_id_++;
 
     spdlog::trace("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    return send(rpc.dump());
+    return send_frame(rpc.dump());
 }
 
 int MoonrakerClient::send_jsonrpc(const std::string& method, const json& params) {
@@ -888,7 +1011,7 @@ int MoonrakerClient::send_jsonrpc(const std::string& method, const json& params)
     rpc["id"] = request_id_++;
 
     spdlog::trace("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    return send(rpc.dump());
+    return send_frame(rpc.dump());
 }
 
 RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& params,
@@ -942,7 +1065,7 @@ RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& p
     }
 
     spdlog::trace("[Moonraker Client] send_jsonrpc: {}", rpc.dump());
-    int result = send(rpc.dump());
+    int result = send_frame(rpc.dump());
     spdlog::trace("[Moonraker Client] send_jsonrpc({}) returned {}", method, result);
 
     // Return the request ID on success, or INVALID_REQUEST_ID on send failure
@@ -1363,77 +1486,92 @@ void MoonrakerClient::continue_discovery(std::function<void()> on_complete,
         });
 }
 
-void MoonrakerClient::complete_discovery_subscription(std::function<void()> on_complete) {
-    // Step 5: Subscribe to all discovered objects + core objects
-    json subscription_objects;
+helix::SubscriptionProfile MoonrakerClient::build_base_subscription_profile() const {
+    helix::SubscriptionProfile profile;
+    profile.name = "base";
 
     // Core non-optional objects
-    subscription_objects["print_stats"] = nullptr;
-    subscription_objects["virtual_sdcard"] = nullptr;
-    subscription_objects["toolhead"] = nullptr;
-    subscription_objects["gcode_move"] = nullptr;
-    subscription_objects["motion_report"] = nullptr;
-    subscription_objects["system_stats"] = nullptr;
+    profile.add("print_stats");
+    profile.add("virtual_sdcard");
+
+    // Only the fields PrinterState reads: estimated_print_time, print_time and
+    // stalls change on every status batch and nothing consumes them
+    profile.add("toolhead", {"position", "homed_axes", "kinematics", "extruder"});
+
+    // gcode_move.position and speed change with every move; the UI shows
+    // gcode_position, the factors and the Z offset
+    profile.add("gcode_move", {"gcode_position", "speed_factor", "extrude_factor",
+                               "homing_origin", "absolute_coordinates", "absolute_extrude"});
+
+    // motion_report and system_stats are left out: no view displays them
 
     // All discovered heaters (extruders, beds, generic heaters)
     for (const auto& heater : heaters_) {
-        subscription_objects[heater] = nullptr;
+        profile.add(heater);
     }
 
     // All discovered sensors
     for (const auto& sensor : sensors_) {
-        subscription_objects[sensor] = nullptr;
+        profile.add(sensor);
     }
 
     // All discovered fans
     for (const auto& fan : fans_) {
-        subscription_objects[fan] = nullptr;
+        profile.add(fan);
     }
 
     // All discovered LEDs
     for (const auto& led : leds_) {
-        subscription_objects[led] = nullptr;
+        profile.add(led);
     }
 
     // Bed mesh (for 3D visualization)
-    subscription_objects["bed_mesh"] = nullptr;
+    profile.add("bed_mesh");
 
     // Exclude object (for mid-print object exclusion)
-    subscription_objects["exclude_object"] = nullptr;
+    profile.add("exclude_object");
 
     // Manual probe (for Z-offset calibration - PROBE_CALIBRATE, Z_ENDSTOP_CALIBRATE)
-    subscription_objects["manual_probe"] = nullptr;
+    profile.add("manual_probe");
 
     // Stepper enable state (for motor enabled/disabled detection - updates immediately on M84)
-    subscription_objects["stepper_enable"] = nullptr;
+    profile.add("stepper_enable");
 
     // Idle timeout (for printer activity state - Ready/Printing/Idle)
-    subscription_objects["idle_timeout"] = nullptr;
+    profile.add("idle_timeout");
 
     // All discovered AFC objects (AFC, AFC_stepper, AFC_hub, AFC_extruder)
     // These provide lane status, sensor states, and filament info for MMU support
     for (const auto& afc_obj : afc_objects_) {
-        subscription_objects[afc_obj] = nullptr;
+        profile.add(afc_obj);
     }
 
     // All discovered filament sensors (filament_switch_sensor, filament_motion_sensor)
     // These provide runout detection and encoder motion data
     for (const auto& sensor : filament_sensors_) {
-        subscription_objects[sensor] = nullptr;
+        profile.add(sensor);
     }
 
     // Firmware retraction settings (if printer has firmware_retraction module)
     if (hardware_.has_firmware_retraction()) {
-        subscription_objects["firmware_retraction"] = nullptr;
+        profile.add("firmware_retraction");
     }
 
     // Print start macros (for detecting when prep phase completes)
     // These are optional - printers without these macros will silently not receive updates
     // AD5M/KAMP macros:
-    subscription_objects["gcode_macro _START_PRINT"] = nullptr;
-    subscription_objects["gcode_macro START_PRINT"] = nullptr;
+    profile.add("gcode_macro _START_PRINT");
+    profile.add("gcode_macro START_PRINT");
     // HelixScreen custom macro:
-    subscription_objects["gcode_macro _HELIX_STATE"] = nullptr;
+    profile.add("gcode_macro _HELIX_STATE");
+
+    return profile;
+}
+
+void MoonrakerClient::complete_discovery_subscription(std::function<void()> on_complete) {
+    // Step 5: Subscribe to all discovered objects + core objects
+    subscriptions_.set_base(build_base_subscription_profile());
+    json subscription_objects = subscriptions_.objects();
 
     json subscribe_params = {{"objects", subscription_objects}};
 
@@ -2230,18 +2230,14 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
     constexpr int HOLD_PHASE_SAMPLES = 120; // ~30 seconds hold at peak
     // Cooling phase = remaining samples (~70s, cools extruder ~20°C to ~40°C)
 
-    // Copy callbacks to avoid holding lock during dispatch
-    std::vector<std::function<void(json)>> callbacks_copy;
+    bool has_callbacks = false;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
+        has_callbacks = !notify_callbacks_.empty() || !status_callbacks_.empty();
     }
 
     // If no callbacks registered yet, skip (caller should register before connect)
-    if (callbacks_copy.empty()) {
+    if (!has_callbacks) {
         spdlog::warn(
             "[MoonrakerClientMock] No callbacks registered for historical temps - skipping");
         return;
@@ -2327,11 +2323,10 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
                              {"params", json::array({status_obj, timestamp_sec})}};
 
         // Dispatch to all callbacks
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        auto delta = std::make_shared<helix::StatusDelta>();
+        delta->other = std::move(status_obj);
+        delta->eventtime = timestamp_sec;
+        dispatch_status_delta(delta, &notification);
     }
 
     // Store final historical values as current temps
@@ -2742,26 +2737,19 @@ void MoonrakerClientMock::temperature_simulation_loop() {
         json notification = {{"method", "notify_status_update"},
                              {"params", json::array({status_obj, tick * base_dt})}};
 
-        // Push notification through all registered callbacks
-        // Two-phase: copy under lock, invoke outside to avoid deadlock
-        std::vector<std::function<void(json)>> callbacks_copy;
-        {
-            std::lock_guard<std::mutex> lock(callbacks_mutex_);
-            callbacks_copy.reserve(notify_callbacks_.size());
-            for (const auto& [id, cb] : notify_callbacks_) {
-                callbacks_copy.push_back(cb);
-            }
-        }
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
+        // Push notification through all registered callbacks, decoding it the
+        // way a websocket frame would be so mock mode exercises the typed slots
+        auto delta = std::make_shared<helix::StatusDelta>();
+        if (!helix::decode_status_notification(notification.dump(), *delta)) {
+            *delta = helix::StatusDelta{};
+            delta->other = status_obj;
         }
+        size_t invoked = dispatch_status_delta(delta, &notification);
 
         // Log every 40 ticks (~10 seconds) to confirm loop is running
         if (tick % 40 == 0) {
             spdlog::trace("[MoonrakerClientMock] Simulation tick {} - callbacks={}", tick,
-                          callbacks_copy.size());
+                          invoked);
         }
 
         // Sleep wall-clock interval with early-exit support for clean shutdown
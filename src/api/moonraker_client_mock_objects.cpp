@@ -70,7 +70,8 @@ void register_object_handlers(std::unordered_map<std::string, MethodHandler>& re
                 status_obj["print_stats"] = {{"state", state_str}};
             }
 
-            // configfile.settings (for update_safety_limits_from_printer)
+            // configfile.settings (for update_safety_limits_from_printer and
+            // get_configured_machine_limits)
             if (objects.contains("configfile")) {
                 status_obj["configfile"] = {
                     {"settings",
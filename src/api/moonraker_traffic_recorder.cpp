@@ -0,0 +1,181 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file moonraker_traffic_recorder.cpp
+ * @brief Writing and reading websocket traffic recordings
+ */
+
+#include "moonraker_traffic_recorder.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace helix {
+
+namespace {
+
+void write_varint(std::ostream& out, uint64_t value) {
+    char bytes[10];
+    size_t n = 0;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        bytes[n++] = static_cast<char>(byte);
+    } while (value != 0);
+    out.write(bytes, static_cast<std::streamsize>(n));
+}
+
+bool read_varint(std::istream& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int c = in.get();
+        if (c == std::char_traits<char>::eof()) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(c & 0x7F) << shift;
+        if ((c & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false; // Over-long encoding
+}
+
+/// Refuse absurd lengths from corrupt files (MoonrakerClient drops frames over 1 MB)
+constexpr uint64_t MAX_FRAME_SIZE = 16 * 1024 * 1024;
+
+} // namespace
+
+// ============================================================================
+// TrafficRecorder
+// ============================================================================
+
+TrafficRecorder::~TrafficRecorder() {
+    close();
+}
+
+bool TrafficRecorder::open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_.is_open()) {
+        out_.close();
+    }
+
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_) {
+        spdlog::error("[TrafficRecorder] Cannot create {}", path);
+        return false;
+    }
+
+    out_.write(MAGIC, sizeof(MAGIC));
+    const char version[2] = {static_cast<char>(VERSION & 0xFF), static_cast<char>(VERSION >> 8)};
+    out_.write(version, sizeof(version));
+
+    path_ = path;
+    start_ = std::chrono::steady_clock::now();
+    last_timestamp_us_ = 0;
+    frame_count_ = 0;
+    spdlog::info("[TrafficRecorder] Recording Moonraker traffic to {}", path);
+    return true;
+}
+
+void TrafficRecorder::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+        return;
+    }
+    out_.close();
+    spdlog::info("[TrafficRecorder] Recorded {} frames to {}", frame_count_, path_);
+}
+
+bool TrafficRecorder::is_open() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return out_.is_open();
+}
+
+void TrafficRecorder::record(TrafficFrame::Direction direction, const std::string& payload) {
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+        return;
+    }
+
+    // Frames from two threads can race for the lock; keep deltas non-negative
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - start_).count();
+    uint64_t timestamp_us = std::max(static_cast<uint64_t>(elapsed), last_timestamp_us_);
+
+    write_varint(out_, timestamp_us - last_timestamp_us_);
+    out_.put(static_cast<char>(direction));
+    write_varint(out_, payload.size());
+    out_.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+
+    last_timestamp_us_ = timestamp_us;
+    ++frame_count_;
+}
+
+size_t TrafficRecorder::frame_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frame_count_;
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+bool load_traffic_recording(const std::string& path, std::vector<TrafficFrame>& frames) {
+    frames.clear();
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        spdlog::error("[TrafficRecorder] Cannot open {}", path);
+        return false;
+    }
+
+    char header[sizeof(TrafficRecorder::MAGIC) + 2];
+    if (!in.read(header, sizeof(header)) ||
+        std::char_traits<char>::compare(header, TrafficRecorder::MAGIC,
+                                        sizeof(TrafficRecorder::MAGIC)) != 0) {
+        spdlog::error("[TrafficRecorder] {} is not a traffic recording", path);
+        return false;
+    }
+    uint16_t version = static_cast<uint8_t>(header[4]) | (static_cast<uint8_t>(header[5]) << 8);
+    if (version != TrafficRecorder::VERSION) {
+        spdlog::error("[TrafficRecorder] {} has unsupported version {}", path, version);
+        return false;
+    }
+
+    uint64_t timestamp_us = 0;
+    while (in.peek() != std::char_traits<char>::eof()) {
+        uint64_t delta_us = 0;
+        uint64_t size = 0;
+        int direction = 0;
+        if (!read_varint(in, delta_us) ||
+            (direction = in.get()) == std::char_traits<char>::eof() || !read_varint(in, size) ||
+            size > MAX_FRAME_SIZE) {
+            spdlog::warn("[TrafficRecorder] {} is truncated after {} frames", path, frames.size());
+            return false;
+        }
+
+        TrafficFrame frame;
+        timestamp_us += delta_us;
+        frame.timestamp_us = timestamp_us;
+        frame.direction = (direction == static_cast<int>(TrafficFrame::Direction::SENT))
+                              ? TrafficFrame::Direction::SENT
+                              : TrafficFrame::Direction::RECEIVED;
+        frame.payload.resize(size);
+        if (!in.read(frame.payload.data(), static_cast<std::streamsize>(size))) {
+            spdlog::warn("[TrafficRecorder] {} is truncated after {} frames", path, frames.size());
+            return false;
+        }
+        frames.push_back(std::move(frame));
+    }
+
+    spdlog::debug("[TrafficRecorder] Loaded {} frames from {}", frames.size(), path);
+    return true;
+}
+
+} // namespace helix
@@ -0,0 +1,705 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file status_delta.cpp
+ * @brief SAX decoding of notify_status_update into typed slots
+ */
+
+#include "status_delta.h"
+
+#include <cstddef>
+
+namespace helix {
+
+namespace {
+
+using json = nlohmann::json;
+
+constexpr std::string_view STATUS_METHOD = "notify_status_update";
+constexpr std::string_view QUOTED_STATUS_METHOD = "\"notify_status_update\"";
+
+/// Moonraker sends "jsonrpc" then "method" first; leaves room for reordering
+constexpr size_t METHOD_SEARCH_WINDOW = 128;
+
+enum class ObjectKind : uint8_t {
+    OTHER,
+    TOOLHEAD,
+    GCODE_MOVE,
+    MOTION_REPORT,
+    VIRTUAL_SDCARD,
+    PRINT_STATS,
+    IDLE_TIMEOUT,
+    THERMAL,
+    FAN,
+};
+
+enum class Slot : uint8_t {
+    NONE,
+    // Positions (arrays)
+    TOOLHEAD_POSITION,
+    GCODE_POSITION,
+    LIVE_POSITION,
+    // Scalars
+    SPEED_FACTOR,
+    EXTRUDE_FACTOR,
+    LIVE_VELOCITY,
+    LIVE_EXTRUDER_VELOCITY,
+    SDCARD_PROGRESS,
+    FILE_POSITION,
+    PRINT_DURATION,
+    TOTAL_DURATION,
+    FILAMENT_USED,
+    PRINTING_TIME,
+    TEMPERATURE,
+    TARGET,
+    POWER,
+    FAN_SPEED,
+    FAN_RPM,
+};
+
+bool starts_with(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+/// "extruder", "extruder1", ... but not "extruder_stepper ..."
+bool is_extruder(std::string_view name) {
+    if (!starts_with(name, "extruder")) {
+        return false;
+    }
+    for (char c : name.substr(8)) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+ObjectKind classify_object(std::string_view name) {
+    if (name == "toolhead") {
+        return ObjectKind::TOOLHEAD;
+    }
+    if (name == "gcode_move") {
+        return ObjectKind::GCODE_MOVE;
+    }
+    if (name == "motion_report") {
+        return ObjectKind::MOTION_REPORT;
+    }
+    if (name == "virtual_sdcard") {
+        return ObjectKind::VIRTUAL_SDCARD;
+    }
+    if (name == "print_stats") {
+        return ObjectKind::PRINT_STATS;
+    }
+    if (name == "idle_timeout") {
+        return ObjectKind::IDLE_TIMEOUT;
+    }
+    // Other sensors (bme280, htu21d, ...) also report "temperature" but are
+    // read by the sensor managers from JSON, so they stay untyped
+    if (name == "heater_bed" || is_extruder(name) || starts_with(name, "heater_generic ") ||
+        starts_with(name, "temperature_sensor ") || starts_with(name, "temperature_fan ")) {
+        return ObjectKind::THERMAL;
+    }
+    // Same prefixes as PrinterFanState::update_from_status()
+    if (name == "fan" || starts_with(name, "heater_fan ") || starts_with(name, "fan_generic ") ||
+        starts_with(name, "controller_fan ")) {
+        return ObjectKind::FAN;
+    }
+    return ObjectKind::OTHER;
+}
+
+Slot slot_for(ObjectKind kind, std::string_view field) {
+    switch (kind) {
+    case ObjectKind::TOOLHEAD:
+        return field == "position" ? Slot::TOOLHEAD_POSITION : Slot::NONE;
+    case ObjectKind::GCODE_MOVE:
+        if (field == "gcode_position") {
+            return Slot::GCODE_POSITION;
+        }
+        if (field == "speed_factor") {
+            return Slot::SPEED_FACTOR;
+        }
+        return field == "extrude_factor" ? Slot::EXTRUDE_FACTOR : Slot::NONE;
+    case ObjectKind::MOTION_REPORT:
+        if (field == "live_position") {
+            return Slot::LIVE_POSITION;
+        }
+        if (field == "live_velocity") {
+            return Slot::LIVE_VELOCITY;
+        }
+        return field == "live_extruder_velocity" ? Slot::LIVE_EXTRUDER_VELOCITY : Slot::NONE;
+    case ObjectKind::VIRTUAL_SDCARD:
+        if (field == "progress") {
+            return Slot::SDCARD_PROGRESS;
+        }
+        return field == "file_position" ? Slot::FILE_POSITION : Slot::NONE;
+    case ObjectKind::PRINT_STATS:
+        if (field == "print_duration") {
+            return Slot::PRINT_DURATION;
+        }
+        if (field == "total_duration") {
+            return Slot::TOTAL_DURATION;
+        }
+        return field == "filament_used" ? Slot::FILAMENT_USED : Slot::NONE;
+    case ObjectKind::IDLE_TIMEOUT:
+        return field == "printing_time" ? Slot::PRINTING_TIME : Slot::NONE;
+    case ObjectKind::THERMAL:
+        if (field == "temperature") {
+            return Slot::TEMPERATURE;
+        }
+        if (field == "target") {
+            return Slot::TARGET;
+        }
+        return field == "power" ? Slot::POWER : Slot::NONE;
+    case ObjectKind::FAN:
+        if (field == "speed") {
+            return Slot::FAN_SPEED;
+        }
+        return field == "rpm" ? Slot::FAN_RPM : Slot::NONE;
+    case ObjectKind::OTHER:
+        break;
+    }
+    return Slot::NONE;
+}
+
+bool is_position_slot(Slot slot) {
+    return slot == Slot::TOOLHEAD_POSITION || slot == Slot::GCODE_POSITION ||
+           slot == Slot::LIVE_POSITION;
+}
+
+json position_json(const StatusPosition& position) {
+    json array = json::array();
+    for (size_t i = 0; i < position.size; ++i) {
+        array.push_back(position.values[i]);
+    }
+    return array;
+}
+
+/**
+ * @brief nlohmann SAX handler for one notify_status_update frame
+ *
+ * Tracks where in the frame it is with a small context stack. Values in typed
+ * slots are stored directly; anything else below the status object is built
+ * into StatusDelta::other the way json_sax_dom_parser would. Returning false
+ * from a callback stops the parse, which is how non-status frames bail out.
+ */
+class StatusDecoder {
+  public:
+    explicit StatusDecoder(StatusDelta& out) : out_(out) {}
+
+    [[nodiscard]] bool complete() const {
+        return method_ok_ && has_status_ && stack_.empty();
+    }
+
+    // SAX interface (nlohmann::json_sax)
+    bool null() {
+        return value(nullptr);
+    }
+    bool boolean(bool val) {
+        return value(val);
+    }
+    bool number_integer(json::number_integer_t val) {
+        return typed_number(static_cast<double>(val)) || value(val);
+    }
+    bool number_unsigned(json::number_unsigned_t val) {
+        return typed_number(static_cast<double>(val)) || value(val);
+    }
+    bool number_float(json::number_float_t val, const json::string_t& /*raw*/) {
+        return typed_number(val) || value(val);
+    }
+    bool string(json::string_t& val) {
+        return value(val);
+    }
+    bool binary(json::binary_t& /*val*/) {
+        return false; // Not produced by the JSON parser
+    }
+    bool start_object(std::size_t /*elements*/);
+    bool key(json::string_t& val);
+    bool end_object() {
+        return end_container();
+    }
+    bool start_array(std::size_t /*elements*/);
+    bool end_array() {
+        return end_container();
+    }
+    bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/,
+                     const json::exception& /*ex*/) {
+        return false;
+    }
+
+  private:
+    enum class Ctx : uint8_t {
+        FRAME,    ///< {"jsonrpc", "method", "params"}
+        PARAMS,   ///< [status, eventtime]
+        STATUS,   ///< {object name: {...}}
+        OBJECT,   ///< One Klipper object's fields
+        POSITION, ///< Array going into a StatusPosition slot
+        BUILD,    ///< Container being built into `other`
+        SKIP,     ///< Container outside the status object
+    };
+
+    bool typed_number(double val);
+    bool value(json val);
+    bool end_container();
+
+    /// Turn the POSITION being collected into a BUILD array (non-number element)
+    void spill_position();
+    /// Add a value to the innermost BUILD container and return it
+    json* place(json val);
+    void begin_build(json& target, json container);
+    void store(Slot slot, double val);
+
+    json& other_root() {
+        if (out_.other.is_null()) {
+            out_.other = json::object();
+        }
+        return out_.other;
+    }
+    json& other_object() {
+        json& object = other_root()[object_];
+        if (object.is_null()) {
+            object = json::object();
+        }
+        return object;
+    }
+    ThermalSample& thermal() {
+        if (thermal_index_ < 0) {
+            thermal_index_ = static_cast<int>(out_.thermals.size());
+            out_.thermals.emplace_back();
+            out_.thermals.back().object = object_;
+        }
+        return out_.thermals[static_cast<size_t>(thermal_index_)];
+    }
+    FanSample& fan() {
+        if (fan_index_ < 0) {
+            fan_index_ = static_cast<int>(out_.fans.size());
+            out_.fans.emplace_back();
+            out_.fans.back().object = object_;
+        }
+        return out_.fans[static_cast<size_t>(fan_index_)];
+    }
+
+    StatusDelta& out_;
+    std::vector<Ctx> stack_;
+    std::vector<json*> build_stack_;
+
+    std::string key_;    ///< Last key seen at any level
+    std::string object_; ///< Klipper object being decoded
+    ObjectKind kind_ = ObjectKind::OTHER;
+    size_t object_values_ = 0; ///< Fields of object_ seen so far
+    int thermal_index_ = -1;
+    int fan_index_ = -1;
+
+    Slot position_slot_ = Slot::NONE;
+    StatusPosition position_;
+
+    size_t params_index_ = 0;
+    bool method_ok_ = false;
+    bool has_status_ = false;
+};
+
+bool StatusDecoder::typed_number(double val) {
+    if (stack_.empty()) {
+        return false;
+    }
+    switch (stack_.back()) {
+    case Ctx::OBJECT: {
+        Slot slot = slot_for(kind_, key_);
+        if (slot == Slot::NONE || is_position_slot(slot)) {
+            return false;
+        }
+        store(slot, val);
+        ++object_values_;
+        return true;
+    }
+    case Ctx::POSITION:
+        if (position_.size >= position_.values.size()) {
+            return false; // Longer than expected: keep it as JSON
+        }
+        position_.values[position_.size++] = val;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool StatusDecoder::value(json val) {
+    if (stack_.empty()) {
+        return false; // Frame is not an object
+    }
+    switch (stack_.back()) {
+    case Ctx::FRAME:
+        if (key_ == "method") {
+            method_ok_ =
+                val.is_string() && val.get_ref<const std::string&>() == STATUS_METHOD;
+            return method_ok_;
+        }
+        return key_ != "params";
+    case Ctx::PARAMS: {
+        size_t index = params_index_++;
+        if (index == 0) {
+            return false; // Status is not an object
+        }
+        if (index == 1 && val.is_number()) {
+            out_.eventtime = val.get<double>();
+        }
+        return true;
+    }
+    case Ctx::STATUS:
+        other_root()[key_] = std::move(val);
+        return true;
+    case Ctx::OBJECT:
+        other_object()[key_] = std::move(val);
+        ++object_values_;
+        return true;
+    case Ctx::POSITION:
+        spill_position();
+        place(std::move(val));
+        return true;
+    case Ctx::BUILD:
+        place(std::move(val));
+        return true;
+    case Ctx::SKIP:
+        return true;
+    }
+    return false;
+}
+
+bool StatusDecoder::key(json::string_t& val) {
+    if (!stack_.empty() && stack_.back() == Ctx::FRAME && val == "id") {
+        return false; // A response, not a notification
+    }
+    key_ = val;
+    return true;
+}
+
+bool StatusDecoder::start_object(std::size_t /*elements*/) {
+    if (stack_.empty()) {
+        stack_.push_back(Ctx::FRAME);
+        return true;
+    }
+    switch (stack_.back()) {
+    case Ctx::FRAME:
+        if (key_ == "params") {
+            return false;
+        }
+        stack_.push_back(Ctx::SKIP);
+        return true;
+    case Ctx::PARAMS:
+        if (params_index_++ != 0) {
+            stack_.push_back(Ctx::SKIP);
+            return true;
+        }
+        has_status_ = true;
+        stack_.push_back(Ctx::STATUS);
+        return true;
+    case Ctx::STATUS:
+        object_ = key_;
+        kind_ = classify_object(object_);
+        object_values_ = 0;
+        thermal_index_ = -1;
+        fan_index_ = -1;
+        stack_.push_back(Ctx::OBJECT);
+        return true;
+    case Ctx::OBJECT:
+        ++object_values_;
+        begin_build(other_object()[key_], json::object());
+        return true;
+    case Ctx::POSITION:
+        spill_position();
+        [[fallthrough]];
+    case Ctx::BUILD: {
+        json* container = place(json::object());
+        build_stack_.push_back(container);
+        stack_.push_back(Ctx::BUILD);
+        return true;
+    }
+    case Ctx::SKIP:
+        stack_.push_back(Ctx::SKIP);
+        return true;
+    }
+    return false;
+}
+
+bool StatusDecoder::start_array(std::size_t /*elements*/) {
+    if (stack_.empty()) {
+        return false;
+    }
+    switch (stack_.back()) {
+    case Ctx::FRAME:
+        if (key_ == "params") {
+            params_index_ = 0;
+            stack_.push_back(Ctx::PARAMS);
+        } else {
+            stack_.push_back(Ctx::SKIP);
+        }
+        return true;
+    case Ctx::PARAMS:
+        if (params_index_++ == 0) {
+            return false;
+        }
+        stack_.push_back(Ctx::SKIP);
+        return true;
+    case Ctx::STATUS:
+        begin_build(other_root()[key_], json::array());
+        return true;
+    case Ctx::OBJECT: {
+        ++object_values_;
+        Slot slot = slot_for(kind_, key_);
+        if (is_position_slot(slot)) {
+            position_slot_ = slot;
+            position_ = {};
+            stack_.push_back(Ctx::POSITION);
+        } else {
+            begin_build(other_object()[key_], json::array());
+        }
+        return true;
+    }
+    case Ctx::POSITION:
+        spill_position();
+        [[fallthrough]];
+    case Ctx::BUILD: {
+        json* container = place(json::array());
+        build_stack_.push_back(container);
+        stack_.push_back(Ctx::BUILD);
+        return true;
+    }
+    case Ctx::SKIP:
+        stack_.push_back(Ctx::SKIP);
+        return true;
+    }
+    return false;
+}
+
+bool StatusDecoder::end_container() {
+    if (stack_.empty()) {
+        return false;
+    }
+    Ctx ctx = stack_.back();
+    stack_.pop_back();
+
+    switch (ctx) {
+    case Ctx::BUILD:
+        build_stack_.pop_back();
+        break;
+    case Ctx::POSITION:
+        switch (position_slot_) {
+        case Slot::TOOLHEAD_POSITION:
+            out_.toolhead_position = position_;
+            out_.fields |= StatusDelta::TOOLHEAD_POSITION;
+            break;
+        case Slot::GCODE_POSITION:
+            out_.gcode_position = position_;
+            out_.fields |= StatusDelta::GCODE_POSITION;
+            break;
+        case Slot::LIVE_POSITION:
+            out_.live_position = position_;
+            out_.fields |= StatusDelta::LIVE_POSITION;
+            break;
+        default:
+            break;
+        }
+        break;
+    case Ctx::OBJECT:
+        if (object_values_ == 0) {
+            other_object(); // Keep empty objects so the shape round-trips
+        }
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+void StatusDecoder::spill_position() {
+    json& target = other_object()[key_];
+    target = position_json(position_);
+    stack_.back() = Ctx::BUILD;
+    build_stack_.push_back(&target);
+}
+
+json* StatusDecoder::place(json val) {
+    json* parent = build_stack_.back();
+    if (parent->is_object()) {
+        json& slot = (*parent)[key_];
+        slot = std::move(val);
+        return &slot;
+    }
+    parent->push_back(std::move(val));
+    return &parent->back();
+}
+
+void StatusDecoder::begin_build(json& target, json container) {
+    target = std::move(container);
+    build_stack_.push_back(&target);
+    stack_.push_back(Ctx::BUILD);
+}
+
+void StatusDecoder::store(Slot slot, double val) {
+    switch (slot) {
+    case Slot::SPEED_FACTOR:
+        out_.speed_factor = val;
+        out_.fields |= StatusDelta::SPEED_FACTOR;
+        break;
+    case Slot::EXTRUDE_FACTOR:
+        out_.extrude_factor = val;
+        out_.fields |= StatusDelta::EXTRUDE_FACTOR;
+        break;
+    case Slot::LIVE_VELOCITY:
+        out_.live_velocity = val;
+        out_.fields |= StatusDelta::LIVE_VELOCITY;
+        break;
+    case Slot::LIVE_EXTRUDER_VELOCITY:
+        out_.live_extruder_velocity = val;
+        out_.fields |= StatusDelta::LIVE_EXTRUDER_VELOCITY;
+        break;
+    case Slot::SDCARD_PROGRESS:
+        out_.sdcard_progress = val;
+        out_.fields |= StatusDelta::SDCARD_PROGRESS;
+        break;
+    case Slot::FILE_POSITION:
+        out_.file_position = val;
+        out_.fields |= StatusDelta::FILE_POSITION;
+        break;
+    case Slot::PRINT_DURATION:
+        out_.print_duration = val;
+        out_.fields |= StatusDelta::PRINT_DURATION;
+        break;
+    case Slot::TOTAL_DURATION:
+        out_.total_duration = val;
+        out_.fields |= StatusDelta::TOTAL_DURATION;
+        break;
+    case Slot::FILAMENT_USED:
+        out_.filament_used = val;
+        out_.fields |= StatusDelta::FILAMENT_USED;
+        break;
+    case Slot::PRINTING_TIME:
+        out_.printing_time = val;
+        out_.fields |= StatusDelta::PRINTING_TIME;
+        break;
+    case Slot::TEMPERATURE: {
+        ThermalSample& sample = thermal();
+        sample.temperature = val;
+        sample.fields |= ThermalSample::TEMPERATURE;
+        break;
+    }
+    case Slot::TARGET: {
+        ThermalSample& sample = thermal();
+        sample.target = val;
+        sample.fields |= ThermalSample::TARGET;
+        break;
+    }
+    case Slot::POWER: {
+        ThermalSample& sample = thermal();
+        sample.power = val;
+        sample.fields |= ThermalSample::POWER;
+        break;
+    }
+    case Slot::FAN_SPEED: {
+        FanSample& sample = fan();
+        sample.speed = val;
+        sample.fields |= FanSample::SPEED;
+        break;
+    }
+    case Slot::FAN_RPM: {
+        FanSample& sample = fan();
+        sample.rpm = val;
+        sample.fields |= FanSample::RPM;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// StatusDelta
+// ============================================================================
+
+const ThermalSample* StatusDelta::find_thermal(std::string_view object) const {
+    for (const auto& sample : thermals) {
+        if (sample.object == object) {
+            return &sample;
+        }
+    }
+    return nullptr;
+}
+
+json StatusDelta::to_status_json() const {
+    json status = other.is_object() ? other : json::object();
+
+    auto set_scalar = [this, &status](Field field, const char* object, const char* key,
+                                      double val) {
+        if (has(field)) {
+            status[object][key] = val;
+        }
+    };
+    auto set_position = [this, &status](Field field, const char* object, const char* key,
+                                        const StatusPosition& position) {
+        if (has(field)) {
+            status[object][key] = position_json(position);
+        }
+    };
+
+    set_position(TOOLHEAD_POSITION, "toolhead", "position", toolhead_position);
+    set_position(GCODE_POSITION, "gcode_move", "gcode_position", gcode_position);
+    set_scalar(SPEED_FACTOR, "gcode_move", "speed_factor", speed_factor);
+    set_scalar(EXTRUDE_FACTOR, "gcode_move", "extrude_factor", extrude_factor);
+    set_position(LIVE_POSITION, "motion_report", "live_position", live_position);
+    set_scalar(LIVE_VELOCITY, "motion_report", "live_velocity", live_velocity);
+    set_scalar(LIVE_EXTRUDER_VELOCITY, "motion_report", "live_extruder_velocity",
+               live_extruder_velocity);
+    set_scalar(SDCARD_PROGRESS, "virtual_sdcard", "progress", sdcard_progress);
+    set_scalar(FILE_POSITION, "virtual_sdcard", "file_position", file_position);
+    set_scalar(PRINT_DURATION, "print_stats", "print_duration", print_duration);
+    set_scalar(TOTAL_DURATION, "print_stats", "total_duration", total_duration);
+    set_scalar(FILAMENT_USED, "print_stats", "filament_used", filament_used);
+    set_scalar(PRINTING_TIME, "idle_timeout", "printing_time", printing_time);
+
+    for (const auto& sample : thermals) {
+        json& object = status[sample.object];
+        if (sample.has(ThermalSample::TEMPERATURE)) {
+            object["temperature"] = sample.temperature;
+        }
+        if (sample.has(ThermalSample::TARGET)) {
+            object["target"] = sample.target;
+        }
+        if (sample.has(ThermalSample::POWER)) {
+            object["power"] = sample.power;
+        }
+    }
+    for (const auto& sample : fans) {
+        json& object = status[sample.object];
+        if (sample.has(FanSample::SPEED)) {
+            object["speed"] = sample.speed;
+        }
+        if (sample.has(FanSample::RPM)) {
+            object["rpm"] = sample.rpm;
+        }
+    }
+    return status;
+}
+
+json StatusDelta::to_notification_json() const {
+    return {{"method", "notify_status_update"},
+            {"params", json::array({to_status_json(), eventtime})}};
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+bool decode_status_notification(std::string_view frame, StatusDelta& out) {
+    std::string_view head = frame.substr(0, METHOD_SEARCH_WINDOW);
+    if (head.find(QUOTED_STATUS_METHOD) == std::string_view::npos) {
+        return false;
+    }
+
+    StatusDecoder decoder(out);
+    bool parsed = json::sax_parse(frame.data(), frame.data() + frame.size(), &decoder);
+    return parsed && decoder.complete();
+}
+
+} // namespace helix
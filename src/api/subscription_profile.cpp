@@ -0,0 +1,118 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file subscription_profile.cpp
+ * @brief Subscription profiles and status traffic accounting
+ */
+
+#include "subscription_profile.h"
+
+#include <algorithm>
+
+namespace helix {
+
+// ============================================================================
+// SubscriptionProfile
+// ============================================================================
+
+void SubscriptionProfile::add(const std::string& object, const std::vector<std::string>& fields) {
+    auto [it, inserted] = objects.emplace(object, fields);
+    auto& current = it->second;
+    if (inserted) {
+        std::sort(current.begin(), current.end());
+        current.erase(std::unique(current.begin(), current.end()), current.end());
+        return;
+    }
+
+    // Either side subscribing to all fields wins
+    if (current.empty() || fields.empty()) {
+        current.clear();
+        return;
+    }
+    current.insert(current.end(), fields.begin(), fields.end());
+    std::sort(current.begin(), current.end());
+    current.erase(std::unique(current.begin(), current.end()), current.end());
+}
+
+nlohmann::json SubscriptionProfile::to_objects_json() const {
+    nlohmann::json result = nlohmann::json::object();
+    for (const auto& [object, fields] : objects) {
+        if (fields.empty()) {
+            result[object] = nullptr;
+        } else {
+            result[object] = fields;
+        }
+    }
+    return result;
+}
+
+// ============================================================================
+// SubscriptionManager
+// ============================================================================
+
+void SubscriptionManager::set_base(SubscriptionProfile base) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    base_ = std::move(base);
+    has_base_ = true;
+    close_traffic_period_locked();
+}
+
+void SubscriptionManager::clear_base() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    has_base_ = false;
+    base_ = {};
+    close_traffic_period_locked();
+}
+
+nlohmann::json SubscriptionManager::objects() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return base_.to_objects_json();
+}
+
+std::string SubscriptionManager::profile_name() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return profile_name_locked();
+}
+
+void SubscriptionManager::record_update(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (traffic_profile_.empty()) {
+        traffic_profile_ = profile_name_locked();
+    }
+    auto& traffic = traffic_[traffic_profile_];
+    traffic.messages++;
+    traffic.bytes += bytes;
+}
+
+std::vector<SubscriptionTraffic> SubscriptionManager::take_traffic() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    close_traffic_period_locked();
+
+    std::vector<SubscriptionTraffic> result;
+    result.reserve(traffic_.size());
+    for (auto& [name, traffic] : traffic_) {
+        traffic.profile = name;
+        result.push_back(traffic);
+    }
+    traffic_.clear();
+    return result;
+}
+
+std::string SubscriptionManager::profile_name_locked() const {
+    return has_base_ ? "base" : "none";
+}
+
+/// Call after the profile changed: credits the elapsed time to the
+/// previous profile and starts counting for the current one
+void SubscriptionManager::close_traffic_period_locked() {
+    auto now = Clock::now();
+    if (!traffic_profile_.empty()) {
+        traffic_[traffic_profile_].seconds +=
+            std::chrono::duration<double>(now - traffic_since_).count();
+    }
+    traffic_profile_ = profile_name_locked();
+    traffic_since_ = now;
+}
+
+} // namespace helix
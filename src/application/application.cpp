@@ -100,13 +100,12 @@
 #include "app_globals.h"
 #include "async_helpers.h"
 #include "filament_sensor_manager.h"
+#include "gcode_analysis_service.h"
 #include "gcode_file_modifier.h"
 #include "hv/hlog.h" // libhv logging - sync level with spdlog
+#include "language_packs.h"
 #include "logging_init.h"
-#include "lv_i18n_translations.h"
-#include "lvgl/src/others/translation/lv_translation.h"
 #include "lvgl/src/xml/lv_xml.h"
-#include "lvgl/src/xml/lv_xml_translation.h"
 #include "lvgl_log_handler.h"
 #include "memory_monitor.h"
 #include "memory_profiling.h"
@@ -116,6 +115,7 @@
 #include "plugin_manager.h"
 #include "printer_discovery.h"
 #include "printer_state.h"
+#include "scoped_trace.h"
 #include "settings_manager.h"
 #include "splash_screen.h"
 #include "standard_macros.h"
@@ -128,7 +128,9 @@
 #include <SDL.h>
 #endif
 
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -172,6 +174,7 @@ Application::~Application() {
 int Application::run(int argc, char** argv) {
     // Initialize minimal logging first so early log calls don't crash
     helix::logging::init_early();
+    uint32_t startup_start_ms = DisplayManager::get_ticks();
 
     // Set libhv log level to WARN immediately - before ANY libhv usage
     // libhv's DEFAULT_LOG_LEVEL is INFO, which causes unwanted output on first start
@@ -200,6 +203,9 @@ int Application::run(int argc, char** argv) {
         return 1;
     }
 
+    // Scoped tracing: --trace records from here, SIGUSR2 toggles/dumps at runtime
+    helix::trace::init(m_args.trace, m_args.trace_path);
+
     spdlog::info("[Application] ========================");
     spdlog::debug("[Application] Target: {}x{}", m_screen_width, m_screen_height);
     spdlog::debug("[Application] DPI: {}{}", (m_args.dpi > 0 ? m_args.dpi : LV_DPI_DEF),
@@ -307,6 +313,16 @@ int Application::run(int argc, char** argv) {
     // Phase 16: Start memory monitoring (logs at TRACE level, -vvv)
     helix::MemoryMonitor::instance().start(5000);
 
+    // Phase 16a: Evict cold overlays under memory pressure. Evictable overlays
+    // (OverlayBase::is_evictable) are rebuilt from XML on next navigation, so on
+    // low-RAM devices rarely used screens don't pin their widget trees forever.
+    static auto evict_cold_overlays_cb = [](lv_timer_t*) {
+        if (helix::get_system_memory_info().is_low_memory()) {
+            NavigationManager::instance().evict_cold_overlays(60000);
+        }
+    };
+    m_evict_overlays_timer = lv_timer_create(evict_cold_overlays_cb, 30000, nullptr);
+
     // Phase 16b: Force full screen refresh
     // On framebuffer displays with PARTIAL render mode, some widgets may not paint
     // on the first frame. Schedule a deferred refresh after the first few frames
@@ -314,6 +330,8 @@ int Application::run(int argc, char** argv) {
     lv_obj_update_layout(m_screen);
     invalidate_all_recursive(m_screen);
     lv_refr_now(nullptr);
+    spdlog::info("[Application] First frame rendered {}ms after startup",
+                 DisplayManager::get_ticks() - startup_start_ms);
 
     // Deferred refresh: Some widgets (nav icons, printer image) may not have their
     // content fully set until after the first frame. Schedule a second refresh.
@@ -477,6 +495,14 @@ bool Application::init_logging() {
         log_config.file_path = m_config->get<std::string>("/log_path", "");
     }
 
+    // Async output (console/journal/file on a writer thread) and the
+    // crash-surviving flight recorder (trace-level ring in /dev/shm)
+    log_config.async = m_config->get<bool>("/log_async", false);
+    log_config.flight_recorder_kb =
+        static_cast<size_t>(std::max(m_config->get<int>("/log_recorder_kb", 64), 0));
+    log_config.flight_recorder_level = parse_level(
+        m_config->get<std::string>("/log_recorder_level", "trace"), spdlog::level::trace);
+
     init(log_config);
 
     // Set libhv log level from config (CLI -v flags don't affect libhv)
@@ -511,6 +537,7 @@ bool Application::init_display() {
     // Get scroll config from helixconfig.json
     config.scroll_throw = m_config->get<int>("/input/scroll_throw", 25);
     config.scroll_limit = m_config->get<int>("/input/scroll_limit", 5);
+    config.settings = m_config;
 
     if (!m_display->init(config)) {
         spdlog::error("[Application] Display initialization failed");
@@ -561,7 +588,7 @@ bool Application::init_theme() {
 
     // Register globals.xml first (required for theme constants)
     // Note: fonts must be registered before this (done in init_assets phase)
-    lv_xml_register_component_from_file("A:ui_xml/globals.xml");
+    helix::register_xml_component("A:ui_xml/globals.xml");
 
     // Initialize theme
     theme_manager_init(m_display->display(), dark_mode);
@@ -622,33 +649,16 @@ bool Application::register_xml_components() {
 }
 
 bool Application::init_translations() {
-    // Load translation strings from XML (for LVGL's native translation system)
-    // This must happen before UI creation but after the XML system is initialized
-    lv_result_t result =
-        lv_xml_register_translation_from_file("A:ui_xml/translations/translations.xml");
-    if (result != LV_RESULT_OK) {
-        spdlog::warn(
-            "[Application] Failed to load LVGL translations - UI will use English defaults");
-        // Not fatal - English will work via fallback (tag = English text)
-    } else {
-        spdlog::info("[Application] LVGL translations loaded successfully");
-    }
-
-    // Initialize lv_i18n translation system (for plural forms and runtime lookups)
-    int i18n_result = lv_i18n_init(lv_i18n_language_pack);
-    if (i18n_result != 0) {
-        spdlog::warn(
-            "[Application] Failed to initialize lv_i18n - plural translations unavailable");
+    // Map only the configured language's catalog (falls back to translations.xml
+    // in source-tree runs). Must happen before UI creation but after the XML
+    // system is initialized. Not fatal - English works via tag fallback.
+    std::string lang = m_config->get_language();
+    if (!helix::LanguagePacks::instance().set_language(lang)) {
+        spdlog::warn("[Application] No translations for '{}' - UI will use English", lang);
     } else {
-        spdlog::info("[Application] lv_i18n initialized successfully");
+        spdlog::info("[Application] Language set to '{}'", lang);
     }
 
-    // Set initial language from config (sync both systems)
-    std::string lang = m_config->get_language();
-    lv_translation_set_language(lang.c_str());
-    lv_i18n_set_locale(lang.c_str());
-    spdlog::info("[Application] Language set to '{}' (both translation systems)", lang);
-
     return true;
 }
 
@@ -693,6 +703,29 @@ bool Application::init_panel_subjects() {
     set_temperature_history_manager(m_temp_history_manager.get());
     spdlog::debug("[Application] TemperatureHistoryManager created");
 
+    // Restore temperature graphs across reboots (skipped in test mode so mock
+    // data never leaks into a real printer's history)
+    if (!get_runtime_config()->is_test_mode()) {
+        std::string cache_dir = get_helix_cache_dir("temp_history");
+        if (!cache_dir.empty()) {
+            m_temp_history_snapshot_path = cache_dir + "/history.bin";
+            int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+            m_temp_history_manager->load_snapshot(m_temp_history_snapshot_path, now_ms);
+
+            // Every 5 minutes: worst case a reboot loses 5 minutes of graph, and
+            // SD/flash writes stay modest
+            static auto save_temp_history_cb = [](lv_timer_t* timer) {
+                auto* app = static_cast<Application*>(lv_timer_get_user_data(timer));
+                if (app->m_temp_history_manager) {
+                    app->m_temp_history_manager->save_snapshot(app->m_temp_history_snapshot_path);
+                }
+            };
+            lv_timer_create(save_temp_history_cb, 5 * 60 * 1000, this);
+        }
+    }
+
     spdlog::debug("[Application] Panel subjects initialized");
     helix::MemoryMonitor::log_now("after_panel_subjects_init");
     return true;
@@ -807,6 +840,20 @@ bool Application::init_moonraker() {
     set_print_history_manager(m_history_manager.get());
     spdlog::debug("[Application] PrintHistoryManager created");
 
+    // Persist print history so restarts only download jobs newer than the cache
+    // (skipped in test mode so mock jobs never leak into a real printer's history)
+    if (!get_runtime_config()->is_test_mode()) {
+        std::string cache_dir = get_helix_cache_dir("print_history");
+        if (!cache_dir.empty()) {
+            std::string source =
+                !m_args.moonraker_url.empty()
+                    ? m_args.moonraker_url
+                    : m_config->get<std::string>(m_config->df() + "moonraker_host", "") + ":" +
+                          std::to_string(m_config->get<int>(m_config->df() + "moonraker_port", 0));
+            m_history_manager->set_cache_file(cache_dir + "/jobs.json", source);
+        }
+    }
+
     // Initialize macro modification manager (for PRINT_START wizard)
     m_moonraker->init_macro_analysis(m_config);
 
@@ -924,6 +971,10 @@ bool Application::run_wizard() {
 
     spdlog::info("[Application] Starting first-run wizard");
 
+    // Wizard subjects are only needed on first run, so they are created here
+    // rather than in SubjectInitializer
+    ui_wizard_init_subjects();
+    StaticPanelRegistry::instance().register_destroy("WizardSubjects", ui_wizard_deinit_subjects);
     ui_wizard_register_event_callbacks();
     ui_wizard_container_register_responsive_constants();
 
@@ -1060,7 +1111,9 @@ void Application::create_overlays() {
 
     if (m_args.overlays.zoffset) {
         auto& overlay = get_global_zoffset_cal_panel();
-        // init_subjects already called by SubjectInitializer
+        if (!overlay.are_subjects_initialized()) {
+            overlay.init_subjects();
+        }
         overlay.set_client(m_moonraker->client());
         if (overlay.create(m_screen)) {
             overlay.show();
@@ -1069,7 +1122,9 @@ void Application::create_overlays() {
 
     if (m_args.overlays.pid) {
         auto& overlay = get_global_pid_cal_panel();
-        // init_subjects already called by SubjectInitializer
+        if (!overlay.are_subjects_initialized()) {
+            overlay.init_subjects();
+        }
         overlay.set_client(m_moonraker->client());
         if (overlay.create(m_screen)) {
             overlay.show();
@@ -1087,6 +1142,9 @@ void Application::create_overlays() {
 
     if (m_args.overlays.input_shaper) {
         auto& panel = get_global_input_shaper_panel();
+        if (!panel.are_subjects_initialized()) {
+            panel.init_subjects();
+        }
         panel.set_api(m_moonraker->client(), m_moonraker->api());
         if (panel.create(m_screen)) {
             panel.show();
@@ -1340,6 +1398,22 @@ bool Application::connect_moonraker() {
 
             get_printer_state().set_hardware(c->hardware);
             get_printer_state().init_fans(c->hardware.fans());
+
+            // Record history for every heater and temperature sensor, not just extruder/bed
+            if (c->app->m_temp_history_manager) {
+                std::vector<std::string> temp_objects = c->hardware.heaters();
+                const auto& sensors = c->hardware.sensors();
+                temp_objects.insert(temp_objects.end(), sensors.begin(), sensors.end());
+                c->app->m_temp_history_manager->set_tracked_sensors(temp_objects);
+            }
+
+            // Catch up on jobs that finished or were deleted while disconnected
+            if (c->app->m_history_manager) {
+                c->app->m_history_manager->request_full_sync();
+                if (c->app->m_history_manager->is_loaded()) {
+                    c->app->m_history_manager->fetch();
+                }
+            }
             get_printer_state().set_klipper_version(c->hardware.software_version());
             get_printer_state().set_moonraker_version(c->hardware.moonraker_version());
 
@@ -1527,6 +1601,9 @@ int Application::main_loop() {
 
     // Main event loop
     while (lv_display_get_next(nullptr) && !app_quit_requested()) {
+        helix::trace::poll();
+        helix::trace::Scope frame_scope("main", "frame");
+
         uint32_t current_tick = DisplayManager::get_ticks();
         m_loop_handler.on_frame(current_tick);
 
@@ -1554,7 +1631,10 @@ int Application::main_loop() {
         m_display->check_display_sleep();
 
         // Run LVGL tasks
-        lv_timer_handler();
+        {
+            HELIX_TRACE_SCOPE("lvgl", "lv_timer_handler");
+            lv_timer_handler();
+        }
         fflush(stdout);
 
         // Signal splash to exit after first frame is rendered
@@ -1579,9 +1659,18 @@ int Application::main_loop() {
             if (m_loop_handler.benchmark_should_report()) {
                 auto report = m_loop_handler.benchmark_get_report();
                 spdlog::info("[Application] Benchmark FPS: {:.1f}", report.fps);
+                if (auto* client = get_moonraker_client()) {
+                    for (const auto& traffic : client->subscriptions().take_traffic()) {
+                        spdlog::info("[Application] Benchmark status traffic ({}): {:.1f} msg/s, "
+                                     "{:.0f} B/s",
+                                     traffic.profile, traffic.messages_per_sec(),
+                                     traffic.bytes_per_sec());
+                    }
+                }
             }
         }
 
+        frame_scope.end();
         DisplayManager::delay(5);
     }
 
@@ -1656,6 +1745,7 @@ void Application::handle_keyboard_shortcuts() {
 }
 
 void Application::process_notifications() {
+    HELIX_TRACE_SCOPE("main", "process_notifications");
     if (m_moonraker) {
         m_moonraker->process_notifications();
     }
@@ -1664,6 +1754,7 @@ void Application::process_notifications() {
 void Application::check_timeouts() {
     uint32_t current_time = DisplayManager::get_ticks();
     if (current_time - m_last_timeout_check >= m_timeout_check_interval) {
+        HELIX_TRACE_SCOPE("main", "process_timeouts");
         if (m_moonraker) {
             m_moonraker->process_timeouts();
         }
@@ -1681,8 +1772,18 @@ void Application::shutdown() {
     // Stop memory monitor first
     helix::MemoryMonitor::instance().stop();
 
+    // Stop evicting overlays before navigation and panels are torn down
+    if (m_evict_overlays_timer) {
+        lv_timer_delete(m_evict_overlays_timer);
+        m_evict_overlays_timer = nullptr;
+    }
+
     spdlog::info("[Application] Shutting down...");
 
+    // Abandon G-code analysis while panels and the UI queue its callbacks
+    // post to still exist (static destruction would join it far too late)
+    helix::gcode::GCodeAnalysisService::instance().shutdown();
+
     // Clear app_globals references BEFORE destroying managers to prevent
     // destructors (e.g., PrintSelectPanel) from accessing destroyed objects
     set_moonraker_manager(nullptr);
@@ -1703,6 +1804,9 @@ void Application::shutdown() {
     // Reset managers in reverse order (MoonrakerManager handles print_start_collector cleanup)
     // History manager MUST be reset before moonraker (uses client for unregistration)
     m_history_manager.reset();
+    if (m_temp_history_manager && !m_temp_history_snapshot_path.empty()) {
+        m_temp_history_manager->save_snapshot(m_temp_history_snapshot_path);
+    }
     m_temp_history_manager.reset();
 
     // Unregister action prompt callback before moonraker is destroyed
@@ -1741,4 +1845,8 @@ void Application::shutdown() {
     m_display.reset();
 
     spdlog::info("[Application] Shutdown complete");
+
+    // Write the trace (if recording) and drain the async log writer before exit
+    helix::trace::shutdown();
+    helix::logging::shutdown();
 }
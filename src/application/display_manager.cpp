@@ -17,11 +17,17 @@
 #include "ui_update_queue.h"
 
 #include "config.h"
+#include "platform_capabilities.h"
+#include "render_profile.h"
 #include "settings_manager.h"
 
+#include "lvgl/src/core/lv_global.h"        // For the draw unit list
+#include "lvgl/src/draw/lv_draw_private.h" // For lv_draw_unit_t internals
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cstring>
 
 #ifdef HELIX_DISPLAY_SDL
 #include "app_globals.h" // For app_request_quit()
@@ -65,6 +71,60 @@ static int sdl_event_filter(void* /*userdata*/, SDL_Event* event) {
 }
 #endif
 
+/// Dispatch for a parked draw unit: never takes a task
+static int32_t parked_draw_unit_dispatch(lv_draw_unit_t* /*draw_unit*/, lv_layer_t* /*layer*/) {
+    return LV_DRAW_UNIT_IDLE;
+}
+
+/**
+ * @brief Keep only @p units software draw units taking tasks
+ *
+ * lv_init() creates LV_DRAW_SW_DRAW_UNIT_CNT software units, each with its own
+ * render thread. Units above the limit get a dispatch that never hands them a
+ * task, so their threads stay blocked until lv_deinit() deletes them.
+ *
+ * @return Software draw units left active
+ */
+static int limit_sw_draw_units(int units) {
+    int active = 0;
+    for (lv_draw_unit_t* u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) {
+        if (!u->name || std::strcmp(u->name, "SW") != 0) {
+            continue; // GPU units are not part of the profile
+        }
+        if (active < units) {
+            active++;
+        } else {
+            u->dispatch_cb = parked_draw_unit_dispatch;
+        }
+    }
+    return active;
+}
+
+/**
+ * @brief Pick this device's render profile and apply it
+ *
+ * Must run right after lv_init(), before anything renders. The profile's draw
+ * unit count is clamped to the build-time ceiling in lv_conf.h
+ * (HELIX_DRAW_SW_UNITS) and the units above it are parked.
+ *
+ * @param settings Config holding the saved profile (null: calibrate without saving)
+ */
+static void apply_render_profile(Config* settings) {
+    helix::RenderProfile profile =
+        helix::select_render_profile(helix::PlatformCapabilities::detect(), settings);
+
+    profile.clamp_draw_units(LV_DRAW_SW_DRAW_UNIT_CNT);
+    int draw_units = limit_sw_draw_units(profile.draw_units);
+
+    lv_image_cache_resize(static_cast<uint32_t>(profile.image_cache_bytes), false);
+    lv_image_header_cache_resize(profile.image_header_cache_count, false);
+
+    spdlog::info("[DisplayManager] Render profile: {} of {} draw units, {} KB image cache, "
+                 "{} header cache entries",
+                 draw_units, LV_DRAW_SW_DRAW_UNIT_CNT, profile.image_cache_bytes / 1024,
+                 profile.image_header_cache_count);
+}
+
 DisplayManager::DisplayManager() = default;
 
 DisplayManager::~DisplayManager() {
@@ -80,6 +140,9 @@ bool DisplayManager::init(const Config& config) {
     // Initialize LVGL library
     lv_init();
 
+    // Size LVGL's caches for this device (first boot runs a short calibration)
+    apply_render_profile(config.settings);
+
     // Create display backend (auto-detects: DRM → framebuffer → SDL)
     m_backend = DisplayBackend::create_auto();
     if (!m_backend) {
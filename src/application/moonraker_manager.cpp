@@ -23,6 +23,7 @@
 #include "app_constants.h"
 #include "app_globals.h"
 #include "config.h"
+#include "gcode_analysis_service.h"
 #include "macro_modification_manager.h"
 #include "moonraker_api.h"
 #include "moonraker_api_mock.h"
@@ -33,10 +34,12 @@
 #include "printer_state.h"
 #include "settings_manager.h"
 #include "sound_manager.h"
+#include "temperature_history_manager.h"
 #include "wizard_config_paths.h"
 
 #include <spdlog/spdlog.h>
 
+#include <chrono>
 #include <cstdlib>
 
 MoonrakerManager::MoonrakerManager() : m_startup_time(std::chrono::steady_clock::now()) {}
@@ -166,6 +169,18 @@ int MoonrakerManager::connect(const std::string& websocket_url, const std::strin
                                          err.message);
                             // Panels will use their default values (170°C)
                         });
+
+                    // Print time estimates are cached, so plan them with the
+                    // configured limits rather than the live M204 values
+                    api->get_configured_machine_limits(
+                        [](const MachineLimits& limits) {
+                            helix::gcode::GCodeAnalysisService::instance().set_machine_limits(
+                                limits);
+                        },
+                        [](const MoonrakerError& err) {
+                            spdlog::warn("[MoonrakerManager] Failed to fetch configured limits: {}",
+                                         err.message);
+                        });
                 }
 
                 // Trigger macro analysis after discovery
@@ -184,11 +199,12 @@ void MoonrakerManager::process_notifications() {
     std::lock_guard<std::mutex> lock(m_notification_mutex);
 
     while (!m_notification_queue.empty()) {
-        json notification = m_notification_queue.front();
+        QueuedNotification queued = std::move(m_notification_queue.front());
         m_notification_queue.pop();
 
         // Check for connection state change (queued from state_change_callback)
-        if (notification.contains("_connection_state")) {
+        if (!queued.status) {
+            const json& notification = queued.connection_state;
             int new_state = notification["new_state"].get<int>();
             static const char* messages[] = {
                 "Disconnected",     // DISCONNECTED
@@ -220,8 +236,17 @@ void MoonrakerManager::process_notifications() {
                 }
             }
         } else {
-            // Regular Moonraker notification
-            get_printer_state().update_from_notification(notification);
+            // Status update; only the shared delta is handed on, no JSON copies
+            get_printer_state().update_from_status_delta(queued.status);
+
+            // Temperature history for heaters/sensors beyond extruder and bed
+            auto* temp_history = get_temperature_history_manager();
+            if (temp_history) {
+                int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count();
+                temp_history->update_from_delta(*queued.status, now_ms);
+            }
         }
     }
 }
@@ -249,6 +274,11 @@ void MoonrakerManager::create_client(const RuntimeConfig& runtime_config) {
     } else {
         spdlog::debug("[MoonrakerManager] Creating REAL client");
         m_client = std::make_unique<MoonrakerClient>();
+
+        // Capture live traffic for replay benchmarks (tests/mocks/moonraker_replay_server.h)
+        if (const char* record_path = std::getenv("HELIX_RECORD_TRAFFIC")) {
+            m_client->start_traffic_recording(record_path);
+        }
     }
 
     // Register with app_globals
@@ -348,17 +378,18 @@ void MoonrakerManager::register_callbacks() {
             state_change["_connection_state"] = true;
             state_change["old_state"] = static_cast<int>(old_state);
             state_change["new_state"] = static_cast<int>(new_state);
-            m_notification_queue.push(state_change);
+            m_notification_queue.push({std::move(state_change), nullptr});
         });
 
-    // Register notification callback to queue updates for main thread
-    m_client->register_notify_update([this, alive](json notification) {
-        if (!alive->load())
-            return;
+    // Register status callback to queue decoded updates for main thread
+    m_client->register_status_update(
+        [this, alive](const std::shared_ptr<const helix::StatusDelta>& delta) {
+            if (!alive->load())
+                return;
 
-        std::lock_guard<std::mutex> lock(m_notification_mutex);
-        m_notification_queue.push(notification);
-    });
+            std::lock_guard<std::mutex> lock(m_notification_mutex);
+            m_notification_queue.push({nullptr, delta});
+        });
 }
 
 void MoonrakerManager::create_api(const RuntimeConfig& runtime_config) {
@@ -15,7 +15,6 @@
 #include "ui_overlay_timelapse_settings.h"
 #include "ui_panel_advanced.h"
 #include "ui_panel_bed_mesh.h"
-#include "ui_panel_calibration_pid.h"
 #include "ui_panel_calibration_zoffset.h"
 #include "ui_panel_console.h"
 #include "ui_panel_controls.h"
@@ -33,7 +32,6 @@
 #include "ui_panel_spoolman.h"
 #include "ui_panel_temp_control.h"
 #include "ui_printer_status_icon.h"
-#include "ui_wizard.h"
 
 #include "abort_manager.h"
 #include "accel_sensor_manager.h"
@@ -222,12 +220,11 @@ void SubjectInitializer::init_panel_subjects(MoonrakerAPI* api) {
     init_screws_tilt_row_handler();
     init_input_shaper_row_handler();
     init_zoffset_row_handler();
-    init_zoffset_event_callbacks();
 
-    // Wizard and keypad - register cleanup with StaticPanelRegistry
-    ui_wizard_init_subjects();
-    StaticPanelRegistry::instance().register_destroy("WizardSubjects", ui_wizard_deinit_subjects);
+    // Wizard subjects are created by Application::run_wizard(), only when the
+    // first-run wizard is actually shown
 
+    // Keypad - register cleanup with StaticPanelRegistry
     ui_keypad_init_subjects();
     StaticPanelRegistry::instance().register_destroy("KeypadSubjects", ui_keypad_deinit_subjects);
 
@@ -253,24 +250,19 @@ void SubjectInitializer::init_panel_subjects(MoonrakerAPI* api) {
     StaticPanelRegistry::instance().register_destroy(
         "PrintStatusPanelSubjects", []() { get_global_print_status_panel().deinit_subjects(); });
 
-    // Motion and Extrusion panels: deinit handled by destructor
-    // (registered with StaticPanelRegistry in their get_global_* functions)
+    // Motion, Extrusion and Bed Mesh overlays: subjects are only bound by their
+    // own XML, so they are created on first navigation (lazy_create_and_push_overlay
+    // and the CLI overlay paths call init_subjects() when needed). Deinit is
+    // guarded, so the destroy hooks are safe if the overlay was never opened.
     m_motion_panel = &get_global_motion_panel();
-    m_motion_panel->init_subjects();
-
     m_extrusion_panel = &get_global_extrusion_panel();
-    m_extrusion_panel->init_subjects();
 
     m_bed_mesh_panel = &get_global_bed_mesh_panel();
-    m_bed_mesh_panel->init_subjects();
     StaticPanelRegistry::instance().register_destroy(
         "BedMeshPanelSubjects", []() { get_global_bed_mesh_panel().deinit_subjects(); });
 
-    // Panel initialization via global instances
-    // PIDCalibrationPanel: deinit handled by destructor (registered with StaticPanelRegistry)
-    get_global_pid_cal_panel().init_subjects();
-
-    get_global_zoffset_cal_panel().init_subjects();
+    // PID, Z-Offset and Input Shaper calibration overlays are lazy as well: their
+    // open paths call init_subjects() and the destructors deinit only if needed.
 
     // TempControlPanel (owned by SubjectInitializer - destructor handles deinit_subjects)
     m_temp_control_panel = std::make_unique<TempControlPanel>(get_printer_state(), api);
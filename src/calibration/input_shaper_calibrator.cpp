@@ -10,7 +10,11 @@
 
 #include "input_shaper_calibrator.h"
 
+#include "async_helpers.h"
+#include "helix_plugin_installer.h"
 #include "moonraker_api.h"
+#include "moonraker_client.h"
+#include "scoped_trace.h"
 #include "spdlog/spdlog.h"
 
 #include <cctype>
@@ -30,6 +34,43 @@ InputShaperCalibrator::InputShaperCalibrator(MoonrakerAPI* api) : api_(api) {
     spdlog::debug("[InputShaperCalibrator] Created with API");
 }
 
+InputShaperCalibrator::~InputShaperCalibrator() {
+    alive_->store(false);
+    join_analysis();
+}
+
+InputShaperCalibrator::InputShaperCalibrator(InputShaperCalibrator&& other) noexcept
+    : api_(other.api_), state_(other.state_), results_(std::move(other.results_)),
+      local_analysis_override_(other.local_analysis_override_) {}
+
+InputShaperCalibrator& InputShaperCalibrator::operator=(InputShaperCalibrator&& other) noexcept {
+    if (this != &other) {
+        alive_->store(false);
+        join_analysis();
+        alive_ = std::make_shared<std::atomic<bool>>(true);
+        api_ = other.api_;
+        state_ = other.state_;
+        results_ = std::move(other.results_);
+        local_analysis_override_ = other.local_analysis_override_;
+    }
+    return *this;
+}
+
+bool InputShaperCalibrator::local_analysis() const {
+    if (local_analysis_override_) {
+        return *local_analysis_override_;
+    }
+    // Klipper writes raw accelerometer data on its own host
+    return api_ &&
+           is_local_host(extract_host_from_websocket_url(api_->get_client().get_last_url()));
+}
+
+void InputShaperCalibrator::join_analysis() {
+    if (analysis_thread_.joinable()) {
+        analysis_thread_.join();
+    }
+}
+
 // ============================================================================
 // check_accelerometer()
 // ============================================================================
@@ -128,26 +169,35 @@ void InputShaperCalibrator::run_calibration(char axis, ProgressCallback on_progr
         }
     };
 
+    if (local_analysis()) {
+        spdlog::info("[InputShaperCalibrator] Capturing raw data for on-device analysis");
+        api_->capture_resonance_data(
+            normalized_axis,
+            [this, alive = alive_, normalized_axis, on_complete,
+             on_error](const std::vector<std::string>& csv_paths) {
+                if (!alive->load()) {
+                    return;
+                }
+                analyze_captured_data(normalized_axis, csv_paths, on_complete, on_error);
+            },
+            [this, alive = alive_, on_error](const MoonrakerError& err) {
+                if (!alive->load()) {
+                    return;
+                }
+                state_ = State::IDLE;
+                spdlog::error("[InputShaperCalibrator] Resonance test failed: {}", err.message);
+                if (on_error) {
+                    on_error(err.message);
+                }
+            });
+        return;
+    }
+
     // Call API to run resonance test
     api_->start_resonance_test(
         normalized_axis, api_progress,
         [this, normalized_axis, on_complete](const InputShaperResult& result) {
-            // Store result in appropriate slot
-            if (normalized_axis == 'X') {
-                results_.x_result = result;
-            } else {
-                results_.y_result = result;
-            }
-
-            // Determine next state
-            if (results_.is_complete()) {
-                state_ = State::READY;
-                spdlog::info("[InputShaperCalibrator] Both axes calibrated, state=READY");
-            } else {
-                state_ = State::IDLE;
-                spdlog::info("[InputShaperCalibrator] Axis {} complete, awaiting other axis",
-                             normalized_axis);
-            }
+            store_result(normalized_axis, result);
 
             // Call user callback if provided
             if (on_complete) {
@@ -167,6 +217,91 @@ void InputShaperCalibrator::run_calibration(char axis, ProgressCallback on_progr
         });
 }
 
+void InputShaperCalibrator::store_result(char axis, const InputShaperResult& result) {
+    // Store result in appropriate slot
+    if (axis == 'X') {
+        results_.x_result = result;
+    } else {
+        results_.y_result = result;
+    }
+
+    // Determine next state
+    if (results_.is_complete()) {
+        state_ = State::READY;
+        spdlog::info("[InputShaperCalibrator] Both axes calibrated, state=READY");
+    } else {
+        state_ = State::IDLE;
+        spdlog::info("[InputShaperCalibrator] Axis {} complete, awaiting other axis", axis);
+    }
+}
+
+void InputShaperCalibrator::analyze_captured_data(char axis,
+                                                  const std::vector<std::string>& csv_paths,
+                                                  ResultCallback on_complete,
+                                                  ErrorCallback on_error) {
+    spdlog::info("[InputShaperCalibrator] Analyzing {} raw data file(s) for axis {}",
+                 csv_paths.size(), axis);
+
+    // A previous analysis finished long ago (each one follows a multi-minute test)
+    join_analysis();
+    analysis_thread_ = std::thread([this, alive = alive_, axis, csv_paths, on_complete,
+                                    on_error]() {
+        helix::trace::set_thread_name("shaper-analysis");
+        InputShaperResult result;
+        std::string error;
+        bool ok;
+        {
+            HELIX_TRACE_SCOPE("calibration", "analyze_resonance_files");
+            ok = analyze_resonance_files(axis, csv_paths, {}, result, &error);
+        }
+
+        helix::async::invoke([this, alive, axis, ok, result, error, on_complete, on_error]() {
+            if (!alive->load()) {
+                return;
+            }
+            if (!ok) {
+                state_ = State::IDLE;
+                spdlog::error("[InputShaperCalibrator] Analysis failed: {}", error);
+                if (on_error) {
+                    on_error(error);
+                }
+                return;
+            }
+
+            store_result(axis, result);
+            if (on_complete) {
+                on_complete(result);
+            }
+        });
+    });
+}
+
+// ============================================================================
+// refit()
+// ============================================================================
+
+bool InputShaperCalibrator::refit(char axis, const ShaperFitOptions& options) {
+    char normalized_axis = static_cast<char>(std::toupper(static_cast<unsigned char>(axis)));
+    InputShaperResult* stored = normalized_axis == 'X'   ? &results_.x_result
+                                : normalized_axis == 'Y' ? &results_.y_result
+                                                         : nullptr;
+    if (!stored || stored->freq_response.empty()) {
+        spdlog::warn("[InputShaperCalibrator] No spectrum stored for axis {}", axis);
+        return false;
+    }
+
+    InputShaperResult result =
+        fit_shapers(normalized_axis, spectrum_from_result(*stored), options);
+    if (!result.is_valid()) {
+        return false;
+    }
+
+    spdlog::info("[InputShaperCalibrator] Re-fitted axis {}: {} @ {:.1f} Hz (max smoothing {})",
+                 normalized_axis, result.shaper_type, result.shaper_freq, options.max_smoothing);
+    *stored = std::move(result);
+    return true;
+}
+
 // ============================================================================
 // apply_settings()
 // ============================================================================
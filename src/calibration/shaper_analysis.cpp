@@ -0,0 +1,1019 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file shaper_analysis.cpp
+ * @brief Welch PSD and input shaper fitting (port of Klipper's shaper_calibrate.py)
+ *
+ * Hot paths are written for a Cortex-A7 at -Os:
+ * - CSV numbers are parsed by hand (no locale, no strtod) while streaming the file
+ * - FFT is a radix-2 real transform on split re/im arrays with NEON butterflies
+ * - Shaper responses use the uniform impulse spacing of every shaper type, so each
+ *   (bin, damping ratio, frequency) needs one exp and one sin/cos instead of one per impulse
+ * - Bins below the vibration threshold are skipped (the response never exceeds 1)
+ */
+
+#include "shaper_analysis.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HELIX_SHAPER_NEON 1
+#endif
+
+namespace helix {
+namespace calibration {
+
+namespace {
+
+// Constants from Klipper's shaper_defs.py / shaper_calibrate.py
+constexpr double SHAPER_VIBRATION_REDUCTION = 20.0;
+constexpr double DEFAULT_DAMPING_RATIO = 0.1;
+constexpr double MIN_FREQ = 5.0;
+constexpr double WINDOW_T_SEC = 0.5;
+constexpr double MAX_SHAPER_FREQ = 150.0;
+constexpr double SHAPER_FREQ_STEP = 0.2;
+constexpr double TEST_DAMPING_RATIOS[] = {0.075, 0.1, 0.15};
+constexpr double TARGET_SMOOTHING = 0.12;
+constexpr double KAISER_BETA = 6.0;
+
+constexpr size_t MAX_IMPULSES = 5;
+constexpr size_t READ_CHUNK = 64 * 1024;
+
+constexpr double PI = 3.14159265358979323846;
+
+// ============================================================================
+// CSV parsing
+// ============================================================================
+
+constexpr double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+constexpr double NEG_POW10[] = {1e-0,  1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,
+                                1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15,
+                                1e-16, 1e-17, 1e-18, 1e-19, 1e-20, 1e-21, 1e-22};
+
+/**
+ * @brief Parse a decimal number ([+-]digits[.digits][e[+-]digits])
+ *
+ * Within one ulp of strtod for up to 19 significant digits and exponents
+ * within 1e±22, which covers Klipper's %.6f output (multiplying by 1e-k
+ * instead of dividing by 1e+k is what makes this cheap on a Cortex-A7).
+ * Longer inputs fall back to strtod.
+ *
+ * @return Pointer past the number, or nullptr if none was found
+ */
+const char* parse_number(const char* p, const char* end, double& out) {
+    const char* begin = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    const char* digits = p;
+    while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+        mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+        ++p;
+    }
+    size_t count = static_cast<size_t>(p - digits);
+    int exponent = 0;
+    if (p < end && *p == '.') {
+        const char* fraction = ++p;
+        while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+            ++p;
+        }
+        count += static_cast<size_t>(p - fraction);
+        exponent = -static_cast<int>(p - fraction);
+    }
+    if (count == 0) {
+        return nullptr;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool exp_negative = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            exp_negative = *q == '-';
+            ++q;
+        }
+        int e = 0;
+        const char* exp_digits = q;
+        while (q < end && static_cast<unsigned>(*q - '0') < 10) {
+            e = std::min(e * 10 + (*q - '0'), 10000);
+            ++q;
+        }
+        if (q != exp_digits) {
+            exponent += exp_negative ? -e : e;
+            p = q;
+        }
+    }
+
+    if (count > 19 || exponent > 22 || exponent < -22) {
+        // Rare: too many digits for the mantissa or out of the exact range
+        char buf[64];
+        size_t len = std::min(static_cast<size_t>(p - begin), sizeof(buf) - 1);
+        std::copy(begin, begin + len, buf);
+        buf[len] = '\0';
+        out = std::strtod(buf, nullptr);
+        return p;
+    }
+
+    double value = static_cast<double>(mantissa);
+    value *= exponent < 0 ? NEG_POW10[-exponent] : POW10[exponent];
+    out = negative ? -value : value;
+    return p;
+}
+
+/// Line-at-a-time CSV parser shared by the in-memory and streaming entry points
+class AccelCsvParser {
+  public:
+    explicit AccelCsvParser(AccelSamples& out) : out_(out) {
+        out_ = AccelSamples{};
+    }
+
+    bool feed_line(std::string_view line) {
+        ++line_number_;
+        const char* p = line.data();
+        const char* end = p + line.size();
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            ++p;
+        }
+        if (p == end || *p == '#') {
+            return true;
+        }
+
+        double values[4];
+        for (int i = 0; i < 4; ++i) {
+            while (p < end && *p == ' ') {
+                ++p;
+            }
+            p = parse_number(p, end, values[i]);
+            if (!p) {
+                return fail("expected 4 numeric columns");
+            }
+            while (p < end && *p == ' ') {
+                ++p;
+            }
+            if (i < 3) {
+                if (p == end || *p != ',') {
+                    return fail("expected 4 numeric columns");
+                }
+                ++p;
+            }
+        }
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            ++p;
+        }
+        if (p != end) {
+            return fail("unexpected trailing data");
+        }
+
+        if (out_.x.empty()) {
+            out_.first_time = values[0];
+        }
+        out_.last_time = values[0];
+        out_.x.push_back(static_cast<float>(values[1]));
+        out_.y.push_back(static_cast<float>(values[2]));
+        out_.z.push_back(static_cast<float>(values[3]));
+        return true;
+    }
+
+    bool finish(std::string* error) {
+        if (!error_.empty()) {
+            if (error) {
+                *error = error_;
+            }
+            return false;
+        }
+        if (out_.size() < 2) {
+            if (error) {
+                *error = "no accelerometer samples";
+            }
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    bool fail(const char* reason) {
+        error_ = "line " + std::to_string(line_number_) + ": " + reason;
+        return false;
+    }
+
+    AccelSamples& out_;
+    size_t line_number_ = 0;
+    std::string error_;
+};
+
+// ============================================================================
+// FFT
+// ============================================================================
+
+/**
+ * @brief Power spectrum of a real signal of power-of-two length
+ *
+ * Packs even/odd samples into a half-length complex FFT and splits the
+ * result, so an N-point real transform costs an N/2-point complex one.
+ * Tables are built once per window size and reused for every segment.
+ */
+class RealFft {
+  public:
+    explicit RealFft(size_t n)
+        : n_(n), half_(n / 2), re_(half_), im_(half_), bitrev_(half_), tw_re_(half_),
+          tw_im_(half_), post_re_(half_ + 1), post_im_(half_ + 1) {
+        size_t bits = 0;
+        while ((size_t{1} << bits) < half_) {
+            ++bits;
+        }
+        for (size_t i = 0; i < half_; ++i) {
+            size_t r = 0;
+            for (size_t b = 0; b < bits; ++b) {
+                r |= ((i >> b) & 1) << (bits - 1 - b);
+            }
+            bitrev_[i] = static_cast<uint32_t>(r);
+        }
+
+        // Twiddles for the butterfly span h live at [h, 2h): exp(-i*pi*k/h).
+        // Spans 1 and 2 are handled by first_stages().
+        for (size_t h = 4; h < half_; h <<= 1) {
+            for (size_t k = 0; k < h; ++k) {
+                double angle = -PI * static_cast<double>(k) / static_cast<double>(h);
+                tw_re_[h + k] = static_cast<float>(std::cos(angle));
+                tw_im_[h + k] = static_cast<float>(std::sin(angle));
+            }
+        }
+        for (size_t k = 0; k <= half_; ++k) {
+            double angle = -2.0 * PI * static_cast<double>(k) / static_cast<double>(n_);
+            post_re_[k] = static_cast<float>(std::cos(angle));
+            post_im_[k] = static_cast<float>(std::sin(angle));
+        }
+    }
+
+    /// Add |X[k]|² for k = 0..n/2 of the real input (length n) to out
+    void accumulate_power(const float* in, double* out) {
+        first_stages(in);
+        for (size_t h = 4; h < half_; h <<= 1) {
+            const float* wr = tw_re_.data() + h;
+            const float* wi = tw_im_.data() + h;
+            for (size_t base = 0; base < half_; base += 2 * h) {
+                butterflies(re_.data() + base, im_.data() + base, re_.data() + base + h,
+                            im_.data() + base + h, wr, wi, h);
+            }
+        }
+
+        for (size_t k = 0; k <= half_; ++k) {
+            size_t a = k == half_ ? 0 : k;
+            size_t b = k == 0 ? 0 : half_ - k;
+            float zr = re_[a], zi = im_[a];
+            float cr = re_[b], ci = -im_[b];
+            // Even part (Z[k] + conj Z[N-k]) / 2, odd part (Z[k] - conj Z[N-k]) / 2i
+            float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+            float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+            float xr = er + post_re_[k] * or_ - post_im_[k] * oi;
+            float xi = ei + post_re_[k] * oi + post_im_[k] * or_;
+            out[k] += static_cast<double>(xr * xr + xi * xi);
+        }
+    }
+
+  private:
+    /**
+     * @brief Bit-reversed load of the packed input fused with spans 1 and 2
+     *
+     * Treats each group of four as one radix-4 butterfly (twiddles 1 and -i),
+     * saving two passes over the arrays.
+     */
+    void first_stages(const float* in) {
+        float* re = re_.data();
+        float* im = im_.data();
+        for (size_t j = 0; j < half_; j += 4) {
+            const float* p0 = in + 2 * bitrev_[j];
+            const float* p1 = in + 2 * bitrev_[j + 1];
+            const float* p2 = in + 2 * bitrev_[j + 2];
+            const float* p3 = in + 2 * bitrev_[j + 3];
+            float s0r = p0[0] + p1[0], s0i = p0[1] + p1[1];
+            float d0r = p0[0] - p1[0], d0i = p0[1] - p1[1];
+            float s1r = p2[0] + p3[0], s1i = p2[1] + p3[1];
+            float d1r = p2[0] - p3[0], d1i = p2[1] - p3[1];
+            re[j] = s0r + s1r;
+            im[j] = s0i + s1i;
+            re[j + 2] = s0r - s1r;
+            im[j + 2] = s0i - s1i;
+            // -i * d1
+            re[j + 1] = d0r + d1i;
+            im[j + 1] = d0i - d1r;
+            re[j + 3] = d0r - d1i;
+            im[j + 3] = d0i + d1r;
+        }
+    }
+
+    /// a' = a + w*b, b' = a - w*b for h (multiple of 4) consecutive pairs
+    static void butterflies(float* ar, float* ai, float* br, float* bi, const float* wr,
+                            const float* wi, size_t h) {
+#ifdef HELIX_SHAPER_NEON
+        for (size_t k = 0; k < h; k += 4) {
+            float32x4_t vwr = vld1q_f32(wr + k), vwi = vld1q_f32(wi + k);
+            float32x4_t vbr = vld1q_f32(br + k), vbi = vld1q_f32(bi + k);
+            float32x4_t tr = vmlsq_f32(vmulq_f32(vbr, vwr), vbi, vwi);
+            float32x4_t ti = vmlaq_f32(vmulq_f32(vbr, vwi), vbi, vwr);
+            float32x4_t var = vld1q_f32(ar + k), vai = vld1q_f32(ai + k);
+            vst1q_f32(ar + k, vaddq_f32(var, tr));
+            vst1q_f32(ai + k, vaddq_f32(vai, ti));
+            vst1q_f32(br + k, vsubq_f32(var, tr));
+            vst1q_f32(bi + k, vsubq_f32(vai, ti));
+        }
+#else
+        for (size_t k = 0; k < h; ++k) {
+            float tr = br[k] * wr[k] - bi[k] * wi[k];
+            float ti = br[k] * wi[k] + bi[k] * wr[k];
+            float xr = ar[k], xi = ai[k];
+            ar[k] = xr + tr;
+            ai[k] = xi + ti;
+            br[k] = xr - tr;
+            bi[k] = xi - ti;
+        }
+#endif
+    }
+
+    size_t n_;
+    size_t half_;
+    std::vector<float> re_, im_;
+    std::vector<uint32_t> bitrev_;
+    std::vector<float> tw_re_, tw_im_;
+    std::vector<float> post_re_, post_im_;
+};
+
+/// Modified Bessel function of the first kind, order 0 (power series)
+double bessel_i0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    double q = x * x / 4.0;
+    for (int k = 1; k < 500; ++k) {
+        term *= q / (static_cast<double>(k) * static_cast<double>(k));
+        sum += term;
+        if (term < sum * 1e-17) {
+            break;
+        }
+    }
+    return sum;
+}
+
+/// numpy.kaiser(n, beta)
+std::vector<float> kaiser_window(size_t n, double beta, double& sum_sq) {
+    std::vector<float> window(n);
+    double alpha = static_cast<double>(n - 1) / 2.0;
+    double denom = bessel_i0(beta);
+    sum_sq = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double r = (static_cast<double>(i) - alpha) / alpha;
+        double w = bessel_i0(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / denom;
+        window[i] = static_cast<float>(w);
+        sum_sq += w * w;
+    }
+    return window;
+}
+
+/// Welch's method over 50%-overlapping windows (Klipper's _psd())
+std::vector<float> welch_psd(const std::vector<float>& x, double fs, size_t nfft,
+                             const std::vector<float>& window, double window_sum_sq,
+                             RealFft& fft) {
+    const size_t overlap = nfft / 2;
+    const size_t step = nfft - overlap;
+    const size_t n_windows = (x.size() - overlap) / step;
+    const size_t bins = nfft / 2 + 1;
+
+    // Windows overlap by half, so each window mean is the sum of two half-blocks
+    std::vector<double> block_sums(n_windows + 1, 0.0);
+    for (size_t b = 0; b <= n_windows; ++b) {
+        const float* src = x.data() + b * step;
+        double sum = 0.0;
+        for (size_t i = 0; i < step; ++i) {
+            sum += src[i];
+        }
+        block_sums[b] = sum;
+    }
+
+    std::vector<double> acc(bins, 0.0);
+    std::vector<float> segment(nfft);
+    for (size_t w = 0; w < n_windows; ++w) {
+        const float* src = x.data() + w * step;
+        auto mean = static_cast<float>((block_sums[w] + block_sums[w + 1]) /
+                                       static_cast<double>(nfft));
+        for (size_t i = 0; i < nfft; ++i) {
+            segment[i] = (src[i] - mean) * window[i];
+        }
+        fft.accumulate_power(segment.data(), acc.data());
+    }
+
+    // One-sided spectrum: double everything but DC and Nyquist
+    const double scale = 1.0 / window_sum_sq / fs / static_cast<double>(n_windows);
+    std::vector<float> psd(bins);
+    for (size_t k = 0; k < bins; ++k) {
+        double factor = (k == 0 || k == bins - 1) ? scale : 2.0 * scale;
+        psd[k] = static_cast<float>(acc[k] * factor);
+    }
+    return psd;
+}
+
+/// Linear interpolation of (xs, ys) at x, clamped at the ends (numpy.interp)
+float interpolate(const std::vector<float>& xs, const std::vector<float>& ys, float x) {
+    if (x <= xs.front()) {
+        return ys.front();
+    }
+    if (x >= xs.back()) {
+        return ys.back();
+    }
+    size_t i = static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), x) - xs.begin());
+    float t = (x - xs[i - 1]) / (xs[i] - xs[i - 1]);
+    return ys[i - 1] + t * (ys[i] - ys[i - 1]);
+}
+
+// ============================================================================
+// Shapers
+// ============================================================================
+
+/**
+ * @brief Impulse amplitudes of a shaper; impulse i fires at i * spacing
+ *
+ * Every autotuned shaper has evenly spaced impulses, which the response
+ * calculation relies on.
+ */
+struct Shaper {
+    double amplitudes[MAX_IMPULSES];
+    size_t count = 0;
+    double spacing = 0.0;
+};
+
+struct ShaperDef {
+    const char* name;
+    double min_freq;
+    Shaper (*make)(double freq, double damping_ratio);
+};
+
+Shaper make_zv(double freq, double damping_ratio) {
+    double df = std::sqrt(1.0 - damping_ratio * damping_ratio);
+    double K = std::exp(-damping_ratio * PI / df);
+    double t_d = 1.0 / (freq * df);
+    return {{1.0, K}, 2, 0.5 * t_d};
+}
+
+Shaper make_mzv(double freq, double damping_ratio) {
+    double df = std::sqrt(1.0 - damping_ratio * damping_ratio);
+    double K = std::exp(-0.75 * damping_ratio * PI / df);
+    double t_d = 1.0 / (freq * df);
+    double a1 = 1.0 - 1.0 / std::sqrt(2.0);
+    double a2 = (std::sqrt(2.0) - 1.0) * K;
+    double a3 = a1 * K * K;
+    return {{a1, a2, a3}, 3, 0.375 * t_d};
+}
+
+Shaper make_ei(double freq, double damping_ratio) {
+    double v_tol = 1.0 / SHAPER_VIBRATION_REDUCTION;
+    double df = std::sqrt(1.0 - damping_ratio * damping_ratio);
+    double K = std::exp(-damping_ratio * PI / df);
+    double t_d = 1.0 / (freq * df);
+    double a1 = 0.25 * (1.0 + v_tol);
+    double a2 = 0.5 * (1.0 - v_tol) * K;
+    double a3 = a1 * K * K;
+    return {{a1, a2, a3}, 3, 0.5 * t_d};
+}
+
+Shaper make_2hump_ei(double freq, double damping_ratio) {
+    double v_tol = 1.0 / SHAPER_VIBRATION_REDUCTION;
+    double df = std::sqrt(1.0 - damping_ratio * damping_ratio);
+    double K = std::exp(-damping_ratio * PI / df);
+    double t_d = 1.0 / (freq * df);
+    double V2 = v_tol * v_tol;
+    double X = std::pow(V2 * (std::sqrt(1.0 - V2) + 1.0), 1.0 / 3.0);
+    double a1 = (3.0 * X * X + 2.0 * X + 3.0 * V2) / (16.0 * X);
+    double a2 = (0.5 - a1) * K;
+    double a3 = a2 * K;
+    double a4 = a1 * K * K * K;
+    return {{a1, a2, a3, a4}, 4, 0.5 * t_d};
+}
+
+Shaper make_3hump_ei(double freq, double damping_ratio) {
+    double v_tol = 1.0 / SHAPER_VIBRATION_REDUCTION;
+    double df = std::sqrt(1.0 - damping_ratio * damping_ratio);
+    double K = std::exp(-damping_ratio * PI / df);
+    double t_d = 1.0 / (freq * df);
+    double K2 = K * K;
+    double a1 = 0.0625 * (1.0 + 3.0 * v_tol + 2.0 * std::sqrt(2.0 * (v_tol + 1.0) * v_tol));
+    double a2 = 0.25 * (1.0 - v_tol) * K;
+    double a3 = (0.5 * (1.0 + v_tol) - 2.0 * a1) * K2;
+    double a4 = a2 * K2;
+    double a5 = a1 * K2 * K2;
+    return {{a1, a2, a3, a4, a5}, 5, 0.5 * t_d};
+}
+
+constexpr ShaperDef SHAPERS[] = {
+    {"zv", 21.0, make_zv},
+    {"mzv", 23.0, make_mzv},
+    {"ei", 29.0, make_ei},
+    {"2hump_ei", 39.0, make_2hump_ei},
+    {"3hump_ei", 48.0, make_3hump_ei},
+};
+
+const ShaperDef* find_shaper(const std::string& type) {
+    for (const auto& def : SHAPERS) {
+        if (type == def.name) {
+            return &def;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Smoothing as max(offset_90, offset_180) = max(c90 + accel*k90, accel*k180)
+ *
+ * Both offsets are linear in acceleration, which lets max_accel be solved
+ * directly instead of bisected.
+ */
+struct SmoothingTerms {
+    double c90 = 0.0;
+    double k90 = 0.0;
+    double k180 = 0.0;
+
+    [[nodiscard]] double at(double accel) const {
+        return std::max(c90 + accel * k90, accel * k180);
+    }
+
+    /// Largest acceleration with smoothing <= target (Klipper bisects to 1e-8)
+    [[nodiscard]] double max_accel(double target) const {
+        if (c90 > target) {
+            return 0.0;
+        }
+        double limit = k90 > 0.0 ? (target - c90) / k90 : HUGE_VAL;
+        if (k180 > 0.0) {
+            limit = std::min(limit, target / k180);
+        }
+        return limit;
+    }
+};
+
+SmoothingTerms smoothing_terms(const Shaper& shaper, double scv) {
+    double sum = 0.0;
+    double shift = 0.0;
+    for (size_t i = 0; i < shaper.count; ++i) {
+        sum += shaper.amplitudes[i];
+        shift += shaper.amplitudes[i] * (static_cast<double>(i) * shaper.spacing);
+    }
+    double inv_d = 1.0 / sum;
+    shift *= inv_d;
+
+    SmoothingTerms terms;
+    for (size_t i = 0; i < shaper.count; ++i) {
+        double dt = static_cast<double>(i) * shaper.spacing - shift;
+        double a = shaper.amplitudes[i];
+        if (dt >= 0.0) {
+            terms.c90 += a * scv * dt;
+            terms.k90 += a * 0.5 * dt * dt;
+        }
+        terms.k180 += a * 0.5 * dt * dt;
+    }
+    terms.c90 *= inv_d * std::sqrt(2.0);
+    terms.k90 *= inv_d * std::sqrt(2.0);
+    terms.k180 *= inv_d;
+    return terms;
+}
+
+/// Frequency bins above the vibration threshold, with per-damping-ratio constants
+struct FitInput {
+    std::vector<double> psd;
+    std::vector<double> damping[3];   ///< dr * omega per bin, per test damping ratio
+    std::vector<double> omega_d[3];   ///< omega * sqrt(1 - dr²)
+    double threshold = 0.0;
+    double all_vibrations = 0.0;
+};
+
+FitInput prepare_fit(const ResonanceSpectrum& spectrum, float max_freq) {
+    FitInput input;
+    double psd_max = 0.0;
+    size_t bins = 0;
+    while (bins < spectrum.freqs.size() && spectrum.freqs[bins] <= max_freq) {
+        psd_max = std::max(psd_max, static_cast<double>(spectrum.psd_sum[bins]));
+        ++bins;
+    }
+    input.threshold = psd_max / SHAPER_VIBRATION_REDUCTION;
+
+    for (size_t b = 0; b < bins; ++b) {
+        double psd = spectrum.psd_sum[b];
+        if (psd <= input.threshold) {
+            continue; // Response <= 1, so remaining vibration here is always 0
+        }
+        input.all_vibrations += psd - input.threshold;
+        input.psd.push_back(psd);
+        double omega = 2.0 * PI * static_cast<double>(spectrum.freqs[b]);
+        for (size_t d = 0; d < 3; ++d) {
+            double dr = TEST_DAMPING_RATIOS[d];
+            input.damping[d].push_back(dr * omega);
+            input.omega_d[d].push_back(omega * std::sqrt(1.0 - dr * dr));
+        }
+    }
+    return input;
+}
+
+/// 1 / sum of impulse amplitudes
+double inverse_amplitude_sum(const Shaper& shaper) {
+    double sum = 0.0;
+    for (size_t i = 0; i < shaper.count; ++i) {
+        sum += shaper.amplitudes[i];
+    }
+    return 1.0 / sum;
+}
+
+/// Shaper response magnitude at one frequency, before dividing by the amplitude sum
+inline double shaper_response_raw(const Shaper& shaper, double damping, double omega_d) {
+    // Sum of A_i * exp(-damping * (T_last - T_i)) * exp(j * omega_d * T_i), in Horner form
+    double decay = std::exp(-damping * shaper.spacing);
+    double angle = omega_d * shaper.spacing;
+    double rot_re = std::cos(angle), rot_im = std::sin(angle);
+    double acc_re = 0.0, acc_im = 0.0;
+    double pow_re = 1.0, pow_im = 0.0;
+    for (size_t i = 0; i < shaper.count; ++i) {
+        acc_re = acc_re * decay + shaper.amplitudes[i] * pow_re;
+        acc_im = acc_im * decay + shaper.amplitudes[i] * pow_im;
+        double next_re = pow_re * rot_re - pow_im * rot_im;
+        pow_im = pow_re * rot_im + pow_im * rot_re;
+        pow_re = next_re;
+    }
+    return std::sqrt(acc_re * acc_re + acc_im * acc_im);
+}
+
+/// Fraction of vibrations left after shaping, for one test damping ratio
+double remaining_vibrations(const Shaper& shaper, const FitInput& input, size_t d) {
+    const double inv_d = inverse_amplitude_sum(shaper);
+    double remaining = 0.0;
+    const size_t bins = input.psd.size();
+    for (size_t b = 0; b < bins; ++b) {
+        double response =
+            shaper_response_raw(shaper, input.damping[d][b], input.omega_d[d][b]) * inv_d;
+        remaining += std::max(response * input.psd[b] - input.threshold, 0.0);
+    }
+    return input.all_vibrations > 0.0 ? remaining / input.all_vibrations : 0.0;
+}
+
+struct FitResult {
+    const char* name = nullptr;
+    double freq = 0.0;
+    double vibrations = 0.0; ///< Fraction
+    double smoothing = 0.0;
+    double score = 0.0;
+    double max_accel = 0.0;
+};
+
+/// Klipper's fit_shaper(): least vibrations, then trade a little for less smoothing
+FitResult fit_shaper(const ShaperDef& def, const FitInput& input, double max_smoothing) {
+    // numpy.arange(min_freq, MAX_SHAPER_FREQ, 0.2), walked from the top
+    const double delta = (def.min_freq + SHAPER_FREQ_STEP) - def.min_freq;
+    const auto count =
+        static_cast<size_t>(std::ceil((MAX_SHAPER_FREQ - def.min_freq) / SHAPER_FREQ_STEP));
+
+    std::vector<FitResult> results;
+    results.reserve(count);
+    size_t best = 0;
+    for (size_t n = count; n-- > 0;) {
+        double freq = def.min_freq + static_cast<double>(n) * delta;
+        Shaper shaper = def.make(freq, DEFAULT_DAMPING_RATIO);
+        SmoothingTerms terms = smoothing_terms(shaper, 5.0);
+        double smoothing = terms.at(5000.0);
+        if (max_smoothing > 0.0 && smoothing > max_smoothing && !results.empty()) {
+            return results[best];
+        }
+
+        // Printer damping is unknown: take the worst case over plausible ratios
+        double vibrations = 0.0;
+        for (size_t d = 0; d < 3; ++d) {
+            vibrations = std::max(vibrations, remaining_vibrations(shaper, input, d));
+        }
+
+        FitResult result;
+        result.name = def.name;
+        result.freq = freq;
+        result.vibrations = vibrations;
+        result.smoothing = smoothing;
+        result.score =
+            smoothing * (std::pow(vibrations, 1.5) + vibrations * 0.2 + 0.01);
+        result.max_accel = terms.max_accel(TARGET_SMOOTHING);
+        results.push_back(result);
+        if (results[best].vibrations > vibrations) {
+            best = results.size() - 1;
+        }
+    }
+
+    FitResult selected = results[best];
+    for (auto it = results.rbegin(); it != results.rend(); ++it) {
+        if (it->vibrations < results[best].vibrations * 1.1 && it->score < selected.score) {
+            selected = *it;
+        }
+    }
+    return selected;
+}
+
+ShaperOption to_option(const FitResult& fit) {
+    ShaperOption option;
+    option.type = fit.name;
+    option.frequency = static_cast<float>(fit.freq);
+    option.vibrations = static_cast<float>(fit.vibrations * 100.0);
+    option.smoothing = static_cast<float>(fit.smoothing);
+    option.max_accel = static_cast<float>(std::round(fit.max_accel / 100.0) * 100.0);
+    return option;
+}
+
+} // namespace
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+bool parse_accel_csv(std::string_view text, AccelSamples& out, std::string* error) {
+    AccelCsvParser parser(out);
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t newline = text.find('\n', pos);
+        if (newline == std::string_view::npos) {
+            newline = text.size();
+        }
+        if (!parser.feed_line(text.substr(pos, newline - pos))) {
+            break;
+        }
+        pos = newline + 1;
+    }
+    return parser.finish(error);
+}
+
+bool load_accel_csv(const std::string& path, AccelSamples& out, std::string* error) {
+    std::unique_ptr<FILE, decltype(&std::fclose)> file(std::fopen(path.c_str(), "rb"),
+                                                       &std::fclose);
+    if (!file) {
+        if (error) {
+            *error = "cannot open " + path;
+        }
+        return false;
+    }
+
+    AccelCsvParser parser(out);
+    std::vector<char> buffer(READ_CHUNK);
+    size_t carry = 0; // Partial line kept at the start of the buffer
+    bool ok = true;
+    while (ok) {
+        if (carry == buffer.size()) {
+            buffer.resize(buffer.size() * 2); // Pathologically long line
+        }
+        size_t n = std::fread(buffer.data() + carry, 1, buffer.size() - carry, file.get());
+        size_t filled = carry + n;
+        std::string_view data(buffer.data(), filled);
+
+        size_t pos = 0;
+        size_t newline;
+        while (ok && (newline = data.find('\n', pos)) != std::string_view::npos) {
+            ok = parser.feed_line(data.substr(pos, newline - pos));
+            pos = newline + 1;
+        }
+        if (n == 0) {
+            if (ok && pos < filled) {
+                ok = parser.feed_line(data.substr(pos));
+            }
+            break;
+        }
+        carry = filled - pos;
+        std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(pos),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(filled), buffer.begin());
+    }
+
+    if (!parser.finish(error)) {
+        if (error) {
+            *error = path + ": " + *error;
+        }
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Spectrum
+// ============================================================================
+
+bool compute_spectrum(const AccelSamples& samples, ResonanceSpectrum& out) {
+    const size_t n = samples.size();
+    const double duration = samples.last_time - samples.first_time;
+    if (n < 2 || !(duration > 0.0)) {
+        return false;
+    }
+
+    // Round the 0.5 s window up to a power of two (int(fs * 0.5 - 1).bit_length())
+    const double fs = static_cast<double>(n) / duration;
+    auto target = static_cast<long long>(fs * WINDOW_T_SEC - 1.0);
+    size_t nfft = 1;
+    while (target > 0) {
+        nfft <<= 1;
+        target >>= 1;
+    }
+    if (nfft < 8 || n <= nfft) {
+        return false;
+    }
+
+    double window_sum_sq = 0.0;
+    std::vector<float> window = kaiser_window(nfft, KAISER_BETA, window_sum_sq);
+    RealFft fft(nfft);
+
+    out = ResonanceSpectrum{};
+    out.psd_x = welch_psd(samples.x, fs, nfft, window, window_sum_sq, fft);
+    out.psd_y = welch_psd(samples.y, fs, nfft, window, window_sum_sq, fft);
+    out.psd_z = welch_psd(samples.z, fs, nfft, window, window_sum_sq, fft);
+
+    const size_t bins = nfft / 2 + 1;
+    out.freqs.resize(bins);
+    out.psd_sum.resize(bins);
+    for (size_t k = 0; k < bins; ++k) {
+        out.freqs[k] = static_cast<float>(static_cast<double>(k) * fs / static_cast<double>(nfft));
+        out.psd_sum[k] = out.psd_x[k] + out.psd_y[k] + out.psd_z[k];
+    }
+    out.data_sets = 1;
+    return true;
+}
+
+void merge_spectrum(ResonanceSpectrum& into, const ResonanceSpectrum& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (into.empty()) {
+        into = other;
+        return;
+    }
+
+    const float total = static_cast<float>(into.data_sets + other.data_sets);
+    auto merge = [&](std::vector<float>& psd, const std::vector<float>& other_psd) {
+        if (other_psd.size() != other.freqs.size()) {
+            return;
+        }
+        for (size_t k = 0; k < psd.size(); ++k) {
+            float value = other.freqs == into.freqs
+                              ? other_psd[k]
+                              : interpolate(other.freqs, other_psd, into.freqs[k]);
+            psd[k] = (psd[k] * static_cast<float>(into.data_sets) +
+                      value * static_cast<float>(other.data_sets)) /
+                     total;
+        }
+    };
+    merge(into.psd_sum, other.psd_sum);
+    merge(into.psd_x, other.psd_x);
+    merge(into.psd_y, other.psd_y);
+    merge(into.psd_z, other.psd_z);
+    into.data_sets += other.data_sets;
+}
+
+void normalize_spectrum(ResonanceSpectrum& spectrum) {
+    for (auto* psd : {&spectrum.psd_sum, &spectrum.psd_x, &spectrum.psd_y, &spectrum.psd_z}) {
+        for (size_t k = 0; k < psd->size() && k < spectrum.freqs.size(); ++k) {
+            float f = spectrum.freqs[k];
+            (*psd)[k] = f < MIN_FREQ ? 0.0f : (*psd)[k] / (f + 0.1f);
+        }
+    }
+}
+
+// ============================================================================
+// Fitting
+// ============================================================================
+
+InputShaperResult fit_shapers(char axis, const ResonanceSpectrum& spectrum,
+                              const ShaperFitOptions& options) {
+    InputShaperResult result;
+    result.axis = axis;
+    if (spectrum.empty() || spectrum.psd_sum.size() != spectrum.freqs.size()) {
+        return result;
+    }
+
+    for (size_t k = 0; k < spectrum.freqs.size() && spectrum.freqs[k] <= options.max_freq; ++k) {
+        result.freq_response.emplace_back(spectrum.freqs[k], spectrum.psd_sum[k]);
+    }
+
+    FitInput input = prepare_fit(spectrum, options.max_freq);
+    if (input.psd.empty()) {
+        return result;
+    }
+
+    // Keep a shaper only if it clearly beats the current pick: 20% better
+    // score, or 5% better score with 10% less smoothing
+    FitResult best;
+    bool have_best = false;
+    for (const auto& def : SHAPERS) {
+        FitResult fit = fit_shaper(def, input, options.max_smoothing);
+        result.all_shapers.push_back(to_option(fit));
+        if (!have_best || fit.score * 1.2 < best.score ||
+            (fit.score * 1.05 < best.score && fit.smoothing * 1.1 < best.smoothing)) {
+            best = fit;
+            have_best = true;
+        }
+    }
+
+    ShaperOption recommended = to_option(best);
+    result.shaper_type = recommended.type;
+    result.shaper_freq = recommended.frequency;
+    result.vibrations = recommended.vibrations;
+    result.smoothing = recommended.smoothing;
+    result.max_accel = recommended.max_accel;
+    return result;
+}
+
+ResonanceSpectrum spectrum_from_result(const InputShaperResult& result) {
+    ResonanceSpectrum spectrum;
+    spectrum.freqs.reserve(result.freq_response.size());
+    spectrum.psd_sum.reserve(result.freq_response.size());
+    for (const auto& [freq, psd] : result.freq_response) {
+        spectrum.freqs.push_back(freq);
+        spectrum.psd_sum.push_back(psd);
+    }
+    spectrum.data_sets = spectrum.freqs.empty() ? 0 : 1;
+    return spectrum;
+}
+
+bool analyze_resonance_files(char axis, const std::vector<std::string>& csv_paths,
+                             const ShaperFitOptions& options, InputShaperResult& out,
+                             std::string* error) {
+    auto start = std::chrono::steady_clock::now();
+    if (csv_paths.empty()) {
+        if (error) {
+            *error = "No accelerometer data files";
+        }
+        return false;
+    }
+
+    ResonanceSpectrum merged;
+    size_t total_samples = 0;
+    for (const auto& path : csv_paths) {
+        AccelSamples samples;
+        if (!load_accel_csv(path, samples, error)) {
+            return false;
+        }
+        ResonanceSpectrum spectrum;
+        if (!compute_spectrum(samples, spectrum)) {
+            if (error) {
+                *error = path + ": capture too short for analysis";
+            }
+            return false;
+        }
+        total_samples += samples.size();
+        merge_spectrum(merged, spectrum);
+    }
+    normalize_spectrum(merged);
+
+    out = fit_shapers(axis, merged, options);
+    if (!out.is_valid()) {
+        if (error) {
+            *error = "No resonances found in accelerometer data";
+        }
+        return false;
+    }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+    spdlog::info("[ShaperAnalysis] Axis {}: {} @ {:.1f} Hz from {} samples in {}ms", axis,
+                 out.shaper_type, out.shaper_freq, total_samples, ms);
+    return true;
+}
+
+std::vector<float> shaper_response(const std::string& type, double shaper_freq,
+                                   const std::vector<float>& freqs) {
+    const ShaperDef* def = find_shaper(type);
+    if (!def || shaper_freq <= 0.0) {
+        return {};
+    }
+    Shaper shaper = def->make(shaper_freq, DEFAULT_DAMPING_RATIO);
+    const double inv_d = inverse_amplitude_sum(shaper);
+
+    std::vector<float> response;
+    response.reserve(freqs.size());
+    for (float freq : freqs) {
+        double omega = 2.0 * PI * static_cast<double>(freq);
+        double worst = 0.0;
+        for (double dr : TEST_DAMPING_RATIOS) {
+            double omega_d = omega * std::sqrt(1.0 - dr * dr);
+            worst = std::max(worst, shaper_response_raw(shaper, dr * omega, omega_d));
+        }
+        response.push_back(static_cast<float>(worst * inv_d));
+    }
+    return response;
+}
+
+double shaper_smoothing(const std::string& type, double freq, double accel, double scv) {
+    const ShaperDef* def = find_shaper(type);
+    if (!def || freq <= 0.0) {
+        return -1.0;
+    }
+    return smoothing_terms(def->make(freq, DEFAULT_DAMPING_RATIO), scv).at(accel);
+}
+
+} // namespace calibration
+} // namespace helix
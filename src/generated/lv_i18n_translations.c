@@ -1,10119 +0,0 @@
-// SPDX-License-Identifier: GPL-3.0-or-later
-// Auto-generated by generate_translations.py - DO NOT EDIT
-
-#include "lv_i18n_translations.h"
-
-#include <stddef.h> // For NULL
-#include <string.h> // For strcmp
-
-////////////////////////////////////////////////////////////////////////////////
-// Define plural operands
-// http://unicode.org/reports/tr35/tr35-numbers.html#Operands
-
-#define UNUSED(x) (void)(x)
-
-static inline uint32_t op_n(int32_t val) {
-    return (uint32_t)(val < 0 ? -val : val);
-}
-static inline uint32_t op_i(uint32_t val) {
-    return val;
-}
-static inline uint32_t op_v(uint32_t val) {
-    UNUSED(val);
-    return 0;
-}
-static inline uint32_t op_w(uint32_t val) {
-    UNUSED(val);
-    return 0;
-}
-static inline uint32_t op_f(uint32_t val) {
-    UNUSED(val);
-    return 0;
-}
-static inline uint32_t op_t(uint32_t val) {
-    UNUSED(val);
-    return 0;
-}
-static inline uint32_t op_e(uint32_t val) {
-    UNUSED(val);
-    return 0;
-}
-
-static const char* de_singulars[] = {
-    " / ",                                                      // 0=" / "
-    " 0 / 0",                                                   // 1=" 0 / 0"
-    "#808080",                                                  // 2="#808080"
-    "#RRGGBB",                                                  // 3="#RRGGBB"
-    "(0)",                                                      // 4="(0)"
-    "(2.4GHz)",                                                 // 5="(2.4GHz)"
-    "+",                                                        // 6="+"
-    "+0",                                                       // 7="+0"
-    "+0.01mm",                                                  // 8="+0.01mm"
-    "+0.05mm",                                                  // 9="+0.05mm"
-    "+0.1mm",                                                   // 10="+0.1mm"
-    "+1mm",                                                     // 11="+1mm"
-    "-",                                                        // 12="-"
-    "- Prüfen Sie [resonance_tester] in printer.cfg",           // 13="- Check [resonance_tester] in
-                                                                // printer.cfg"
-    "- Stellen Sie sicher, dass der ADXL345 angeschlossen ist", // 14="- Ensure ADXL345 is
-                                                                // connected"
-    "- Versuchen Sie zuerst Rauschen messen",                   // 15="- Try Measure Noise first"
-    "--",                                                       // 16="--"
-    "---",                                                      // 17="---"
-    "-0.01mm",                                                  // 18="-0.01mm"
-    "-0.05mm",                                                  // 19="-0.05mm"
-    "-0.1mm",                                                   // 20="-0.1mm"
-    "-1mm",                                                     // 21="-1mm"
-    "/",                                                        // 22="/"
-    "0,4-2mm Direct Drive, 4-6mm Bowden",              // 23="0.4-2mm direct drive, 4-6mm bowden"
-    "1. Drucker referenziert und prüft das Bett",      // 24="1. Printer homes and probes the bed"
-    "1. Drucker referenziert und prüft jede Schraube", // 25="1. Printer will home and probe each
-                                                       // screw"
-    "10mm",                                            // 26="10mm"
-    "1mm",                                             // 27="1mm"
-    "2. Papier zwischen Düse und Bett legen",          // 28="2. Place paper between nozzle and bed"
-    "2. Ergebnisse zeigen, wie viel jede Schraube gedreht werden muss", // 29="2. Results show how
-                                                                        // much to turn each screw"
-    "200-230°C",                                                        // 30="200-230°C"
-    "210°C / 60°C",                                                     // 31="210°C / 60°C"
-    "230°C / 50°C",                                                     // 32="230°C / 50°C"
-    "240°C / 80°C",                                                     // 33="240°C / 80°C"
-    "250°C / 100°C",                                                    // 34="250°C / 100°C"
-    "25mm",                                                             // 35="25mm"
-    "3. Schrauben einstellen, dann erneut prüfen", // 36="3. Adjust screws, then re-probe to verify"
-    "3. Düse absenken, bis das Papier leicht schleift",   // 37="3. Lower nozzle until paper drags
-                                                          // slightly"
-    "3D-Vorschau",                                        // 38="3D Preview"
-    "4. Papier sollte sich bewegen, aber mit Widerstand", // 39="4. Paper should move but with
-                                                          // resistance"
-    "4. Wiederholen bis das Bett nivelliert ist",         // 40="4. Repeat until bed is level"
-    "5mm",                                                // 41="5mm"
-    "60°C",                                               // 42="60°C"
-    "6mm",                                                // 43="6mm"
-    "850g",                                               // 44="850g"
-    "= Lösen",                                            // 45="= Loosen"
-    "= Anziehen",                                         // 46="= Tighten"
-    "?",                                                  // 47="?"
-    "ÜBER",                                               // 48="ABOUT"
-    "ABS",                                                // 49="ABS"
-    "AMS-Einstellungen",                                  // 50="AMS Settings"
-    "ERSCHEINUNGSBILD",                                   // 51="APPEARANCE"
-    "AUTOMATISIERUNG",                                    // 52="AUTOMATION"
-    "Abbrechen",                                          // 53="Abort"
-    "Über",                                               // 54="About"
-    "Beschl. zu Verzög.",                                 // 55="Accel to Decel"
-    "Beschleunigung zu Verzögerung Limit (mm/s²)",        // 56="Acceleration to deceleration limit
-                                                          // (mm/s²)"
-    "Beschleunigungssensoren",                            // 57="Accelerometers"
-    "Akzeptieren",                                        // 58="Accept"
-    "Aktion erforderlich",                                // 59="Action Required"
-    "Aktionen",                                           // 60="Actions"
-    "Aktiv",                                              // 61="Active"
-    "Aktuell",                                            // 62="Actual"
-    "Verstecktes Netzwerk hinzufügen",                    // 63="Add Hidden Network"
-    "Bildschirmhelligkeit anpassen",                      // 64="Adjust screen brightness level"
-    "Schrauben einstellen, dann erneut prüfen.",          // 65="Adjust screws, then re-probe."
-    "Anpassungen bleiben bis zum Neustart aktiv. Nach Druckende speichern.", // 66="Adjustments stay
-                                                                             // active until
-                                                                             // restart. Save after
-                                                                             // print completes."
-    "Erweiterte Einstellung",                      // 67="Advanced Setting"
-    "Alle",                                        // 68="All"
-    "Alle Schrauben sind innerhalb der Toleranz.", // 69="All screws are within tolerance."
-    "Allwinner",                                   // 70="Allwinner"
-    "Menge:",                                      // 71="Amount:"
-    "Ein Beschleunigungssensor wurde an Ihrem Drucker erkannt.", // 72="An accelerometer was
-                                                                 // detected on your printer."
-    "Bei der Kalibrierung ist ein Fehler aufgetreten.",          // 73="An error occurred during
-                                                                 // calibration."
-    "Beim Abtasten ist ein Fehler aufgetreten.", // 74="An error occurred during probing."
-    "Beim Laden des Filaments ist ein Fehler aufgetreten.", // 75="An error occurred while loading
-                                                            // filament."
-    "Animationen",                                          // 76="Animations"
-    "App-Hintergrund",                                      // 77="App Background"
-    "Anwenden",                                             // 78="Apply"
-    "Änderungen anwenden",                                  // 79="Apply Changes"
-    "Nur für diese Sitzung speichern", // 80="Apply saves for this session only"
-    "Wird angewendet...",              // 81="Applying..."
-    "Sind Sie sicher, dass Sie diesen Druck abbrechen möchten? Der gesamte Fortschritt geht "
-    "verloren.",      // 82="Are you sure you want to cancel this print? All progress will be lost."
-    "Spule zuweisen", // 83="Assign Spool"
-    "Rolle zuweisen, um Sensorüberwachung zu aktivieren", // 84="Assign a role to enable sensor
-                                                          // monitoring"
-    "Wird Slot 1 zugewiesen",                             // 85="Assigning to Slot 1"
-    "Automatisch",                                        // 86="Auto"
-    "Automatisches Bettnetz",                             // 87="Auto Bed Mesh"
-    "Automatisches Heizen beim Laden",                    // 88="Auto-Heat on Load"
-    "Automatisches Abtasten oder manuelle Prüfung der Schraubenhöhen", // 89="Auto-probe or manually
-                                                                       // check screw heights"
-    "Video automatisch rendern",                                       // 90="Auto-render video"
-    "Automatische PID-Kalibrierung",                              // 91="Automatic PID Calibration"
-    "Spoolman automatisch auf Gewichtsaktualisierungen abfragen", // 92="Automatically poll Spoolman
-                                                                  // for weight updates"
-    "Verfügbare Netzwerke",                                       // 93="Available Networks"
-    "Verfügbare Netzwerke",                                       // 94="Available networks"
-    "Zurück",                                                     // 95="Back"
-    "Sicherung",                                                  // 96="Backup"
-    "Heizbett",                                                   // 97="Bed"
-    "Bettheizung",                                                // 98="Bed Heater"
-    "Bettnivellierung",                                           // 99="Bed Level"
-    "Bettnivellierung",                                           // 100="Bed Leveling"
-    "Bettnetz",                                                   // 101="Bed Mesh"
-    "Bettnetz-Darstellung",                                       // 102="Bed Mesh Render"
-    "Bettschrauben-Einstellung",                                  // 103="Bed Screw Adjustment"
-    "Bettschrauben",                                              // 104="Bed Screws"
-    "Bett ist nivelliert!",                                       // 105="Bed is Level!"
-    "Bett °C",                                                    // 106="Bed °C"
-    "Bett:",                                                      // 107="Bed:"
-    "Schwarz",                                                    // 108="Black"
-    "Bluetooth",                                                  // 109="Bluetooth"
-    "Fließtext unterstützt längere Anleitungen bei guter Lesbarkeit.", // 110="Body text supports
-                                                                       // longer guidance while
-                                                                       // staying readable."
-    "Rahmendeckkraft",                                                 // 111="Border Opacity"
-    "Rahmenradius",                                                    // 112="Border Radius"
-    "Rahmenbreite",                                                    // 113="Border Width"
-    "Rahmentransparenz (0 = unsichtbar, 255 = solid)", // 114="Border transparency (0 = invisible,
-                                                       // 255 = solid)"
-    "Helligkeit",                                      // 115="Brightness"
-    "Durchsuchen",                                     // 116="Browse"
-    "Beschäftigt",                                     // 117="Busy"
-    "Bypass",                                          // 118="Bypass"
-    "Bypass-Modus",                                    // 119="Bypass Mode"
-    "KALIBRIERUNG",                                    // 120="CALIBRATION"
-    "SEIT LETZTER SITZUNG GEÄNDERT",                   // 121="CHANGED FROM LAST SESSION"
-    "FARBEN ERFORDERLICH",                             // 122="COLORS REQUIRED"
-    "KRITISCH",                                        // 123="CRITICAL"
-    "Kalibrieren",                                     // 124="Calibrate"
-    "X kalibrieren",                                   // 125="Calibrate X"
-    "Y kalibrieren",                                   // 126="Calibrate Y"
-    "Resonanzkompensation kalibrieren",                // 127="Calibrate resonance compensation"
-    "Kalibriere...",                                   // 128="Calibrating..."
-    "Kalibrierung",                                    // 129="Calibration"
-    "Kalibrierung & Werkzeuge",                        // 130="Calibration & Tools"
-    "Kalibrierung &amp; Werkzeuge",                    // 131="Calibration &amp; Tools"
-    "Kalibrierung abgeschlossen!",                     // 132="Calibration Complete!"
-    "Kalibrierung fehlgeschlagen",                     // 133="Calibration Failed"
-    "Abbrechen",                                       // 134="Cancel"
-    "Druck abbrechen",                                 // 135="Cancel Print"
-    "Abgebrochen",                                     // 136="Cancelled"
-    "Kammer",                                          // 137="Chamber"
-    "Kammerlüfter",                                    // 138="Chamber Fan"
-    "Kammer- und Trockner-Feuchtigkeitsüberwachung", // 139="Chamber and dryer humidity monitoring"
-    "Kammer:",                                       // 140="Chamber:"
-    "Änderungen werden sofort angewendet. Während des Drucks zur Feinabstimmung anpassen.", // 141="Changes
-                                                                                            // apply
-                                                                                            // immediately.
-                                                                                            // Adjust
-                                                                                            // during
-                                                                                            // print
-                                                                                            // for
-                                                                                            // tuning."
-    "Änderungen sind temporär und werden beim Neustart des Druckers zurückgesetzt", // 142="Changes
-                                                                                    // are temporary
-                                                                                    // and reset on
-                                                                                    // printer
-                                                                                    // reboot"
-    "Prüfen Sie den Filamentpfad und versuchen Sie es erneut.", // 143="Check the filament path and
-                                                                // try again."
-    "Prüfe Slots...",                                           // 144="Checking slots..."
-    "12-Stunden- oder 24-Stunden-Zeitformat wählen", // 145="Choose 12-hour or 24-hour time display"
-    "Anzeigesprache wählen",                         // 146="Choose display language"
-    "Wählen Sie, wie Bilder während des Drucks aufgenommen werden", // 147="Choose how frames are
-                                                                    // captured during printing"
-    "Darstellungsmodus für G-Code-Visualisierung wählen",   // 148="Choose rendering mode for G-code
-                                                            // visualization"
-    "Darstellungsmodus für Bettnetz-Visualisierung wählen", // 149="Choose rendering mode for bed
-                                                            // mesh visualization"
-    "Düse reinigen",                                        // 150="Clean Nozzle"
-    "Löschen",                                              // 151="Clear"
-    "Alles löschen",                                        // 152="Clear All"
-    "Zuweisung löschen",                                    // 153="Clear Assignment"
-    "Zwischenablage nicht verfügbar - verwenden Sie SSH",   // 154="Clipboard unavailable - use SSH"
-    "Schließen",                                            // 155="Close"
-    "Näher = mehr Quetschung | Weiter = weniger Quetschung", // 156="Closer = more squish | Farther
-                                                             // = less squish"
-    "Farbsensoren",                                          // 157="Color Sensors"
-    "Abgeschlossen",                                         // 158="Complete"
-    "Abgeschlossen",                                         // 159="Completed"
-    "In 3 Abtastungen abgeschlossen",                        // 160="Completed in 3 probes"
-    "Konfigurationsdefiniert (schreibgeschützt)",            // 161="Config-defined (read-only)"
-    "G10/G11 Firmware-Retraktion konfigurieren", // 162="Configure G10/G11 firmware retraction"
-    "PRINT_START konfigurieren",                 // 163="Configure PRINT_START"
-    "Spoolman-Integration und Gewichtssynchronisierung konfigurieren.", // 164="Configure Spoolman
-                                                                        // integration and weight
-                                                                        // sync settings."
-    "Geräte in Moonraker konfigurieren",               // 165="Configure devices in Moonraker"
-    "Filamenterkennungssensoren konfigurieren",        // 166="Configure filament detection sensors"
-    "Schnelltasten und Standard-Makros konfigurieren", // 167="Configure quick buttons and standard
-                                                       // macros"
-    "Zeitrafferaufnahme konfigurieren",                // 168="Configure timelapse recording"
-    "Verbinden",                                       // 169="Connect"
-    "Verbunden",                                       // 170="Connected"
-    "Verbinde",                                        // 171="Connecting"
-    "Verbinde mit Netzwerk...",                        // 172="Connecting to network..."
-    "Verbinde...",                                     // 173="Connecting..."
-    "Verbindung",                                      // 174="Connection"
-    "Verbindung fehlgeschlagen. Passwort prüfen.",     // 175="Connection failed. Check password."
-    "Verbindung muss erfolgreich getestet werden, um fortzufahren", // 176="Connection must be
-                                                                    // tested successfully to
-                                                                    // continue"
-    "Konsole",                                                      // 177="Console"
-    "Optionale Druckstartfunktionen steuern",         // 178="Control optional print start features"
-    "Abkühlen",                                       // 179="Cool Down"
-    "Abkühlen",                                       // 180="Cooldown"
-    "Kühlung",                                        // 181="Cooling"
-    "Befehl kopieren",                                // 182="Copy Command"
-    "Eckenrundung (0 = scharf, 40 = sehr rund)",      // 183="Corner roundness (0 = sharp, 40 = very
-                                                      // round)"
-    "Video erstellen wenn Druck abgeschlossen",       // 184="Create video when print completes"
-    "Aktuell / Ziel",                                 // 185="Current / Target"
-    "Aktuelles Netz",                                 // 186="Current Mesh"
-    "Aktuelle Temperatur",                            // 187="Current Temperature"
-    "Aktuelle Z-Position",                            // 188="Current Z Position"
-    "Aktueller Name:",                                // 189="Current name:"
-    "Aktuell geladen",                                // 190="Currently Loaded"
-    "Aktueller Druck",                                // 191="Currently printing"
-    "Benutzerdefiniert...",                           // 192="Custom..."
-    "Filament wird geschnitten...",                   // 193="Cutting filament..."
-    "DIAGNOSE",                                       // 194="DIAGNOSTICS"
-    "DEAKTIVIERT",                                    // 195="DISABLED"
-    "Gefahr",                                         // 196="Danger"
-    "Dunkelmodus",                                    // 197="Dark Mode"
-    "Tag",                                            // 198="Day"
-    "Standard (Wert=50)",                             // 199="Default (value=50)"
-    "Standard-Rahmendicke",                           // 200="Default border thickness"
-    "Makros in Ihrer printer.cfg definieren",         // 201="Define macros in your printer.cfg"
-    "Löschen",                                        // 202="Delete"
-    "Delta:",                                         // 203="Delta:"
-    "Deutsch",                                        // 204="Deutsch"
-    "Geräteoperationen",                              // 205="Device Operations"
-    "Deaktivieren",                                   // 206="Disable"
-    "Gefundene Drucker",                              // 207="Discovered Printers"
-    "Verwerfen",                                      // 208="Dismiss"
-    "Anzeige",                                        // 209="Display"
-    "Anzeigeeinstellungen",                           // 210="Display Settings"
-    "Bildschirm-Ruhezustand",                         // 211="Display Sleep"
-    "Nicht speichern",                                // 212="Don't Save"
-    "Nicht erneut fragen",                            // 213="Don't ask again"
-    "Fertig",                                         // 214="Done"
-    "Schattenstärke (0 = deaktiviert)",               // 215="Drop shadow strength (0 = disabled)"
-    "Trockner",                                       // 216="Dryer"
-    "Trocknersteuerung",                              // 217="Dryer Control"
-    "Dauer",                                          // 218="Duration"
-    "Notaus",                                         // 219="E-Stop"
-    "Notaus-Bestätigung",                             // 220="E-Stop Confirmation"
-    "NOTFALL-STEUERUNG",                              // 221="EMERGENCY CONTROLS"
-    "NOTAUS",                                         // 222="EMERGENCY STOP"
-    "Jeder Lüfter kann nur einmal ausgewählt werden", // 223="Each fan can only be selected once"
-    "Bearbeiten",                                     // 224="Edit"
-    "Voreinstellung bearbeiten",                      // 225="Edit Preset"
-    "Slot 1 bearbeiten",                              // 226="Edit Slot 1"
-    "Themenfarben bearbeiten",                        // 227="Edit Theme Colors"
-    "Themenfarben bearbeiten (Geändert)",             // 228="Edit Theme Colors (Modified)"
-    "Vergangen",                                      // 229="Elapsed"
-    "Notaus",                                         // 230="Emergency Stop"
-    "Notaus (M112)",                                  // 231="Emergency Stop (M112)"
-    "Notaus?",                                        // 232="Emergency Stop?"
-    "Leer",                                           // 233="Empty"
-    "Leere Slots deaktivieren die zugehörige Funktionalität", // 234="Empty slots disable the
-                                                              // associated functionality"
-    "Aktivieren",                                             // 235="Enable"
-    "Überwachung aktivieren",                                 // 236="Enable Monitoring"
-    "Retraktion aktivieren",                                  // 237="Enable Retraction"
-    "Zeitraffer aktivieren",                                  // 238="Enable Timelapse"
-    "UI-Bewegungseffekte aktivieren",                         // 239="Enable UI motion effects"
-    "WiFi aktivieren zum Scannen",                            // 240="Enable WiFi to scan"
-    "WiFi aktivieren, um nach Netzwerken zu suchen", // 241="Enable WiFi to scan for networks"
-    "Akustisches Feedback aktivieren",               // 242="Enable audio feedback"
-    "Detaillierte Druckvorbereitungsverfolgung aktivieren (Empfohlen)", // 243="Enable detailed
-                                                                        // print preparation
-                                                                        // tracking (Recommended)"
-    "Aktiviert",                                                        // 244="Enabled"
-    "Beendet",                                                          // 245="Ended"
-    "Englisch",                                                         // 246="English"
-    "Verbesserung abgeschlossen!",                                  // 247="Enhancement Complete!"
-    "Verbesserung fehlgeschlagen",                                  // 248="Enhancement Failed"
-    "G-Code-Befehl eingeben...",                                    // 249="Enter G-code command..."
-    "WiFi-Passwort eingeben",                                       // 250="Enter WiFi Password"
-    "Geben Sie einen Namen für Ihr benutzerdefiniertes Thema ein:", // 251="Enter a name for your
-                                                                    // custom theme:"
-    "Geben Sie einen Namen ein, um dieses Profil zu speichern", // 252="Enter a name to save this
-                                                                // profile"
-    "Netzwerkname eingeben",                                    // 253="Enter network name"
-    "Passwort eingeben",                                        // 254="Enter password"
-    "Fehler",                                                   // 255="Error"
-    "Fehlerzustand",                                            // 256="Error state"
-    "Spanisch",                                                 // 257="Español"
-    "Ethernet",                                                 // 258="Ethernet"
-    "Ausschließen",                                             // 259="Exclude"
-    "Drucker-Makros ausführen",                                 // 260="Execute printer macros"
-    "Abluftlüfter",                                             // 261="Exhaust Fan"
-    "Erkunden Sie, wie die gewählte Palette Text, Steuerelemente und Statusfarben gestaltet.", // 262="Explore
-                                                                                               // how
-                                                                                               // the
-                                                                                               // selected
-                                                                                               // palette
-                                                                                               // shapes
-                                                                                               // text,
-                                                                                               // controls,
-                                                                                               // and
-                                                                                               // status
-                                                                                               // colors."
-    "Palette erkunden und Vorschau",                         // 263="Explore palette and preview"
-    "Zusätzliches Primen zum Ausgleich von Auslaufen",       // 264="Extra prime to compensate ooze"
-    "Extrudieren",                                           // 265="Extrude"
-    "Extrudieren / Zurückziehen",                            // 266="Extrude / Retract"
-    "Extruder",                                              // 267="Extruder"
-    "Extruder-PID-Abstimmung",                               // 268="Extruder PID Tuning"
-    "Extruder heizt automatisch basierend auf dem Material", // 269="Extruder heats automatically
-                                                             // based on material"
-    "Extrusionsrate",                                        // 270="Extrusion rate"
-    "FEHLGESCHLAGEN",                                        // 271="FAILED"
-    "FILAMENT",                                              // 272="FILAMENT"
-    "Werkseinstellungen",                                    // 273="Factory Reset"
-    "Fehlgeschlagen",                                        // 274="Failed"
-    "Fehler beim Speichern der Thema-Datei",                 // 275="Failed to save theme file"
-    "Filament direkt zum Extruder führen",               // 276="Feed filament directly to extruder"
-    "Filament",                                          // 277="Filament"
-    "Filamentsensor",                                    // 278="Filament Sensor"
-    "Filamentsensoren",                                  // 279="Filament Sensors"
-    "Filament verwendet",                                // 280="Filament Used"
-    "Filament nach Typ",                                 // 281="Filament by Type"
-    "Filamentdurchmessersensoren für Flusskompensation", // 282="Filament diameter sensors for flow
-                                                         // compensation"
-    "Filament-Auslauf- und Bewegungserkennungssensoren", // 283="Filament runout and motion
-                                                         // detection sensors"
-    "Filamentverfolgung und Inventar",                   // 284="Filament tracking and inventory"
-    "Datei",                                             // 285="File"
-    "Dateiinfo",                                         // 286="File Info"
-    "Dateiname",                                         // 287="Filename"
-    "Dateien",                                           // 288="Files"
-    "Füllung: 100% / 75% / 40% / 10%",                   // 289="Fill: 100% / 75% / 40% / 10%"
-    "Firmware-Neustart",                                 // 290="Firmware Restart"
-    "Flache konzentrische Ringe (bestehender ams_slot)", // 291="Flat Concentric Rings (existing
-                                                         // ams_slot)"
-    "Flussrate",                                         // 292="Flow Rate"
-    "Spitze wird geformt...",                            // 293="Forming tip..."
-    "Bildrate",                                          // 294="Framerate"
-    "Französisch",                                       // 295="Français"
-    "Freq",                                              // 296="Freq"
-    "Vorne",                                             // 297="Front"
-    "G-Code-Konsole",                                    // 298="G-code Console"
-    "G-Code-Vorschau",                                   // 299="G-code Preview"
-    "G-Code-Befehle werden hier angezeigt",              // 300="G-code commands will appear here"
-    "Geist:",                                            // 301="Ghost:"
-    "Grau",                                              // 302="Gray"
-    "Happy Hare MMU",                                    // 303="Happy Hare MMU"
-    "Hardware",                                          // 304="Hardware"
-    "Hardware-Zustand",                                  // 305="Hardware Health"
-    "Hardware-Probleme",                                 // 306="Hardware Issues"
-    "Hardware-Name",                                     // 307="Hardware Name"
-    "Hardware wird beim Start und bei Wiederverbindung validiert", // 308="Hardware is validated on
-                                                                   // startup and reconnection"
-    "Halten Sie ein Blatt Papier bereit, bevor Sie beginnen.", // 309="Have a piece of paper ready
-                                                               // before starting."
-    "Halten Sie Ihr Bett-Einstellwerkzeug (Schraubendreher, Inbusschlüssel, etc.) bereit, falls "
-    "Ihr Bett nicht mit Rändelschrauben oder einem anderen eingebauten Mechanismus eingestellt "
-    "wird.", // 310="Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if your bed
-             // isn't adjusted with                              thumb wheels or some other built-in
-             // mechanism."
-    "Überschrift",                        // 311="Heading"
-    "Aufwärmen",                          // 312="Heat Soak"
-    "Auf 170°C erhitzen zum Extrudieren", // 313="Heat to 170°C to extrude"
-    "Heizbett-Temperatur",                // 314="Heatbed Temperature"
-    "Heizbett",                           // 315="Heated Bed"
-    "Heizt...",                           // 316="Heating..."
-    "HelixScreen abgestürzt",             // 317="HelixScreen Crashed"
-    "HelixScreen wird sich mit Ihrem Filamentwechsler für Multi-Spulen/Farb-Druckoperationen "
-    "integrieren.",       // 318="HelixScreen will integrate with your filament changer for
-                          // multi-spool/color print operations."
-    "Höher = schneller",  // 319="Higher = faster"
-    "Home",               // 320="Home"
-    "Alle referenzieren", // 321="Home All"
-    "X referenzieren",    // 322="Home X"
-    "Y referenzieren",    // 323="Home Y"
-    "Z referenzieren",    // 324="Home Z"
-    "Horizontaler Fortschritt (Nivellierungs-Assistent)",   // 325="Horizontal Progress (Leveling
-                                                            // Wizard)"
-    "Host",                                                 // 326="Host"
-    "Hotend",                                               // 327="Hotend"
-    "Hotend-Lüfter",                                        // 328="Hotend Fan"
-    "Hotend-Heizung",                                       // 329="Hotend Heater"
-    "Wie oft Spoolman auf Gewichtsaktualisierungen prüfen", // 330="How often to check Spoolman for
-                                                            // weight updates"
-    "Feuchtigkeit",                                         // 331="Humidity"
-    "Feuchtigkeitssensoren",                                // 332="Humidity Sensors"
-    "IP:",                                                  // 333="IP:"
-    "Leerlauf",                                             // 334="Idle"
-    "Ignorieren",                                           // 335="Ignore"
-    "In Bearbeitung",                                       // 336="In Progress"
-    "G-Code wird indiziert...",                             // 337="Indexing G-code..."
-    "Initialisiere...",                                     // 338="Initializing..."
-    "Eingabe",                                              // 339="Input"
-    "Input Shaper",                                         // 340="Input Shaper"
-    "Input Shaping",                                        // 341="Input Shaping"
-    "Input-Shaper-Kalibrierungssensoren", // 342="Input shaper calibration sensors"
-    "Input Shaping reduziert Vibrationsartefakte (Klingeln) in Ihren Drucken.", // 343="Input
-                                                                                // shaping reduces
-                                                                                // vibration
-                                                                                // artifacts
-                                                                                // (ringing) in your
-                                                                                // prints."
-    "HelixPrint-Plugin installieren", // 344="Install HelixPrint Plugin"
-    "Plugin installieren",            // 345="Install Plugin"
-    "Installieren Sie das HelixPrint-Plugin für schnelle G-Code-Modifikationen. Führen Sie diesen "
-    "Befehl per SSH auf Ihrem Drucker aus:", // 346="Install the HelixPrint plugin to enable fast
-                                             // G-code modifications. Run this command via SSH on
-                                             // your printer:"
-    "Installation fehlgeschlagen",           // 347="Installation Failed"
-    "Die Installation dauert etwa 30 Sekunden.", // 348="Installation takes about 30 seconds."
-    "Installiere...",                            // 349="Installing..."
-    "Intensität",                                // 350="Intensity"
-    "Interaktiver 3D-G-Code während des Drucks", // 351="Interactive 3D G-code during prints"
-    "Interaktive Sondenkalibrierung",            // 352="Interactive probe calibration"
-    "Problembeschreibung",                       // 353="Issue description"
-    "Italienisch",                               // 354="Italiano"
-    "Gerade eben",                               // 355="Just now"
-    "Kd:",                                       // 356="Kd:"
-    "Weiter drucken",                            // 357="Keep Printing"
-    "Erforderlich behalten",                     // 358="Keep Required"
-    "Tastaturtest (Gboard-Stil)",                // 359="Keyboard Test (Gboard-style)"
-    "Ki:",                                       // 360="Ki:"
-    "Klipper",                                   // 361="Klipper"
-    "Klipper ist in den Shutdown-Zustand eingetreten. Dies kann durch einen Notaus, thermisches "
-    "Durchgehen oder einen Konfigurationsfehler verursacht worden sein.", // 362="Klipper has
-                                                                          // entered shutdown state.
-                                                                          // This may be due to an
-                                                                          // emergency stop, thermal
-                                                                          // runaway, or
-                                                                          // configuration error."
-    "Klipper wird neu starten, um Änderungen anzuwenden",      // 363="Klipper will restart to apply
-                                                               // changes"
-    "Klipper wird neu starten, um Änderungen anzuwenden.",     // 364="Klipper will restart to apply
-                                                               // changes."
-    "Klipper wird neu starten, um neue PID-Werte anzuwenden.", // 365="Klipper will restart to apply
-                                                               // new PID values."
-    "Kp:",                                                     // 366="Kp:"
-    "LED-Streifen",                                            // 367="LED Strip"
-    "LED beim Start einschalten",                              // 368="LED on at Start"
-    "GELADEN",                                                 // 369="LOADED"
-    "Sprache",                                                 // 370="Language"
-    "Letzte 7 Tage",                                           // 371="Last 7 days"
-    "Letzter Druck abgebrochen",                               // 372="Last print cancelled"
-    "Letzter Druck fehlgeschlagen",                            // 373="Last print failed"
-    "Später",                                                  // 374="Later"
-    "Schicht",                                                 // 375="Layer"
-    "Schichthöhe",                                             // 376="Layer Height"
-    "Schichtmodus nimmt ein Bild pro Schichtwechsel auf. Am besten für die meisten Drucke.", // 377="Layer
-                                                                                             // mode
-                                                                                             // captures
-                                                                                             // one
-                                                                                             // frame
-                                                                                             // per
-                                                                                             // layer
-                                                                                             // change.
-                                                                                             // Best
-                                                                                             // for
-                                                                                             // most
-                                                                                             // prints."
-    "Schicht:",                                          // 378="Layer:"
-    "Schichten",                                         // 379="Layers"
-    "Länge:",                                            // 380="Length:"
-    "Hell",                                              // 381="Light"
-    "Laden",                                             // 382="Load"
-    "Filament laden",                                    // 383="Load Filament"
-    "Geladen",                                           // 384="Loaded"
-    "Ladefehler",                                        // 385="Loading Error"
-    "G-Code wird geladen...",                            // 386="Loading G-code..."
-    "Filament wird geladen...",                          // 387="Loading filament..."
-    "Lade Verlauf...",                                   // 388="Loading history..."
-    "Lade Spulen...",                                    // 389="Loading spools..."
-    "Lade...",                                           // 390="Loading..."
-    "Während des Drucks gesperrt",                       // 391="Locked during print"
-    "M zum Umschalten",                                  // 392="M to toggle"
-    "MAC:",                                              // 393="MAC:"
-    "MDI-Icons",                                         // 394="MDI Icons"
-    "KONFIGURIERT FEHLT",                                // 395="MISSING CONFIGURED"
-    "BEWEGUNG",                                          // 396="MOTION"
-    "Maschinenlimits",                                   // 397="Machine Limits"
-    "Makro-Browser",                                     // 398="Macro Browser"
-    "Makro-Tasten",                                      // 399="Macro Buttons"
-    "Makro für Bettnetz-Kalibrierung",                   // 400="Macro for bed mesh calibration"
-    "Makro für Kammer/Bett-Aufwärmen",                   // 401="Macro for chamber/bed heat soak"
-    "Makro für physische Bettnivellierung (QGL/Z-Tilt)", // 402="Macro for physical bed leveling
-                                                         // (QGL/Z-Tilt)"
-    "Makro zum Abbrechen eines aktiven Drucks",          // 403="Macro to cancel an active print"
-    "Makro zum Reinigen/Wischen der Düse",               // 404="Macro to clean/wipe the nozzle"
-    "Makro zum Laden von Filament in den Extruder", // 405="Macro to load filament into extruder"
-    "Makro zum Pausieren eines aktiven Drucks",     // 406="Macro to pause an active print"
-    "Makro zum Entlüften/Primen der Düse",          // 407="Macro to purge/prime the nozzle"
-    "Makro zum Fortsetzen eines pausierten Drucks", // 408="Macro to resume a paused print"
-    "Makro zum Entladen von Filament aus dem Extruder", // 409="Macro to unload filament from
-                                                        // extruder"
-    "Makros",                                           // 410="Macros"
-    "Haupt-LED-Streifen",                               // 411="Main LED Strip"
-    "Optional machen",                                  // 412="Make Optional"
-    "Bettnetz und QGL überspringbar machen",            // 413="Make bed mesh and QGL skippable"
-    "Verwalten",                                        // 414="Manage"
-    "Manuelle Bettnivellierung",                        // 415="Manual Bed Leveling"
-    "Material",                                         // 416="Material"
-    "Material Design Spinner",                          // 417="Material Design Spinner"
-    "Max. Beschleunigung",                              // 418="Max Acceleration"
-    "Max. Geschwindigkeit",                             // 419="Max Velocity"
-    "Max. Z-Beschl.",                                   // 420="Max Z Accel"
-    "Max. Z-Geschw.",                                   // 421="Max Z Velocity"
-    "Max. Geschwindigkeit durch Ecken (mm/s)",          // 422="Max speed through corners (mm/s)"
-    "Maximale Beschleunigung (mm/s²)",                  // 423="Maximum acceleration (mm/s²)"
-    "Maximale Werkzeugkopfgeschwindigkeit (mm/s)",      // 424="Maximum toolhead speed (mm/s)"
-    "Rauschen messen",                                  // 425="Measure Noise"
-    "Speicher (MB)",                                    // 426="Memory (MB)"
-    "Netz abgeschlossen",                               // 427="Mesh Complete"
-    "Modus",                                            // 428="Mode"
-    "Geändert",                                         // 429="Modified"
-    "Monat",                                            // 430="Month"
-    "Moonraker",                                        // 431="Moonraker"
-    "Bewegung",                                         // 432="Motion"
-    "Bewegung: XYZ",                                    // 433="Motion: XYZ"
-    "Motoren aus",                                      // 434="Motors Off"
-    "Bewegen",                                          // 435="Move"
-    "Bewegen Sie das Papier während der Einstellung hin und her. Stoppen Sie, wenn das Papier "
-    "leicht greift, aber noch gleitet.",   // 436="Move paper back and forth while adjusting. Stop
-                                           // when paper catches slightly but still slides."
-    "Bewegungsgeschwindigkeit",            // 437="Movement speed"
-    "Multi-Filament",                      // 438="Multi-Filament"
-    "Multi-Material",                      // 439="Multi-Material"
-    "Mein benutzerdefiniertes Thema",      // 440="My Custom Theme"
-    "Mein Panel",                          // 441="My Panel"
-    "Mein Drucker",                        // 442="My Printer"
-    "NEU ENTDECKT",                        // 443="NEWLY DISCOVERED"
-    "BENACHRICHTIGUNGEN",                  // 444="NOTIFICATIONS"
-    "Name",                                // 445="Name"
-    "Netzwerkadresse",                     // 446="Network Address"
-    "Netzwerkname",                        // 447="Network Name"
-    "Netzwerkname (SSID)",                 // 448="Network Name (SSID)"
-    "Netzwerkeinstellungen",               // 449="Network Settings"
-    "Netzwerktest",                        // 450="Network Test"
-    "Nie",                                 // 451="Never"
-    "Neue PID-Werte",                      // 452="New PID Values"
-    "Neuer Z-Offset: 0,000",               // 453="New Z-Offset: 0.000"
-    "Neuer Profilname",                    // 454="New profile name"
-    "Weiter",                              // 455="Next"
-    "Kein AMS-System verbunden.",          // 456="No AMS system connected."
-    "Kein Verlauf",                        // 457="No History"
-    "Keine Makros gefunden",               // 458="No Macros Found"
-    "Keine Stromgeräte",                   // 459="No Power Devices"
-    "Keine Spulen",                        // 460="No Spools"
-    "Keine Datei geladen",                 // 461="No file loaded"
-    "Keine Dateien zum Drucken verfügbar", // 462="No files available for printing"
-    "Kein Netz geladen",                   // 463="No mesh loaded"
-    "Keine Netzwerke gefunden",            // 464="No networks found"
-    "Keine Benachrichtigungen",            // 465="No notifications"
-    "Keine Plugins gefunden",              // 466="No plugins found"
-    "Keine Vorschau",                      // 467="No preview"
-    "Noch kein Druckverlauf",              // 468="No print history yet"
-    "Kein Druckstart-Makro gefunden",      // 469="No print start macro found"
-    "Keine Profile verfügbar",             // 470="No profiles available"
-    "Keine Sensoren erkannt",              // 471="No sensors detected"
-    "Keine Spulen verfügbar",              // 472="No spools available"
-    "Nicht jetzt",                         // 473="Not Now"
-    "Nicht verbunden",                     // 474="Not connected"
-    "Benachrichtigungen",                  // 475="Notifications"
-    "Benachrichtigen wenn Druck beendet",  // 476="Notify when print finishes"
-    "Düse",                                // 477="Nozzle"
-    "Düsen-Priming",                       // 478="Nozzle Priming"
-    "Düsentemp.",                          // 479="Nozzle Temp"
-    "Düsentemperatur",                     // 480="Nozzle Temperature"
-    "Düse °C",                             // 481="Nozzle °C"
-    "Düse:",                               // 482="Nozzle:"
-    "OK",                                  // 483="OK"
-    "Aus",                                 // 484="Off"
-    "Offline",                             // 485="Offline"
-    "Ein",                                 // 486="On"
-    "Öffnen",                              // 487="Open"
-    "Operationen",                         // 488="Operations"
-    "Optimieren Sie Ihren Druck",          // 489="Optimize Your Printing"
-    "Oder manuell eingeben",               // 490="Or Enter Manually"
-    "PETG",                                // 491="PETG"
-    "PID-Abstimmung",                      // 492="PID Tuning"
-    "PID-Abstimmung optimiert die Temperaturregelung für stabiles Heizen.", // 493="PID tuning
-                                                                            // optimizes temperature
-                                                                            // control for stable
-                                                                            // heating."
-    "PLA",                                                                  // 494="PLA"
-    "PLA - Schwarz",                                                        // 495="PLA - Black"
-    "VOR-DRUCK-SCHRITTE",                                                   // 496="PRE-PRINT STEPS"
-    "DRUCKER",                                                              // 497="PRINTER"
-    "Papiertest-Kalibrierung",                // 498="Paper Test Calibration"
-    "Teile-Kühllüfter",                       // 499="Part Cooling Fan"
-    "Teile-Lüfter",                           // 500="Part Fan"
-    "Passwort",                               // 501="Password"
-    "Passwort darf nicht leer sein",          // 502="Password cannot be empty"
-    "Pause",                                  // 503="Pause"
-    "Pausiert",                               // 504="Paused"
-    "Pausiert (Aufmerksamkeit erforderlich)", // 505="Paused (attention needed)"
-    "Spitze:",                                // 506="Peak:"
-    "Phasenverfolgung",                       // 507="Phase Tracking"
-    "Farbe wählen",                           // 508="Pick Color"
-    "Platzieren Sie Plugins im Plugin-Verzeichnis, um HelixScreen zu erweitern", // 509="Place
-                                                                                 // plugins in the
-                                                                                 // plugins
-                                                                                 // directory to
-                                                                                 // extend
-                                                                                 // HelixScreen"
-    "Bitte geben Sie einen Themennamen ein", // 510="Please enter a theme name"
-    "Bitte warten Sie, während der Drucker referenziert und abtastet.", // 511="Please wait while
-                                                                        // the printer homes and
-                                                                        // probes."
-    "Bitte warten Sie, während der Drucker jede Schraubenposition abtastet.", // 512="Please wait
-                                                                              // while the printer
-                                                                              // probes each screw
-                                                                              // position."
-    "Plugin erfolgreich installiert.",                // 513="Plugin installed successfully."
-    "Plugins",                                        // 514="Plugins"
-    "Plugins werden beim Anwendungsstart erkannt",    // 515="Plugins are discovered on application
-                                                      // startup"
-    "Polymaker",                                      // 516="Polymaker"
-    "Port",                                           // 517="Port"
-    "Portugiesisch",                                  // 518="Português"
-    "Position",                                       // 519="Position"
-    "Strom",                                          // 520="Power"
-    "Stromsteuerung",                                 // 521="Power Control"
-    "Vorheizen",                                      // 522="Preheat"
-    "Druck wird vorbereitet",                         // 523="Preparing Print"
-    "Vorbereiten...",                                 // 524="Preparing..."
-    "Voreinstellungen",                               // 525="Presets"
-    "Zurück",                                         // 526="Previous"
-    "Primär",                                         // 527="Primary"
-    "Drucken",                                        // 528="Print"
-    "Druck abgebrochen",                              // 529="Print Cancelled"
-    "Druck abgeschlossen",                            // 530="Print Complete"
-    "Druck abgeschlossen!",                           // 531="Print Complete!"
-    "Druckabschluss-Benachrichtigung",                // 532="Print Completion Alert"
-    "Druckdetails",                                   // 533="Print Details"
-    "Druckdatei",                                     // 534="Print File"
-    "Druckdateien",                                   // 535="Print Files"
-    "Druckverlauf",                                   // 536="Print History"
-    "Druckstunden",                                   // 537="Print Hours"
-    "Druckgeschwindigkeit",                           // 538="Print Speed"
-    "Druckstatus",                                    // 539="Print Status"
-    "Druckzeit",                                      // 540="Print Time"
-    "Druck-Feinabstimmung",                           // 541="Print Tuning"
-    "Drucker",                                        // 542="Printer"
-    "Druckername",                                    // 543="Printer Name"
-    "Drucker-Shutdown",                               // 544="Printer Shutdown"
-    "Druckertyp",                                     // 545="Printer Type"
-    "Druckt",                                         // 546="Printing"
-    "Drucktrend",                                     // 547="Prints Trend"
-    "Privat:",                                        // 548="Private:"
-    "Sonde",                                          // 549="Probe"
-    "Abtastsensor",                                   // 550="Probe Sensor"
-    "Abtastsensoren",                                 // 551="Probe Sensors"
-    "Bettnetz wird abgetastet",                       // 552="Probing Bed Mesh"
-    "Bettschrauben werden abgetastet...",             // 553="Probing Bed Screws..."
-    "Bett wird abgetastet...",                        // 554="Probing Bed..."
-    "Abtasten fehlgeschlagen",                        // 555="Probing Failed"
-    "Verarbeite...",                                  // 556="Processing..."
-    "Profil",                                         // 557="Profile"
-    "Profilname (z.B. Standard)",                     // 558="Profile name (e.g., default)"
-    "Profile",                                        // 559="Profiles"
-    "Fortschritt",                                    // 560="Progress"
-    "Fortschrittsbalken-Tests",                       // 561="Progress Bar Tests"
-    "Entlüften",                                      // 562="Purge"
-    "50mm entlüften",                                 // 563="Purge 50mm"
-    "SCHNELLTASTEN",                                  // 564="QUICK BUTTONS"
-    "Quad Gantry Level",                              // 565="Quad Gantry Level"
-    "Schnellaktionen",                                // 566="Quick Actions"
-    "Schnelltaste 1",                                 // 567="Quick Button 1"
-    "Schnelltaste 2",                                 // 568="Quick Button 2"
-    "Schnellaktionen, Kalibrierung, Geschwindigkeit", // 569="Quick actions, calibration, speed"
-    "RSS:",                                           // 570="RSS:"
-    "Erneut abtasten",                                // 571="Re-probe"
-    "Bereit",                                         // 572="Ready"
-    "Empfohlen",                                      // 573="Recommended"
-    "Empfohlen: 200°C für Extruder",                  // 574="Recommended: 200°C for extruder"
-    "Zeitraffer aufnehmen",                           // 575="Record Timelapse"
-    "Zeitraffer Ihrer Drucke aufnehmen",              // 576="Record timelapses of your prints"
-    "Aufnahmemodus",                                  // 577="Recording Mode"
-    "Wiederherstellen",                               // 578="Recover"
-    "Klingeln reduzieren",                            // 579="Reduce Ringing"
-    "Aktualisieren",                                  // 580="Refresh"
-    "Aktualisierungsintervall",                       // 581="Refresh Interval"
-    "Verbleibend",                                    // 582="Remaining"
-    "Plugin vom Drucker entfernen",                   // 583="Remove plugin from printer"
-    "Umbenennen",                                     // 584="Rename"
-    "Netzprofil umbenennen",                          // 585="Rename Mesh Profile"
-    "Erneut drucken",                                 // 586="Reprint"
-    "Bestätigung vor Notaus erforderlich",  // 587="Require confirmation before emergency stop"
-    "Erfordert Moonraker-Timelapse-Plugin", // 588="Requires Moonraker-Timelapse plugin"
-    "Zurücksetzen",                         // 589="Reset"
-    "Geschwindigkeit & Fluss auf 100% zurücksetzen",     // 590="Reset Speed & Flow to 100%"
-    "Geschwindigkeit &amp; Fluss auf 100% zurücksetzen", // 591="Reset Speed &amp; Flow to 100%"
-    "Alle Einstellungen zurücksetzen und Assistenten neu starten", // 592="Reset all settings and
-                                                                   // restart wizard"
-    "Wird zurückgesetzt...",                                       // 593="Resetting..."
-    "Resonanzkompensations-Abstimmung",                  // 594="Resonance compensation tuning"
-    "HelixScreen neu starten",                           // 595="Restart HelixScreen"
-    "Klipper neu starten",                               // 596="Restart Klipper"
-    "Jetzt neu starten",                                 // 597="Restart Now"
-    "Neustart erforderlich",                             // 598="Restart Required"
-    "Anzeigeanwendung neu starten",                      // 599="Restart the display application"
-    "Fortsetzen",                                        // 600="Resume"
-    "Druck fortsetzen",                                  // 601="Resume Print"
-    "Zurückziehen",                                      // 602="Retract"
-    "Rückzugslänge",                                     // 603="Retract Length"
-    "Rückzugsgeschwindigkeit",                           // 604="Retract Speed"
-    "Rückzugseinstellungen",                             // 605="Retraction Settings"
-    "Wiederholen",                                       // 606="Retry"
-    "Erkannte Hardware-Validierungsprobleme überprüfen", // 607="Review detected hardware validation
-                                                         // issues"
-    "Ihre Änderungen überprüfen",                        // 608="Review your changes"
-    "Rolle:",                                            // 609="Role:"
-    "Auslaufsensor",                                     // 610="Runout Sensor"
-    "STANDARD-MAKROS",                                   // 611="STANDARD MACROS"
-    "STOPP",                                             // 612="STOP"
-    "STIL-EIGENSCHAFTEN",                                // 613="STYLE PROPERTIES"
-    "SYSTEM",                                            // 614="SYSTEM"
-    "Speichern",                                         // 615="Save"
-    "Speichern & Neu starten",                           // 616="Save & Restart"
-    "Speichern &amp; Neu starten",                       // 617="Save &amp; Restart"
-    "Als neu speichern",                                 // 618="Save As New"
-    "Konfiguration speichern",                           // 619="Save Config"
-    "Druckerkonfiguration speichern",                    // 620="Save Printer Configuration"
-    "Thema speichern als",                               // 621="Save Theme As"
-    "Z-Offset speichern",                                // 622="Save Z-Offset"
-    "Z-Offset speichern?",                               // 623="Save Z-Offset?"
-    "Änderungen speichern, um sie über Neustarts hinweg zu erhalten?", // 624="Save changes to
-                                                                       // persist them across
-                                                                       // restarts?"
-    "Konfiguration wird gespeichert...", // 625="Saving Configuration..."
-    "Speichern startet Klipper neu und BRICHT jeden aktiven Druck ab!", // 626="Saving will restart
-                                                                        // Klipper and CANCEL any
-                                                                        // active print!"
-    "Suche nach Netzwerken...", // 627="Scanning for networks..."
-    "Bildschirm dimmen",        // 628="Screen Dim"
-    "Bildschirm dimmt nach Inaktivitätszeitraum auf niedrigere Helligkeit", // 629="Screen dims to
-                                                                            // lower brightness
-                                                                            // after period of
-                                                                            // inactivity"
-    "Bildschirm dimmt nach dem gewählten Inaktivitätszeitraum", // 630="Screen will dim after the
-                                                                // selected period of inactivity"
-    "Scroll-Geschwindigkeit",                                   // 631="Scroll Speed"
-    "Dateiname suchen...",                                      // 632="Search filename..."
-    "Sekundär",                                                 // 633="Secondary"
-    "Sicherheit",                                               // 634="Security"
-    "Auswählen",                                                // 635="Select"
-    "Wählen Sie 'Keine', wenn Sie keinen Filamentsensor haben oder nicht bei Auslaufen pausieren "
-    "möchten.", // 636="Select 'None' if you don't have a filament sensor, or if you don't want to
-                // pause on runout."
-    "Wählen Sie 'Keine', wenn Sie eine dedizierte Sonde haben oder keine Bettnetz-Nivellierung "
-    "verwenden.",         // 637="Select 'None' if you have a dedicated probe, or don't use bed mesh
-                          // leveling."
-    "Filament auswählen", // 638="Select Filament"
-    "Datei wählen",       // 639="Select File"
-    "G-Code-Datei auswählen",                          // 640="Select G-Code File"
-    "Heizung auswählen",                               // 641="Select Heater"
-    "Makro für erste Taste auswählen",                 // 642="Select macro for first button"
-    "Makro für zweite Taste auswählen",                // 643="Select macro for second button"
-    "Slot wird ausgewählt...",                         // 644="Selecting slot..."
-    "Semantische Größenparameter-Tests",               // 645="Semantic Size Parameter Tests"
-    "Befehle direkt an Drucker senden",                // 646="Send commands directly to printer"
-    "Sensoren",                                        // 647="Sensors"
-    "Setzen ",                                         // 648="Set "
-    "Einstellungen",                                   // 649="Settings"
-    "Schattenintensität",                              // 650="Shadow Intensity"
-    "Shaper",                                          // 651="Shaper"
-    "Glanz:",                                          // 652="Shininess:"
-    "Detaillierten Druckvorbereitungsstatus anzeigen", // 653="Show detailed print preparation
-                                                       // status"
-    "Seite",                                           // 654="Side"
-    "Größe",                                           // 655="Size"
-    "Vorerst überspringen",                            // 656="Skip for now"
-    "Slot 1",                                          // 657="Slot 1"
-    "Kleine Beschriftungen helfen, Steuerelemente ruhig und fokussiert zu halten.", // 658="Small
-                                                                                    // labels help
-                                                                                    // keep controls
-                                                                                    // calm and
-                                                                                    // focused."
-    "Einige Einstellungen werden nach dem Neustart wirksam.", // 659="Some settings will take effect
-                                                              // after restart."
-    "Töne",                                                   // 660="Sounds"
-    "Spiegelung:",                                            // 661="Specular:"
-    "Geschwindigkeit",                                        // 662="Speed"
-    "Geschwindigkeitseinstellungen",                          // 663="Speed Settings"
-    "Geschwindigkeit der Prime-Bewegung",                     // 664="Speed of prime movement"
-    "Geschwindigkeit der Rückzugsbewegung",                   // 665="Speed of retraction movement"
-    "Geschw.:",                                               // 666="Speed:"
-    "Spulen-Visualisierung (Pseudo-3D-Canvas)", // 667="Spool Visualization (Pseudo-3D Canvas)"
-    "Spoolman",                                 // 668="Spoolman"
-    "Spoolman hat keine Spulen konfiguriert",   // 669="Spoolman has no spools configured"
-    "Eckgeschwindigkeit",                       // 670="Square Corner Velocity"
-    "Bereitschaft",                             // 671="Standby"
-    "Kalibrierung starten",                     // 672="Start Calibration"
-    "Abtasten starten",                         // 673="Start Probing"
-    "Gestartet",                                // 674="Started"
-    "Status",                                   // 675="Status"
-    "Status-Icons",                             // 676="Status icons"
-    "Schritt",                                  // 677="Step"
-    "Schrittfortschritts-Widget-Test",          // 678="Step Progress Widget Test"
-    "Stoppen",                                  // 679="Stop"
-    "Trocknen stoppen",                         // 680="Stop Drying"
-    "Druck stoppen?",                           // 681="Stop Print?"
-    "Stoppt alle Bewegung. Erfordert Firmware-Neustart.", // 682="Stops all motion. Requires
-                                                          // firmware restart."
-    "Gestaltet (Wert=75)",                                // 683="Styled (value=75)"
-    "Erfolgsrate",                                        // 684="Success Rate"
-    "Erfolg!",                                            // 685="Success!"
-    "Oberflächen erben App-Hintergrund-Tokens für Hell- und Dunkelmodus.", // 686="Surfaces inherit
-                                                                           // app background tokens
-                                                                           // for light and dark
-                                                                           // modes."
-    "Schaltersensoren",                                                    // 687="Switch Sensors"
-    "Zwischen Hell- und Dunkelthemen wechseln",  // 688="Switch between light and dark themes"
-    "Mit Spoolman synchronisieren",              // 689="Sync to Spoolman"
-    "Mit Spoolman synchronisieren",              // 690="Sync with Spoolman"
-    "Sysfs",                                     // 691="Sysfs"
-    "System erkannt",                            // 692="System detected"
-    "TD-1-Filamentfarberkennung",                // 693="TD-1 filament color detection"
-    "THEMENFARBEN",                              // 694="THEME COLORS"
-    "TPU",                                       // 695="TPU"
-    "Tippen Sie, um die Tastatur anzuzeigen...", // 696="Tap to show keyboard..."
-    "Ziel",                                      // 697="Target"
-    "Zieltemperatur",                            // 698="Target Temperature"
-    "Temperatur",                                // 699="Temperature"
-    "Temperaturen",                              // 700="Temperatures"
-    "Temporäre Anpassung für diesen Druck, sofern nicht im Steuerungspanel gespeichert", // 701="Temporary
-                                                                                         // adjustment
-                                                                                         // for this
-                                                                                         // print,
-                                                                                         // unless
-                                                                                         // saved on
-                                                                                         // Controls
-                                                                                         // panel"
-    "Tertiär",           // 702="Tertiary"
-    "Verbindung testen", // 703="Test Connection"
-    "Netzwerk testen",   // 704="Test Network"
-    "Testdruck",         // 705="Test Print"
-    "Das HelixPrint-Plugin ermöglicht schnelle G-Code-Modifikationen direkt auf Ihrem Drucker – "
-    "wie das Überspringen des Bettnetzes für schnelle Neudrucke.", // 706="The HelixPrint plugin
-                                                                   // enables fast G-code
-                                                                   // modifications directly on your
-                                                                   // printer—like skipping bed mesh
-                                                                   // for quick reprints."
-    "Die Heizung wird mehrmals ein- und ausschalten.",    // 707="The heater will cycle on and off
-                                                          // several times."
-    "Thema",                                              // 708="Theme"
-    "Themenfarben",                                       // 709="Theme Colors"
-    "Thema-Voreinstellung",                               // 710="Theme Preset"
-    "Themenänderungen werden nach dem Neustart wirksam.", // 711="Theme changes apply after
-                                                          // restart."
-    "Themenänderungen werden nach dem Neustart wirksam.", // 712="Theme changes will take effect
-                                                          // after restart."
-    "Thema, Helligkeit und Ruhezustandseinstellungen",    // 713="Theme, brightness, and sleep
-                                                          // settings"
-    "Dünner Balken (Höhe=8)",                             // 714="Thin bar (height=8)"
-    "Diese Kalibrierung verwendet die Papierreibungsmethode zur Einstellung Ihres Z-Offsets.", // 715="This
-                                                                                               // calibration
-                                                                                               // uses
-                                                                                               // the
-                                                                                               // paper
-                                                                                               // friction
-                                                                                               // method
-                                                                                               // to
-                                                                                               // set
-                                                                                               // your
-                                                                                               // Z-offset."
-    "Dies kann 1-2 Minuten dauern",        // 716="This may take 1-2 minutes"
-    "Dies kann bis zu 30 Sekunden dauern", // 717="This may take up to 30 seconds"
-    "Dieses Plugin ermöglicht HelixScreen die Steuerung von Druckstartoptionen wie Bettnetz und "
-    "QGL. Nach der Installation verwenden Sie PRINT_START konfigurieren unten, um optionale "
-    "Schritte zu aktivieren.", // 718="This plugin lets HelixScreen control print start options like
-                               // bed mesh and QGL. Once installed, use Configure PRINT_START below
-                               // to enable optional steps."
-    "Dieser Vorgang dauert 3-5 Minuten. Nicht unterbrechen.", // 719="This process takes 3-5
-                                                              // minutes. Do not interrupt."
-    "Dieses Werkzeug tastet jede Bettschraube ab und zeigt Ihnen, wie viel Sie einstellen müssen.", // 720="This tool probes each bed screw and tells you how much to adjust."
-    "Dies stoppt sofort alle Druckeroperationen. Der Drucker erfordert einen Neustart, um "
-    "fortzufahren.", // 721="This will immediately halt all printer operations. The printer will
-                     // require a restart to resume."
-    "Dies setzt alle Einstellungen auf die Standardwerte zurück. Diese Aktion kann nicht "
-    "rückgängig gemacht werden.", // 722="This will reset all settings to defaults. This action
-                                  // cannot be undone."
-    "Dies startet Klipper neu.",  // 723="This will restart Klipper."
-    "Zeit",                       // 724="Time"
-    "Zeitformat",                 // 725="Time Format"
-    "Zeitraffer",                 // 726="Timelapse"
-    "Zeitraffer verfügbar",       // 727="Timelapse Available"
-    "Zeitraffer-Einstellungen",   // 728="Timelapse Settings"
-    "Tipp:",                      // 729="Tip:"
-    "Funktion umschalten",        // 730="Toggle Feature"
-    "Werkzeug",                   // 731="Tool"
-    "Werkzeugwechsler",           // 732="Tool Changer"
-    "Oben",                       // 733="Top"
-    "Gesamte Drucke",             // 734="Total Prints"
-    "Touch-Kalibrierung",         // 735="Touch Calibration"
-    "Tippen Sie irgendwo, um die Kalibrierung zu testen", // 736="Touch anywhere to test
-                                                          // calibration"
-    "Touchscreen berühren zum Aufwecken",                 // 737="Touch screen to wake from sleep"
-    "Verfahrwege",                                        // 738="Travels"
-    "Fehlerbehebung:",                                    // 739="Troubleshooting:"
-    "Abstimmen",                                          // 740="Tune"
-    "Heizungs-PID-Parameter abstimmen",                   // 741="Tune heater PID parameters"
-    "LED beim Druckerstart einschalten",                  // 742="Turn on LED when printer starts"
-    "Typ",                                                // 743="Type"
-    "Tippen Sie zur Vorschau des Eingabefeldes...",       // 744="Type to preview input field..."
-    "USB",                                                // 745="USB"
-    "HelixPrint-Plugin deinstallieren",                   // 746="Uninstall HelixPrint Plugin"
-    "Unbekannt",                                          // 747="Unknown"
-    "Unbekannte Spule",                                   // 748="Unknown Spool"
-    "Unbekannter Schritt",                                // 749="Unknown Step"
-    "Entladen",                                           // 750="Unload"
-    "Filament entladen",                                  // 751="Unload Filament"
-    "Filament wird entladen...",                          // 752="Unloading filament..."
-    "Zusätzliches Primen",                                // 753="Unretract Extra"
-    "Prime-Geschwindigkeit",                              // 754="Unretract Speed"
-    "Laden Sie G-Code-Dateien hoch, um zu beginnen",      // 755="Upload gcode files to get started"
-    "G10/G11-Firmware-Retraktion verwenden",              // 756="Use G10/G11 firmware retraction"
-    "ValgACE (ACE Pro)",                                  // 757="ValgACE (ACE Pro)"
-    "Werte wurden in der Druckerkonfiguration gespeichert.", // 758="Values have been saved to
-                                                             // printer configuration."
-    "Geschwindigkeits- und Beschleunigungslimits",   // 759="Velocity and acceleration limits"
-    "Hersteller",                                    // 760="Vendor"
-    "Version",                                       // 761="Version"
-    "Vertikaler Fortschritt (Rückzugs-Assistent)",   // 762="Vertical Progress (Retract Wizard)"
-    "Vibration",                                     // 763="Vibration"
-    "Videowiedergabegeschwindigkeit",                // 764="Video playback speed"
-    "Vollständigen Verlauf anzeigen",                // 765="View Full History"
-    "Voreinstellungen anzeigen",                     // 766="View Presets"
-    "Zeitraffer ansehen",                            // 767="View Timelapse"
-    "Installierte Plugins und Status anzeigen",      // 768="View installed plugins and status"
-    "Druckstatistiken und Auftragsverlauf anzeigen", // 769="View print statistics and job history"
-    "Warnung",                                       // 770="Warning"
-    "Woche",                                         // 771="Week"
-    "Gewichtsdaten werden von Spoolman synchronisiert, um verbleibendes Filament anzuzeigen. "
-    "Änderungen werden auch synchronisiert, wenn Drucke starten, pausieren oder abgeschlossen "
-    "werden.", // 772="Weight data is synced from Spoolman to display remaining filament. Changes
-               // are also synced when prints start, pause, or complete."
-    "Gewichtssynchronisierungs-Einstellungen",           // 773="Weight sync settings"
-    "Weiß",                                              // 774="White"
-    "WiFi",                                              // 775="WiFi"
-    "WiFi-Netzwerk",                                     // 776="WiFi Network"
-    "WiFi und Ethernet",                                 // 777="WiFi and Ethernet"
-    "WiFi- und Ethernet-Konfiguration",                  // 778="WiFi and Ethernet configuration"
-    "WiFi-Steuerung nicht verfügbar",                    // 779="WiFi control unavailable"
-    "WiFi-Hardware nicht verfügbar",                     // 780="WiFi hardware unavailable"
-    "Breite",                                            // 781="Width"
-    "Breitensensoren",                                   // 782="Width Sensors"
-    "X:",                                                // 783="X:"
-    "XY",                                                // 784="XY"
-    "Y:",                                                // 785="Y:"
-    "Jahr",                                              // 786="Year"
-    "Ihre abgeschlossenen Drucke werden hier angezeigt", // 787="Your completed prints will appear
-                                                         // here"
-    "Z",                                                 // 788="Z"
-    "Z-Kalibrierung",                                    // 789="Z Calibration"
-    "Z-Bereich",                                         // 790="Z Range"
-    "Z-Sonden für Bettnivellierung und Netzerzeugung",   // 791="Z probes for bed leveling and mesh
-                                                         // generation"
-    "Z-Offset",                                          // 792="Z-Offset"
-    "Z-Offset-Kalibrierung",                             // 793="Z-Offset Calibration"
-    "Z-Offset:",                                         // 794="Z-Offset:"
-    "Z-Tilt-Anpassung",                                  // 795="Z-Tilt Adjust"
-    "Z:",                                                // 796="Z:"
-    "Z: 0,000",                                          // 797="Z: 0.000"
-    "Zoom",                                              // 798="Zoom"
-    "^ VORNE",                                           // 799="^ FRONT"
-    "Stunde",                                            // 800="hour"
-    "Stunden",                                           // 801="hours"
-    "lg",                                                // 802="lg"
-    "md",                                                // 803="md"
-    "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-    "Minute",                               // 805="minute"
-    "Minuten",                              // 806="minutes"
-    "mzv @ 36,7 Hz",                        // 807="mzv @ 36.7 Hz"
-    "Sekunden",                             // 808="seconds"
-    "size=\"large\"",                       // 809="size="large""
-    "size=\"medium\"",                      // 810="size="medium""
-    "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-    "size=\"small\"",                       // 812="size="small""
-    "size=\"tiny\"",                        // 813="size="tiny""
-    "sm",                                   // 814="sm"
-    "true",                                 // 815="true"
-    "value=0 (zeigt VOLL - FEHLER!)",       // 816="value=0 (shows FULL - BUG!)"
-    "value=1 (kleiner Splitter?)",          // 817="value=1 (tiny sliver?)"
-    "value=100 (sollte voll sein)",         // 818="value=100 (should be full)"
-    "xs",                                   // 819="xs"
-    "Russisch",                             // 820="Русский"
-    "—",                                    // 821="—"
-    "•",                                    // 822="•"
-    "Chinesisch",                           // 823="中文"
-    "Japanisch",                            // 824="日本語"
-    "󰅐",                                 // 825="󰅐"
-    "󰉋",                                 // 826="󰉋"
-    "󱧰",                                 // 827="󱧰"
-};
-
-static const char*
-    en_singulars[] =
-        {
-            " / ",                                       // 0=" / "
-            " 0 / 0",                                    // 1=" 0 / 0"
-            "#808080",                                   // 2="#808080"
-            "#RRGGBB",                                   // 3="#RRGGBB"
-            "(0)",                                       // 4="(0)"
-            "(2.4GHz)",                                  // 5="(2.4GHz)"
-            "+",                                         // 6="+"
-            "+0",                                        // 7="+0"
-            "+0.01mm",                                   // 8="+0.01mm"
-            "+0.05mm",                                   // 9="+0.05mm"
-            "+0.1mm",                                    // 10="+0.1mm"
-            "+1mm",                                      // 11="+1mm"
-            "-",                                         // 12="-"
-            "- Check [resonance_tester] in printer.cfg", // 13="- Check [resonance_tester] in
-                                                         // printer.cfg"
-            "- Ensure ADXL345 is connected",             // 14="- Ensure ADXL345 is connected"
-            "- Try Measure Noise first",                 // 15="- Try Measure Noise first"
-            "--",                                        // 16="--"
-            "---",                                       // 17="---"
-            "-0.01mm",                                   // 18="-0.01mm"
-            "-0.05mm",                                   // 19="-0.05mm"
-            "-0.1mm",                                    // 20="-0.1mm"
-            "-1mm",                                      // 21="-1mm"
-            "/",                                         // 22="/"
-            "0.4-2mm direct drive, 4-6mm bowden",        // 23="0.4-2mm direct drive, 4-6mm bowden"
-            "1. Printer homes and probes the bed",       // 24="1. Printer homes and probes the bed"
-            "1. Printer will home and probe each screw", // 25="1. Printer will home and probe each
-                                                         // screw"
-            "10mm",                                      // 26="10mm"
-            "1mm",                                       // 27="1mm"
-            "2. Place paper between nozzle and bed", // 28="2. Place paper between nozzle and bed"
-            "2. Results show how much to turn each screw", // 29="2. Results show how much to turn
-                                                           // each screw"
-            "200-230°C",                                   // 30="200-230°C"
-            "210°C / 60°C",                                // 31="210°C / 60°C"
-            "230°C / 50°C",                                // 32="230°C / 50°C"
-            "240°C / 80°C",                                // 33="240°C / 80°C"
-            "250°C / 100°C",                               // 34="250°C / 100°C"
-            "25mm",                                        // 35="25mm"
-            "3. Adjust screws, then re-probe to verify",   // 36="3. Adjust screws, then re-probe to
-                                                           // verify"
-            "3. Lower nozzle until paper drags slightly",  // 37="3. Lower nozzle until paper drags
-                                                           // slightly"
-            "3D Preview",                                  // 38="3D Preview"
-            "4. Paper should move but with resistance",    // 39="4. Paper should move but with
-                                                           // resistance"
-            "4. Repeat until bed is level",                // 40="4. Repeat until bed is level"
-            "5mm",                                         // 41="5mm"
-            "60°C",                                        // 42="60°C"
-            "6mm",                                         // 43="6mm"
-            "850g",                                        // 44="850g"
-            "= Loosen",                                    // 45="= Loosen"
-            "= Tighten",                                   // 46="= Tighten"
-            "?",                                           // 47="?"
-            "ABOUT",                                       // 48="ABOUT"
-            "ABS",                                         // 49="ABS"
-            "AMS Settings",                                // 50="AMS Settings"
-            "APPEARANCE",                                  // 51="APPEARANCE"
-            "AUTOMATION",                                  // 52="AUTOMATION"
-            "Abort",                                       // 53="Abort"
-            "About",                                       // 54="About"
-            "Accel to Decel",                              // 55="Accel to Decel"
-            "Acceleration to deceleration limit (mm/s²)",  // 56="Acceleration to deceleration limit
-                                                           // (mm/s²)"
-            "Accelerometers",                              // 57="Accelerometers"
-            "Accept",                                      // 58="Accept"
-            "Action Required",                             // 59="Action Required"
-            "Actions",                                     // 60="Actions"
-            "Active",                                      // 61="Active"
-            "Actual",                                      // 62="Actual"
-            "Add Hidden Network",                          // 63="Add Hidden Network"
-            "Adjust screen brightness level",              // 64="Adjust screen brightness level"
-            "Adjust screws, then re-probe.",               // 65="Adjust screws, then re-probe."
-            "Adjustments stay active until restart. Save after print completes.", // 66="Adjustments
-                                                                                  // stay active
-                                                                                  // until restart.
-                                                                                  // Save after
-                                                                                  // print
-                                                                                  // completes."
-            "Advanced Setting",                 // 67="Advanced Setting"
-            "All",                              // 68="All"
-            "All screws are within tolerance.", // 69="All screws are within tolerance."
-            "Allwinner",                        // 70="Allwinner"
-            "Amount:",                          // 71="Amount:"
-            "An accelerometer was detected on your printer.", // 72="An accelerometer was detected
-                                                              // on your printer."
-            "An error occurred during calibration.", // 73="An error occurred during calibration."
-            "An error occurred during probing.",     // 74="An error occurred during probing."
-            "An error occurred while loading filament.", // 75="An error occurred while loading
-                                                         // filament."
-            "Animations",                                // 76="Animations"
-            "App Background",                            // 77="App Background"
-            "Apply",                                     // 78="Apply"
-            "Apply Changes",                             // 79="Apply Changes"
-            "Apply saves for this session only",         // 80="Apply saves for this session only"
-            "Applying...",                               // 81="Applying..."
-            "Are you sure you want to cancel this print? All progress will be lost.", // 82="Are you
-                                                                                      // sure you
-                                                                                      // want to
-                                                                                      // cancel this
-                                                                                      // print? All
-                                                                                      // progress
-                                                                                      // will be
-                                                                                      // lost."
-            "Assign Spool",                               // 83="Assign Spool"
-            "Assign a role to enable sensor monitoring",  // 84="Assign a role to enable sensor
-                                                          // monitoring"
-            "Assigning to Slot 1",                        // 85="Assigning to Slot 1"
-            "Auto",                                       // 86="Auto"
-            "Auto Bed Mesh",                              // 87="Auto Bed Mesh"
-            "Auto-Heat on Load",                          // 88="Auto-Heat on Load"
-            "Auto-probe or manually check screw heights", // 89="Auto-probe or manually check screw
-                                                          // heights"
-            "Auto-render video",                          // 90="Auto-render video"
-            "Automatic PID Calibration",                  // 91="Automatic PID Calibration"
-            "Automatically poll Spoolman for weight updates", // 92="Automatically poll Spoolman for
-                                                              // weight updates"
-            "Available Networks",                             // 93="Available Networks"
-            "Available networks",                             // 94="Available networks"
-            "Back",                                           // 95="Back"
-            "Backup",                                         // 96="Backup"
-            "Bed",                                            // 97="Bed"
-            "Bed Heater",                                     // 98="Bed Heater"
-            "Bed Level",                                      // 99="Bed Level"
-            "Bed Leveling",                                   // 100="Bed Leveling"
-            "Bed Mesh",                                       // 101="Bed Mesh"
-            "Bed Mesh Render",                                // 102="Bed Mesh Render"
-            "Bed Screw Adjustment",                           // 103="Bed Screw Adjustment"
-            "Bed Screws",                                     // 104="Bed Screws"
-            "Bed is Level!",                                  // 105="Bed is Level!"
-            "Bed °C",                                         // 106="Bed °C"
-            "Bed:",                                           // 107="Bed:"
-            "Black",                                          // 108="Black"
-            "Bluetooth",                                      // 109="Bluetooth"
-            "Body text supports longer guidance while staying readable.", // 110="Body text supports
-                                                                          // longer guidance while
-                                                                          // staying readable."
-            "Border Opacity",                                             // 111="Border Opacity"
-            "Border Radius",                                              // 112="Border Radius"
-            "Border Width",                                               // 113="Border Width"
-            "Border transparency (0 = invisible, 255 = solid)", // 114="Border transparency (0 =
-                                                                // invisible, 255 = solid)"
-            "Brightness",                                       // 115="Brightness"
-            "Browse",                                           // 116="Browse"
-            "Busy",                                             // 117="Busy"
-            "Bypass",                                           // 118="Bypass"
-            "Bypass Mode",                                      // 119="Bypass Mode"
-            "CALIBRATION",                                      // 120="CALIBRATION"
-            "CHANGED FROM LAST SESSION",                        // 121="CHANGED FROM LAST SESSION"
-            "COLORS REQUIRED",                                  // 122="COLORS REQUIRED"
-            "CRITICAL",                                         // 123="CRITICAL"
-            "Calibrate",                                        // 124="Calibrate"
-            "Calibrate X",                                      // 125="Calibrate X"
-            "Calibrate Y",                                      // 126="Calibrate Y"
-            "Calibrate resonance compensation",      // 127="Calibrate resonance compensation"
-            "Calibrating...",                        // 128="Calibrating..."
-            "Calibration",                           // 129="Calibration"
-            "Calibration & Tools",                   // 130="Calibration & Tools"
-            "Calibration &amp; Tools",               // 131="Calibration &amp; Tools"
-            "Calibration Complete!",                 // 132="Calibration Complete!"
-            "Calibration Failed",                    // 133="Calibration Failed"
-            "Cancel",                                // 134="Cancel"
-            "Cancel Print",                          // 135="Cancel Print"
-            "Cancelled",                             // 136="Cancelled"
-            "Chamber",                               // 137="Chamber"
-            "Chamber Fan",                           // 138="Chamber Fan"
-            "Chamber and dryer humidity monitoring", // 139="Chamber and dryer humidity monitoring"
-            "Chamber:",                              // 140="Chamber:"
-            "Changes apply immediately. Adjust during print for tuning.", // 141="Changes apply
-                                                                          // immediately. Adjust
-                                                                          // during print for
-                                                                          // tuning."
-            "Changes are temporary and reset on printer reboot", // 142="Changes are temporary and
-                                                                 // reset on printer reboot"
-            "Check the filament path and try again.", // 143="Check the filament path and try
-                                                      // again."
-            "Checking slots...",                      // 144="Checking slots..."
-            "Choose 12-hour or 24-hour time display", // 145="Choose 12-hour or 24-hour time
-                                                      // display"
-            "Choose display language",                // 146="Choose display language"
-            "Choose how frames are captured during printing", // 147="Choose how frames are captured
-                                                              // during printing"
-            "Choose rendering mode for G-code visualization", // 148="Choose rendering mode for
-                                                              // G-code visualization"
-            "Choose rendering mode for bed mesh visualization", // 149="Choose rendering mode for
-                                                                // bed mesh visualization"
-            "Clean Nozzle",                                     // 150="Clean Nozzle"
-            "Clear",                                            // 151="Clear"
-            "Clear All",                                        // 152="Clear All"
-            "Clear Assignment",                                 // 153="Clear Assignment"
-            "Clipboard unavailable - use SSH",              // 154="Clipboard unavailable - use SSH"
-            "Close",                                        // 155="Close"
-            "Closer = more squish | Farther = less squish", // 156="Closer = more squish | Farther =
-                                                            // less squish"
-            "Color Sensors",                                // 157="Color Sensors"
-            "Complete",                                     // 158="Complete"
-            "Completed",                                    // 159="Completed"
-            "Completed in 3 probes",                        // 160="Completed in 3 probes"
-            "Config-defined (read-only)",                   // 161="Config-defined (read-only)"
-            "Configure G10/G11 firmware retraction", // 162="Configure G10/G11 firmware retraction"
-            "Configure PRINT_START",                 // 163="Configure PRINT_START"
-            "Configure Spoolman integration and weight sync settings.", // 164="Configure Spoolman
-                                                                        // integration and weight
-                                                                        // sync settings."
-            "Configure devices in Moonraker",       // 165="Configure devices in Moonraker"
-            "Configure filament detection sensors", // 166="Configure filament detection sensors"
-            "Configure quick buttons and standard macros", // 167="Configure quick buttons and
-                                                           // standard macros"
-            "Configure timelapse recording",               // 168="Configure timelapse recording"
-            "Connect",                                     // 169="Connect"
-            "Connected",                                   // 170="Connected"
-            "Connecting",                                  // 171="Connecting"
-            "Connecting to network...",                    // 172="Connecting to network..."
-            "Connecting...",                               // 173="Connecting..."
-            "Connection",                                  // 174="Connection"
-            "Connection failed. Check password.", // 175="Connection failed. Check password."
-            "Connection must be tested successfully to continue", // 176="Connection must be tested
-                                                                  // successfully to continue"
-            "Console",                                            // 177="Console"
-            "Control optional print start features", // 178="Control optional print start features"
-            "Cool Down",                             // 179="Cool Down"
-            "Cooldown",                              // 180="Cooldown"
-            "Cooling",                               // 181="Cooling"
-            "Copy Command",                          // 182="Copy Command"
-            "Corner roundness (0 = sharp, 40 = very round)", // 183="Corner roundness (0 = sharp, 40
-                                                             // = very round)"
-            "Create video when print completes",   // 184="Create video when print completes"
-            "Current / Target",                    // 185="Current / Target"
-            "Current Mesh",                        // 186="Current Mesh"
-            "Current Temperature",                 // 187="Current Temperature"
-            "Current Z Position",                  // 188="Current Z Position"
-            "Current name:",                       // 189="Current name:"
-            "Currently Loaded",                    // 190="Currently Loaded"
-            "Currently printing",                  // 191="Currently printing"
-            "Custom...",                           // 192="Custom..."
-            "Cutting filament...",                 // 193="Cutting filament..."
-            "DIAGNOSTICS",                         // 194="DIAGNOSTICS"
-            "DISABLED",                            // 195="DISABLED"
-            "Danger",                              // 196="Danger"
-            "Dark Mode",                           // 197="Dark Mode"
-            "Day",                                 // 198="Day"
-            "Default (value=50)",                  // 199="Default (value=50)"
-            "Default border thickness",            // 200="Default border thickness"
-            "Define macros in your printer.cfg",   // 201="Define macros in your printer.cfg"
-            "Delete",                              // 202="Delete"
-            "Delta:",                              // 203="Delta:"
-            "Deutsch",                             // 204="Deutsch"
-            "Device Operations",                   // 205="Device Operations"
-            "Disable",                             // 206="Disable"
-            "Discovered Printers",                 // 207="Discovered Printers"
-            "Dismiss",                             // 208="Dismiss"
-            "Display",                             // 209="Display"
-            "Display Settings",                    // 210="Display Settings"
-            "Display Sleep",                       // 211="Display Sleep"
-            "Don't Save",                          // 212="Don't Save"
-            "Don't ask again",                     // 213="Don't ask again"
-            "Done",                                // 214="Done"
-            "Drop shadow strength (0 = disabled)", // 215="Drop shadow strength (0 = disabled)"
-            "Dryer",                               // 216="Dryer"
-            "Dryer Control",                       // 217="Dryer Control"
-            "Duration",                            // 218="Duration"
-            "E-Stop",                              // 219="E-Stop"
-            "E-Stop Confirmation",                 // 220="E-Stop Confirmation"
-            "EMERGENCY CONTROLS",                  // 221="EMERGENCY CONTROLS"
-            "EMERGENCY STOP",                      // 222="EMERGENCY STOP"
-            "Each fan can only be selected once",  // 223="Each fan can only be selected once"
-            "Edit",                                // 224="Edit"
-            "Edit Preset",                         // 225="Edit Preset"
-            "Edit Slot 1",                         // 226="Edit Slot 1"
-            "Edit Theme Colors",                   // 227="Edit Theme Colors"
-            "Edit Theme Colors (Modified)",        // 228="Edit Theme Colors (Modified)"
-            "Elapsed",                             // 229="Elapsed"
-            "Emergency Stop",                      // 230="Emergency Stop"
-            "Emergency Stop (M112)",               // 231="Emergency Stop (M112)"
-            "Emergency Stop?",                     // 232="Emergency Stop?"
-            "Empty",                               // 233="Empty"
-            "Empty slots disable the associated functionality", // 234="Empty slots disable the
-                                                                // associated functionality"
-            "Enable",                                           // 235="Enable"
-            "Enable Monitoring",                                // 236="Enable Monitoring"
-            "Enable Retraction",                                // 237="Enable Retraction"
-            "Enable Timelapse",                                 // 238="Enable Timelapse"
-            "Enable UI motion effects",                         // 239="Enable UI motion effects"
-            "Enable WiFi to scan",                              // 240="Enable WiFi to scan"
-            "Enable WiFi to scan for networks", // 241="Enable WiFi to scan for networks"
-            "Enable audio feedback",            // 242="Enable audio feedback"
-            "Enable detailed print preparation tracking (Recommended)", // 243="Enable detailed
-                                                                        // print preparation
-                                                                        // tracking (Recommended)"
-            "Enabled",                                                  // 244="Enabled"
-            "Ended",                                                    // 245="Ended"
-            "English",                                                  // 246="English"
-            "Enhancement Complete!",               // 247="Enhancement Complete!"
-            "Enhancement Failed",                  // 248="Enhancement Failed"
-            "Enter G-code command...",             // 249="Enter G-code command..."
-            "Enter WiFi Password",                 // 250="Enter WiFi Password"
-            "Enter a name for your custom theme:", // 251="Enter a name for your custom theme:"
-            "Enter a name to save this profile",   // 252="Enter a name to save this profile"
-            "Enter network name",                  // 253="Enter network name"
-            "Enter password",                      // 254="Enter password"
-            "Error",                               // 255="Error"
-            "Error state",                         // 256="Error state"
-            "Español",                             // 257="Español"
-            "Ethernet",                            // 258="Ethernet"
-            "Exclude",                             // 259="Exclude"
-            "Execute printer macros",              // 260="Execute printer macros"
-            "Exhaust Fan",                         // 261="Exhaust Fan"
-            "Explore how the selected palette shapes text, controls, and status colors.", // 262="Explore
-                                                                                          // how the
-                                                                                          // selected
-                                                                                          // palette
-                                                                                          // shapes
-                                                                                          // text,
-                                                                                          // controls,
-                                                                                          // and
-                                                                                          // status
-                                                                                          // colors."
-            "Explore palette and preview",    // 263="Explore palette and preview"
-            "Extra prime to compensate ooze", // 264="Extra prime to compensate ooze"
-            "Extrude",                        // 265="Extrude"
-            "Extrude / Retract",              // 266="Extrude / Retract"
-            "Extruder",                       // 267="Extruder"
-            "Extruder PID Tuning",            // 268="Extruder PID Tuning"
-            "Extruder heats automatically based on material", // 269="Extruder heats automatically
-                                                              // based on material"
-            "Extrusion rate",                                 // 270="Extrusion rate"
-            "FAILED",                                         // 271="FAILED"
-            "FILAMENT",                                       // 272="FILAMENT"
-            "Factory Reset",                                  // 273="Factory Reset"
-            "Failed",                                         // 274="Failed"
-            "Failed to save theme file",                      // 275="Failed to save theme file"
-            "Feed filament directly to extruder", // 276="Feed filament directly to extruder"
-            "Filament",                           // 277="Filament"
-            "Filament Sensor",                    // 278="Filament Sensor"
-            "Filament Sensors",                   // 279="Filament Sensors"
-            "Filament Used",                      // 280="Filament Used"
-            "Filament by Type",                   // 281="Filament by Type"
-            "Filament diameter sensors for flow compensation", // 282="Filament diameter sensors for
-                                                               // flow compensation"
-            "Filament runout and motion detection sensors",    // 283="Filament runout and motion
-                                                               // detection sensors"
-            "Filament tracking and inventory",           // 284="Filament tracking and inventory"
-            "File",                                      // 285="File"
-            "File Info",                                 // 286="File Info"
-            "Filename",                                  // 287="Filename"
-            "Files",                                     // 288="Files"
-            "Fill: 100% / 75% / 40% / 10%",              // 289="Fill: 100% / 75% / 40% / 10%"
-            "Firmware Restart",                          // 290="Firmware Restart"
-            "Flat Concentric Rings (existing ams_slot)", // 291="Flat Concentric Rings (existing
-                                                         // ams_slot)"
-            "Flow Rate",                                 // 292="Flow Rate"
-            "Forming tip...",                            // 293="Forming tip..."
-            "Framerate",                                 // 294="Framerate"
-            "Français",                                  // 295="Français"
-            "Freq",                                      // 296="Freq"
-            "Front",                                     // 297="Front"
-            "G-code Console",                            // 298="G-code Console"
-            "G-code Preview",                            // 299="G-code Preview"
-            "G-code commands will appear here",          // 300="G-code commands will appear here"
-            "Ghost:",                                    // 301="Ghost:"
-            "Gray",                                      // 302="Gray"
-            "Happy Hare MMU",                            // 303="Happy Hare MMU"
-            "Hardware",                                  // 304="Hardware"
-            "Hardware Health",                           // 305="Hardware Health"
-            "Hardware Issues",                           // 306="Hardware Issues"
-            "Hardware Name",                             // 307="Hardware Name"
-            "Hardware is validated on startup and reconnection", // 308="Hardware is validated on
-                                                                 // startup and reconnection"
-            "Have a piece of paper ready before starting.",      // 309="Have a piece of paper ready
-                                                                 // before starting."
-            "Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if your bed isn't "
-            "adjusted with                              thumb wheels or some other built-in "
-            "mechanism.", // 310="Have your bed adjustment tool (screwdriver, hex-key, etc.) ready
-                          // if your bed isn't adjusted with                              thumb
-                          // wheels or some other built-in mechanism."
-            "Heading",    // 311="Heading"
-            "Heat Soak",  // 312="Heat Soak"
-            "Heat to 170°C to extrude", // 313="Heat to 170°C to extrude"
-            "Heatbed Temperature",      // 314="Heatbed Temperature"
-            "Heated Bed",               // 315="Heated Bed"
-            "Heating...",               // 316="Heating..."
-            "HelixScreen Crashed",      // 317="HelixScreen Crashed"
-            "HelixScreen will integrate with your filament changer for multi-spool/color print "
-            "operations.",     // 318="HelixScreen will integrate with your filament changer for
-                               // multi-spool/color print operations."
-            "Higher = faster", // 319="Higher = faster"
-            "Home",            // 320="Home"
-            "Home All",        // 321="Home All"
-            "Home X",          // 322="Home X"
-            "Home Y",          // 323="Home Y"
-            "Home Z",          // 324="Home Z"
-            "Horizontal Progress (Leveling Wizard)", // 325="Horizontal Progress (Leveling Wizard)"
-            "Host",                                  // 326="Host"
-            "Hotend",                                // 327="Hotend"
-            "Hotend Fan",                            // 328="Hotend Fan"
-            "Hotend Heater",                         // 329="Hotend Heater"
-            "How often to check Spoolman for weight updates", // 330="How often to check Spoolman
-                                                              // for weight updates"
-            "Humidity",                                       // 331="Humidity"
-            "Humidity Sensors",                               // 332="Humidity Sensors"
-            "IP:",                                            // 333="IP:"
-            "Idle",                                           // 334="Idle"
-            "Ignore",                                         // 335="Ignore"
-            "In Progress",                                    // 336="In Progress"
-            "Indexing G-code...",                             // 337="Indexing G-code..."
-            "Initializing...",                                // 338="Initializing..."
-            "Input",                                          // 339="Input"
-            "Input Shaper",                                   // 340="Input Shaper"
-            "Input Shaping",                                  // 341="Input Shaping"
-            "Input shaper calibration sensors", // 342="Input shaper calibration sensors"
-            "Input shaping reduces vibration artifacts (ringing) in your prints.", // 343="Input
-                                                                                   // shaping
-                                                                                   // reduces
-                                                                                   // vibration
-                                                                                   // artifacts
-                                                                                   // (ringing) in
-                                                                                   // your prints."
-            "Install HelixPrint Plugin", // 344="Install HelixPrint Plugin"
-            "Install Plugin",            // 345="Install Plugin"
-            "Install the HelixPrint plugin to enable fast G-code modifications. Run this command "
-            "via SSH on your printer:", // 346="Install the HelixPrint plugin to enable fast G-code
-                                        // modifications. Run this command via SSH on your printer:"
-            "Installation Failed",      // 347="Installation Failed"
-            "Installation takes about 30 seconds.", // 348="Installation takes about 30 seconds."
-            "Installing...",                        // 349="Installing..."
-            "Intensity",                            // 350="Intensity"
-            "Interactive 3D G-code during prints",  // 351="Interactive 3D G-code during prints"
-            "Interactive probe calibration",        // 352="Interactive probe calibration"
-            "Issue description",                    // 353="Issue description"
-            "Italiano",                             // 354="Italiano"
-            "Just now",                             // 355="Just now"
-            "Kd:",                                  // 356="Kd:"
-            "Keep Printing",                        // 357="Keep Printing"
-            "Keep Required",                        // 358="Keep Required"
-            "Keyboard Test (Gboard-style)",         // 359="Keyboard Test (Gboard-style)"
-            "Ki:",                                  // 360="Ki:"
-            "Klipper",                              // 361="Klipper"
-            "Klipper has entered shutdown state. This may be due to an emergency stop, thermal "
-            "runaway, or configuration error.", // 362="Klipper has entered shutdown state. This may
-                                                // be due to an emergency stop, thermal runaway, or
-                                                // configuration error."
-            "Klipper will restart to apply changes",  // 363="Klipper will restart to apply changes"
-            "Klipper will restart to apply changes.", // 364="Klipper will restart to apply
-                                                      // changes."
-            "Klipper will restart to apply new PID values.", // 365="Klipper will restart to apply
-                                                             // new PID values."
-            "Kp:",                                           // 366="Kp:"
-            "LED Strip",                                     // 367="LED Strip"
-            "LED on at Start",                               // 368="LED on at Start"
-            "LOADED",                                        // 369="LOADED"
-            "Language",                                      // 370="Language"
-            "Last 7 days",                                   // 371="Last 7 days"
-            "Last print cancelled",                          // 372="Last print cancelled"
-            "Last print failed",                             // 373="Last print failed"
-            "Later",                                         // 374="Later"
-            "Layer",                                         // 375="Layer"
-            "Layer Height",                                  // 376="Layer Height"
-            "Layer mode captures one frame per layer change. Best for most prints.", // 377="Layer
-                                                                                     // mode
-                                                                                     // captures one
-                                                                                     // frame per
-                                                                                     // layer
-                                                                                     // change. Best
-                                                                                     // for most
-                                                                                     // prints."
-            "Layer:",                                                                // 378="Layer:"
-            "Layers",                                                                // 379="Layers"
-            "Length:",                                      // 380="Length:"
-            "Light",                                        // 381="Light"
-            "Load",                                         // 382="Load"
-            "Load Filament",                                // 383="Load Filament"
-            "Loaded",                                       // 384="Loaded"
-            "Loading Error",                                // 385="Loading Error"
-            "Loading G-code...",                            // 386="Loading G-code..."
-            "Loading filament...",                          // 387="Loading filament..."
-            "Loading history...",                           // 388="Loading history..."
-            "Loading spools...",                            // 389="Loading spools..."
-            "Loading...",                                   // 390="Loading..."
-            "Locked during print",                          // 391="Locked during print"
-            "M to toggle",                                  // 392="M to toggle"
-            "MAC:",                                         // 393="MAC:"
-            "MDI Icons",                                    // 394="MDI Icons"
-            "MISSING CONFIGURED",                           // 395="MISSING CONFIGURED"
-            "MOTION",                                       // 396="MOTION"
-            "Machine Limits",                               // 397="Machine Limits"
-            "Macro Browser",                                // 398="Macro Browser"
-            "Macro Buttons",                                // 399="Macro Buttons"
-            "Macro for bed mesh calibration",               // 400="Macro for bed mesh calibration"
-            "Macro for chamber/bed heat soak",              // 401="Macro for chamber/bed heat soak"
-            "Macro for physical bed leveling (QGL/Z-Tilt)", // 402="Macro for physical bed leveling
-                                                            // (QGL/Z-Tilt)"
-            "Macro to cancel an active print",              // 403="Macro to cancel an active print"
-            "Macro to clean/wipe the nozzle",               // 404="Macro to clean/wipe the nozzle"
-            "Macro to load filament into extruder",   // 405="Macro to load filament into extruder"
-            "Macro to pause an active print",         // 406="Macro to pause an active print"
-            "Macro to purge/prime the nozzle",        // 407="Macro to purge/prime the nozzle"
-            "Macro to resume a paused print",         // 408="Macro to resume a paused print"
-            "Macro to unload filament from extruder", // 409="Macro to unload filament from
-                                                      // extruder"
-            "Macros",                                 // 410="Macros"
-            "Main LED Strip",                         // 411="Main LED Strip"
-            "Make Optional",                          // 412="Make Optional"
-            "Make bed mesh and QGL skippable",        // 413="Make bed mesh and QGL skippable"
-            "Manage",                                 // 414="Manage"
-            "Manual Bed Leveling",                    // 415="Manual Bed Leveling"
-            "Material",                               // 416="Material"
-            "Material Design Spinner",                // 417="Material Design Spinner"
-            "Max Acceleration",                       // 418="Max Acceleration"
-            "Max Velocity",                           // 419="Max Velocity"
-            "Max Z Accel",                            // 420="Max Z Accel"
-            "Max Z Velocity",                         // 421="Max Z Velocity"
-            "Max speed through corners (mm/s)",       // 422="Max speed through corners (mm/s)"
-            "Maximum acceleration (mm/s²)",           // 423="Maximum acceleration (mm/s²)"
-            "Maximum toolhead speed (mm/s)",          // 424="Maximum toolhead speed (mm/s)"
-            "Measure Noise",                          // 425="Measure Noise"
-            "Memory (MB)",                            // 426="Memory (MB)"
-            "Mesh Complete",                          // 427="Mesh Complete"
-            "Mode",                                   // 428="Mode"
-            "Modified",                               // 429="Modified"
-            "Month",                                  // 430="Month"
-            "Moonraker",                              // 431="Moonraker"
-            "Motion",                                 // 432="Motion"
-            "Motion: XYZ",                            // 433="Motion: XYZ"
-            "Motors Off",                             // 434="Motors Off"
-            "Move",                                   // 435="Move"
-            "Move paper back and forth while adjusting. Stop when paper catches slightly but still "
-            "slides.", // 436="Move paper back and forth while adjusting. Stop when paper catches
-                       // slightly but still slides."
-            "Movement speed",                  // 437="Movement speed"
-            "Multi-Filament",                  // 438="Multi-Filament"
-            "Multi-Material",                  // 439="Multi-Material"
-            "My Custom Theme",                 // 440="My Custom Theme"
-            "My Panel",                        // 441="My Panel"
-            "My Printer",                      // 442="My Printer"
-            "NEWLY DISCOVERED",                // 443="NEWLY DISCOVERED"
-            "NOTIFICATIONS",                   // 444="NOTIFICATIONS"
-            "Name",                            // 445="Name"
-            "Network Address",                 // 446="Network Address"
-            "Network Name",                    // 447="Network Name"
-            "Network Name (SSID)",             // 448="Network Name (SSID)"
-            "Network Settings",                // 449="Network Settings"
-            "Network Test",                    // 450="Network Test"
-            "Never",                           // 451="Never"
-            "New PID Values",                  // 452="New PID Values"
-            "New Z-Offset: 0.000",             // 453="New Z-Offset: 0.000"
-            "New profile name",                // 454="New profile name"
-            "Next",                            // 455="Next"
-            "No AMS system connected.",        // 456="No AMS system connected."
-            "No History",                      // 457="No History"
-            "No Macros Found",                 // 458="No Macros Found"
-            "No Power Devices",                // 459="No Power Devices"
-            "No Spools",                       // 460="No Spools"
-            "No file loaded",                  // 461="No file loaded"
-            "No files available for printing", // 462="No files available for printing"
-            "No mesh loaded",                  // 463="No mesh loaded"
-            "No networks found",               // 464="No networks found"
-            "No notifications",                // 465="No notifications"
-            "No plugins found",                // 466="No plugins found"
-            "No preview",                      // 467="No preview"
-            "No print history yet",            // 468="No print history yet"
-            "No print start macro found",      // 469="No print start macro found"
-            "No profiles available",           // 470="No profiles available"
-            "No sensors detected",             // 471="No sensors detected"
-            "No spools available",             // 472="No spools available"
-            "Not Now",                         // 473="Not Now"
-            "Not connected",                   // 474="Not connected"
-            "Notifications",                   // 475="Notifications"
-            "Notify when print finishes",      // 476="Notify when print finishes"
-            "Nozzle",                          // 477="Nozzle"
-            "Nozzle Priming",                  // 478="Nozzle Priming"
-            "Nozzle Temp",                     // 479="Nozzle Temp"
-            "Nozzle Temperature",              // 480="Nozzle Temperature"
-            "Nozzle °C",                       // 481="Nozzle °C"
-            "Nozzle:",                         // 482="Nozzle:"
-            "OK",                              // 483="OK"
-            "Off",                             // 484="Off"
-            "Offline",                         // 485="Offline"
-            "On",                              // 486="On"
-            "Open",                            // 487="Open"
-            "Operations",                      // 488="Operations"
-            "Optimize Your Printing",          // 489="Optimize Your Printing"
-            "Or Enter Manually",               // 490="Or Enter Manually"
-            "PETG",                            // 491="PETG"
-            "PID Tuning",                      // 492="PID Tuning"
-            "PID tuning optimizes temperature control for stable heating.", // 493="PID tuning
-                                                                            // optimizes temperature
-                                                                            // control for stable
-                                                                            // heating."
-            "PLA",                                                          // 494="PLA"
-            "PLA - Black",                                                  // 495="PLA - Black"
-            "PRE-PRINT STEPS",                                              // 496="PRE-PRINT STEPS"
-            "PRINTER",                                                      // 497="PRINTER"
-            "Paper Test Calibration",    // 498="Paper Test Calibration"
-            "Part Cooling Fan",          // 499="Part Cooling Fan"
-            "Part Fan",                  // 500="Part Fan"
-            "Password",                  // 501="Password"
-            "Password cannot be empty",  // 502="Password cannot be empty"
-            "Pause",                     // 503="Pause"
-            "Paused",                    // 504="Paused"
-            "Paused (attention needed)", // 505="Paused (attention needed)"
-            "Peak:",                     // 506="Peak:"
-            "Phase Tracking",            // 507="Phase Tracking"
-            "Pick Color",                // 508="Pick Color"
-            "Place plugins in the plugins directory to extend HelixScreen", // 509="Place plugins in
-                                                                            // the plugins directory
-                                                                            // to extend
-                                                                            // HelixScreen"
-            "Please enter a theme name",                       // 510="Please enter a theme name"
-            "Please wait while the printer homes and probes.", // 511="Please wait while the printer
-                                                               // homes and probes."
-            "Please wait while the printer probes each screw position.", // 512="Please wait while
-                                                                         // the printer probes each
-                                                                         // screw position."
-            "Plugin installed successfully.",                // 513="Plugin installed successfully."
-            "Plugins",                                       // 514="Plugins"
-            "Plugins are discovered on application startup", // 515="Plugins are discovered on
-                                                             // application startup"
-            "Polymaker",                                     // 516="Polymaker"
-            "Port",                                          // 517="Port"
-            "Português",                                     // 518="Português"
-            "Position",                                      // 519="Position"
-            "Power",                                         // 520="Power"
-            "Power Control",                                 // 521="Power Control"
-            "Preheat",                                       // 522="Preheat"
-            "Preparing Print",                               // 523="Preparing Print"
-            "Preparing...",                                  // 524="Preparing..."
-            "Presets",                                       // 525="Presets"
-            "Previous",                                      // 526="Previous"
-            "Primary",                                       // 527="Primary"
-            "Print",                                         // 528="Print"
-            "Print Cancelled",                               // 529="Print Cancelled"
-            "Print Complete",                                // 530="Print Complete"
-            "Print Complete!",                               // 531="Print Complete!"
-            "Print Completion Alert",                        // 532="Print Completion Alert"
-            "Print Details",                                 // 533="Print Details"
-            "Print File",                                    // 534="Print File"
-            "Print Files",                                   // 535="Print Files"
-            "Print History",                                 // 536="Print History"
-            "Print Hours",                                   // 537="Print Hours"
-            "Print Speed",                                   // 538="Print Speed"
-            "Print Status",                                  // 539="Print Status"
-            "Print Time",                                    // 540="Print Time"
-            "Print Tuning",                                  // 541="Print Tuning"
-            "Printer",                                       // 542="Printer"
-            "Printer Name",                                  // 543="Printer Name"
-            "Printer Shutdown",                              // 544="Printer Shutdown"
-            "Printer Type",                                  // 545="Printer Type"
-            "Printing",                                      // 546="Printing"
-            "Prints Trend",                                  // 547="Prints Trend"
-            "Private:",                                      // 548="Private:"
-            "Probe",                                         // 549="Probe"
-            "Probe Sensor",                                  // 550="Probe Sensor"
-            "Probe Sensors",                                 // 551="Probe Sensors"
-            "Probing Bed Mesh",                              // 552="Probing Bed Mesh"
-            "Probing Bed Screws...",                         // 553="Probing Bed Screws..."
-            "Probing Bed...",                                // 554="Probing Bed..."
-            "Probing Failed",                                // 555="Probing Failed"
-            "Processing...",                                 // 556="Processing..."
-            "Profile",                                       // 557="Profile"
-            "Profile name (e.g., default)",                  // 558="Profile name (e.g., default)"
-            "Profiles",                                      // 559="Profiles"
-            "Progress",                                      // 560="Progress"
-            "Progress Bar Tests",                            // 561="Progress Bar Tests"
-            "Purge",                                         // 562="Purge"
-            "Purge 50mm",                                    // 563="Purge 50mm"
-            "QUICK BUTTONS",                                 // 564="QUICK BUTTONS"
-            "Quad Gantry Level",                             // 565="Quad Gantry Level"
-            "Quick Actions",                                 // 566="Quick Actions"
-            "Quick Button 1",                                // 567="Quick Button 1"
-            "Quick Button 2",                                // 568="Quick Button 2"
-            "Quick actions, calibration, speed",          // 569="Quick actions, calibration, speed"
-            "RSS:",                                       // 570="RSS:"
-            "Re-probe",                                   // 571="Re-probe"
-            "Ready",                                      // 572="Ready"
-            "Recommended",                                // 573="Recommended"
-            "Recommended: 200°C for extruder",            // 574="Recommended: 200°C for extruder"
-            "Record Timelapse",                           // 575="Record Timelapse"
-            "Record timelapses of your prints",           // 576="Record timelapses of your prints"
-            "Recording Mode",                             // 577="Recording Mode"
-            "Recover",                                    // 578="Recover"
-            "Reduce Ringing",                             // 579="Reduce Ringing"
-            "Refresh",                                    // 580="Refresh"
-            "Refresh Interval",                           // 581="Refresh Interval"
-            "Remaining",                                  // 582="Remaining"
-            "Remove plugin from printer",                 // 583="Remove plugin from printer"
-            "Rename",                                     // 584="Rename"
-            "Rename Mesh Profile",                        // 585="Rename Mesh Profile"
-            "Reprint",                                    // 586="Reprint"
-            "Require confirmation before emergency stop", // 587="Require confirmation before
-                                                          // emergency stop"
-            "Requires Moonraker-Timelapse plugin",   // 588="Requires Moonraker-Timelapse plugin"
-            "Reset",                                 // 589="Reset"
-            "Reset Speed & Flow to 100%",            // 590="Reset Speed & Flow to 100%"
-            "Reset Speed &amp; Flow to 100%",        // 591="Reset Speed &amp; Flow to 100%"
-            "Reset all settings and restart wizard", // 592="Reset all settings and restart wizard"
-            "Resetting...",                          // 593="Resetting..."
-            "Resonance compensation tuning",         // 594="Resonance compensation tuning"
-            "Restart HelixScreen",                   // 595="Restart HelixScreen"
-            "Restart Klipper",                       // 596="Restart Klipper"
-            "Restart Now",                           // 597="Restart Now"
-            "Restart Required",                      // 598="Restart Required"
-            "Restart the display application",       // 599="Restart the display application"
-            "Resume",                                // 600="Resume"
-            "Resume Print",                          // 601="Resume Print"
-            "Retract",                               // 602="Retract"
-            "Retract Length",                        // 603="Retract Length"
-            "Retract Speed",                         // 604="Retract Speed"
-            "Retraction Settings",                   // 605="Retraction Settings"
-            "Retry",                                 // 606="Retry"
-            "Review detected hardware validation issues",    // 607="Review detected hardware
-                                                             // validation issues"
-            "Review your changes",                           // 608="Review your changes"
-            "Role:",                                         // 609="Role:"
-            "Runout Sensor",                                 // 610="Runout Sensor"
-            "STANDARD MACROS",                               // 611="STANDARD MACROS"
-            "STOP",                                          // 612="STOP"
-            "STYLE PROPERTIES",                              // 613="STYLE PROPERTIES"
-            "SYSTEM",                                        // 614="SYSTEM"
-            "Save",                                          // 615="Save"
-            "Save & Restart",                                // 616="Save & Restart"
-            "Save &amp; Restart",                            // 617="Save &amp; Restart"
-            "Save As New",                                   // 618="Save As New"
-            "Save Config",                                   // 619="Save Config"
-            "Save Printer Configuration",                    // 620="Save Printer Configuration"
-            "Save Theme As",                                 // 621="Save Theme As"
-            "Save Z-Offset",                                 // 622="Save Z-Offset"
-            "Save Z-Offset?",                                // 623="Save Z-Offset?"
-            "Save changes to persist them across restarts?", // 624="Save changes to persist them
-                                                             // across restarts?"
-            "Saving Configuration...",                       // 625="Saving Configuration..."
-            "Saving will restart Klipper and CANCEL any active print!", // 626="Saving will restart
-                                                                        // Klipper and CANCEL any
-                                                                        // active print!"
-            "Scanning for networks...", // 627="Scanning for networks..."
-            "Screen Dim",               // 628="Screen Dim"
-            "Screen dims to lower brightness after period of inactivity", // 629="Screen dims to
-                                                                          // lower brightness after
-                                                                          // period of inactivity"
-            "Screen will dim after the selected period of inactivity", // 630="Screen will dim after
-                                                                       // the selected period of
-                                                                       // inactivity"
-            "Scroll Speed",                                            // 631="Scroll Speed"
-            "Search filename...",                                      // 632="Search filename..."
-            "Secondary",                                               // 633="Secondary"
-            "Security",                                                // 634="Security"
-            "Select",                                                  // 635="Select"
-            "Select 'None' if you don't have a filament sensor, or if you don't want to pause on "
-            "runout.", // 636="Select 'None' if you don't have a filament sensor, or if you don't
-                       // want to pause on runout."
-            "Select 'None' if you have a dedicated probe, or don't use bed mesh leveling.", // 637="Select
-                                                                                            // 'None'
-                                                                                            // if
-                                                                                            // you
-                                                                                            // have
-                                                                                            // a
-                                                                                            // dedicated
-                                                                                            // probe,
-                                                                                            // or
-                                                                                            // don't
-                                                                                            // use
-                                                                                            // bed
-                                                                                            // mesh
-                                                                                            // leveling."
-            "Select Filament",                        // 638="Select Filament"
-            "Select File",                            // 639="Select File"
-            "Select G-Code File",                     // 640="Select G-Code File"
-            "Select Heater",                          // 641="Select Heater"
-            "Select macro for first button",          // 642="Select macro for first button"
-            "Select macro for second button",         // 643="Select macro for second button"
-            "Selecting slot...",                      // 644="Selecting slot..."
-            "Semantic Size Parameter Tests",          // 645="Semantic Size Parameter Tests"
-            "Send commands directly to printer",      // 646="Send commands directly to printer"
-            "Sensors",                                // 647="Sensors"
-            "Set ",                                   // 648="Set "
-            "Settings",                               // 649="Settings"
-            "Shadow Intensity",                       // 650="Shadow Intensity"
-            "Shaper",                                 // 651="Shaper"
-            "Shininess:",                             // 652="Shininess:"
-            "Show detailed print preparation status", // 653="Show detailed print preparation
-                                                      // status"
-            "Side",                                   // 654="Side"
-            "Size",                                   // 655="Size"
-            "Skip for now",                           // 656="Skip for now"
-            "Slot 1",                                 // 657="Slot 1"
-            "Small labels help keep controls calm and focused.", // 658="Small labels help keep
-                                                                 // controls calm and focused."
-            "Some settings will take effect after restart.", // 659="Some settings will take effect
-                                                             // after restart."
-            "Sounds",                                        // 660="Sounds"
-            "Specular:",                                     // 661="Specular:"
-            "Speed",                                         // 662="Speed"
-            "Speed Settings",                                // 663="Speed Settings"
-            "Speed of prime movement",                       // 664="Speed of prime movement"
-            "Speed of retraction movement",                  // 665="Speed of retraction movement"
-            "Speed:",                                        // 666="Speed:"
-            "Spool Visualization (Pseudo-3D Canvas)",        // 667="Spool Visualization (Pseudo-3D
-                                                             // Canvas)"
-            "Spoolman",                                      // 668="Spoolman"
-            "Spoolman has no spools configured", // 669="Spoolman has no spools configured"
-            "Square Corner Velocity",            // 670="Square Corner Velocity"
-            "Standby",                           // 671="Standby"
-            "Start Calibration",                 // 672="Start Calibration"
-            "Start Probing",                     // 673="Start Probing"
-            "Started",                           // 674="Started"
-            "Status",                            // 675="Status"
-            "Status icons",                      // 676="Status icons"
-            "Step",                              // 677="Step"
-            "Step Progress Widget Test",         // 678="Step Progress Widget Test"
-            "Stop",                              // 679="Stop"
-            "Stop Drying",                       // 680="Stop Drying"
-            "Stop Print?",                       // 681="Stop Print?"
-            "Stops all motion. Requires firmware restart.", // 682="Stops all motion. Requires
-                                                            // firmware restart."
-            "Styled (value=75)",                            // 683="Styled (value=75)"
-            "Success Rate",                                 // 684="Success Rate"
-            "Success!",                                     // 685="Success!"
-            "Surfaces inherit app background tokens for light and dark modes.", // 686="Surfaces
-                                                                                // inherit app
-                                                                                // background tokens
-                                                                                // for light and
-                                                                                // dark modes."
-            "Switch Sensors",                       // 687="Switch Sensors"
-            "Switch between light and dark themes", // 688="Switch between light and dark themes"
-            "Sync to Spoolman",                     // 689="Sync to Spoolman"
-            "Sync with Spoolman",                   // 690="Sync with Spoolman"
-            "Sysfs",                                // 691="Sysfs"
-            "System detected",                      // 692="System detected"
-            "TD-1 filament color detection",        // 693="TD-1 filament color detection"
-            "THEME COLORS",                         // 694="THEME COLORS"
-            "TPU",                                  // 695="TPU"
-            "Tap to show keyboard...",              // 696="Tap to show keyboard..."
-            "Target",                               // 697="Target"
-            "Target Temperature",                   // 698="Target Temperature"
-            "Temperature",                          // 699="Temperature"
-            "Temperatures",                         // 700="Temperatures"
-            "Temporary adjustment for this print, unless saved on Controls panel", // 701="Temporary
-                                                                                   // adjustment for
-                                                                                   // this print,
-                                                                                   // unless saved
-                                                                                   // on Controls
-                                                                                   // panel"
-            "Tertiary",                                                            // 702="Tertiary"
-            "Test Connection", // 703="Test Connection"
-            "Test Network",    // 704="Test Network"
-            "Test Print",      // 705="Test Print"
-            "The HelixPrint plugin enables fast G-code modifications directly on your printer—like "
-            "skipping bed mesh for quick reprints.", // 706="The HelixPrint plugin enables fast
-                                                     // G-code modifications directly on your
-                                                     // printer—like skipping bed mesh for quick
-                                                     // reprints."
-            "The heater will cycle on and off several times.", // 707="The heater will cycle on and
-                                                               // off several times."
-            "Theme",                                           // 708="Theme"
-            "Theme Colors",                                    // 709="Theme Colors"
-            "Theme Preset",                                    // 710="Theme Preset"
-            "Theme changes apply after restart.", // 711="Theme changes apply after restart."
-            "Theme changes will take effect after restart.", // 712="Theme changes will take effect
-                                                             // after restart."
-            "Theme, brightness, and sleep settings", // 713="Theme, brightness, and sleep settings"
-            "Thin bar (height=8)",                   // 714="Thin bar (height=8)"
-            "This calibration uses the paper friction method to set your Z-offset.", // 715="This
-                                                                                     // calibration
-                                                                                     // uses the
-                                                                                     // paper
-                                                                                     // friction
-                                                                                     // method to
-                                                                                     // set your
-                                                                                     // Z-offset."
-            "This may take 1-2 minutes",      // 716="This may take 1-2 minutes"
-            "This may take up to 30 seconds", // 717="This may take up to 30 seconds"
-            "This plugin lets HelixScreen control print start options like bed mesh and QGL. Once "
-            "installed, use Configure PRINT_START below to enable optional steps.", // 718="This
-                                                                                    // plugin lets
-                                                                                    // HelixScreen
-                                                                                    // control print
-                                                                                    // start options
-                                                                                    // like bed mesh
-                                                                                    // and QGL. Once
-                                                                                    // installed,
-                                                                                    // use Configure
-                                                                                    // PRINT_START
-                                                                                    // below to
-                                                                                    // enable
-                                                                                    // optional
-                                                                                    // steps."
-            "This process takes 3-5 minutes. Do not interrupt.", // 719="This process takes 3-5
-                                                                 // minutes. Do not interrupt."
-            "This tool probes each bed screw and tells you how much to adjust.", // 720="This tool
-                                                                                 // probes each bed
-                                                                                 // screw and tells
-                                                                                 // you how much to
-                                                                                 // adjust."
-            "This will immediately halt all printer operations. The printer will require a restart "
-            "to resume.", // 721="This will immediately halt all printer operations. The printer
-                          // will require a restart to resume."
-            "This will reset all settings to defaults. This action cannot be undone.", // 722="This
-                                                                                       // will reset
-                                                                                       // all
-                                                                                       // settings
-                                                                                       // to
-                                                                                       // defaults.
-                                                                                       // This
-                                                                                       // action
-                                                                                       // cannot be
-                                                                                       // undone."
-            "This will restart Klipper.",         // 723="This will restart Klipper."
-            "Time",                               // 724="Time"
-            "Time Format",                        // 725="Time Format"
-            "Timelapse",                          // 726="Timelapse"
-            "Timelapse Available",                // 727="Timelapse Available"
-            "Timelapse Settings",                 // 728="Timelapse Settings"
-            "Tip:",                               // 729="Tip:"
-            "Toggle Feature",                     // 730="Toggle Feature"
-            "Tool",                               // 731="Tool"
-            "Tool Changer",                       // 732="Tool Changer"
-            "Top",                                // 733="Top"
-            "Total Prints",                       // 734="Total Prints"
-            "Touch Calibration",                  // 735="Touch Calibration"
-            "Touch anywhere to test calibration", // 736="Touch anywhere to test calibration"
-            "Touch screen to wake from sleep",    // 737="Touch screen to wake from sleep"
-            "Travels",                            // 738="Travels"
-            "Troubleshooting:",                   // 739="Troubleshooting:"
-            "Tune",                               // 740="Tune"
-            "Tune heater PID parameters",         // 741="Tune heater PID parameters"
-            "Turn on LED when printer starts",    // 742="Turn on LED when printer starts"
-            "Type",                               // 743="Type"
-            "Type to preview input field...",     // 744="Type to preview input field..."
-            "USB",                                // 745="USB"
-            "Uninstall HelixPrint Plugin",        // 746="Uninstall HelixPrint Plugin"
-            "Unknown",                            // 747="Unknown"
-            "Unknown Spool",                      // 748="Unknown Spool"
-            "Unknown Step",                       // 749="Unknown Step"
-            "Unload",                             // 750="Unload"
-            "Unload Filament",                    // 751="Unload Filament"
-            "Unloading filament...",              // 752="Unloading filament..."
-            "Unretract Extra",                    // 753="Unretract Extra"
-            "Unretract Speed",                    // 754="Unretract Speed"
-            "Upload gcode files to get started",  // 755="Upload gcode files to get started"
-            "Use G10/G11 firmware retraction",    // 756="Use G10/G11 firmware retraction"
-            "ValgACE (ACE Pro)",                  // 757="ValgACE (ACE Pro)"
-            "Values have been saved to printer configuration.", // 758="Values have been saved to
-                                                                // printer configuration."
-            "Velocity and acceleration limits",      // 759="Velocity and acceleration limits"
-            "Vendor",                                // 760="Vendor"
-            "Version",                               // 761="Version"
-            "Vertical Progress (Retract Wizard)",    // 762="Vertical Progress (Retract Wizard)"
-            "Vibration",                             // 763="Vibration"
-            "Video playback speed",                  // 764="Video playback speed"
-            "View Full History",                     // 765="View Full History"
-            "View Presets",                          // 766="View Presets"
-            "View Timelapse",                        // 767="View Timelapse"
-            "View installed plugins and status",     // 768="View installed plugins and status"
-            "View print statistics and job history", // 769="View print statistics and job history"
-            "Warning",                               // 770="Warning"
-            "Week",                                  // 771="Week"
-            "Weight data is synced from Spoolman to display remaining filament. Changes are also "
-            "synced when prints start, pause, or complete.", // 772="Weight data is synced from
-                                                             // Spoolman to display remaining
-                                                             // filament. Changes are also synced
-                                                             // when prints start, pause, or
-                                                             // complete."
-            "Weight sync settings",                          // 773="Weight sync settings"
-            "White",                                         // 774="White"
-            "WiFi",                                          // 775="WiFi"
-            "WiFi Network",                                  // 776="WiFi Network"
-            "WiFi and Ethernet",                             // 777="WiFi and Ethernet"
-            "WiFi and Ethernet configuration",        // 778="WiFi and Ethernet configuration"
-            "WiFi control unavailable",               // 779="WiFi control unavailable"
-            "WiFi hardware unavailable",              // 780="WiFi hardware unavailable"
-            "Width",                                  // 781="Width"
-            "Width Sensors",                          // 782="Width Sensors"
-            "X:",                                     // 783="X:"
-            "XY",                                     // 784="XY"
-            "Y:",                                     // 785="Y:"
-            "Year",                                   // 786="Year"
-            "Your completed prints will appear here", // 787="Your completed prints will appear
-                                                      // here"
-            "Z",                                      // 788="Z"
-            "Z Calibration",                          // 789="Z Calibration"
-            "Z Range",                                // 790="Z Range"
-            "Z probes for bed leveling and mesh generation", // 791="Z probes for bed leveling and
-                                                             // mesh generation"
-            "Z-Offset",                                      // 792="Z-Offset"
-            "Z-Offset Calibration",                          // 793="Z-Offset Calibration"
-            "Z-Offset:",                                     // 794="Z-Offset:"
-            "Z-Tilt Adjust",                                 // 795="Z-Tilt Adjust"
-            "Z:",                                            // 796="Z:"
-            "Z: 0.000",                                      // 797="Z: 0.000"
-            "Zoom",                                          // 798="Zoom"
-            "^ FRONT",                                       // 799="^ FRONT"
-            "hour",                                          // 800="hour"
-            "hours",                                         // 801="hours"
-            "lg",                                            // 802="lg"
-            "md",                                            // 803="md"
-            "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-            "minute",                               // 805="minute"
-            "minutes",                              // 806="minutes"
-            "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-            "seconds",                              // 808="seconds"
-            "size=\"large\"",                       // 809="size="large""
-            "size=\"medium\"",                      // 810="size="medium""
-            "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-            "size=\"small\"",                       // 812="size="small""
-            "size=\"tiny\"",                        // 813="size="tiny""
-            "sm",                                   // 814="sm"
-            "true",                                 // 815="true"
-            "value=0 (shows FULL - BUG!)",          // 816="value=0 (shows FULL - BUG!)"
-            "value=1 (tiny sliver?)",               // 817="value=1 (tiny sliver?)"
-            "value=100 (should be full)",           // 818="value=100 (should be full)"
-            "xs",                                   // 819="xs"
-            "Русский",                              // 820="Русский"
-            "—",                                    // 821="—"
-            "•",                                    // 822="•"
-            "中文",                                 // 823="中文"
-            "日本語",                               // 824="日本語"
-            "󰅐",                                 // 825="󰅐"
-            "󰉋",                                 // 826="󰉋"
-            "󱧰",                                 // 827="󱧰"
-};
-
-static const char*
-    es_singulars[] =
-        {
-            " / ",                                           // 0=" / "
-            " 0 / 0",                                        // 1=" 0 / 0"
-            "#808080",                                       // 2="#808080"
-            "#RRGGBB",                                       // 3="#RRGGBB"
-            "(0)",                                           // 4="(0)"
-            "(2.4GHz)",                                      // 5="(2.4GHz)"
-            "+",                                             // 6="+"
-            "+0",                                            // 7="+0"
-            "+0.01mm",                                       // 8="+0.01mm"
-            "+0.05mm",                                       // 9="+0.05mm"
-            "+0.1mm",                                        // 10="+0.1mm"
-            "+1mm",                                          // 11="+1mm"
-            "-",                                             // 12="-"
-            "- Verifique [resonance_tester] en printer.cfg", // 13="- Check [resonance_tester] in
-                                                             // printer.cfg"
-            "- Asegúrese de que el ADXL345 esté conectado",  // 14="- Ensure ADXL345 is connected"
-            "- Intente Medir Ruido primero",                 // 15="- Try Measure Noise first"
-            "--",                                            // 16="--"
-            "---",                                           // 17="---"
-            "-0.01mm",                                       // 18="-0.01mm"
-            "-0.05mm",                                       // 19="-0.05mm"
-            "-0.1mm",                                        // 20="-0.1mm"
-            "-1mm",                                          // 21="-1mm"
-            "/",                                             // 22="/"
-            "0.4-2mm extrusión directa, 4-6mm bowden", // 23="0.4-2mm direct drive, 4-6mm bowden"
-            "1. La impresora hace origen y sondea la cama", // 24="1. Printer homes and probes the
-                                                            // bed"
-            "1. La impresora hará origen y sondeará cada tornillo", // 25="1. Printer will home and
-                                                                    // probe each screw"
-            "10mm",                                                 // 26="10mm"
-            "1mm",                                                  // 27="1mm"
-            "2. Coloque papel entre la boquilla y la cama", // 28="2. Place paper between nozzle and
-                                                            // bed"
-            "2. Los resultados muestran cuánto girar cada tornillo", // 29="2. Results show how much
-                                                                     // to turn each screw"
-            "200-230°C",                                             // 30="200-230°C"
-            "210°C / 60°C",                                          // 31="210°C / 60°C"
-            "230°C / 50°C",                                          // 32="230°C / 50°C"
-            "240°C / 80°C",                                          // 33="240°C / 80°C"
-            "250°C / 100°C",                                         // 34="250°C / 100°C"
-            "25mm",                                                  // 35="25mm"
-            "3. Ajuste los tornillos, luego vuelva a sondear para verificar", // 36="3. Adjust
-                                                                              // screws, then
-                                                                              // re-probe to verify"
-            "3. Baje la boquilla hasta que el papel roce ligeramente", // 37="3. Lower nozzle until
-                                                                       // paper drags slightly"
-            "Vista previa 3D",                                         // 38="3D Preview"
-            "4. El papel debe moverse pero con resistencia",  // 39="4. Paper should move but with
-                                                              // resistance"
-            "4. Repita hasta que la cama esté nivelada",      // 40="4. Repeat until bed is level"
-            "5mm",                                            // 41="5mm"
-            "60°C",                                           // 42="60°C"
-            "6mm",                                            // 43="6mm"
-            "850g",                                           // 44="850g"
-            "= Aflojar",                                      // 45="= Loosen"
-            "= Apretar",                                      // 46="= Tighten"
-            "?",                                              // 47="?"
-            "ACERCA DE",                                      // 48="ABOUT"
-            "ABS",                                            // 49="ABS"
-            "Configuración AMS",                              // 50="AMS Settings"
-            "APARIENCIA",                                     // 51="APPEARANCE"
-            "AUTOMATIZACIÓN",                                 // 52="AUTOMATION"
-            "Abortar",                                        // 53="Abort"
-            "Acerca de",                                      // 54="About"
-            "Acel a Desacel",                                 // 55="Accel to Decel"
-            "Límite de aceleración a desaceleración (mm/s²)", // 56="Acceleration to deceleration
-                                                              // limit (mm/s²)"
-            "Acelerómetros",                                  // 57="Accelerometers"
-            "Aceptar",                                        // 58="Accept"
-            "Acción Requerida",                               // 59="Action Required"
-            "Acciones",                                       // 60="Actions"
-            "Activo",                                         // 61="Active"
-            "Actual",                                         // 62="Actual"
-            "Agregar Red Oculta",                             // 63="Add Hidden Network"
-            "Ajustar el nivel de brillo de la pantalla",      // 64="Adjust screen brightness level"
-            "Ajuste los tornillos, luego vuelva a sondear.",  // 65="Adjust screws, then re-probe."
-            "Los ajustes permanecen activos hasta reiniciar. Guarde después de que termine la "
-            "impresión.", // 66="Adjustments stay active until restart. Save after print completes."
-            "Configuración Avanzada",                             // 67="Advanced Setting"
-            "Todo",                                               // 68="All"
-            "Todos los tornillos están dentro de la tolerancia.", // 69="All screws are within
-                                                                  // tolerance."
-            "Allwinner",                                          // 70="Allwinner"
-            "Cantidad:",                                          // 71="Amount:"
-            "Se detectó un acelerómetro en su impresora.", // 72="An accelerometer was detected on
-                                                           // your printer."
-            "Ocurrió un error durante la calibración.",    // 73="An error occurred during
-                                                           // calibration."
-            "Ocurrió un error durante el sondeo.",         // 74="An error occurred during probing."
-            "Ocurrió un error al cargar el filamento.",    // 75="An error occurred while loading
-                                                           // filament."
-            "Animaciones",                                 // 76="Animations"
-            "Fondo de la Aplicación",                      // 77="App Background"
-            "Aplicar",                                     // 78="Apply"
-            "Aplicar Cambios",                             // 79="Apply Changes"
-            "Aplicar cambios solo para esta sesión",       // 80="Apply saves for this session only"
-            "Aplicando...",                                // 81="Applying..."
-            "¿Está seguro de que desea cancelar esta impresión? Todo el progreso se perderá.", // 82="Are
-                                                                                               // you
-                                                                                               // sure
-                                                                                               // you
-                                                                                               // want
-                                                                                               // to
-                                                                                               // cancel
-                                                                                               // this
-                                                                                               // print?
-                                                                                               // All
-                                                                                               // progress
-                                                                                               // will
-                                                                                               // be
-                                                                                               // lost."
-            "Asignar Bobina",                                       // 83="Assign Spool"
-            "Asigne un rol para habilitar el monitoreo del sensor", // 84="Assign a role to enable
-                                                                    // sensor monitoring"
-            "Asignando a Ranura 1",                                 // 85="Assigning to Slot 1"
-            "Automático",                                           // 86="Auto"
-            "Malla de Cama Automática",                             // 87="Auto Bed Mesh"
-            "Calentar Automáticamente al Cargar",                   // 88="Auto-Heat on Load"
-            "Sondear automáticamente o verificar manualmente las alturas de los tornillos", // 89="Auto-probe
-                                                                                            // or
-                                                                                            // manually
-                                                                                            // check
-                                                                                            // screw
-                                                                                            // heights"
-            "Renderizar video automáticamente", // 90="Auto-render video"
-            "Calibración PID Automática",       // 91="Automatic PID Calibration"
-            "Consultar Spoolman automáticamente para actualizaciones de peso", // 92="Automatically
-                                                                               // poll Spoolman for
-                                                                               // weight updates"
-            "Redes Disponibles",            // 93="Available Networks"
-            "Redes disponibles",            // 94="Available networks"
-            "Volver",                       // 95="Back"
-            "Respaldo",                     // 96="Backup"
-            "Cama",                         // 97="Bed"
-            "Calentador de Cama",           // 98="Bed Heater"
-            "Nivel de Cama",                // 99="Bed Level"
-            "Nivelación de Cama",           // 100="Bed Leveling"
-            "Malla de Cama",                // 101="Bed Mesh"
-            "Renderizado de Malla de Cama", // 102="Bed Mesh Render"
-            "Ajuste de Tornillos de Cama",  // 103="Bed Screw Adjustment"
-            "Tornillos de Cama",            // 104="Bed Screws"
-            "¡La Cama está Nivelada!",      // 105="Bed is Level!"
-            "Cama °C",                      // 106="Bed °C"
-            "Cama:",                        // 107="Bed:"
-            "Negro",                        // 108="Black"
-            "Bluetooth",                    // 109="Bluetooth"
-            "El texto del cuerpo admite guías más largas mientras permanece legible.", // 110="Body
-                                                                                       // text
-                                                                                       // supports
-                                                                                       // longer
-                                                                                       // guidance
-                                                                                       // while
-                                                                                       // staying
-                                                                                       // readable."
-            "Opacidad del Borde",                                    // 111="Border Opacity"
-            "Radio del Borde",                                       // 112="Border Radius"
-            "Ancho del Borde",                                       // 113="Border Width"
-            "Transparencia del borde (0 = invisible, 255 = sólido)", // 114="Border transparency (0
-                                                                     // = invisible, 255 = solid)"
-            "Brillo",                                                // 115="Brightness"
-            "Explorar",                                              // 116="Browse"
-            "Ocupado",                                               // 117="Busy"
-            "Bypass",                                                // 118="Bypass"
-            "Modo Bypass",                                           // 119="Bypass Mode"
-            "CALIBRACIÓN",                                           // 120="CALIBRATION"
-            "CAMBIADO DESDE LA ÚLTIMA SESIÓN",          // 121="CHANGED FROM LAST SESSION"
-            "COLORES REQUERIDOS",                       // 122="COLORS REQUIRED"
-            "CRÍTICO",                                  // 123="CRITICAL"
-            "Calibrar",                                 // 124="Calibrate"
-            "Calibrar X",                               // 125="Calibrate X"
-            "Calibrar Y",                               // 126="Calibrate Y"
-            "Calibrar compensación de resonancia",      // 127="Calibrate resonance compensation"
-            "Calibrando...",                            // 128="Calibrating..."
-            "Calibración",                              // 129="Calibration"
-            "Calibración y Herramientas",               // 130="Calibration & Tools"
-            "Calibración y Herramientas",               // 131="Calibration &amp; Tools"
-            "¡Calibración Completa!",                   // 132="Calibration Complete!"
-            "Calibración Fallida",                      // 133="Calibration Failed"
-            "Cancelar",                                 // 134="Cancel"
-            "Cancelar Impresión",                       // 135="Cancel Print"
-            "Cancelado",                                // 136="Cancelled"
-            "Cámara",                                   // 137="Chamber"
-            "Ventilador de Cámara",                     // 138="Chamber Fan"
-            "Monitoreo de humedad de cámara y secador", // 139="Chamber and dryer humidity
-                                                        // monitoring"
-            "Cámara:",                                  // 140="Chamber:"
-            "Los cambios se aplican inmediatamente. Ajuste durante la impresión para afinar.", // 141="Changes
-                                                                                               // apply
-                                                                                               // immediately.
-                                                                                               // Adjust
-                                                                                               // during
-                                                                                               // print
-                                                                                               // for
-                                                                                               // tuning."
-            "Los cambios son temporales y se reinician al reiniciar la impresora", // 142="Changes
-                                                                                   // are temporary
-                                                                                   // and reset on
-                                                                                   // printer
-                                                                                   // reboot"
-            "Verifique la ruta del filamento e intente de nuevo.", // 143="Check the filament path
-                                                                   // and try again."
-            "Verificando ranuras...",                              // 144="Checking slots..."
-            "Elija visualización de hora de 12 o 24 horas", // 145="Choose 12-hour or 24-hour time
-                                                            // display"
-            "Elija el idioma de visualización",             // 146="Choose display language"
-            "Elija cómo se capturan los cuadros durante la impresión", // 147="Choose how frames are
-                                                                       // captured during printing"
-            "Elija el modo de renderizado para la visualización de G-code", // 148="Choose rendering
-                                                                            // mode for G-code
-                                                                            // visualization"
-            "Elija el modo de renderizado para la visualización de malla de cama", // 149="Choose
-                                                                                   // rendering mode
-                                                                                   // for bed mesh
-                                                                                   // visualization"
-            "Limpiar Boquilla",                     // 150="Clean Nozzle"
-            "Borrar",                               // 151="Clear"
-            "Borrar Todo",                          // 152="Clear All"
-            "Borrar Asignación",                    // 153="Clear Assignment"
-            "Portapapeles no disponible - use SSH", // 154="Clipboard unavailable - use SSH"
-            "Cerrar",                               // 155="Close"
-            "Más cerca = más aplastamiento | Más lejos = menos aplastamiento", // 156="Closer = more
-                                                                               // squish | Farther =
-                                                                               // less squish"
-            "Sensores de Color",                         // 157="Color Sensors"
-            "Completo",                                  // 158="Complete"
-            "Completado",                                // 159="Completed"
-            "Completado en 3 sondeos",                   // 160="Completed in 3 probes"
-            "Definido en configuración (solo lectura)",  // 161="Config-defined (read-only)"
-            "Configurar retracción de firmware G10/G11", // 162="Configure G10/G11 firmware
-                                                         // retraction"
-            "Configurar PRINT_START",                    // 163="Configure PRINT_START"
-            "Configurar integración de Spoolman y ajustes de sincronización de peso.", // 164="Configure
-                                                                                       // Spoolman
-                                                                                       // integration
-                                                                                       // and weight
-                                                                                       // sync
-                                                                                       // settings."
-            "Configurar dispositivos en Moonraker",          // 165="Configure devices in Moonraker"
-            "Configurar sensores de detección de filamento", // 166="Configure filament detection
-                                                             // sensors"
-            "Configurar botones rápidos y macros estándar",  // 167="Configure quick buttons and
-                                                             // standard macros"
-            "Configurar grabación de timelapse",             // 168="Configure timelapse recording"
-            "Conectar",                                      // 169="Connect"
-            "Conectado",                                     // 170="Connected"
-            "Conectando",                                    // 171="Connecting"
-            "Conectando a la red...",                        // 172="Connecting to network..."
-            "Conectando...",                                 // 173="Connecting..."
-            "Conexión",                                      // 174="Connection"
-            "Conexión fallida. Verifique la contraseña.",    // 175="Connection failed. Check
-                                                             // password."
-            "La conexión debe probarse exitosamente para continuar", // 176="Connection must be
-                                                                     // tested successfully to
-                                                                     // continue"
-            "Consola",                                               // 177="Console"
-            "Controlar funciones opcionales de inicio de impresión", // 178="Control optional print
-                                                                     // start features"
-            "Enfriar",                                               // 179="Cool Down"
-            "Enfriar",                                               // 180="Cooldown"
-            "Enfriamiento",                                          // 181="Cooling"
-            "Copiar Comando",                                        // 182="Copy Command"
-            "Redondez de esquinas (0 = agudo, 40 = muy redondeado)", // 183="Corner roundness (0 =
-                                                                     // sharp, 40 = very round)"
-            "Crear video cuando termine la impresión", // 184="Create video when print completes"
-            "Actual / Objetivo",                       // 185="Current / Target"
-            "Malla Actual",                            // 186="Current Mesh"
-            "Temperatura Actual",                      // 187="Current Temperature"
-            "Posición Z Actual",                       // 188="Current Z Position"
-            "Nombre actual:",                          // 189="Current name:"
-            "Actualmente Cargado",                     // 190="Currently Loaded"
-            "Imprimiendo actualmente",                 // 191="Currently printing"
-            "Personalizado...",                        // 192="Custom..."
-            "Cortando filamento...",                   // 193="Cutting filament..."
-            "DIAGNÓSTICOS",                            // 194="DIAGNOSTICS"
-            "DESACTIVADO",                             // 195="DISABLED"
-            "Peligro",                                 // 196="Danger"
-            "Modo Oscuro",                             // 197="Dark Mode"
-            "Día",                                     // 198="Day"
-            "Predeterminado (valor=50)",               // 199="Default (value=50)"
-            "Grosor de borde predeterminado",          // 200="Default border thickness"
-            "Defina macros en su printer.cfg",         // 201="Define macros in your printer.cfg"
-            "Eliminar",                                // 202="Delete"
-            "Delta:",                                  // 203="Delta:"
-            "Deutsch",                                 // 204="Deutsch"
-            "Operaciones de Dispositivo",              // 205="Device Operations"
-            "Desactivar",                              // 206="Disable"
-            "Impresoras Descubiertas",                 // 207="Discovered Printers"
-            "Descartar",                               // 208="Dismiss"
-            "Pantalla",                                // 209="Display"
-            "Configuración de Pantalla",               // 210="Display Settings"
-            "Suspensión de Pantalla",                  // 211="Display Sleep"
-            "No Guardar",                              // 212="Don't Save"
-            "No volver a preguntar",                   // 213="Don't ask again"
-            "Listo",                                   // 214="Done"
-            "Intensidad de sombra (0 = desactivada)",  // 215="Drop shadow strength (0 = disabled)"
-            "Secador",                                 // 216="Dryer"
-            "Control de Secador",                      // 217="Dryer Control"
-            "Duración",                                // 218="Duration"
-            "Parada de emergencia",                    // 219="E-Stop"
-            "Confirmación de Parada de Emergencia",    // 220="E-Stop Confirmation"
-            "CONTROLES DE EMERGENCIA",                 // 221="EMERGENCY CONTROLS"
-            "PARADA DE EMERGENCIA",                    // 222="EMERGENCY STOP"
-            "Cada ventilador solo se puede seleccionar una vez", // 223="Each fan can only be
-                                                                 // selected once"
-            "Editar",                                            // 224="Edit"
-            "Editar Preajuste",                                  // 225="Edit Preset"
-            "Editar Ranura 1",                                   // 226="Edit Slot 1"
-            "Editar Colores del Tema",                           // 227="Edit Theme Colors"
-            "Editar Colores del Tema (Modificado)", // 228="Edit Theme Colors (Modified)"
-            "Transcurrido",                         // 229="Elapsed"
-            "Parada de Emergencia",                 // 230="Emergency Stop"
-            "Parada de Emergencia (M112)",          // 231="Emergency Stop (M112)"
-            "¿Parada de Emergencia?",               // 232="Emergency Stop?"
-            "Vacío",                                // 233="Empty"
-            "Las ranuras vacías desactivan la funcionalidad asociada", // 234="Empty slots disable
-                                                                       // the associated
-                                                                       // functionality"
-            "Activar",                                                 // 235="Enable"
-            "Activar Monitoreo",                                       // 236="Enable Monitoring"
-            "Activar Retracción",                                      // 237="Enable Retraction"
-            "Activar Timelapse",                                       // 238="Enable Timelapse"
-            "Activar efectos de movimiento de la interfaz", // 239="Enable UI motion effects"
-            "Active WiFi para escanear",                    // 240="Enable WiFi to scan"
-            "Active WiFi para buscar redes",      // 241="Enable WiFi to scan for networks"
-            "Activar retroalimentación de audio", // 242="Enable audio feedback"
-            "Activar seguimiento detallado de preparación de impresión (Recomendado)", // 243="Enable
-                                                                                       // detailed
-                                                                                       // print
-                                                                                       // preparation
-                                                                                       // tracking
-                                                                                       // (Recommended)"
-            "Activado",                                      // 244="Enabled"
-            "Terminado",                                     // 245="Ended"
-            "English",                                       // 246="English"
-            "¡Mejora Completa!",                             // 247="Enhancement Complete!"
-            "Mejora Fallida",                                // 248="Enhancement Failed"
-            "Ingrese comando G-code...",                     // 249="Enter G-code command..."
-            "Ingrese Contraseña WiFi",                       // 250="Enter WiFi Password"
-            "Ingrese un nombre para su tema personalizado:", // 251="Enter a name for your custom
-                                                             // theme:"
-            "Ingrese un nombre para guardar este perfil", // 252="Enter a name to save this profile"
-            "Ingrese nombre de red",                      // 253="Enter network name"
-            "Ingrese contraseña",                         // 254="Enter password"
-            "Error",                                      // 255="Error"
-            "Estado de error",                            // 256="Error state"
-            "Español",                                    // 257="Español"
-            "Ethernet",                                   // 258="Ethernet"
-            "Excluir",                                    // 259="Exclude"
-            "Ejecutar macros de impresora",               // 260="Execute printer macros"
-            "Ventilador de Escape",                       // 261="Exhaust Fan"
-            "Explore cómo la paleta seleccionada da forma a los colores de texto, controles y "
-            "estado.", // 262="Explore how the selected palette shapes text, controls, and status
-                       // colors."
-            "Explorar paleta y vista previa",          // 263="Explore palette and preview"
-            "Cebado extra para compensar el rezumado", // 264="Extra prime to compensate ooze"
-            "Extruir",                                 // 265="Extrude"
-            "Extruir / Retraer",                       // 266="Extrude / Retract"
-            "Extrusor",                                // 267="Extruder"
-            "Ajuste PID del Extrusor",                 // 268="Extruder PID Tuning"
-            "El extrusor calienta automáticamente según el material", // 269="Extruder heats
-                                                                      // automatically based on
-                                                                      // material"
-            "Tasa de extrusión",                                      // 270="Extrusion rate"
-            "FALLIDO",                                                // 271="FAILED"
-            "FILAMENTO",                                              // 272="FILAMENT"
-            "Restaurar de Fábrica",                                   // 273="Factory Reset"
-            "Fallido",                                                // 274="Failed"
-            "Error al guardar archivo de tema",             // 275="Failed to save theme file"
-            "Alimentar filamento directamente al extrusor", // 276="Feed filament directly to
-                                                            // extruder"
-            "Filamento",                                    // 277="Filament"
-            "Sensor de Filamento",                          // 278="Filament Sensor"
-            "Sensores de Filamento",                        // 279="Filament Sensors"
-            "Filamento Usado",                              // 280="Filament Used"
-            "Filamento por Tipo",                           // 281="Filament by Type"
-            "Sensores de diámetro de filamento para compensación de flujo", // 282="Filament
-                                                                            // diameter sensors for
-                                                                            // flow compensation"
-            "Sensores de detección de agotamiento y movimiento de filamento", // 283="Filament
-                                                                              // runout and motion
-                                                                              // detection sensors"
-            "Seguimiento e inventario de filamento", // 284="Filament tracking and inventory"
-            "Archivo",                               // 285="File"
-            "Info de Archivo",                       // 286="File Info"
-            "Nombre de Archivo",                     // 287="Filename"
-            "Archivos",                              // 288="Files"
-            "Relleno: 100% / 75% / 40% / 10%",       // 289="Fill: 100% / 75% / 40% / 10%"
-            "Reinicio de Firmware",                  // 290="Firmware Restart"
-            "Anillos Concéntricos Planos (ams_slot existente)", // 291="Flat Concentric Rings
-                                                                // (existing ams_slot)"
-            "Tasa de Flujo",                                    // 292="Flow Rate"
-            "Formando punta...",                                // 293="Forming tip..."
-            "Cuadros por segundo",                              // 294="Framerate"
-            "Français",                                         // 295="Français"
-            "Frec",                                             // 296="Freq"
-            "Frente",                                           // 297="Front"
-            "Consola G-code",                                   // 298="G-code Console"
-            "Vista Previa de G-code",                           // 299="G-code Preview"
-            "Los comandos G-code aparecerán aquí", // 300="G-code commands will appear here"
-            "Fantasma:",                           // 301="Ghost:"
-            "Gris",                                // 302="Gray"
-            "Happy Hare MMU",                      // 303="Happy Hare MMU"
-            "Hardware",                            // 304="Hardware"
-            "Estado del Hardware",                 // 305="Hardware Health"
-            "Problemas de Hardware",               // 306="Hardware Issues"
-            "Nombre del Hardware",                 // 307="Hardware Name"
-            "El hardware se valida al inicio y reconexión", // 308="Hardware is validated on startup
-                                                            // and reconnection"
-            "Tenga un pedazo de papel listo antes de comenzar.", // 309="Have a piece of paper ready
-                                                                 // before starting."
-            "Tenga lista su herramienta de ajuste de cama (destornillador, llave Allen, etc.) si "
-            "su cama no se ajusta con ruedas de pulgar u otro mecanismo integrado.", // 310="Have
-                                                                                     // your bed
-                                                                                     // adjustment
-                                                                                     // tool
-                                                                                     // (screwdriver,
-                                                                                     // hex-key,
-                                                                                     // etc.) ready
-                                                                                     // if your bed
-                                                                                     // isn't
-                                                                                     // adjusted
-                                                                                     // with thumb
-                                                                                     // wheels or
-                                                                                     // some other
-                                                                                     // built-in
-                                                                                     // mechanism."
-            "Encabezado",                    // 311="Heading"
-            "Estabilización Térmica",        // 312="Heat Soak"
-            "Calentar a 170°C para extruir", // 313="Heat to 170°C to extrude"
-            "Temperatura de Cama Caliente",  // 314="Heatbed Temperature"
-            "Cama Caliente",                 // 315="Heated Bed"
-            "Calentando...",                 // 316="Heating..."
-            "HelixScreen se Bloqueó",        // 317="HelixScreen Crashed"
-            "HelixScreen se integrará con su cambiador de filamento para operaciones de impresión "
-            "multi-bobina/color.", // 318="HelixScreen will integrate with your filament changer for
-                                   // multi-spool/color print operations."
-            "Mayor = más rápido",  // 319="Higher = faster"
-            "Inicio",              // 320="Home"
-            "Origen todo",         // 321="Home All"
-            "Origen X",            // 322="Home X"
-            "Origen Y",            // 323="Home Y"
-            "Origen Z",            // 324="Home Z"
-            "Progreso Horizontal (Asistente de Nivelación)", // 325="Horizontal Progress (Leveling
-                                                             // Wizard)"
-            "Host",                                          // 326="Host"
-            "Hotend",                                        // 327="Hotend"
-            "Ventilador de Hotend",                          // 328="Hotend Fan"
-            "Calentador de Hotend",                          // 329="Hotend Heater"
-            "Con qué frecuencia verificar Spoolman para actualizaciones de peso", // 330="How often
-                                                                                  // to check
-                                                                                  // Spoolman for
-                                                                                  // weight updates"
-            "Humedad",                                                            // 331="Humidity"
-            "Sensores de Humedad",                             // 332="Humidity Sensors"
-            "IP:",                                             // 333="IP:"
-            "Inactivo",                                        // 334="Idle"
-            "Ignorar",                                         // 335="Ignore"
-            "En Progreso",                                     // 336="In Progress"
-            "Indexando G-code...",                             // 337="Indexing G-code..."
-            "Inicializando...",                                // 338="Initializing..."
-            "Entrada",                                         // 339="Input"
-            "Moldeador de Entrada",                            // 340="Input Shaper"
-            "Moldeado de Entrada",                             // 341="Input Shaping"
-            "Sensores de calibración de moldeador de entrada", // 342="Input shaper calibration
-                                                               // sensors"
-            "El moldeado de entrada reduce los artefactos de vibración (resonancia) en sus "
-            "impresiones.", // 343="Input shaping reduces vibration artifacts (ringing) in your
-                            // prints."
-            "Instalar Plugin HelixPrint", // 344="Install HelixPrint Plugin"
-            "Instalar Plugin",            // 345="Install Plugin"
-            "Instale el plugin HelixPrint para habilitar modificaciones rápidas de G-code. Ejecute "
-            "este comando vía SSH en su impresora:", // 346="Install the HelixPrint plugin to enable
-                                                     // fast G-code modifications. Run this command
-                                                     // via SSH on your printer:"
-            "Instalación Fallida",                   // 347="Installation Failed"
-            "La instalación tarda aproximadamente 30 segundos.", // 348="Installation takes about 30
-                                                                 // seconds."
-            "Instalando...",                                     // 349="Installing..."
-            "Intensidad",                                        // 350="Intensity"
-            "G-code 3D interactivo durante impresiones", // 351="Interactive 3D G-code during
-                                                         // prints"
-            "Calibración interactiva de sonda",          // 352="Interactive probe calibration"
-            "Descripción del problema",                  // 353="Issue description"
-            "Italiano",                                  // 354="Italiano"
-            "Justo ahora",                               // 355="Just now"
-            "Kd:",                                       // 356="Kd:"
-            "Continuar Imprimiendo",                     // 357="Keep Printing"
-            "Mantener Requerido",                        // 358="Keep Required"
-            "Prueba de Teclado (estilo Gboard)",         // 359="Keyboard Test (Gboard-style)"
-            "Ki:",                                       // 360="Ki:"
-            "Klipper",                                   // 361="Klipper"
-            "Klipper ha entrado en estado de apagado. Esto puede deberse a una parada de "
-            "emergencia, fuga térmica o error de configuración.", // 362="Klipper has entered
-                                                                  // shutdown state. This may be due
-                                                                  // to an emergency stop, thermal
-                                                                  // runaway, or configuration
-                                                                  // error."
-            "Klipper se reiniciará para aplicar los cambios",  // 363="Klipper will restart to apply
-                                                               // changes"
-            "Klipper se reiniciará para aplicar los cambios.", // 364="Klipper will restart to apply
-                                                               // changes."
-            "Klipper se reiniciará para aplicar los nuevos valores PID.", // 365="Klipper will
-                                                                          // restart to apply new
-                                                                          // PID values."
-            "Kp:",                                                        // 366="Kp:"
-            "Tira LED",                                                   // 367="LED Strip"
-            "LED encendido al Iniciar",                                   // 368="LED on at Start"
-            "CARGADO",                                                    // 369="LOADED"
-            "Idioma",                                                     // 370="Language"
-            "Últimos 7 días",                                             // 371="Last 7 days"
-            "Última impresión cancelada", // 372="Last print cancelled"
-            "Última impresión fallida",   // 373="Last print failed"
-            "Más Tarde",                  // 374="Later"
-            "Capa",                       // 375="Layer"
-            "Altura de Capa",             // 376="Layer Height"
-            "El modo de capa captura un cuadro por cambio de capa. Mejor para la mayoría de las "
-            "impresiones.", // 377="Layer mode captures one frame per layer change. Best for most
-                            // prints."
-            "Capa:",        // 378="Layer:"
-            "Capas",        // 379="Layers"
-            "Longitud:",    // 380="Length:"
-            "Claro",        // 381="Light"
-            "Cargar",       // 382="Load"
-            "Cargar Filamento",                        // 383="Load Filament"
-            "Cargado",                                 // 384="Loaded"
-            "Error de Carga",                          // 385="Loading Error"
-            "Cargando G-code...",                      // 386="Loading G-code..."
-            "Cargando filamento...",                   // 387="Loading filament..."
-            "Cargando historial...",                   // 388="Loading history..."
-            "Cargando bobinas...",                     // 389="Loading spools..."
-            "Cargando...",                             // 390="Loading..."
-            "Bloqueado durante impresión",             // 391="Locked during print"
-            "M para alternar",                         // 392="M to toggle"
-            "MAC:",                                    // 393="MAC:"
-            "Iconos MDI",                              // 394="MDI Icons"
-            "CONFIGURADO FALTANTE",                    // 395="MISSING CONFIGURED"
-            "MOVIMIENTO",                              // 396="MOTION"
-            "Límites de la Máquina",                   // 397="Machine Limits"
-            "Explorador de Macros",                    // 398="Macro Browser"
-            "Botones de Macro",                        // 399="Macro Buttons"
-            "Macro para calibración de malla de cama", // 400="Macro for bed mesh calibration"
-            "Macro para estabilización térmica de cámara/cama",  // 401="Macro for chamber/bed heat
-                                                                 // soak"
-            "Macro para nivelación física de cama (QGL/Z-Tilt)", // 402="Macro for physical bed
-                                                                 // leveling (QGL/Z-Tilt)"
-            "Macro para cancelar una impresión activa",    // 403="Macro to cancel an active print"
-            "Macro para limpiar la boquilla",              // 404="Macro to clean/wipe the nozzle"
-            "Macro para cargar filamento en el extrusor",  // 405="Macro to load filament into
-                                                           // extruder"
-            "Macro para pausar una impresión activa",      // 406="Macro to pause an active print"
-            "Macro para purgar/cebar la boquilla",         // 407="Macro to purge/prime the nozzle"
-            "Macro para reanudar una impresión pausada",   // 408="Macro to resume a paused print"
-            "Macro para descargar filamento del extrusor", // 409="Macro to unload filament from
-                                                           // extruder"
-            "Macros",                                      // 410="Macros"
-            "Tira LED Principal",                          // 411="Main LED Strip"
-            "Hacer Opcional",                              // 412="Make Optional"
-            "Hacer que la malla de cama y QGL sean omitibles", // 413="Make bed mesh and QGL
-                                                               // skippable"
-            "Administrar",                                     // 414="Manage"
-            "Nivelación Manual de Cama",                       // 415="Manual Bed Leveling"
-            "Material",                                        // 416="Material"
-            "Indicador de Carga Material Design",              // 417="Material Design Spinner"
-            "Aceleración Máxima",                              // 418="Max Acceleration"
-            "Velocidad Máxima",                                // 419="Max Velocity"
-            "Aceleración Z Máxima",                            // 420="Max Z Accel"
-            "Velocidad Z Máxima",                              // 421="Max Z Velocity"
-            "Velocidad máxima en esquinas (mm/s)", // 422="Max speed through corners (mm/s)"
-            "Aceleración máxima (mm/s²)",          // 423="Maximum acceleration (mm/s²)"
-            "Velocidad máxima del cabezal (mm/s)", // 424="Maximum toolhead speed (mm/s)"
-            "Medir Ruido",                         // 425="Measure Noise"
-            "Memoria (MB)",                        // 426="Memory (MB)"
-            "Malla Completa",                      // 427="Mesh Complete"
-            "Modo",                                // 428="Mode"
-            "Modificado",                          // 429="Modified"
-            "Mes",                                 // 430="Month"
-            "Moonraker",                           // 431="Moonraker"
-            "Movimiento",                          // 432="Motion"
-            "Movimiento: XYZ",                     // 433="Motion: XYZ"
-            "Motores Apagados",                    // 434="Motors Off"
-            "Mover",                               // 435="Move"
-            "Mueva el papel hacia adelante y atrás mientras ajusta. Deténgase cuando el papel se "
-            "enganche ligeramente pero aún se deslice.",   // 436="Move paper back and forth while
-                                                           // adjusting. Stop when paper catches
-                                                           // slightly but still slides."
-            "Velocidad de movimiento",                     // 437="Movement speed"
-            "Multi-Filamento",                             // 438="Multi-Filament"
-            "Multi-Material",                              // 439="Multi-Material"
-            "Mi Tema Personalizado",                       // 440="My Custom Theme"
-            "Mi Panel",                                    // 441="My Panel"
-            "Mi Impresora",                                // 442="My Printer"
-            "RECIÉN DESCUBIERTO",                          // 443="NEWLY DISCOVERED"
-            "NOTIFICACIONES",                              // 444="NOTIFICATIONS"
-            "Nombre",                                      // 445="Name"
-            "Dirección de Red",                            // 446="Network Address"
-            "Nombre de Red",                               // 447="Network Name"
-            "Nombre de Red (SSID)",                        // 448="Network Name (SSID)"
-            "Configuración de Red",                        // 449="Network Settings"
-            "Prueba de Red",                               // 450="Network Test"
-            "Nunca",                                       // 451="Never"
-            "Nuevos Valores PID",                          // 452="New PID Values"
-            "Nuevo Z-Offset: 0.000",                       // 453="New Z-Offset: 0.000"
-            "Nombre del nuevo perfil",                     // 454="New profile name"
-            "Siguiente",                                   // 455="Next"
-            "No hay sistema AMS conectado.",               // 456="No AMS system connected."
-            "Sin Historial",                               // 457="No History"
-            "No se Encontraron Macros",                    // 458="No Macros Found"
-            "Sin Dispositivos de Energía",                 // 459="No Power Devices"
-            "Sin Bobinas",                                 // 460="No Spools"
-            "Sin archivo cargado",                         // 461="No file loaded"
-            "No hay archivos disponibles para imprimir",   // 462="No files available for printing"
-            "No hay malla cargada",                        // 463="No mesh loaded"
-            "No se encontraron redes",                     // 464="No networks found"
-            "Sin notificaciones",                          // 465="No notifications"
-            "No se encontraron plugins",                   // 466="No plugins found"
-            "Sin vista previa",                            // 467="No preview"
-            "Aún no hay historial de impresión",           // 468="No print history yet"
-            "No se encontró macro de inicio de impresión", // 469="No print start macro found"
-            "No hay perfiles disponibles",                 // 470="No profiles available"
-            "No se detectaron sensores",                   // 471="No sensors detected"
-            "No hay bobinas disponibles",                  // 472="No spools available"
-            "Ahora No",                                    // 473="Not Now"
-            "No conectado",                                // 474="Not connected"
-            "Notificaciones",                              // 475="Notifications"
-            "Notificar cuando termine la impresión",       // 476="Notify when print finishes"
-            "Boquilla",                                    // 477="Nozzle"
-            "Cebado de Boquilla",                          // 478="Nozzle Priming"
-            "Temp de Boquilla",                            // 479="Nozzle Temp"
-            "Temperatura de Boquilla",                     // 480="Nozzle Temperature"
-            "Boquilla °C",                                 // 481="Nozzle °C"
-            "Boquilla:",                                   // 482="Nozzle:"
-            "OK",                                          // 483="OK"
-            "Apagado",                                     // 484="Off"
-            "Sin conexión",                                // 485="Offline"
-            "Encendido",                                   // 486="On"
-            "Abrir",                                       // 487="Open"
-            "Operaciones",                                 // 488="Operations"
-            "Optimice su Impresión",                       // 489="Optimize Your Printing"
-            "O Ingrese Manualmente",                       // 490="Or Enter Manually"
-            "PETG",                                        // 491="PETG"
-            "Ajuste PID",                                  // 492="PID Tuning"
-            "El ajuste PID optimiza el control de temperatura para un calentamiento estable.", // 493="PID
-                                                                                               // tuning
-                                                                                               // optimizes
-                                                                                               // temperature
-                                                                                               // control
-                                                                                               // for
-                                                                                               // stable
-                                                                                               // heating."
-            "PLA",                                 // 494="PLA"
-            "PLA - Negro",                         // 495="PLA - Black"
-            "PASOS PREVIOS A IMPRESIÓN",           // 496="PRE-PRINT STEPS"
-            "IMPRESORA",                           // 497="PRINTER"
-            "Calibración con Prueba de Papel",     // 498="Paper Test Calibration"
-            "Ventilador de Enfriamiento de Pieza", // 499="Part Cooling Fan"
-            "Ventilador de Pieza",                 // 500="Part Fan"
-            "Contraseña",                          // 501="Password"
-            "La contraseña no puede estar vacía",  // 502="Password cannot be empty"
-            "Pausar",                              // 503="Pause"
-            "Pausado",                             // 504="Paused"
-            "Pausado (requiere atención)",         // 505="Paused (attention needed)"
-            "Pico:",                               // 506="Peak:"
-            "Seguimiento de Fase",                 // 507="Phase Tracking"
-            "Elegir Color",                        // 508="Pick Color"
-            "Coloque plugins en el directorio de plugins para extender HelixScreen", // 509="Place
-                                                                                     // plugins in
-                                                                                     // the plugins
-                                                                                     // directory to
-                                                                                     // extend
-                                                                                     // HelixScreen"
-            "Por favor ingrese un nombre de tema", // 510="Please enter a theme name"
-            "Por favor espere mientras la impresora hace origen y sondea.", // 511="Please wait
-                                                                            // while the printer
-                                                                            // homes and probes."
-            "Por favor espere mientras la impresora sondea cada posición de tornillo.", // 512="Please
-                                                                                        // wait
-                                                                                        // while the
-                                                                                        // printer
-                                                                                        // probes
-                                                                                        // each
-                                                                                        // screw
-                                                                                        // position."
-            "Plugin instalado exitosamente.", // 513="Plugin installed successfully."
-            "Plugins",                        // 514="Plugins"
-            "Los plugins se descubren al iniciar la aplicación", // 515="Plugins are discovered on
-                                                                 // application startup"
-            "Polymaker",                                         // 516="Polymaker"
-            "Puerto",                                            // 517="Port"
-            "Português",                                         // 518="Português"
-            "Posición",                                          // 519="Position"
-            "Energía",                                           // 520="Power"
-            "Control de Energía",                                // 521="Power Control"
-            "Precalentar",                                       // 522="Preheat"
-            "Preparando Impresión",                              // 523="Preparing Print"
-            "Preparando...",                                     // 524="Preparing..."
-            "Preajustes",                                        // 525="Presets"
-            "Anterior",                                          // 526="Previous"
-            "Primario",                                          // 527="Primary"
-            "Imprimir",                                          // 528="Print"
-            "Impresión Cancelada",                               // 529="Print Cancelled"
-            "Impresión Completa",                                // 530="Print Complete"
-            "¡Impresión Completa!",                              // 531="Print Complete!"
-            "Alerta de Impresión Completa",                      // 532="Print Completion Alert"
-            "Detalles de Impresión",                             // 533="Print Details"
-            "Archivo de Impresión",                              // 534="Print File"
-            "Archivos de Impresión",                             // 535="Print Files"
-            "Historial de Impresión",                            // 536="Print History"
-            "Horas de Impresión",                                // 537="Print Hours"
-            "Velocidad de Impresión",                            // 538="Print Speed"
-            "Estado de Impresión",                               // 539="Print Status"
-            "Tiempo de Impresión",                               // 540="Print Time"
-            "Ajuste de Impresión",                               // 541="Print Tuning"
-            "Impresora",                                         // 542="Printer"
-            "Nombre de Impresora",                               // 543="Printer Name"
-            "Apagado de Impresora",                              // 544="Printer Shutdown"
-            "Tipo de Impresora",                                 // 545="Printer Type"
-            "Imprimiendo",                                       // 546="Printing"
-            "Tendencia de Impresiones",                          // 547="Prints Trend"
-            "Privado:",                                          // 548="Private:"
-            "Sonda",                                             // 549="Probe"
-            "Sensor de Sonda",                                   // 550="Probe Sensor"
-            "Sensores de Sonda",                                 // 551="Probe Sensors"
-            "Sondeando Malla de Cama",                           // 552="Probing Bed Mesh"
-            "Sondeando Tornillos de Cama...",                    // 553="Probing Bed Screws..."
-            "Sondeando Cama...",                                 // 554="Probing Bed..."
-            "Sondeo Fallido",                                    // 555="Probing Failed"
-            "Procesando...",                                     // 556="Processing..."
-            "Perfil",                                            // 557="Profile"
-            "Nombre del perfil (ej., default)",         // 558="Profile name (e.g., default)"
-            "Perfiles",                                 // 559="Profiles"
-            "Progreso",                                 // 560="Progress"
-            "Pruebas de Barra de Progreso",             // 561="Progress Bar Tests"
-            "Purgar",                                   // 562="Purge"
-            "Purgar 50mm",                              // 563="Purge 50mm"
-            "BOTONES RÁPIDOS",                          // 564="QUICK BUTTONS"
-            "Nivelación de Pórtico Cuádruple",          // 565="Quad Gantry Level"
-            "Acciones Rápidas",                         // 566="Quick Actions"
-            "Botón Rápido 1",                           // 567="Quick Button 1"
-            "Botón Rápido 2",                           // 568="Quick Button 2"
-            "Acciones rápidas, calibración, velocidad", // 569="Quick actions, calibration, speed"
-            "RSS:",                                     // 570="RSS:"
-            "Re-sondear",                               // 571="Re-probe"
-            "Listo",                                    // 572="Ready"
-            "Recomendado",                              // 573="Recommended"
-            "Recomendado: 200°C para extrusor",         // 574="Recommended: 200°C for extruder"
-            "Grabar Timelapse",                         // 575="Record Timelapse"
-            "Grabe timelapses de sus impresiones",      // 576="Record timelapses of your prints"
-            "Modo de Grabación",                        // 577="Recording Mode"
-            "Recuperar",                                // 578="Recover"
-            "Reducir Resonancia",                       // 579="Reduce Ringing"
-            "Actualizar",                               // 580="Refresh"
-            "Intervalo de Actualización",               // 581="Refresh Interval"
-            "Restante",                                 // 582="Remaining"
-            "Eliminar plugin de la impresora",          // 583="Remove plugin from printer"
-            "Renombrar",                                // 584="Rename"
-            "Renombrar Perfil de Malla",                // 585="Rename Mesh Profile"
-            "Reimprimir",                               // 586="Reprint"
-            "Requerir confirmación antes de parada de emergencia", // 587="Require confirmation
-                                                                   // before emergency stop"
-            "Requiere plugin Moonraker-Timelapse",  // 588="Requires Moonraker-Timelapse plugin"
-            "Restablecer",                          // 589="Reset"
-            "Restablecer Velocidad y Flujo a 100%", // 590="Reset Speed & Flow to 100%"
-            "Restablecer Velocidad y Flujo a 100%", // 591="Reset Speed &amp; Flow to 100%"
-            "Restablecer todos los ajustes y reiniciar asistente", // 592="Reset all settings and
-                                                                   // restart wizard"
-            "Restableciendo...",                                   // 593="Resetting..."
-            "Ajuste de compensación de resonancia", // 594="Resonance compensation tuning"
-            "Reiniciar HelixScreen",                // 595="Restart HelixScreen"
-            "Reiniciar Klipper",                    // 596="Restart Klipper"
-            "Reiniciar Ahora",                      // 597="Restart Now"
-            "Reinicio Requerido",                   // 598="Restart Required"
-            "Reiniciar la aplicación de pantalla",  // 599="Restart the display application"
-            "Reanudar",                             // 600="Resume"
-            "Reanudar Impresión",                   // 601="Resume Print"
-            "Retraer",                              // 602="Retract"
-            "Longitud de Retracción",               // 603="Retract Length"
-            "Velocidad de Retracción",              // 604="Retract Speed"
-            "Configuración de Retracción",          // 605="Retraction Settings"
-            "Reintentar",                           // 606="Retry"
-            "Revisar problemas de validación de hardware detectados", // 607="Review detected
-                                                                      // hardware validation issues"
-            "Revisar sus cambios",                                    // 608="Review your changes"
-            "Rol:",                                                   // 609="Role:"
-            "Sensor de Agotamiento",                                  // 610="Runout Sensor"
-            "MACROS ESTÁNDAR",                                        // 611="STANDARD MACROS"
-            "DETENER",                                                // 612="STOP"
-            "PROPIEDADES DE ESTILO",                                  // 613="STYLE PROPERTIES"
-            "SISTEMA",                                                // 614="SYSTEM"
-            "Guardar",                                                // 615="Save"
-            "Guardar y Reiniciar",                                    // 616="Save & Restart"
-            "Guardar y Reiniciar",                                    // 617="Save &amp; Restart"
-            "Guardar Como Nuevo",                                     // 618="Save As New"
-            "Guardar Configuración",                                  // 619="Save Config"
-            "Guardar Configuración de Impresora", // 620="Save Printer Configuration"
-            "Guardar Tema Como",                  // 621="Save Theme As"
-            "Guardar Z-Offset",                   // 622="Save Z-Offset"
-            "¿Guardar Z-Offset?",                 // 623="Save Z-Offset?"
-            "¿Guardar cambios para mantenerlos entre reinicios?", // 624="Save changes to persist
-                                                                  // them across restarts?"
-            "Guardando Configuración...",                         // 625="Saving Configuration..."
-            "¡Guardar reiniciará Klipper y CANCELARÁ cualquier impresión activa!", // 626="Saving
-                                                                                   // will restart
-                                                                                   // Klipper and
-                                                                                   // CANCEL any
-                                                                                   // active print!"
-            "Buscando redes...",      // 627="Scanning for networks..."
-            "Atenuación de Pantalla", // 628="Screen Dim"
-            "La pantalla atenúa el brillo después de un período de inactividad", // 629="Screen dims
-                                                                                 // to lower
-                                                                                 // brightness after
-                                                                                 // period of
-                                                                                 // inactivity"
-            "La pantalla se atenuará después del período de inactividad seleccionado", // 630="Screen
-                                                                                       // will dim
-                                                                                       // after the
-                                                                                       // selected
-                                                                                       // period of
-                                                                                       // inactivity"
-            "Velocidad de Desplazamiento", // 631="Scroll Speed"
-            "Buscar archivo...",           // 632="Search filename..."
-            "Secundario",                  // 633="Secondary"
-            "Seguridad",                   // 634="Security"
-            "Seleccionar",                 // 635="Select"
-            "Seleccione 'Ninguno' si no tiene un sensor de filamento, o si no desea pausar al "
-            "agotarse.", // 636="Select 'None' if you don't have a filament sensor, or if you don't
-                         // want to pause on runout."
-            "Seleccione 'Ninguno' si tiene una sonda dedicada, o no usa nivelación de malla de "
-            "cama.", // 637="Select 'None' if you have a dedicated probe, or don't use bed mesh
-                     // leveling."
-            "Seleccionar Filamento",                       // 638="Select Filament"
-            "Seleccionar archivo",                         // 639="Select File"
-            "Seleccionar Archivo G-Code",                  // 640="Select G-Code File"
-            "Seleccionar Calentador",                      // 641="Select Heater"
-            "Seleccionar macro para el primer botón",      // 642="Select macro for first button"
-            "Seleccionar macro para el segundo botón",     // 643="Select macro for second button"
-            "Seleccionando ranura...",                     // 644="Selecting slot..."
-            "Pruebas de Parámetros de Tamaño Semántico",   // 645="Semantic Size Parameter Tests"
-            "Enviar comandos directamente a la impresora", // 646="Send commands directly to
-                                                           // printer"
-            "Sensores",                                    // 647="Sensors"
-            "Establecer ",                                 // 648="Set "
-            "Ajustes",                                     // 649="Settings"
-            "Intensidad de Sombra",                        // 650="Shadow Intensity"
-            "Moldeador",                                   // 651="Shaper"
-            "Brillo:",                                     // 652="Shininess:"
-            "Mostrar estado detallado de preparación de impresión", // 653="Show detailed print
-                                                                    // preparation status"
-            "Lado",                                                 // 654="Side"
-            "Tamaño",                                               // 655="Size"
-            "Omitir por ahora",                                     // 656="Skip for now"
-            "Ranura 1",                                             // 657="Slot 1"
-            "Las etiquetas pequeñas ayudan a mantener los controles calmados y enfocados.", // 658="Small
-                                                                                            // labels
-                                                                                            // help
-                                                                                            // keep
-                                                                                            // controls
-                                                                                            // calm
-                                                                                            // and
-                                                                                            // focused."
-            "Algunos ajustes tendrán efecto después de reiniciar.", // 659="Some settings will take
-                                                                    // effect after restart."
-            "Sonidos",                                              // 660="Sounds"
-            "Especular:",                                           // 661="Specular:"
-            "Velocidad",                                            // 662="Speed"
-            "Configuración de Velocidad",                           // 663="Speed Settings"
-            "Velocidad del movimiento de cebado",                   // 664="Speed of prime movement"
-            "Velocidad del movimiento de retracción",     // 665="Speed of retraction movement"
-            "Velocidad:",                                 // 666="Speed:"
-            "Visualización de Bobina (Lienzo Pseudo-3D)", // 667="Spool Visualization (Pseudo-3D
-                                                          // Canvas)"
-            "Spoolman",                                   // 668="Spoolman"
-            "Spoolman no tiene bobinas configuradas",     // 669="Spoolman has no spools configured"
-            "Velocidad de Esquina Cuadrada",              // 670="Square Corner Velocity"
-            "En espera",                                  // 671="Standby"
-            "Iniciar Calibración",                        // 672="Start Calibration"
-            "Iniciar Sondeo",                             // 673="Start Probing"
-            "Iniciado",                                   // 674="Started"
-            "Estado",                                     // 675="Status"
-            "Iconos de estado",                           // 676="Status icons"
-            "Paso",                                       // 677="Step"
-            "Prueba de Widget de Progreso por Pasos",     // 678="Step Progress Widget Test"
-            "Detener",                                    // 679="Stop"
-            "Detener Secado",                             // 680="Stop Drying"
-            "¿Detener Impresión?",                        // 681="Stop Print?"
-            "Detiene todo movimiento. Requiere reinicio de firmware.", // 682="Stops all motion.
-                                                                       // Requires firmware
-                                                                       // restart."
-            "Estilizado (valor=75)",                                   // 683="Styled (value=75)"
-            "Tasa de Éxito",                                           // 684="Success Rate"
-            "¡Éxito!",                                                 // 685="Success!"
-            "Las superficies heredan los tokens de fondo de la aplicación para modos claro y "
-            "oscuro.", // 686="Surfaces inherit app background tokens for light and dark modes."
-            "Sensores de Interruptor",              // 687="Switch Sensors"
-            "Cambiar entre temas claro y oscuro",   // 688="Switch between light and dark themes"
-            "Sincronizar con Spoolman",             // 689="Sync to Spoolman"
-            "Sincronizar con Spoolman",             // 690="Sync with Spoolman"
-            "Sysfs",                                // 691="Sysfs"
-            "Sistema detectado",                    // 692="System detected"
-            "Detección de color de filamento TD-1", // 693="TD-1 filament color detection"
-            "COLORES DEL TEMA",                     // 694="THEME COLORS"
-            "TPU",                                  // 695="TPU"
-            "Toque para mostrar teclado...",        // 696="Tap to show keyboard..."
-            "Objetivo",                             // 697="Target"
-            "Temperatura Objetivo",                 // 698="Target Temperature"
-            "Temperatura",                          // 699="Temperature"
-            "Temperaturas",                         // 700="Temperatures"
-            "Ajuste temporal para esta impresión, a menos que se guarde en el panel de Controles", // 701="Temporary adjustment for this print, unless saved on Controls panel"
-            "Terciario",           // 702="Tertiary"
-            "Probar Conexión",     // 703="Test Connection"
-            "Probar Red",          // 704="Test Network"
-            "Impresión de Prueba", // 705="Test Print"
-            "El plugin HelixPrint permite modificaciones rápidas de G-code directamente en su "
-            "impresora, como omitir la malla de cama para reimpresiones rápidas.", // 706="The
-                                                                                   // HelixPrint
-                                                                                   // plugin enables
-                                                                                   // fast G-code
-                                                                                   // modifications
-                                                                                   // directly on
-                                                                                   // your
-                                                                                   // printer—like
-                                                                                   // skipping bed
-                                                                                   // mesh for quick
-                                                                                   // reprints."
-            "El calentador se encenderá y apagará varias veces.",   // 707="The heater will cycle on
-                                                                    // and off several times."
-            "Tema",                                                 // 708="Theme"
-            "Colores del Tema",                                     // 709="Theme Colors"
-            "Preajuste de Tema",                                    // 710="Theme Preset"
-            "Los cambios de tema se aplican después de reiniciar.", // 711="Theme changes apply
-                                                                    // after restart."
-            "Los cambios de tema tendrán efecto después de reiniciar.", // 712="Theme changes will
-                                                                        // take effect after
-                                                                        // restart."
-            "Tema, brillo y configuración de suspensión", // 713="Theme, brightness, and sleep
-                                                          // settings"
-            "Barra delgada (alto=8)",                     // 714="Thin bar (height=8)"
-            "Esta calibración usa el método de fricción de papel para establecer su Z-offset.", // 715="This calibration uses the paper friction method to set your Z-offset."
-            "Esto puede tardar 1-2 minutos",       // 716="This may take 1-2 minutes"
-            "Esto puede tardar hasta 30 segundos", // 717="This may take up to 30 seconds"
-            "Este plugin permite que HelixScreen controle opciones de inicio de impresión como "
-            "malla de cama y QGL. Una vez instalado, use Configurar PRINT_START abajo para "
-            "habilitar pasos opcionales.", // 718="This plugin lets HelixScreen control print start
-                                           // options like bed mesh and QGL. Once installed, use
-                                           // Configure PRINT_START below to enable optional steps."
-            "Este proceso tarda 3-5 minutos. No interrumpa.", // 719="This process takes 3-5
-                                                              // minutes. Do not interrupt."
-            "Esta herramienta sondea cada tornillo de cama y le indica cuánto ajustar.", // 720="This
-                                                                                         // tool
-                                                                                         // probes
-                                                                                         // each bed
-                                                                                         // screw
-                                                                                         // and
-                                                                                         // tells
-                                                                                         // you how
-                                                                                         // much to
-                                                                                         // adjust."
-            "Esto detendrá inmediatamente todas las operaciones de la impresora. La impresora "
-            "requerirá un reinicio para reanudar.", // 721="This will immediately halt all printer
-                                                    // operations. The printer will require a
-                                                    // restart to resume."
-            "Esto restablecerá todos los ajustes a los valores predeterminados. Esta acción no se "
-            "puede deshacer.", // 722="This will reset all settings to defaults. This action cannot
-                               // be undone."
-            "Esto reiniciará Klipper.",   // 723="This will restart Klipper."
-            "Hora",                       // 724="Time"
-            "Formato de Hora",            // 725="Time Format"
-            "Timelapse",                  // 726="Timelapse"
-            "Timelapse Disponible",       // 727="Timelapse Available"
-            "Configuración de Timelapse", // 728="Timelapse Settings"
-            "Consejo:",                   // 729="Tip:"
-            "Alternar Función",           // 730="Toggle Feature"
-            "Herramienta",                // 731="Tool"
-            "Cambiador de Herramientas",  // 732="Tool Changer"
-            "Superior",                   // 733="Top"
-            "Total de Impresiones",       // 734="Total Prints"
-            "Calibración Táctil",         // 735="Touch Calibration"
-            "Toque en cualquier lugar para probar la calibración", // 736="Touch anywhere to test
-                                                                   // calibration"
-            "Toque la pantalla para despertar de la suspensión",   // 737="Touch screen to wake from
-                                                                   // sleep"
-            "Desplazamientos",                                     // 738="Travels"
-            "Solución de problemas:",                              // 739="Troubleshooting:"
-            "Ajustar",                                             // 740="Tune"
-            "Ajustar parámetros PID del calentador",   // 741="Tune heater PID parameters"
-            "Encender LED cuando la impresora inicie", // 742="Turn on LED when printer starts"
-            "Tipo",                                    // 743="Type"
-            "Escriba para previsualizar campo de entrada...", // 744="Type to preview input
-                                                              // field..."
-            "USB",                                            // 745="USB"
-            "Desinstalar Plugin HelixPrint",                  // 746="Uninstall HelixPrint Plugin"
-            "Desconocido",                                    // 747="Unknown"
-            "Bobina Desconocida",                             // 748="Unknown Spool"
-            "Paso Desconocido",                               // 749="Unknown Step"
-            "Descargar",                                      // 750="Unload"
-            "Descargar Filamento",                            // 751="Unload Filament"
-            "Descargando filamento...",                       // 752="Unloading filament..."
-            "Extra de Des-retracción",                        // 753="Unretract Extra"
-            "Velocidad de Des-retracción",                    // 754="Unretract Speed"
-            "Suba archivos gcode para comenzar",   // 755="Upload gcode files to get started"
-            "Usar retracción de firmware G10/G11", // 756="Use G10/G11 firmware retraction"
-            "ValgACE (ACE Pro)",                   // 757="ValgACE (ACE Pro)"
-            "Los valores se han guardado en la configuración de la impresora.", // 758="Values have
-                                                                                // been saved to
-                                                                                // printer
-                                                                                // configuration."
-            "Límites de velocidad y aceleración",          // 759="Velocity and acceleration limits"
-            "Fabricante",                                  // 760="Vendor"
-            "Versión",                                     // 761="Version"
-            "Progreso Vertical (Asistente de Retracción)", // 762="Vertical Progress (Retract
-                                                           // Wizard)"
-            "Vibración",                                   // 763="Vibration"
-            "Velocidad de reproducción de video",          // 764="Video playback speed"
-            "Ver Historial Completo",                      // 765="View Full History"
-            "Ver Preajustes",                              // 766="View Presets"
-            "Ver Timelapse",                               // 767="View Timelapse"
-            "Ver plugins instalados y estado", // 768="View installed plugins and status"
-            "Ver estadísticas de impresión e historial de trabajos", // 769="View print statistics
-                                                                     // and job history"
-            "Advertencia",                                           // 770="Warning"
-            "Semana",                                                // 771="Week"
-            "Los datos de peso se sincronizan desde Spoolman para mostrar el filamento restante. "
-            "Los cambios también se sincronizan cuando las impresiones inician, pausan o "
-            "completan.", // 772="Weight data is synced from Spoolman to display remaining filament.
-                          // Changes are also synced when prints start, pause, or complete."
-            "Configuración de sincronización de peso",     // 773="Weight sync settings"
-            "Blanco",                                      // 774="White"
-            "WiFi",                                        // 775="WiFi"
-            "Red WiFi",                                    // 776="WiFi Network"
-            "WiFi y Ethernet",                             // 777="WiFi and Ethernet"
-            "Configuración de WiFi y Ethernet",            // 778="WiFi and Ethernet configuration"
-            "Control de WiFi no disponible",               // 779="WiFi control unavailable"
-            "Hardware WiFi no disponible",                 // 780="WiFi hardware unavailable"
-            "Ancho",                                       // 781="Width"
-            "Sensores de Ancho",                           // 782="Width Sensors"
-            "X:",                                          // 783="X:"
-            "XY",                                          // 784="XY"
-            "Y:",                                          // 785="Y:"
-            "Año",                                         // 786="Year"
-            "Sus impresiones completadas aparecerán aquí", // 787="Your completed prints will appear
-                                                           // here"
-            "Z",                                           // 788="Z"
-            "Calibración Z",                               // 789="Z Calibration"
-            "Rango Z",                                     // 790="Z Range"
-            "Sondas Z para nivelación de cama y generación de malla", // 791="Z probes for bed
-                                                                      // leveling and mesh
-                                                                      // generation"
-            "Z-Offset",                                               // 792="Z-Offset"
-            "Calibración de Z-Offset",                                // 793="Z-Offset Calibration"
-            "Z-Offset:",                                              // 794="Z-Offset:"
-            "Ajuste Z-Tilt",                                          // 795="Z-Tilt Adjust"
-            "Z:",                                                     // 796="Z:"
-            "Z: 0.000",                                               // 797="Z: 0.000"
-            "Zoom",                                                   // 798="Zoom"
-            "^ FRENTE",                                               // 799="^ FRONT"
-            "hora",                                                   // 800="hour"
-            "horas",                                                  // 801="hours"
-            "lg",                                                     // 802="lg"
-            "md",                                                     // 803="md"
-            "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-            "minuto",                               // 805="minute"
-            "minutos",                              // 806="minutes"
-            "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-            "segundos",                             // 808="seconds"
-            "size=\"large\"",                       // 809="size="large""
-            "size=\"medium\"",                      // 810="size="medium""
-            "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-            "size=\"small\"",                       // 812="size="small""
-            "size=\"tiny\"",                        // 813="size="tiny""
-            "sm",                                   // 814="sm"
-            "true",                                 // 815="true"
-            "value=0 (muestra LLENO - ¡ERROR!)",    // 816="value=0 (shows FULL - BUG!)"
-            "value=1 (¿pequeño fragmento?)",        // 817="value=1 (tiny sliver?)"
-            "value=100 (debería estar lleno)",      // 818="value=100 (should be full)"
-            "xs",                                   // 819="xs"
-            "Русский",                              // 820="Русский"
-            "—",                                    // 821="—"
-            "•",                                    // 822="•"
-            "中文",                                 // 823="中文"
-            "日本語",                               // 824="日本語"
-            "󰅐",                                 // 825="󰅐"
-            "󰉋",                                 // 826="󰉋"
-            "󱧰",                                 // 827="󱧰"
-};
-
-static const char* fr_singulars[] = {
-    " / ",                                                // 0=" / "
-    " 0 / 0",                                             // 1=" 0 / 0"
-    "#808080",                                            // 2="#808080"
-    "#RRGGBB",                                            // 3="#RRGGBB"
-    "(0)",                                                // 4="(0)"
-    "(2.4GHz)",                                           // 5="(2.4GHz)"
-    "+",                                                  // 6="+"
-    "+0",                                                 // 7="+0"
-    "+0.01mm",                                            // 8="+0.01mm"
-    "+0.05mm",                                            // 9="+0.05mm"
-    "+0.1mm",                                             // 10="+0.1mm"
-    "+1mm",                                               // 11="+1mm"
-    "-",                                                  // 12="-"
-    "- Vérifiez [resonance_tester] dans printer.cfg",     // 13="- Check [resonance_tester] in
-                                                          // printer.cfg"
-    "- Assurez-vous que l'ADXL345 est connecté",          // 14="- Ensure ADXL345 is connected"
-    "- Essayez d'abord Mesurer le bruit",                 // 15="- Try Measure Noise first"
-    "--",                                                 // 16="--"
-    "---",                                                // 17="---"
-    "-0.01mm",                                            // 18="-0.01mm"
-    "-0.05mm",                                            // 19="-0.05mm"
-    "-0.1mm",                                             // 20="-0.1mm"
-    "-1mm",                                               // 21="-1mm"
-    "/",                                                  // 22="/"
-    "0.4-2mm entraînement direct, 4-6mm bowden",          // 23="0.4-2mm direct drive, 4-6mm bowden"
-    "1. L'imprimante fait l'origine et palpe le plateau", // 24="1. Printer homes and probes the
-                                                          // bed"
-    "1. L'imprimante fera l'origine et palpera chaque vis", // 25="1. Printer will home and probe
-                                                            // each screw"
-    "10mm",                                                 // 26="10mm"
-    "1mm",                                                  // 27="1mm"
-    "2. Placez du papier entre la buse et le plateau", // 28="2. Place paper between nozzle and bed"
-    "2. Les résultats indiquent combien tourner chaque vis", // 29="2. Results show how much to turn
-                                                             // each screw"
-    "200-230°C",                                             // 30="200-230°C"
-    "210°C / 60°C",                                          // 31="210°C / 60°C"
-    "230°C / 50°C",                                          // 32="230°C / 50°C"
-    "240°C / 80°C",                                          // 33="240°C / 80°C"
-    "250°C / 100°C",                                         // 34="250°C / 100°C"
-    "25mm",                                                  // 35="25mm"
-    "3. Ajustez les vis, puis re-palpez pour vérifier", // 36="3. Adjust screws, then re-probe to
-                                                        // verify"
-    "3. Abaissez la buse jusqu'à ce que le papier frotte légèrement", // 37="3. Lower nozzle until
-                                                                      // paper drags slightly"
-    "Aperçu 3D",                                                      // 38="3D Preview"
-    "4. Le papier doit bouger mais avec résistance",    // 39="4. Paper should move but with
-                                                        // resistance"
-    "4. Répétez jusqu'à ce que le plateau soit niveau", // 40="4. Repeat until bed is level"
-    "5mm",                                              // 41="5mm"
-    "60°C",                                             // 42="60°C"
-    "6mm",                                              // 43="6mm"
-    "850g",                                             // 44="850g"
-    "= Desserrer",                                      // 45="= Loosen"
-    "= Serrer",                                         // 46="= Tighten"
-    "?",                                                // 47="?"
-    "À PROPOS",                                         // 48="ABOUT"
-    "ABS",                                              // 49="ABS"
-    "Paramètres AMS",                                   // 50="AMS Settings"
-    "APPARENCE",                                        // 51="APPEARANCE"
-    "AUTOMATISATION",                                   // 52="AUTOMATION"
-    "Abandonner",                                       // 53="Abort"
-    "À propos",                                         // 54="About"
-    "Accél. à Décél.",                                  // 55="Accel to Decel"
-    "Limite d'accélération à décélération (mm/s²)",     // 56="Acceleration to deceleration limit
-                                                        // (mm/s²)"
-    "Accéléromètres",                                   // 57="Accelerometers"
-    "Accepter",                                         // 58="Accept"
-    "Action requise",                                   // 59="Action Required"
-    "Actions",                                          // 60="Actions"
-    "Actif",                                            // 61="Active"
-    "Actuel",                                           // 62="Actual"
-    "Ajouter un réseau masqué",                         // 63="Add Hidden Network"
-    "Ajuster le niveau de luminosité de l'écran",       // 64="Adjust screen brightness level"
-    "Ajustez les vis, puis re-palpez.",                 // 65="Adjust screws, then re-probe."
-    "Les ajustements restent actifs jusqu'au redémarrage. Enregistrez après la fin de "
-    "l'impression.",    // 66="Adjustments stay active until restart. Save after print completes."
-    "Paramètre avancé", // 67="Advanced Setting"
-    "Tous",             // 68="All"
-    "Toutes les vis sont dans la tolérance.",               // 69="All screws are within tolerance."
-    "Allwinner",                                            // 70="Allwinner"
-    "Quantité :",                                           // 71="Amount:"
-    "Un accéléromètre a été détecté sur votre imprimante.", // 72="An accelerometer was detected on
-                                                            // your printer."
-    "Une erreur s'est produite pendant la calibration.",    // 73="An error occurred during
-                                                            // calibration."
-    "Une erreur s'est produite pendant le palpage.", // 74="An error occurred during probing."
-    "Une erreur s'est produite lors du chargement du filament.", // 75="An error occurred while
-                                                                 // loading filament."
-    "Animations",                                                // 76="Animations"
-    "Arrière-plan de l'application",                             // 77="App Background"
-    "Appliquer",                                                 // 78="Apply"
-    "Appliquer les modifications",                               // 79="Apply Changes"
-    "Appliquer enregistre pour cette session uniquement", // 80="Apply saves for this session only"
-    "Application...",                                     // 81="Applying..."
-    "Êtes-vous sûr de vouloir annuler cette impression ? Toute la progression sera perdue.", // 82="Are
-                                                                                             // you
-                                                                                             // sure
-                                                                                             // you
-                                                                                             // want
-                                                                                             // to
-                                                                                             // cancel
-                                                                                             // this
-                                                                                             // print?
-                                                                                             // All
-                                                                                             // progress
-                                                                                             // will
-                                                                                             // be
-                                                                                             // lost."
-    "Attribuer la bobine",                                       // 83="Assign Spool"
-    "Attribuez un rôle pour activer la surveillance du capteur", // 84="Assign a role to enable
-                                                                 // sensor monitoring"
-    "Attribution au slot 1",                                     // 85="Assigning to Slot 1"
-    "Auto",                                                      // 86="Auto"
-    "Maillage auto du plateau",                                  // 87="Auto Bed Mesh"
-    "Préchauffage auto au chargement",                           // 88="Auto-Heat on Load"
-    "Palpage auto ou vérification manuelle des hauteurs de vis", // 89="Auto-probe or manually check
-                                                                 // screw heights"
-    "Rendu vidéo automatique",                                   // 90="Auto-render video"
-    "Calibration PID automatique",                               // 91="Automatic PID Calibration"
-    "Interroger automatiquement Spoolman pour les mises à jour de poids", // 92="Automatically poll
-                                                                          // Spoolman for weight
-                                                                          // updates"
-    "Réseaux disponibles",                                                // 93="Available Networks"
-    "Réseaux disponibles",                                                // 94="Available networks"
-    "Retour",                                                             // 95="Back"
-    "Sauvegarde",                                                         // 96="Backup"
-    "Plateau",                                                            // 97="Bed"
-    "Chauffage du plateau",                                               // 98="Bed Heater"
-    "Niveau du plateau",                                                  // 99="Bed Level"
-    "Mise à niveau du plateau",                                           // 100="Bed Leveling"
-    "Maillage du plateau",                                                // 101="Bed Mesh"
-    "Rendu du maillage du plateau",                                       // 102="Bed Mesh Render"
-    "Ajustement des vis du plateau", // 103="Bed Screw Adjustment"
-    "Vis du plateau",                // 104="Bed Screws"
-    "Le plateau est niveau !",       // 105="Bed is Level!"
-    "Plateau °C",                    // 106="Bed °C"
-    "Plateau :",                     // 107="Bed:"
-    "Noir",                          // 108="Black"
-    "Bluetooth",                     // 109="Bluetooth"
-    "Le texte de corps supporte des instructions plus longues tout en restant lisible.", // 110="Body
-                                                                                         // text
-                                                                                         // supports
-                                                                                         // longer
-                                                                                         // guidance
-                                                                                         // while
-                                                                                         // staying
-                                                                                         // readable."
-    "Opacité de la bordure",                                    // 111="Border Opacity"
-    "Rayon de la bordure",                                      // 112="Border Radius"
-    "Largeur de la bordure",                                    // 113="Border Width"
-    "Transparence de la bordure (0 = invisible, 255 = solide)", // 114="Border transparency (0 =
-                                                                // invisible, 255 = solid)"
-    "Luminosité",                                               // 115="Brightness"
-    "Parcourir",                                                // 116="Browse"
-    "Occupé",                                                   // 117="Busy"
-    "Bypass",                                                   // 118="Bypass"
-    "Mode bypass",                                              // 119="Bypass Mode"
-    "CALIBRATION",                                              // 120="CALIBRATION"
-    "MODIFIÉ DEPUIS LA DERNIÈRE SESSION",                       // 121="CHANGED FROM LAST SESSION"
-    "COULEURS REQUISES",                                        // 122="COLORS REQUIRED"
-    "CRITIQUE",                                                 // 123="CRITICAL"
-    "Calibrer",                                                 // 124="Calibrate"
-    "Calibrer X",                                               // 125="Calibrate X"
-    "Calibrer Y",                                               // 126="Calibrate Y"
-    "Calibrer la compensation de résonance", // 127="Calibrate resonance compensation"
-    "Calibration...",                        // 128="Calibrating..."
-    "Calibration",                           // 129="Calibration"
-    "Calibration & Outils",                  // 130="Calibration & Tools"
-    "Calibration &amp; Outils",              // 131="Calibration &amp; Tools"
-    "Calibration terminée !",                // 132="Calibration Complete!"
-    "Calibration échouée",                   // 133="Calibration Failed"
-    "Annuler",                               // 134="Cancel"
-    "Annuler l'impression",                  // 135="Cancel Print"
-    "Annulé",                                // 136="Cancelled"
-    "Chambre",                               // 137="Chamber"
-    "Ventilateur de chambre",                // 138="Chamber Fan"
-    "Surveillance de l'humidité de la chambre et du sécheur", // 139="Chamber and dryer humidity
-                                                              // monitoring"
-    "Chambre :",                                              // 140="Chamber:"
-    "Les modifications s'appliquent immédiatement. Ajustez pendant l'impression pour le réglage.", // 141="Changes apply immediately. Adjust during print for tuning."
-    "Les modifications sont temporaires et réinitialisées au redémarrage de l'imprimante", // 142="Changes
-                                                                                           // are
-                                                                                           // temporary
-                                                                                           // and
-                                                                                           // reset
-                                                                                           // on
-                                                                                           // printer
-                                                                                           // reboot"
-    "Vérifiez le chemin du filament et réessayez.", // 143="Check the filament path and try again."
-    "Vérification des slots...",                    // 144="Checking slots..."
-    "Choisir l'affichage 12 heures ou 24 heures",   // 145="Choose 12-hour or 24-hour time display"
-    "Choisir la langue d'affichage",                // 146="Choose display language"
-    "Choisir comment les images sont capturées pendant l'impression", // 147="Choose how frames are
-                                                                      // captured during printing"
-    "Choisir le mode de rendu pour la visualisation du G-code", // 148="Choose rendering mode for
-                                                                // G-code visualization"
-    "Choisir le mode de rendu pour la visualisation du maillage du plateau", // 149="Choose
-                                                                             // rendering mode for
-                                                                             // bed mesh
-                                                                             // visualization"
-    "Nettoyer la buse",                                                      // 150="Clean Nozzle"
-    "Effacer",                                                               // 151="Clear"
-    "Tout effacer",                                                          // 152="Clear All"
-    "Effacer l'attribution",                                // 153="Clear Assignment"
-    "Presse-papiers indisponible - utilisez SSH",           // 154="Clipboard unavailable - use SSH"
-    "Fermer",                                               // 155="Close"
-    "Plus proche = plus écrasé | Plus loin = moins écrasé", // 156="Closer = more squish | Farther =
-                                                            // less squish"
-    "Capteurs de couleur",                                  // 157="Color Sensors"
-    "Terminé",                                              // 158="Complete"
-    "Terminé",                                              // 159="Completed"
-    "Terminé en 3 palpages",                                // 160="Completed in 3 probes"
-    "Défini par la config (lecture seule)",                 // 161="Config-defined (read-only)"
-    "Configurer la rétraction firmware G10/G11", // 162="Configure G10/G11 firmware retraction"
-    "Configurer PRINT_START",                    // 163="Configure PRINT_START"
-    "Configurer l'intégration Spoolman et les paramètres de synchronisation du poids.", // 164="Configure
-                                                                                        // Spoolman
-                                                                                        // integration
-                                                                                        // and
-                                                                                        // weight
-                                                                                        // sync
-                                                                                        // settings."
-    "Configurer les appareils dans Moonraker",               // 165="Configure devices in Moonraker"
-    "Configurer les capteurs de détection de filament",      // 166="Configure filament detection
-                                                             // sensors"
-    "Configurer les boutons rapides et les macros standard", // 167="Configure quick buttons and
-                                                             // standard macros"
-    "Configurer l'enregistrement timelapse",                 // 168="Configure timelapse recording"
-    "Connecter",                                             // 169="Connect"
-    "Connecté",                                              // 170="Connected"
-    "Connexion",                                             // 171="Connecting"
-    "Connexion au réseau...",                                // 172="Connecting to network..."
-    "Connexion...",                                          // 173="Connecting..."
-    "Connexion",                                             // 174="Connection"
-    "Connexion échouée. Vérifiez le mot de passe.", // 175="Connection failed. Check password."
-    "La connexion doit être testée avec succès pour continuer", // 176="Connection must be tested
-                                                                // successfully to continue"
-    "Console",                                                  // 177="Console"
-    "Contrôler les fonctionnalités optionnelles de démarrage d'impression", // 178="Control optional
-                                                                            // print start features"
-    "Refroidir",                                                            // 179="Cool Down"
-    "Refroidissement",                                                      // 180="Cooldown"
-    "Refroidissement",                                                      // 181="Cooling"
-    "Copier la commande",                                                   // 182="Copy Command"
-    "Arrondi des coins (0 = anguleux, 40 = très arrondi)", // 183="Corner roundness (0 = sharp, 40 =
-                                                           // very round)"
-    "Créer une vidéo à la fin de l'impression",     // 184="Create video when print completes"
-    "Actuel / Cible",                               // 185="Current / Target"
-    "Maillage du plateau actuel",                   // 186="Current Mesh"
-    "Température actuelle",                         // 187="Current Temperature"
-    "Position Z actuelle",                          // 188="Current Z Position"
-    "Nom actuel :",                                 // 189="Current name:"
-    "Actuellement chargé",                          // 190="Currently Loaded"
-    "Impression en cours",                          // 191="Currently printing"
-    "Personnalisé...",                              // 192="Custom..."
-    "Coupe du filament...",                         // 193="Cutting filament..."
-    "DIAGNOSTICS",                                  // 194="DIAGNOSTICS"
-    "DÉSACTIVÉ",                                    // 195="DISABLED"
-    "Danger",                                       // 196="Danger"
-    "Mode sombre",                                  // 197="Dark Mode"
-    "Jour",                                         // 198="Day"
-    "Default (value=50)",                           // 199="Default (value=50)"
-    "Épaisseur de bordure par défaut",              // 200="Default border thickness"
-    "Définissez les macros dans votre printer.cfg", // 201="Define macros in your printer.cfg"
-    "Supprimer",                                    // 202="Delete"
-    "Delta :",                                      // 203="Delta:"
-    "Deutsch",                                      // 204="Deutsch"
-    "Opérations de l'appareil",                     // 205="Device Operations"
-    "Désactiver",                                   // 206="Disable"
-    "Imprimantes découvertes",                      // 207="Discovered Printers"
-    "Ignorer",                                      // 208="Dismiss"
-    "Affichage",                                    // 209="Display"
-    "Paramètres d'affichage",                       // 210="Display Settings"
-    "Veille de l'écran",                            // 211="Display Sleep"
-    "Ne pas enregistrer",                           // 212="Don't Save"
-    "Ne plus demander",                             // 213="Don't ask again"
-    "Terminé",                                      // 214="Done"
-    "Intensité de l'ombre portée (0 = désactivé)",  // 215="Drop shadow strength (0 = disabled)"
-    "Sécheur",                                      // 216="Dryer"
-    "Contrôle du sécheur",                          // 217="Dryer Control"
-    "Durée",                                        // 218="Duration"
-    "Arrêt d'urgence",                              // 219="E-Stop"
-    "Confirmation arrêt d'urgence",                 // 220="E-Stop Confirmation"
-    "CONTRÔLES D'URGENCE",                          // 221="EMERGENCY CONTROLS"
-    "ARRÊT D'URGENCE",                              // 222="EMERGENCY STOP"
-    "Chaque ventilateur ne peut être sélectionné qu'une fois", // 223="Each fan can only be selected
-                                                               // once"
-    "Modifier",                                                // 224="Edit"
-    "Modifier le préréglage",                                  // 225="Edit Preset"
-    "Modifier le slot 1",                                      // 226="Edit Slot 1"
-    "Modifier les couleurs du thème",                          // 227="Edit Theme Colors"
-    "Modifier les couleurs du thème (Modifié)",                // 228="Edit Theme Colors (Modified)"
-    "Écoulé",                                                  // 229="Elapsed"
-    "Arrêt d'urgence",                                         // 230="Emergency Stop"
-    "Arrêt d'urgence (M112)",                                  // 231="Emergency Stop (M112)"
-    "Arrêt d'urgence ?",                                       // 232="Emergency Stop?"
-    "Vide",                                                    // 233="Empty"
-    "Les slots vides désactivent la fonctionnalité associée",  // 234="Empty slots disable the
-                                                               // associated functionality"
-    "Activer",                                                 // 235="Enable"
-    "Activer la surveillance",                                 // 236="Enable Monitoring"
-    "Activer la rétraction",                                   // 237="Enable Retraction"
-    "Activer le timelapse",                                    // 238="Enable Timelapse"
-    "Activer les effets de mouvement de l'interface",          // 239="Enable UI motion effects"
-    "Activer le WiFi pour scanner",                            // 240="Enable WiFi to scan"
-    "Activer le WiFi pour scanner les réseaux", // 241="Enable WiFi to scan for networks"
-    "Activer le retour audio",                  // 242="Enable audio feedback"
-    "Activer le suivi détaillé de la préparation d'impression (Recommandé)", // 243="Enable detailed
-                                                                             // print preparation
-                                                                             // tracking
-                                                                             // (Recommended)"
-    "Activé",                                                                // 244="Enabled"
-    "Terminé",                                                               // 245="Ended"
-    "English",                                                               // 246="English"
-    "Amélioration terminée !",                       // 247="Enhancement Complete!"
-    "Amélioration échouée",                          // 248="Enhancement Failed"
-    "Entrez une commande G-code...",                 // 249="Enter G-code command..."
-    "Entrez le mot de passe WiFi",                   // 250="Enter WiFi Password"
-    "Entrez un nom pour votre thème personnalisé :", // 251="Enter a name for your custom theme:"
-    "Entrez un nom pour enregistrer ce profil",      // 252="Enter a name to save this profile"
-    "Entrez le nom du réseau",                       // 253="Enter network name"
-    "Entrez le mot de passe",                        // 254="Enter password"
-    "Erreur",                                        // 255="Error"
-    "État d'erreur",                                 // 256="Error state"
-    "Español",                                       // 257="Español"
-    "Ethernet",                                      // 258="Ethernet"
-    "Exclure",                                       // 259="Exclude"
-    "Exécuter les macros de l'imprimante",           // 260="Execute printer macros"
-    "Ventilateur d'extraction",                      // 261="Exhaust Fan"
-    "Explorez comment la palette sélectionnée façonne les couleurs du texte, des contrôles et des "
-    "statuts.", // 262="Explore how the selected palette shapes text, controls, and status colors."
-    "Explorer la palette et prévisualiser",                  // 263="Explore palette and preview"
-    "Amorce supplémentaire pour compenser le suintement",    // 264="Extra prime to compensate ooze"
-    "Extruder",                                              // 265="Extrude"
-    "Extruder / Rétracter",                                  // 266="Extrude / Retract"
-    "Extrudeur",                                             // 267="Extruder"
-    "Réglage PID de l'extrudeur",                            // 268="Extruder PID Tuning"
-    "L'extrudeur chauffe automatiquement selon le matériau", // 269="Extruder heats automatically
-                                                             // based on material"
-    "Taux d'extrusion",                                      // 270="Extrusion rate"
-    "ÉCHOUÉ",                                                // 271="FAILED"
-    "FILAMENT",                                              // 272="FILAMENT"
-    "Réinitialisation d'usine",                              // 273="Factory Reset"
-    "Échoué",                                                // 274="Failed"
-    "Échec de l'enregistrement du fichier de thème",         // 275="Failed to save theme file"
-    "Alimenter le filament directement vers l'extrudeur",    // 276="Feed filament directly to
-                                                             // extruder"
-    "Filament",                                              // 277="Filament"
-    "Capteur de filament",                                   // 278="Filament Sensor"
-    "Capteurs de filament",                                  // 279="Filament Sensors"
-    "Filament utilisé",                                      // 280="Filament Used"
-    "Filament par type",                                     // 281="Filament by Type"
-    "Capteurs de diamètre de filament pour compensation du débit", // 282="Filament diameter sensors
-                                                                   // for flow compensation"
-    "Capteurs de fin de filament et de détection de mouvement", // 283="Filament runout and motion
-                                                                // detection sensors"
-    "Suivi et inventaire du filament",                 // 284="Filament tracking and inventory"
-    "Fichier",                                         // 285="File"
-    "Info fichier",                                    // 286="File Info"
-    "Nom du fichier",                                  // 287="Filename"
-    "Fichiers",                                        // 288="Files"
-    "Remplissage : 100% / 75% / 40% / 10%",            // 289="Fill: 100% / 75% / 40% / 10%"
-    "Redémarrage firmware",                            // 290="Firmware Restart"
-    "Anneaux concentriques plats (ams_slot existant)", // 291="Flat Concentric Rings (existing
-                                                       // ams_slot)"
-    "Débit",                                           // 292="Flow Rate"
-    "Formation de la pointe...",                       // 293="Forming tip..."
-    "Fréquence d'images",                              // 294="Framerate"
-    "Français",                                        // 295="Français"
-    "Fréq",                                            // 296="Freq"
-    "Avant",                                           // 297="Front"
-    "Console G-code",                                  // 298="G-code Console"
-    "Aperçu G-code",                                   // 299="G-code Preview"
-    "Les commandes G-code apparaîtront ici",           // 300="G-code commands will appear here"
-    "Fantôme :",                                       // 301="Ghost:"
-    "Gris",                                            // 302="Gray"
-    "Happy Hare MMU",                                  // 303="Happy Hare MMU"
-    "Matériel",                                        // 304="Hardware"
-    "État du matériel",                                // 305="Hardware Health"
-    "Problèmes matériels",                             // 306="Hardware Issues"
-    "Nom du matériel",                                 // 307="Hardware Name"
-    "Le matériel est validé au démarrage et à la reconnexion", // 308="Hardware is validated on
-                                                               // startup and reconnection"
-    "Préparez une feuille de papier avant de commencer.", // 309="Have a piece of paper ready before
-                                                          // starting."
-    "Préparez votre outil de réglage du plateau (tournevis, clé Allen, etc.) si votre plateau "
-    "n'est pas ajusté avec des molettes ou un autre mécanisme intégré.", // 310="Have your bed
-                                                                         // adjustment tool
-                                                                         // (screwdriver, hex-key,
-                                                                         // etc.) ready if your bed
-                                                                         // isn't adjusted with
-                                                                         // thumb wheels or some
-                                                                         // other built-in
-                                                                         // mechanism."
-    "Titre",                                                             // 311="Heading"
-    "Stabilisation thermique",                                           // 312="Heat Soak"
-    "Chauffer à 170°C pour extruder",   // 313="Heat to 170°C to extrude"
-    "Température du plateau chauffant", // 314="Heatbed Temperature"
-    "Plateau chauffant",                // 315="Heated Bed"
-    "Chauffage...",                     // 316="Heating..."
-    "HelixScreen a planté",             // 317="HelixScreen Crashed"
-    "HelixScreen s'intégrera avec votre changeur de filament pour les opérations d'impression "
-    "multi-bobines/couleurs.",  // 318="HelixScreen will integrate with your filament changer for
-                                // multi-spool/color print operations."
-    "Plus élevé = plus rapide", // 319="Higher = faster"
-    "Origine",                  // 320="Home"
-    "Origine tout",             // 321="Home All"
-    "Origine X",                // 322="Home X"
-    "Origine Y",                // 323="Home Y"
-    "Origine Z",                // 324="Home Z"
-    "Progression horizontale (Assistant de mise à niveau)", // 325="Horizontal Progress (Leveling
-                                                            // Wizard)"
-    "Hôte",                                                 // 326="Host"
-    "Hotend",                                               // 327="Hotend"
-    "Ventilateur du hotend",                                // 328="Hotend Fan"
-    "Chauffage du hotend",                                  // 329="Hotend Heater"
-    "Fréquence de vérification des mises à jour de poids Spoolman", // 330="How often to check
-                                                                    // Spoolman for weight updates"
-    "Humidité",                                                     // 331="Humidity"
-    "Capteurs d'humidité",                                          // 332="Humidity Sensors"
-    "IP :",                                                         // 333="IP:"
-    "Inactif",                                                      // 334="Idle"
-    "Ignorer",                                                      // 335="Ignore"
-    "En cours",                                                     // 336="In Progress"
-    "Indexation du G-code...",                                      // 337="Indexing G-code..."
-    "Initialisation...",                                            // 338="Initializing..."
-    "Entrée",                                                       // 339="Input"
-    "Input Shaper",                                                 // 340="Input Shaper"
-    "Input Shaping",                                                // 341="Input Shaping"
-    "Capteurs de calibration Input Shaper", // 342="Input shaper calibration sensors"
-    "L'Input Shaping réduit les artefacts de vibration (ondulations) dans vos impressions.", // 343="Input
-                                                                                             // shaping
-                                                                                             // reduces
-                                                                                             // vibration
-                                                                                             // artifacts
-                                                                                             // (ringing)
-                                                                                             // in
-                                                                                             // your
-                                                                                             // prints."
-    "Installer le plugin HelixPrint", // 344="Install HelixPrint Plugin"
-    "Installer le plugin",            // 345="Install Plugin"
-    "Installez le plugin HelixPrint pour activer les modifications rapides de G-code. Exécutez "
-    "cette commande via SSH sur votre imprimante :", // 346="Install the HelixPrint plugin to enable
-                                                     // fast G-code modifications. Run this command
-                                                     // via SSH on your printer:"
-    "Installation échouée",                          // 347="Installation Failed"
-    "L'installation prend environ 30 secondes.",     // 348="Installation takes about 30 seconds."
-    "Installation...",                               // 349="Installing..."
-    "Intensité",                                     // 350="Intensity"
-    "G-code 3D interactif pendant les impressions",  // 351="Interactive 3D G-code during prints"
-    "Calibration interactive de la sonde",           // 352="Interactive probe calibration"
-    "Description du problème",                       // 353="Issue description"
-    "Italiano",                                      // 354="Italiano"
-    "À l'instant",                                   // 355="Just now"
-    "Kd :",                                          // 356="Kd:"
-    "Continuer l'impression",                        // 357="Keep Printing"
-    "Garder obligatoire",                            // 358="Keep Required"
-    "Test clavier (style Gboard)",                   // 359="Keyboard Test (Gboard-style)"
-    "Ki :",                                          // 360="Ki:"
-    "Klipper",                                       // 361="Klipper"
-    "Klipper est passé en état d'arrêt. Cela peut être dû à un arrêt d'urgence, un emballement "
-    "thermique ou une erreur de configuration.", // 362="Klipper has entered shutdown state. This
-                                                 // may be due to an emergency stop, thermal
-                                                 // runaway, or configuration error."
-    "Klipper redémarrera pour appliquer les modifications",  // 363="Klipper will restart to apply
-                                                             // changes"
-    "Klipper redémarrera pour appliquer les modifications.", // 364="Klipper will restart to apply
-                                                             // changes."
-    "Klipper redémarrera pour appliquer les nouvelles valeurs PID.", // 365="Klipper will restart to
-                                                                     // apply new PID values."
-    "Kp :",                                                          // 366="Kp:"
-    "Bandeau LED",                                                   // 367="LED Strip"
-    "LED allumée au démarrage",                                      // 368="LED on at Start"
-    "CHARGÉ",                                                        // 369="LOADED"
-    "Langue",                                                        // 370="Language"
-    "7 derniers jours",                                              // 371="Last 7 days"
-    "Dernière impression annulée",                                   // 372="Last print cancelled"
-    "Dernière impression échouée",                                   // 373="Last print failed"
-    "Plus tard",                                                     // 374="Later"
-    "Couche",                                                        // 375="Layer"
-    "Hauteur de couche",                                             // 376="Layer Height"
-    "Le mode couche capture une image par changement de couche. Idéal pour la plupart des "
-    "impressions.", // 377="Layer mode captures one frame per layer change. Best for most prints."
-    "Couche :",     // 378="Layer:"
-    "Couches",      // 379="Layers"
-    "Longueur :",   // 380="Length:"
-    "Clair",        // 381="Light"
-    "Charger",      // 382="Load"
-    "Charger le filament",                                   // 383="Load Filament"
-    "Chargé",                                                // 384="Loaded"
-    "Erreur de chargement",                                  // 385="Loading Error"
-    "Chargement du G-code...",                               // 386="Loading G-code..."
-    "Chargement du filament...",                             // 387="Loading filament..."
-    "Chargement de l'historique...",                         // 388="Loading history..."
-    "Chargement des bobines...",                             // 389="Loading spools..."
-    "Chargement...",                                         // 390="Loading..."
-    "Verrouillé pendant l'impression",                       // 391="Locked during print"
-    "M pour basculer",                                       // 392="M to toggle"
-    "MAC :",                                                 // 393="MAC:"
-    "Icônes MDI",                                            // 394="MDI Icons"
-    "CONFIGURÉ MANQUANT",                                    // 395="MISSING CONFIGURED"
-    "MOUVEMENT",                                             // 396="MOTION"
-    "Limites de la machine",                                 // 397="Machine Limits"
-    "Navigateur de macros",                                  // 398="Macro Browser"
-    "Boutons de macros",                                     // 399="Macro Buttons"
-    "Macro pour la calibration du maillage du plateau",      // 400="Macro for bed mesh calibration"
-    "Macro pour la stabilisation thermique chambre/plateau", // 401="Macro for chamber/bed heat
-                                                             // soak"
-    "Macro pour la mise à niveau physique du plateau (QGL/Z-Tilt)", // 402="Macro for physical bed
-                                                                    // leveling (QGL/Z-Tilt)"
-    "Macro pour annuler une impression active",        // 403="Macro to cancel an active print"
-    "Macro pour nettoyer/essuyer la buse",             // 404="Macro to clean/wipe the nozzle"
-    "Macro pour charger le filament dans l'extrudeur", // 405="Macro to load filament into extruder"
-    "Macro pour mettre en pause une impression active", // 406="Macro to pause an active print"
-    "Macro pour purger/amorcer la buse",                // 407="Macro to purge/prime the nozzle"
-    "Macro pour reprendre une impression en pause",     // 408="Macro to resume a paused print"
-    "Macro pour décharger le filament de l'extrudeur",  // 409="Macro to unload filament from
-                                                        // extruder"
-    "Macros",                                           // 410="Macros"
-    "Bandeau LED principal",                            // 411="Main LED Strip"
-    "Rendre optionnel",                                 // 412="Make Optional"
-    "Rendre le maillage du plateau et QGL ignorables",  // 413="Make bed mesh and QGL skippable"
-    "Gérer",                                            // 414="Manage"
-    "Mise à niveau manuelle du plateau",                // 415="Manual Bed Leveling"
-    "Matériau",                                         // 416="Material"
-    "Indicateur Material Design",                       // 417="Material Design Spinner"
-    "Accélération max",                                 // 418="Max Acceleration"
-    "Vitesse max",                                      // 419="Max Velocity"
-    "Accél. Z max",                                     // 420="Max Z Accel"
-    "Vitesse Z max",                                    // 421="Max Z Velocity"
-    "Vitesse max dans les virages (mm/s)",              // 422="Max speed through corners (mm/s)"
-    "Accélération maximale (mm/s²)",                    // 423="Maximum acceleration (mm/s²)"
-    "Vitesse maximale de la tête d'outil (mm/s)",       // 424="Maximum toolhead speed (mm/s)"
-    "Mesurer le bruit",                                 // 425="Measure Noise"
-    "Mémoire (Mo)",                                     // 426="Memory (MB)"
-    "Maillage du plateau terminé",                      // 427="Mesh Complete"
-    "Mode",                                             // 428="Mode"
-    "Modifié",                                          // 429="Modified"
-    "Mois",                                             // 430="Month"
-    "Moonraker",                                        // 431="Moonraker"
-    "Mouvement",                                        // 432="Motion"
-    "Mouvement : XYZ",                                  // 433="Motion: XYZ"
-    "Moteurs éteints",                                  // 434="Motors Off"
-    "Déplacer",                                         // 435="Move"
-    "Déplacez le papier d'avant en arrière pendant l'ajustement. Arrêtez quand le papier accroche "
-    "légèrement mais glisse encore.", // 436="Move paper back and forth while adjusting. Stop when
-                                      // paper catches slightly but still slides."
-    "Vitesse de déplacement",         // 437="Movement speed"
-    "Multi-filament",                 // 438="Multi-Filament"
-    "Multi-matériau",                 // 439="Multi-Material"
-    "Mon thème personnalisé",         // 440="My Custom Theme"
-    "Mon panneau",                    // 441="My Panel"
-    "Mon imprimante",                 // 442="My Printer"
-    "NOUVELLEMENT DÉCOUVERT",         // 443="NEWLY DISCOVERED"
-    "NOTIFICATIONS",                  // 444="NOTIFICATIONS"
-    "Nom",                            // 445="Name"
-    "Adresse réseau",                 // 446="Network Address"
-    "Nom du réseau",                  // 447="Network Name"
-    "Nom du réseau (SSID)",           // 448="Network Name (SSID)"
-    "Paramètres réseau",              // 449="Network Settings"
-    "Test réseau",                    // 450="Network Test"
-    "Jamais",                         // 451="Never"
-    "Nouvelles valeurs PID",          // 452="New PID Values"
-    "Nouveau Z-Offset : 0.000",       // 453="New Z-Offset: 0.000"
-    "Nouveau nom de profil",          // 454="New profile name"
-    "Suivant",                        // 455="Next"
-    "Aucun système AMS connecté.",    // 456="No AMS system connected."
-    "Pas d'historique",               // 457="No History"
-    "Aucune macro trouvée",           // 458="No Macros Found"
-    "Aucun appareil électrique",      // 459="No Power Devices"
-    "Aucune bobine",                  // 460="No Spools"
-    "Aucun fichier chargé",           // 461="No file loaded"
-    "Aucun fichier disponible pour l'impression",     // 462="No files available for printing"
-    "Aucun maillage de plateau chargé",               // 463="No mesh loaded"
-    "Aucun réseau trouvé",                            // 464="No networks found"
-    "Aucune notification",                            // 465="No notifications"
-    "Aucun plugin trouvé",                            // 466="No plugins found"
-    "Pas d'aperçu",                                   // 467="No preview"
-    "Pas encore d'historique d'impression",           // 468="No print history yet"
-    "Aucune macro de démarrage d'impression trouvée", // 469="No print start macro found"
-    "Aucun profil disponible",                        // 470="No profiles available"
-    "Aucun capteur détecté",                          // 471="No sensors detected"
-    "Aucune bobine disponible",                       // 472="No spools available"
-    "Pas maintenant",                                 // 473="Not Now"
-    "Non connecté",                                   // 474="Not connected"
-    "Notifications",                                  // 475="Notifications"
-    "Notifier à la fin de l'impression",              // 476="Notify when print finishes"
-    "Buse",                                           // 477="Nozzle"
-    "Amorçage de la buse",                            // 478="Nozzle Priming"
-    "Temp. buse",                                     // 479="Nozzle Temp"
-    "Température de la buse",                         // 480="Nozzle Temperature"
-    "Buse °C",                                        // 481="Nozzle °C"
-    "Buse :",                                         // 482="Nozzle:"
-    "OK",                                             // 483="OK"
-    "Éteint",                                         // 484="Off"
-    "Hors ligne",                                     // 485="Offline"
-    "Allumé",                                         // 486="On"
-    "Ouvrir",                                         // 487="Open"
-    "Opérations",                                     // 488="Operations"
-    "Optimisez votre impression",                     // 489="Optimize Your Printing"
-    "Ou entrer manuellement",                         // 490="Or Enter Manually"
-    "PETG",                                           // 491="PETG"
-    "Réglage PID",                                    // 492="PID Tuning"
-    "Le réglage PID optimise le contrôle de température pour un chauffage stable.", // 493="PID
-                                                                                    // tuning
-                                                                                    // optimizes
-                                                                                    // temperature
-                                                                                    // control for
-                                                                                    // stable
-                                                                                    // heating."
-    "PLA",                                                                          // 494="PLA"
-    "PLA - Noir",                            // 495="PLA - Black"
-    "ÉTAPES PRÉ-IMPRESSION",                 // 496="PRE-PRINT STEPS"
-    "IMPRIMANTE",                            // 497="PRINTER"
-    "Calibration par test papier",           // 498="Paper Test Calibration"
-    "Ventilateur de refroidissement pièce",  // 499="Part Cooling Fan"
-    "Ventilateur pièce",                     // 500="Part Fan"
-    "Mot de passe",                          // 501="Password"
-    "Le mot de passe ne peut pas être vide", // 502="Password cannot be empty"
-    "Pause",                                 // 503="Pause"
-    "En pause",                              // 504="Paused"
-    "En pause (attention requise)",          // 505="Paused (attention needed)"
-    "Pic :",                                 // 506="Peak:"
-    "Suivi de phase",                        // 507="Phase Tracking"
-    "Choisir la couleur",                    // 508="Pick Color"
-    "Placez les plugins dans le répertoire plugins pour étendre HelixScreen", // 509="Place plugins
-                                                                              // in the plugins
-                                                                              // directory to extend
-                                                                              // HelixScreen"
-    "Veuillez entrer un nom de thème", // 510="Please enter a theme name"
-    "Veuillez patienter pendant que l'imprimante fait l'origine et palpe.", // 511="Please wait
-                                                                            // while the printer
-                                                                            // homes and probes."
-    "Veuillez patienter pendant que l'imprimante palpe chaque position de vis.", // 512="Please wait
-                                                                                 // while the
-                                                                                 // printer probes
-                                                                                 // each screw
-                                                                                 // position."
-    "Plugin installé avec succès.", // 513="Plugin installed successfully."
-    "Plugins",                      // 514="Plugins"
-    "Les plugins sont découverts au démarrage de l'application", // 515="Plugins are discovered on
-                                                                 // application startup"
-    "Polymaker",                                                 // 516="Polymaker"
-    "Port",                                                      // 517="Port"
-    "Português",                                                 // 518="Português"
-    "Position",                                                  // 519="Position"
-    "Alimentation",                                              // 520="Power"
-    "Contrôle d'alimentation",                                   // 521="Power Control"
-    "Préchauffer",                                               // 522="Preheat"
-    "Préparation de l'impression",                               // 523="Preparing Print"
-    "Préparation...",                                            // 524="Preparing..."
-    "Préréglages",                                               // 525="Presets"
-    "Précédent",                                                 // 526="Previous"
-    "Principal",                                                 // 527="Primary"
-    "Imprimer",                                                  // 528="Print"
-    "Impression annulée",                                        // 529="Print Cancelled"
-    "Impression terminée",                                       // 530="Print Complete"
-    "Impression terminée !",                                     // 531="Print Complete!"
-    "Alerte de fin d'impression",                                // 532="Print Completion Alert"
-    "Détails de l'impression",                                   // 533="Print Details"
-    "Fichier d'impression",                                      // 534="Print File"
-    "Fichiers d'impression",                                     // 535="Print Files"
-    "Historique d'impression",                                   // 536="Print History"
-    "Heures d'impression",                                       // 537="Print Hours"
-    "Vitesse d'impression",                                      // 538="Print Speed"
-    "État de l'impression",                                      // 539="Print Status"
-    "Temps d'impression",                                        // 540="Print Time"
-    "Réglage de l'impression",                                   // 541="Print Tuning"
-    "Imprimante",                                                // 542="Printer"
-    "Nom de l'imprimante",                                       // 543="Printer Name"
-    "Arrêt de l'imprimante",                                     // 544="Printer Shutdown"
-    "Type d'imprimante",                                         // 545="Printer Type"
-    "Impression",                                                // 546="Printing"
-    "Tendance des impressions",                                  // 547="Prints Trend"
-    "Privé :",                                                   // 548="Private:"
-    "Sonde",                                                     // 549="Probe"
-    "Capteur de sonde",                                          // 550="Probe Sensor"
-    "Capteurs de sonde",                                         // 551="Probe Sensors"
-    "Palpage du maillage du plateau",                            // 552="Probing Bed Mesh"
-    "Palpage des vis du plateau...",                             // 553="Probing Bed Screws..."
-    "Palpage du plateau...",                                     // 554="Probing Bed..."
-    "Palpage échoué",                                            // 555="Probing Failed"
-    "Traitement...",                                             // 556="Processing..."
-    "Profil",                                                    // 557="Profile"
-    "Nom du profil (ex : default)",                  // 558="Profile name (e.g., default)"
-    "Profils",                                       // 559="Profiles"
-    "Progression",                                   // 560="Progress"
-    "Tests de barre de progression",                 // 561="Progress Bar Tests"
-    "Purger",                                        // 562="Purge"
-    "Purger 50mm",                                   // 563="Purge 50mm"
-    "BOUTONS RAPIDES",                               // 564="QUICK BUTTONS"
-    "Quad Gantry Level",                             // 565="Quad Gantry Level"
-    "Actions rapides",                               // 566="Quick Actions"
-    "Bouton rapide 1",                               // 567="Quick Button 1"
-    "Bouton rapide 2",                               // 568="Quick Button 2"
-    "Actions rapides, calibration, vitesse",         // 569="Quick actions, calibration, speed"
-    "RSS :",                                         // 570="RSS:"
-    "Re-palper",                                     // 571="Re-probe"
-    "Prêt",                                          // 572="Ready"
-    "Recommandé",                                    // 573="Recommended"
-    "Recommandé : 200°C pour l'extrudeur",           // 574="Recommended: 200°C for extruder"
-    "Enregistrer le timelapse",                      // 575="Record Timelapse"
-    "Enregistrer des timelapses de vos impressions", // 576="Record timelapses of your prints"
-    "Mode d'enregistrement",                         // 577="Recording Mode"
-    "Récupérer",                                     // 578="Recover"
-    "Réduire les ondulations",                       // 579="Reduce Ringing"
-    "Actualiser",                                    // 580="Refresh"
-    "Intervalle de rafraîchissement",                // 581="Refresh Interval"
-    "Restant",                                       // 582="Remaining"
-    "Supprimer le plugin de l'imprimante",           // 583="Remove plugin from printer"
-    "Renommer",                                      // 584="Rename"
-    "Renommer le profil de maillage du plateau",     // 585="Rename Mesh Profile"
-    "Réimprimer",                                    // 586="Reprint"
-    "Demander confirmation avant l'arrêt d'urgence", // 587="Require confirmation before emergency
-                                                     // stop"
-    "Nécessite le plugin Moonraker-Timelapse",       // 588="Requires Moonraker-Timelapse plugin"
-    "Réinitialiser",                                 // 589="Reset"
-    "Réinitialiser vitesse & débit à 100%",          // 590="Reset Speed & Flow to 100%"
-    "Réinitialiser vitesse &amp; débit à 100%",      // 591="Reset Speed &amp; Flow to 100%"
-    "Réinitialiser tous les paramètres et redémarrer l'assistant", // 592="Reset all settings and
-                                                                   // restart wizard"
-    "Réinitialisation...",                                         // 593="Resetting..."
-    "Réglage de la compensation de résonance", // 594="Resonance compensation tuning"
-    "Redémarrer HelixScreen",                  // 595="Restart HelixScreen"
-    "Redémarrer Klipper",                      // 596="Restart Klipper"
-    "Redémarrer maintenant",                   // 597="Restart Now"
-    "Redémarrage requis",                      // 598="Restart Required"
-    "Redémarrer l'application d'affichage",    // 599="Restart the display application"
-    "Reprendre",                               // 600="Resume"
-    "Reprendre l'impression",                  // 601="Resume Print"
-    "Rétracter",                               // 602="Retract"
-    "Longueur de rétraction",                  // 603="Retract Length"
-    "Vitesse de rétraction",                   // 604="Retract Speed"
-    "Paramètres de rétraction",                // 605="Retraction Settings"
-    "Réessayer",                               // 606="Retry"
-    "Examiner les problèmes de validation matérielle détectés", // 607="Review detected hardware
-                                                                // validation issues"
-    "Examiner vos modifications",                               // 608="Review your changes"
-    "Rôle :",                                                   // 609="Role:"
-    "Capteur de fin de filament",                               // 610="Runout Sensor"
-    "MACROS STANDARD",                                          // 611="STANDARD MACROS"
-    "ARRÊT",                                                    // 612="STOP"
-    "PROPRIÉTÉS DE STYLE",                                      // 613="STYLE PROPERTIES"
-    "SYSTÈME",                                                  // 614="SYSTEM"
-    "Enregistrer",                                              // 615="Save"
-    "Enregistrer & Redémarrer",                                 // 616="Save & Restart"
-    "Enregistrer &amp; Redémarrer",                             // 617="Save &amp; Restart"
-    "Enregistrer comme nouveau",                                // 618="Save As New"
-    "Enregistrer la config",                                    // 619="Save Config"
-    "Enregistrer la configuration de l'imprimante",             // 620="Save Printer Configuration"
-    "Enregistrer le thème sous",                                // 621="Save Theme As"
-    "Enregistrer le Z-Offset",                                  // 622="Save Z-Offset"
-    "Enregistrer le Z-Offset ?",                                // 623="Save Z-Offset?"
-    "Enregistrer les modifications pour les conserver après redémarrage ?", // 624="Save changes to
-                                                                            // persist them across
-                                                                            // restarts?"
-    "Enregistrement de la configuration...", // 625="Saving Configuration..."
-    "L'enregistrement redémarrera Klipper et ANNULERA toute impression active !", // 626="Saving
-                                                                                  // will restart
-                                                                                  // Klipper and
-                                                                                  // CANCEL any
-                                                                                  // active print!"
-    "Recherche de réseaux...",                          // 627="Scanning for networks..."
-    "Atténuation de l'écran",                           // 628="Screen Dim"
-    "L'écran s'atténue après une période d'inactivité", // 629="Screen dims to lower brightness
-                                                        // after period of inactivity"
-    "L'écran s'atténuera après la période d'inactivité sélectionnée", // 630="Screen will dim after
-                                                                      // the selected period of
-                                                                      // inactivity"
-    "Vitesse de défilement",                                          // 631="Scroll Speed"
-    "Rechercher un fichier...",                                       // 632="Search filename..."
-    "Secondaire",                                                     // 633="Secondary"
-    "Sécurité",                                                       // 634="Security"
-    "Sélectionner",                                                   // 635="Select"
-    "Sélectionnez 'Aucun' si vous n'avez pas de capteur de filament, ou si vous ne voulez pas "
-    "mettre en pause en fin de filament.", // 636="Select 'None' if you don't have a filament
-                                           // sensor, or if you don't want to pause on runout."
-    "Sélectionnez 'Aucun' si vous avez une sonde dédiée, ou si vous n'utilisez pas le maillage du "
-    "plateau.", // 637="Select 'None' if you have a dedicated probe, or don't use bed mesh
-                // leveling."
-    "Sélectionner le filament",                         // 638="Select Filament"
-    "Sélectionner un fichier",                          // 639="Select File"
-    "Sélectionner un fichier G-Code",                   // 640="Select G-Code File"
-    "Sélectionner le chauffage",                        // 641="Select Heater"
-    "Sélectionner la macro pour le premier bouton",     // 642="Select macro for first button"
-    "Sélectionner la macro pour le deuxième bouton",    // 643="Select macro for second button"
-    "Sélection du slot...",                             // 644="Selecting slot..."
-    "Tests de paramètres de taille sémantique",         // 645="Semantic Size Parameter Tests"
-    "Envoyer des commandes directement à l'imprimante", // 646="Send commands directly to printer"
-    "Capteurs",                                         // 647="Sensors"
-    "Définir ",                                         // 648="Set "
-    "Paramètres",                                       // 649="Settings"
-    "Intensité de l'ombre",                             // 650="Shadow Intensity"
-    "Shaper",                                           // 651="Shaper"
-    "Brillance :",                                      // 652="Shininess:"
-    "Afficher l'état détaillé de la préparation d'impression", // 653="Show detailed print
-                                                               // preparation status"
-    "Côté",                                                    // 654="Side"
-    "Taille",                                                  // 655="Size"
-    "Passer pour l'instant",                                   // 656="Skip for now"
-    "Slot 1",                                                  // 657="Slot 1"
-    "Les petites étiquettes aident à garder les contrôles calmes et concentrés.", // 658="Small
-                                                                                  // labels help
-                                                                                  // keep controls
-                                                                                  // calm and
-                                                                                  // focused."
-    "Certains paramètres prendront effet après redémarrage.", // 659="Some settings will take effect
-                                                              // after restart."
-    "Sons",                                                   // 660="Sounds"
-    "Spéculaire :",                                           // 661="Specular:"
-    "Vitesse",                                                // 662="Speed"
-    "Paramètres de vitesse",                                  // 663="Speed Settings"
-    "Vitesse du mouvement d'amorçage",                        // 664="Speed of prime movement"
-    "Vitesse du mouvement de rétraction",                     // 665="Speed of retraction movement"
-    "Vitesse :",                                              // 666="Speed:"
-    "Visualisation de bobine (Canvas pseudo-3D)", // 667="Spool Visualization (Pseudo-3D Canvas)"
-    "Spoolman",                                   // 668="Spoolman"
-    "Spoolman n'a aucune bobine configurée",      // 669="Spoolman has no spools configured"
-    "Vitesse dans les angles",                    // 670="Square Corner Velocity"
-    "Veille",                                     // 671="Standby"
-    "Démarrer la calibration",                    // 672="Start Calibration"
-    "Démarrer le palpage",                        // 673="Start Probing"
-    "Démarré",                                    // 674="Started"
-    "État",                                       // 675="Status"
-    "Icônes d'état",                              // 676="Status icons"
-    "Étape",                                      // 677="Step"
-    "Test du widget de progression par étapes",   // 678="Step Progress Widget Test"
-    "Arrêter",                                    // 679="Stop"
-    "Arrêter le séchage",                         // 680="Stop Drying"
-    "Arrêter l'impression ?",                     // 681="Stop Print?"
-    "Arrête tout mouvement. Nécessite un redémarrage du firmware.", // 682="Stops all motion.
-                                                                    // Requires firmware restart."
-    "Styled (value=75)",                                            // 683="Styled (value=75)"
-    "Taux de réussite",                                             // 684="Success Rate"
-    "Succès !",                                                     // 685="Success!"
-    "Les surfaces héritent des jetons d'arrière-plan de l'application pour les modes clair et "
-    "sombre.",            // 686="Surfaces inherit app background tokens for light and dark modes."
-    "Capteurs à contact", // 687="Switch Sensors"
-    "Basculer entre les thèmes clair et sombre", // 688="Switch between light and dark themes"
-    "Synchroniser vers Spoolman",                // 689="Sync to Spoolman"
-    "Synchroniser avec Spoolman",                // 690="Sync with Spoolman"
-    "Sysfs",                                     // 691="Sysfs"
-    "Système détecté",                           // 692="System detected"
-    "Détection de couleur de filament TD-1",     // 693="TD-1 filament color detection"
-    "COULEURS DU THÈME",                         // 694="THEME COLORS"
-    "TPU",                                       // 695="TPU"
-    "Appuyez pour afficher le clavier...",       // 696="Tap to show keyboard..."
-    "Cible",                                     // 697="Target"
-    "Température cible",                         // 698="Target Temperature"
-    "Température",                               // 699="Temperature"
-    "Températures",                              // 700="Temperatures"
-    "Ajustement temporaire pour cette impression, sauf si enregistré dans le panneau Contrôles", // 701="Temporary adjustment for this print, unless saved on Controls panel"
-    "Tertiaire",           // 702="Tertiary"
-    "Tester la connexion", // 703="Test Connection"
-    "Tester le réseau",    // 704="Test Network"
-    "Impression test",     // 705="Test Print"
-    "Le plugin HelixPrint permet des modifications rapides du G-code directement sur votre "
-    "imprimante—comme ignorer le maillage du plateau pour des réimpressions rapides.", // 706="The
-                                                                                       // HelixPrint
-                                                                                       // plugin
-                                                                                       // enables
-                                                                                       // fast
-                                                                                       // G-code
-                                                                                       // modifications
-                                                                                       // directly
-                                                                                       // on your
-                                                                                       // printer—like
-                                                                                       // skipping
-                                                                                       // bed mesh
-                                                                                       // for quick
-                                                                                       // reprints."
-    "Le chauffage s'allumera et s'éteindra plusieurs fois.", // 707="The heater will cycle on and
-                                                             // off several times."
-    "Thème",                                                 // 708="Theme"
-    "Couleurs du thème",                                     // 709="Theme Colors"
-    "Préréglage du thème",                                   // 710="Theme Preset"
-    "Les modifications du thème s'appliquent après redémarrage.", // 711="Theme changes apply after
-                                                                  // restart."
-    "Les modifications du thème prendront effet après redémarrage.", // 712="Theme changes will take
-                                                                     // effect after restart."
-    "Thème, luminosité et paramètres de veille", // 713="Theme, brightness, and sleep settings"
-    "Thin bar (height=8)",                       // 714="Thin bar (height=8)"
-    "Cette calibration utilise la méthode de friction du papier pour définir votre Z-offset.", // 715="This
-                                                                                               // calibration
-                                                                                               // uses
-                                                                                               // the
-                                                                                               // paper
-                                                                                               // friction
-                                                                                               // method
-                                                                                               // to
-                                                                                               // set
-                                                                                               // your
-                                                                                               // Z-offset."
-    "Cela peut prendre 1-2 minutes",         // 716="This may take 1-2 minutes"
-    "Cela peut prendre jusqu'à 30 secondes", // 717="This may take up to 30 seconds"
-    "Ce plugin permet à HelixScreen de contrôler les options de démarrage d'impression comme le "
-    "maillage du plateau et QGL. Une fois installé, utilisez Configurer PRINT_START ci-dessous "
-    "pour activer les étapes optionnelles.", // 718="This plugin lets HelixScreen control print
-                                             // start options like bed mesh and QGL. Once installed,
-                                             // use Configure PRINT_START below to enable optional
-                                             // steps."
-    "Ce processus prend 3-5 minutes. Ne pas interrompre.", // 719="This process takes 3-5 minutes.
-                                                           // Do not interrupt."
-    "Cet outil palpe chaque vis du plateau et vous indique combien ajuster.", // 720="This tool
-                                                                              // probes each bed
-                                                                              // screw and tells you
-                                                                              // how much to
-                                                                              // adjust."
-    "Cela arrêtera immédiatement toutes les opérations de l'imprimante. L'imprimante nécessitera "
-    "un redémarrage pour reprendre.", // 721="This will immediately halt all printer operations. The
-                                      // printer will require a restart to resume."
-    "Cela réinitialisera tous les paramètres par défaut. Cette action ne peut pas être annulée.", // 722="This will reset all settings to defaults. This action cannot be undone."
-    "Cela redémarrera Klipper.",                       // 723="This will restart Klipper."
-    "Temps",                                           // 724="Time"
-    "Format de l'heure",                               // 725="Time Format"
-    "Timelapse",                                       // 726="Timelapse"
-    "Timelapse disponible",                            // 727="Timelapse Available"
-    "Paramètres du timelapse",                         // 728="Timelapse Settings"
-    "Conseil :",                                       // 729="Tip:"
-    "Basculer la fonctionnalité",                      // 730="Toggle Feature"
-    "Outil",                                           // 731="Tool"
-    "Changeur d'outils",                               // 732="Tool Changer"
-    "Haut",                                            // 733="Top"
-    "Total des impressions",                           // 734="Total Prints"
-    "Calibration tactile",                             // 735="Touch Calibration"
-    "Touchez n'importe où pour tester la calibration", // 736="Touch anywhere to test calibration"
-    "Touchez l'écran pour sortir de veille",           // 737="Touch screen to wake from sleep"
-    "Déplacements",                                    // 738="Travels"
-    "Dépannage :",                                     // 739="Troubleshooting:"
-    "Régler",                                          // 740="Tune"
-    "Régler les paramètres PID du chauffage",          // 741="Tune heater PID parameters"
-    "Allumer la LED au démarrage de l'imprimante",     // 742="Turn on LED when printer starts"
-    "Type",                                            // 743="Type"
-    "Tapez pour prévisualiser le champ de saisie...",  // 744="Type to preview input field..."
-    "USB",                                             // 745="USB"
-    "Désinstaller le plugin HelixPrint",               // 746="Uninstall HelixPrint Plugin"
-    "Inconnu",                                         // 747="Unknown"
-    "Bobine inconnue",                                 // 748="Unknown Spool"
-    "Étape inconnue",                                  // 749="Unknown Step"
-    "Décharger",                                       // 750="Unload"
-    "Décharger le filament",                           // 751="Unload Filament"
-    "Déchargement du filament...",                     // 752="Unloading filament..."
-    "Extra de dérétraction",                           // 753="Unretract Extra"
-    "Vitesse de dérétraction",                         // 754="Unretract Speed"
-    "Téléversez des fichiers gcode pour commencer",    // 755="Upload gcode files to get started"
-    "Utiliser la rétraction firmware G10/G11",         // 756="Use G10/G11 firmware retraction"
-    "ValgACE (ACE Pro)",                               // 757="ValgACE (ACE Pro)"
-    "Les valeurs ont été enregistrées dans la configuration de l'imprimante.", // 758="Values have
-                                                                               // been saved to
-                                                                               // printer
-                                                                               // configuration."
-    "Limites de vitesse et d'accélération",            // 759="Velocity and acceleration limits"
-    "Fabricant",                                       // 760="Vendor"
-    "Version",                                         // 761="Version"
-    "Progression verticale (Assistant de rétraction)", // 762="Vertical Progress (Retract Wizard)"
-    "Vibration",                                       // 763="Vibration"
-    "Vitesse de lecture vidéo",                        // 764="Video playback speed"
-    "Voir l'historique complet",                       // 765="View Full History"
-    "Voir les préréglages",                            // 766="View Presets"
-    "Voir le timelapse",                               // 767="View Timelapse"
-    "Voir les plugins installés et leur état",         // 768="View installed plugins and status"
-    "Voir les statistiques d'impression et l'historique des travaux", // 769="View print statistics
-                                                                      // and job history"
-    "Avertissement",                                                  // 770="Warning"
-    "Semaine",                                                        // 771="Week"
-    "Les données de poids sont synchronisées depuis Spoolman pour afficher le filament restant. "
-    "Les modifications sont également synchronisées au démarrage, à la pause ou à la fin des "
-    "impressions.", // 772="Weight data is synced from Spoolman to display remaining filament.
-                    // Changes are also synced when prints start, pause, or complete."
-    "Paramètres de synchronisation du poids",     // 773="Weight sync settings"
-    "Blanc",                                      // 774="White"
-    "WiFi",                                       // 775="WiFi"
-    "Réseau WiFi",                                // 776="WiFi Network"
-    "WiFi et Ethernet",                           // 777="WiFi and Ethernet"
-    "Configuration WiFi et Ethernet",             // 778="WiFi and Ethernet configuration"
-    "Contrôle WiFi indisponible",                 // 779="WiFi control unavailable"
-    "Matériel WiFi indisponible",                 // 780="WiFi hardware unavailable"
-    "Largeur",                                    // 781="Width"
-    "Capteurs de largeur",                        // 782="Width Sensors"
-    "X :",                                        // 783="X:"
-    "XY",                                         // 784="XY"
-    "Y :",                                        // 785="Y:"
-    "Année",                                      // 786="Year"
-    "Vos impressions terminées apparaîtront ici", // 787="Your completed prints will appear here"
-    "Z",                                          // 788="Z"
-    "Calibration Z",                              // 789="Z Calibration"
-    "Plage Z",                                    // 790="Z Range"
-    "Sondes Z pour la mise à niveau du plateau et la génération de maillage", // 791="Z probes for
-                                                                              // bed leveling and
-                                                                              // mesh generation"
-    "Z-Offset",                                                               // 792="Z-Offset"
-    "Calibration du Z-Offset",              // 793="Z-Offset Calibration"
-    "Z-Offset :",                           // 794="Z-Offset:"
-    "Ajustement Z-Tilt",                    // 795="Z-Tilt Adjust"
-    "Z :",                                  // 796="Z:"
-    "Z : 0.000",                            // 797="Z: 0.000"
-    "Zoom",                                 // 798="Zoom"
-    "^ AVANT",                              // 799="^ FRONT"
-    "heure",                                // 800="hour"
-    "heures",                               // 801="hours"
-    "lg",                                   // 802="lg"
-    "md",                                   // 803="md"
-    "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-    "minute",                               // 805="minute"
-    "minutes",                              // 806="minutes"
-    "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-    "secondes",                             // 808="seconds"
-    "size=\"large\"",                       // 809="size="large""
-    "size=\"medium\"",                      // 810="size="medium""
-    "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-    "size=\"small\"",                       // 812="size="small""
-    "size=\"tiny\"",                        // 813="size="tiny""
-    "sm",                                   // 814="sm"
-    "true",                                 // 815="true"
-    "value=0 (shows FULL - BUG!)",          // 816="value=0 (shows FULL - BUG!)"
-    "value=1 (tiny sliver?)",               // 817="value=1 (tiny sliver?)"
-    "value=100 (should be full)",           // 818="value=100 (should be full)"
-    "xs",                                   // 819="xs"
-    "Русский",                              // 820="Русский"
-    "—",                                    // 821="—"
-    "•",                                    // 822="•"
-    "中文",                                 // 823="中文"
-    "日本語",                               // 824="日本語"
-    "󰅐",                                 // 825="󰅐"
-    "󰉋",                                 // 826="󰉋"
-    "󱧰",                                 // 827="󱧰"
-};
-
-static const char* it_singulars[] =
-    {
-        " / ",                                             // 0=" / "
-        " 0 / 0",                                          // 1=" 0 / 0"
-        "#808080",                                         // 2="#808080"
-        "#RRGGBB",                                         // 3="#RRGGBB"
-        "(0)",                                             // 4="(0)"
-        "(2.4GHz)",                                        // 5="(2.4GHz)"
-        "+",                                               // 6="+"
-        "+0",                                              // 7="+0"
-        "+0.01mm",                                         // 8="+0.01mm"
-        "+0.05mm",                                         // 9="+0.05mm"
-        "+0.1mm",                                          // 10="+0.1mm"
-        "+1mm",                                            // 11="+1mm"
-        "-",                                               // 12="-"
-        "- Controllare [resonance_tester] in printer.cfg", // 13="- Check [resonance_tester] in
-                                                           // printer.cfg"
-        "- Assicurarsi che ADXL345 sia collegato",         // 14="- Ensure ADXL345 is connected"
-        "- Provare prima Misura rumore",                   // 15="- Try Measure Noise first"
-        "--",                                              // 16="--"
-        "---",                                             // 17="---"
-        "-0.01mm",                                         // 18="-0.01mm"
-        "-0.05mm",                                         // 19="-0.05mm"
-        "-0.1mm",                                          // 20="-0.1mm"
-        "-1mm",                                            // 21="-1mm"
-        "/",                                               // 22="/"
-        "0,4-2mm direct drive, 4-6mm bowden",             // 23="0.4-2mm direct drive, 4-6mm bowden"
-        "1. La stampante esegue homing e sonda il piano", // 24="1. Printer homes and probes the
-                                                          // bed"
-        "1. La stampante eseguirà homing e sonderà ogni vite", // 25="1. Printer will home and probe
-                                                               // each screw"
-        "10mm",                                                // 26="10mm"
-        "1mm",                                                 // 27="1mm"
-        "2. Posizionare carta tra ugello e piano", // 28="2. Place paper between nozzle and bed"
-        "2. I risultati mostrano quanto girare ogni vite",   // 29="2. Results show how much to turn
-                                                             // each screw"
-        "200-230°C",                                         // 30="200-230°C"
-        "210°C / 60°C",                                      // 31="210°C / 60°C"
-        "230°C / 50°C",                                      // 32="230°C / 50°C"
-        "240°C / 80°C",                                      // 33="240°C / 80°C"
-        "250°C / 100°C",                                     // 34="250°C / 100°C"
-        "25mm",                                              // 35="25mm"
-        "3. Regolare le viti, poi risondare per verificare", // 36="3. Adjust screws, then re-probe
-                                                             // to verify"
-        "3. Abbassare l'ugello fino a quando la carta striscia leggermente", // 37="3. Lower nozzle
-                                                                             // until paper drags
-                                                                             // slightly"
-        "Anteprima 3D",                                                      // 38="3D Preview"
-        "4. La carta dovrebbe muoversi ma con resistenza", // 39="4. Paper should move but with
-                                                           // resistance"
-        "4. Ripetere fino a quando il piano è livellato",  // 40="4. Repeat until bed is level"
-        "5mm",                                             // 41="5mm"
-        "60°C",                                            // 42="60°C"
-        "6mm",                                             // 43="6mm"
-        "850g",                                            // 44="850g"
-        "= Allentare",                                     // 45="= Loosen"
-        "= Stringere",                                     // 46="= Tighten"
-        "?",                                               // 47="?"
-        "INFORMAZIONI",                                    // 48="ABOUT"
-        "ABS",                                             // 49="ABS"
-        "Impostazioni AMS",                                // 50="AMS Settings"
-        "ASPETTO",                                         // 51="APPEARANCE"
-        "AUTOMAZIONE",                                     // 52="AUTOMATION"
-        "Interrompi",                                      // 53="Abort"
-        "Informazioni",                                    // 54="About"
-        "Accel. a Decel.",                                 // 55="Accel to Decel"
-        "Limite accelerazione a decelerazione (mm/s²)",    // 56="Acceleration to deceleration limit
-                                                           // (mm/s²)"
-        "Accelerometri",                                   // 57="Accelerometers"
-        "Accetta",                                         // 58="Accept"
-        "Azione richiesta",                                // 59="Action Required"
-        "Azioni",                                          // 60="Actions"
-        "Attivo",                                          // 61="Active"
-        "Effettivo",                                       // 62="Actual"
-        "Aggiungi rete nascosta",                          // 63="Add Hidden Network"
-        "Regola il livello di luminosità dello schermo",   // 64="Adjust screen brightness level"
-        "Regolare le viti, poi risondare.",                // 65="Adjust screws, then re-probe."
-        "Le regolazioni restano attive fino al riavvio. Salvare dopo il completamento della "
-        "stampa.", // 66="Adjustments stay active until restart. Save after print completes."
-        "Impostazione avanzata",                   // 67="Advanced Setting"
-        "Tutto",                                   // 68="All"
-        "Tutte le viti sono entro la tolleranza.", // 69="All screws are within tolerance."
-        "Allwinner",                               // 70="Allwinner"
-        "Quantità:",                               // 71="Amount:"
-        "È stato rilevato un accelerometro sulla stampante.", // 72="An accelerometer was detected
-                                                              // on your printer."
-        "Si è verificato un errore durante la calibrazione.", // 73="An error occurred during
-                                                              // calibration."
-        "Si è verificato un errore durante il sondaggio.", // 74="An error occurred during probing."
-        "Si è verificato un errore durante il caricamento del filamento.", // 75="An error occurred
-                                                                           // while loading
-                                                                           // filament."
-        "Animazioni",                                                      // 76="Animations"
-        "Sfondo applicazione",                                             // 77="App Background"
-        "Applica",                                                         // 78="Apply"
-        "Applica modifiche",                                               // 79="Apply Changes"
-        "Applica salvataggio solo per questa sessione", // 80="Apply saves for this session only"
-        "Applicazione in corso...",                     // 81="Applying..."
-        "Sei sicuro di voler annullare questa stampa? Tutto il progresso verrà perso.", // 82="Are
-                                                                                        // you sure
-                                                                                        // you want
-                                                                                        // to cancel
-                                                                                        // this
-                                                                                        // print?
-                                                                                        // All
-                                                                                        // progress
-                                                                                        // will be
-                                                                                        // lost."
-        "Assegna bobina",                                             // 83="Assign Spool"
-        "Assegna un ruolo per abilitare il monitoraggio del sensore", // 84="Assign a role to enable
-                                                                      // sensor monitoring"
-        "Assegnazione allo Slot 1",                                   // 85="Assigning to Slot 1"
-        "Auto",                                                       // 86="Auto"
-        "Mesh piano automatica",                                      // 87="Auto Bed Mesh"
-        "Riscaldamento automatico al caricamento",                    // 88="Auto-Heat on Load"
-        "Sondaggio automatico o controllo manuale dell'altezza delle viti", // 89="Auto-probe or
-                                                                            // manually check screw
-                                                                            // heights"
-        "Rendering video automatico",  // 90="Auto-render video"
-        "Calibrazione PID automatica", // 91="Automatic PID Calibration"
-        "Interroga automaticamente Spoolman per aggiornamenti peso", // 92="Automatically poll
-                                                                     // Spoolman for weight updates"
-        "Reti disponibili",                                          // 93="Available Networks"
-        "Reti disponibili",                                          // 94="Available networks"
-        "Indietro",                                                  // 95="Back"
-        "Backup",                                                    // 96="Backup"
-        "Piano",                                                     // 97="Bed"
-        "Riscaldatore piano",                                        // 98="Bed Heater"
-        "Livellamento piano",                                        // 99="Bed Level"
-        "Livellamento piano",                                        // 100="Bed Leveling"
-        "Mesh piano",                                                // 101="Bed Mesh"
-        "Rendering mesh piano",                                      // 102="Bed Mesh Render"
-        "Regolazione viti piano",                                    // 103="Bed Screw Adjustment"
-        "Viti piano",                                                // 104="Bed Screws"
-        "Piano livellato!",                                          // 105="Bed is Level!"
-        "Piano °C",                                                  // 106="Bed °C"
-        "Piano:",                                                    // 107="Bed:"
-        "Nero",                                                      // 108="Black"
-        "Bluetooth",                                                 // 109="Bluetooth"
-        "Il testo corpo supporta guide più lunghe restando leggibile.", // 110="Body text supports
-                                                                        // longer guidance while
-                                                                        // staying readable."
-        "Opacità bordo",                                                // 111="Border Opacity"
-        "Raggio bordo",                                                 // 112="Border Radius"
-        "Larghezza bordo",                                              // 113="Border Width"
-        "Trasparenza bordo (0 = invisibile, 255 = solido)", // 114="Border transparency (0 =
-                                                            // invisible, 255 = solid)"
-        "Luminosità",                                       // 115="Brightness"
-        "Sfoglia",                                          // 116="Browse"
-        "Occupato",                                         // 117="Busy"
-        "Bypass",                                           // 118="Bypass"
-        "Modalità bypass",                                  // 119="Bypass Mode"
-        "CALIBRAZIONE",                                     // 120="CALIBRATION"
-        "MODIFICATO DALLA SESSIONE PRECEDENTE",             // 121="CHANGED FROM LAST SESSION"
-        "COLORI RICHIESTI",                                 // 122="COLORS REQUIRED"
-        "CRITICO",                                          // 123="CRITICAL"
-        "Calibra",                                          // 124="Calibrate"
-        "Calibra X",                                        // 125="Calibrate X"
-        "Calibra Y",                                        // 126="Calibrate Y"
-        "Calibra compensazione risonanza",            // 127="Calibrate resonance compensation"
-        "Calibrazione in corso...",                   // 128="Calibrating..."
-        "Calibrazione",                               // 129="Calibration"
-        "Calibrazione e strumenti",                   // 130="Calibration & Tools"
-        "Calibrazione e strumenti",                   // 131="Calibration &amp; Tools"
-        "Calibrazione completata!",                   // 132="Calibration Complete!"
-        "Calibrazione fallita",                       // 133="Calibration Failed"
-        "Annulla",                                    // 134="Cancel"
-        "Annulla stampa",                             // 135="Cancel Print"
-        "Annullato",                                  // 136="Cancelled"
-        "Camera",                                     // 137="Chamber"
-        "Ventola camera",                             // 138="Chamber Fan"
-        "Monitoraggio umidità camera ed essiccatore", // 139="Chamber and dryer humidity monitoring"
-        "Camera:",                                    // 140="Chamber:"
-        "Le modifiche si applicano immediatamente. Regolare durante la stampa per la messa a "
-        "punto.", // 141="Changes apply immediately. Adjust during print for tuning."
-        "Le modifiche sono temporanee e si resettano al riavvio della stampante", // 142="Changes
-                                                                                  // are temporary
-                                                                                  // and reset on
-                                                                                  // printer reboot"
-        "Controllare il percorso del filamento e riprovare.", // 143="Check the filament path and
-                                                              // try again."
-        "Controllo slot...",                                  // 144="Checking slots..."
-        "Scegli formato orario 12 ore o 24 ore", // 145="Choose 12-hour or 24-hour time display"
-        "Scegli lingua di visualizzazione",      // 146="Choose display language"
-        "Scegli come vengono catturati i fotogrammi durante la stampa", // 147="Choose how frames
-                                                                        // are captured during
-                                                                        // printing"
-        "Scegli modalità di rendering per visualizzazione G-code", // 148="Choose rendering mode for
-                                                                   // G-code visualization"
-        "Scegli modalità di rendering per visualizzazione mesh piano", // 149="Choose rendering mode
-                                                                       // for bed mesh
-                                                                       // visualization"
-        "Pulisci ugello",                                              // 150="Clean Nozzle"
-        "Cancella",                                                    // 151="Clear"
-        "Cancella tutto",                                              // 152="Clear All"
-        "Rimuovi assegnazione",                                        // 153="Clear Assignment"
-        "Appunti non disponibili - usare SSH", // 154="Clipboard unavailable - use SSH"
-        "Chiudi",                              // 155="Close"
-        "Più vicino = più schiacciamento | Più lontano = meno schiacciamento", // 156="Closer = more
-                                                                               // squish | Farther =
-                                                                               // less squish"
-        "Sensori colore",                               // 157="Color Sensors"
-        "Completato",                                   // 158="Complete"
-        "Completato",                                   // 159="Completed"
-        "Completato in 3 sondaggi",                     // 160="Completed in 3 probes"
-        "Definito nella configurazione (sola lettura)", // 161="Config-defined (read-only)"
-        "Configura retrazione firmware G10/G11", // 162="Configure G10/G11 firmware retraction"
-        "Configura PRINT_START",                 // 163="Configure PRINT_START"
-        "Configura integrazione Spoolman e impostazioni sincronizzazione peso.", // 164="Configure
-                                                                                 // Spoolman
-                                                                                 // integration and
-                                                                                 // weight sync
-                                                                                 // settings."
-        "Configura dispositivi in Moonraker",         // 165="Configure devices in Moonraker"
-        "Configura sensori rilevamento filamento",    // 166="Configure filament detection sensors"
-        "Configura pulsanti rapidi e macro standard", // 167="Configure quick buttons and standard
-                                                      // macros"
-        "Configura registrazione timelapse",          // 168="Configure timelapse recording"
-        "Connetti",                                   // 169="Connect"
-        "Connesso",                                   // 170="Connected"
-        "Connessione",                                // 171="Connecting"
-        "Connessione alla rete...",                   // 172="Connecting to network..."
-        "Connessione in corso...",                    // 173="Connecting..."
-        "Connessione",                                // 174="Connection"
-        "Connessione fallita. Verificare la password.", // 175="Connection failed. Check password."
-        "La connessione deve essere testata con successo per continuare", // 176="Connection must be
-                                                                          // tested successfully to
-                                                                          // continue"
-        "Console",                                                        // 177="Console"
-        "Controlla funzionalità opzionali avvio stampa", // 178="Control optional print start
-                                                         // features"
-        "Raffredda",                                     // 179="Cool Down"
-        "Raffreddamento",                                // 180="Cooldown"
-        "Raffreddamento",                                // 181="Cooling"
-        "Copia comando",                                 // 182="Copy Command"
-        "Arrotondamento angoli (0 = netto, 40 = molto arrotondato)", // 183="Corner roundness (0 =
-                                                                     // sharp, 40 = very round)"
-        "Crea video al completamento della stampa",  // 184="Create video when print completes"
-        "Attuale / Target",                          // 185="Current / Target"
-        "Mesh attuale",                              // 186="Current Mesh"
-        "Temperatura attuale",                       // 187="Current Temperature"
-        "Posizione Z attuale",                       // 188="Current Z Position"
-        "Nome attuale:",                             // 189="Current name:"
-        "Attualmente caricato",                      // 190="Currently Loaded"
-        "Stampa in corso",                           // 191="Currently printing"
-        "Personalizzato...",                         // 192="Custom..."
-        "Taglio filamento...",                       // 193="Cutting filament..."
-        "DIAGNOSTICA",                               // 194="DIAGNOSTICS"
-        "DISABILITATO",                              // 195="DISABLED"
-        "Pericolo",                                  // 196="Danger"
-        "Modalità scura",                            // 197="Dark Mode"
-        "Giorno",                                    // 198="Day"
-        "Predefinito (valore=50)",                   // 199="Default (value=50)"
-        "Spessore bordo predefinito",                // 200="Default border thickness"
-        "Definire le macro nel proprio printer.cfg", // 201="Define macros in your printer.cfg"
-        "Elimina",                                   // 202="Delete"
-        "Delta:",                                    // 203="Delta:"
-        "Deutsch",                                   // 204="Deutsch"
-        "Operazioni dispositivo",                    // 205="Device Operations"
-        "Disabilita",                                // 206="Disable"
-        "Stampanti rilevate",                        // 207="Discovered Printers"
-        "Ignora",                                    // 208="Dismiss"
-        "Schermo",                                   // 209="Display"
-        "Impostazioni schermo",                      // 210="Display Settings"
-        "Schermo in standby",                        // 211="Display Sleep"
-        "Non salvare",                               // 212="Don't Save"
-        "Non chiedere più",                          // 213="Don't ask again"
-        "Fatto",                                     // 214="Done"
-        "Intensità ombra (0 = disabilitata)",        // 215="Drop shadow strength (0 = disabled)"
-        "Essiccatore",                               // 216="Dryer"
-        "Controllo essiccatore",                     // 217="Dryer Control"
-        "Durata",                                    // 218="Duration"
-        "Arresto emergenza",                         // 219="E-Stop"
-        "Conferma arresto emergenza",                // 220="E-Stop Confirmation"
-        "CONTROLLI EMERGENZA",                       // 221="EMERGENCY CONTROLS"
-        "ARRESTO EMERGENZA",                         // 222="EMERGENCY STOP"
-        "Ogni ventola può essere selezionata solo una volta", // 223="Each fan can only be selected
-                                                              // once"
-        "Modifica",                                           // 224="Edit"
-        "Modifica preset",                                    // 225="Edit Preset"
-        "Modifica Slot 1",                                    // 226="Edit Slot 1"
-        "Modifica colori tema",                               // 227="Edit Theme Colors"
-        "Modifica colori tema (modificato)",                  // 228="Edit Theme Colors (Modified)"
-        "Trascorso",                                          // 229="Elapsed"
-        "Arresto emergenza",                                  // 230="Emergency Stop"
-        "Arresto emergenza (M112)",                           // 231="Emergency Stop (M112)"
-        "Arresto emergenza?",                                 // 232="Emergency Stop?"
-        "Vuoto",                                              // 233="Empty"
-        "Gli slot vuoti disabilitano le funzionalità associate", // 234="Empty slots disable the
-                                                                 // associated functionality"
-        "Abilita",                                               // 235="Enable"
-        "Abilita monitoraggio",                                  // 236="Enable Monitoring"
-        "Abilita retrazione",                                    // 237="Enable Retraction"
-        "Abilita timelapse",                                     // 238="Enable Timelapse"
-        "Abilita effetti movimento interfaccia",                 // 239="Enable UI motion effects"
-        "Abilita WiFi per scansionare",                          // 240="Enable WiFi to scan"
-        "Abilita WiFi per scansionare le reti", // 241="Enable WiFi to scan for networks"
-        "Abilita feedback audio",               // 242="Enable audio feedback"
-        "Abilita tracciamento dettagliato preparazione stampa (consigliato)", // 243="Enable
-                                                                              // detailed print
-                                                                              // preparation
-                                                                              // tracking
-                                                                              // (Recommended)"
-        "Abilitato",                                                          // 244="Enabled"
-        "Terminato",                                                          // 245="Ended"
-        "English",                                                            // 246="English"
-        "Miglioramento completato!",                         // 247="Enhancement Complete!"
-        "Miglioramento fallito",                             // 248="Enhancement Failed"
-        "Inserisci comando G-code...",                       // 249="Enter G-code command..."
-        "Inserisci password WiFi",                           // 250="Enter WiFi Password"
-        "Inserisci un nome per il tuo tema personalizzato:", // 251="Enter a name for your custom
-                                                             // theme:"
-        "Inserisci un nome per salvare questo profilo", // 252="Enter a name to save this profile"
-        "Inserisci nome rete",                          // 253="Enter network name"
-        "Inserisci password",                           // 254="Enter password"
-        "Errore",                                       // 255="Error"
-        "Stato errore",                                 // 256="Error state"
-        "Español",                                      // 257="Español"
-        "Ethernet",                                     // 258="Ethernet"
-        "Escludi",                                      // 259="Exclude"
-        "Esegui macro stampante",                       // 260="Execute printer macros"
-        "Ventola scarico",                              // 261="Exhaust Fan"
-        "Esplora come la palette selezionata definisce testo, controlli e colori di stato.", // 262="Explore
-                                                                                             // how
-                                                                                             // the
-                                                                                             // selected
-                                                                                             // palette
-                                                                                             // shapes
-                                                                                             // text,
-                                                                                             // controls,
-                                                                                             // and
-                                                                                             // status
-                                                                                             // colors."
-        "Esplora palette e anteprima",                 // 263="Explore palette and preview"
-        "Priming extra per compensare la fuoriuscita", // 264="Extra prime to compensate ooze"
-        "Estrudi",                                     // 265="Extrude"
-        "Estrudi / Ritrai",                            // 266="Extrude / Retract"
-        "Estrusore",                                   // 267="Extruder"
-        "Regolazione PID estrusore",                   // 268="Extruder PID Tuning"
-        "L'estrusore si riscalda automaticamente in base al materiale", // 269="Extruder heats
-                                                                        // automatically based on
-                                                                        // material"
-        "Velocità estrusione",                                          // 270="Extrusion rate"
-        "FALLITO",                                                      // 271="FAILED"
-        "FILAMENTO",                                                    // 272="FILAMENT"
-        "Ripristino di fabbrica",                                       // 273="Factory Reset"
-        "Fallito",                                                      // 274="Failed"
-        "Salvataggio file tema fallito",                 // 275="Failed to save theme file"
-        "Alimenta filamento direttamente all'estrusore", // 276="Feed filament directly to extruder"
-        "Filamento",                                     // 277="Filament"
-        "Sensore filamento",                             // 278="Filament Sensor"
-        "Sensori filamento",                             // 279="Filament Sensors"
-        "Filamento utilizzato",                          // 280="Filament Used"
-        "Filamento per tipo",                            // 281="Filament by Type"
-        "Sensori diametro filamento per compensazione flusso", // 282="Filament diameter sensors for
-                                                               // flow compensation"
-        "Sensori esaurimento filamento e rilevamento movimento", // 283="Filament runout and motion
-                                                                 // detection sensors"
-        "Tracciamento e inventario filamento",            // 284="Filament tracking and inventory"
-        "File",                                           // 285="File"
-        "Info file",                                      // 286="File Info"
-        "Nome file",                                      // 287="Filename"
-        "File",                                           // 288="Files"
-        "Riempimento: 100% / 75% / 40% / 10%",            // 289="Fill: 100% / 75% / 40% / 10%"
-        "Riavvio firmware",                               // 290="Firmware Restart"
-        "Anelli concentrici piatti (ams_slot esistente)", // 291="Flat Concentric Rings (existing
-                                                          // ams_slot)"
-        "Flusso",                                         // 292="Flow Rate"
-        "Formazione punta...",                            // 293="Forming tip..."
-        "Frequenza fotogrammi",                           // 294="Framerate"
-        "Français",                                       // 295="Français"
-        "Freq",                                           // 296="Freq"
-        "Anteriore",                                      // 297="Front"
-        "Console G-code",                                 // 298="G-code Console"
-        "Anteprima G-code",                               // 299="G-code Preview"
-        "I comandi G-code appariranno qui",               // 300="G-code commands will appear here"
-        "Ghost:",                                         // 301="Ghost:"
-        "Grigio",                                         // 302="Gray"
-        "Happy Hare MMU",                                 // 303="Happy Hare MMU"
-        "Hardware",                                       // 304="Hardware"
-        "Stato hardware",                                 // 305="Hardware Health"
-        "Problemi hardware",                              // 306="Hardware Issues"
-        "Nome hardware",                                  // 307="Hardware Name"
-        "L'hardware viene validato all'avvio e alla riconnessione", // 308="Hardware is validated on
-                                                                    // startup and reconnection"
-        "Avere un foglio di carta pronto prima di iniziare.", // 309="Have a piece of paper ready
-                                                              // before starting."
-        "Avere pronto lo strumento di regolazione piano (cacciavite, chiave esagonale, ecc.) se il "
-        "piano non viene regolato con                              manopole o altri meccanismi "
-        "integrati.",   // 310="Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if
-                        // your bed isn't adjusted with                              thumb wheels or
-                        // some other built-in mechanism."
-        "Intestazione", // 311="Heading"
-        "Preriscaldamento",                 // 312="Heat Soak"
-        "Riscaldare a 170°C per estrudere", // 313="Heat to 170°C to extrude"
-        "Temperatura piano riscaldato",     // 314="Heatbed Temperature"
-        "Piano riscaldato",                 // 315="Heated Bed"
-        "Riscaldamento...",                 // 316="Heating..."
-        "HelixScreen si è arrestato",       // 317="HelixScreen Crashed"
-        "HelixScreen si integrerà con il tuo cambia-filamento per operazioni di stampa "
-        "multi-bobina/colore.",  // 318="HelixScreen will integrate with your filament changer for
-                                 // multi-spool/color print operations."
-        "Più alto = più veloce", // 319="Higher = faster"
-        "Home",                  // 320="Home"
-        "Home tutto",            // 321="Home All"
-        "Home X",                // 322="Home X"
-        "Home Y",                // 323="Home Y"
-        "Home Z",                // 324="Home Z"
-        "Progresso orizzontale (procedura guidata livellamento)", // 325="Horizontal Progress
-                                                                  // (Leveling Wizard)"
-        "Host",                                                   // 326="Host"
-        "Hotend",                                                 // 327="Hotend"
-        "Ventola hotend",                                         // 328="Hotend Fan"
-        "Riscaldatore hotend",                                    // 329="Hotend Heater"
-        "Frequenza controllo Spoolman per aggiornamenti peso", // 330="How often to check Spoolman
-                                                               // for weight updates"
-        "Umidità",                                             // 331="Humidity"
-        "Sensori umidità",                                     // 332="Humidity Sensors"
-        "IP:",                                                 // 333="IP:"
-        "Inattivo",                                            // 334="Idle"
-        "Ignora",                                              // 335="Ignore"
-        "In corso",                                            // 336="In Progress"
-        "Indicizzazione G-code...",                            // 337="Indexing G-code..."
-        "Inizializzazione...",                                 // 338="Initializing..."
-        "Input",                                               // 339="Input"
-        "Input Shaper",                                        // 340="Input Shaper"
-        "Input Shaping",                                       // 341="Input Shaping"
-        "Sensori calibrazione input shaper", // 342="Input shaper calibration sensors"
-        "L'input shaping riduce gli artefatti da vibrazione (ringing) nelle stampe.", // 343="Input
-                                                                                      // shaping
-                                                                                      // reduces
-                                                                                      // vibration
-                                                                                      // artifacts
-                                                                                      // (ringing)
-                                                                                      // in your
-                                                                                      // prints."
-        "Installa plugin HelixPrint", // 344="Install HelixPrint Plugin"
-        "Installa plugin",            // 345="Install Plugin"
-        "Installa il plugin HelixPrint per abilitare modifiche G-code rapide. Esegui questo "
-        "comando via SSH sulla stampante:", // 346="Install the HelixPrint plugin to enable fast
-                                            // G-code modifications. Run this command via SSH on
-                                            // your printer:"
-        "Installazione fallita",            // 347="Installation Failed"
-        "L'installazione richiede circa 30 secondi.", // 348="Installation takes about 30 seconds."
-        "Installazione in corso...",                  // 349="Installing..."
-        "Intensità",                                  // 350="Intensity"
-        "G-code 3D interattivo durante le stampe",    // 351="Interactive 3D G-code during prints"
-        "Calibrazione sonda interattiva",             // 352="Interactive probe calibration"
-        "Descrizione problema",                       // 353="Issue description"
-        "Italiano",                                   // 354="Italiano"
-        "Adesso",                                     // 355="Just now"
-        "Kd:",                                        // 356="Kd:"
-        "Continua a stampare",                        // 357="Keep Printing"
-        "Mantieni obbligatorio",                      // 358="Keep Required"
-        "Test tastiera (stile Gboard)",               // 359="Keyboard Test (Gboard-style)"
-        "Ki:",                                        // 360="Ki:"
-        "Klipper",                                    // 361="Klipper"
-        "Klipper è entrato in stato di arresto. Ciò potrebbe essere dovuto a un arresto di "
-        "emergenza, fuga termica o errore di configurazione.", // 362="Klipper has entered shutdown
-                                                               // state. This may be due to an
-                                                               // emergency stop, thermal runaway,
-                                                               // or configuration error."
-        "Klipper si riavvierà per applicare le modifiche",     // 363="Klipper will restart to apply
-                                                               // changes"
-        "Klipper si riavvierà per applicare le modifiche.",    // 364="Klipper will restart to apply
-                                                               // changes."
-        "Klipper si riavvierà per applicare i nuovi valori PID.", // 365="Klipper will restart to
-                                                                  // apply new PID values."
-        "Kp:",                                                    // 366="Kp:"
-        "Striscia LED",                                           // 367="LED Strip"
-        "LED acceso all'avvio",                                   // 368="LED on at Start"
-        "CARICATO",                                               // 369="LOADED"
-        "Lingua",                                                 // 370="Language"
-        "Ultimi 7 giorni",                                        // 371="Last 7 days"
-        "Ultima stampa annullata",                                // 372="Last print cancelled"
-        "Ultima stampa fallita",                                  // 373="Last print failed"
-        "Dopo",                                                   // 374="Later"
-        "Layer",                                                  // 375="Layer"
-        "Altezza layer",                                          // 376="Layer Height"
-        "La modalità layer cattura un fotogramma per cambio layer. Ideale per la maggior parte "
-        "delle stampe.",      // 377="Layer mode captures one frame per layer change. Best for most
-                              // prints."
-        "Layer:",             // 378="Layer:"
-        "Layer",              // 379="Layers"
-        "Lunghezza:",         // 380="Length:"
-        "Chiaro",             // 381="Light"
-        "Carica",             // 382="Load"
-        "Carica filamento",   // 383="Load Filament"
-        "Caricato",           // 384="Loaded"
-        "Errore caricamento", // 385="Loading Error"
-        "Caricamento G-code...",                            // 386="Loading G-code..."
-        "Caricamento filamento...",                         // 387="Loading filament..."
-        "Caricamento cronologia...",                        // 388="Loading history..."
-        "Caricamento bobine...",                            // 389="Loading spools..."
-        "Caricamento...",                                   // 390="Loading..."
-        "Bloccato durante la stampa",                       // 391="Locked during print"
-        "M per alternare",                                  // 392="M to toggle"
-        "MAC:",                                             // 393="MAC:"
-        "Icone MDI",                                        // 394="MDI Icons"
-        "CONFIGURATO MANCANTE",                             // 395="MISSING CONFIGURED"
-        "MOVIMENTO",                                        // 396="MOTION"
-        "Limiti macchina",                                  // 397="Machine Limits"
-        "Browser macro",                                    // 398="Macro Browser"
-        "Pulsanti macro",                                   // 399="Macro Buttons"
-        "Macro per calibrazione mesh piano",                // 400="Macro for bed mesh calibration"
-        "Macro per preriscaldamento camera/piano",          // 401="Macro for chamber/bed heat soak"
-        "Macro per livellamento fisico piano (QGL/Z-Tilt)", // 402="Macro for physical bed leveling
-                                                            // (QGL/Z-Tilt)"
-        "Macro per annullare una stampa attiva",            // 403="Macro to cancel an active print"
-        "Macro per pulire l'ugello",                        // 404="Macro to clean/wipe the nozzle"
-        "Macro per caricare filamento nell'estrusore", // 405="Macro to load filament into extruder"
-        "Macro per mettere in pausa una stampa attiva", // 406="Macro to pause an active print"
-        "Macro per spurgare/preparare l'ugello",        // 407="Macro to purge/prime the nozzle"
-        "Macro per riprendere una stampa in pausa",     // 408="Macro to resume a paused print"
-        "Macro per scaricare filamento dall'estrusore", // 409="Macro to unload filament from
-                                                        // extruder"
-        "Macro",                                        // 410="Macros"
-        "Striscia LED principale",                      // 411="Main LED Strip"
-        "Rendi opzionale",                              // 412="Make Optional"
-        "Rendi mesh piano e QGL saltabili",             // 413="Make bed mesh and QGL skippable"
-        "Gestisci",                                     // 414="Manage"
-        "Livellamento piano manuale",                   // 415="Manual Bed Leveling"
-        "Materiale",                                    // 416="Material"
-        "Spinner Material Design",                      // 417="Material Design Spinner"
-        "Accelerazione massima",                        // 418="Max Acceleration"
-        "Velocità massima",                             // 419="Max Velocity"
-        "Accel. Z massima",                             // 420="Max Z Accel"
-        "Velocità Z massima",                           // 421="Max Z Velocity"
-        "Velocità massima in curva (mm/s)",             // 422="Max speed through corners (mm/s)"
-        "Accelerazione massima (mm/s²)",                // 423="Maximum acceleration (mm/s²)"
-        "Velocità massima testina (mm/s)",              // 424="Maximum toolhead speed (mm/s)"
-        "Misura rumore",                                // 425="Measure Noise"
-        "Memoria (MB)",                                 // 426="Memory (MB)"
-        "Mesh completata",                              // 427="Mesh Complete"
-        "Modalità",                                     // 428="Mode"
-        "Modificato",                                   // 429="Modified"
-        "Mese",                                         // 430="Month"
-        "Moonraker",                                    // 431="Moonraker"
-        "Movimento",                                    // 432="Motion"
-        "Movimento: XYZ",                               // 433="Motion: XYZ"
-        "Motori spenti",                                // 434="Motors Off"
-        "Muovi",                                        // 435="Move"
-        "Muovere la carta avanti e indietro durante la regolazione. Fermarsi quando la carta si "
-        "blocca leggermente ma ancora scorre.",  // 436="Move paper back and forth while adjusting.
-                                                 // Stop when paper catches slightly but still
-                                                 // slides."
-        "Velocità movimento",                    // 437="Movement speed"
-        "Multi-filamento",                       // 438="Multi-Filament"
-        "Multi-materiale",                       // 439="Multi-Material"
-        "Il mio tema personalizzato",            // 440="My Custom Theme"
-        "Il mio pannello",                       // 441="My Panel"
-        "La mia stampante",                      // 442="My Printer"
-        "APPENA RILEVATO",                       // 443="NEWLY DISCOVERED"
-        "NOTIFICHE",                             // 444="NOTIFICATIONS"
-        "Nome",                                  // 445="Name"
-        "Indirizzo di rete",                     // 446="Network Address"
-        "Nome rete",                             // 447="Network Name"
-        "Nome rete (SSID)",                      // 448="Network Name (SSID)"
-        "Impostazioni rete",                     // 449="Network Settings"
-        "Test rete",                             // 450="Network Test"
-        "Mai",                                   // 451="Never"
-        "Nuovi valori PID",                      // 452="New PID Values"
-        "Nuovo Z-Offset: 0.000",                 // 453="New Z-Offset: 0.000"
-        "Nome nuovo profilo",                    // 454="New profile name"
-        "Avanti",                                // 455="Next"
-        "Nessun sistema AMS connesso.",          // 456="No AMS system connected."
-        "Nessuna cronologia",                    // 457="No History"
-        "Nessuna macro trovata",                 // 458="No Macros Found"
-        "Nessun dispositivo alimentazione",      // 459="No Power Devices"
-        "Nessuna bobina",                        // 460="No Spools"
-        "Nessun file caricato",                  // 461="No file loaded"
-        "Nessun file disponibile per la stampa", // 462="No files available for printing"
-        "Nessuna mesh caricata",                 // 463="No mesh loaded"
-        "Nessuna rete trovata",                  // 464="No networks found"
-        "Nessuna notifica",                      // 465="No notifications"
-        "Nessun plugin trovato",                 // 466="No plugins found"
-        "Nessuna anteprima",                     // 467="No preview"
-        "Ancora nessuna cronologia stampa",      // 468="No print history yet"
-        "Nessuna macro avvio stampa trovata",    // 469="No print start macro found"
-        "Nessun profilo disponibile",            // 470="No profiles available"
-        "Nessun sensore rilevato",               // 471="No sensors detected"
-        "Nessuna bobina disponibile",            // 472="No spools available"
-        "Non ora",                               // 473="Not Now"
-        "Non connesso",                          // 474="Not connected"
-        "Notifiche",                             // 475="Notifications"
-        "Notifica al termine della stampa",      // 476="Notify when print finishes"
-        "Ugello",                                // 477="Nozzle"
-        "Preparazione ugello",                   // 478="Nozzle Priming"
-        "Temp. ugello",                          // 479="Nozzle Temp"
-        "Temperatura ugello",                    // 480="Nozzle Temperature"
-        "Ugello °C",                             // 481="Nozzle °C"
-        "Ugello:",                               // 482="Nozzle:"
-        "OK",                                    // 483="OK"
-        "Off",                                   // 484="Off"
-        "Offline",                               // 485="Offline"
-        "On",                                    // 486="On"
-        "Apri",                                  // 487="Open"
-        "Operazioni",                            // 488="Operations"
-        "Ottimizza la tua stampa",               // 489="Optimize Your Printing"
-        "Oppure inserisci manualmente",          // 490="Or Enter Manually"
-        "PETG",                                  // 491="PETG"
-        "Regolazione PID",                       // 492="PID Tuning"
-        "La regolazione PID ottimizza il controllo temperatura per un riscaldamento stabile.", // 493="PID
-                                                                                               // tuning
-                                                                                               // optimizes
-                                                                                               // temperature
-                                                                                               // control
-                                                                                               // for
-                                                                                               // stable
-                                                                                               // heating."
-        "PLA",                              // 494="PLA"
-        "PLA - Nero",                       // 495="PLA - Black"
-        "PASSAGGI PRE-STAMPA",              // 496="PRE-PRINT STEPS"
-        "STAMPANTE",                        // 497="PRINTER"
-        "Calibrazione test carta",          // 498="Paper Test Calibration"
-        "Ventola raffreddamento pezzo",     // 499="Part Cooling Fan"
-        "Ventola pezzo",                    // 500="Part Fan"
-        "Password",                         // 501="Password"
-        "La password non può essere vuota", // 502="Password cannot be empty"
-        "Pausa",                            // 503="Pause"
-        "In pausa",                         // 504="Paused"
-        "In pausa (attenzione richiesta)",  // 505="Paused (attention needed)"
-        "Picco:",                           // 506="Peak:"
-        "Tracciamento fase",                // 507="Phase Tracking"
-        "Scegli colore",                    // 508="Pick Color"
-        "Posiziona i plugin nella directory plugins per estendere HelixScreen", // 509="Place
-                                                                                // plugins in the
-                                                                                // plugins directory
-                                                                                // to extend
-                                                                                // HelixScreen"
-        "Inserire un nome per il tema", // 510="Please enter a theme name"
-        "Attendere mentre la stampante esegue homing e sondaggio.", // 511="Please wait while the
-                                                                    // printer homes and probes."
-        "Attendere mentre la stampante sonda ogni posizione vite.", // 512="Please wait while the
-                                                                    // printer probes each screw
-                                                                    // position."
-        "Plugin installato con successo.", // 513="Plugin installed successfully."
-        "Plugin",                          // 514="Plugins"
-        "I plugin vengono rilevati all'avvio dell'applicazione", // 515="Plugins are discovered on
-                                                                 // application startup"
-        "Polymaker",                                             // 516="Polymaker"
-        "Porta",                                                 // 517="Port"
-        "Português",                                             // 518="Português"
-        "Posizione",                                             // 519="Position"
-        "Alimentazione",                                         // 520="Power"
-        "Controllo alimentazione",                               // 521="Power Control"
-        "Preriscalda",                                           // 522="Preheat"
-        "Preparazione stampa",                                   // 523="Preparing Print"
-        "Preparazione...",                                       // 524="Preparing..."
-        "Preset",                                                // 525="Presets"
-        "Precedente",                                            // 526="Previous"
-        "Primario",                                              // 527="Primary"
-        "Stampa",                                                // 528="Print"
-        "Stampa annullata",                                      // 529="Print Cancelled"
-        "Stampa completata",                                     // 530="Print Complete"
-        "Stampa completata!",                                    // 531="Print Complete!"
-        "Avviso completamento stampa",                           // 532="Print Completion Alert"
-        "Dettagli stampa",                                       // 533="Print Details"
-        "File stampa",                                           // 534="Print File"
-        "File di stampa",                                        // 535="Print Files"
-        "Cronologia stampe",                                     // 536="Print History"
-        "Ore di stampa",                                         // 537="Print Hours"
-        "Velocità stampa",                                       // 538="Print Speed"
-        "Stato stampa",                                          // 539="Print Status"
-        "Tempo stampa",                                          // 540="Print Time"
-        "Regolazione stampa",                                    // 541="Print Tuning"
-        "Stampante",                                             // 542="Printer"
-        "Nome stampante",                                        // 543="Printer Name"
-        "Arresto stampante",                                     // 544="Printer Shutdown"
-        "Tipo stampante",                                        // 545="Printer Type"
-        "Stampa in corso",                                       // 546="Printing"
-        "Tendenza stampe",                                       // 547="Prints Trend"
-        "Privato:",                                              // 548="Private:"
-        "Sonda",                                                 // 549="Probe"
-        "Sensore sonda",                                         // 550="Probe Sensor"
-        "Sensori sonda",                                         // 551="Probe Sensors"
-        "Sondaggio mesh piano",                                  // 552="Probing Bed Mesh"
-        "Sondaggio viti piano...",                               // 553="Probing Bed Screws..."
-        "Sondaggio piano...",                                    // 554="Probing Bed..."
-        "Sondaggio fallito",                                     // 555="Probing Failed"
-        "Elaborazione...",                                       // 556="Processing..."
-        "Profilo",                                               // 557="Profile"
-        "Nome profilo (es. default)",            // 558="Profile name (e.g., default)"
-        "Profili",                               // 559="Profiles"
-        "Progresso",                             // 560="Progress"
-        "Test barra progresso",                  // 561="Progress Bar Tests"
-        "Spurga",                                // 562="Purge"
-        "Spurga 50mm",                           // 563="Purge 50mm"
-        "PULSANTI RAPIDI",                       // 564="QUICK BUTTONS"
-        "Livellamento gantry quadruplo",         // 565="Quad Gantry Level"
-        "Azioni rapide",                         // 566="Quick Actions"
-        "Pulsante rapido 1",                     // 567="Quick Button 1"
-        "Pulsante rapido 2",                     // 568="Quick Button 2"
-        "Azioni rapide, calibrazione, velocità", // 569="Quick actions, calibration, speed"
-        "RSS:",                                  // 570="RSS:"
-        "Risonda",                               // 571="Re-probe"
-        "Pronto",                                // 572="Ready"
-        "Consigliato",                           // 573="Recommended"
-        "Consigliato: 200°C per estrusore",      // 574="Recommended: 200°C for extruder"
-        "Registra timelapse",                    // 575="Record Timelapse"
-        "Registra timelapse delle tue stampe",   // 576="Record timelapses of your prints"
-        "Modalità registrazione",                // 577="Recording Mode"
-        "Recupera",                              // 578="Recover"
-        "Riduci ringing",                        // 579="Reduce Ringing"
-        "Aggiorna",                              // 580="Refresh"
-        "Intervallo aggiornamento",              // 581="Refresh Interval"
-        "Rimanente",                             // 582="Remaining"
-        "Rimuovi plugin dalla stampante",        // 583="Remove plugin from printer"
-        "Rinomina",                              // 584="Rename"
-        "Rinomina profilo mesh",                 // 585="Rename Mesh Profile"
-        "Ristampa",                              // 586="Reprint"
-        "Richiedi conferma prima dell'arresto di emergenza", // 587="Require confirmation before
-                                                             // emergency stop"
-        "Richiede plugin Moonraker-Timelapse",  // 588="Requires Moonraker-Timelapse plugin"
-        "Ripristina",                           // 589="Reset"
-        "Ripristina velocità e flusso al 100%", // 590="Reset Speed & Flow to 100%"
-        "Ripristina velocità e flusso al 100%", // 591="Reset Speed &amp; Flow to 100%"
-        "Ripristina tutte le impostazioni e riavvia procedura guidata", // 592="Reset all settings
-                                                                        // and restart wizard"
-        "Ripristino...",                                                // 593="Resetting..."
-        "Regolazione compensazione risonanza",              // 594="Resonance compensation tuning"
-        "Riavvia HelixScreen",                              // 595="Restart HelixScreen"
-        "Riavvia Klipper",                                  // 596="Restart Klipper"
-        "Riavvia ora",                                      // 597="Restart Now"
-        "Riavvio richiesto",                                // 598="Restart Required"
-        "Riavvia l'applicazione display",                   // 599="Restart the display application"
-        "Riprendi",                                         // 600="Resume"
-        "Riprendi stampa",                                  // 601="Resume Print"
-        "Ritrai",                                           // 602="Retract"
-        "Lunghezza retrazione",                             // 603="Retract Length"
-        "Velocità retrazione",                              // 604="Retract Speed"
-        "Impostazioni retrazione",                          // 605="Retraction Settings"
-        "Riprova",                                          // 606="Retry"
-        "Rivedi problemi di validazione hardware rilevati", // 607="Review detected hardware
-                                                            // validation issues"
-        "Rivedi le modifiche",                              // 608="Review your changes"
-        "Ruolo:",                                           // 609="Role:"
-        "Sensore esaurimento",                              // 610="Runout Sensor"
-        "MACRO STANDARD",                                   // 611="STANDARD MACROS"
-        "STOP",                                             // 612="STOP"
-        "PROPRIETÀ STILE",                                  // 613="STYLE PROPERTIES"
-        "SISTEMA",                                          // 614="SYSTEM"
-        "Salva",                                            // 615="Save"
-        "Salva e riavvia",                                  // 616="Save & Restart"
-        "Salva e riavvia",                                  // 617="Save &amp; Restart"
-        "Salva come nuovo",                                 // 618="Save As New"
-        "Salva configurazione",                             // 619="Save Config"
-        "Salva configurazione stampante",                   // 620="Save Printer Configuration"
-        "Salva tema come",                                  // 621="Save Theme As"
-        "Salva Z-Offset",                                   // 622="Save Z-Offset"
-        "Salvare Z-Offset?",                                // 623="Save Z-Offset?"
-        "Salvare le modifiche per mantenerle dopo i riavvii?", // 624="Save changes to persist them
-                                                               // across restarts?"
-        "Salvataggio configurazione...",                       // 625="Saving Configuration..."
-        "Il salvataggio riavvierà Klipper e ANNULLERÀ qualsiasi stampa attiva!", // 626="Saving will
-                                                                                 // restart Klipper
-                                                                                 // and CANCEL any
-                                                                                 // active print!"
-        "Scansione reti...",                                   // 627="Scanning for networks..."
-        "Attenuazione schermo",                                // 628="Screen Dim"
-        "Lo schermo si attenua dopo un periodo di inattività", // 629="Screen dims to lower
-                                                               // brightness after period of
-                                                               // inactivity"
-        "Lo schermo si attenuerà dopo il periodo di inattività selezionato", // 630="Screen will dim
-                                                                             // after the selected
-                                                                             // period of
-                                                                             // inactivity"
-        "Velocità scorrimento",                                              // 631="Scroll Speed"
-        "Cerca nome file...", // 632="Search filename..."
-        "Secondario",         // 633="Secondary"
-        "Sicurezza",          // 634="Security"
-        "Seleziona",          // 635="Select"
-        "Selezionare 'Nessuno' se non si dispone di un sensore filamento o se non si desidera la "
-        "pausa all'esaurimento.", // 636="Select 'None' if you don't have a filament sensor, or if
-                                  // you don't want to pause on runout."
-        "Selezionare 'Nessuno' se si dispone di una sonda dedicata o non si utilizza il "
-        "livellamento mesh piano.", // 637="Select 'None' if you have a dedicated probe, or don't
-                                    // use bed mesh leveling."
-        "Seleziona filamento",      // 638="Select Filament"
-        "Seleziona file",           // 639="Select File"
-        "Seleziona file G-Code",    // 640="Select G-Code File"
-        "Seleziona riscaldatore",   // 641="Select Heater"
-        "Seleziona macro per il primo pulsante",        // 642="Select macro for first button"
-        "Seleziona macro per il secondo pulsante",      // 643="Select macro for second button"
-        "Selezione slot...",                            // 644="Selecting slot..."
-        "Test parametri dimensione semantici",          // 645="Semantic Size Parameter Tests"
-        "Invia comandi direttamente alla stampante",    // 646="Send commands directly to printer"
-        "Sensori",                                      // 647="Sensors"
-        "Imposta ",                                     // 648="Set "
-        "Impostazioni",                                 // 649="Settings"
-        "Intensità ombra",                              // 650="Shadow Intensity"
-        "Shaper",                                       // 651="Shaper"
-        "Lucentezza:",                                  // 652="Shininess:"
-        "Mostra stato dettagliato preparazione stampa", // 653="Show detailed print preparation
-                                                        // status"
-        "Lato",                                         // 654="Side"
-        "Dimensione",                                   // 655="Size"
-        "Salta per ora",                                // 656="Skip for now"
-        "Slot 1",                                       // 657="Slot 1"
-        "Le etichette piccole aiutano a mantenere i controlli ordinati e mirati.", // 658="Small
-                                                                                   // labels help
-                                                                                   // keep controls
-                                                                                   // calm and
-                                                                                   // focused."
-        "Alcune impostazioni avranno effetto dopo il riavvio.", // 659="Some settings will take
-                                                                // effect after restart."
-        "Suoni",                                                // 660="Sounds"
-        "Speculare:",                                           // 661="Specular:"
-        "Velocità",                                             // 662="Speed"
-        "Impostazioni velocità",                                // 663="Speed Settings"
-        "Velocità movimento priming",                           // 664="Speed of prime movement"
-        "Velocità movimento retrazione",             // 665="Speed of retraction movement"
-        "Velocità:",                                 // 666="Speed:"
-        "Visualizzazione bobina (Canvas pseudo-3D)", // 667="Spool Visualization (Pseudo-3D Canvas)"
-        "Spoolman",                                  // 668="Spoolman"
-        "Spoolman non ha bobine configurate",        // 669="Spoolman has no spools configured"
-        "Velocità angoli retti",                     // 670="Square Corner Velocity"
-        "Standby",                                   // 671="Standby"
-        "Avvia calibrazione",                        // 672="Start Calibration"
-        "Avvia sondaggio",                           // 673="Start Probing"
-        "Avviato",                                   // 674="Started"
-        "Stato",                                     // 675="Status"
-        "Icone stato",                               // 676="Status icons"
-        "Passaggio",                                 // 677="Step"
-        "Test widget progresso passaggi",            // 678="Step Progress Widget Test"
-        "Ferma",                                     // 679="Stop"
-        "Ferma essiccazione",                        // 680="Stop Drying"
-        "Fermare stampa?",                           // 681="Stop Print?"
-        "Ferma tutto il movimento. Richiede riavvio firmware.", // 682="Stops all motion. Requires
-                                                                // firmware restart."
-        "Stilizzato (valore=75)",                               // 683="Styled (value=75)"
-        "Tasso di successo",                                    // 684="Success Rate"
-        "Successo!",                                            // 685="Success!"
-        "Le superfici ereditano i token sfondo app per modalità chiara e scura.", // 686="Surfaces
-                                                                                  // inherit app
-                                                                                  // background
-                                                                                  // tokens for
-                                                                                  // light and dark
-                                                                                  // modes."
-        "Sensori interruttore",              // 687="Switch Sensors"
-        "Passa tra tema chiaro e scuro",     // 688="Switch between light and dark themes"
-        "Sincronizza con Spoolman",          // 689="Sync to Spoolman"
-        "Sincronizza con Spoolman",          // 690="Sync with Spoolman"
-        "Sysfs",                             // 691="Sysfs"
-        "Sistema rilevato",                  // 692="System detected"
-        "Rilevamento colore filamento TD-1", // 693="TD-1 filament color detection"
-        "COLORI TEMA",                       // 694="THEME COLORS"
-        "TPU",                               // 695="TPU"
-        "Tocca per mostrare tastiera...",    // 696="Tap to show keyboard..."
-        "Target",                            // 697="Target"
-        "Temperatura target",                // 698="Target Temperature"
-        "Temperatura",                       // 699="Temperature"
-        "Temperature",                       // 700="Temperatures"
-        "Regolazione temporanea per questa stampa, salvo salvataggio nel pannello Controlli", // 701="Temporary
-                                                                                              // adjustment
-                                                                                              // for
-                                                                                              // this
-                                                                                              // print,
-                                                                                              // unless
-                                                                                              // saved
-                                                                                              // on
-                                                                                              // Controls
-                                                                                              // panel"
-        "Terziario",        // 702="Tertiary"
-        "Test connessione", // 703="Test Connection"
-        "Test rete",        // 704="Test Network"
-        "Stampa di prova",  // 705="Test Print"
-        "Il plugin HelixPrint abilita modifiche G-code rapide direttamente sulla stampante, come "
-        "saltare la mesh piano per ristampe veloci.", // 706="The HelixPrint plugin enables fast
-                                                      // G-code modifications directly on your
-                                                      // printer—like skipping bed mesh for quick
-                                                      // reprints."
-        "Il riscaldatore si accenderà e spegnerà diverse volte.", // 707="The heater will cycle on
-                                                                  // and off several times."
-        "Tema",                                                   // 708="Theme"
-        "Colori tema",                                            // 709="Theme Colors"
-        "Preset tema",                                            // 710="Theme Preset"
-        "Le modifiche al tema si applicano dopo il riavvio.",     // 711="Theme changes apply after
-                                                                  // restart."
-        "Le modifiche al tema avranno effetto dopo il riavvio.",  // 712="Theme changes will take
-                                                                  // effect after restart."
-        "Tema, luminosità e impostazioni standby", // 713="Theme, brightness, and sleep settings"
-        "Barra sottile (altezza=8)",               // 714="Thin bar (height=8)"
-        "Questa calibrazione utilizza il metodo della frizione della carta per impostare lo "
-        "Z-offset.", // 715="This calibration uses the paper friction method to set your Z-offset."
-        "Questo potrebbe richiedere 1-2 minuti",        // 716="This may take 1-2 minutes"
-        "Questo potrebbe richiedere fino a 30 secondi", // 717="This may take up to 30 seconds"
-        "Questo plugin permette a HelixScreen di controllare opzioni avvio stampa come mesh piano "
-        "e QGL. Una volta installato, usa Configura PRINT_START sotto per abilitare i passaggi "
-        "opzionali.", // 718="This plugin lets HelixScreen control print start options like bed mesh
-                      // and QGL. Once installed, use Configure PRINT_START below to enable optional
-                      // steps."
-        "Questo processo richiede 3-5 minuti. Non interrompere.", // 719="This process takes 3-5
-                                                                  // minutes. Do not interrupt."
-        "Questo strumento sonda ogni vite del piano e indica quanto regolare.", // 720="This tool
-                                                                                // probes each bed
-                                                                                // screw and tells
-                                                                                // you how much to
-                                                                                // adjust."
-        "Questo fermerà immediatamente tutte le operazioni della stampante. La stampante "
-        "richiederà un riavvio per riprendere.", // 721="This will immediately halt all printer
-                                                 // operations. The printer will require a restart
-                                                 // to resume."
-        "Questo ripristinerà tutte le impostazioni ai valori predefiniti. Questa azione non può "
-        "essere annullata.", // 722="This will reset all settings to defaults. This action cannot be
-                             // undone."
-        "Questo riavvierà Klipper.",                 // 723="This will restart Klipper."
-        "Tempo",                                     // 724="Time"
-        "Formato ora",                               // 725="Time Format"
-        "Timelapse",                                 // 726="Timelapse"
-        "Timelapse disponibile",                     // 727="Timelapse Available"
-        "Impostazioni timelapse",                    // 728="Timelapse Settings"
-        "Suggerimento:",                             // 729="Tip:"
-        "Attiva/disattiva funzione",                 // 730="Toggle Feature"
-        "Strumento",                                 // 731="Tool"
-        "Cambia utensile",                           // 732="Tool Changer"
-        "Alto",                                      // 733="Top"
-        "Stampe totali",                             // 734="Total Prints"
-        "Calibrazione touch",                        // 735="Touch Calibration"
-        "Tocca ovunque per testare la calibrazione", // 736="Touch anywhere to test calibration"
-        "Tocca lo schermo per riattivare",           // 737="Touch screen to wake from sleep"
-        "Spostamenti",                               // 738="Travels"
-        "Risoluzione problemi:",                     // 739="Troubleshooting:"
-        "Regola",                                    // 740="Tune"
-        "Regola parametri PID riscaldatore",         // 741="Tune heater PID parameters"
-        "Accendi LED all'avvio della stampante",     // 742="Turn on LED when printer starts"
-        "Tipo",                                      // 743="Type"
-        "Digita per visualizzare anteprima campo input...", // 744="Type to preview input field..."
-        "USB",                                              // 745="USB"
-        "Disinstalla plugin HelixPrint",                    // 746="Uninstall HelixPrint Plugin"
-        "Sconosciuto",                                      // 747="Unknown"
-        "Bobina sconosciuta",                               // 748="Unknown Spool"
-        "Passaggio sconosciuto",                            // 749="Unknown Step"
-        "Scarica",                                          // 750="Unload"
-        "Scarica filamento",                                // 751="Unload Filament"
-        "Scaricamento filamento...",                        // 752="Unloading filament..."
-        "Extra dopo retrazione",                            // 753="Unretract Extra"
-        "Velocità dopo retrazione",                         // 754="Unretract Speed"
-        "Carica file gcode per iniziare",  // 755="Upload gcode files to get started"
-        "Usa retrazione firmware G10/G11", // 756="Use G10/G11 firmware retraction"
-        "ValgACE (ACE Pro)",               // 757="ValgACE (ACE Pro)"
-        "I valori sono stati salvati nella configurazione stampante.", // 758="Values have been
-                                                                       // saved to printer
-                                                                       // configuration."
-        "Limiti velocità e accelerazione", // 759="Velocity and acceleration limits"
-        "Produttore",                      // 760="Vendor"
-        "Versione",                        // 761="Version"
-        "Progresso verticale (procedura guidata retrazione)", // 762="Vertical Progress (Retract
-                                                              // Wizard)"
-        "Vibrazione",                                         // 763="Vibration"
-        "Velocità riproduzione video",                        // 764="Video playback speed"
-        "Visualizza cronologia completa",                     // 765="View Full History"
-        "Visualizza preset",                                  // 766="View Presets"
-        "Visualizza timelapse",                               // 767="View Timelapse"
-        "Visualizza plugin installati e stato", // 768="View installed plugins and status"
-        "Visualizza statistiche stampa e cronologia lavori", // 769="View print statistics and job
-                                                             // history"
-        "Avviso",                                            // 770="Warning"
-        "Settimana",                                         // 771="Week"
-        "I dati del peso sono sincronizzati da Spoolman per mostrare il filamento rimanente. Le "
-        "modifiche vengono sincronizzate anche quando le stampe iniziano, si mettono in pausa o si "
-        "completano.", // 772="Weight data is synced from Spoolman to display remaining filament.
-                       // Changes are also synced when prints start, pause, or complete."
-        "Impostazioni sincronizzazione peso",   // 773="Weight sync settings"
-        "Bianco",                               // 774="White"
-        "WiFi",                                 // 775="WiFi"
-        "Rete WiFi",                            // 776="WiFi Network"
-        "WiFi ed Ethernet",                     // 777="WiFi and Ethernet"
-        "Configurazione WiFi ed Ethernet",      // 778="WiFi and Ethernet configuration"
-        "Controllo WiFi non disponibile",       // 779="WiFi control unavailable"
-        "Hardware WiFi non disponibile",        // 780="WiFi hardware unavailable"
-        "Larghezza",                            // 781="Width"
-        "Sensori larghezza",                    // 782="Width Sensors"
-        "X:",                                   // 783="X:"
-        "XY",                                   // 784="XY"
-        "Y:",                                   // 785="Y:"
-        "Anno",                                 // 786="Year"
-        "Le stampe completate appariranno qui", // 787="Your completed prints will appear here"
-        "Z",                                    // 788="Z"
-        "Calibrazione Z",                       // 789="Z Calibration"
-        "Intervallo Z",                         // 790="Z Range"
-        "Sonde Z per livellamento piano e generazione mesh", // 791="Z probes for bed leveling and
-                                                             // mesh generation"
-        "Z-Offset",                                          // 792="Z-Offset"
-        "Calibrazione Z-Offset",                             // 793="Z-Offset Calibration"
-        "Z-Offset:",                                         // 794="Z-Offset:"
-        "Regolazione Z-Tilt",                                // 795="Z-Tilt Adjust"
-        "Z:",                                                // 796="Z:"
-        "Z: 0.000",                                          // 797="Z: 0.000"
-        "Zoom",                                              // 798="Zoom"
-        "^ ANTERIORE",                                       // 799="^ FRONT"
-        "ora",                                               // 800="hour"
-        "ore",                                               // 801="hours"
-        "lg",                                                // 802="lg"
-        "md",                                                // 803="md"
-        "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-        "minuto",                               // 805="minute"
-        "minuti",                               // 806="minutes"
-        "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-        "secondi",                              // 808="seconds"
-        "size=\"large\"",                       // 809="size="large""
-        "size=\"medium\"",                      // 810="size="medium""
-        "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-        "size=\"small\"",                       // 812="size="small""
-        "size=\"tiny\"",                        // 813="size="tiny""
-        "sm",                                   // 814="sm"
-        "true",                                 // 815="true"
-        "value=0 (mostra PIENO - BUG!)",        // 816="value=0 (shows FULL - BUG!)"
-        "value=1 (frammento piccolo?)",         // 817="value=1 (tiny sliver?)"
-        "value=100 (dovrebbe essere pieno)",    // 818="value=100 (should be full)"
-        "xs",                                   // 819="xs"
-        "Русский",                              // 820="Русский"
-        "—",                                    // 821="—"
-        "•",                                    // 822="•"
-        "中文",                                 // 823="中文"
-        "日本語",                               // 824="日本語"
-        "󰅐",                                 // 825="󰅐"
-        "󰉋",                                 // 826="󰉋"
-        "󱧰",                                 // 827="󱧰"
-};
-
-static const char*
-    ja_singulars[] =
-        {
-            " / ",                                                    // 0=" / "
-            " 0 / 0",                                                 // 1=" 0 / 0"
-            "#808080",                                                // 2="#808080"
-            "#RRGGBB",                                                // 3="#RRGGBB"
-            "(0)",                                                    // 4="(0)"
-            "(2.4GHz)",                                               // 5="(2.4GHz)"
-            "+",                                                      // 6="+"
-            "+0",                                                     // 7="+0"
-            "+0.01mm",                                                // 8="+0.01mm"
-            "+0.05mm",                                                // 9="+0.05mm"
-            "+0.1mm",                                                 // 10="+0.1mm"
-            "+1mm",                                                   // 11="+1mm"
-            "-",                                                      // 12="-"
-            "- printer.cfg の [resonance_tester] を確認してください", // 13="- Check
-                                                                      // [resonance_tester] in
-                                                                      // printer.cfg"
-            "- ADXL345 が接続されていることを確認してください",       // 14="- Ensure ADXL345 is
-                                                                      // connected"
-            "- まず「ノイズ測定」をお試しください",       // 15="- Try Measure Noise first"
-            "--",                                         // 16="--"
-            "---",                                        // 17="---"
-            "-0.01mm",                                    // 18="-0.01mm"
-            "-0.05mm",                                    // 19="-0.05mm"
-            "-0.1mm",                                     // 20="-0.1mm"
-            "-1mm",                                       // 21="-1mm"
-            "/",                                          // 22="/"
-            "0.4-2mm ダイレクトドライブ、4-6mm ボーデン", // 23="0.4-2mm direct drive, 4-6mm bowden"
-            "1. プリンターがホーミングしてベッドをプローブします", // 24="1. Printer homes and
-                                                                   // probes the bed"
-            "1. プリンターがホーミングして各ネジをプローブします", // 25="1. Printer will home and
-                                                                   // probe each screw"
-            "10mm",                                                // 26="10mm"
-            "1mm",                                                 // 27="1mm"
-            "2. ノズルとベッドの間に紙を置いてください",   // 28="2. Place paper between nozzle and
-                                                           // bed"
-            "2. 各ネジをどれだけ回すか結果が表示されます", // 29="2. Results show how much to turn
-                                                           // each screw"
-            "200-230°C",                                   // 30="200-230°C"
-            "210°C / 60°C",                                // 31="210°C / 60°C"
-            "230°C / 50°C",                                // 32="230°C / 50°C"
-            "240°C / 80°C",                                // 33="240°C / 80°C"
-            "250°C / 100°C",                               // 34="250°C / 100°C"
-            "25mm",                                        // 35="25mm"
-            "3. ネジを調整し、再度プローブして確認してください",   // 36="3. Adjust screws, then
-                                                                   // re-probe to verify"
-            "3. 紙がわずかに引っかかるまでノズルを下げてください", // 37="3. Lower nozzle until
-                                                                   // paper drags slightly"
-            "3Dプレビュー",                                        // 38="3D Preview"
-            "4. 紙が抵抗を感じながら動く状態が適切です",   // 39="4. Paper should move but with
-                                                           // resistance"
-            "4. ベッドが水平になるまで繰り返してください", // 40="4. Repeat until bed is level"
-            "5mm",                                         // 41="5mm"
-            "60°C",                                        // 42="60°C"
-            "6mm",                                         // 43="6mm"
-            "850g",                                        // 44="850g"
-            "= 緩める",                                    // 45="= Loosen"
-            "= 締める",                                    // 46="= Tighten"
-            "?",                                           // 47="?"
-            "バージョン情報",                              // 48="ABOUT"
-            "ABS",                                         // 49="ABS"
-            "AMS設定",                                     // 50="AMS Settings"
-            "外観",                                        // 51="APPEARANCE"
-            "自動化",                                      // 52="AUTOMATION"
-            "中止",                                        // 53="Abort"
-            "バージョン情報",                              // 54="About"
-            "加速から減速",                                // 55="Accel to Decel"
-            "加速から減速の制限値 (mm/s²)", // 56="Acceleration to deceleration limit (mm/s²)"
-            "加速度センサー",               // 57="Accelerometers"
-            "承認",                         // 58="Accept"
-            "対応が必要です",               // 59="Action Required"
-            "アクション",                   // 60="Actions"
-            "アクティブ",                   // 61="Active"
-            "実際",                         // 62="Actual"
-            "非公開ネットワークを追加",     // 63="Add Hidden Network"
-            "画面の明るさを調整します",     // 64="Adjust screen brightness level"
-            "ネジを調整して、再度プローブしてください。", // 65="Adjust screws, then re-probe."
-            "調整は再起動まで有効です。印刷完了後に保存してください。", // 66="Adjustments stay
-                                                                        // active until restart.
-                                                                        // Save after print
-                                                                        // completes."
-            "詳細設定",                                                 // 67="Advanced Setting"
-            "すべて",                                                   // 68="All"
-            "すべてのネジが許容範囲内です。",               // 69="All screws are within tolerance."
-            "Allwinner",                                    // 70="Allwinner"
-            "量:",                                          // 71="Amount:"
-            "プリンターで加速度センサーが検出されました。", // 72="An accelerometer was detected on
-                                                            // your printer."
-            "キャリブレーション中にエラーが発生しました。", // 73="An error occurred during
-                                                            // calibration."
-            "プローブ中にエラーが発生しました。", // 74="An error occurred during probing."
-            "フィラメントの装填中にエラーが発生しました。", // 75="An error occurred while loading
-                                                            // filament."
-            "アニメーション",                               // 76="Animations"
-            "アプリ背景",                                   // 77="App Background"
-            "適用",                                         // 78="Apply"
-            "変更を適用",                                   // 79="Apply Changes"
-            "このセッションのみに適用して保存", // 80="Apply saves for this session only"
-            "適用中...",                        // 81="Applying..."
-            "この印刷をキャンセルしますか？すべての進行状況が失われます。", // 82="Are you sure you
-                                                                            // want to cancel this
-                                                                            // print? All progress
-                                                                            // will be lost."
-            "スプールを割り当て",                                           // 83="Assign Spool"
-            "センサー監視を有効にするには役割を割り当ててください", // 84="Assign a role to enable
-                                                                    // sensor monitoring"
-            "スロット1に割り当て中",                                // 85="Assigning to Slot 1"
-            "自動",                                                 // 86="Auto"
-            "自動ベッドメッシュ",                                   // 87="Auto Bed Mesh"
-            "装填時に自動加熱",                                     // 88="Auto-Heat on Load"
-            "自動プローブまたは手動でネジの高さを確認",  // 89="Auto-probe or manually check screw
-                                                         // heights"
-            "動画を自動レンダリング",                    // 90="Auto-render video"
-            "自動PIDキャリブレーション",                 // 91="Automatic PID Calibration"
-            "Spoolman から重量更新を自動的にポーリング", // 92="Automatically poll Spoolman for
-                                                         // weight updates"
-            "利用可能なネットワーク",                    // 93="Available Networks"
-            "利用可能なネットワーク",                    // 94="Available networks"
-            "戻る",                                      // 95="Back"
-            "バックアップ",                              // 96="Backup"
-            "ベッド",                                    // 97="Bed"
-            "ベッドヒーター",                            // 98="Bed Heater"
-            "ベッドレベル",                              // 99="Bed Level"
-            "ベッドレベリング",                          // 100="Bed Leveling"
-            "ベッドメッシュ",                            // 101="Bed Mesh"
-            "ベッドメッシュ描画",                        // 102="Bed Mesh Render"
-            "ベッドネジ調整",                            // 103="Bed Screw Adjustment"
-            "ベッドネジ",                                // 104="Bed Screws"
-            "ベッドが水平です！",                        // 105="Bed is Level!"
-            "ベッド °C",                                 // 106="Bed °C"
-            "ベッド:",                                   // 107="Bed:"
-            "ブラック",                                  // 108="Black"
-            "Bluetooth",                                 // 109="Bluetooth"
-            "本文テキストは読みやすさを保ちながら、より長い説明をサポートします。", // 110="Body
-                                                                                    // text supports
-                                                                                    // longer
-                                                                                    // guidance
-                                                                                    // while staying
-                                                                                    // readable."
-            "境界線の不透明度",                        // 111="Border Opacity"
-            "角の丸み",                                // 112="Border Radius"
-            "境界線の幅",                              // 113="Border Width"
-            "境界線の透明度 (0 = 透明、255 = 不透明)", // 114="Border transparency (0 = invisible,
-                                                       // 255 = solid)"
-            "明るさ",                                  // 115="Brightness"
-            "参照",                                    // 116="Browse"
-            "ビジー",                                  // 117="Busy"
-            "バイパス",                                // 118="Bypass"
-            "バイパスモード",                          // 119="Bypass Mode"
-            "キャリブレーション",                      // 120="CALIBRATION"
-            "前回のセッションから変更",                // 121="CHANGED FROM LAST SESSION"
-            "必要な色",                                // 122="COLORS REQUIRED"
-            "重大",                                    // 123="CRITICAL"
-            "キャリブレート",                          // 124="Calibrate"
-            "X軸をキャリブレート",                     // 125="Calibrate X"
-            "Y軸をキャリブレート",                     // 126="Calibrate Y"
-            "共振補正をキャリブレート",                // 127="Calibrate resonance compensation"
-            "キャリブレーション中...",                 // 128="Calibrating..."
-            "キャリブレーション",                      // 129="Calibration"
-            "キャリブレーションとツール",              // 130="Calibration & Tools"
-            "キャリブレーションとツール",              // 131="Calibration &amp; Tools"
-            "キャリブレーション完了！",                // 132="Calibration Complete!"
-            "キャリブレーション失敗",                  // 133="Calibration Failed"
-            "キャンセル",                              // 134="Cancel"
-            "印刷をキャンセル",                        // 135="Cancel Print"
-            "キャンセル済み",                          // 136="Cancelled"
-            "チャンバー",                              // 137="Chamber"
-            "チャンバーファン",                        // 138="Chamber Fan"
-            "チャンバーとドライヤーの湿度監視", // 139="Chamber and dryer humidity monitoring"
-            "チャンバー:",                      // 140="Chamber:"
-            "変更は即座に適用されます。印刷中に調整して最適化できます。", // 141="Changes apply
-                                                                          // immediately. Adjust
-                                                                          // during print for
-                                                                          // tuning."
-            "変更は一時的で、プリンター再起動時にリセットされます", // 142="Changes are temporary
-                                                                    // and reset on printer reboot"
-            "フィラメント経路を確認して、もう一度お試しください。", // 143="Check the filament path
-                                                                    // and try again."
-            "スロットを確認中...",                                  // 144="Checking slots..."
-            "12時間表示または24時間表示を選択",     // 145="Choose 12-hour or 24-hour time display"
-            "表示言語を選択",                       // 146="Choose display language"
-            "印刷中のフレームキャプチャ方法を選択", // 147="Choose how frames are captured during
-                                                    // printing"
-            "G-codeの視覚化レンダリングモードを選択", // 148="Choose rendering mode for G-code
-                                                      // visualization"
-            "ベッドメッシュの視覚化レンダリングモードを選択", // 149="Choose rendering mode for bed
-                                                              // mesh visualization"
-            "ノズル清掃",                                     // 150="Clean Nozzle"
-            "クリア",                                         // 151="Clear"
-            "すべてクリア",                                   // 152="Clear All"
-            "割り当てを解除",                                 // 153="Clear Assignment"
-            "クリップボード利用不可 - SSHを使用してください", // 154="Clipboard unavailable - use
-                                                              // SSH"
-            "閉じる",                                         // 155="Close"
-            "近い = より圧縮 | 遠い = 圧縮少なめ", // 156="Closer = more squish | Farther = less
-                                                   // squish"
-            "カラーセンサー",                      // 157="Color Sensors"
-            "完了",                                // 158="Complete"
-            "完了",                                // 159="Completed"
-            "3回のプローブで完了",                 // 160="Completed in 3 probes"
-            "設定で定義済み（読み取り専用）",      // 161="Config-defined (read-only)"
-            "G10/G11 ファームウェアリトラクションを設定", // 162="Configure G10/G11 firmware
-                                                          // retraction"
-            "PRINT_START を設定",                         // 163="Configure PRINT_START"
-            "Spoolman 連携と重量同期設定を行います。",    // 164="Configure Spoolman integration and
-                                                          // weight sync settings."
-            "Moonraker でデバイスを設定",                 // 165="Configure devices in Moonraker"
-            "フィラメント検出センサーを設定",   // 166="Configure filament detection sensors"
-            "クイックボタンと標準マクロを設定", // 167="Configure quick buttons and standard macros"
-            "タイムラプス録画を設定",           // 168="Configure timelapse recording"
-            "接続",                             // 169="Connect"
-            "接続済み",                         // 170="Connected"
-            "接続中",                           // 171="Connecting"
-            "ネットワークに接続中...",          // 172="Connecting to network..."
-            "接続中...",                        // 173="Connecting..."
-            "接続",                             // 174="Connection"
-            "接続に失敗しました。パスワードを確認してください。", // 175="Connection failed. Check
-                                                                  // password."
-            "続行するには接続テストに成功する必要があります",     // 176="Connection must be tested
-                                                                  // successfully to continue"
-            "コンソール",                                         // 177="Console"
-            "オプションの印刷開始機能を制御",         // 178="Control optional print start features"
-            "冷却",                                   // 179="Cool Down"
-            "冷却",                                   // 180="Cooldown"
-            "冷却中",                                 // 181="Cooling"
-            "コマンドをコピー",                       // 182="Copy Command"
-            "角の丸み (0 = 鋭い、40 = 非常に丸い)",   // 183="Corner roundness (0 = sharp, 40 = very
-                                                      // round)"
-            "印刷完了時に動画を作成",                 // 184="Create video when print completes"
-            "現在 / 目標",                            // 185="Current / Target"
-            "現在のメッシュ",                         // 186="Current Mesh"
-            "現在の温度",                             // 187="Current Temperature"
-            "現在のZ位置",                            // 188="Current Z Position"
-            "現在の名前:",                            // 189="Current name:"
-            "現在装填中",                             // 190="Currently Loaded"
-            "印刷中",                                 // 191="Currently printing"
-            "カスタム...",                            // 192="Custom..."
-            "フィラメントを切断中...",                // 193="Cutting filament..."
-            "診断",                                   // 194="DIAGNOSTICS"
-            "無効",                                   // 195="DISABLED"
-            "危険",                                   // 196="Danger"
-            "ダークモード",                           // 197="Dark Mode"
-            "日",                                     // 198="Day"
-            "デフォルト (value=50)",                  // 199="Default (value=50)"
-            "デフォルトの境界線の太さ",               // 200="Default border thickness"
-            "printer.cfg でマクロを定義してください", // 201="Define macros in your printer.cfg"
-            "削除",                                   // 202="Delete"
-            "差分:",                                  // 203="Delta:"
-            "Deutsch",                                // 204="Deutsch"
-            "デバイス操作",                           // 205="Device Operations"
-            "無効化",                                 // 206="Disable"
-            "検出されたプリンター",                   // 207="Discovered Printers"
-            "閉じる",                                 // 208="Dismiss"
-            "ディスプレイ",                           // 209="Display"
-            "ディスプレイ設定",                       // 210="Display Settings"
-            "ディスプレイスリープ",                   // 211="Display Sleep"
-            "保存しない",                             // 212="Don't Save"
-            "今後表示しない",                         // 213="Don't ask again"
-            "完了",                                   // 214="Done"
-            "影の強さ (0 = 無効)",                    // 215="Drop shadow strength (0 = disabled)"
-            "ドライヤー",                             // 216="Dryer"
-            "ドライヤー制御",                         // 217="Dryer Control"
-            "時間",                                   // 218="Duration"
-            "緊急停止",                               // 219="E-Stop"
-            "緊急停止の確認",                         // 220="E-Stop Confirmation"
-            "緊急コントロール",                       // 221="EMERGENCY CONTROLS"
-            "緊急停止",                               // 222="EMERGENCY STOP"
-            "各ファンは一度のみ選択できます",         // 223="Each fan can only be selected once"
-            "編集",                                   // 224="Edit"
-            "プリセットを編集",                       // 225="Edit Preset"
-            "スロット1を編集",                        // 226="Edit Slot 1"
-            "テーマカラーを編集",                     // 227="Edit Theme Colors"
-            "テーマカラーを編集（変更済み）",         // 228="Edit Theme Colors (Modified)"
-            "経過",                                   // 229="Elapsed"
-            "緊急停止",                               // 230="Emergency Stop"
-            "緊急停止 (M112)",                        // 231="Emergency Stop (M112)"
-            "緊急停止しますか？",                     // 232="Emergency Stop?"
-            "空",                                     // 233="Empty"
-            "空のスロットは関連機能を無効にします",   // 234="Empty slots disable the associated
-                                                      // functionality"
-            "有効化",                                 // 235="Enable"
-            "監視を有効化",                           // 236="Enable Monitoring"
-            "リトラクションを有効化",                 // 237="Enable Retraction"
-            "タイムラプスを有効化",                   // 238="Enable Timelapse"
-            "UIモーションエフェクトを有効化",         // 239="Enable UI motion effects"
-            "WiFi を有効にしてスキャン",              // 240="Enable WiFi to scan"
-            "WiFi を有効にしてネットワークをスキャン",    // 241="Enable WiFi to scan for networks"
-            "音声フィードバックを有効化",                 // 242="Enable audio feedback"
-            "詳細な印刷準備トラッキングを有効化（推奨）", // 243="Enable detailed print preparation
-                                                          // tracking (Recommended)"
-            "有効",                                       // 244="Enabled"
-            "終了",                                       // 245="Ended"
-            "English",                                    // 246="English"
-            "改善完了！",                                 // 247="Enhancement Complete!"
-            "改善失敗",                                   // 248="Enhancement Failed"
-            "G-code コマンドを入力...",                   // 249="Enter G-code command..."
-            "WiFi パスワードを入力",                      // 250="Enter WiFi Password"
-            "カスタムテーマの名前を入力してください:", // 251="Enter a name for your custom theme:"
-            "このプロファイルを保存する名前を入力",    // 252="Enter a name to save this profile"
-            "ネットワーク名を入力",                    // 253="Enter network name"
-            "パスワードを入力",                        // 254="Enter password"
-            "エラー",                                  // 255="Error"
-            "エラー状態",                              // 256="Error state"
-            "Español",                                 // 257="Español"
-            "イーサネット",                            // 258="Ethernet"
-            "除外",                                    // 259="Exclude"
-            "プリンターマクロを実行",                  // 260="Execute printer macros"
-            "排気ファン",                              // 261="Exhaust Fan"
-            "選択したパレットがテキスト、コントロール、ステータスカラーにどのように影響するかを確認"
-            "できます。", // 262="Explore how the selected palette shapes text, controls, and status
-                          // colors."
-            "パレットを確認してプレビュー",             // 263="Explore palette and preview"
-            "滲み出しを補正するための追加プライム",     // 264="Extra prime to compensate ooze"
-            "押し出し",                                 // 265="Extrude"
-            "押し出し / 引き戻し",                      // 266="Extrude / Retract"
-            "エクストルーダー",                         // 267="Extruder"
-            "エクストルーダー PID チューニング",        // 268="Extruder PID Tuning"
-            "素材に基づいてエクストルーダーが自動加熱", // 269="Extruder heats automatically based
-                                                        // on material"
-            "押し出し速度",                             // 270="Extrusion rate"
-            "失敗",                                     // 271="FAILED"
-            "フィラメント",                             // 272="FILAMENT"
-            "工場出荷時リセット",                       // 273="Factory Reset"
-            "失敗",                                     // 274="Failed"
-            "テーマファイルの保存に失敗しました",       // 275="Failed to save theme file"
-            "フィラメントをエクストルーダーに直接供給", // 276="Feed filament directly to extruder"
-            "フィラメント",                             // 277="Filament"
-            "フィラメントセンサー",                     // 278="Filament Sensor"
-            "フィラメントセンサー",                     // 279="Filament Sensors"
-            "使用済みフィラメント",                     // 280="Filament Used"
-            "種類別フィラメント",                       // 281="Filament by Type"
-            "フロー補正用フィラメント直径センサー",     // 282="Filament diameter sensors for flow
-                                                        // compensation"
-            "フィラメント切れとモーション検出センサー", // 283="Filament runout and motion detection
-                                                        // sensors"
-            "フィラメント追跡と在庫管理",               // 284="Filament tracking and inventory"
-            "ファイル",                                 // 285="File"
-            "ファイル情報",                             // 286="File Info"
-            "ファイル名",                               // 287="Filename"
-            "ファイル",                                 // 288="Files"
-            "塗りつぶし: 100% / 75% / 40% / 10%",       // 289="Fill: 100% / 75% / 40% / 10%"
-            "ファームウェア再起動",                     // 290="Firmware Restart"
-            "同心円リング（既存の ams_slot）", // 291="Flat Concentric Rings (existing ams_slot)"
-            "フローレート",                    // 292="Flow Rate"
-            "チップを形成中...",               // 293="Forming tip..."
-            "フレームレート",                  // 294="Framerate"
-            "Français",                        // 295="Français"
-            "周波数",                          // 296="Freq"
-            "正面",                            // 297="Front"
-            "G-code コンソール",               // 298="G-code Console"
-            "G-code プレビュー",               // 299="G-code Preview"
-            "G-code コマンドがここに表示されます", // 300="G-code commands will appear here"
-            "Ghost:",                              // 301="Ghost:"
-            "グレー",                              // 302="Gray"
-            "Happy Hare MMU",                      // 303="Happy Hare MMU"
-            "ハードウェア",                        // 304="Hardware"
-            "ハードウェア状態",                    // 305="Hardware Health"
-            "ハードウェアの問題",                  // 306="Hardware Issues"
-            "ハードウェア名",                      // 307="Hardware Name"
-            "ハードウェアは起動時と再接続時に検証されます", // 308="Hardware is validated on startup
-                                                            // and reconnection"
-            "開始前に紙を用意してください。", // 309="Have a piece of paper ready before starting."
-            "ベッドがサムホイールなどの内蔵機構で調整できない場合は、ベッド調整ツール（ドライバー、"
-            "六角レンチなど）を用意してください。", // 310="Have your bed adjustment tool
-                                                    // (screwdriver, hex-key, etc.) ready if your
-                                                    // bed isn't adjusted with thumb wheels or some
-                                                    // other built-in mechanism."
-            "見出し",                                // 311="Heading"
-            "ヒートソーク",                          // 312="Heat Soak"
-            "押し出しには170°Cまで加熱してください", // 313="Heat to 170°C to extrude"
-            "ヒートベッド温度",                      // 314="Heatbed Temperature"
-            "加熱ベッド",                            // 315="Heated Bed"
-            "加熱中...",                             // 316="Heating..."
-            "HelixScreen がクラッシュしました",      // 317="HelixScreen Crashed"
-            "HelixScreen "
-            "はマルチスプール/カラー印刷操作のためにフィラメントチェンジャーと連携します。", // 318="HelixScreen
-                                                                                             // will
-                                                                                             // integrate
-                                                                                             // with
-                                                                                             // your
-                                                                                             // filament
-                                                                                             // changer
-                                                                                             // for
-                                                                                             // multi-spool/color
-                                                                                             // print
-                                                                                             // operations."
-            "高い = 速い",                            // 319="Higher = faster"
-            "ホーム",                                 // 320="Home"
-            "全軸ホーム",                             // 321="Home All"
-            "X軸ホーム",                              // 322="Home X"
-            "Y軸ホーム",                              // 323="Home Y"
-            "Z軸ホーム",                              // 324="Home Z"
-            "水平プログレス（レベリングウィザード）", // 325="Horizontal Progress (Leveling Wizard)"
-            "ホスト",                                 // 326="Host"
-            "ホットエンド",                           // 327="Hotend"
-            "ホットエンドファン",                     // 328="Hotend Fan"
-            "ホットエンドヒーター",                   // 329="Hotend Heater"
-            "Spoolman の重量更新をチェックする頻度",  // 330="How often to check Spoolman for weight
-                                                      // updates"
-            "湿度",                                   // 331="Humidity"
-            "湿度センサー",                           // 332="Humidity Sensors"
-            "IP:",                                    // 333="IP:"
-            "アイドル",                               // 334="Idle"
-            "無視",                                   // 335="Ignore"
-            "進行中",                                 // 336="In Progress"
-            "G-codeをインデックス中...",              // 337="Indexing G-code..."
-            "初期化中...",                            // 338="Initializing..."
-            "入力",                                   // 339="Input"
-            "インプットシェーパー",                   // 340="Input Shaper"
-            "インプットシェーピング",                 // 341="Input Shaping"
-            "インプットシェーパーキャリブレーションセンサー", // 342="Input shaper calibration
-                                                              // sensors"
-            "インプットシェーピングは印刷物の振動アーティファクト（リンギング）を軽減します。", // 343="Input shaping reduces vibration artifacts (ringing) in your prints."
-            "HelixPrint プラグインをインストール", // 344="Install HelixPrint Plugin"
-            "プラグインをインストール",            // 345="Install Plugin"
-            "高速 G-code 修正を有効にするために HelixPrint "
-            "プラグインをインストールしてください。プリンターで SSH "
-            "経由でこのコマンドを実行してください:", // 346="Install the HelixPrint plugin to enable
-                                                     // fast G-code modifications. Run this command
-                                                     // via SSH on your printer:"
-            "インストール失敗",                      // 347="Installation Failed"
-            "インストールには約30秒かかります。",    // 348="Installation takes about 30 seconds."
-            "インストール中...",                     // 349="Installing..."
-            "強度",                                  // 350="Intensity"
-            "印刷中のインタラクティブ 3D G-code",    // 351="Interactive 3D G-code during prints"
-            "インタラクティブプローブキャリブレーション", // 352="Interactive probe calibration"
-            "問題の説明",                                 // 353="Issue description"
-            "Italiano",                                   // 354="Italiano"
-            "たった今",                                   // 355="Just now"
-            "Kd:",                                        // 356="Kd:"
-            "印刷を続行",                                 // 357="Keep Printing"
-            "必須を維持",                                 // 358="Keep Required"
-            "キーボードテスト（Gboard風）",               // 359="Keyboard Test (Gboard-style)"
-            "Ki:",                                        // 360="Ki:"
-            "Klipper",                                    // 361="Klipper"
-            "Klipper "
-            "がシャットダウン状態になりました。緊急停止、熱暴走、または設定エラーが原因の可能性があ"
-            "ります。", // 362="Klipper has entered shutdown state. This may be due to an emergency
-                        // stop, thermal runaway, or configuration error."
-            "変更を適用するために Klipper が再起動します",   // 363="Klipper will restart to apply
-                                                             // changes"
-            "変更を適用するために Klipper が再起動します。", // 364="Klipper will restart to apply
-                                                             // changes."
-            "新しい PID 値を適用するために Klipper が再起動します。", // 365="Klipper will restart
-                                                                      // to apply new PID values."
-            "Kp:",                                                    // 366="Kp:"
-            "LEDストリップ",                                          // 367="LED Strip"
-            "起動時LED点灯",                                          // 368="LED on at Start"
-            "装填済み",                                               // 369="LOADED"
-            "言語",                                                   // 370="Language"
-            "過去7日間",                                              // 371="Last 7 days"
-            "前回の印刷がキャンセルされました",                       // 372="Last print cancelled"
-            "前回の印刷が失敗しました",                               // 373="Last print failed"
-            "後で",                                                   // 374="Later"
-            "レイヤー",                                               // 375="Layer"
-            "レイヤー高さ",                                           // 376="Layer Height"
-            "レイヤーモードはレイヤー変更ごとに1フレームをキャプチャします。ほとんどの印刷に最適で"
-            "す。", // 377="Layer mode captures one frame per layer change. Best for most prints."
-            "レイヤー:",                                   // 378="Layer:"
-            "レイヤー",                                    // 379="Layers"
-            "長さ:",                                       // 380="Length:"
-            "ライト",                                      // 381="Light"
-            "装填",                                        // 382="Load"
-            "フィラメントを装填",                          // 383="Load Filament"
-            "装填済み",                                    // 384="Loaded"
-            "装填エラー",                                  // 385="Loading Error"
-            "G-codeを読み込み中...",                       // 386="Loading G-code..."
-            "フィラメントを装填中...",                     // 387="Loading filament..."
-            "履歴を読み込み中...",                         // 388="Loading history..."
-            "スプールを読み込み中...",                     // 389="Loading spools..."
-            "読み込み中...",                               // 390="Loading..."
-            "印刷中はロックされています",                  // 391="Locked during print"
-            "M で切り替え",                                // 392="M to toggle"
-            "MAC:",                                        // 393="MAC:"
-            "MDI アイコン",                                // 394="MDI Icons"
-            "設定済みが見つかりません",                    // 395="MISSING CONFIGURED"
-            "動作",                                        // 396="MOTION"
-            "機械制限",                                    // 397="Machine Limits"
-            "マクロブラウザ",                              // 398="Macro Browser"
-            "マクロボタン",                                // 399="Macro Buttons"
-            "ベッドメッシュキャリブレーション用マクロ",    // 400="Macro for bed mesh calibration"
-            "チャンバー/ベッドヒートソーク用マクロ",       // 401="Macro for chamber/bed heat soak"
-            "物理的ベッドレベリング用マクロ (QGL/Z-Tilt)", // 402="Macro for physical bed leveling
-                                                           // (QGL/Z-Tilt)"
-            "アクティブな印刷をキャンセルするマクロ",      // 403="Macro to cancel an active print"
-            "ノズルを清掃/ワイプするマクロ",               // 404="Macro to clean/wipe the nozzle"
-            "フィラメントをエクストルーダーに装填するマクロ", // 405="Macro to load filament into
-                                                              // extruder"
-            "アクティブな印刷を一時停止するマクロ", // 406="Macro to pause an active print"
-            "ノズルをパージ/プライムするマクロ",    // 407="Macro to purge/prime the nozzle"
-            "一時停止した印刷を再開するマクロ",     // 408="Macro to resume a paused print"
-            "エクストルーダーからフィラメントを排出するマクロ", // 409="Macro to unload filament
-                                                                // from extruder"
-            "マクロ",                                           // 410="Macros"
-            "メインLEDストリップ",                              // 411="Main LED Strip"
-            "オプションにする",                                 // 412="Make Optional"
-            "ベッドメッシュと QGL をスキップ可能にする", // 413="Make bed mesh and QGL skippable"
-            "管理",                                      // 414="Manage"
-            "手動ベッドレベリング",                      // 415="Manual Bed Leveling"
-            "素材",                                      // 416="Material"
-            "マテリアルデザインスピナー",                // 417="Material Design Spinner"
-            "最大加速度",                                // 418="Max Acceleration"
-            "最大速度",                                  // 419="Max Velocity"
-            "最大Z加速度",                               // 420="Max Z Accel"
-            "最大Z速度",                                 // 421="Max Z Velocity"
-            "コーナー通過時の最大速度 (mm/s)",           // 422="Max speed through corners (mm/s)"
-            "最大加速度 (mm/s²)",                        // 423="Maximum acceleration (mm/s²)"
-            "ツールヘッドの最大速度 (mm/s)",             // 424="Maximum toolhead speed (mm/s)"
-            "ノイズ測定",                                // 425="Measure Noise"
-            "メモリ (MB)",                               // 426="Memory (MB)"
-            "メッシュ完了",                              // 427="Mesh Complete"
-            "モード",                                    // 428="Mode"
-            "変更日時",                                  // 429="Modified"
-            "月",                                        // 430="Month"
-            "Moonraker",                                 // 431="Moonraker"
-            "動作",                                      // 432="Motion"
-            "動作: XYZ",                                 // 433="Motion: XYZ"
-            "モーターオフ",                              // 434="Motors Off"
-            "移動",                                      // 435="Move"
-            "調整中は紙を前後に動かしてください。紙がわずかに引っかかりながらも滑る状態で止めてくだ"
-            "さい。",   // 436="Move paper back and forth while adjusting. Stop when paper catches
-                        // slightly but still slides."
-            "移動速度", // 437="Movement speed"
-            "マルチフィラメント",                 // 438="Multi-Filament"
-            "マルチマテリアル",                   // 439="Multi-Material"
-            "マイカスタムテーマ",                 // 440="My Custom Theme"
-            "マイパネル",                         // 441="My Panel"
-            "マイプリンター",                     // 442="My Printer"
-            "新規検出",                           // 443="NEWLY DISCOVERED"
-            "通知",                               // 444="NOTIFICATIONS"
-            "名前",                               // 445="Name"
-            "ネットワークアドレス",               // 446="Network Address"
-            "ネットワーク名",                     // 447="Network Name"
-            "ネットワーク名 (SSID)",              // 448="Network Name (SSID)"
-            "ネットワーク設定",                   // 449="Network Settings"
-            "ネットワークテスト",                 // 450="Network Test"
-            "なし",                               // 451="Never"
-            "新しい PID 値",                      // 452="New PID Values"
-            "新しい Z-Offset: 0.000",             // 453="New Z-Offset: 0.000"
-            "新しいプロファイル名",               // 454="New profile name"
-            "次へ",                               // 455="Next"
-            "AMS システムが接続されていません。", // 456="No AMS system connected."
-            "履歴なし",                           // 457="No History"
-            "マクロが見つかりません",             // 458="No Macros Found"
-            "電源デバイスなし",                   // 459="No Power Devices"
-            "スプールなし",                       // 460="No Spools"
-            "ファイルが読み込まれていません",     // 461="No file loaded"
-            "印刷可能なファイルがありません",     // 462="No files available for printing"
-            "メッシュが読み込まれていません",     // 463="No mesh loaded"
-            "ネットワークが見つかりません",       // 464="No networks found"
-            "通知なし",                           // 465="No notifications"
-            "プラグインが見つかりません",         // 466="No plugins found"
-            "プレビューなし",                     // 467="No preview"
-            "印刷履歴がありません",               // 468="No print history yet"
-            "印刷開始マクロが見つかりません",     // 469="No print start macro found"
-            "利用可能なプロファイルがありません", // 470="No profiles available"
-            "センサーが検出されませんでした",     // 471="No sensors detected"
-            "利用可能なスプールがありません",     // 472="No spools available"
-            "今はしない",                         // 473="Not Now"
-            "未接続",                             // 474="Not connected"
-            "通知",                               // 475="Notifications"
-            "印刷完了時に通知",                   // 476="Notify when print finishes"
-            "ノズル",                             // 477="Nozzle"
-            "ノズルプライミング",                 // 478="Nozzle Priming"
-            "ノズル温度",                         // 479="Nozzle Temp"
-            "ノズル温度",                         // 480="Nozzle Temperature"
-            "ノズル °C",                          // 481="Nozzle °C"
-            "ノズル:",                            // 482="Nozzle:"
-            "OK",                                 // 483="OK"
-            "オフ",                               // 484="Off"
-            "オフライン",                         // 485="Offline"
-            "オン",                               // 486="On"
-            "開く",                               // 487="Open"
-            "操作",                               // 488="Operations"
-            "印刷を最適化",                       // 489="Optimize Your Printing"
-            "または手動で入力",                   // 490="Or Enter Manually"
-            "PETG",                               // 491="PETG"
-            "PID チューニング",                   // 492="PID Tuning"
-            "PID チューニングは安定した加熱のために温度制御を最適化します。", // 493="PID tuning
-                                                                              // optimizes
-                                                                              // temperature control
-                                                                              // for stable
-                                                                              // heating."
-            "PLA",                                                            // 494="PLA"
-            "PLA - ブラック",                                                 // 495="PLA - Black"
-            "印刷前の手順",                 // 496="PRE-PRINT STEPS"
-            "プリンター",                   // 497="PRINTER"
-            "紙テストキャリブレーション",   // 498="Paper Test Calibration"
-            "パーツ冷却ファン",             // 499="Part Cooling Fan"
-            "パーツファン",                 // 500="Part Fan"
-            "パスワード",                   // 501="Password"
-            "パスワードを入力してください", // 502="Password cannot be empty"
-            "一時停止",                     // 503="Pause"
-            "一時停止",                     // 504="Paused"
-            "一時停止（対応が必要）",       // 505="Paused (attention needed)"
-            "ピーク:",                      // 506="Peak:"
-            "フェーズトラッキング",         // 507="Phase Tracking"
-            "色を選択",                     // 508="Pick Color"
-            "HelixScreen を拡張するには、プラグインディレクトリにプラグインを配置してください", // 509="Place plugins in the plugins directory to extend HelixScreen"
-            "テーマ名を入力してください", // 510="Please enter a theme name"
-            "プリンターがホーミングとプローブを行う間お待ちください。", // 511="Please wait while
-                                                                        // the printer homes and
-                                                                        // probes."
-            "プリンターが各ネジ位置をプローブする間お待ちください。", // 512="Please wait while the
-                                                                      // printer probes each screw
-                                                                      // position."
-            "プラグインが正常にインストールされました。", // 513="Plugin installed successfully."
-            "プラグイン",                                 // 514="Plugins"
-            "プラグインはアプリケーション起動時に検出されます", // 515="Plugins are discovered on
-                                                                // application startup"
-            "Polymaker",                                        // 516="Polymaker"
-            "ポート",                                           // 517="Port"
-            "Português",                                        // 518="Português"
-            "位置",                                             // 519="Position"
-            "電源",                                             // 520="Power"
-            "電源制御",                                         // 521="Power Control"
-            "予熱",                                             // 522="Preheat"
-            "印刷準備中",                                       // 523="Preparing Print"
-            "準備中...",                                        // 524="Preparing..."
-            "プリセット",                                       // 525="Presets"
-            "前へ",                                             // 526="Previous"
-            "プライマリ",                                       // 527="Primary"
-            "印刷",                                             // 528="Print"
-            "印刷キャンセル",                                   // 529="Print Cancelled"
-            "印刷完了",                                         // 530="Print Complete"
-            "印刷完了！",                                       // 531="Print Complete!"
-            "印刷完了通知",                                     // 532="Print Completion Alert"
-            "印刷詳細",                                         // 533="Print Details"
-            "印刷ファイル",                                     // 534="Print File"
-            "印刷ファイル",                                     // 535="Print Files"
-            "印刷履歴",                                         // 536="Print History"
-            "印刷時間",                                         // 537="Print Hours"
-            "印刷速度",                                         // 538="Print Speed"
-            "印刷ステータス",                                   // 539="Print Status"
-            "印刷時間",                                         // 540="Print Time"
-            "印刷チューニング",                                 // 541="Print Tuning"
-            "プリンター",                                       // 542="Printer"
-            "プリンター名",                                     // 543="Printer Name"
-            "プリンターシャットダウン",                         // 544="Printer Shutdown"
-            "プリンタータイプ",                                 // 545="Printer Type"
-            "印刷中",                                           // 546="Printing"
-            "印刷傾向",                                         // 547="Prints Trend"
-            "プライベート:",                                    // 548="Private:"
-            "プローブ",                                         // 549="Probe"
-            "プローブセンサー",                                 // 550="Probe Sensor"
-            "プローブセンサー",                                 // 551="Probe Sensors"
-            "ベッドメッシュをプローブ中",                       // 552="Probing Bed Mesh"
-            "ベッドネジをプローブ中...",                        // 553="Probing Bed Screws..."
-            "ベッドをプローブ中...",                            // 554="Probing Bed..."
-            "プローブ失敗",                                     // 555="Probing Failed"
-            "処理中...",                                        // 556="Processing..."
-            "プロファイル",                                     // 557="Profile"
-            "プロファイル名（例: default）",                // 558="Profile name (e.g., default)"
-            "プロファイル",                                 // 559="Profiles"
-            "進捗",                                         // 560="Progress"
-            "プログレスバーテスト",                         // 561="Progress Bar Tests"
-            "パージ",                                       // 562="Purge"
-            "50mm パージ",                                  // 563="Purge 50mm"
-            "クイックボタン",                               // 564="QUICK BUTTONS"
-            "クアッドガントリーレベル",                     // 565="Quad Gantry Level"
-            "クイックアクション",                           // 566="Quick Actions"
-            "クイックボタン1",                              // 567="Quick Button 1"
-            "クイックボタン2",                              // 568="Quick Button 2"
-            "クイックアクション、キャリブレーション、速度", // 569="Quick actions, calibration,
-                                                            // speed"
-            "RSS:",                                         // 570="RSS:"
-            "再プローブ",                                   // 571="Re-probe"
-            "準備完了",                                     // 572="Ready"
-            "推奨",                                         // 573="Recommended"
-            "推奨: エクストルーダーに200°C",                // 574="Recommended: 200°C for extruder"
-            "タイムラプスを録画",                           // 575="Record Timelapse"
-            "印刷のタイムラプスを録画",         // 576="Record timelapses of your prints"
-            "録画モード",                       // 577="Recording Mode"
-            "回復",                             // 578="Recover"
-            "リンギングを軽減",                 // 579="Reduce Ringing"
-            "更新",                             // 580="Refresh"
-            "更新間隔",                         // 581="Refresh Interval"
-            "残り",                             // 582="Remaining"
-            "プリンターからプラグインを削除",   // 583="Remove plugin from printer"
-            "名前を変更",                       // 584="Rename"
-            "メッシュプロファイルの名前を変更", // 585="Rename Mesh Profile"
-            "再印刷",                           // 586="Reprint"
-            "緊急停止前に確認を求める",         // 587="Require confirmation before emergency stop"
-            "Moonraker-Timelapse プラグインが必要です", // 588="Requires Moonraker-Timelapse plugin"
-            "リセット",                                 // 589="Reset"
-            "速度とフローを100%にリセット",             // 590="Reset Speed & Flow to 100%"
-            "速度とフローを100%にリセット",             // 591="Reset Speed &amp; Flow to 100%"
-            "すべての設定をリセットしてウィザードを再開", // 592="Reset all settings and restart
-                                                          // wizard"
-            "リセット中...",                              // 593="Resetting..."
-            "共振補正チューニング",                       // 594="Resonance compensation tuning"
-            "HelixScreen を再起動",                       // 595="Restart HelixScreen"
-            "Klipper を再起動",                           // 596="Restart Klipper"
-            "今すぐ再起動",                               // 597="Restart Now"
-            "再起動が必要です",                           // 598="Restart Required"
-            "ディスプレイアプリケーションを再起動",       // 599="Restart the display application"
-            "再開",                                       // 600="Resume"
-            "印刷を再開",                                 // 601="Resume Print"
-            "リトラクト",                                 // 602="Retract"
-            "リトラクト長",                               // 603="Retract Length"
-            "リトラクト速度",                             // 604="Retract Speed"
-            "リトラクション設定",                         // 605="Retraction Settings"
-            "再試行",                                     // 606="Retry"
-            "検出されたハードウェア検証の問題を確認", // 607="Review detected hardware validation
-                                                      // issues"
-            "変更を確認",                             // 608="Review your changes"
-            "役割:",                                  // 609="Role:"
-            "フィラメント切れセンサー",               // 610="Runout Sensor"
-            "標準マクロ",                             // 611="STANDARD MACROS"
-            "停止",                                   // 612="STOP"
-            "スタイルプロパティ",                     // 613="STYLE PROPERTIES"
-            "システム",                               // 614="SYSTEM"
-            "保存",                                   // 615="Save"
-            "保存して再起動",                         // 616="Save & Restart"
-            "保存して再起動",                         // 617="Save &amp; Restart"
-            "新規として保存",                         // 618="Save As New"
-            "設定を保存",                             // 619="Save Config"
-            "プリンター設定を保存",                   // 620="Save Printer Configuration"
-            "テーマを名前を付けて保存",               // 621="Save Theme As"
-            "Z-Offset を保存",                        // 622="Save Z-Offset"
-            "Z-Offset を保存しますか？",              // 623="Save Z-Offset?"
-            "再起動後も変更を保持するために保存しますか？", // 624="Save changes to persist them
-                                                            // across restarts?"
-            "設定を保存中...",                              // 625="Saving Configuration..."
-            "保存すると Klipper が再起動し、アクティブな印刷がキャンセルされます！", // 626="Saving
-                                                                                     // will restart
-                                                                                     // Klipper and
-                                                                                     // CANCEL any
-                                                                                     // active
-                                                                                     // print!"
-            "ネットワークをスキャン中...",                  // 627="Scanning for networks..."
-            "画面減光",                                     // 628="Screen Dim"
-            "一定時間操作がないと画面の明るさが下がります", // 629="Screen dims to lower brightness
-                                                            // after period of inactivity"
-            "選択した時間操作がないと画面が減光します", // 630="Screen will dim after the selected
-                                                        // period of inactivity"
-            "スクロール速度",                           // 631="Scroll Speed"
-            "ファイル名を検索...",                      // 632="Search filename..."
-            "セカンダリ",                               // 633="Secondary"
-            "セキュリティ",                             // 634="Security"
-            "選択",                                     // 635="Select"
-            "フィラメントセンサーがない場合、またはフィラメント切れで一時停止したくない場合は「なし"
-            "」を選択してください。", // 636="Select 'None' if you don't have a filament sensor, or
-                                      // if you don't want to pause on runout."
-            "専用プローブがある場合、またはベッドメッシュレベリングを使用しない場合は「なし」を選択"
-            "してください。", // 637="Select 'None' if you have a dedicated probe, or don't use bed
-                              // mesh leveling."
-            "フィラメントを選択",                   // 638="Select Filament"
-            "ファイルを選択",                       // 639="Select File"
-            "G-Codeファイルを選択",                 // 640="Select G-Code File"
-            "ヒーターを選択",                       // 641="Select Heater"
-            "最初のボタンのマクロを選択",           // 642="Select macro for first button"
-            "2番目のボタンのマクロを選択",          // 643="Select macro for second button"
-            "スロットを選択中...",                  // 644="Selecting slot..."
-            "セマンティックサイズパラメータテスト", // 645="Semantic Size Parameter Tests"
-            "プリンターに直接コマンドを送信",       // 646="Send commands directly to printer"
-            "センサー",                             // 647="Sensors"
-            "設定 ",                                // 648="Set "
-            "設定",                                 // 649="Settings"
-            "影の強度",                             // 650="Shadow Intensity"
-            "シェーパー",                           // 651="Shaper"
-            "光沢:",                                // 652="Shininess:"
-            "詳細な印刷準備ステータスを表示",       // 653="Show detailed print preparation status"
-            "側面",                                 // 654="Side"
-            "サイズ",                               // 655="Size"
-            "今はスキップ",                         // 656="Skip for now"
-            "スロット1",                            // 657="Slot 1"
-            "小さなラベルはコントロールを落ち着いた集中した状態に保ちます。", // 658="Small labels
-                                                                              // help keep controls
-                                                                              // calm and focused."
-            "一部の設定は再起動後に有効になります。", // 659="Some settings will take effect after
-                                                      // restart."
-            "サウンド",                               // 660="Sounds"
-            "スペキュラー:",                          // 661="Specular:"
-            "速度",                                   // 662="Speed"
-            "速度設定",                               // 663="Speed Settings"
-            "プライム動作の速度",                     // 664="Speed of prime movement"
-            "リトラクション動作の速度",               // 665="Speed of retraction movement"
-            "速度:",                                  // 666="Speed:"
-            "スプール可視化（疑似3Dキャンバス）", // 667="Spool Visualization (Pseudo-3D Canvas)"
-            "Spoolman",                           // 668="Spoolman"
-            "Spoolman にスプールが設定されていません", // 669="Spoolman has no spools configured"
-            "直角コーナー速度",                        // 670="Square Corner Velocity"
-            "スタンバイ",                              // 671="Standby"
-            "キャリブレーション開始",                  // 672="Start Calibration"
-            "プローブ開始",                            // 673="Start Probing"
-            "開始",                                    // 674="Started"
-            "ステータス",                              // 675="Status"
-            "ステータスアイコン",                      // 676="Status icons"
-            "ステップ",                                // 677="Step"
-            "ステッププログレスウィジェットテスト",    // 678="Step Progress Widget Test"
-            "停止",                                    // 679="Stop"
-            "乾燥を停止",                              // 680="Stop Drying"
-            "印刷を停止しますか？",                    // 681="Stop Print?"
-            "すべての動作を停止します。ファームウェアの再起動が必要です。", // 682="Stops all
-                                                                            // motion. Requires
-                                                                            // firmware restart."
-            "スタイル適用 (value=75)", // 683="Styled (value=75)"
-            "成功率",                  // 684="Success Rate"
-            "成功！",                  // 685="Success!"
-            "サーフェスはライトモードとダークモードのアプリ背景トークンを継承します。", // 686="Surfaces
-                                                                                        // inherit
-                                                                                        // app
-                                                                                        // background
-                                                                                        // tokens
-                                                                                        // for light
-                                                                                        // and dark
-                                                                                        // modes."
-            "センサーを切り替え",                   // 687="Switch Sensors"
-            "ライトテーマとダークテーマを切り替え", // 688="Switch between light and dark themes"
-            "Spoolman に同期",                      // 689="Sync to Spoolman"
-            "Spoolman と同期",                      // 690="Sync with Spoolman"
-            "Sysfs",                                // 691="Sysfs"
-            "システムを検出しました",               // 692="System detected"
-            "TD-1 フィラメント色検出",              // 693="TD-1 filament color detection"
-            "テーマカラー",                         // 694="THEME COLORS"
-            "TPU",                                  // 695="TPU"
-            "タップしてキーボードを表示...",        // 696="Tap to show keyboard..."
-            "目標",                                 // 697="Target"
-            "目標温度",                             // 698="Target Temperature"
-            "温度",                                 // 699="Temperature"
-            "温度",                                 // 700="Temperatures"
-            "コントロールパネルで保存しない限り、この印刷のみの一時的な調整です", // 701="Temporary
-                                                                                  // adjustment for
-                                                                                  // this print,
-                                                                                  // unless saved on
-                                                                                  // Controls panel"
-            "ターシャリ",                                                         // 702="Tertiary"
-            "接続テスト",         // 703="Test Connection"
-            "ネットワークテスト", // 704="Test Network"
-            "テスト印刷",         // 705="Test Print"
-            "HelixPrint "
-            "プラグインは、クイック再印刷のためのベッドメッシュスキップなど、プリンター上で直接高速"
-            " G-code 修正を可能にします。", // 706="The HelixPrint plugin enables fast G-code
-                                            // modifications directly on your printer—like skipping
-                                            // bed mesh for quick reprints."
-            "ヒーターは数回オン/オフを繰り返します。",  // 707="The heater will cycle on and off
-                                                        // several times."
-            "テーマ",                                   // 708="Theme"
-            "テーマカラー",                             // 709="Theme Colors"
-            "テーマプリセット",                         // 710="Theme Preset"
-            "テーマの変更は再起動後に適用されます。",   // 711="Theme changes apply after restart."
-            "テーマの変更は再起動後に有効になります。", // 712="Theme changes will take effect after
-                                                        // restart."
-            "テーマ、明るさ、スリープ設定", // 713="Theme, brightness, and sleep settings"
-            "細いバー (height=8)",          // 714="Thin bar (height=8)"
-            "このキャリブレーションは紙の摩擦方式を使用して Z-offset を設定します。", // 715="This
-                                                                                      // calibration
-                                                                                      // uses the
-                                                                                      // paper
-                                                                                      // friction
-                                                                                      // method to
-                                                                                      // set your
-                                                                                      // Z-offset."
-            "1〜2分かかる場合があります",   // 716="This may take 1-2 minutes"
-            "最大30秒かかる場合があります", // 717="This may take up to 30 seconds"
-            "このプラグインにより、HelixScreen がベッドメッシュや QGL "
-            "などの印刷開始オプションを制御できます。インストール後、以下の「PRINT_START "
-            "を設定」を使用してオプションの手順を有効にしてください。", // 718="This plugin lets
-                                                                        // HelixScreen control print
-                                                                        // start options like bed
-                                                                        // mesh and QGL. Once
-                                                                        // installed, use Configure
-                                                                        // PRINT_START below to
-                                                                        // enable optional steps."
-            "このプロセスは3〜5分かかります。中断しないでください。", // 719="This process takes 3-5
-                                                                      // minutes. Do not interrupt."
-            "このツールは各ベッドネジをプローブし、どのくらい調整が必要かを教えます。", // 720="This
-                                                                                        // tool
-                                                                                        // probes
-                                                                                        // each bed
-                                                                                        // screw and
-                                                                                        // tells you
-                                                                                        // how much
-                                                                                        // to
-                                                                                        // adjust."
-            "これはすべてのプリンター操作を直ちに停止します。再開するにはプリンターの再起動が必要で"
-            "す。", // 721="This will immediately halt all printer operations. The printer will
-                    // require a restart to resume."
-            "これはすべての設定をデフォルトにリセットします。この操作は元に戻せません。", // 722="This
-                                                                                          // will
-                                                                                          // reset
-                                                                                          // all
-                                                                                          // settings
-                                                                                          // to
-                                                                                          // defaults.
-                                                                                          // This
-                                                                                          // action
-                                                                                          // cannot
-                                                                                          // be
-                                                                                          // undone."
-            "これにより Klipper が再起動します。",          // 723="This will restart Klipper."
-            "時間",                                         // 724="Time"
-            "時間形式",                                     // 725="Time Format"
-            "タイムラプス",                                 // 726="Timelapse"
-            "タイムラプス利用可能",                         // 727="Timelapse Available"
-            "タイムラプス設定",                             // 728="Timelapse Settings"
-            "ヒント:",                                      // 729="Tip:"
-            "機能を切り替え",                               // 730="Toggle Feature"
-            "ツール",                                       // 731="Tool"
-            "ツールチェンジャー",                           // 732="Tool Changer"
-            "上",                                           // 733="Top"
-            "総印刷数",                                     // 734="Total Prints"
-            "タッチキャリブレーション",                     // 735="Touch Calibration"
-            "どこでもタッチしてキャリブレーションをテスト", // 736="Touch anywhere to test
-                                                            // calibration"
-            "画面をタッチしてスリープ解除",                 // 737="Touch screen to wake from sleep"
-            "移動",                                         // 738="Travels"
-            "トラブルシューティング:",                      // 739="Troubleshooting:"
-            "チューニング",                                 // 740="Tune"
-            "ヒーター PID パラメータをチューニング",        // 741="Tune heater PID parameters"
-            "プリンター起動時に LED を点灯",                // 742="Turn on LED when printer starts"
-            "タイプ",                                       // 743="Type"
-            "入力フィールドをプレビューするには入力してください...", // 744="Type to preview input
-                                                                     // field..."
-            "USB",                                                   // 745="USB"
-            "HelixPrint プラグインをアンインストール", // 746="Uninstall HelixPrint Plugin"
-            "不明",                                    // 747="Unknown"
-            "不明なスプール",                          // 748="Unknown Spool"
-            "不明なステップ",                          // 749="Unknown Step"
-            "排出",                                    // 750="Unload"
-            "フィラメントを排出",                      // 751="Unload Filament"
-            "フィラメントを排出中...",                 // 752="Unloading filament..."
-            "アンリトラクト追加量",                    // 753="Unretract Extra"
-            "アンリトラクト速度",                      // 754="Unretract Speed"
-            "開始するには gcode ファイルをアップロードしてください", // 755="Upload gcode files to
-                                                                     // get started"
-            "G10/G11 ファームウェアリトラクションを使用", // 756="Use G10/G11 firmware retraction"
-            "ValgACE (ACE Pro)",                          // 757="ValgACE (ACE Pro)"
-            "値がプリンター設定に保存されました。",       // 758="Values have been saved to printer
-                                                          // configuration."
-            "速度と加速度の制限",                         // 759="Velocity and acceleration limits"
-            "ベンダー",                                   // 760="Vendor"
-            "バージョン",                                 // 761="Version"
-            "垂直プログレス（リトラクトウィザード）", // 762="Vertical Progress (Retract Wizard)"
-            "振動",                                   // 763="Vibration"
-            "動画再生速度",                           // 764="Video playback speed"
-            "全履歴を表示",                           // 765="View Full History"
-            "プリセットを表示",                       // 766="View Presets"
-            "タイムラプスを表示",                     // 767="View Timelapse"
-            "インストール済みプラグインとステータスを表示", // 768="View installed plugins and
-                                                            // status"
-            "印刷統計とジョブ履歴を表示", // 769="View print statistics and job history"
-            "警告",                       // 770="Warning"
-            "週",                         // 771="Week"
-            "残りのフィラメントを表示するために、重量データが Spoolman "
-            "から同期されます。印刷の開始、一時停止、完了時にも変更が同期されます。", // 772="Weight
-                                                                                      // data is
-                                                                                      // synced from
-                                                                                      // Spoolman to
-                                                                                      // display
-                                                                                      // remaining
-                                                                                      // filament.
-                                                                                      // Changes are
-                                                                                      // also synced
-                                                                                      // when prints
-                                                                                      // start,
-                                                                                      // pause, or
-                                                                                      // complete."
-            "重量同期設定",                      // 773="Weight sync settings"
-            "ホワイト",                          // 774="White"
-            "WiFi",                              // 775="WiFi"
-            "WiFi ネットワーク",                 // 776="WiFi Network"
-            "WiFi とイーサネット",               // 777="WiFi and Ethernet"
-            "WiFi とイーサネットの設定",         // 778="WiFi and Ethernet configuration"
-            "WiFi 制御は利用できません",         // 779="WiFi control unavailable"
-            "WiFi ハードウェアが利用できません", // 780="WiFi hardware unavailable"
-            "幅",                                // 781="Width"
-            "幅センサー",                        // 782="Width Sensors"
-            "X:",                                // 783="X:"
-            "XY",                                // 784="XY"
-            "Y:",                                // 785="Y:"
-            "年",                                // 786="Year"
-            "完了した印刷がここに表示されます",  // 787="Your completed prints will appear here"
-            "Z",                                 // 788="Z"
-            "Z キャリブレーション",              // 789="Z Calibration"
-            "Z 範囲",                            // 790="Z Range"
-            "ベッドレベリングとメッシュ生成用 Z プローブ", // 791="Z probes for bed leveling and
-                                                           // mesh generation"
-            "Z-Offset",                                    // 792="Z-Offset"
-            "Z-Offset キャリブレーション",                 // 793="Z-Offset Calibration"
-            "Z-Offset:",                                   // 794="Z-Offset:"
-            "Z-Tilt 調整",                                 // 795="Z-Tilt Adjust"
-            "Z:",                                          // 796="Z:"
-            "Z: 0.000",                                    // 797="Z: 0.000"
-            "ズーム",                                      // 798="Zoom"
-            "^ 正面",                                      // 799="^ FRONT"
-            "時間",                                        // 800="hour"
-            "時間",                                        // 801="hours"
-            "lg",                                          // 802="lg"
-            "md",                                          // 803="md"
-            "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-            "分",                                   // 805="minute"
-            "分",                                   // 806="minutes"
-            "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-            "秒",                                   // 808="seconds"
-            "size=\"large\"",                       // 809="size="large""
-            "size=\"medium\"",                      // 810="size="medium""
-            "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-            "size=\"small\"",                       // 812="size="small""
-            "size=\"tiny\"",                        // 813="size="tiny""
-            "sm",                                   // 814="sm"
-            "true",                                 // 815="true"
-            "value=0 (shows FULL - BUG!)",          // 816="value=0 (shows FULL - BUG!)"
-            "value=1 (tiny sliver?)",               // 817="value=1 (tiny sliver?)"
-            "value=100 (should be full)",           // 818="value=100 (should be full)"
-            "xs",                                   // 819="xs"
-            "Русский",                              // 820="Русский"
-            "—",                                    // 821="—"
-            "•",                                    // 822="•"
-            "中文",                                 // 823="中文"
-            "日本語",                               // 824="日本語"
-            "󰅐",                                 // 825="󰅐"
-            "󰉋",                                 // 826="󰉋"
-            "󱧰",                                 // 827="󱧰"
-};
-
-static const char* pt_singulars[] = {
-    " / ",                                               // 0=" / "
-    " 0 / 0",                                            // 1=" 0 / 0"
-    "#808080",                                           // 2="#808080"
-    "#RRGGBB",                                           // 3="#RRGGBB"
-    "(0)",                                               // 4="(0)"
-    "(2.4GHz)",                                          // 5="(2.4GHz)"
-    "+",                                                 // 6="+"
-    "+0",                                                // 7="+0"
-    "+0.01mm",                                           // 8="+0.01mm"
-    "+0.05mm",                                           // 9="+0.05mm"
-    "+0.1mm",                                            // 10="+0.1mm"
-    "+1mm",                                              // 11="+1mm"
-    "-",                                                 // 12="-"
-    "- Verifique [resonance_tester] no printer.cfg",     // 13="- Check [resonance_tester] in
-                                                         // printer.cfg"
-    "- Certifique-se de que o ADXL345 está conectado",   // 14="- Ensure ADXL345 is connected"
-    "- Tente Medir Ruído primeiro",                      // 15="- Try Measure Noise first"
-    "--",                                                // 16="--"
-    "---",                                               // 17="---"
-    "-0.01mm",                                           // 18="-0.01mm"
-    "-0.05mm",                                           // 19="-0.05mm"
-    "-0.1mm",                                            // 20="-0.1mm"
-    "-1mm",                                              // 21="-1mm"
-    "/",                                                 // 22="/"
-    "0.4-2mm direct drive, 4-6mm bowden",                // 23="0.4-2mm direct drive, 4-6mm bowden"
-    "1. A impressora faz home e sonda a mesa",           // 24="1. Printer homes and probes the bed"
-    "1. A impressora fará home e sondará cada parafuso", // 25="1. Printer will home and probe each
-                                                         // screw"
-    "10mm",                                              // 26="10mm"
-    "1mm",                                               // 27="1mm"
-    "2. Coloque papel entre o bico e a mesa", // 28="2. Place paper between nozzle and bed"
-    "2. Os resultados mostram quanto girar cada parafuso", // 29="2. Results show how much to turn
-                                                           // each screw"
-    "200-230°C",                                           // 30="200-230°C"
-    "210°C / 60°C",                                        // 31="210°C / 60°C"
-    "230°C / 50°C",                                        // 32="230°C / 50°C"
-    "240°C / 80°C",                                        // 33="240°C / 80°C"
-    "250°C / 100°C",                                       // 34="250°C / 100°C"
-    "25mm",                                                // 35="25mm"
-    "3. Ajuste os parafusos, depois sonde novamente para verificar", // 36="3. Adjust screws, then
-                                                                     // re-probe to verify"
-    "3. Abaixe o bico até o papel arrastar levemente", // 37="3. Lower nozzle until paper drags
-                                                       // slightly"
-    "Visualização 3D",                                 // 38="3D Preview"
-    "4. O papel deve se mover, mas com resistência",   // 39="4. Paper should move but with
-                                                       // resistance"
-    "4. Repita até a mesa estar nivelada",             // 40="4. Repeat until bed is level"
-    "5mm",                                             // 41="5mm"
-    "60°C",                                            // 42="60°C"
-    "6mm",                                             // 43="6mm"
-    "850g",                                            // 44="850g"
-    "= Afrouxar",                                      // 45="= Loosen"
-    "= Apertar",                                       // 46="= Tighten"
-    "?",                                               // 47="?"
-    "SOBRE",                                           // 48="ABOUT"
-    "ABS",                                             // 49="ABS"
-    "Configurações AMS",                               // 50="AMS Settings"
-    "APARÊNCIA",                                       // 51="APPEARANCE"
-    "AUTOMAÇÃO",                                       // 52="AUTOMATION"
-    "Abortar",                                         // 53="Abort"
-    "Sobre",                                           // 54="About"
-    "Aceleração para Desaceleração",                   // 55="Accel to Decel"
-    "Limite de aceleração para desaceleração (mm/s²)", // 56="Acceleration to deceleration limit
-                                                       // (mm/s²)"
-    "Acelerômetros",                                   // 57="Accelerometers"
-    "Aceitar",                                         // 58="Accept"
-    "Ação Necessária",                                 // 59="Action Required"
-    "Ações",                                           // 60="Actions"
-    "Ativo",                                           // 61="Active"
-    "Real",                                            // 62="Actual"
-    "Adicionar Rede Oculta",                           // 63="Add Hidden Network"
-    "Ajustar nível de brilho da tela",                 // 64="Adjust screen brightness level"
-    "Ajuste os parafusos, depois sonde novamente.",    // 65="Adjust screws, then re-probe."
-    "Ajustes permanecem ativos até reiniciar. Salve após a impressão terminar.", // 66="Adjustments
-                                                                                 // stay active
-                                                                                 // until restart.
-                                                                                 // Save after print
-                                                                                 // completes."
-    "Configuração Avançada",                            // 67="Advanced Setting"
-    "Todos",                                            // 68="All"
-    "Todos os parafusos estão dentro da tolerância.",   // 69="All screws are within tolerance."
-    "Allwinner",                                        // 70="Allwinner"
-    "Quantidade:",                                      // 71="Amount:"
-    "Um acelerômetro foi detectado na sua impressora.", // 72="An accelerometer was detected on your
-                                                        // printer."
-    "Ocorreu um erro durante a calibração.",    // 73="An error occurred during calibration."
-    "Ocorreu um erro durante a sondagem.",      // 74="An error occurred during probing."
-    "Ocorreu um erro ao carregar o filamento.", // 75="An error occurred while loading filament."
-    "Animações",                                // 76="Animations"
-    "Fundo do Aplicativo",                      // 77="App Background"
-    "Aplicar",                                  // 78="Apply"
-    "Aplicar Alterações",                       // 79="Apply Changes"
-    "Aplicar salva apenas para esta sessão",    // 80="Apply saves for this session only"
-    "Aplicando...",                             // 81="Applying..."
-    "Tem certeza de que deseja cancelar esta impressão? Todo o progresso será perdido.", // 82="Are
-                                                                                         // you sure
-                                                                                         // you want
-                                                                                         // to
-                                                                                         // cancel
-                                                                                         // this
-                                                                                         // print?
-                                                                                         // All
-                                                                                         // progress
-                                                                                         // will be
-                                                                                         // lost."
-    "Atribuir Carretel",                                           // 83="Assign Spool"
-    "Atribua uma função para habilitar o monitoramento do sensor", // 84="Assign a role to enable
-                                                                   // sensor monitoring"
-    "Atribuindo ao Slot 1",                                        // 85="Assigning to Slot 1"
-    "Automático",                                                  // 86="Auto"
-    "Malha da Mesa Automática",                                    // 87="Auto Bed Mesh"
-    "Aquecer Automaticamente ao Carregar",                         // 88="Auto-Heat on Load"
-    "Sondagem automática ou verificação manual da altura dos parafusos", // 89="Auto-probe or
-                                                                         // manually check screw
-                                                                         // heights"
-    "Renderizar vídeo automaticamente",                                  // 90="Auto-render video"
-    "Calibração PID Automática", // 91="Automatic PID Calibration"
-    "Consultar automaticamente o Spoolman para atualizações de peso", // 92="Automatically poll
-                                                                      // Spoolman for weight
-                                                                      // updates"
-    "Redes Disponíveis",                                              // 93="Available Networks"
-    "Redes disponíveis",                                              // 94="Available networks"
-    "Voltar",                                                         // 95="Back"
-    "Backup",                                                         // 96="Backup"
-    "Mesa",                                                           // 97="Bed"
-    "Aquecedor da Mesa",                                              // 98="Bed Heater"
-    "Nível da Mesa",                                                  // 99="Bed Level"
-    "Nivelamento da Mesa",                                            // 100="Bed Leveling"
-    "Malha da Mesa",                                                  // 101="Bed Mesh"
-    "Renderização da Malha da Mesa",                                  // 102="Bed Mesh Render"
-    "Ajuste dos Parafusos da Mesa",                                   // 103="Bed Screw Adjustment"
-    "Parafusos da Mesa",                                              // 104="Bed Screws"
-    "Mesa Nivelada!",                                                 // 105="Bed is Level!"
-    "Mesa °C",                                                        // 106="Bed °C"
-    "Mesa:",                                                          // 107="Bed:"
-    "Preto",                                                          // 108="Black"
-    "Bluetooth",                                                      // 109="Bluetooth"
-    "O texto do corpo suporta orientações mais longas mantendo a legibilidade.", // 110="Body text
-                                                                                 // supports longer
-                                                                                 // guidance while
-                                                                                 // staying
-                                                                                 // readable."
-    "Opacidade da Borda",                                   // 111="Border Opacity"
-    "Raio da Borda",                                        // 112="Border Radius"
-    "Largura da Borda",                                     // 113="Border Width"
-    "Transparência da borda (0 = invisível, 255 = sólido)", // 114="Border transparency (0 =
-                                                            // invisible, 255 = solid)"
-    "Brilho",                                               // 115="Brightness"
-    "Navegar",                                              // 116="Browse"
-    "Ocupado",                                              // 117="Busy"
-    "Bypass",                                               // 118="Bypass"
-    "Modo Bypass",                                          // 119="Bypass Mode"
-    "CALIBRAÇÃO",                                           // 120="CALIBRATION"
-    "ALTERADO DESDE A ÚLTIMA SESSÃO",                       // 121="CHANGED FROM LAST SESSION"
-    "CORES NECESSÁRIAS",                                    // 122="COLORS REQUIRED"
-    "CRÍTICO",                                              // 123="CRITICAL"
-    "Calibrar",                                             // 124="Calibrate"
-    "Calibrar X",                                           // 125="Calibrate X"
-    "Calibrar Y",                                           // 126="Calibrate Y"
-    "Calibrar compensação de ressonância",          // 127="Calibrate resonance compensation"
-    "Calibrando...",                                // 128="Calibrating..."
-    "Calibração",                                   // 129="Calibration"
-    "Calibração & Ferramentas",                     // 130="Calibration & Tools"
-    "Calibração &amp; Ferramentas",                 // 131="Calibration &amp; Tools"
-    "Calibração Concluída!",                        // 132="Calibration Complete!"
-    "Calibração Falhou",                            // 133="Calibration Failed"
-    "Cancelar",                                     // 134="Cancel"
-    "Cancelar Impressão",                           // 135="Cancel Print"
-    "Cancelado",                                    // 136="Cancelled"
-    "Câmara",                                       // 137="Chamber"
-    "Ventoinha da Câmara",                          // 138="Chamber Fan"
-    "Monitoramento de umidade da câmara e secador", // 139="Chamber and dryer humidity monitoring"
-    "Câmara:",                                      // 140="Chamber:"
-    "Alterações aplicadas imediatamente. Ajuste durante a impressão para calibrar.", // 141="Changes
-                                                                                     // apply
-                                                                                     // immediately.
-                                                                                     // Adjust
-                                                                                     // during print
-                                                                                     // for tuning."
-    "Alterações são temporárias e resetam ao reiniciar a impressora", // 142="Changes are temporary
-                                                                      // and reset on printer
-                                                                      // reboot"
-    "Verifique o caminho do filamento e tente novamente.", // 143="Check the filament path and try
-                                                           // again."
-    "Verificando slots...",                                // 144="Checking slots..."
-    "Escolha exibição de hora em 12 ou 24 horas", // 145="Choose 12-hour or 24-hour time display"
-    "Escolha o idioma de exibição",               // 146="Choose display language"
-    "Escolha como os quadros são capturados durante a impressão", // 147="Choose how frames are
-                                                                  // captured during printing"
-    "Escolha o modo de renderização para visualização do G-code", // 148="Choose rendering mode for
-                                                                  // G-code visualization"
-    "Escolha o modo de renderização para visualização da malha da mesa", // 149="Choose rendering
-                                                                         // mode for bed mesh
-                                                                         // visualization"
-    "Limpar Bico",                                                       // 150="Clean Nozzle"
-    "Limpar",                                                            // 151="Clear"
-    "Limpar Tudo",                                                       // 152="Clear All"
-    "Limpar Atribuição",                                                 // 153="Clear Assignment"
-    "Área de transferência indisponível - use SSH", // 154="Clipboard unavailable - use SSH"
-    "Fechar",                                       // 155="Close"
-    "Mais perto = mais compressão | Mais longe = menos compressão", // 156="Closer = more squish |
-                                                                    // Farther = less squish"
-    "Sensores de Cor",                                              // 157="Color Sensors"
-    "Concluído",                                                    // 158="Complete"
-    "Concluído",                                                    // 159="Completed"
-    "Concluído em 3 sondagens",                                     // 160="Completed in 3 probes"
-    "Definido na configuração (somente leitura)", // 161="Config-defined (read-only)"
-    "Configurar retração de firmware G10/G11",    // 162="Configure G10/G11 firmware retraction"
-    "Configurar PRINT_START",                     // 163="Configure PRINT_START"
-    "Configurar integração com Spoolman e configurações de sincronização de peso.", // 164="Configure
-                                                                                    // Spoolman
-                                                                                    // integration
-                                                                                    // and weight
-                                                                                    // sync
-                                                                                    // settings."
-    "Configurar dispositivos no Moonraker",         // 165="Configure devices in Moonraker"
-    "Configurar sensores de detecção de filamento", // 166="Configure filament detection sensors"
-    "Configurar botões rápidos e macros padrão",    // 167="Configure quick buttons and standard
-                                                    // macros"
-    "Configurar gravação de timelapse",             // 168="Configure timelapse recording"
-    "Conectar",                                     // 169="Connect"
-    "Conectado",                                    // 170="Connected"
-    "Conectando",                                   // 171="Connecting"
-    "Conectando à rede...",                         // 172="Connecting to network..."
-    "Conectando...",                                // 173="Connecting..."
-    "Conexão",                                      // 174="Connection"
-    "Conexão falhou. Verifique a senha.",           // 175="Connection failed. Check password."
-    "A conexão deve ser testada com sucesso para continuar", // 176="Connection must be tested
-                                                             // successfully to continue"
-    "Console",                                               // 177="Console"
-    "Controlar recursos opcionais de início de impressão",   // 178="Control optional print start
-                                                             // features"
-    "Resfriar",                                              // 179="Cool Down"
-    "Resfriamento",                                          // 180="Cooldown"
-    "Resfriamento",                                          // 181="Cooling"
-    "Copiar Comando",                                        // 182="Copy Command"
-    "Arredondamento dos cantos (0 = reto, 40 = muito arredondado)", // 183="Corner roundness (0 =
-                                                                    // sharp, 40 = very round)"
-    "Criar vídeo quando a impressão terminar",        // 184="Create video when print completes"
-    "Atual / Alvo",                                   // 185="Current / Target"
-    "Malha Atual",                                    // 186="Current Mesh"
-    "Temperatura Atual",                              // 187="Current Temperature"
-    "Posição Z Atual",                                // 188="Current Z Position"
-    "Nome atual:",                                    // 189="Current name:"
-    "Atualmente Carregado",                           // 190="Currently Loaded"
-    "Imprimindo atualmente",                          // 191="Currently printing"
-    "Personalizado...",                               // 192="Custom..."
-    "Cortando filamento...",                          // 193="Cutting filament..."
-    "DIAGNÓSTICOS",                                   // 194="DIAGNOSTICS"
-    "DESABILITADO",                                   // 195="DISABLED"
-    "Perigo",                                         // 196="Danger"
-    "Modo Escuro",                                    // 197="Dark Mode"
-    "Dia",                                            // 198="Day"
-    "Padrão (valor=50)",                              // 199="Default (value=50)"
-    "Espessura padrão da borda",                      // 200="Default border thickness"
-    "Defina macros no seu printer.cfg",               // 201="Define macros in your printer.cfg"
-    "Excluir",                                        // 202="Delete"
-    "Delta:",                                         // 203="Delta:"
-    "Deutsch",                                        // 204="Deutsch"
-    "Operações do Dispositivo",                       // 205="Device Operations"
-    "Desabilitar",                                    // 206="Disable"
-    "Impressoras Descobertas",                        // 207="Discovered Printers"
-    "Dispensar",                                      // 208="Dismiss"
-    "Tela",                                           // 209="Display"
-    "Configurações de Exibição",                      // 210="Display Settings"
-    "Suspensão da Tela",                              // 211="Display Sleep"
-    "Não Salvar",                                     // 212="Don't Save"
-    "Não perguntar novamente",                        // 213="Don't ask again"
-    "Concluído",                                      // 214="Done"
-    "Intensidade da sombra (0 = desabilitado)",       // 215="Drop shadow strength (0 = disabled)"
-    "Secador",                                        // 216="Dryer"
-    "Controle do Secador",                            // 217="Dryer Control"
-    "Duração",                                        // 218="Duration"
-    "E-Stop",                                         // 219="E-Stop"
-    "Confirmação de Parada de Emergência",            // 220="E-Stop Confirmation"
-    "CONTROLES DE EMERGÊNCIA",                        // 221="EMERGENCY CONTROLS"
-    "PARADA DE EMERGÊNCIA",                           // 222="EMERGENCY STOP"
-    "Cada ventoinha só pode ser selecionada uma vez", // 223="Each fan can only be selected once"
-    "Editar",                                         // 224="Edit"
-    "Editar Predefinição",                            // 225="Edit Preset"
-    "Editar Slot 1",                                  // 226="Edit Slot 1"
-    "Editar Cores do Tema",                           // 227="Edit Theme Colors"
-    "Editar Cores do Tema (Modificado)",              // 228="Edit Theme Colors (Modified)"
-    "Decorrido",                                      // 229="Elapsed"
-    "Parada de Emergência",                           // 230="Emergency Stop"
-    "Parada de Emergência (M112)",                    // 231="Emergency Stop (M112)"
-    "Parada de Emergência?",                          // 232="Emergency Stop?"
-    "Vazio",                                          // 233="Empty"
-    "Slots vazios desabilitam a funcionalidade associada", // 234="Empty slots disable the
-                                                           // associated functionality"
-    "Habilitar",                                           // 235="Enable"
-    "Habilitar Monitoramento",                             // 236="Enable Monitoring"
-    "Habilitar Retração",                                  // 237="Enable Retraction"
-    "Habilitar Timelapse",                                 // 238="Enable Timelapse"
-    "Habilitar efeitos de movimento da interface",         // 239="Enable UI motion effects"
-    "Habilitar WiFi para escanear",                        // 240="Enable WiFi to scan"
-    "Habilitar WiFi para escanear redes",                  // 241="Enable WiFi to scan for networks"
-    "Habilitar feedback de áudio",                         // 242="Enable audio feedback"
-    "Habilitar rastreamento detalhado de preparação de impressão (Recomendado)", // 243="Enable
-                                                                                 // detailed print
-                                                                                 // preparation
-                                                                                 // tracking
-                                                                                 // (Recommended)"
-    "Habilitado",                                                                // 244="Enabled"
-    "Finalizado",                                                                // 245="Ended"
-    "English",                                                                   // 246="English"
-    "Aprimoramento Concluído!",                    // 247="Enhancement Complete!"
-    "Aprimoramento Falhou",                        // 248="Enhancement Failed"
-    "Digite o comando G-code...",                  // 249="Enter G-code command..."
-    "Digite a Senha WiFi",                         // 250="Enter WiFi Password"
-    "Digite um nome para seu tema personalizado:", // 251="Enter a name for your custom theme:"
-    "Digite um nome para salvar este perfil",      // 252="Enter a name to save this profile"
-    "Digite o nome da rede",                       // 253="Enter network name"
-    "Digite a senha",                              // 254="Enter password"
-    "Erro",                                        // 255="Error"
-    "Estado de erro",                              // 256="Error state"
-    "Español",                                     // 257="Español"
-    "Ethernet",                                    // 258="Ethernet"
-    "Excluir",                                     // 259="Exclude"
-    "Executar macros da impressora",               // 260="Execute printer macros"
-    "Ventoinha de Exaustão",                       // 261="Exhaust Fan"
-    "Explore como a paleta selecionada molda texto, controles e cores de status.", // 262="Explore
-                                                                                   // how the
-                                                                                   // selected
-                                                                                   // palette shapes
-                                                                                   // text,
-                                                                                   // controls, and
-                                                                                   // status
-                                                                                   // colors."
-    "Explorar paleta e visualizar",         // 263="Explore palette and preview"
-    "Prime extra para compensar vazamento", // 264="Extra prime to compensate ooze"
-    "Extrudar",                             // 265="Extrude"
-    "Extrudar / Retrair",                   // 266="Extrude / Retract"
-    "Extrusor",                             // 267="Extruder"
-    "Ajuste PID do Extrusor",               // 268="Extruder PID Tuning"
-    "O extrusor aquece automaticamente com base no material", // 269="Extruder heats automatically
-                                                              // based on material"
-    "Taxa de extrusão",                                       // 270="Extrusion rate"
-    "FALHOU",                                                 // 271="FAILED"
-    "FILAMENTO",                                              // 272="FILAMENT"
-    "Restauração de Fábrica",                                 // 273="Factory Reset"
-    "Falhou",                                                 // 274="Failed"
-    "Falha ao salvar arquivo do tema",                        // 275="Failed to save theme file"
-    "Alimentar filamento diretamente ao extrusor", // 276="Feed filament directly to extruder"
-    "Filamento",                                   // 277="Filament"
-    "Sensor de Filamento",                         // 278="Filament Sensor"
-    "Sensores de Filamento",                       // 279="Filament Sensors"
-    "Filamento Usado",                             // 280="Filament Used"
-    "Filamento por Tipo",                          // 281="Filament by Type"
-    "Sensores de diâmetro de filamento para compensação de fluxo", // 282="Filament diameter sensors
-                                                                   // for flow compensation"
-    "Sensores de detecção de fim de filamento e movimento", // 283="Filament runout and motion
-                                                            // detection sensors"
-    "Rastreamento e inventário de filamento",               // 284="Filament tracking and inventory"
-    "Arquivo",                                              // 285="File"
-    "Informações do Arquivo",                               // 286="File Info"
-    "Nome do Arquivo",                                      // 287="Filename"
-    "Arquivos",                                             // 288="Files"
-    "Preenchimento: 100% / 75% / 40% / 10%",                // 289="Fill: 100% / 75% / 40% / 10%"
-    "Reiniciar Firmware",                                   // 290="Firmware Restart"
-    "Anéis Concêntricos Planos (ams_slot existente)",       // 291="Flat Concentric Rings (existing
-                                                            // ams_slot)"
-    "Taxa de Fluxo",                                        // 292="Flow Rate"
-    "Formando ponta...",                                    // 293="Forming tip..."
-    "Taxa de Quadros",                                      // 294="Framerate"
-    "Français",                                             // 295="Français"
-    "Freq",                                                 // 296="Freq"
-    "Frente",                                               // 297="Front"
-    "Console G-code",                                       // 298="G-code Console"
-    "Visualização G-code",                                  // 299="G-code Preview"
-    "Os comandos G-code aparecerão aqui",                 // 300="G-code commands will appear here"
-    "Fantasma:",                                          // 301="Ghost:"
-    "Cinza",                                              // 302="Gray"
-    "Happy Hare MMU",                                     // 303="Happy Hare MMU"
-    "Hardware",                                           // 304="Hardware"
-    "Saúde do Hardware",                                  // 305="Hardware Health"
-    "Problemas de Hardware",                              // 306="Hardware Issues"
-    "Nome do Hardware",                                   // 307="Hardware Name"
-    "O hardware é validado na inicialização e reconexão", // 308="Hardware is validated on startup
-                                                          // and reconnection"
-    "Tenha um pedaço de papel pronto antes de começar.",  // 309="Have a piece of paper ready before
-                                                          // starting."
-    "Tenha sua ferramenta de ajuste da mesa (chave de fenda, chave Allen, etc.) pronta se sua mesa "
-    "não for ajustada com                              rodas manuais ou algum outro mecanismo "
-    "embutido.", // 310="Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if your
-                 // bed isn't adjusted with                              thumb wheels or some other
-                 // built-in mechanism."
-    "Título",    // 311="Heading"
-    "Aquecimento Prolongado",        // 312="Heat Soak"
-    "Aquecer a 170°C para extrudar", // 313="Heat to 170°C to extrude"
-    "Temperatura da Mesa Aquecida",  // 314="Heatbed Temperature"
-    "Mesa Aquecida",                 // 315="Heated Bed"
-    "Aquecendo...",                  // 316="Heating..."
-    "HelixScreen Travou",            // 317="HelixScreen Crashed"
-    "HelixScreen se integrará com seu trocador de filamento para operações de impressão com "
-    "múltiplos carretéis/cores.", // 318="HelixScreen will integrate with your filament changer for
-                                  // multi-spool/color print operations."
-    "Maior = mais rápido",        // 319="Higher = faster"
-    "Home",                       // 320="Home"
-    "Home Todos",                 // 321="Home All"
-    "Home X",                     // 322="Home X"
-    "Home Y",                     // 323="Home Y"
-    "Home Z",                     // 324="Home Z"
-    "Progresso Horizontal (Assistente de Nivelamento)", // 325="Horizontal Progress (Leveling
-                                                        // Wizard)"
-    "Host",                                             // 326="Host"
-    "Hotend",                                           // 327="Hotend"
-    "Ventoinha do Hotend",                              // 328="Hotend Fan"
-    "Aquecedor do Hotend",                              // 329="Hotend Heater"
-    "Com que frequência verificar o Spoolman para atualizações de peso", // 330="How often to check
-                                                                         // Spoolman for weight
-                                                                         // updates"
-    "Umidade",                                                           // 331="Humidity"
-    "Sensores de Umidade",                                               // 332="Humidity Sensors"
-    "IP:",                                                               // 333="IP:"
-    "Ocioso",                                                            // 334="Idle"
-    "Ignorar",                                                           // 335="Ignore"
-    "Em Andamento",                                                      // 336="In Progress"
-    "Indexando G-code...",                                               // 337="Indexing G-code..."
-    "Inicializando...",                                                  // 338="Initializing..."
-    "Entrada",                                                           // 339="Input"
-    "Input Shaper",                                                      // 340="Input Shaper"
-    "Input Shaping",                                                     // 341="Input Shaping"
-    "Sensores de calibração do input shaper", // 342="Input shaper calibration sensors"
-    "O input shaping reduz artefatos de vibração (ringing) nas suas impressões.", // 343="Input
-                                                                                  // shaping reduces
-                                                                                  // vibration
-                                                                                  // artifacts
-                                                                                  // (ringing) in
-                                                                                  // your prints."
-    "Instalar Plugin HelixPrint", // 344="Install HelixPrint Plugin"
-    "Instalar Plugin",            // 345="Install Plugin"
-    "Instale o plugin HelixPrint para habilitar modificações rápidas de G-code. Execute este "
-    "comando via SSH na sua impressora:", // 346="Install the HelixPrint plugin to enable fast
-                                          // G-code modifications. Run this command via SSH on your
-                                          // printer:"
-    "Instalação Falhou",                  // 347="Installation Failed"
-    "A instalação leva cerca de 30 segundos.", // 348="Installation takes about 30 seconds."
-    "Instalando...",                           // 349="Installing..."
-    "Intensidade",                             // 350="Intensity"
-    "G-code 3D interativo durante impressões", // 351="Interactive 3D G-code during prints"
-    "Calibração interativa de sonda",          // 352="Interactive probe calibration"
-    "Descrição do problema",                   // 353="Issue description"
-    "Italiano",                                // 354="Italiano"
-    "Agora mesmo",                             // 355="Just now"
-    "Kd:",                                     // 356="Kd:"
-    "Continuar Imprimindo",                    // 357="Keep Printing"
-    "Manter Obrigatório",                      // 358="Keep Required"
-    "Teste de Teclado (estilo Gboard)",        // 359="Keyboard Test (Gboard-style)"
-    "Ki:",                                     // 360="Ki:"
-    "Klipper",                                 // 361="Klipper"
-    "O Klipper entrou em estado de desligamento. Isso pode ser devido a uma parada de emergência, "
-    "fuga térmica ou erro de configuração.", // 362="Klipper has entered shutdown state. This may be
-                                             // due to an emergency stop, thermal runaway, or
-                                             // configuration error."
-    "O Klipper será reiniciado para aplicar as alterações",  // 363="Klipper will restart to apply
-                                                             // changes"
-    "O Klipper será reiniciado para aplicar as alterações.", // 364="Klipper will restart to apply
-                                                             // changes."
-    "O Klipper será reiniciado para aplicar os novos valores PID.", // 365="Klipper will restart to
-                                                                    // apply new PID values."
-    "Kp:",                                                          // 366="Kp:"
-    "Fita de LED",                                                  // 367="LED Strip"
-    "LED Ligado ao Iniciar",                                        // 368="LED on at Start"
-    "CARREGADO",                                                    // 369="LOADED"
-    "Idioma",                                                       // 370="Language"
-    "Últimos 7 dias",                                               // 371="Last 7 days"
-    "Última impressão cancelada",                                   // 372="Last print cancelled"
-    "Última impressão falhou",                                      // 373="Last print failed"
-    "Depois",                                                       // 374="Later"
-    "Camada",                                                       // 375="Layer"
-    "Altura da Camada",                                             // 376="Layer Height"
-    "O modo por camada captura um quadro por mudança de camada. Melhor para a maioria das "
-    "impressões.",  // 377="Layer mode captures one frame per layer change. Best for most prints."
-    "Camada:",      // 378="Layer:"
-    "Camadas",      // 379="Layers"
-    "Comprimento:", // 380="Length:"
-    "Claro",        // 381="Light"
-    "Carregar",     // 382="Load"
-    "Carregar Filamento",                                 // 383="Load Filament"
-    "Carregado",                                          // 384="Loaded"
-    "Erro de Carregamento",                               // 385="Loading Error"
-    "Carregando G-code...",                               // 386="Loading G-code..."
-    "Carregando filamento...",                            // 387="Loading filament..."
-    "Carregando histórico...",                            // 388="Loading history..."
-    "Carregando carretéis...",                            // 389="Loading spools..."
-    "Carregando...",                                      // 390="Loading..."
-    "Bloqueado durante impressão",                        // 391="Locked during print"
-    "M para alternar",                                    // 392="M to toggle"
-    "MAC:",                                               // 393="MAC:"
-    "Ícones MDI",                                         // 394="MDI Icons"
-    "CONFIGURAÇÃO FALTANDO",                              // 395="MISSING CONFIGURED"
-    "MOVIMENTO",                                          // 396="MOTION"
-    "Limites da Máquina",                                 // 397="Machine Limits"
-    "Navegador de Macros",                                // 398="Macro Browser"
-    "Botões de Macro",                                    // 399="Macro Buttons"
-    "Macro para calibração da malha da mesa",             // 400="Macro for bed mesh calibration"
-    "Macro para aquecimento prolongado da câmara/mesa",   // 401="Macro for chamber/bed heat soak"
-    "Macro para nivelamento físico da mesa (QGL/Z-Tilt)", // 402="Macro for physical bed leveling
-                                                          // (QGL/Z-Tilt)"
-    "Macro para cancelar uma impressão ativa",            // 403="Macro to cancel an active print"
-    "Macro para limpar o bico",                           // 404="Macro to clean/wipe the nozzle"
-    "Macro para carregar filamento no extrusor",    // 405="Macro to load filament into extruder"
-    "Macro para pausar uma impressão ativa",        // 406="Macro to pause an active print"
-    "Macro para purgar/preparar o bico",            // 407="Macro to purge/prime the nozzle"
-    "Macro para retomar uma impressão pausada",     // 408="Macro to resume a paused print"
-    "Macro para descarregar filamento do extrusor", // 409="Macro to unload filament from extruder"
-    "Macros",                                       // 410="Macros"
-    "Fita de LED Principal",                        // 411="Main LED Strip"
-    "Tornar Opcional",                              // 412="Make Optional"
-    "Tornar malha da mesa e QGL opcionais",         // 413="Make bed mesh and QGL skippable"
-    "Gerenciar",                                    // 414="Manage"
-    "Nivelamento Manual da Mesa",                   // 415="Manual Bed Leveling"
-    "Material",                                     // 416="Material"
-    "Indicador de Carregamento Material Design",    // 417="Material Design Spinner"
-    "Aceleração Máxima",                            // 418="Max Acceleration"
-    "Velocidade Máxima",                            // 419="Max Velocity"
-    "Aceleração Z Máxima",                          // 420="Max Z Accel"
-    "Velocidade Z Máxima",                          // 421="Max Z Velocity"
-    "Velocidade máxima em curvas (mm/s)",           // 422="Max speed through corners (mm/s)"
-    "Aceleração máxima (mm/s²)",                    // 423="Maximum acceleration (mm/s²)"
-    "Velocidade máxima do cabeçote (mm/s)",         // 424="Maximum toolhead speed (mm/s)"
-    "Medir Ruído",                                  // 425="Measure Noise"
-    "Memória (MB)",                                 // 426="Memory (MB)"
-    "Malha Concluída",                              // 427="Mesh Complete"
-    "Modo",                                         // 428="Mode"
-    "Modificado",                                   // 429="Modified"
-    "Mês",                                          // 430="Month"
-    "Moonraker",                                    // 431="Moonraker"
-    "Movimento",                                    // 432="Motion"
-    "Movimento: XYZ",                               // 433="Motion: XYZ"
-    "Desligar Motores",                             // 434="Motors Off"
-    "Mover",                                        // 435="Move"
-    "Mova o papel para frente e para trás enquanto ajusta. Pare quando o papel prender levemente, "
-    "mas ainda deslizar.",     // 436="Move paper back and forth while adjusting. Stop when paper
-                               // catches slightly but still slides."
-    "Velocidade de movimento", // 437="Movement speed"
-    "Multi-Filamento",         // 438="Multi-Filament"
-    "Multi-Material",          // 439="Multi-Material"
-    "Meu Tema Personalizado",  // 440="My Custom Theme"
-    "Meu Painel",              // 441="My Panel"
-    "Minha Impressora",        // 442="My Printer"
-    "RECÉM DESCOBERTO",        // 443="NEWLY DISCOVERED"
-    "NOTIFICAÇÕES",            // 444="NOTIFICATIONS"
-    "Nome",                    // 445="Name"
-    "Endereço de Rede",        // 446="Network Address"
-    "Nome da Rede",            // 447="Network Name"
-    "Nome da Rede (SSID)",     // 448="Network Name (SSID)"
-    "Configurações de Rede",   // 449="Network Settings"
-    "Teste de Rede",           // 450="Network Test"
-    "Nunca",                   // 451="Never"
-    "Novos Valores PID",       // 452="New PID Values"
-    "Novo Z-Offset: 0.000",    // 453="New Z-Offset: 0.000"
-    "Novo nome do perfil",     // 454="New profile name"
-    "Próximo",                 // 455="Next"
-    "Nenhum sistema AMS conectado.",                   // 456="No AMS system connected."
-    "Sem Histórico",                                   // 457="No History"
-    "Nenhuma Macro Encontrada",                        // 458="No Macros Found"
-    "Sem Dispositivos de Energia",                     // 459="No Power Devices"
-    "Sem Carretéis",                                   // 460="No Spools"
-    "Nenhum arquivo carregado",                        // 461="No file loaded"
-    "Nenhum arquivo disponível para impressão",        // 462="No files available for printing"
-    "Nenhuma malha carregada",                         // 463="No mesh loaded"
-    "Nenhuma rede encontrada",                         // 464="No networks found"
-    "Sem notificações",                                // 465="No notifications"
-    "Nenhum plugin encontrado",                        // 466="No plugins found"
-    "Sem visualização",                                // 467="No preview"
-    "Ainda sem histórico de impressão",                // 468="No print history yet"
-    "Nenhuma macro de início de impressão encontrada", // 469="No print start macro found"
-    "Nenhum perfil disponível",                        // 470="No profiles available"
-    "Nenhum sensor detectado",                         // 471="No sensors detected"
-    "Nenhum carretel disponível",                      // 472="No spools available"
-    "Agora Não",                                       // 473="Not Now"
-    "Não conectado",                                   // 474="Not connected"
-    "Notificações",                                    // 475="Notifications"
-    "Notificar quando a impressão terminar",           // 476="Notify when print finishes"
-    "Bico",                                            // 477="Nozzle"
-    "Preparação do Bico",                              // 478="Nozzle Priming"
-    "Temp. do Bico",                                   // 479="Nozzle Temp"
-    "Temperatura do Bico",                             // 480="Nozzle Temperature"
-    "Bico °C",                                         // 481="Nozzle °C"
-    "Bico:",                                           // 482="Nozzle:"
-    "OK",                                              // 483="OK"
-    "Desligado",                                       // 484="Off"
-    "Offline",                                         // 485="Offline"
-    "Ligado",                                          // 486="On"
-    "Abrir",                                           // 487="Open"
-    "Operações",                                       // 488="Operations"
-    "Otimize Sua Impressão",                           // 489="Optimize Your Printing"
-    "Ou Digite Manualmente",                           // 490="Or Enter Manually"
-    "PETG",                                            // 491="PETG"
-    "Ajuste PID",                                      // 492="PID Tuning"
-    "O ajuste PID otimiza o controle de temperatura para aquecimento estável.", // 493="PID tuning
-                                                                                // optimizes
-                                                                                // temperature
-                                                                                // control for
-                                                                                // stable heating."
-    "PLA",                                                                      // 494="PLA"
-    "PLA - Preto",                                                              // 495="PLA - Black"
-    "ETAPAS PRÉ-IMPRESSÃO",              // 496="PRE-PRINT STEPS"
-    "IMPRESSORA",                        // 497="PRINTER"
-    "Calibração por Teste de Papel",     // 498="Paper Test Calibration"
-    "Ventoinha de Resfriamento da Peça", // 499="Part Cooling Fan"
-    "Ventoinha da Peça",                 // 500="Part Fan"
-    "Senha",                             // 501="Password"
-    "A senha não pode estar vazia",      // 502="Password cannot be empty"
-    "Pausar",                            // 503="Pause"
-    "Pausado",                           // 504="Paused"
-    "Pausado (atenção necessária)",      // 505="Paused (attention needed)"
-    "Pico:",                             // 506="Peak:"
-    "Rastreamento de Fase",              // 507="Phase Tracking"
-    "Escolher Cor",                      // 508="Pick Color"
-    "Coloque plugins no diretório de plugins para estender o HelixScreen", // 509="Place plugins in
-                                                                           // the plugins directory
-                                                                           // to extend HelixScreen"
-    "Por favor, digite um nome para o tema",                      // 510="Please enter a theme name"
-    "Por favor, aguarde enquanto a impressora faz home e sonda.", // 511="Please wait while the
-                                                                  // printer homes and probes."
-    "Por favor, aguarde enquanto a impressora sonda cada posição de parafuso.", // 512="Please wait
-                                                                                // while the printer
-                                                                                // probes each screw
-                                                                                // position."
-    "Plugin instalado com sucesso.", // 513="Plugin installed successfully."
-    "Plugins",                       // 514="Plugins"
-    "Plugins são descobertos na inicialização do aplicativo", // 515="Plugins are discovered on
-                                                              // application startup"
-    "Polymaker",                                              // 516="Polymaker"
-    "Porta",                                                  // 517="Port"
-    "Português",                                              // 518="Português"
-    "Posição",                                                // 519="Position"
-    "Energia",                                                // 520="Power"
-    "Controle de Energia",                                    // 521="Power Control"
-    "Pré-aquecer",                                            // 522="Preheat"
-    "Preparando Impressão",                                   // 523="Preparing Print"
-    "Preparando...",                                          // 524="Preparing..."
-    "Predefinições",                                          // 525="Presets"
-    "Anterior",                                               // 526="Previous"
-    "Primário",                                               // 527="Primary"
-    "Imprimir",                                               // 528="Print"
-    "Impressão Cancelada",                                    // 529="Print Cancelled"
-    "Impressão Concluída",                                    // 530="Print Complete"
-    "Impressão Concluída!",                                   // 531="Print Complete!"
-    "Alerta de Conclusão de Impressão",                       // 532="Print Completion Alert"
-    "Detalhes da Impressão",                                  // 533="Print Details"
-    "Arquivo de Impressão",                                   // 534="Print File"
-    "Arquivos de Impressão",                                  // 535="Print Files"
-    "Histórico de Impressão",                                 // 536="Print History"
-    "Horas de Impressão",                                     // 537="Print Hours"
-    "Velocidade de Impressão",                                // 538="Print Speed"
-    "Status da Impressão",                                    // 539="Print Status"
-    "Tempo de Impressão",                                     // 540="Print Time"
-    "Ajuste de Impressão",                                    // 541="Print Tuning"
-    "Impressora",                                             // 542="Printer"
-    "Nome da Impressora",                                     // 543="Printer Name"
-    "Desligamento da Impressora",                             // 544="Printer Shutdown"
-    "Tipo de Impressora",                                     // 545="Printer Type"
-    "Imprimindo",                                             // 546="Printing"
-    "Tendência de Impressões",                                // 547="Prints Trend"
-    "Privado:",                                               // 548="Private:"
-    "Sonda",                                                  // 549="Probe"
-    "Sensor de Sonda",                                        // 550="Probe Sensor"
-    "Sensores de Sonda",                                      // 551="Probe Sensors"
-    "Sondando Malha da Mesa",                                 // 552="Probing Bed Mesh"
-    "Sondando Parafusos da Mesa...",                          // 553="Probing Bed Screws..."
-    "Sondando Mesa...",                                       // 554="Probing Bed..."
-    "Sondagem Falhou",                                        // 555="Probing Failed"
-    "Processando...",                                         // 556="Processing..."
-    "Perfil",                                                 // 557="Profile"
-    "Nome do perfil (ex.: padrão)",                           // 558="Profile name (e.g., default)"
-    "Perfis",                                                 // 559="Profiles"
-    "Progresso",                                              // 560="Progress"
-    "Testes de Barra de Progresso",                           // 561="Progress Bar Tests"
-    "Purgar",                                                 // 562="Purge"
-    "Purgar 50mm",                                            // 563="Purge 50mm"
-    "BOTÕES RÁPIDOS",                                         // 564="QUICK BUTTONS"
-    "Nivelamento Quad Gantry",                                // 565="Quad Gantry Level"
-    "Ações Rápidas",                                          // 566="Quick Actions"
-    "Botão Rápido 1",                                         // 567="Quick Button 1"
-    "Botão Rápido 2",                                         // 568="Quick Button 2"
-    "Ações rápidas, calibração, velocidade",            // 569="Quick actions, calibration, speed"
-    "RSS:",                                             // 570="RSS:"
-    "Sondar Novamente",                                 // 571="Re-probe"
-    "Pronto",                                           // 572="Ready"
-    "Recomendado",                                      // 573="Recommended"
-    "Recomendado: 200°C para o extrusor",               // 574="Recommended: 200°C for extruder"
-    "Gravar Timelapse",                                 // 575="Record Timelapse"
-    "Gravar timelapses das suas impressões",            // 576="Record timelapses of your prints"
-    "Modo de Gravação",                                 // 577="Recording Mode"
-    "Recuperar",                                        // 578="Recover"
-    "Reduzir Ringing",                                  // 579="Reduce Ringing"
-    "Atualizar",                                        // 580="Refresh"
-    "Intervalo de Atualização",                         // 581="Refresh Interval"
-    "Restante",                                         // 582="Remaining"
-    "Remover plugin da impressora",                     // 583="Remove plugin from printer"
-    "Renomear",                                         // 584="Rename"
-    "Renomear Perfil de Malha",                         // 585="Rename Mesh Profile"
-    "Reimprimir",                                       // 586="Reprint"
-    "Exigir confirmação antes da parada de emergência", // 587="Require confirmation before
-                                                        // emergency stop"
-    "Requer plugin Moonraker-Timelapse",                // 588="Requires Moonraker-Timelapse plugin"
-    "Resetar",                                          // 589="Reset"
-    "Resetar Velocidade & Fluxo para 100%",             // 590="Reset Speed & Flow to 100%"
-    "Resetar Velocidade &amp; Fluxo para 100%",         // 591="Reset Speed &amp; Flow to 100%"
-    "Resetar todas as configurações e reiniciar assistente", // 592="Reset all settings and restart
-                                                             // wizard"
-    "Resetando...",                                          // 593="Resetting..."
-    "Ajuste de compensação de ressonância",                  // 594="Resonance compensation tuning"
-    "Reiniciar HelixScreen",                                 // 595="Restart HelixScreen"
-    "Reiniciar Klipper",                                     // 596="Restart Klipper"
-    "Reiniciar Agora",                                       // 597="Restart Now"
-    "Reinício Necessário",                                   // 598="Restart Required"
-    "Reiniciar o aplicativo de exibição", // 599="Restart the display application"
-    "Retomar",                            // 600="Resume"
-    "Retomar Impressão",                  // 601="Resume Print"
-    "Retrair",                            // 602="Retract"
-    "Comprimento de Retração",            // 603="Retract Length"
-    "Velocidade de Retração",             // 604="Retract Speed"
-    "Configurações de Retração",          // 605="Retraction Settings"
-    "Tentar Novamente",                   // 606="Retry"
-    "Revisar problemas de validação de hardware detectados",    // 607="Review detected hardware
-                                                                // validation issues"
-    "Revisar suas alterações",                                  // 608="Review your changes"
-    "Função:",                                                  // 609="Role:"
-    "Sensor de Fim de Filamento",                               // 610="Runout Sensor"
-    "MACROS PADRÃO",                                            // 611="STANDARD MACROS"
-    "PARAR",                                                    // 612="STOP"
-    "PROPRIEDADES DE ESTILO",                                   // 613="STYLE PROPERTIES"
-    "SISTEMA",                                                  // 614="SYSTEM"
-    "Salvar",                                                   // 615="Save"
-    "Salvar & Reiniciar",                                       // 616="Save & Restart"
-    "Salvar &amp; Reiniciar",                                   // 617="Save &amp; Restart"
-    "Salvar Como Novo",                                         // 618="Save As New"
-    "Salvar Configuração",                                      // 619="Save Config"
-    "Salvar Configuração da Impressora",                        // 620="Save Printer Configuration"
-    "Salvar Tema Como",                                         // 621="Save Theme As"
-    "Salvar Z-Offset",                                          // 622="Save Z-Offset"
-    "Salvar Z-Offset?",                                         // 623="Save Z-Offset?"
-    "Salvar alterações para persistir entre reinicializações?", // 624="Save changes to persist them
-                                                                // across restarts?"
-    "Salvando Configuração...",                                 // 625="Saving Configuration..."
-    "Salvar reiniciará o Klipper e CANCELARÁ qualquer impressão ativa!", // 626="Saving will restart
-                                                                         // Klipper and CANCEL any
-                                                                         // active print!"
-    "Escaneando redes...",   // 627="Scanning for networks..."
-    "Escurecimento da Tela", // 628="Screen Dim"
-    "A tela escurece para menor brilho após período de inatividade", // 629="Screen dims to lower
-                                                                     // brightness after period of
-                                                                     // inactivity"
-    "A tela escurecerá após o período selecionado de inatividade", // 630="Screen will dim after the
-                                                                   // selected period of inactivity"
-    "Velocidade de Rolagem",                                       // 631="Scroll Speed"
-    "Buscar nome do arquivo...",                                   // 632="Search filename..."
-    "Secundário",                                                  // 633="Secondary"
-    "Segurança",                                                   // 634="Security"
-    "Selecionar",                                                  // 635="Select"
-    "Selecione 'Nenhum' se você não tiver um sensor de filamento, ou se não quiser pausar quando "
-    "acabar.", // 636="Select 'None' if you don't have a filament sensor, or if you don't want to
-               // pause on runout."
-    "Selecione 'Nenhum' se você tiver uma sonda dedicada, ou não usar nivelamento por malha da "
-    "mesa.", // 637="Select 'None' if you have a dedicated probe, or don't use bed mesh leveling."
-    "Selecionar Filamento",                          // 638="Select Filament"
-    "Selecionar Arquivo",                            // 639="Select File"
-    "Selecionar Arquivo G-Code",                     // 640="Select G-Code File"
-    "Selecionar Aquecedor",                          // 641="Select Heater"
-    "Selecionar macro para o primeiro botão",        // 642="Select macro for first button"
-    "Selecionar macro para o segundo botão",         // 643="Select macro for second button"
-    "Selecionando slot...",                          // 644="Selecting slot..."
-    "Testes de Parâmetros de Tamanho Semântico",     // 645="Semantic Size Parameter Tests"
-    "Enviar comandos diretamente para a impressora", // 646="Send commands directly to printer"
-    "Sensores",                                      // 647="Sensors"
-    "Definir ",                                      // 648="Set "
-    "Configurações",                                 // 649="Settings"
-    "Intensidade da Sombra",                         // 650="Shadow Intensity"
-    "Shaper",                                        // 651="Shaper"
-    "Brilho:",                                       // 652="Shininess:"
-    "Mostrar status detalhado de preparação de impressão", // 653="Show detailed print preparation
-                                                           // status"
-    "Lateral",                                             // 654="Side"
-    "Tamanho",                                             // 655="Size"
-    "Pular por agora",                                     // 656="Skip for now"
-    "Slot 1",                                              // 657="Slot 1"
-    "Rótulos pequenos ajudam a manter os controles calmos e focados.", // 658="Small labels help
-                                                                       // keep controls calm and
-                                                                       // focused."
-    "Algumas configurações terão efeito após reiniciar.", // 659="Some settings will take effect
-                                                          // after restart."
-    "Sons",                                               // 660="Sounds"
-    "Especular:",                                         // 661="Specular:"
-    "Velocidade",                                         // 662="Speed"
-    "Configurações de Velocidade",                        // 663="Speed Settings"
-    "Velocidade do movimento de prime",                   // 664="Speed of prime movement"
-    "Velocidade do movimento de retração",                // 665="Speed of retraction movement"
-    "Velocidade:",                                        // 666="Speed:"
-    "Visualização de Carretel (Canvas Pseudo-3D)", // 667="Spool Visualization (Pseudo-3D Canvas)"
-    "Spoolman",                                    // 668="Spoolman"
-    "Spoolman não tem carretéis configurados",     // 669="Spoolman has no spools configured"
-    "Velocidade em Cantos Retos",                  // 670="Square Corner Velocity"
-    "Em Espera",                                   // 671="Standby"
-    "Iniciar Calibração",                          // 672="Start Calibration"
-    "Iniciar Sondagem",                            // 673="Start Probing"
-    "Iniciado",                                    // 674="Started"
-    "Status",                                      // 675="Status"
-    "Ícones de status",                            // 676="Status icons"
-    "Etapa",                                       // 677="Step"
-    "Teste do Widget de Progresso por Etapa",      // 678="Step Progress Widget Test"
-    "Parar",                                       // 679="Stop"
-    "Parar Secagem",                               // 680="Stop Drying"
-    "Parar Impressão?",                            // 681="Stop Print?"
-    "Para todo movimento. Requer reinício do firmware.", // 682="Stops all motion. Requires firmware
-                                                         // restart."
-    "Estilizado (valor=75)",                             // 683="Styled (value=75)"
-    "Taxa de Sucesso",                                   // 684="Success Rate"
-    "Sucesso!",                                          // 685="Success!"
-    "Superfícies herdam tokens de fundo do aplicativo para modos claro e escuro.", // 686="Surfaces
-                                                                                   // inherit app
-                                                                                   // background
-                                                                                   // tokens for
-                                                                                   // light and dark
-                                                                                   // modes."
-    "Sensores de Chave",                   // 687="Switch Sensors"
-    "Alternar entre temas claro e escuro", // 688="Switch between light and dark themes"
-    "Sincronizar com Spoolman",            // 689="Sync to Spoolman"
-    "Sincronizar com Spoolman",            // 690="Sync with Spoolman"
-    "Sysfs",                               // 691="Sysfs"
-    "Sistema detectado",                   // 692="System detected"
-    "Detecção de cor de filamento TD-1",   // 693="TD-1 filament color detection"
-    "CORES DO TEMA",                       // 694="THEME COLORS"
-    "TPU",                                 // 695="TPU"
-    "Toque para mostrar o teclado...",     // 696="Tap to show keyboard..."
-    "Alvo",                                // 697="Target"
-    "Temperatura Alvo",                    // 698="Target Temperature"
-    "Temperatura",                         // 699="Temperature"
-    "Temperaturas",                        // 700="Temperatures"
-    "Ajuste temporário para esta impressão, a menos que salvo no painel de Controles", // 701="Temporary
-                                                                                       // adjustment
-                                                                                       // for this
-                                                                                       // print,
-                                                                                       // unless
-                                                                                       // saved on
-                                                                                       // Controls
-                                                                                       // panel"
-    "Terciário",          // 702="Tertiary"
-    "Testar Conexão",     // 703="Test Connection"
-    "Testar Rede",        // 704="Test Network"
-    "Impressão de Teste", // 705="Test Print"
-    "O plugin HelixPrint permite modificações rápidas de G-code diretamente na sua impressora—como "
-    "pular malha da mesa para reimpressões rápidas.", // 706="The HelixPrint plugin enables fast
-                                                      // G-code modifications directly on your
-                                                      // printer—like skipping bed mesh for quick
-                                                      // reprints."
-    "O aquecedor ligará e desligará várias vezes.", // 707="The heater will cycle on and off several
-                                                    // times."
-    "Tema",                                         // 708="Theme"
-    "Cores do Tema",                                // 709="Theme Colors"
-    "Predefinição de Tema",                         // 710="Theme Preset"
-    "Alterações de tema aplicam após reiniciar.",   // 711="Theme changes apply after restart."
-    "Alterações de tema terão efeito após reiniciar.", // 712="Theme changes will take effect after
-                                                       // restart."
-    "Tema, brilho e configurações de suspensão", // 713="Theme, brightness, and sleep settings"
-    "Barra fina (altura=8)",                     // 714="Thin bar (height=8)"
-    "Esta calibração usa o método de fricção de papel para definir seu Z-offset.", // 715="This
-                                                                                   // calibration
-                                                                                   // uses the paper
-                                                                                   // friction
-                                                                                   // method to set
-                                                                                   // your
-                                                                                   // Z-offset."
-    "Isso pode levar 1-2 minutos",     // 716="This may take 1-2 minutes"
-    "Isso pode levar até 30 segundos", // 717="This may take up to 30 seconds"
-    "Este plugin permite que o HelixScreen controle opções de início de impressão como malha da "
-    "mesa e QGL. Após instalado, use Configurar PRINT_START abaixo para habilitar etapas "
-    "opcionais.", // 718="This plugin lets HelixScreen control print start options like bed mesh and
-                  // QGL. Once installed, use Configure PRINT_START below to enable optional steps."
-    "Este processo leva 3-5 minutos. Não interrompa.", // 719="This process takes 3-5 minutes. Do
-                                                       // not interrupt."
-    "Esta ferramenta sonda cada parafuso da mesa e informa quanto ajustar.", // 720="This tool
-                                                                             // probes each bed
-                                                                             // screw and tells you
-                                                                             // how much to adjust."
-    "Isso interromperá imediatamente todas as operações da impressora. A impressora precisará de "
-    "um reinício para retomar.", // 721="This will immediately halt all printer operations. The
-                                 // printer will require a restart to resume."
-    "Isso resetará todas as configurações para os padrões. Esta ação não pode ser desfeita.", // 722="This
-                                                                                              // will
-                                                                                              // reset
-                                                                                              // all
-                                                                                              // settings
-                                                                                              // to
-                                                                                              // defaults.
-                                                                                              // This
-                                                                                              // action
-                                                                                              // cannot
-                                                                                              // be
-                                                                                              // undone."
-    "Isso reiniciará o Klipper.",                       // 723="This will restart Klipper."
-    "Tempo",                                            // 724="Time"
-    "Formato de Hora",                                  // 725="Time Format"
-    "Timelapse",                                        // 726="Timelapse"
-    "Timelapse Disponível",                             // 727="Timelapse Available"
-    "Configurações de Timelapse",                       // 728="Timelapse Settings"
-    "Dica:",                                            // 729="Tip:"
-    "Alternar Recurso",                                 // 730="Toggle Feature"
-    "Ferramenta",                                       // 731="Tool"
-    "Trocador de Ferramentas",                          // 732="Tool Changer"
-    "Topo",                                             // 733="Top"
-    "Total de Impressões",                              // 734="Total Prints"
-    "Calibração de Toque",                              // 735="Touch Calibration"
-    "Toque em qualquer lugar para testar a calibração", // 736="Touch anywhere to test calibration"
-    "Toque na tela para acordar da suspensão",          // 737="Touch screen to wake from sleep"
-    "Deslocamentos",                                    // 738="Travels"
-    "Solução de Problemas:",                            // 739="Troubleshooting:"
-    "Ajustar",                                          // 740="Tune"
-    "Ajustar parâmetros PID do aquecedor",              // 741="Tune heater PID parameters"
-    "Ligar LED quando a impressora iniciar",            // 742="Turn on LED when printer starts"
-    "Tipo",                                             // 743="Type"
-    "Digite para visualizar o campo de entrada...",     // 744="Type to preview input field..."
-    "USB",                                              // 745="USB"
-    "Desinstalar Plugin HelixPrint",                    // 746="Uninstall HelixPrint Plugin"
-    "Desconhecido",                                     // 747="Unknown"
-    "Carretel Desconhecido",                            // 748="Unknown Spool"
-    "Etapa Desconhecida",                               // 749="Unknown Step"
-    "Descarregar",                                      // 750="Unload"
-    "Descarregar Filamento",                            // 751="Unload Filament"
-    "Descarregando filamento...",                       // 752="Unloading filament..."
-    "Extra de Desretração",                             // 753="Unretract Extra"
-    "Velocidade de Desretração",                        // 754="Unretract Speed"
-    "Faça upload de arquivos gcode para começar",       // 755="Upload gcode files to get started"
-    "Usar retração de firmware G10/G11",                // 756="Use G10/G11 firmware retraction"
-    "ValgACE (ACE Pro)",                                // 757="ValgACE (ACE Pro)"
-    "Os valores foram salvos na configuração da impressora.", // 758="Values have been saved to
-                                                              // printer configuration."
-    "Limites de velocidade e aceleração",          // 759="Velocity and acceleration limits"
-    "Fabricante",                                  // 760="Vendor"
-    "Versão",                                      // 761="Version"
-    "Progresso Vertical (Assistente de Retração)", // 762="Vertical Progress (Retract Wizard)"
-    "Vibração",                                    // 763="Vibration"
-    "Velocidade de reprodução do vídeo",           // 764="Video playback speed"
-    "Ver Histórico Completo",                      // 765="View Full History"
-    "Ver Predefinições",                           // 766="View Presets"
-    "Ver Timelapse",                               // 767="View Timelapse"
-    "Ver plugins instalados e status",             // 768="View installed plugins and status"
-    "Ver estatísticas de impressão e histórico de trabalhos", // 769="View print statistics and job
-                                                              // history"
-    "Aviso",                                                  // 770="Warning"
-    "Semana",                                                 // 771="Week"
-    "Dados de peso são sincronizados do Spoolman para exibir filamento restante. Alterações também "
-    "são sincronizadas quando impressões iniciam, pausam ou terminam.", // 772="Weight data is
-                                                                        // synced from Spoolman to
-                                                                        // display remaining
-                                                                        // filament. Changes are
-                                                                        // also synced when prints
-                                                                        // start, pause, or
-                                                                        // complete."
-    "Configurações de sincronização de peso",     // 773="Weight sync settings"
-    "Branco",                                     // 774="White"
-    "WiFi",                                       // 775="WiFi"
-    "Rede WiFi",                                  // 776="WiFi Network"
-    "WiFi e Ethernet",                            // 777="WiFi and Ethernet"
-    "Configuração de WiFi e Ethernet",            // 778="WiFi and Ethernet configuration"
-    "Controle WiFi indisponível",                 // 779="WiFi control unavailable"
-    "Hardware WiFi indisponível",                 // 780="WiFi hardware unavailable"
-    "Largura",                                    // 781="Width"
-    "Sensores de Largura",                        // 782="Width Sensors"
-    "X:",                                         // 783="X:"
-    "XY",                                         // 784="XY"
-    "Y:",                                         // 785="Y:"
-    "Ano",                                        // 786="Year"
-    "Suas impressões concluídas aparecerão aqui", // 787="Your completed prints will appear here"
-    "Z",                                          // 788="Z"
-    "Calibração Z",                               // 789="Z Calibration"
-    "Alcance Z",                                  // 790="Z Range"
-    "Sondas Z para nivelamento da mesa e geração de malha", // 791="Z probes for bed leveling and
-                                                            // mesh generation"
-    "Z-Offset",                                             // 792="Z-Offset"
-    "Calibração de Z-Offset",                               // 793="Z-Offset Calibration"
-    "Z-Offset:",                                            // 794="Z-Offset:"
-    "Ajuste Z-Tilt",                                        // 795="Z-Tilt Adjust"
-    "Z:",                                                   // 796="Z:"
-    "Z: 0.000",                                             // 797="Z: 0.000"
-    "Zoom",                                                 // 798="Zoom"
-    "^ FRENTE",                                             // 799="^ FRONT"
-    "hora",                                                 // 800="hour"
-    "horas",                                                // 801="hours"
-    "lg",                                                   // 802="lg"
-    "md",                                                   // 803="md"
-    "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-    "minuto",                               // 805="minute"
-    "minutos",                              // 806="minutes"
-    "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-    "segundos",                             // 808="seconds"
-    "size=\"large\"",                       // 809="size="large""
-    "size=\"medium\"",                      // 810="size="medium""
-    "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-    "size=\"small\"",                       // 812="size="small""
-    "size=\"tiny\"",                        // 813="size="tiny""
-    "sm",                                   // 814="sm"
-    "verdadeiro",                           // 815="true"
-    "value=0 (mostra CHEIO - BUG!)",        // 816="value=0 (shows FULL - BUG!)"
-    "value=1 (fatia pequena?)",             // 817="value=1 (tiny sliver?)"
-    "value=100 (deveria estar cheio)",      // 818="value=100 (should be full)"
-    "xs",                                   // 819="xs"
-    "Русский",                              // 820="Русский"
-    "—",                                    // 821="—"
-    "•",                                    // 822="•"
-    "中文",                                 // 823="中文"
-    "日本語",                               // 824="日本語"
-    "󰅐",                                 // 825="󰅐"
-    "󰉋",                                 // 826="󰉋"
-    "󱧰",                                 // 827="󱧰"
-};
-
-static const char* ru_singulars[] = {
-    " / ",                                           // 0=" / "
-    " 0 / 0",                                        // 1=" 0 / 0"
-    "#808080",                                       // 2="#808080"
-    "#RRGGBB",                                       // 3="#RRGGBB"
-    "(0)",                                           // 4="(0)"
-    "(2.4GHz)",                                      // 5="(2.4GHz)"
-    "+",                                             // 6="+"
-    "+0",                                            // 7="+0"
-    "+0.01мм",                                       // 8="+0.01mm"
-    "+0.05мм",                                       // 9="+0.05mm"
-    "+0.1мм",                                        // 10="+0.1mm"
-    "+1мм",                                          // 11="+1mm"
-    "-",                                             // 12="-"
-    "- Проверьте [resonance_tester] в printer.cfg",  // 13="- Check [resonance_tester] in
-                                                     // printer.cfg"
-    "- Убедитесь, что ADXL345 подключен",            // 14="- Ensure ADXL345 is connected"
-    "- Сначала попробуйте измерить шум",             // 15="- Try Measure Noise first"
-    "--",                                            // 16="--"
-    "---",                                           // 17="---"
-    "-0.01мм",                                       // 18="-0.01mm"
-    "-0.05мм",                                       // 19="-0.05mm"
-    "-0.1мм",                                        // 20="-0.1mm"
-    "-1мм",                                          // 21="-1mm"
-    "/",                                             // 22="/"
-    "0.4-2мм прямой привод, 4-6мм боуден",           // 23="0.4-2mm direct drive, 4-6mm bowden"
-    "1. Принтер паркуется и зондирует стол",         // 24="1. Printer homes and probes the bed"
-    "1. Принтер запаркуется и проверит каждый винт", // 25="1. Printer will home and probe each
-                                                     // screw"
-    "10мм",                                          // 26="10mm"
-    "1мм",                                           // 27="1mm"
-    "2. Положите бумагу между соплом и столом",      // 28="2. Place paper between nozzle and bed"
-    "2. Результаты покажут, насколько повернуть каждый винт", // 29="2. Results show how much to
-                                                              // turn each screw"
-    "200-230°C",                                              // 30="200-230°C"
-    "210°C / 60°C",                                           // 31="210°C / 60°C"
-    "230°C / 50°C",                                           // 32="230°C / 50°C"
-    "240°C / 80°C",                                           // 33="240°C / 80°C"
-    "250°C / 100°C",                                          // 34="250°C / 100°C"
-    "25мм",                                                   // 35="25mm"
-    "3. Отрегулируйте винты, затем перепроверьте", // 36="3. Adjust screws, then re-probe to verify"
-    "3. Опустите сопло, пока бумага не начнёт слегка цепляться", // 37="3. Lower nozzle until paper
-                                                                 // drags slightly"
-    "3D-просмотр",                                               // 38="3D Preview"
-    "4. Бумага должна двигаться, но с сопротивлением", // 39="4. Paper should move but with
-                                                       // resistance"
-    "4. Повторяйте, пока стол не выровняется",         // 40="4. Repeat until bed is level"
-    "5мм",                                             // 41="5mm"
-    "60°C",                                            // 42="60°C"
-    "6мм",                                             // 43="6mm"
-    "850г",                                            // 44="850g"
-    "= Ослабить",                                      // 45="= Loosen"
-    "= Затянуть",                                      // 46="= Tighten"
-    "?",                                               // 47="?"
-    "О ПРОГРАММЕ",                                     // 48="ABOUT"
-    "ABS",                                             // 49="ABS"
-    "Настройки AMS",                                   // 50="AMS Settings"
-    "ВНЕШНИЙ ВИД",                                     // 51="APPEARANCE"
-    "АВТОМАТИЗАЦИЯ",                                   // 52="AUTOMATION"
-    "Прервать",                                        // 53="Abort"
-    "О программе",                                     // 54="About"
-    "Ускорение к торможению",                          // 55="Accel to Decel"
-    "Предел ускорения к торможению (мм/с²)",     // 56="Acceleration to deceleration limit (mm/s²)"
-    "Акселерометры",                             // 57="Accelerometers"
-    "Принять",                                   // 58="Accept"
-    "Требуется действие",                        // 59="Action Required"
-    "Действия",                                  // 60="Actions"
-    "Активно",                                   // 61="Active"
-    "Текущая",                                   // 62="Actual"
-    "Добавить скрытую сеть",                     // 63="Add Hidden Network"
-    "Настроить уровень яркости экрана",          // 64="Adjust screen brightness level"
-    "Отрегулируйте винты, затем перепроверьте.", // 65="Adjust screws, then re-probe."
-    "Настройки активны до перезагрузки. Сохраните после завершения печати.", // 66="Adjustments stay
-                                                                             // active until
-                                                                             // restart. Save after
-                                                                             // print completes."
-    "Расширенные настройки",                         // 67="Advanced Setting"
-    "Все",                                           // 68="All"
-    "Все винты в пределах допуска.",                 // 69="All screws are within tolerance."
-    "Allwinner",                                     // 70="Allwinner"
-    "Количество:",                                   // 71="Amount:"
-    "На вашем принтере обнаружен акселерометр.",     // 72="An accelerometer was detected on your
-                                                     // printer."
-    "Во время калибровки произошла ошибка.",         // 73="An error occurred during calibration."
-    "Во время зондирования произошла ошибка.",       // 74="An error occurred during probing."
-    "Во время загрузки филамента произошла ошибка.", // 75="An error occurred while loading
-                                                     // filament."
-    "Анимации",                                      // 76="Animations"
-    "Фон приложения",                                // 77="App Background"
-    "Применить",                                     // 78="Apply"
-    "Применить изменения",                           // 79="Apply Changes"
-    "Применить только для этой сессии",              // 80="Apply saves for this session only"
-    "Применение...",                                 // 81="Applying..."
-    "Вы уверены, что хотите отменить печать? Весь прогресс будет потерян.", // 82="Are you sure you
-                                                                            // want to cancel this
-                                                                            // print? All progress
-                                                                            // will be lost."
-    "Назначить катушку",                                                    // 83="Assign Spool"
-    "Назначьте роль для мониторинга датчика", // 84="Assign a role to enable sensor monitoring"
-    "Назначение в слот 1",                    // 85="Assigning to Slot 1"
-    "Авто",                                   // 86="Auto"
-    "Авто сетка стола",                       // 87="Auto Bed Mesh"
-    "Автонагрев при загрузке",                // 88="Auto-Heat on Load"
-    "Автозондирование или ручная проверка высоты винтов", // 89="Auto-probe or manually check screw
-                                                          // heights"
-    "Автоматический рендер видео",                        // 90="Auto-render video"
-    "Автоматическая PID-калибровка",                      // 91="Automatic PID Calibration"
-    "Автоматически опрашивать Spoolman для обновления веса", // 92="Automatically poll Spoolman for
-                                                             // weight updates"
-    "Доступные сети",                                        // 93="Available Networks"
-    "Доступные сети",                                        // 94="Available networks"
-    "Назад",                                                 // 95="Back"
-    "Резервная копия",                                       // 96="Backup"
-    "Стол",                                                  // 97="Bed"
-    "Нагреватель стола",                                     // 98="Bed Heater"
-    "Уровень стола",                                         // 99="Bed Level"
-    "Выравнивание стола",                                    // 100="Bed Leveling"
-    "Сетка стола",                                           // 101="Bed Mesh"
-    "Рендер сетки стола",                                    // 102="Bed Mesh Render"
-    "Регулировка винтов стола",                              // 103="Bed Screw Adjustment"
-    "Винты стола",                                           // 104="Bed Screws"
-    "Стол выровнен!",                                        // 105="Bed is Level!"
-    "Стол °C",                                               // 106="Bed °C"
-    "Стол:",                                                 // 107="Bed:"
-    "Чёрный",                                                // 108="Black"
-    "Bluetooth",                                             // 109="Bluetooth"
-    "Основной текст поддерживает развёрнутые инструкции, оставаясь читаемым.", // 110="Body text
-                                                                               // supports longer
-                                                                               // guidance while
-                                                                               // staying readable."
-    "Прозрачность границы",                                 // 111="Border Opacity"
-    "Радиус скругления",                                    // 112="Border Radius"
-    "Толщина границы",                                      // 113="Border Width"
-    "Прозрачность границы (0 = невидимая, 255 = сплошная)", // 114="Border transparency (0 =
-                                                            // invisible, 255 = solid)"
-    "Яркость",                                              // 115="Brightness"
-    "Обзор",                                                // 116="Browse"
-    "Занят",                                                // 117="Busy"
-    "Обход",                                                // 118="Bypass"
-    "Режим обхода",                                         // 119="Bypass Mode"
-    "КАЛИБРОВКА",                                           // 120="CALIBRATION"
-    "ИЗМЕНЕНО С ПРОШЛОЙ СЕССИИ",                            // 121="CHANGED FROM LAST SESSION"
-    "ТРЕБУЕМЫЕ ЦВЕТА",                                      // 122="COLORS REQUIRED"
-    "КРИТИЧНО",                                             // 123="CRITICAL"
-    "Калибровать",                                          // 124="Calibrate"
-    "Калибровать X",                                        // 125="Calibrate X"
-    "Калибровать Y",                                        // 126="Calibrate Y"
-    "Калибровка компенсации резонанса",      // 127="Calibrate resonance compensation"
-    "Калибровка...",                         // 128="Calibrating..."
-    "Калибровка",                            // 129="Calibration"
-    "Калибровка и инструменты",              // 130="Calibration & Tools"
-    "Калибровка и инструменты",              // 131="Calibration &amp; Tools"
-    "Калибровка завершена!",                 // 132="Calibration Complete!"
-    "Ошибка калибровки",                     // 133="Calibration Failed"
-    "Отмена",                                // 134="Cancel"
-    "Отменить печать",                       // 135="Cancel Print"
-    "Отменено",                              // 136="Cancelled"
-    "Камера",                                // 137="Chamber"
-    "Вентилятор камеры",                     // 138="Chamber Fan"
-    "Мониторинг влажности камеры и сушилки", // 139="Chamber and dryer humidity monitoring"
-    "Камера:",                               // 140="Chamber:"
-    "Изменения применяются немедленно. Корректируйте во время печати.", // 141="Changes apply
-                                                                        // immediately. Adjust
-                                                                        // during print for tuning."
-    "Изменения временные и сбрасываются при перезагрузке принтера", // 142="Changes are temporary
-                                                                    // and reset on printer reboot"
-    "Проверьте путь филамента и попробуйте снова.", // 143="Check the filament path and try again."
-    "Проверка слотов...",                           // 144="Checking slots..."
-    "Выберите 12-часовой или 24-часовой формат времени", // 145="Choose 12-hour or 24-hour time
-                                                         // display"
-    "Выберите язык интерфейса",                          // 146="Choose display language"
-    "Выберите способ захвата кадров во время печати", // 147="Choose how frames are captured during
-                                                      // printing"
-    "Выберите режим рендеринга для визуализации G-code", // 148="Choose rendering mode for G-code
-                                                         // visualization"
-    "Выберите режим рендеринга для визуализации сетки стола", // 149="Choose rendering mode for bed
-                                                              // mesh visualization"
-    "Очистить сопло",                                         // 150="Clean Nozzle"
-    "Очистить",                                               // 151="Clear"
-    "Очистить всё",                                           // 152="Clear All"
-    "Очистить назначение",                                    // 153="Clear Assignment"
-    "Буфер обмена недоступен - используйте SSH",      // 154="Clipboard unavailable - use SSH"
-    "Закрыть",                                        // 155="Close"
-    "Ближе = больше сжатие | Дальше = меньше сжатие", // 156="Closer = more squish | Farther = less
-                                                      // squish"
-    "Датчики цвета",                                  // 157="Color Sensors"
-    "Завершено",                                      // 158="Complete"
-    "Завершено",                                      // 159="Completed"
-    "Завершено за 3 зондирования",                    // 160="Completed in 3 probes"
-    "Определено в конфигурации (только чтение)",      // 161="Config-defined (read-only)"
-    "Настроить аппаратный ретракт G10/G11",           // 162="Configure G10/G11 firmware retraction"
-    "Настроить PRINT_START",                          // 163="Configure PRINT_START"
-    "Настройте интеграцию со Spoolman и синхронизацию веса.", // 164="Configure Spoolman integration
-                                                              // and weight sync settings."
-    "Настроить устройства в Moonraker",               // 165="Configure devices in Moonraker"
-    "Настроить датчики обнаружения филамента",        // 166="Configure filament detection sensors"
-    "Настроить быстрые кнопки и стандартные макросы", // 167="Configure quick buttons and standard
-                                                      // macros"
-    "Настроить запись таймлапса",                     // 168="Configure timelapse recording"
-    "Подключить",                                     // 169="Connect"
-    "Подключен",                                      // 170="Connected"
-    "Подключение",                                    // 171="Connecting"
-    "Подключение к сети...",                          // 172="Connecting to network..."
-    "Подключение...",                                 // 173="Connecting..."
-    "Соединение",                                     // 174="Connection"
-    "Ошибка подключения. Проверьте пароль.",          // 175="Connection failed. Check password."
-    "Для продолжения соединение должно быть успешно проверено", // 176="Connection must be tested
-                                                                // successfully to continue"
-    "Консоль",                                                  // 177="Console"
-    "Управление дополнительными функциями начала печати",       // 178="Control optional print start
-                                                                // features"
-    "Охладить",                                                 // 179="Cool Down"
-    "Охлаждение",                                               // 180="Cooldown"
-    "Охлаждение",                                               // 181="Cooling"
-    "Копировать команду",                                       // 182="Copy Command"
-    "Скругление углов (0 = острые, 40 = очень круглые)", // 183="Corner roundness (0 = sharp, 40 =
-                                                         // very round)"
-    "Создать видео после завершения печати",             // 184="Create video when print completes"
-    "Текущая / Цель",                                    // 185="Current / Target"
-    "Текущая сетка",                                     // 186="Current Mesh"
-    "Текущая температура",                               // 187="Current Temperature"
-    "Текущая позиция Z",                                 // 188="Current Z Position"
-    "Текущее имя:",                                      // 189="Current name:"
-    "Сейчас загружен",                                   // 190="Currently Loaded"
-    "Сейчас печатается",                                 // 191="Currently printing"
-    "Настроить...",                                      // 192="Custom..."
-    "Обрезка филамента...",                              // 193="Cutting filament..."
-    "ДИАГНОСТИКА",                                       // 194="DIAGNOSTICS"
-    "ОТКЛЮЧЕНО",                                         // 195="DISABLED"
-    "Опасность",                                         // 196="Danger"
-    "Тёмный режим",                                      // 197="Dark Mode"
-    "День",                                              // 198="Day"
-    "По умолчанию (значение=50)",                        // 199="Default (value=50)"
-    "Толщина границы по умолчанию",                      // 200="Default border thickness"
-    "Определите макросы в вашем printer.cfg",            // 201="Define macros in your printer.cfg"
-    "Удалить",                                           // 202="Delete"
-    "Дельта:",                                           // 203="Delta:"
-    "Deutsch",                                           // 204="Deutsch"
-    "Операции с устройством",                            // 205="Device Operations"
-    "Отключить",                                         // 206="Disable"
-    "Обнаруженные принтеры",                             // 207="Discovered Printers"
-    "Отклонить",                                         // 208="Dismiss"
-    "Дисплей",                                           // 209="Display"
-    "Настройки дисплея",                                 // 210="Display Settings"
-    "Спящий режим экрана",                               // 211="Display Sleep"
-    "Не сохранять",                                      // 212="Don't Save"
-    "Больше не спрашивать",                              // 213="Don't ask again"
-    "Готово",                                            // 214="Done"
-    "Интенсивность тени (0 = отключено)",              // 215="Drop shadow strength (0 = disabled)"
-    "Сушилка",                                         // 216="Dryer"
-    "Управление сушилкой",                             // 217="Dryer Control"
-    "Длительность",                                    // 218="Duration"
-    "Экстренный стоп",                                 // 219="E-Stop"
-    "Подтверждение аварийной остановки",               // 220="E-Stop Confirmation"
-    "АВАРИЙНОЕ УПРАВЛЕНИЕ",                            // 221="EMERGENCY CONTROLS"
-    "АВАРИЙНАЯ ОСТАНОВКА",                             // 222="EMERGENCY STOP"
-    "Каждый вентилятор можно выбрать только один раз", // 223="Each fan can only be selected once"
-    "Редактировать",                                   // 224="Edit"
-    "Редактировать пресет",                            // 225="Edit Preset"
-    "Редактировать слот 1",                            // 226="Edit Slot 1"
-    "Редактировать цвета темы",                        // 227="Edit Theme Colors"
-    "Редактировать цвета темы (изменено)",             // 228="Edit Theme Colors (Modified)"
-    "Прошло",                                          // 229="Elapsed"
-    "Аварийная остановка",                             // 230="Emergency Stop"
-    "Аварийная остановка (M112)",                      // 231="Emergency Stop (M112)"
-    "Аварийная остановка?",                            // 232="Emergency Stop?"
-    "Пусто",                                           // 233="Empty"
-    "Пустые слоты отключают связанный функционал",     // 234="Empty slots disable the associated
-                                                       // functionality"
-    "Включить",                                        // 235="Enable"
-    "Включить мониторинг",                             // 236="Enable Monitoring"
-    "Включить ретракт",                                // 237="Enable Retraction"
-    "Включить таймлапс",                               // 238="Enable Timelapse"
-    "Включить эффекты движения интерфейса",            // 239="Enable UI motion effects"
-    "Включите WiFi для сканирования",                  // 240="Enable WiFi to scan"
-    "Включите WiFi для поиска сетей",                  // 241="Enable WiFi to scan for networks"
-    "Включить звуковую обратную связь",                // 242="Enable audio feedback"
-    "Включить детальное отслеживание подготовки к печати (рекомендуется)", // 243="Enable detailed
-                                                                           // print preparation
-                                                                           // tracking
-                                                                           // (Recommended)"
-    "Включено",                                                            // 244="Enabled"
-    "Завершено",                                                           // 245="Ended"
-    "English",                                                             // 246="English"
-    "Улучшение завершено!",               // 247="Enhancement Complete!"
-    "Ошибка улучшения",                   // 248="Enhancement Failed"
-    "Введите G-code команду...",          // 249="Enter G-code command..."
-    "Введите пароль WiFi",                // 250="Enter WiFi Password"
-    "Введите название для вашей темы:",   // 251="Enter a name for your custom theme:"
-    "Введите имя для сохранения профиля", // 252="Enter a name to save this profile"
-    "Введите название сети",              // 253="Enter network name"
-    "Введите пароль",                     // 254="Enter password"
-    "Ошибка",                             // 255="Error"
-    "Состояние ошибки",                   // 256="Error state"
-    "Español",                            // 257="Español"
-    "Ethernet",                           // 258="Ethernet"
-    "Исключить",                          // 259="Exclude"
-    "Выполнить макросы принтера",         // 260="Execute printer macros"
-    "Вытяжной вентилятор",                // 261="Exhaust Fan"
-    "Изучите, как выбранная палитра влияет на текст, элементы управления и цвета статуса.", // 262="Explore
-                                                                                            // how
-                                                                                            // the
-                                                                                            // selected
-                                                                                            // palette
-                                                                                            // shapes
-                                                                                            // text,
-                                                                                            // controls,
-                                                                                            // and
-                                                                                            // status
-                                                                                            // colors."
-    "Изучить палитру и предпросмотр",                  // 263="Explore palette and preview"
-    "Дополнительная подача для компенсации вытекания", // 264="Extra prime to compensate ooze"
-    "Экструдировать",                                  // 265="Extrude"
-    "Экструзия / Ретракт",                             // 266="Extrude / Retract"
-    "Экструдер",                                       // 267="Extruder"
-    "PID-настройка экструдера",                        // 268="Extruder PID Tuning"
-    "Экструдер нагревается автоматически в зависимости от материала", // 269="Extruder heats
-                                                                      // automatically based on
-                                                                      // material"
-    "Скорость экструзии",                                             // 270="Extrusion rate"
-    "ОШИБКА",                                                         // 271="FAILED"
-    "ФИЛАМЕНТ",                                                       // 272="FILAMENT"
-    "Сброс к заводским настройкам",                                   // 273="Factory Reset"
-    "Ошибка",                                                         // 274="Failed"
-    "Не удалось сохранить файл темы",                    // 275="Failed to save theme file"
-    "Подать филамент напрямую в экструдер",              // 276="Feed filament directly to extruder"
-    "Филамент",                                          // 277="Filament"
-    "Датчик филамента",                                  // 278="Filament Sensor"
-    "Датчики филамента",                                 // 279="Filament Sensors"
-    "Использовано филамента",                            // 280="Filament Used"
-    "Филамент по типу",                                  // 281="Filament by Type"
-    "Датчики диаметра филамента для компенсации потока", // 282="Filament diameter sensors for flow
-                                                         // compensation"
-    "Датчики окончания и движения филамента", // 283="Filament runout and motion detection sensors"
-    "Отслеживание и учёт филамента",          // 284="Filament tracking and inventory"
-    "Файл",                                   // 285="File"
-    "Информация о файле",                     // 286="File Info"
-    "Имя файла",                              // 287="Filename"
-    "Файлы",                                  // 288="Files"
-    "Заполнение: 100% / 75% / 40% / 10%",     // 289="Fill: 100% / 75% / 40% / 10%"
-    "Перезапуск прошивки",                    // 290="Firmware Restart"
-    "Плоские концентрические кольца (существующий ams_slot)", // 291="Flat Concentric Rings
-                                                              // (existing ams_slot)"
-    "Скорость потока",                                        // 292="Flow Rate"
-    "Формирование кончика...",                                // 293="Forming tip..."
-    "Частота кадров",                                         // 294="Framerate"
-    "Français",                                               // 295="Français"
-    "Частота",                                                // 296="Freq"
-    "Спереди",                                                // 297="Front"
-    "Консоль G-code",                                         // 298="G-code Console"
-    "Просмотр G-code",                                        // 299="G-code Preview"
-    "Здесь будут отображаться G-code команды", // 300="G-code commands will appear here"
-    "Тень:",                                   // 301="Ghost:"
-    "Серый",                                   // 302="Gray"
-    "Happy Hare MMU",                          // 303="Happy Hare MMU"
-    "Оборудование",                            // 304="Hardware"
-    "Состояние оборудования",                  // 305="Hardware Health"
-    "Проблемы оборудования",                   // 306="Hardware Issues"
-    "Название оборудования",                   // 307="Hardware Name"
-    "Оборудование проверяется при запуске и переподключении", // 308="Hardware is validated on
-                                                              // startup and reconnection"
-    "Подготовьте лист бумаги перед началом.", // 309="Have a piece of paper ready before starting."
-    "Подготовьте инструмент для регулировки стола (отвёртку, шестигранник и т.д.), если стол не "
-    "регулируется                              барашками или другим встроенным механизмом.", // 310="Have
-                                                                                             // your
-                                                                                             // bed
-                                                                                             // adjustment
-                                                                                             // tool
-                                                                                             // (screwdriver,
-                                                                                             // hex-key,
-                                                                                             // etc.)
-                                                                                             // ready
-                                                                                             // if
-                                                                                             // your
-                                                                                             // bed
-                                                                                             // isn't
-                                                                                             // adjusted
-                                                                                             // with
-                                                                                             // thumb
-                                                                                             // wheels
-                                                                                             // or
-                                                                                             // some
-                                                                                             // other
-                                                                                             // built-in
-                                                                                             // mechanism."
-    "Заголовок",                       // 311="Heading"
-    "Прогрев",                         // 312="Heat Soak"
-    "Нагрейте до 170°C для экструзии", // 313="Heat to 170°C to extrude"
-    "Температура стола",               // 314="Heatbed Temperature"
-    "Подогреваемый стол",              // 315="Heated Bed"
-    "Нагрев...",                       // 316="Heating..."
-    "HelixScreen аварийно завершился", // 317="HelixScreen Crashed"
-    "HelixScreen интегрируется с вашим сменщиком филамента для многокатушечной/многоцветной "
-    "печати.", // 318="HelixScreen will integrate with your filament changer for multi-spool/color
-               // print operations."
-    "Выше = быстрее",                                // 319="Higher = faster"
-    "Главная",                                       // 320="Home"
-    "Домой все",                                     // 321="Home All"
-    "Домой X",                                       // 322="Home X"
-    "Домой Y",                                       // 323="Home Y"
-    "Домой Z",                                       // 324="Home Z"
-    "Горизонтальный прогресс (мастер выравнивания)", // 325="Horizontal Progress (Leveling Wizard)"
-    "Хост",                                          // 326="Host"
-    "Хотенд",                                        // 327="Hotend"
-    "Вентилятор хотенда",                            // 328="Hotend Fan"
-    "Нагреватель хотенда",                           // 329="Hotend Heater"
-    "Как часто проверять Spoolman на обновления веса", // 330="How often to check Spoolman for
-                                                       // weight updates"
-    "Влажность",                                       // 331="Humidity"
-    "Датчики влажности",                               // 332="Humidity Sensors"
-    "IP:",                                             // 333="IP:"
-    "Ожидание",                                        // 334="Idle"
-    "Игнорировать",                                    // 335="Ignore"
-    "В процессе",                                      // 336="In Progress"
-    "Индексация G-code...",                            // 337="Indexing G-code..."
-    "Инициализация...",                                // 338="Initializing..."
-    "Ввод",                                            // 339="Input"
-    "Компенсатор вибраций",                            // 340="Input Shaper"
-    "Компенсация вибраций",                            // 341="Input Shaping"
-    "Датчики калибровки компенсатора вибраций",        // 342="Input shaper calibration sensors"
-    "Компенсация вибраций уменьшает артефакты вибрации (звон) в ваших отпечатках.", // 343="Input
-                                                                                    // shaping
-                                                                                    // reduces
-                                                                                    // vibration
-                                                                                    // artifacts
-                                                                                    // (ringing) in
-                                                                                    // your prints."
-    "Установить плагин HelixPrint", // 344="Install HelixPrint Plugin"
-    "Установить плагин",            // 345="Install Plugin"
-    "Установите плагин HelixPrint для быстрой модификации G-code. Выполните эту команду через SSH "
-    "на вашем принтере:", // 346="Install the HelixPrint plugin to enable fast G-code modifications.
-                          // Run this command via SSH on your printer:"
-    "Ошибка установки",   // 347="Installation Failed"
-    "Установка занимает около 30 секунд.",     // 348="Installation takes about 30 seconds."
-    "Установка...",                            // 349="Installing..."
-    "Интенсивность",                           // 350="Intensity"
-    "Интерактивный 3D G-code во время печати", // 351="Interactive 3D G-code during prints"
-    "Интерактивная калибровка зонда",          // 352="Interactive probe calibration"
-    "Описание проблемы",                       // 353="Issue description"
-    "Italiano",                                // 354="Italiano"
-    "Только что",                              // 355="Just now"
-    "Kd:",                                     // 356="Kd:"
-    "Продолжить печать",                       // 357="Keep Printing"
-    "Оставить обязательным",                   // 358="Keep Required"
-    "Тест клавиатуры (стиль Gboard)",          // 359="Keyboard Test (Gboard-style)"
-    "Ki:",                                     // 360="Ki:"
-    "Klipper",                                 // 361="Klipper"
-    "Klipper перешёл в состояние остановки. Это может быть вызвано аварийной остановкой, тепловым "
-    "разгоном или ошибкой конфигурации.", // 362="Klipper has entered shutdown state. This may be
-                                          // due to an emergency stop, thermal runaway, or
-                                          // configuration error."
-    "Klipper перезапустится для применения изменений",  // 363="Klipper will restart to apply
-                                                        // changes"
-    "Klipper перезапустится для применения изменений.", // 364="Klipper will restart to apply
-                                                        // changes."
-    "Klipper перезапустится для применения новых значений PID.", // 365="Klipper will restart to
-                                                                 // apply new PID values."
-    "Kp:",                                                       // 366="Kp:"
-    "LED-лента",                                                 // 367="LED Strip"
-    "Включать LED при старте",                                   // 368="LED on at Start"
-    "ЗАГРУЖЕН",                                                  // 369="LOADED"
-    "Язык",                                                      // 370="Language"
-    "Последние 7 дней",                                          // 371="Last 7 days"
-    "Последняя печать отменена",                                 // 372="Last print cancelled"
-    "Последняя печать не удалась",                               // 373="Last print failed"
-    "Позже",                                                     // 374="Later"
-    "Слой",                                                      // 375="Layer"
-    "Высота слоя",                                               // 376="Layer Height"
-    "Послойный режим захватывает один кадр на каждую смену слоя. Лучший выбор для большинства "
-    "печатей.",  // 377="Layer mode captures one frame per layer change. Best for most prints."
-    "Слой:",     // 378="Layer:"
-    "Слои",      // 379="Layers"
-    "Длина:",    // 380="Length:"
-    "Светлый",   // 381="Light"
-    "Загрузить", // 382="Load"
-    "Загрузить филамент",                // 383="Load Filament"
-    "Загружен",                          // 384="Loaded"
-    "Ошибка загрузки",                   // 385="Loading Error"
-    "Загрузка G-code...",                // 386="Loading G-code..."
-    "Загрузка филамента...",             // 387="Loading filament..."
-    "Загрузка истории...",               // 388="Loading history..."
-    "Загрузка катушек...",               // 389="Loading spools..."
-    "Загрузка...",                       // 390="Loading..."
-    "Заблокировано во время печати",     // 391="Locked during print"
-    "M для переключения",                // 392="M to toggle"
-    "MAC:",                              // 393="MAC:"
-    "Иконки MDI",                        // 394="MDI Icons"
-    "ОТСУТСТВУЕТ НАСТРОЕННОЕ",           // 395="MISSING CONFIGURED"
-    "ДВИЖЕНИЕ",                          // 396="MOTION"
-    "Ограничения принтера",              // 397="Machine Limits"
-    "Обзор макросов",                    // 398="Macro Browser"
-    "Кнопки макросов",                   // 399="Macro Buttons"
-    "Макрос для калибровки сетки стола", // 400="Macro for bed mesh calibration"
-    "Макрос для прогрева камеры/стола",  // 401="Macro for chamber/bed heat soak"
-    "Макрос для механического выравнивания стола (QGL/Z-Tilt)", // 402="Macro for physical bed
-                                                                // leveling (QGL/Z-Tilt)"
-    "Макрос для отмены активной печати",         // 403="Macro to cancel an active print"
-    "Макрос для очистки/протирки сопла",         // 404="Macro to clean/wipe the nozzle"
-    "Макрос для загрузки филамента в экструдер", // 405="Macro to load filament into extruder"
-    "Макрос для паузы активной печати",          // 406="Macro to pause an active print"
-    "Макрос для продувки/подготовки сопла",      // 407="Macro to purge/prime the nozzle"
-    "Макрос для возобновления приостановленной печати", // 408="Macro to resume a paused print"
-    "Макрос для выгрузки филамента из экструдера", // 409="Macro to unload filament from extruder"
-    "Макросы",                                     // 410="Macros"
-    "Основная LED-лента",                          // 411="Main LED Strip"
-    "Сделать опциональным",                        // 412="Make Optional"
-    "Сделать сетку стола и QGL пропускаемыми",     // 413="Make bed mesh and QGL skippable"
-    "Управление",                                  // 414="Manage"
-    "Ручное выравнивание стола",                   // 415="Manual Bed Leveling"
-    "Материал",                                    // 416="Material"
-    "Индикатор загрузки Material Design",          // 417="Material Design Spinner"
-    "Макс. ускорение",                             // 418="Max Acceleration"
-    "Макс. скорость",                              // 419="Max Velocity"
-    "Макс. ускорение Z",                           // 420="Max Z Accel"
-    "Макс. скорость Z",                            // 421="Max Z Velocity"
-    "Макс. скорость на поворотах (мм/с)",          // 422="Max speed through corners (mm/s)"
-    "Максимальное ускорение (мм/с²)",              // 423="Maximum acceleration (mm/s²)"
-    "Максимальная скорость печатающей головки (мм/с)", // 424="Maximum toolhead speed (mm/s)"
-    "Измерить шум",                                    // 425="Measure Noise"
-    "Память (МБ)",                                     // 426="Memory (MB)"
-    "Сетка завершена",                                 // 427="Mesh Complete"
-    "Режим",                                           // 428="Mode"
-    "Изменён",                                         // 429="Modified"
-    "Месяц",                                           // 430="Month"
-    "Moonraker",                                       // 431="Moonraker"
-    "Движение",                                        // 432="Motion"
-    "Движение: XYZ",                                   // 433="Motion: XYZ"
-    "Отключить моторы",                                // 434="Motors Off"
-    "Движение",                                        // 435="Move"
-    "Двигайте бумагу вперёд-назад во время регулировки. Остановитесь, когда бумага слегка "
-    "цепляется, но ещё скользит.",    // 436="Move paper back and forth while adjusting. Stop when
-                                      // paper catches slightly but still slides."
-    "Скорость движения",              // 437="Movement speed"
-    "Мульти-филамент",                // 438="Multi-Filament"
-    "Мульти-материал",                // 439="Multi-Material"
-    "Моя тема",                       // 440="My Custom Theme"
-    "Моя панель",                     // 441="My Panel"
-    "Мой принтер",                    // 442="My Printer"
-    "НЕДАВНО ОБНАРУЖЕНО",             // 443="NEWLY DISCOVERED"
-    "УВЕДОМЛЕНИЯ",                    // 444="NOTIFICATIONS"
-    "Название",                       // 445="Name"
-    "Сетевой адрес",                  // 446="Network Address"
-    "Название сети",                  // 447="Network Name"
-    "Название сети (SSID)",           // 448="Network Name (SSID)"
-    "Сетевые настройки",              // 449="Network Settings"
-    "Тест сети",                      // 450="Network Test"
-    "Никогда",                        // 451="Never"
-    "Новые значения PID",             // 452="New PID Values"
-    "Новое Z-смещение: 0.000",        // 453="New Z-Offset: 0.000"
-    "Новое имя профиля",              // 454="New profile name"
-    "Далее",                          // 455="Next"
-    "AMS-система не подключена.",     // 456="No AMS system connected."
-    "Нет истории",                    // 457="No History"
-    "Макросы не найдены",             // 458="No Macros Found"
-    "Нет устройств питания",          // 459="No Power Devices"
-    "Нет катушек",                    // 460="No Spools"
-    "Файл не загружен",               // 461="No file loaded"
-    "Нет файлов для печати",          // 462="No files available for printing"
-    "Сетка не загружена",             // 463="No mesh loaded"
-    "Сети не найдены",                // 464="No networks found"
-    "Нет уведомлений",                // 465="No notifications"
-    "Плагины не найдены",             // 466="No plugins found"
-    "Нет предпросмотра",              // 467="No preview"
-    "Истории печати пока нет",        // 468="No print history yet"
-    "Макрос старта печати не найден", // 469="No print start macro found"
-    "Профили недоступны",             // 470="No profiles available"
-    "Датчики не обнаружены",          // 471="No sensors detected"
-    "Катушки недоступны",             // 472="No spools available"
-    "Не сейчас",                      // 473="Not Now"
-    "Не подключен",                   // 474="Not connected"
-    "Уведомления",                    // 475="Notifications"
-    "Уведомить о завершении печати",  // 476="Notify when print finishes"
-    "Сопло",                          // 477="Nozzle"
-    "Подготовка сопла",               // 478="Nozzle Priming"
-    "Темп. сопла",                    // 479="Nozzle Temp"
-    "Температура сопла",              // 480="Nozzle Temperature"
-    "Сопло °C",                       // 481="Nozzle °C"
-    "Сопло:",                         // 482="Nozzle:"
-    "OK",                             // 483="OK"
-    "Выкл",                           // 484="Off"
-    "Не в сети",                      // 485="Offline"
-    "Вкл",                            // 486="On"
-    "Открыть",                        // 487="Open"
-    "Операции",                       // 488="Operations"
-    "Оптимизируйте вашу печать",      // 489="Optimize Your Printing"
-    "Или введите вручную",            // 490="Or Enter Manually"
-    "PETG",                           // 491="PETG"
-    "PID-настройка",                  // 492="PID Tuning"
-    "PID-настройка оптимизирует контроль температуры для стабильного нагрева.", // 493="PID tuning
-                                                                                // optimizes
-                                                                                // temperature
-                                                                                // control for
-                                                                                // stable heating."
-    "PLA",                                                                      // 494="PLA"
-    "PLA - Чёрный",                                                             // 495="PLA - Black"
-    "ЭТАПЫ ПОДГОТОВКИ",                    // 496="PRE-PRINT STEPS"
-    "ПРИНТЕР",                             // 497="PRINTER"
-    "Калибровка бумажным тестом",          // 498="Paper Test Calibration"
-    "Вентилятор охлаждения детали",        // 499="Part Cooling Fan"
-    "Вент. детали",                        // 500="Part Fan"
-    "Пароль",                              // 501="Password"
-    "Пароль не может быть пустым",         // 502="Password cannot be empty"
-    "Пауза",                               // 503="Pause"
-    "Приостановлено",                      // 504="Paused"
-    "Приостановлено (требуется внимание)", // 505="Paused (attention needed)"
-    "Пик:",                                // 506="Peak:"
-    "Отслеживание фазы",                   // 507="Phase Tracking"
-    "Выбрать цвет",                        // 508="Pick Color"
-    "Поместите плагины в директорию plugins для расширения HelixScreen", // 509="Place plugins in
-                                                                         // the plugins directory to
-                                                                         // extend HelixScreen"
-    "Введите название темы",                                      // 510="Please enter a theme name"
-    "Пожалуйста, подождите, пока принтер паркуется и зондирует.", // 511="Please wait while the
-                                                                  // printer homes and probes."
-    "Пожалуйста, подождите, пока принтер проверяет позицию каждого винта.", // 512="Please wait
-                                                                            // while the printer
-                                                                            // probes each screw
-                                                                            // position."
-    "Плагин успешно установлен.",                    // 513="Plugin installed successfully."
-    "Плагины",                                       // 514="Plugins"
-    "Плагины обнаруживаются при запуске приложения", // 515="Plugins are discovered on application
-                                                     // startup"
-    "Polymaker",                                     // 516="Polymaker"
-    "Порт",                                          // 517="Port"
-    "Português",                                     // 518="Português"
-    "Позиция",                                       // 519="Position"
-    "Питание",                                       // 520="Power"
-    "Управление питанием",                           // 521="Power Control"
-    "Прогрев",                                       // 522="Preheat"
-    "Подготовка печати",                             // 523="Preparing Print"
-    "Подготовка...",                                 // 524="Preparing..."
-    "Пресеты",                                       // 525="Presets"
-    "Назад",                                         // 526="Previous"
-    "Основной",                                      // 527="Primary"
-    "Печать",                                        // 528="Print"
-    "Печать отменена",                               // 529="Print Cancelled"
-    "Печать завершена",                              // 530="Print Complete"
-    "Печать завершена!",                             // 531="Print Complete!"
-    "Уведомление о завершении печати",               // 532="Print Completion Alert"
-    "Детали печати",                                 // 533="Print Details"
-    "Файл печати",                                   // 534="Print File"
-    "Файлы печати",                                  // 535="Print Files"
-    "История печати",                                // 536="Print History"
-    "Часы печати",                                   // 537="Print Hours"
-    "Скорость печати",                               // 538="Print Speed"
-    "Статус печати",                                 // 539="Print Status"
-    "Время печати",                                  // 540="Print Time"
-    "Настройка печати",                              // 541="Print Tuning"
-    "Принтер",                                       // 542="Printer"
-    "Название принтера",                             // 543="Printer Name"
-    "Остановка принтера",                            // 544="Printer Shutdown"
-    "Тип принтера",                                  // 545="Printer Type"
-    "Печать",                                        // 546="Printing"
-    "Тренд печатей",                                 // 547="Prints Trend"
-    "Закрытая:",                                     // 548="Private:"
-    "Зонд",                                          // 549="Probe"
-    "Датчик зонда",                                  // 550="Probe Sensor"
-    "Датчики зонда",                                 // 551="Probe Sensors"
-    "Зондирование сетки стола",                      // 552="Probing Bed Mesh"
-    "Проверка винтов стола...",                      // 553="Probing Bed Screws..."
-    "Зондирование стола...",                         // 554="Probing Bed..."
-    "Ошибка зондирования",                           // 555="Probing Failed"
-    "Обработка...",                                  // 556="Processing..."
-    "Профиль",                                       // 557="Profile"
-    "Имя профиля (например, default)",               // 558="Profile name (e.g., default)"
-    "Профили",                                       // 559="Profiles"
-    "Прогресс",                                      // 560="Progress"
-    "Тесты прогресс-бара",                           // 561="Progress Bar Tests"
-    "Продуть",                                       // 562="Purge"
-    "Продуть 50мм",                                  // 563="Purge 50mm"
-    "БЫСТРЫЕ КНОПКИ",                                // 564="QUICK BUTTONS"
-    "Выравнивание портала",                          // 565="Quad Gantry Level"
-    "Быстрые действия",                              // 566="Quick Actions"
-    "Быстрая кнопка 1",                              // 567="Quick Button 1"
-    "Быстрая кнопка 2",                              // 568="Quick Button 2"
-    "Быстрые действия, калибровка, скорость",        // 569="Quick actions, calibration, speed"
-    "RSS:",                                          // 570="RSS:"
-    "Перепроверить",                                 // 571="Re-probe"
-    "Готов",                                         // 572="Ready"
-    "Рекомендуется",                                 // 573="Recommended"
-    "Рекомендуется: 200°C для экструдера",           // 574="Recommended: 200°C for extruder"
-    "Записать таймлапс",                             // 575="Record Timelapse"
-    "Записывайте таймлапсы ваших печатей",           // 576="Record timelapses of your prints"
-    "Режим записи",                                  // 577="Recording Mode"
-    "Восстановить",                                  // 578="Recover"
-    "Уменьшить звон",                                // 579="Reduce Ringing"
-    "Обновить",                                      // 580="Refresh"
-    "Интервал обновления",                           // 581="Refresh Interval"
-    "Осталось",                                      // 582="Remaining"
-    "Удалить плагин с принтера",                     // 583="Remove plugin from printer"
-    "Переименовать",                                 // 584="Rename"
-    "Переименовать профиль сетки",                   // 585="Rename Mesh Profile"
-    "Повторить печать",                              // 586="Reprint"
-    "Требовать подтверждение перед аварийной остановкой", // 587="Require confirmation before
-                                                          // emergency stop"
-    "Требуется плагин Moonraker-Timelapse",          // 588="Requires Moonraker-Timelapse plugin"
-    "Сброс",                                         // 589="Reset"
-    "Сбросить скорость и поток на 100%",             // 590="Reset Speed & Flow to 100%"
-    "Сбросить скорость и поток на 100%",             // 591="Reset Speed &amp; Flow to 100%"
-    "Сбросить все настройки и перезапустить мастер", // 592="Reset all settings and restart wizard"
-    "Сброс...",                                      // 593="Resetting..."
-    "Настройка компенсации резонанса",               // 594="Resonance compensation tuning"
-    "Перезапустить HelixScreen",                     // 595="Restart HelixScreen"
-    "Перезапустить Klipper",                         // 596="Restart Klipper"
-    "Перезапустить сейчас",                          // 597="Restart Now"
-    "Требуется перезапуск",                          // 598="Restart Required"
-    "Перезапустить приложение дисплея",              // 599="Restart the display application"
-    "Продолжить",                                    // 600="Resume"
-    "Продолжить печать",                             // 601="Resume Print"
-    "Втянуть",                                       // 602="Retract"
-    "Длина ретракта",                                // 603="Retract Length"
-    "Скорость ретракта",                             // 604="Retract Speed"
-    "Настройки ретракта",                            // 605="Retraction Settings"
-    "Повторить",                                     // 606="Retry"
-    "Просмотр обнаруженных проблем валидации оборудования", // 607="Review detected hardware
-                                                            // validation issues"
-    "Просмотр ваших изменений",                             // 608="Review your changes"
-    "Роль:",                                                // 609="Role:"
-    "Датчик окончания",                                     // 610="Runout Sensor"
-    "СТАНДАРТНЫЕ МАКРОСЫ",                                  // 611="STANDARD MACROS"
-    "СТОП",                                                 // 612="STOP"
-    "СВОЙСТВА СТИЛЯ",                                       // 613="STYLE PROPERTIES"
-    "СИСТЕМА",                                              // 614="SYSTEM"
-    "Сохранить",                                            // 615="Save"
-    "Сохранить и перезапустить",                            // 616="Save & Restart"
-    "Сохранить и перезапустить",                            // 617="Save &amp; Restart"
-    "Сохранить как новый",                                  // 618="Save As New"
-    "Сохранить конфигурацию",                               // 619="Save Config"
-    "Сохранить конфигурацию принтера",                      // 620="Save Printer Configuration"
-    "Сохранить тему как",                                   // 621="Save Theme As"
-    "Сохранить Z-смещение",                                 // 622="Save Z-Offset"
-    "Сохранить Z-смещение?",                                // 623="Save Z-Offset?"
-    "Сохранить изменения, чтобы они сохранились после перезапуска?", // 624="Save changes to persist
-                                                                     // them across restarts?"
-    "Сохранение конфигурации...", // 625="Saving Configuration..."
-    "Сохранение перезапустит Klipper и ОТМЕНИТ любую активную печать!", // 626="Saving will restart
-                                                                        // Klipper and CANCEL any
-                                                                        // active print!"
-    "Поиск сетей...",                               // 627="Scanning for networks..."
-    "Затемнение экрана",                            // 628="Screen Dim"
-    "Экран затемняется после периода неактивности", // 629="Screen dims to lower brightness after
-                                                    // period of inactivity"
-    "Экран затемнится после выбранного периода неактивности", // 630="Screen will dim after the
-                                                              // selected period of inactivity"
-    "Скорость прокрутки",                                     // 631="Scroll Speed"
-    "Поиск файла...",                                         // 632="Search filename..."
-    "Вторичный",                                              // 633="Secondary"
-    "Безопасность",                                           // 634="Security"
-    "Выбрать",                                                // 635="Select"
-    "Выберите 'Нет', если у вас нет датчика филамента или вы не хотите паузу при окончании.", // 636="Select
-                                                                                              // 'None'
-                                                                                              // if
-                                                                                              // you
-                                                                                              // don't
-                                                                                              // have
-                                                                                              // a
-                                                                                              // filament
-                                                                                              // sensor,
-                                                                                              // or
-                                                                                              // if
-                                                                                              // you
-                                                                                              // don't
-                                                                                              // want
-                                                                                              // to
-                                                                                              // pause
-                                                                                              // on
-                                                                                              // runout."
-    "Выберите 'Нет', если у вас отдельный зонд или вы не используете сетку стола.", // 637="Select
-                                                                                    // 'None' if you
-                                                                                    // have a
-                                                                                    // dedicated
-                                                                                    // probe, or
-                                                                                    // don't use bed
-                                                                                    // mesh
-                                                                                    // leveling."
-    "Выбрать филамент",                                // 638="Select Filament"
-    "Выбрать файл",                                    // 639="Select File"
-    "Выбрать файл G-Code",                             // 640="Select G-Code File"
-    "Выбрать нагреватель",                             // 641="Select Heater"
-    "Выберите макрос для первой кнопки",               // 642="Select macro for first button"
-    "Выберите макрос для второй кнопки",               // 643="Select macro for second button"
-    "Выбор слота...",                                  // 644="Selecting slot..."
-    "Тесты семантических параметров размера",          // 645="Semantic Size Parameter Tests"
-    "Отправлять команды напрямую принтеру",            // 646="Send commands directly to printer"
-    "Датчики",                                         // 647="Sensors"
-    "Установить ",                                     // 648="Set "
-    "Настройки",                                       // 649="Settings"
-    "Интенсивность тени",                              // 650="Shadow Intensity"
-    "Шейпер",                                          // 651="Shaper"
-    "Блеск:",                                          // 652="Shininess:"
-    "Показывать детальный статус подготовки к печати", // 653="Show detailed print preparation
-                                                       // status"
-    "Сбоку",                                           // 654="Side"
-    "Размер",                                          // 655="Size"
-    "Пропустить",                                      // 656="Skip for now"
-    "Слот 1",                                          // 657="Slot 1"
-    "Мелкие надписи помогают сохранять элементы управления аккуратными.", // 658="Small labels help
-                                                                          // keep controls calm and
-                                                                          // focused."
-    "Некоторые настройки вступят в силу после перезапуска.", // 659="Some settings will take effect
-                                                             // after restart."
-    "Звуки",                                                 // 660="Sounds"
-    "Отражение:",                                            // 661="Specular:"
-    "Скорость",                                              // 662="Speed"
-    "Настройки скорости",                                    // 663="Speed Settings"
-    "Скорость движения подачи",                              // 664="Speed of prime movement"
-    "Скорость движения ретракта",                            // 665="Speed of retraction movement"
-    "Скорость:",                                             // 666="Speed:"
-    "Визуализация катушки (псевдо-3D)",   // 667="Spool Visualization (Pseudo-3D Canvas)"
-    "Spoolman",                           // 668="Spoolman"
-    "В Spoolman нет настроенных катушек", // 669="Spoolman has no spools configured"
-    "Скорость прямых углов",              // 670="Square Corner Velocity"
-    "Режим ожидания",                     // 671="Standby"
-    "Начать калибровку",                  // 672="Start Calibration"
-    "Начать зондирование",                // 673="Start Probing"
-    "Начато",                             // 674="Started"
-    "Статус",                             // 675="Status"
-    "Иконки статуса",                     // 676="Status icons"
-    "Шаг",                                // 677="Step"
-    "Тест виджета пошагового прогресса",  // 678="Step Progress Widget Test"
-    "Стоп",                               // 679="Stop"
-    "Остановить сушку",                   // 680="Stop Drying"
-    "Остановить печать?",                 // 681="Stop Print?"
-    "Останавливает всё движение. Требуется перезапуск прошивки.", // 682="Stops all motion. Requires
-                                                                  // firmware restart."
-    "Стилизованный (значение=75)",                                // 683="Styled (value=75)"
-    "Процент успеха",                                             // 684="Success Rate"
-    "Успешно!",                                                   // 685="Success!"
-    "Поверхности наследуют токены фона приложения для светлого и тёмного режимов.", // 686="Surfaces
-                                                                                    // inherit app
-                                                                                    // background
-                                                                                    // tokens for
-                                                                                    // light and
-                                                                                    // dark modes."
-    "Переключить датчики",                        // 687="Switch Sensors"
-    "Переключение между светлой и тёмной темами", // 688="Switch between light and dark themes"
-    "Синхронизировать со Spoolman",               // 689="Sync to Spoolman"
-    "Синхронизация со Spoolman",                  // 690="Sync with Spoolman"
-    "Sysfs",                                      // 691="Sysfs"
-    "Обнаружена система",                         // 692="System detected"
-    "Определение цвета филамента TD-1",           // 693="TD-1 filament color detection"
-    "ЦВЕТА ТЕМЫ",                                 // 694="THEME COLORS"
-    "TPU",                                        // 695="TPU"
-    "Нажмите для показа клавиатуры...",           // 696="Tap to show keyboard..."
-    "Цель",                                       // 697="Target"
-    "Целевая температура",                        // 698="Target Temperature"
-    "Температура",                                // 699="Temperature"
-    "Температуры",                                // 700="Temperatures"
-    "Временная настройка для этой печати, если не сохранена в панели управления", // 701="Temporary
-                                                                                  // adjustment for
-                                                                                  // this print,
-                                                                                  // unless saved on
-                                                                                  // Controls panel"
-    "Третичный",                                                                  // 702="Tertiary"
-    "Тест соединения", // 703="Test Connection"
-    "Тест сети",       // 704="Test Network"
-    "Тестовая печать", // 705="Test Print"
-    "Плагин HelixPrint позволяет быстро модифицировать G-code прямо на принтере — например, "
-    "пропускать сетку стола для быстрых перепечаток.", // 706="The HelixPrint plugin enables fast
-                                                       // G-code modifications directly on your
-                                                       // printer—like skipping bed mesh for quick
-                                                       // reprints."
-    "Нагреватель будет несколько раз включаться и выключаться.", // 707="The heater will cycle on
-                                                                 // and off several times."
-    "Тема",                                                      // 708="Theme"
-    "Цвета темы",                                                // 709="Theme Colors"
-    "Пресет темы",                                               // 710="Theme Preset"
-    "Изменения темы применяются после перезапуска.",    // 711="Theme changes apply after restart."
-    "Изменения темы вступят в силу после перезапуска.", // 712="Theme changes will take effect after
-                                                        // restart."
-    "Тема, яркость и настройки сна", // 713="Theme, brightness, and sleep settings"
-    "Тонкая полоса (высота=8)",      // 714="Thin bar (height=8)"
-    "Эта калибровка использует метод трения бумаги для установки Z-смещения.", // 715="This
-                                                                               // calibration uses
-                                                                               // the paper friction
-                                                                               // method to set your
-                                                                               // Z-offset."
-    "Это может занять 1-2 минуты",   // 716="This may take 1-2 minutes"
-    "Это может занять до 30 секунд", // 717="This may take up to 30 seconds"
-    "Этот плагин позволяет HelixScreen управлять опциями старта печати, такими как сетка стола и "
-    "QGL. После установки используйте «Настроить PRINT_START» ниже для включения опциональных "
-    "шагов.", // 718="This plugin lets HelixScreen control print start options like bed mesh and
-              // QGL. Once installed, use Configure PRINT_START below to enable optional steps."
-    "Этот процесс занимает 3-5 минут. Не прерывайте.", // 719="This process takes 3-5 minutes. Do
-                                                       // not interrupt."
-    "Этот инструмент проверяет каждый винт стола и показывает, насколько его нужно отрегулировать.", // 720="This tool probes each bed screw and tells you how much to adjust."
-    "Это немедленно остановит все операции принтера. Для продолжения потребуется перезапуск.", // 721="This
-                                                                                               // will
-                                                                                               // immediately
-                                                                                               // halt
-                                                                                               // all
-                                                                                               // printer
-                                                                                               // operations.
-                                                                                               // The
-                                                                                               // printer
-                                                                                               // will
-                                                                                               // require
-                                                                                               // a
-                                                                                               // restart
-                                                                                               // to
-                                                                                               // resume."
-    "Это сбросит все настройки к значениям по умолчанию. Это действие нельзя отменить.", // 722="This
-                                                                                         // will
-                                                                                         // reset
-                                                                                         // all
-                                                                                         // settings
-                                                                                         // to
-                                                                                         // defaults.
-                                                                                         // This
-                                                                                         // action
-                                                                                         // cannot
-                                                                                         // be
-                                                                                         // undone."
-    "Это перезапустит Klipper.",                    // 723="This will restart Klipper."
-    "Время",                                        // 724="Time"
-    "Формат времени",                               // 725="Time Format"
-    "Таймлапс",                                     // 726="Timelapse"
-    "Таймлапс доступен",                            // 727="Timelapse Available"
-    "Настройки таймлапса",                          // 728="Timelapse Settings"
-    "Совет:",                                       // 729="Tip:"
-    "Переключить функцию",                          // 730="Toggle Feature"
-    "Инструмент",                                   // 731="Tool"
-    "Сменщик инструментов",                         // 732="Tool Changer"
-    "Сверху",                                       // 733="Top"
-    "Всего печатей",                                // 734="Total Prints"
-    "Калибровка касания",                           // 735="Touch Calibration"
-    "Коснитесь экрана для проверки калибровки",     // 736="Touch anywhere to test calibration"
-    "Коснитесь экрана для выхода из сна",           // 737="Touch screen to wake from sleep"
-    "Перемещения",                                  // 738="Travels"
-    "Устранение неполадок:",                        // 739="Troubleshooting:"
-    "Настройка",                                    // 740="Tune"
-    "Настроить PID-параметры нагревателя",          // 741="Tune heater PID parameters"
-    "Включать LED при запуске принтера",            // 742="Turn on LED when printer starts"
-    "Тип",                                          // 743="Type"
-    "Введите для предпросмотра поля ввода...",      // 744="Type to preview input field..."
-    "USB",                                          // 745="USB"
-    "Удалить плагин HelixPrint",                    // 746="Uninstall HelixPrint Plugin"
-    "Неизвестно",                                   // 747="Unknown"
-    "Неизвестная катушка",                          // 748="Unknown Spool"
-    "Неизвестный шаг",                              // 749="Unknown Step"
-    "Выгрузить",                                    // 750="Unload"
-    "Выгрузить филамент",                           // 751="Unload Filament"
-    "Выгрузка филамента...",                        // 752="Unloading filament..."
-    "Дополнительный возврат",                       // 753="Unretract Extra"
-    "Скорость возврата",                            // 754="Unretract Speed"
-    "Загрузите gcode-файлы для начала",             // 755="Upload gcode files to get started"
-    "Использовать аппаратный ретракт G10/G11",      // 756="Use G10/G11 firmware retraction"
-    "ValgACE (ACE Pro)",                            // 757="ValgACE (ACE Pro)"
-    "Значения сохранены в конфигурацию принтера.",  // 758="Values have been saved to printer
-                                                    // configuration."
-    "Ограничения скорости и ускорения",             // 759="Velocity and acceleration limits"
-    "Производитель",                                // 760="Vendor"
-    "Версия",                                       // 761="Version"
-    "Вертикальный прогресс (мастер ретракта)",      // 762="Vertical Progress (Retract Wizard)"
-    "Вибрация",                                     // 763="Vibration"
-    "Скорость воспроизведения видео",               // 764="Video playback speed"
-    "Просмотреть полную историю",                   // 765="View Full History"
-    "Просмотр пресетов",                            // 766="View Presets"
-    "Просмотр таймлапса",                           // 767="View Timelapse"
-    "Просмотр установленных плагинов и статуса",    // 768="View installed plugins and status"
-    "Просмотр статистики печати и истории заданий", // 769="View print statistics and job history"
-    "Предупреждение",                               // 770="Warning"
-    "Неделя",                                       // 771="Week"
-    "Данные о весе синхронизируются из Spoolman для отображения оставшегося филамента. Изменения "
-    "также синхронизируются при начале, паузе или завершении печати.", // 772="Weight data is synced
-                                                                       // from Spoolman to display
-                                                                       // remaining filament.
-                                                                       // Changes are also synced
-                                                                       // when prints start, pause,
-                                                                       // or complete."
-    "Настройки синхронизации веса",                                    // 773="Weight sync settings"
-    "Белый",                                                           // 774="White"
-    "WiFi",                                                            // 775="WiFi"
-    "Сеть WiFi",                                                       // 776="WiFi Network"
-    "WiFi и Ethernet",                                                 // 777="WiFi and Ethernet"
-    "Настройка WiFi и Ethernet",              // 778="WiFi and Ethernet configuration"
-    "Управление WiFi недоступно",             // 779="WiFi control unavailable"
-    "Оборудование WiFi недоступно",           // 780="WiFi hardware unavailable"
-    "Ширина",                                 // 781="Width"
-    "Датчики ширины",                         // 782="Width Sensors"
-    "X:",                                     // 783="X:"
-    "XY",                                     // 784="XY"
-    "Y:",                                     // 785="Y:"
-    "Год",                                    // 786="Year"
-    "Ваши завершённые печати появятся здесь", // 787="Your completed prints will appear here"
-    "Z",                                      // 788="Z"
-    "Калибровка Z",                           // 789="Z Calibration"
-    "Диапазон Z",                             // 790="Z Range"
-    "Z-зонды для выравнивания стола и создания сетки", // 791="Z probes for bed leveling and mesh
-                                                       // generation"
-    "Z-смещение",                                      // 792="Z-Offset"
-    "Калибровка Z-смещения",                           // 793="Z-Offset Calibration"
-    "Z-смещение:",                                     // 794="Z-Offset:"
-    "Регулировка Z-наклона",                           // 795="Z-Tilt Adjust"
-    "Z:",                                              // 796="Z:"
-    "Z: 0.000",                                        // 797="Z: 0.000"
-    "Масштаб",                                         // 798="Zoom"
-    "^ ПЕРЕД",                                         // 799="^ FRONT"
-    "час",                                             // 800="hour"
-    "часов",                                           // 801="hours"
-    "lg",                                              // 802="lg"
-    "md",                                              // 803="md"
-    "min_value=0, max_value=100, value=25",            // 804="min_value=0, max_value=100, value=25"
-    "минута",                                          // 805="minute"
-    "минут",                                           // 806="minutes"
-    "mzv @ 36.7 Гц",                                   // 807="mzv @ 36.7 Hz"
-    "секунд",                                          // 808="seconds"
-    "size=\"large\"",                                  // 809="size="large""
-    "size=\"medium\"",                                 // 810="size="medium""
-    "size=\"medium\" width=\"100\"",                   // 811="size="medium" width="100""
-    "size=\"small\"",                                  // 812="size="small""
-    "size=\"tiny\"",                                   // 813="size="tiny""
-    "sm",                                              // 814="sm"
-    "true",                                            // 815="true"
-    "value=0 (показывает ПОЛНЫЙ - БАГ!)",              // 816="value=0 (shows FULL - BUG!)"
-    "value=1 (крошечная полоска?)",                    // 817="value=1 (tiny sliver?)"
-    "value=100 (должен быть полным)",                  // 818="value=100 (should be full)"
-    "xs",                                              // 819="xs"
-    "Русский",                                         // 820="Русский"
-    "—",                                               // 821="—"
-    "•",                                               // 822="•"
-    "中文",                                            // 823="中文"
-    "日本語",                                          // 824="日本語"
-    "󰅐",                                            // 825="󰅐"
-    "󰉋",                                            // 826="󰉋"
-    "󱧰",                                            // 827="󱧰"
-};
-
-static const char* zh_singulars[] =
-    {
-        " / ",                                        // 0=" / "
-        " 0 / 0",                                     // 1=" 0 / 0"
-        "#808080",                                    // 2="#808080"
-        "#RRGGBB",                                    // 3="#RRGGBB"
-        "(0)",                                        // 4="(0)"
-        "(2.4GHz)",                                   // 5="(2.4GHz)"
-        "+",                                          // 6="+"
-        "+0",                                         // 7="+0"
-        "+0.01mm",                                    // 8="+0.01mm"
-        "+0.05mm",                                    // 9="+0.05mm"
-        "+0.1mm",                                     // 10="+0.1mm"
-        "+1mm",                                       // 11="+1mm"
-        "-",                                          // 12="-"
-        "- 检查 printer.cfg 中的 [resonance_tester]", // 13="- Check [resonance_tester] in
-                                                      // printer.cfg"
-        "- 确保 ADXL345 已连接",                      // 14="- Ensure ADXL345 is connected"
-        "- 先尝试测量噪声",                           // 15="- Try Measure Noise first"
-        "--",                                         // 16="--"
-        "---",                                        // 17="---"
-        "-0.01mm",                                    // 18="-0.01mm"
-        "-0.05mm",                                    // 19="-0.05mm"
-        "-0.1mm",                                     // 20="-0.1mm"
-        "-1mm",                                       // 21="-1mm"
-        "/",                                          // 22="/"
-        "直驱 0.4-2mm，远程挤出 4-6mm",               // 23="0.4-2mm direct drive, 4-6mm bowden"
-        "1. 打印机归位并探测热床",                    // 24="1. Printer homes and probes the bed"
-        "1. 打印机将归位并探测每个螺丝位置", // 25="1. Printer will home and probe each screw"
-        "10mm",                              // 26="10mm"
-        "1mm",                               // 27="1mm"
-        "2. 将纸张放在喷嘴和热床之间",       // 28="2. Place paper between nozzle and bed"
-        "2. 结果显示每个螺丝需要旋转多少",   // 29="2. Results show how much to turn each screw"
-        "200-230°C",                         // 30="200-230°C"
-        "210°C / 60°C",                      // 31="210°C / 60°C"
-        "230°C / 50°C",                      // 32="230°C / 50°C"
-        "240°C / 80°C",                      // 33="240°C / 80°C"
-        "250°C / 100°C",                     // 34="250°C / 100°C"
-        "25mm",                              // 35="25mm"
-        "3. 调整螺丝，然后重新探测以验证",   // 36="3. Adjust screws, then re-probe to verify"
-        "3. 降低喷嘴直到纸张有轻微阻力",     // 37="3. Lower nozzle until paper drags slightly"
-        "3D 预览",                           // 38="3D Preview"
-        "4. 纸张应能移动但有阻力",           // 39="4. Paper should move but with resistance"
-        "4. 重复直到热床水平",               // 40="4. Repeat until bed is level"
-        "5mm",                               // 41="5mm"
-        "60°C",                              // 42="60°C"
-        "6mm",                               // 43="6mm"
-        "850g",                              // 44="850g"
-        "= 松开",                            // 45="= Loosen"
-        "= 拧紧",                            // 46="= Tighten"
-        "?",                                 // 47="?"
-        "关于",                              // 48="ABOUT"
-        "ABS",                               // 49="ABS"
-        "AMS 设置",                          // 50="AMS Settings"
-        "外观",                              // 51="APPEARANCE"
-        "自动化",                            // 52="AUTOMATION"
-        "中止",                              // 53="Abort"
-        "关于",                              // 54="About"
-        "加速到减速",                        // 55="Accel to Decel"
-        "加速到减速限制 (mm/s²)",            // 56="Acceleration to deceleration limit (mm/s²)"
-        "加速度计",                          // 57="Accelerometers"
-        "接受",                              // 58="Accept"
-        "需要操作",                          // 59="Action Required"
-        "操作",                              // 60="Actions"
-        "活动",                              // 61="Active"
-        "实际",                              // 62="Actual"
-        "添加隐藏网络",                      // 63="Add Hidden Network"
-        "调整屏幕亮度",                      // 64="Adjust screen brightness level"
-        "调整螺丝，然后重新探测。",          // 65="Adjust screws, then re-probe."
-        "调整在重启前保持有效。打印完成后保存。", // 66="Adjustments stay active until restart. Save
-                                                  // after print completes."
-        "高级设置",                               // 67="Advanced Setting"
-        "全部",                                   // 68="All"
-        "所有螺丝都在公差范围内。",               // 69="All screws are within tolerance."
-        "Allwinner",                              // 70="Allwinner"
-        "数量：",                                 // 71="Amount:"
-        "在您的打印机上检测到加速度计。", // 72="An accelerometer was detected on your printer."
-        "校准过程中发生错误。",           // 73="An error occurred during calibration."
-        "探测过程中发生错误。",           // 74="An error occurred during probing."
-        "加载耗材时发生错误。",           // 75="An error occurred while loading filament."
-        "动画",                           // 76="Animations"
-        "应用背景",                       // 77="App Background"
-        "应用",                           // 78="Apply"
-        "应用更改",                       // 79="Apply Changes"
-        "仅为本次会话应用保存",           // 80="Apply saves for this session only"
-        "正在应用...",                    // 81="Applying..."
-        "确定要取消此打印吗？所有进度将丢失。", // 82="Are you sure you want to cancel this print?
-                                                // All progress will be lost."
-        "分配料盘",                             // 83="Assign Spool"
-        "分配角色以启用传感器监控",             // 84="Assign a role to enable sensor monitoring"
-        "正在分配到料仓 1",                     // 85="Assigning to Slot 1"
-        "自动",                                 // 86="Auto"
-        "自动热床网格",                         // 87="Auto Bed Mesh"
-        "加载时自动加热",                       // 88="Auto-Heat on Load"
-        "自动探测或手动检查螺丝高度",           // 89="Auto-probe or manually check screw heights"
-        "自动渲染视频",                         // 90="Auto-render video"
-        "自动 PID 校准",                        // 91="Automatic PID Calibration"
-        "自动从 Spoolman 获取重量更新",       // 92="Automatically poll Spoolman for weight updates"
-        "可用网络",                           // 93="Available Networks"
-        "可用网络",                           // 94="Available networks"
-        "返回",                               // 95="Back"
-        "备份",                               // 96="Backup"
-        "热床",                               // 97="Bed"
-        "热床加热器",                         // 98="Bed Heater"
-        "热床调平",                           // 99="Bed Level"
-        "热床调平",                           // 100="Bed Leveling"
-        "热床网格",                           // 101="Bed Mesh"
-        "热床网格渲染",                       // 102="Bed Mesh Render"
-        "热床螺丝调整",                       // 103="Bed Screw Adjustment"
-        "热床螺丝",                           // 104="Bed Screws"
-        "热床已水平！",                       // 105="Bed is Level!"
-        "热床 °C",                            // 106="Bed °C"
-        "热床：",                             // 107="Bed:"
-        "黑色",                               // 108="Black"
-        "蓝牙",                               // 109="Bluetooth"
-        "正文支持更长的说明同时保持可读性。", // 110="Body text supports longer guidance while
-                                              // staying readable."
-        "边框不透明度",                       // 111="Border Opacity"
-        "边框圆角",                           // 112="Border Radius"
-        "边框宽度",                           // 113="Border Width"
-        "边框透明度（0 = 不可见，255 = 实心）",   // 114="Border transparency (0 = invisible, 255 =
-                                                  // solid)"
-        "亮度",                                   // 115="Brightness"
-        "浏览",                                   // 116="Browse"
-        "忙碌",                                   // 117="Busy"
-        "旁路",                                   // 118="Bypass"
-        "旁路模式",                               // 119="Bypass Mode"
-        "校准",                                   // 120="CALIBRATION"
-        "与上次会话相比有更改",                   // 121="CHANGED FROM LAST SESSION"
-        "所需颜色",                               // 122="COLORS REQUIRED"
-        "严重",                                   // 123="CRITICAL"
-        "校准",                                   // 124="Calibrate"
-        "校准 X 轴",                              // 125="Calibrate X"
-        "校准 Y 轴",                              // 126="Calibrate Y"
-        "校准共振补偿",                           // 127="Calibrate resonance compensation"
-        "正在校准...",                            // 128="Calibrating..."
-        "校准",                                   // 129="Calibration"
-        "校准和工具",                             // 130="Calibration & Tools"
-        "校准和工具",                             // 131="Calibration &amp; Tools"
-        "校准完成！",                             // 132="Calibration Complete!"
-        "校准失败",                               // 133="Calibration Failed"
-        "取消",                                   // 134="Cancel"
-        "取消打印",                               // 135="Cancel Print"
-        "已取消",                                 // 136="Cancelled"
-        "仓室",                                   // 137="Chamber"
-        "仓室风扇",                               // 138="Chamber Fan"
-        "仓室和干燥器湿度监控",                   // 139="Chamber and dryer humidity monitoring"
-        "仓室：",                                 // 140="Chamber:"
-        "更改立即生效。可在打印时调整进行调优。", // 141="Changes apply immediately. Adjust during
-                                                  // print for tuning."
-        "更改是临时的，打印机重启后会重置",       // 142="Changes are temporary and reset on printer
-                                                  // reboot"
-        "检查耗材路径并重试。",                   // 143="Check the filament path and try again."
-        "正在检查料仓...",                        // 144="Checking slots..."
-        "选择 12 小时制或 24 小时制",             // 145="Choose 12-hour or 24-hour time display"
-        "选择显示语言",                           // 146="Choose display language"
-        "选择打印期间的帧捕获方式",     // 147="Choose how frames are captured during printing"
-        "选择 G-code 可视化的渲染模式", // 148="Choose rendering mode for G-code visualization"
-        "选择热床网格可视化的渲染模式", // 149="Choose rendering mode for bed mesh visualization"
-        "清洁喷嘴",                     // 150="Clean Nozzle"
-        "清除",                         // 151="Clear"
-        "全部清除",                     // 152="Clear All"
-        "清除分配",                     // 153="Clear Assignment"
-        "剪贴板不可用 - 请使用 SSH",    // 154="Clipboard unavailable - use SSH"
-        "关闭",                         // 155="Close"
-        "更近 = 更多挤压 | 更远 = 更少挤压",  // 156="Closer = more squish | Farther = less squish"
-        "颜色传感器",                         // 157="Color Sensors"
-        "完成",                               // 158="Complete"
-        "已完成",                             // 159="Completed"
-        "3 次探测完成",                       // 160="Completed in 3 probes"
-        "配置定义（只读）",                   // 161="Config-defined (read-only)"
-        "配置 G10/G11 固件回抽",              // 162="Configure G10/G11 firmware retraction"
-        "配置 PRINT_START",                   // 163="Configure PRINT_START"
-        "配置 Spoolman 集成和重量同步设置。", // 164="Configure Spoolman integration and weight sync
-                                              // settings."
-        "在 Moonraker 中配置设备",            // 165="Configure devices in Moonraker"
-        "配置耗材检测传感器",                 // 166="Configure filament detection sensors"
-        "配置快捷按钮和标准宏",               // 167="Configure quick buttons and standard macros"
-        "配置延时录像",                       // 168="Configure timelapse recording"
-        "连接",                               // 169="Connect"
-        "已连接",                             // 170="Connected"
-        "正在连接",                           // 171="Connecting"
-        "正在连接网络...",                    // 172="Connecting to network..."
-        "正在连接...",                        // 173="Connecting..."
-        "连接",                               // 174="Connection"
-        "连接失败。请检查密码。",             // 175="Connection failed. Check password."
-        "必须成功测试连接才能继续", // 176="Connection must be tested successfully to continue"
-        "控制台",                   // 177="Console"
-        "控制可选的打印启动功能",   // 178="Control optional print start features"
-        "冷却",                     // 179="Cool Down"
-        "冷却",                     // 180="Cooldown"
-        "冷却中",                   // 181="Cooling"
-        "复制命令",                 // 182="Copy Command"
-        "圆角程度（0 = 尖锐，40 = 非常圆润）", // 183="Corner roundness (0 = sharp, 40 = very
-                                               // round)"
-        "打印完成时创建视频",                  // 184="Create video when print completes"
-        "当前 / 目标",                         // 185="Current / Target"
-        "当前网格",                            // 186="Current Mesh"
-        "当前温度",                            // 187="Current Temperature"
-        "当前 Z 位置",                         // 188="Current Z Position"
-        "当前名称：",                          // 189="Current name:"
-        "当前已加载",                          // 190="Currently Loaded"
-        "正在打印",                            // 191="Currently printing"
-        "自定义...",                           // 192="Custom..."
-        "正在切断耗材...",                     // 193="Cutting filament..."
-        "诊断",                                // 194="DIAGNOSTICS"
-        "已禁用",                              // 195="DISABLED"
-        "危险",                                // 196="Danger"
-        "深色模式",                            // 197="Dark Mode"
-        "日",                                  // 198="Day"
-        "默认 (value=50)",                     // 199="Default (value=50)"
-        "默认边框厚度",                        // 200="Default border thickness"
-        "在 printer.cfg 中定义宏",             // 201="Define macros in your printer.cfg"
-        "删除",                                // 202="Delete"
-        "差值：",                              // 203="Delta:"
-        "Deutsch",                             // 204="Deutsch"
-        "设备操作",                            // 205="Device Operations"
-        "禁用",                                // 206="Disable"
-        "已发现的打印机",                      // 207="Discovered Printers"
-        "忽略",                                // 208="Dismiss"
-        "显示",                                // 209="Display"
-        "显示设置",                            // 210="Display Settings"
-        "显示休眠",                            // 211="Display Sleep"
-        "不保存",                              // 212="Don't Save"
-        "不再询问",                            // 213="Don't ask again"
-        "完成",                                // 214="Done"
-        "阴影强度（0 = 禁用）",                // 215="Drop shadow strength (0 = disabled)"
-        "干燥器",                              // 216="Dryer"
-        "干燥器控制",                          // 217="Dryer Control"
-        "持续时间",                            // 218="Duration"
-        "急停",                                // 219="E-Stop"
-        "急停确认",                            // 220="E-Stop Confirmation"
-        "紧急控制",                            // 221="EMERGENCY CONTROLS"
-        "紧急停止",                            // 222="EMERGENCY STOP"
-        "每个风扇只能选择一次",                // 223="Each fan can only be selected once"
-        "编辑",                                // 224="Edit"
-        "编辑预设",                            // 225="Edit Preset"
-        "编辑料仓 1",                          // 226="Edit Slot 1"
-        "编辑主题颜色",                        // 227="Edit Theme Colors"
-        "编辑主题颜色（已修改）",              // 228="Edit Theme Colors (Modified)"
-        "已用时间",                            // 229="Elapsed"
-        "紧急停止",                            // 230="Emergency Stop"
-        "紧急停止 (M112)",                     // 231="Emergency Stop (M112)"
-        "紧急停止？",                          // 232="Emergency Stop?"
-        "空",                                  // 233="Empty"
-        "空料仓将禁用相关功能",         // 234="Empty slots disable the associated functionality"
-        "启用",                         // 235="Enable"
-        "启用监控",                     // 236="Enable Monitoring"
-        "启用回抽",                     // 237="Enable Retraction"
-        "启用延时摄影",                 // 238="Enable Timelapse"
-        "启用界面动效",                 // 239="Enable UI motion effects"
-        "启用 WiFi 以扫描",             // 240="Enable WiFi to scan"
-        "启用 WiFi 以扫描网络",         // 241="Enable WiFi to scan for networks"
-        "启用声音反馈",                 // 242="Enable audio feedback"
-        "启用详细打印准备跟踪（推荐）", // 243="Enable detailed print preparation tracking
-                                        // (Recommended)"
-        "已启用",                       // 244="Enabled"
-        "已结束",                       // 245="Ended"
-        "English",                      // 246="English"
-        "增强完成！",                   // 247="Enhancement Complete!"
-        "增强失败",                     // 248="Enhancement Failed"
-        "输入 G-code 命令...",          // 249="Enter G-code command..."
-        "输入 WiFi 密码",               // 250="Enter WiFi Password"
-        "输入自定义主题名称：",         // 251="Enter a name for your custom theme:"
-        "输入名称以保存此配置",         // 252="Enter a name to save this profile"
-        "输入网络名称",                 // 253="Enter network name"
-        "输入密码",                     // 254="Enter password"
-        "错误",                         // 255="Error"
-        "错误状态",                     // 256="Error state"
-        "Español",                      // 257="Español"
-        "以太网",                       // 258="Ethernet"
-        "排除",                         // 259="Exclude"
-        "执行打印机宏",                 // 260="Execute printer macros"
-        "排气扇",                       // 261="Exhaust Fan"
-        "探索所选调色板如何影响文本、控件和状态颜色。", // 262="Explore how the selected palette
-                                                        // shapes text, controls, and status
-                                                        // colors."
-        "探索调色板和预览",                             // 263="Explore palette and preview"
-        "额外挤出以补偿溢料",                           // 264="Extra prime to compensate ooze"
-        "挤出",                                         // 265="Extrude"
-        "挤出 / 回抽",                                  // 266="Extrude / Retract"
-        "挤出机",                                       // 267="Extruder"
-        "挤出机 PID 调优",                              // 268="Extruder PID Tuning"
-        "挤出机根据材料自动加热",         // 269="Extruder heats automatically based on material"
-        "挤出速率",                       // 270="Extrusion rate"
-        "失败",                           // 271="FAILED"
-        "耗材",                           // 272="FILAMENT"
-        "恢复出厂设置",                   // 273="Factory Reset"
-        "失败",                           // 274="Failed"
-        "保存主题文件失败",               // 275="Failed to save theme file"
-        "将耗材直接送入挤出机",           // 276="Feed filament directly to extruder"
-        "耗材",                           // 277="Filament"
-        "耗材传感器",                     // 278="Filament Sensor"
-        "耗材传感器",                     // 279="Filament Sensors"
-        "已用耗材",                       // 280="Filament Used"
-        "按类型分类的耗材",               // 281="Filament by Type"
-        "耗材直径传感器用于流量补偿",     // 282="Filament diameter sensors for flow compensation"
-        "耗材用尽和运动检测传感器",       // 283="Filament runout and motion detection sensors"
-        "耗材跟踪和库存",                 // 284="Filament tracking and inventory"
-        "文件",                           // 285="File"
-        "文件信息",                       // 286="File Info"
-        "文件名",                         // 287="Filename"
-        "文件",                           // 288="Files"
-        "填充：100% / 75% / 40% / 10%",   // 289="Fill: 100% / 75% / 40% / 10%"
-        "固件重启",                       // 290="Firmware Restart"
-        "扁平同心环（现有 ams_slot）",    // 291="Flat Concentric Rings (existing ams_slot)"
-        "流量",                           // 292="Flow Rate"
-        "正在成型尖端...",                // 293="Forming tip..."
-        "帧率",                           // 294="Framerate"
-        "Français",                       // 295="Français"
-        "频率",                           // 296="Freq"
-        "前",                             // 297="Front"
-        "G-code 控制台",                  // 298="G-code Console"
-        "G-code 预览",                    // 299="G-code Preview"
-        "G-code 命令将显示在此处",        // 300="G-code commands will appear here"
-        "残影：",                         // 301="Ghost:"
-        "灰色",                           // 302="Gray"
-        "Happy Hare MMU",                 // 303="Happy Hare MMU"
-        "硬件",                           // 304="Hardware"
-        "硬件状态",                       // 305="Hardware Health"
-        "硬件问题",                       // 306="Hardware Issues"
-        "硬件名称",                       // 307="Hardware Name"
-        "硬件在启动和重新连接时进行验证", // 308="Hardware is validated on startup and reconnection"
-        "开始前准备好一张纸。",           // 309="Have a piece of paper ready before starting."
-        "如果您的热床不是用旋钮或其他内置机构调整的，请准备好热床调整工具（螺丝刀、内六角扳手等）"
-        "。",   // 310="Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if your bed
-                // isn't adjusted with                              thumb wheels or some other
-                // built-in mechanism."
-        "标题", // 311="Heading"
-        "预热浸泡",            // 312="Heat Soak"
-        "加热到 170°C 以挤出", // 313="Heat to 170°C to extrude"
-        "热床温度",            // 314="Heatbed Temperature"
-        "加热床",              // 315="Heated Bed"
-        "正在加热...",         // 316="Heating..."
-        "HelixScreen 崩溃",    // 317="HelixScreen Crashed"
-        "HelixScreen 将与您的耗材更换器集成，用于多料盘/多色打印操作。", // 318="HelixScreen will
-                                                                         // integrate with your
-                                                                         // filament changer for
-                                                                         // multi-spool/color print
-                                                                         // operations."
-        "越高 = 越快",                                                   // 319="Higher = faster"
-        "归位",                                                          // 320="Home"
-        "全部归位",                                                      // 321="Home All"
-        "X 轴归位",                                                      // 322="Home X"
-        "Y 轴归位",                                                      // 323="Home Y"
-        "Z 轴归位",                                                      // 324="Home Z"
-        "水平进度（调平向导）",         // 325="Horizontal Progress (Leveling Wizard)"
-        "主机",                         // 326="Host"
-        "热端",                         // 327="Hotend"
-        "热端风扇",                     // 328="Hotend Fan"
-        "热端加热器",                   // 329="Hotend Heater"
-        "检查 Spoolman 重量更新的频率", // 330="How often to check Spoolman for weight updates"
-        "湿度",                         // 331="Humidity"
-        "湿度传感器",                   // 332="Humidity Sensors"
-        "IP：",                         // 333="IP:"
-        "空闲",                         // 334="Idle"
-        "忽略",                         // 335="Ignore"
-        "进行中",                       // 336="In Progress"
-        "正在索引 G-code...",           // 337="Indexing G-code..."
-        "正在初始化...",                // 338="Initializing..."
-        "输入",                         // 339="Input"
-        "输入整形器",                   // 340="Input Shaper"
-        "输入整形",                     // 341="Input Shaping"
-        "输入整形器校准传感器",         // 342="Input shaper calibration sensors"
-        "输入整形可减少打印件中的振动伪影（振纹）。", // 343="Input shaping reduces vibration
-                                                      // artifacts (ringing) in your prints."
-        "安装 HelixPrint 插件",                       // 344="Install HelixPrint Plugin"
-        "安装插件",                                   // 345="Install Plugin"
-        "安装 HelixPrint 插件以启用快速 G-code 修改。通过 SSH 在打印机上运行此命令：", // 346="Install
-                                                                                       // the
-                                                                                       // HelixPrint
-                                                                                       // plugin to
-                                                                                       // enable
-                                                                                       // fast
-                                                                                       // G-code
-                                                                                       // modifications.
-                                                                                       // Run this
-                                                                                       // command
-                                                                                       // via SSH on
-                                                                                       // your
-                                                                                       // printer:"
-        "安装失败",                   // 347="Installation Failed"
-        "安装大约需要 30 秒。",       // 348="Installation takes about 30 seconds."
-        "正在安装...",                // 349="Installing..."
-        "强度",                       // 350="Intensity"
-        "打印期间的交互式 3D G-code", // 351="Interactive 3D G-code during prints"
-        "交互式探针校准",             // 352="Interactive probe calibration"
-        "问题描述",                   // 353="Issue description"
-        "Italiano",                   // 354="Italiano"
-        "刚刚",                       // 355="Just now"
-        "Kd：",                       // 356="Kd:"
-        "继续打印",                   // 357="Keep Printing"
-        "保持必需",                   // 358="Keep Required"
-        "键盘测试（Gboard 风格）",    // 359="Keyboard Test (Gboard-style)"
-        "Ki：",                       // 360="Ki:"
-        "Klipper",                    // 361="Klipper"
-        "Klipper 已进入关闭状态。这可能是由于紧急停止、热失控或配置错误。", // 362="Klipper has
-                                                                            // entered shutdown
-                                                                            // state. This may be
-                                                                            // due to an emergency
-                                                                            // stop, thermal
-                                                                            // runaway, or
-                                                                            // configuration error."
-        "Klipper 将重启以应用更改",          // 363="Klipper will restart to apply changes"
-        "Klipper 将重启以应用更改。",        // 364="Klipper will restart to apply changes."
-        "Klipper 将重启以应用新的 PID 值。", // 365="Klipper will restart to apply new PID values."
-        "Kp：",                              // 366="Kp:"
-        "LED 灯带",                          // 367="LED Strip"
-        "启动时开启 LED",                    // 368="LED on at Start"
-        "已加载",                            // 369="LOADED"
-        "语言",                              // 370="Language"
-        "最近 7 天",                         // 371="Last 7 days"
-        "上次打印已取消",                    // 372="Last print cancelled"
-        "上次打印失败",                      // 373="Last print failed"
-        "稍后",                              // 374="Later"
-        "层",                                // 375="Layer"
-        "层高",                              // 376="Layer Height"
-        "层模式在每次换层时捕获一帧。适用于大多数打印。", // 377="Layer mode captures one frame per
-                                                          // layer change. Best for most prints."
-        "层：",                                           // 378="Layer:"
-        "层",                                             // 379="Layers"
-        "长度：",                                         // 380="Length:"
-        "浅色",                                           // 381="Light"
-        "加载",                                           // 382="Load"
-        "加载耗材",                                       // 383="Load Filament"
-        "已加载",                                         // 384="Loaded"
-        "加载错误",                                       // 385="Loading Error"
-        "正在加载 G-code...",                             // 386="Loading G-code..."
-        "正在加载耗材...",                                // 387="Loading filament..."
-        "正在加载历史...",                                // 388="Loading history..."
-        "正在加载料盘...",                                // 389="Loading spools..."
-        "正在加载...",                                    // 390="Loading..."
-        "打印期间锁定",                                   // 391="Locked during print"
-        "按 M 切换",                                      // 392="M to toggle"
-        "MAC：",                                          // 393="MAC:"
-        "MDI 图标",                                       // 394="MDI Icons"
-        "缺少配置",                                       // 395="MISSING CONFIGURED"
-        "运动",                                           // 396="MOTION"
-        "机器限制",                                       // 397="Machine Limits"
-        "宏浏览器",                                       // 398="Macro Browser"
-        "宏按钮",                                         // 399="Macro Buttons"
-        "热床网格校准宏",                                 // 400="Macro for bed mesh calibration"
-        "仓室/热床预热浸泡宏",                            // 401="Macro for chamber/bed heat soak"
-        "物理热床调平宏（QGL/Z-Tilt）", // 402="Macro for physical bed leveling (QGL/Z-Tilt)"
-        "取消当前打印的宏",             // 403="Macro to cancel an active print"
-        "清洁/擦拭喷嘴的宏",            // 404="Macro to clean/wipe the nozzle"
-        "将耗材加载到挤出机的宏",       // 405="Macro to load filament into extruder"
-        "暂停当前打印的宏",             // 406="Macro to pause an active print"
-        "排料/预挤喷嘴的宏",            // 407="Macro to purge/prime the nozzle"
-        "恢复暂停打印的宏",             // 408="Macro to resume a paused print"
-        "从挤出机卸载耗材的宏",         // 409="Macro to unload filament from extruder"
-        "宏",                           // 410="Macros"
-        "主 LED 灯带",                  // 411="Main LED Strip"
-        "设为可选",                     // 412="Make Optional"
-        "使热床网格和 QGL 可跳过",      // 413="Make bed mesh and QGL skippable"
-        "管理",                         // 414="Manage"
-        "手动热床调平",                 // 415="Manual Bed Leveling"
-        "材料",                         // 416="Material"
-        "Material Design 加载动画",     // 417="Material Design Spinner"
-        "最大加速度",                   // 418="Max Acceleration"
-        "最大速度",                     // 419="Max Velocity"
-        "最大 Z 轴加速度",              // 420="Max Z Accel"
-        "最大 Z 轴速度",                // 421="Max Z Velocity"
-        "转角最大速度 (mm/s)",          // 422="Max speed through corners (mm/s)"
-        "最大加速度 (mm/s²)",           // 423="Maximum acceleration (mm/s²)"
-        "打印头最大速度 (mm/s)",        // 424="Maximum toolhead speed (mm/s)"
-        "测量噪声",                     // 425="Measure Noise"
-        "内存 (MB)",                    // 426="Memory (MB)"
-        "网格完成",                     // 427="Mesh Complete"
-        "模式",                         // 428="Mode"
-        "已修改",                       // 429="Modified"
-        "月",                           // 430="Month"
-        "Moonraker",                    // 431="Moonraker"
-        "运动",                         // 432="Motion"
-        "运动：XYZ",                    // 433="Motion: XYZ"
-        "关闭电机",                     // 434="Motors Off"
-        "移动",                         // 435="Move"
-        "调整时前后移动纸张。当纸张有轻微阻力但仍能滑动时停止。", // 436="Move paper back and forth
-                                                                  // while adjusting. Stop when
-                                                                  // paper catches slightly but
-                                                                  // still slides."
-        "移动速度",                                               // 437="Movement speed"
-        "多耗材",                                                 // 438="Multi-Filament"
-        "多材料",                                                 // 439="Multi-Material"
-        "我的自定义主题",                                         // 440="My Custom Theme"
-        "我的面板",                                               // 441="My Panel"
-        "我的打印机",                                             // 442="My Printer"
-        "新发现",                                                 // 443="NEWLY DISCOVERED"
-        "通知",                                                   // 444="NOTIFICATIONS"
-        "名称",                                                   // 445="Name"
-        "网络地址",                                               // 446="Network Address"
-        "网络名称",                                               // 447="Network Name"
-        "网络名称 (SSID)",                                        // 448="Network Name (SSID)"
-        "网络设置",                                               // 449="Network Settings"
-        "网络测试",                                               // 450="Network Test"
-        "从不",                                                   // 451="Never"
-        "新 PID 值",                                              // 452="New PID Values"
-        "新 Z 偏移：0.000",                                       // 453="New Z-Offset: 0.000"
-        "新配置名称",                                             // 454="New profile name"
-        "下一步",                                                 // 455="Next"
-        "未连接 AMS 系统。",                                      // 456="No AMS system connected."
-        "无历史记录",                                             // 457="No History"
-        "未找到宏",                                               // 458="No Macros Found"
-        "无电源设备",                                             // 459="No Power Devices"
-        "无料盘",                                                 // 460="No Spools"
-        "未加载文件",                                             // 461="No file loaded"
-        "没有可用于打印的文件",                   // 462="No files available for printing"
-        "未加载网格",                             // 463="No mesh loaded"
-        "未找到网络",                             // 464="No networks found"
-        "无通知",                                 // 465="No notifications"
-        "未找到插件",                             // 466="No plugins found"
-        "无预览",                                 // 467="No preview"
-        "暂无打印历史",                           // 468="No print history yet"
-        "未找到打印启动宏",                       // 469="No print start macro found"
-        "无可用配置",                             // 470="No profiles available"
-        "未检测到传感器",                         // 471="No sensors detected"
-        "无可用料盘",                             // 472="No spools available"
-        "暂不",                                   // 473="Not Now"
-        "未连接",                                 // 474="Not connected"
-        "通知",                                   // 475="Notifications"
-        "打印完成时通知",                         // 476="Notify when print finishes"
-        "喷嘴",                                   // 477="Nozzle"
-        "喷嘴预挤",                               // 478="Nozzle Priming"
-        "喷嘴温度",                               // 479="Nozzle Temp"
-        "喷嘴温度",                               // 480="Nozzle Temperature"
-        "喷嘴 °C",                                // 481="Nozzle °C"
-        "喷嘴：",                                 // 482="Nozzle:"
-        "确定",                                   // 483="OK"
-        "关",                                     // 484="Off"
-        "离线",                                   // 485="Offline"
-        "开",                                     // 486="On"
-        "打开",                                   // 487="Open"
-        "操作",                                   // 488="Operations"
-        "优化您的打印",                           // 489="Optimize Your Printing"
-        "或手动输入",                             // 490="Or Enter Manually"
-        "PETG",                                   // 491="PETG"
-        "PID 调优",                               // 492="PID Tuning"
-        "PID 调优可优化温度控制以实现稳定加热。", // 493="PID tuning optimizes temperature control
-                                                  // for stable heating."
-        "PLA",                                    // 494="PLA"
-        "PLA - 黑色",                             // 495="PLA - Black"
-        "打印前步骤",                             // 496="PRE-PRINT STEPS"
-        "打印机",                                 // 497="PRINTER"
-        "纸张测试校准",                           // 498="Paper Test Calibration"
-        "零件冷却风扇",                           // 499="Part Cooling Fan"
-        "零件风扇",                               // 500="Part Fan"
-        "密码",                                   // 501="Password"
-        "密码不能为空",                           // 502="Password cannot be empty"
-        "暂停",                                   // 503="Pause"
-        "已暂停",                                 // 504="Paused"
-        "已暂停（需要处理）",                     // 505="Paused (attention needed)"
-        "峰值：",                                 // 506="Peak:"
-        "相位跟踪",                               // 507="Phase Tracking"
-        "选择颜色",                               // 508="Pick Color"
-        "将插件放在 plugins 目录中以扩展 HelixScreen", // 509="Place plugins in the plugins
-                                                       // directory to extend HelixScreen"
-        "请输入主题名称",                              // 510="Please enter a theme name"
-        "请等待打印机归位和探测。",       // 511="Please wait while the printer homes and probes."
-        "请等待打印机探测每个螺丝位置。", // 512="Please wait while the printer probes each screw
-                                          // position."
-        "插件安装成功。",                 // 513="Plugin installed successfully."
-        "插件",                           // 514="Plugins"
-        "插件在应用程序启动时被发现",     // 515="Plugins are discovered on application startup"
-        "Polymaker",                      // 516="Polymaker"
-        "端口",                           // 517="Port"
-        "Português",                      // 518="Português"
-        "位置",                           // 519="Position"
-        "电源",                           // 520="Power"
-        "电源控制",                       // 521="Power Control"
-        "预热",                           // 522="Preheat"
-        "准备打印",                       // 523="Preparing Print"
-        "正在准备...",                    // 524="Preparing..."
-        "预设",                           // 525="Presets"
-        "上一步",                         // 526="Previous"
-        "主要",                           // 527="Primary"
-        "打印",                           // 528="Print"
-        "打印已取消",                     // 529="Print Cancelled"
-        "打印完成",                       // 530="Print Complete"
-        "打印完成！",                     // 531="Print Complete!"
-        "打印完成提醒",                   // 532="Print Completion Alert"
-        "打印详情",                       // 533="Print Details"
-        "打印文件",                       // 534="Print File"
-        "打印文件",                       // 535="Print Files"
-        "打印历史",                       // 536="Print History"
-        "打印时长",                       // 537="Print Hours"
-        "打印速度",                       // 538="Print Speed"
-        "打印状态",                       // 539="Print Status"
-        "打印时间",                       // 540="Print Time"
-        "打印调优",                       // 541="Print Tuning"
-        "打印机",                         // 542="Printer"
-        "打印机名称",                     // 543="Printer Name"
-        "打印机关机",                     // 544="Printer Shutdown"
-        "打印机类型",                     // 545="Printer Type"
-        "正在打印",                       // 546="Printing"
-        "打印趋势",                       // 547="Prints Trend"
-        "私有：",                         // 548="Private:"
-        "探针",                           // 549="Probe"
-        "探针传感器",                     // 550="Probe Sensor"
-        "探针传感器",                     // 551="Probe Sensors"
-        "正在探测热床网格",               // 552="Probing Bed Mesh"
-        "正在探测热床螺丝...",            // 553="Probing Bed Screws..."
-        "正在探测热床...",                // 554="Probing Bed..."
-        "探测失败",                       // 555="Probing Failed"
-        "正在处理...",                    // 556="Processing..."
-        "配置",                           // 557="Profile"
-        "配置名称（例如：default）",      // 558="Profile name (e.g., default)"
-        "配置",                           // 559="Profiles"
-        "进度",                           // 560="Progress"
-        "进度条测试",                     // 561="Progress Bar Tests"
-        "排料",                           // 562="Purge"
-        "排料 50mm",                      // 563="Purge 50mm"
-        "快捷按钮",                       // 564="QUICK BUTTONS"
-        "四角龙门调平",                   // 565="Quad Gantry Level"
-        "快捷操作",                       // 566="Quick Actions"
-        "快捷按钮 1",                     // 567="Quick Button 1"
-        "快捷按钮 2",                     // 568="Quick Button 2"
-        "快捷操作、校准、速度",           // 569="Quick actions, calibration, speed"
-        "RSS：",                          // 570="RSS:"
-        "重新探测",                       // 571="Re-probe"
-        "就绪",                           // 572="Ready"
-        "推荐",                           // 573="Recommended"
-        "推荐：挤出机 200°C",             // 574="Recommended: 200°C for extruder"
-        "录制延时摄影",                   // 575="Record Timelapse"
-        "录制打印延时摄影",               // 576="Record timelapses of your prints"
-        "录制模式",                       // 577="Recording Mode"
-        "恢复",                           // 578="Recover"
-        "减少振纹",                       // 579="Reduce Ringing"
-        "刷新",                           // 580="Refresh"
-        "刷新间隔",                       // 581="Refresh Interval"
-        "剩余",                           // 582="Remaining"
-        "从打印机移除插件",               // 583="Remove plugin from printer"
-        "重命名",                         // 584="Rename"
-        "重命名网格配置",                 // 585="Rename Mesh Profile"
-        "重新打印",                       // 586="Reprint"
-        "紧急停止前需要确认",             // 587="Require confirmation before emergency stop"
-        "需要 Moonraker-Timelapse 插件",  // 588="Requires Moonraker-Timelapse plugin"
-        "重置",                           // 589="Reset"
-        "重置速度和流量为 100%",          // 590="Reset Speed & Flow to 100%"
-        "重置速度和流量为 100%",          // 591="Reset Speed &amp; Flow to 100%"
-        "重置所有设置并重新启动向导",     // 592="Reset all settings and restart wizard"
-        "正在重置...",                    // 593="Resetting..."
-        "共振补偿调优",                   // 594="Resonance compensation tuning"
-        "重启 HelixScreen",               // 595="Restart HelixScreen"
-        "重启 Klipper",                   // 596="Restart Klipper"
-        "立即重启",                       // 597="Restart Now"
-        "需要重启",                       // 598="Restart Required"
-        "重启显示应用程序",               // 599="Restart the display application"
-        "恢复",                           // 600="Resume"
-        "恢复打印",                       // 601="Resume Print"
-        "回抽",                           // 602="Retract"
-        "回抽长度",                       // 603="Retract Length"
-        "回抽速度",                       // 604="Retract Speed"
-        "回抽设置",                       // 605="Retraction Settings"
-        "重试",                           // 606="Retry"
-        "查看检测到的硬件验证问题",       // 607="Review detected hardware validation issues"
-        "查看您的更改",                   // 608="Review your changes"
-        "角色：",                         // 609="Role:"
-        "断料传感器",                     // 610="Runout Sensor"
-        "标准宏",                         // 611="STANDARD MACROS"
-        "停止",                           // 612="STOP"
-        "样式属性",                       // 613="STYLE PROPERTIES"
-        "系统",                           // 614="SYSTEM"
-        "保存",                           // 615="Save"
-        "保存并重启",                     // 616="Save & Restart"
-        "保存并重启",                     // 617="Save &amp; Restart"
-        "另存为新配置",                   // 618="Save As New"
-        "保存配置",                       // 619="Save Config"
-        "保存打印机配置",                 // 620="Save Printer Configuration"
-        "主题另存为",                     // 621="Save Theme As"
-        "保存 Z 偏移",                    // 622="Save Z-Offset"
-        "保存 Z 偏移？",                  // 623="Save Z-Offset?"
-        "保存更改以便在重启后保留？",     // 624="Save changes to persist them across restarts?"
-        "正在保存配置...",                // 625="Saving Configuration..."
-        "保存将重启 Klipper 并取消任何正在进行的打印！", // 626="Saving will restart Klipper and
-                                                         // CANCEL any active print!"
-        "正在扫描网络...",                               // 627="Scanning for networks..."
-        "屏幕变暗",                                      // 628="Screen Dim"
-        "一段时间不活动后屏幕会降低亮度", // 629="Screen dims to lower brightness after period of
-                                          // inactivity"
-        "在选定的不活动时间后屏幕将变暗", // 630="Screen will dim after the selected period of
-                                          // inactivity"
-        "滚动速度",                       // 631="Scroll Speed"
-        "搜索文件名...",                  // 632="Search filename..."
-        "次要",                           // 633="Secondary"
-        "安全",                           // 634="Security"
-        "选择",                           // 635="Select"
-        "如果您没有耗材传感器，或不想在断料时暂停，请选择「无」。", // 636="Select 'None' if you
-                                                                    // don't have a filament sensor,
-                                                                    // or if you don't want to pause
-                                                                    // on runout."
-        "如果您有专用探针，或不使用热床网格调平，请选择「无」。", // 637="Select 'None' if you have
-                                                                  // a dedicated probe, or don't use
-                                                                  // bed mesh leveling."
-        "选择耗材",                                               // 638="Select Filament"
-        "选择文件",                                               // 639="Select File"
-        "选择 G-Code 文件",                                       // 640="Select G-Code File"
-        "选择加热器",                                             // 641="Select Heater"
-        "为第一个按钮选择宏",             // 642="Select macro for first button"
-        "为第二个按钮选择宏",             // 643="Select macro for second button"
-        "正在选择料仓...",                // 644="Selecting slot..."
-        "语义大小参数测试",               // 645="Semantic Size Parameter Tests"
-        "直接向打印机发送命令",           // 646="Send commands directly to printer"
-        "传感器",                         // 647="Sensors"
-        "设置 ",                          // 648="Set "
-        "设置",                           // 649="Settings"
-        "阴影强度",                       // 650="Shadow Intensity"
-        "整形器",                         // 651="Shaper"
-        "光泽度：",                       // 652="Shininess:"
-        "显示详细的打印准备状态",         // 653="Show detailed print preparation status"
-        "侧面",                           // 654="Side"
-        "大小",                           // 655="Size"
-        "暂时跳过",                       // 656="Skip for now"
-        "料仓 1",                         // 657="Slot 1"
-        "小标签有助于保持控件简洁专注。", // 658="Small labels help keep controls calm and focused."
-        "某些设置将在重启后生效。",       // 659="Some settings will take effect after restart."
-        "声音",                           // 660="Sounds"
-        "镜面反射：",                     // 661="Specular:"
-        "速度",                           // 662="Speed"
-        "速度设置",                       // 663="Speed Settings"
-        "预挤移动速度",                   // 664="Speed of prime movement"
-        "回抽移动速度",                   // 665="Speed of retraction movement"
-        "速度：",                         // 666="Speed:"
-        "料盘可视化（伪 3D 画布）",       // 667="Spool Visualization (Pseudo-3D Canvas)"
-        "Spoolman",                       // 668="Spoolman"
-        "Spoolman 未配置料盘",            // 669="Spoolman has no spools configured"
-        "直角转弯速度",                   // 670="Square Corner Velocity"
-        "待机",                           // 671="Standby"
-        "开始校准",                       // 672="Start Calibration"
-        "开始探测",                       // 673="Start Probing"
-        "已开始",                         // 674="Started"
-        "状态",                           // 675="Status"
-        "状态图标",                       // 676="Status icons"
-        "步骤",                           // 677="Step"
-        "步骤进度组件测试",               // 678="Step Progress Widget Test"
-        "停止",                           // 679="Stop"
-        "停止干燥",                       // 680="Stop Drying"
-        "停止打印？",                     // 681="Stop Print?"
-        "停止所有运动。需要固件重启。",   // 682="Stops all motion. Requires firmware restart."
-        "样式化 (value=75)",              // 683="Styled (value=75)"
-        "成功率",                         // 684="Success Rate"
-        "成功！",                         // 685="Success!"
-        "表面继承应用背景色用于浅色和深色模式。", // 686="Surfaces inherit app background tokens for
-                                                  // light and dark modes."
-        "开关传感器",                             // 687="Switch Sensors"
-        "切换浅色和深色主题",                     // 688="Switch between light and dark themes"
-        "同步到 Spoolman",                        // 689="Sync to Spoolman"
-        "与 Spoolman 同步",                       // 690="Sync with Spoolman"
-        "Sysfs",                                  // 691="Sysfs"
-        "检测到系统",                             // 692="System detected"
-        "TD-1 耗材颜色检测",                      // 693="TD-1 filament color detection"
-        "主题颜色",                               // 694="THEME COLORS"
-        "TPU",                                    // 695="TPU"
-        "点击显示键盘...",                        // 696="Tap to show keyboard..."
-        "目标",                                   // 697="Target"
-        "目标温度",                               // 698="Target Temperature"
-        "温度",                                   // 699="Temperature"
-        "温度",                                   // 700="Temperatures"
-        "此打印的临时调整，除非在控制面板上保存", // 701="Temporary adjustment for this print,
-                                                  // unless saved on Controls panel"
-        "第三",                                   // 702="Tertiary"
-        "测试连接",                               // 703="Test Connection"
-        "测试网络",                               // 704="Test Network"
-        "测试打印",                               // 705="Test Print"
-        "HelixPrint 插件可在打印机上直接进行快速 G-code 修改——例如跳过热床网格以快速重新打印。", // 706="The HelixPrint plugin enables fast G-code modifications directly on your printer—like skipping bed mesh for quick reprints."
-        "加热器将多次开关循环。",   // 707="The heater will cycle on and off several times."
-        "主题",                     // 708="Theme"
-        "主题颜色",                 // 709="Theme Colors"
-        "主题预设",                 // 710="Theme Preset"
-        "主题更改在重启后生效。",   // 711="Theme changes apply after restart."
-        "主题更改将在重启后生效。", // 712="Theme changes will take effect after restart."
-        "主题、亮度和休眠设置",     // 713="Theme, brightness, and sleep settings"
-        "细条 (height=8)",          // 714="Thin bar (height=8)"
-        "此校准使用纸张摩擦法设置 Z 偏移。", // 715="This calibration uses the paper friction method
-                                             // to set your Z-offset."
-        "这可能需要 1-2 分钟",               // 716="This may take 1-2 minutes"
-        "这可能需要 30 秒",                  // 717="This may take up to 30 seconds"
-        "此插件让 HelixScreen 控制打印启动选项，如热床网格和 QGL。安装后，使用下面的配置 "
-        "PRINT_START 启用可选步骤。",      // 718="This plugin lets HelixScreen control print start
-                                           // options like bed mesh and QGL. Once installed, use
-                                           // Configure PRINT_START below to enable optional steps."
-        "此过程需要 3-5 分钟。请勿中断。", // 719="This process takes 3-5 minutes. Do not
-                                           // interrupt."
-        "此工具探测每个热床螺丝并告诉您需要调整多少。", // 720="This tool probes each bed screw and
-                                                        // tells you how much to adjust."
-        "这将立即停止所有打印机操作。打印机需要重启才能恢复。", // 721="This will immediately halt
-                                                                // all printer operations. The
-                                                                // printer will require a restart to
-                                                                // resume."
-        "这将把所有设置重置为默认值。此操作无法撤销。", // 722="This will reset all settings to
-                                                        // defaults. This action cannot be undone."
-        "这将重启 Klipper。",                           // 723="This will restart Klipper."
-        "时间",                                         // 724="Time"
-        "时间格式",                                     // 725="Time Format"
-        "延时摄影",                                     // 726="Timelapse"
-        "延时摄影可用",                                 // 727="Timelapse Available"
-        "延时摄影设置",                                 // 728="Timelapse Settings"
-        "提示：",                                       // 729="Tip:"
-        "切换功能",                                     // 730="Toggle Feature"
-        "工具",                                         // 731="Tool"
-        "换刀器",                                       // 732="Tool Changer"
-        "顶部",                                         // 733="Top"
-        "总打印数",                                     // 734="Total Prints"
-        "触摸校准",                                     // 735="Touch Calibration"
-        "触摸任意位置测试校准",                         // 736="Touch anywhere to test calibration"
-        "触摸屏幕唤醒",                                 // 737="Touch screen to wake from sleep"
-        "空驶",                                         // 738="Travels"
-        "故障排除：",                                   // 739="Troubleshooting:"
-        "调优",                                         // 740="Tune"
-        "调优加热器 PID 参数",                          // 741="Tune heater PID parameters"
-        "打印机启动时打开 LED",                         // 742="Turn on LED when printer starts"
-        "类型",                                         // 743="Type"
-        "输入以预览输入框...",                          // 744="Type to preview input field..."
-        "USB",                                          // 745="USB"
-        "卸载 HelixPrint 插件",                         // 746="Uninstall HelixPrint Plugin"
-        "未知",                                         // 747="Unknown"
-        "未知料盘",                                     // 748="Unknown Spool"
-        "未知步骤",                                     // 749="Unknown Step"
-        "卸载",                                         // 750="Unload"
-        "卸载耗材",                                     // 751="Unload Filament"
-        "正在卸载耗材...",                              // 752="Unloading filament..."
-        "回抽恢复额外量",                               // 753="Unretract Extra"
-        "回抽恢复速度",                                 // 754="Unretract Speed"
-        "上传 gcode 文件开始使用",                      // 755="Upload gcode files to get started"
-        "使用 G10/G11 固件回抽",                        // 756="Use G10/G11 firmware retraction"
-        "ValgACE (ACE Pro)",                            // 757="ValgACE (ACE Pro)"
-        "值已保存到打印机配置。", // 758="Values have been saved to printer configuration."
-        "速度和加速度限制",       // 759="Velocity and acceleration limits"
-        "供应商",                 // 760="Vendor"
-        "版本",                   // 761="Version"
-        "垂直进度（回抽向导）",   // 762="Vertical Progress (Retract Wizard)"
-        "振动",                   // 763="Vibration"
-        "视频播放速度",           // 764="Video playback speed"
-        "查看完整历史",           // 765="View Full History"
-        "查看预设",               // 766="View Presets"
-        "查看延时摄影",           // 767="View Timelapse"
-        "查看已安装的插件和状态", // 768="View installed plugins and status"
-        "查看打印统计和作业历史", // 769="View print statistics and job history"
-        "警告",                   // 770="Warning"
-        "周",                     // 771="Week"
-        "重量数据从 Spoolman 同步以显示剩余耗材。打印开始、暂停或完成时也会同步更改。", // 772="Weight
-                                                                                        // data is
-                                                                                        // synced
-                                                                                        // from
-                                                                                        // Spoolman
-                                                                                        // to
-                                                                                        // display
-                                                                                        // remaining
-                                                                                        // filament.
-                                                                                        // Changes
-                                                                                        // are also
-                                                                                        // synced
-                                                                                        // when
-                                                                                        // prints
-                                                                                        // start,
-                                                                                        // pause, or
-                                                                                        // complete."
-        "重量同步设置",                    // 773="Weight sync settings"
-        "白色",                            // 774="White"
-        "WiFi",                            // 775="WiFi"
-        "WiFi 网络",                       // 776="WiFi Network"
-        "WiFi 和以太网",                   // 777="WiFi and Ethernet"
-        "WiFi 和以太网配置",               // 778="WiFi and Ethernet configuration"
-        "WiFi 控制不可用",                 // 779="WiFi control unavailable"
-        "WiFi 硬件不可用",                 // 780="WiFi hardware unavailable"
-        "宽度",                            // 781="Width"
-        "宽度传感器",                      // 782="Width Sensors"
-        "X：",                             // 783="X:"
-        "XY",                              // 784="XY"
-        "Y：",                             // 785="Y:"
-        "年",                              // 786="Year"
-        "您完成的打印将显示在此处",        // 787="Your completed prints will appear here"
-        "Z",                               // 788="Z"
-        "Z 轴校准",                        // 789="Z Calibration"
-        "Z 范围",                          // 790="Z Range"
-        "用于热床调平和网格生成的 Z 探针", // 791="Z probes for bed leveling and mesh generation"
-        "Z 偏移",                          // 792="Z-Offset"
-        "Z 偏移校准",                      // 793="Z-Offset Calibration"
-        "Z 偏移：",                        // 794="Z-Offset:"
-        "Z 倾斜调整",                      // 795="Z-Tilt Adjust"
-        "Z：",                             // 796="Z:"
-        "Z：0.000",                        // 797="Z: 0.000"
-        "缩放",                            // 798="Zoom"
-        "^ 前方",                          // 799="^ FRONT"
-        "小时",                            // 800="hour"
-        "小时",                            // 801="hours"
-        "lg",                              // 802="lg"
-        "md",                              // 803="md"
-        "min_value=0, max_value=100, value=25", // 804="min_value=0, max_value=100, value=25"
-        "分钟",                                 // 805="minute"
-        "分钟",                                 // 806="minutes"
-        "mzv @ 36.7 Hz",                        // 807="mzv @ 36.7 Hz"
-        "秒",                                   // 808="seconds"
-        "size=\"large\"",                       // 809="size="large""
-        "size=\"medium\"",                      // 810="size="medium""
-        "size=\"medium\" width=\"100\"",        // 811="size="medium" width="100""
-        "size=\"small\"",                       // 812="size="small""
-        "size=\"tiny\"",                        // 813="size="tiny""
-        "sm",                                   // 814="sm"
-        "true",                                 // 815="true"
-        "value=0 (shows FULL - BUG!)",          // 816="value=0 (shows FULL - BUG!)"
-        "value=1 (tiny sliver?)",               // 817="value=1 (tiny sliver?)"
-        "value=100 (should be full)",           // 818="value=100 (should be full)"
-        "xs",                                   // 819="xs"
-        "Русский",                              // 820="Русский"
-        "—",                                    // 821="—"
-        "•",                                    // 822="•"
-        "中文",                                 // 823="中文"
-        "日本語",                               // 824="日本語"
-        "󰅐",                                 // 825="󰅐"
-        "󰉋",                                 // 826="󰉋"
-        "󱧰",                                 // 827="󱧰"
-};
-
-static const lv_i18n_lang_t de_lang = {
-    .locale_name = "de",
-    .singulars = de_singulars,
-};
-
-static const lv_i18n_lang_t en_lang = {
-    .locale_name = "en",
-    .singulars = en_singulars,
-};
-
-static const lv_i18n_lang_t es_lang = {
-    .locale_name = "es",
-    .singulars = es_singulars,
-};
-
-static const lv_i18n_lang_t fr_lang = {
-    .locale_name = "fr",
-    .singulars = fr_singulars,
-};
-
-static const lv_i18n_lang_t it_lang = {
-    .locale_name = "it",
-    .singulars = it_singulars,
-};
-
-static const lv_i18n_lang_t ja_lang = {
-    .locale_name = "ja",
-    .singulars = ja_singulars,
-};
-
-static const lv_i18n_lang_t pt_lang = {
-    .locale_name = "pt",
-    .singulars = pt_singulars,
-};
-
-static const lv_i18n_lang_t ru_lang = {
-    .locale_name = "ru",
-    .singulars = ru_singulars,
-};
-
-static const lv_i18n_lang_t zh_lang = {
-    .locale_name = "zh",
-    .singulars = zh_singulars,
-};
-
-const lv_i18n_language_pack_t lv_i18n_language_pack[] = {
-    &de_lang, &en_lang, &es_lang, &fr_lang, &it_lang, &ja_lang, &pt_lang, &ru_lang, &zh_lang,
-    NULL // End mark
-};
-
-#ifndef LV_I18N_OPTIMIZE
-
-static const char* singular_idx[] = {
-    " / ",
-    " 0 / 0",
-    "#808080",
-    "#RRGGBB",
-    "(0)",
-    "(2.4GHz)",
-    "+",
-    "+0",
-    "+0.01mm",
-    "+0.05mm",
-    "+0.1mm",
-    "+1mm",
-    "-",
-    "- Check [resonance_tester] in printer.cfg",
-    "- Ensure ADXL345 is connected",
-    "- Try Measure Noise first",
-    "--",
-    "---",
-    "-0.01mm",
-    "-0.05mm",
-    "-0.1mm",
-    "-1mm",
-    "/",
-    "0.4-2mm direct drive, 4-6mm bowden",
-    "1. Printer homes and probes the bed",
-    "1. Printer will home and probe each screw",
-    "10mm",
-    "1mm",
-    "2. Place paper between nozzle and bed",
-    "2. Results show how much to turn each screw",
-    "200-230°C",
-    "210°C / 60°C",
-    "230°C / 50°C",
-    "240°C / 80°C",
-    "250°C / 100°C",
-    "25mm",
-    "3. Adjust screws, then re-probe to verify",
-    "3. Lower nozzle until paper drags slightly",
-    "3D Preview",
-    "4. Paper should move but with resistance",
-    "4. Repeat until bed is level",
-    "5mm",
-    "60°C",
-    "6mm",
-    "850g",
-    "= Loosen",
-    "= Tighten",
-    "?",
-    "ABOUT",
-    "ABS",
-    "AMS Settings",
-    "APPEARANCE",
-    "AUTOMATION",
-    "Abort",
-    "About",
-    "Accel to Decel",
-    "Acceleration to deceleration limit (mm/s²)",
-    "Accelerometers",
-    "Accept",
-    "Action Required",
-    "Actions",
-    "Active",
-    "Actual",
-    "Add Hidden Network",
-    "Adjust screen brightness level",
-    "Adjust screws, then re-probe.",
-    "Adjustments stay active until restart. Save after print completes.",
-    "Advanced Setting",
-    "All",
-    "All screws are within tolerance.",
-    "Allwinner",
-    "Amount:",
-    "An accelerometer was detected on your printer.",
-    "An error occurred during calibration.",
-    "An error occurred during probing.",
-    "An error occurred while loading filament.",
-    "Animations",
-    "App Background",
-    "Apply",
-    "Apply Changes",
-    "Apply saves for this session only",
-    "Applying...",
-    "Are you sure you want to cancel this print? All progress will be lost.",
-    "Assign Spool",
-    "Assign a role to enable sensor monitoring",
-    "Assigning to Slot 1",
-    "Auto",
-    "Auto Bed Mesh",
-    "Auto-Heat on Load",
-    "Auto-probe or manually check screw heights",
-    "Auto-render video",
-    "Automatic PID Calibration",
-    "Automatically poll Spoolman for weight updates",
-    "Available Networks",
-    "Available networks",
-    "Back",
-    "Backup",
-    "Bed",
-    "Bed Heater",
-    "Bed Level",
-    "Bed Leveling",
-    "Bed Mesh",
-    "Bed Mesh Render",
-    "Bed Screw Adjustment",
-    "Bed Screws",
-    "Bed is Level!",
-    "Bed °C",
-    "Bed:",
-    "Black",
-    "Bluetooth",
-    "Body text supports longer guidance while staying readable.",
-    "Border Opacity",
-    "Border Radius",
-    "Border Width",
-    "Border transparency (0 = invisible, 255 = solid)",
-    "Brightness",
-    "Browse",
-    "Busy",
-    "Bypass",
-    "Bypass Mode",
-    "CALIBRATION",
-    "CHANGED FROM LAST SESSION",
-    "COLORS REQUIRED",
-    "CRITICAL",
-    "Calibrate",
-    "Calibrate X",
-    "Calibrate Y",
-    "Calibrate resonance compensation",
-    "Calibrating...",
-    "Calibration",
-    "Calibration & Tools",
-    "Calibration &amp; Tools",
-    "Calibration Complete!",
-    "Calibration Failed",
-    "Cancel",
-    "Cancel Print",
-    "Cancelled",
-    "Chamber",
-    "Chamber Fan",
-    "Chamber and dryer humidity monitoring",
-    "Chamber:",
-    "Changes apply immediately. Adjust during print for tuning.",
-    "Changes are temporary and reset on printer reboot",
-    "Check the filament path and try again.",
-    "Checking slots...",
-    "Choose 12-hour or 24-hour time display",
-    "Choose display language",
-    "Choose how frames are captured during printing",
-    "Choose rendering mode for G-code visualization",
-    "Choose rendering mode for bed mesh visualization",
-    "Clean Nozzle",
-    "Clear",
-    "Clear All",
-    "Clear Assignment",
-    "Clipboard unavailable - use SSH",
-    "Close",
-    "Closer = more squish | Farther = less squish",
-    "Color Sensors",
-    "Complete",
-    "Completed",
-    "Completed in 3 probes",
-    "Config-defined (read-only)",
-    "Configure G10/G11 firmware retraction",
-    "Configure PRINT_START",
-    "Configure Spoolman integration and weight sync settings.",
-    "Configure devices in Moonraker",
-    "Configure filament detection sensors",
-    "Configure quick buttons and standard macros",
-    "Configure timelapse recording",
-    "Connect",
-    "Connected",
-    "Connecting",
-    "Connecting to network...",
-    "Connecting...",
-    "Connection",
-    "Connection failed. Check password.",
-    "Connection must be tested successfully to continue",
-    "Console",
-    "Control optional print start features",
-    "Cool Down",
-    "Cooldown",
-    "Cooling",
-    "Copy Command",
-    "Corner roundness (0 = sharp, 40 = very round)",
-    "Create video when print completes",
-    "Current / Target",
-    "Current Mesh",
-    "Current Temperature",
-    "Current Z Position",
-    "Current name:",
-    "Currently Loaded",
-    "Currently printing",
-    "Custom...",
-    "Cutting filament...",
-    "DIAGNOSTICS",
-    "DISABLED",
-    "Danger",
-    "Dark Mode",
-    "Day",
-    "Default (value=50)",
-    "Default border thickness",
-    "Define macros in your printer.cfg",
-    "Delete",
-    "Delta:",
-    "Deutsch",
-    "Device Operations",
-    "Disable",
-    "Discovered Printers",
-    "Dismiss",
-    "Display",
-    "Display Settings",
-    "Display Sleep",
-    "Don't Save",
-    "Don't ask again",
-    "Done",
-    "Drop shadow strength (0 = disabled)",
-    "Dryer",
-    "Dryer Control",
-    "Duration",
-    "E-Stop",
-    "E-Stop Confirmation",
-    "EMERGENCY CONTROLS",
-    "EMERGENCY STOP",
-    "Each fan can only be selected once",
-    "Edit",
-    "Edit Preset",
-    "Edit Slot 1",
-    "Edit Theme Colors",
-    "Edit Theme Colors (Modified)",
-    "Elapsed",
-    "Emergency Stop",
-    "Emergency Stop (M112)",
-    "Emergency Stop?",
-    "Empty",
-    "Empty slots disable the associated functionality",
-    "Enable",
-    "Enable Monitoring",
-    "Enable Retraction",
-    "Enable Timelapse",
-    "Enable UI motion effects",
-    "Enable WiFi to scan",
-    "Enable WiFi to scan for networks",
-    "Enable audio feedback",
-    "Enable detailed print preparation tracking (Recommended)",
-    "Enabled",
-    "Ended",
-    "English",
-    "Enhancement Complete!",
-    "Enhancement Failed",
-    "Enter G-code command...",
-    "Enter WiFi Password",
-    "Enter a name for your custom theme:",
-    "Enter a name to save this profile",
-    "Enter network name",
-    "Enter password",
-    "Error",
-    "Error state",
-    "Español",
-    "Ethernet",
-    "Exclude",
-    "Execute printer macros",
-    "Exhaust Fan",
-    "Explore how the selected palette shapes text, controls, and status colors.",
-    "Explore palette and preview",
-    "Extra prime to compensate ooze",
-    "Extrude",
-    "Extrude / Retract",
-    "Extruder",
-    "Extruder PID Tuning",
-    "Extruder heats automatically based on material",
-    "Extrusion rate",
-    "FAILED",
-    "FILAMENT",
-    "Factory Reset",
-    "Failed",
-    "Failed to save theme file",
-    "Feed filament directly to extruder",
-    "Filament",
-    "Filament Sensor",
-    "Filament Sensors",
-    "Filament Used",
-    "Filament by Type",
-    "Filament diameter sensors for flow compensation",
-    "Filament runout and motion detection sensors",
-    "Filament tracking and inventory",
-    "File",
-    "File Info",
-    "Filename",
-    "Files",
-    "Fill: 100% / 75% / 40% / 10%",
-    "Firmware Restart",
-    "Flat Concentric Rings (existing ams_slot)",
-    "Flow Rate",
-    "Forming tip...",
-    "Framerate",
-    "Français",
-    "Freq",
-    "Front",
-    "G-code Console",
-    "G-code Preview",
-    "G-code commands will appear here",
-    "Ghost:",
-    "Gray",
-    "Happy Hare MMU",
-    "Hardware",
-    "Hardware Health",
-    "Hardware Issues",
-    "Hardware Name",
-    "Hardware is validated on startup and reconnection",
-    "Have a piece of paper ready before starting.",
-    "Have your bed adjustment tool (screwdriver, hex-key, etc.) ready if your bed isn't adjusted "
-    "with                              thumb wheels or some other built-in mechanism.",
-    "Heading",
-    "Heat Soak",
-    "Heat to 170°C to extrude",
-    "Heatbed Temperature",
-    "Heated Bed",
-    "Heating...",
-    "HelixScreen Crashed",
-    "HelixScreen will integrate with your filament changer for multi-spool/color print operations.",
-    "Higher = faster",
-    "Home",
-    "Home All",
-    "Home X",
-    "Home Y",
-    "Home Z",
-    "Horizontal Progress (Leveling Wizard)",
-    "Host",
-    "Hotend",
-    "Hotend Fan",
-    "Hotend Heater",
-    "How often to check Spoolman for weight updates",
-    "Humidity",
-    "Humidity Sensors",
-    "IP:",
-    "Idle",
-    "Ignore",
-    "In Progress",
-    "Indexing G-code...",
-    "Initializing...",
-    "Input",
-    "Input Shaper",
-    "Input Shaping",
-    "Input shaper calibration sensors",
-    "Input shaping reduces vibration artifacts (ringing) in your prints.",
-    "Install HelixPrint Plugin",
-    "Install Plugin",
-    "Install the HelixPrint plugin to enable fast G-code modifications. Run this command via SSH "
-    "on your printer:",
-    "Installation Failed",
-    "Installation takes about 30 seconds.",
-    "Installing...",
-    "Intensity",
-    "Interactive 3D G-code during prints",
-    "Interactive probe calibration",
-    "Issue description",
-    "Italiano",
-    "Just now",
-    "Kd:",
-    "Keep Printing",
-    "Keep Required",
-    "Keyboard Test (Gboard-style)",
-    "Ki:",
-    "Klipper",
-    "Klipper has entered shutdown state. This may be due to an emergency stop, thermal runaway, or "
-    "configuration error.",
-    "Klipper will restart to apply changes",
-    "Klipper will restart to apply changes.",
-    "Klipper will restart to apply new PID values.",
-    "Kp:",
-    "LED Strip",
-    "LED on at Start",
-    "LOADED",
-    "Language",
-    "Last 7 days",
-    "Last print cancelled",
-    "Last print failed",
-    "Later",
-    "Layer",
-    "Layer Height",
-    "Layer mode captures one frame per layer change. Best for most prints.",
-    "Layer:",
-    "Layers",
-    "Length:",
-    "Light",
-    "Load",
-    "Load Filament",
-    "Loaded",
-    "Loading Error",
-    "Loading G-code...",
-    "Loading filament...",
-    "Loading history...",
-    "Loading spools...",
-    "Loading...",
-    "Locked during print",
-    "M to toggle",
-    "MAC:",
-    "MDI Icons",
-    "MISSING CONFIGURED",
-    "MOTION",
-    "Machine Limits",
-    "Macro Browser",
-    "Macro Buttons",
-    "Macro for bed mesh calibration",
-    "Macro for chamber/bed heat soak",
-    "Macro for physical bed leveling (QGL/Z-Tilt)",
-    "Macro to cancel an active print",
-    "Macro to clean/wipe the nozzle",
-    "Macro to load filament into extruder",
-    "Macro to pause an active print",
-    "Macro to purge/prime the nozzle",
-    "Macro to resume a paused print",
-    "Macro to unload filament from extruder",
-    "Macros",
-    "Main LED Strip",
-    "Make Optional",
-    "Make bed mesh and QGL skippable",
-    "Manage",
-    "Manual Bed Leveling",
-    "Material",
-    "Material Design Spinner",
-    "Max Acceleration",
-    "Max Velocity",
-    "Max Z Accel",
-    "Max Z Velocity",
-    "Max speed through corners (mm/s)",
-    "Maximum acceleration (mm/s²)",
-    "Maximum toolhead speed (mm/s)",
-    "Measure Noise",
-    "Memory (MB)",
-    "Mesh Complete",
-    "Mode",
-    "Modified",
-    "Month",
-    "Moonraker",
-    "Motion",
-    "Motion: XYZ",
-    "Motors Off",
-    "Move",
-    "Move paper back and forth while adjusting. Stop when paper catches slightly but still slides.",
-    "Movement speed",
-    "Multi-Filament",
-    "Multi-Material",
-    "My Custom Theme",
-    "My Panel",
-    "My Printer",
-    "NEWLY DISCOVERED",
-    "NOTIFICATIONS",
-    "Name",
-    "Network Address",
-    "Network Name",
-    "Network Name (SSID)",
-    "Network Settings",
-    "Network Test",
-    "Never",
-    "New PID Values",
-    "New Z-Offset: 0.000",
-    "New profile name",
-    "Next",
-    "No AMS system connected.",
-    "No History",
-    "No Macros Found",
-    "No Power Devices",
-    "No Spools",
-    "No file loaded",
-    "No files available for printing",
-    "No mesh loaded",
-    "No networks found",
-    "No notifications",
-    "No plugins found",
-    "No preview",
-    "No print history yet",
-    "No print start macro found",
-    "No profiles available",
-    "No sensors detected",
-    "No spools available",
-    "Not Now",
-    "Not connected",
-    "Notifications",
-    "Notify when print finishes",
-    "Nozzle",
-    "Nozzle Priming",
-    "Nozzle Temp",
-    "Nozzle Temperature",
-    "Nozzle °C",
-    "Nozzle:",
-    "OK",
-    "Off",
-    "Offline",
-    "On",
-    "Open",
-    "Operations",
-    "Optimize Your Printing",
-    "Or Enter Manually",
-    "PETG",
-    "PID Tuning",
-    "PID tuning optimizes temperature control for stable heating.",
-    "PLA",
-    "PLA - Black",
-    "PRE-PRINT STEPS",
-    "PRINTER",
-    "Paper Test Calibration",
-    "Part Cooling Fan",
-    "Part Fan",
-    "Password",
-    "Password cannot be empty",
-    "Pause",
-    "Paused",
-    "Paused (attention needed)",
-    "Peak:",
-    "Phase Tracking",
-    "Pick Color",
-    "Place plugins in the plugins directory to extend HelixScreen",
-    "Please enter a theme name",
-    "Please wait while the printer homes and probes.",
-    "Please wait while the printer probes each screw position.",
-    "Plugin installed successfully.",
-    "Plugins",
-    "Plugins are discovered on application startup",
-    "Polymaker",
-    "Port",
-    "Português",
-    "Position",
-    "Power",
-    "Power Control",
-    "Preheat",
-    "Preparing Print",
-    "Preparing...",
-    "Presets",
-    "Previous",
-    "Primary",
-    "Print",
-    "Print Cancelled",
-    "Print Complete",
-    "Print Complete!",
-    "Print Completion Alert",
-    "Print Details",
-    "Print File",
-    "Print Files",
-    "Print History",
-    "Print Hours",
-    "Print Speed",
-    "Print Status",
-    "Print Time",
-    "Print Tuning",
-    "Printer",
-    "Printer Name",
-    "Printer Shutdown",
-    "Printer Type",
-    "Printing",
-    "Prints Trend",
-    "Private:",
-    "Probe",
-    "Probe Sensor",
-    "Probe Sensors",
-    "Probing Bed Mesh",
-    "Probing Bed Screws...",
-    "Probing Bed...",
-    "Probing Failed",
-    "Processing...",
-    "Profile",
-    "Profile name (e.g., default)",
-    "Profiles",
-    "Progress",
-    "Progress Bar Tests",
-    "Purge",
-    "Purge 50mm",
-    "QUICK BUTTONS",
-    "Quad Gantry Level",
-    "Quick Actions",
-    "Quick Button 1",
-    "Quick Button 2",
-    "Quick actions, calibration, speed",
-    "RSS:",
-    "Re-probe",
-    "Ready",
-    "Recommended",
-    "Recommended: 200°C for extruder",
-    "Record Timelapse",
-    "Record timelapses of your prints",
-    "Recording Mode",
-    "Recover",
-    "Reduce Ringing",
-    "Refresh",
-    "Refresh Interval",
-    "Remaining",
-    "Remove plugin from printer",
-    "Rename",
-    "Rename Mesh Profile",
-    "Reprint",
-    "Require confirmation before emergency stop",
-    "Requires Moonraker-Timelapse plugin",
-    "Reset",
-    "Reset Speed & Flow to 100%",
-    "Reset Speed &amp; Flow to 100%",
-    "Reset all settings and restart wizard",
-    "Resetting...",
-    "Resonance compensation tuning",
-    "Restart HelixScreen",
-    "Restart Klipper",
-    "Restart Now",
-    "Restart Required",
-    "Restart the display application",
-    "Resume",
-    "Resume Print",
-    "Retract",
-    "Retract Length",
-    "Retract Speed",
-    "Retraction Settings",
-    "Retry",
-    "Review detected hardware validation issues",
-    "Review your changes",
-    "Role:",
-    "Runout Sensor",
-    "STANDARD MACROS",
-    "STOP",
-    "STYLE PROPERTIES",
-    "SYSTEM",
-    "Save",
-    "Save & Restart",
-    "Save &amp; Restart",
-    "Save As New",
-    "Save Config",
-    "Save Printer Configuration",
-    "Save Theme As",
-    "Save Z-Offset",
-    "Save Z-Offset?",
-    "Save changes to persist them across restarts?",
-    "Saving Configuration...",
-    "Saving will restart Klipper and CANCEL any active print!",
-    "Scanning for networks...",
-    "Screen Dim",
-    "Screen dims to lower brightness after period of inactivity",
-    "Screen will dim after the selected period of inactivity",
-    "Scroll Speed",
-    "Search filename...",
-    "Secondary",
-    "Security",
-    "Select",
-    "Select 'None' if you don't have a filament sensor, or if you don't want to pause on runout.",
-    "Select 'None' if you have a dedicated probe, or don't use bed mesh leveling.",
-    "Select Filament",
-    "Select File",
-    "Select G-Code File",
-    "Select Heater",
-    "Select macro for first button",
-    "Select macro for second button",
-    "Selecting slot...",
-    "Semantic Size Parameter Tests",
-    "Send commands directly to printer",
-    "Sensors",
-    "Set ",
-    "Settings",
-    "Shadow Intensity",
-    "Shaper",
-    "Shininess:",
-    "Show detailed print preparation status",
-    "Side",
-    "Size",
-    "Skip for now",
-    "Slot 1",
-    "Small labels help keep controls calm and focused.",
-    "Some settings will take effect after restart.",
-    "Sounds",
-    "Specular:",
-    "Speed",
-    "Speed Settings",
-    "Speed of prime movement",
-    "Speed of retraction movement",
-    "Speed:",
-    "Spool Visualization (Pseudo-3D Canvas)",
-    "Spoolman",
-    "Spoolman has no spools configured",
-    "Square Corner Velocity",
-    "Standby",
-    "Start Calibration",
-    "Start Probing",
-    "Started",
-    "Status",
-    "Status icons",
-    "Step",
-    "Step Progress Widget Test",
-    "Stop",
-    "Stop Drying",
-    "Stop Print?",
-    "Stops all motion. Requires firmware restart.",
-    "Styled (value=75)",
-    "Success Rate",
-    "Success!",
-    "Surfaces inherit app background tokens for light and dark modes.",
-    "Switch Sensors",
-    "Switch between light and dark themes",
-    "Sync to Spoolman",
-    "Sync with Spoolman",
-    "Sysfs",
-    "System detected",
-    "TD-1 filament color detection",
-    "THEME COLORS",
-    "TPU",
-    "Tap to show keyboard...",
-    "Target",
-    "Target Temperature",
-    "Temperature",
-    "Temperatures",
-    "Temporary adjustment for this print, unless saved on Controls panel",
-    "Tertiary",
-    "Test Connection",
-    "Test Network",
-    "Test Print",
-    "The HelixPrint plugin enables fast G-code modifications directly on your printer—like "
-    "skipping bed mesh for quick reprints.",
-    "The heater will cycle on and off several times.",
-    "Theme",
-    "Theme Colors",
-    "Theme Preset",
-    "Theme changes apply after restart.",
-    "Theme changes will take effect after restart.",
-    "Theme, brightness, and sleep settings",
-    "Thin bar (height=8)",
-    "This calibration uses the paper friction method to set your Z-offset.",
-    "This may take 1-2 minutes",
-    "This may take up to 30 seconds",
-    "This plugin lets HelixScreen control print start options like bed mesh and QGL. Once "
-    "installed, use Configure PRINT_START below to enable optional steps.",
-    "This process takes 3-5 minutes. Do not interrupt.",
-    "This tool probes each bed screw and tells you how much to adjust.",
-    "This will immediately halt all printer operations. The printer will require a restart to "
-    "resume.",
-    "This will reset all settings to defaults. This action cannot be undone.",
-    "This will restart Klipper.",
-    "Time",
-    "Time Format",
-    "Timelapse",
-    "Timelapse Available",
-    "Timelapse Settings",
-    "Tip:",
-    "Toggle Feature",
-    "Tool",
-    "Tool Changer",
-    "Top",
-    "Total Prints",
-    "Touch Calibration",
-    "Touch anywhere to test calibration",
-    "Touch screen to wake from sleep",
-    "Travels",
-    "Troubleshooting:",
-    "Tune",
-    "Tune heater PID parameters",
-    "Turn on LED when printer starts",
-    "Type",
-    "Type to preview input field...",
-    "USB",
-    "Uninstall HelixPrint Plugin",
-    "Unknown",
-    "Unknown Spool",
-    "Unknown Step",
-    "Unload",
-    "Unload Filament",
-    "Unloading filament...",
-    "Unretract Extra",
-    "Unretract Speed",
-    "Upload gcode files to get started",
-    "Use G10/G11 firmware retraction",
-    "ValgACE (ACE Pro)",
-    "Values have been saved to printer configuration.",
-    "Velocity and acceleration limits",
-    "Vendor",
-    "Version",
-    "Vertical Progress (Retract Wizard)",
-    "Vibration",
-    "Video playback speed",
-    "View Full History",
-    "View Presets",
-    "View Timelapse",
-    "View installed plugins and status",
-    "View print statistics and job history",
-    "Warning",
-    "Week",
-    "Weight data is synced from Spoolman to display remaining filament. Changes are also synced "
-    "when prints start, pause, or complete.",
-    "Weight sync settings",
-    "White",
-    "WiFi",
-    "WiFi Network",
-    "WiFi and Ethernet",
-    "WiFi and Ethernet configuration",
-    "WiFi control unavailable",
-    "WiFi hardware unavailable",
-    "Width",
-    "Width Sensors",
-    "X:",
-    "XY",
-    "Y:",
-    "Year",
-    "Your completed prints will appear here",
-    "Z",
-    "Z Calibration",
-    "Z Range",
-    "Z probes for bed leveling and mesh generation",
-    "Z-Offset",
-    "Z-Offset Calibration",
-    "Z-Offset:",
-    "Z-Tilt Adjust",
-    "Z:",
-    "Z: 0.000",
-    "Zoom",
-    "^ FRONT",
-    "hour",
-    "hours",
-    "lg",
-    "md",
-    "min_value=0, max_value=100, value=25",
-    "minute",
-    "minutes",
-    "mzv @ 36.7 Hz",
-    "seconds",
-    "size=\"large\"",
-    "size=\"medium\"",
-    "size=\"medium\" width=\"100\"",
-    "size=\"small\"",
-    "size=\"tiny\"",
-    "sm",
-    "true",
-    "value=0 (shows FULL - BUG!)",
-    "value=1 (tiny sliver?)",
-    "value=100 (should be full)",
-    "xs",
-    "Русский",
-    "—",
-    "•",
-    "中文",
-    "日本語",
-    "󰅐",
-    "󰉋",
-    "󱧰",
-};
-
-#endif
-
-////////////////////////////////////////////////////////////////////////////////
-// Runtime API
-////////////////////////////////////////////////////////////////////////////////
-
-// Internal state
-static const lv_i18n_language_pack_t* current_lang_pack = NULL;
-static const lv_i18n_lang_t* current_lang = NULL;
-
-int lv_i18n_init(const lv_i18n_language_pack_t* langs) {
-    if (langs == NULL)
-        return -1;
-    if (langs[0] == NULL)
-        return -1;
-
-    current_lang_pack = langs;
-    current_lang = langs[0]; // Default to first language
-    return 0;
-}
-
-int lv_i18n_set_locale(const char* l_name) {
-    if (current_lang_pack == NULL)
-        return -1;
-    if (l_name == NULL)
-        return -1;
-
-    for (int i = 0; current_lang_pack[i] != NULL; i++) {
-        if (strcmp(current_lang_pack[i]->locale_name, l_name) == 0) {
-            current_lang = current_lang_pack[i];
-            return 0;
-        }
-    }
-
-    return -1; // Locale not found
-}
-
-const char* lv_i18n_get_current_locale(void) {
-    if (current_lang == NULL)
-        return NULL;
-    return current_lang->locale_name;
-}
@@ -1,60 +0,0 @@
-// SPDX-License-Identifier: GPL-3.0-or-later
-// Auto-generated by generate_translations.py - DO NOT EDIT
-
-#ifndef LV_I18N_TRANSLATIONS_H
-#define LV_I18N_TRANSLATIONS_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include <stdint.h>
-
-////////////////////////////////////////////////////////////////////////////////
-
-typedef enum {
-    LV_I18N_PLURAL_TYPE_ZERO,
-    LV_I18N_PLURAL_TYPE_ONE,
-    LV_I18N_PLURAL_TYPE_TWO,
-    LV_I18N_PLURAL_TYPE_FEW,
-    LV_I18N_PLURAL_TYPE_MANY,
-    LV_I18N_PLURAL_TYPE_OTHER,
-    _LV_I18N_PLURAL_TYPE_NUM,
-} lv_i18n_plural_type_t;
-
-typedef struct {
-    const char* locale_name;
-    const char** singulars;
-    const char** plurals[_LV_I18N_PLURAL_TYPE_NUM];
-    uint8_t (*locale_plural_fn)(int32_t num);
-} lv_i18n_lang_t;
-
-typedef const lv_i18n_lang_t* lv_i18n_language_pack_t;
-
-extern const lv_i18n_language_pack_t lv_i18n_language_pack[];
-
-/**
- * Initialize the lv_i18n translation system with a language pack.
- * @param langs Pointer to the array of languages (last element must be NULL)
- * @return 0 on success, -1 on error
- */
-int lv_i18n_init(const lv_i18n_language_pack_t* langs);
-
-/**
- * Change the current locale (language).
- * @param l_name Name of the locale to use (e.g., "en", "de", "fr")
- * @return 0 on success, -1 if locale not found
- */
-int lv_i18n_set_locale(const char* l_name);
-
-/**
- * Get the name of the currently active locale.
- * @return Locale name string, or NULL if not initialized
- */
-const char* lv_i18n_get_current_locale(void);
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-#endif /* LV_I18N_TRANSLATIONS_H */
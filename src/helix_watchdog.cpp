@@ -23,6 +23,7 @@
 
 #include "backlight_backend.h"
 #include "display_backend.h"
+#include "flight_recorder.h"
 #include "logging_init.h"
 
 #include <spdlog/spdlog.h>
@@ -422,6 +423,36 @@ static CrashInfo run_child_process(const WatchdogArgs& args, pid_t splash_pid) {
     return crash;
 }
 
+/**
+ * @brief Log the crashed child's flight recorder contents
+ *
+ * helix-screen keeps its most recent trace-level log lines in a tmpfs
+ * ring buffer; they survive the crash even though production logs run at
+ * WARN, so dump them to the journal before the recovery dialog.
+ */
+static void dump_flight_recorder() {
+    std::string text;
+    uint32_t pid = 0;
+    if (!helix::logging::FlightRecorder::read_file(helix::logging::default_flight_recorder_path(),
+                                                   text, &pid) ||
+        text.empty()) {
+        return;
+    }
+
+    spdlog::warn("[Watchdog] Flight recorder from pid {} ({} bytes):", pid, text.size());
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        if (end > pos) {
+            spdlog::warn("[Watchdog] | {}", std::string_view(text).substr(pos, end - pos));
+        }
+        pos = end + 1;
+    }
+}
+
 // =============================================================================
 // System Restart
 // =============================================================================
@@ -717,6 +748,7 @@ static int run_watchdog(const WatchdogArgs& args) {
 
         // Crash detected - show recovery dialog (no splash during dialog)
         spdlog::warn("[Watchdog] Crash detected, showing recovery dialog");
+        dump_flight_recorder();
 
         DialogChoice choice = show_crash_dialog(args.width, args.height, crash);
 
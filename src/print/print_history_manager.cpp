@@ -11,6 +11,73 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+constexpr int CACHE_VERSION = 1;
+
+// Margin below the newest start_time so rounding never skips a job
+constexpr double SYNC_OVERLAP_S = 1.0;
+
+nlohmann::json job_to_json(const PrintHistoryJob& job) {
+    return {{"job_id", job.job_id},
+            {"filename", job.filename},
+            {"status", static_cast<int>(job.status)},
+            {"start_time", job.start_time},
+            {"end_time", job.end_time},
+            {"print_duration", job.print_duration},
+            {"total_duration", job.total_duration},
+            {"filament_used", job.filament_used},
+            {"exists", job.exists},
+            {"filament_type", job.filament_type},
+            {"layer_count", job.layer_count},
+            {"layer_height", job.layer_height},
+            {"nozzle_temp", job.nozzle_temp},
+            {"bed_temp", job.bed_temp},
+            {"thumbnail_path", job.thumbnail_path},
+            {"uuid", job.uuid},
+            {"size_bytes", job.size_bytes},
+            {"duration_str", job.duration_str},
+            {"date_str", job.date_str},
+            {"filament_str", job.filament_str}};
+}
+
+PrintHistoryJob job_from_json(const nlohmann::json& j) {
+    PrintHistoryJob job;
+    job.job_id = j.value("job_id", "");
+    job.filename = j.value("filename", "");
+    job.status = static_cast<PrintJobStatus>(j.value("status", 0));
+    job.start_time = j.value("start_time", 0.0);
+    job.end_time = j.value("end_time", 0.0);
+    job.print_duration = j.value("print_duration", 0.0);
+    job.total_duration = j.value("total_duration", 0.0);
+    job.filament_used = j.value("filament_used", 0.0);
+    job.exists = j.value("exists", false);
+    job.filament_type = j.value("filament_type", "");
+    job.layer_count = j.value("layer_count", 0u);
+    job.layer_height = j.value("layer_height", 0.0);
+    job.nozzle_temp = j.value("nozzle_temp", 0.0);
+    job.bed_temp = j.value("bed_temp", 0.0);
+    job.thumbnail_path = j.value("thumbnail_path", "");
+    job.uuid = j.value("uuid", "");
+    job.size_bytes = j.value("size_bytes", static_cast<size_t>(0));
+    job.duration_str = j.value("duration_str", "");
+    job.date_str = j.value("date_str", "");
+    job.filament_str = j.value("filament_str", "");
+    return job;
+}
+
+/// Whether a re-fetched job differs in anything the caches aggregate or display
+bool job_changed(const PrintHistoryJob& a, const PrintHistoryJob& b) {
+    return a.status != b.status || a.start_time != b.start_time || a.end_time != b.end_time ||
+           a.print_duration != b.print_duration || a.filament_used != b.filament_used ||
+           a.filament_type != b.filament_type || a.exists != b.exists ||
+           a.filename != b.filename || a.uuid != b.uuid;
+}
+
+} // namespace
 
 // ============================================================================
 // Construction / Destruction
@@ -44,24 +111,45 @@ void PrintHistoryManager::fetch(int limit) {
         return;
     }
 
+    bool full_sync = full_sync_requested_ ||
+                     std::chrono::steady_clock::now() - last_full_sync_ >= FULL_SYNC_INTERVAL;
+
     is_fetching_ = true;
-    spdlog::debug("[HistoryManager] Fetching history (limit={})", limit);
+    request_history(limit, full_sync ? 0.0 : sync_since());
+}
+
+void PrintHistoryManager::request_full_sync() {
+    full_sync_requested_ = true;
+}
+
+void PrintHistoryManager::request_history(int limit, double since) {
+    bool incremental = since > 0.0;
+    spdlog::debug("[HistoryManager] Fetching history (limit={}, since={})", limit, since);
 
     // Capture weak_ptr for async callback safety [L012]
     std::weak_ptr<bool> weak_guard = callback_guard_;
 
     api_->get_history_list(
-        limit, 0, 0.0, 0.0, // limit, start, since, before
-        [this, weak_guard](const std::vector<PrintHistoryJob>& jobs, uint64_t /*total*/) {
+        limit, 0, since, 0.0, // limit, start, since, before
+        [this, weak_guard, limit, incremental](const std::vector<PrintHistoryJob>& jobs,
+                                               uint64_t /*total*/) {
             // Copy jobs since callback param is const ref
             std::vector<PrintHistoryJob> jobs_copy = jobs;
 
             // Dispatch to main thread with guard check
-            ui_queue_update([this, weak_guard, jobs = std::move(jobs_copy)]() mutable {
+            ui_queue_update([this, weak_guard, limit, incremental,
+                             jobs = std::move(jobs_copy)]() mutable {
                 if (!weak_guard.lock()) {
                     return; // Object destroyed, abort
                 }
-                on_history_fetched(std::move(jobs));
+                if (incremental && static_cast<int>(jobs.size()) >= limit) {
+                    // More new jobs than one page: cheaper to start over than to page
+                    spdlog::info("[HistoryManager] {} new jobs, resyncing full history",
+                                 jobs.size());
+                    request_history(limit, 0.0);
+                    return;
+                }
+                on_history_fetched(std::move(jobs), incremental);
             });
         },
         [this, weak_guard](const MoonrakerError& error) {
@@ -81,6 +169,104 @@ void PrintHistoryManager::invalidate() {
     is_loaded_ = false;
 }
 
+double PrintHistoryManager::sync_since() const {
+    if (cached_jobs_.empty()) {
+        return 0.0;
+    }
+
+    double newest = 0.0;
+    double oldest_in_progress = 0.0;
+    for (const auto& job : cached_jobs_) {
+        newest = std::max(newest, job.start_time);
+        if (job.status == PrintJobStatus::IN_PROGRESS &&
+            (oldest_in_progress == 0.0 || job.start_time < oldest_in_progress)) {
+            oldest_in_progress = job.start_time;
+        }
+    }
+
+    double since = oldest_in_progress > 0.0 ? std::min(newest, oldest_in_progress) : newest;
+    return std::max(since - SYNC_OVERLAP_S, SYNC_OVERLAP_S);
+}
+
+void PrintHistoryManager::remove_job(const std::string& job_id) {
+    auto it = std::find_if(cached_jobs_.begin(), cached_jobs_.end(),
+                           [&job_id](const PrintHistoryJob& j) { return j.job_id == job_id; });
+    if (it == cached_jobs_.end()) {
+        return;
+    }
+
+    rollups_.remove(*it);
+    cached_jobs_.erase(it);
+    build_filename_stats();
+    save_cache();
+    notify_observers();
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+
+bool PrintHistoryManager::set_cache_file(const std::string& path, const std::string& source) {
+    cache_path_ = path;
+    cache_source_ = source;
+
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+
+    std::vector<PrintHistoryJob> jobs;
+    try {
+        nlohmann::json root = nlohmann::json::parse(in);
+        if (root.value("version", 0) != CACHE_VERSION || root.value("source", "") != source) {
+            spdlog::info("[HistoryManager] Discarding history cache for another printer/version");
+            return false;
+        }
+        for (const auto& j : root.at("jobs")) {
+            jobs.push_back(job_from_json(j));
+        }
+    } catch (const nlohmann::json::exception& e) {
+        spdlog::warn("[HistoryManager] Ignoring unreadable history cache {}: {}", path, e.what());
+        return false;
+    }
+
+    cached_jobs_ = std::move(jobs);
+    rollups_.rebuild(cached_jobs_);
+    build_filename_stats();
+    is_loaded_ = true;
+    spdlog::info("[HistoryManager] Restored {} cached jobs", cached_jobs_.size());
+
+    notify_observers();
+    return true;
+}
+
+void PrintHistoryManager::save_cache() const {
+    if (cache_path_.empty()) {
+        return;
+    }
+
+    nlohmann::json jobs = nlohmann::json::array();
+    for (const auto& job : cached_jobs_) {
+        jobs.push_back(job_to_json(job));
+    }
+    nlohmann::json root = {{"version", CACHE_VERSION}, {"source", cache_source_}, {"jobs", jobs}};
+
+    std::string tmp_path = cache_path_ + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::trunc);
+        if (!out || !(out << root.dump()) || !out.flush()) {
+            spdlog::warn("[HistoryManager] Cannot write history cache {}", tmp_path);
+            return;
+        }
+    }
+
+    // Rename so a power cut mid-write never leaves a truncated cache
+    if (std::rename(tmp_path.c_str(), cache_path_.c_str()) != 0) {
+        spdlog::warn("[HistoryManager] Cannot replace history cache {}", cache_path_);
+        std::remove(tmp_path.c_str());
+    }
+}
+
 // ============================================================================
 // Observer Pattern
 // ============================================================================
@@ -108,52 +294,110 @@ void PrintHistoryManager::remove_observer(HistoryChangedCallback* cb) {
 // Private Implementation
 // ============================================================================
 
-void PrintHistoryManager::on_history_fetched(std::vector<PrintHistoryJob>&& jobs) {
-    spdlog::info("[HistoryManager] Fetched {} jobs", jobs.size());
+void PrintHistoryManager::on_history_fetched(std::vector<PrintHistoryJob>&& jobs,
+                                             bool incremental) {
+    bool changed = true;
+    if (incremental) {
+        spdlog::debug("[HistoryManager] Fetched {} new/updated jobs", jobs.size());
+        changed = merge_jobs(std::move(jobs));
+    } else {
+        spdlog::info("[HistoryManager] Fetched {} jobs", jobs.size());
+        // Replacing the cache also drops jobs deleted by other clients
+        full_sync_requested_ = false;
+        last_full_sync_ = std::chrono::steady_clock::now();
+        cached_jobs_ = std::move(jobs);
+        rollups_.rebuild(cached_jobs_);
+        build_filename_stats();
+    }
 
-    cached_jobs_ = std::move(jobs);
-    build_filename_stats();
+    if (changed) {
+        save_cache();
+    }
 
+    // Panels waiting on is_loaded() need a callback even if nothing changed
+    bool notify = changed || !is_loaded_;
     is_loaded_ = true;
     is_fetching_ = false;
 
-    notify_observers();
+    if (notify) {
+        notify_observers();
+    }
+}
+
+bool PrintHistoryManager::merge_jobs(std::vector<PrintHistoryJob>&& jobs) {
+    bool added = false;
+    bool replaced = false;
+
+    for (auto& job : jobs) {
+        auto it = std::find_if(cached_jobs_.begin(), cached_jobs_.end(),
+                               [&job](const PrintHistoryJob& j) { return j.job_id == job.job_id; });
+        if (it == cached_jobs_.end()) {
+            rollups_.add(job);
+            add_filename_stats(job);
+            cached_jobs_.push_back(std::move(job));
+            added = true;
+        } else if (job_changed(*it, job)) {
+            // e.g. the in-progress job finished: swap its contribution
+            rollups_.remove(*it);
+            rollups_.add(job);
+            *it = std::move(job);
+            replaced = true;
+        }
+    }
+
+    if (replaced) {
+        // Per-file "most recent" status can't be un-applied; rebuild from the cache
+        build_filename_stats();
+    }
+    if (added || replaced) {
+        // Keep Moonraker's newest-first order for the list panel
+        std::stable_sort(cached_jobs_.begin(), cached_jobs_.end(),
+                         [](const PrintHistoryJob& a, const PrintHistoryJob& b) {
+                             return a.start_time > b.start_time;
+                         });
+    }
+
+    return added || replaced;
 }
 
 void PrintHistoryManager::build_filename_stats() {
     filename_stats_.clear();
 
     for (const auto& job : cached_jobs_) {
-        // Strip path from filename to get basename
-        std::string basename = job.filename;
-        auto slash_pos = basename.rfind('/');
-        if (slash_pos != std::string::npos) {
-            basename = basename.substr(slash_pos + 1);
-        }
+        add_filename_stats(job);
+    }
 
-        if (basename.empty()) {
-            continue;
-        }
+    spdlog::debug("[HistoryManager] Built stats for {} unique filenames", filename_stats_.size());
+}
 
-        auto& stats = filename_stats_[basename];
+void PrintHistoryManager::add_filename_stats(const PrintHistoryJob& job) {
+    // Strip path from filename to get basename
+    std::string basename = job.filename;
+    auto slash_pos = basename.rfind('/');
+    if (slash_pos != std::string::npos) {
+        basename = basename.substr(slash_pos + 1);
+    }
 
-        // Count successes and failures
-        if (job.status == PrintJobStatus::COMPLETED) {
-            stats.success_count++;
-        } else if (job.status == PrintJobStatus::CANCELLED || job.status == PrintJobStatus::ERROR) {
-            stats.failure_count++;
-        }
+    if (basename.empty()) {
+        return;
+    }
 
-        // Track most recent job for this filename
-        if (job.start_time > stats.last_print_time) {
-            stats.last_print_time = job.start_time;
-            stats.last_status = job.status;
-            stats.uuid = job.uuid;
-            stats.size_bytes = job.size_bytes;
-        }
+    auto& stats = filename_stats_[basename];
+
+    // Count successes and failures
+    if (job.status == PrintJobStatus::COMPLETED) {
+        stats.success_count++;
+    } else if (job.status == PrintJobStatus::CANCELLED || job.status == PrintJobStatus::ERROR) {
+        stats.failure_count++;
     }
 
-    spdlog::debug("[HistoryManager] Built stats for {} unique filenames", filename_stats_.size());
+    // Track most recent job for this filename
+    if (job.start_time > stats.last_print_time) {
+        stats.last_print_time = job.start_time;
+        stats.last_status = job.status;
+        stats.uuid = job.uuid;
+        stats.size_bytes = job.size_bytes;
+    }
 }
 
 std::vector<PrintHistoryJob> PrintHistoryManager::get_jobs_since(double since) const {
@@ -195,7 +439,8 @@ void PrintHistoryManager::subscribe_to_notifications() {
                                               if (!weak_guard.lock()) {
                                                   return; // Object destroyed, abort
                                               }
-                                              invalidate();
+                                              // Incremental: only jobs since the
+                                              // newest cached one are downloaded
                                               fetch();
                                           });
                                       });
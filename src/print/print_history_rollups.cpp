@@ -0,0 +1,262 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "print_history_rollups.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+namespace {
+
+constexpr HistoryRollupPeriod ALL_PERIODS[] = {HistoryRollupPeriod::HOUR, HistoryRollupPeriod::DAY,
+                                               HistoryRollupPeriod::WEEK,
+                                               HistoryRollupPeriod::MONTH};
+
+// Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm)
+int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const auto yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void civil_from_days(int64_t z, int& y, unsigned& m, unsigned& d) {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<int>(static_cast<int64_t>(yoe) + era * 400 + (m <= 2));
+}
+
+std::tm local_tm(double timestamp) {
+    std::time_t t = static_cast<std::time_t>(std::floor(timestamp));
+    std::tm tm{};
+    localtime_r(&t, &tm);
+    return tm;
+}
+
+double local_midnight(int y, unsigned m, unsigned d) {
+    std::tm tm{};
+    tm.tm_year = y - 1900;
+    tm.tm_mon = static_cast<int>(m) - 1;
+    tm.tm_mday = static_cast<int>(d);
+    tm.tm_isdst = -1;
+    return static_cast<double>(std::mktime(&tm));
+}
+
+int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+void add_type_usage(HistoryRollupBucket& bucket, const std::string& type, double mm, int sign) {
+    auto it = std::find_if(bucket.filament_by_type.begin(), bucket.filament_by_type.end(),
+                           [&type](const FilamentUsageByType& u) { return u.type == type; });
+    if (it == bucket.filament_by_type.end()) {
+        if (sign < 0) {
+            return;
+        }
+        bucket.filament_by_type.push_back({type, 0.0, 0});
+        it = bucket.filament_by_type.end() - 1;
+    }
+
+    it->usage_mm += sign * mm;
+    it->print_count = static_cast<uint32_t>(static_cast<int64_t>(it->print_count) + sign);
+    if (it->print_count == 0) {
+        bucket.filament_by_type.erase(it);
+    }
+}
+
+void apply_to_bucket(HistoryRollupBucket& bucket, const PrintHistoryJob& job,
+                     const std::vector<std::string>& types, int sign) {
+    bucket.job_count = static_cast<uint32_t>(static_cast<int64_t>(bucket.job_count) + sign);
+    if (job.status == PrintJobStatus::COMPLETED) {
+        bucket.completed_count =
+            static_cast<uint32_t>(static_cast<int64_t>(bucket.completed_count) + sign);
+    }
+    bucket.print_duration += sign * job.print_duration;
+    bucket.filament_mm += sign * job.filament_used;
+
+    if (types.empty()) {
+        add_type_usage(bucket, "Unknown", job.filament_used, sign);
+        return;
+    }
+
+    // Distribute filament evenly among all extruders
+    double per_extruder = job.filament_used / static_cast<double>(types.size());
+    for (const auto& type : types) {
+        add_type_usage(bucket, type, per_extruder, sign);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// HistoryRollupBucket
+// ============================================================================
+
+void HistoryRollupBucket::merge(const HistoryRollupBucket& other) {
+    job_count += other.job_count;
+    completed_count += other.completed_count;
+    print_duration += other.print_duration;
+    filament_mm += other.filament_mm;
+
+    for (const auto& usage : other.filament_by_type) {
+        auto it =
+            std::find_if(filament_by_type.begin(), filament_by_type.end(),
+                         [&usage](const FilamentUsageByType& u) { return u.type == usage.type; });
+        if (it == filament_by_type.end()) {
+            filament_by_type.push_back(usage);
+        } else {
+            it->usage_mm += usage.usage_mm;
+            it->print_count += usage.print_count;
+        }
+    }
+}
+
+// ============================================================================
+// PrintHistoryRollups
+// ============================================================================
+
+void PrintHistoryRollups::add(const PrintHistoryJob& job) {
+    apply(job, +1);
+}
+
+void PrintHistoryRollups::remove(const PrintHistoryJob& job) {
+    apply(job, -1);
+}
+
+void PrintHistoryRollups::clear() {
+    for (auto& buckets : buckets_) {
+        buckets.clear();
+    }
+    totals_ = HistoryRollupBucket{};
+}
+
+void PrintHistoryRollups::rebuild(const std::vector<PrintHistoryJob>& jobs) {
+    clear();
+    for (const auto& job : jobs) {
+        apply(job, +1);
+    }
+}
+
+void PrintHistoryRollups::apply(const PrintHistoryJob& job, int sign) {
+    std::vector<std::string> types = split_filament_types(job.filament_type);
+
+    apply_to_bucket(totals_, job, types, sign);
+
+    for (HistoryRollupPeriod period : ALL_PERIODS) {
+        auto& buckets = buckets_[static_cast<size_t>(period)];
+        int64_t key = bucket_key(period, job.start_time);
+        if (sign < 0 && buckets.find(key) == buckets.end()) {
+            continue;
+        }
+
+        auto& bucket = buckets[key];
+        apply_to_bucket(bucket, job, types, sign);
+        // Drop emptied buckets so float residue never lingers in old periods
+        if (bucket.job_count == 0) {
+            buckets.erase(key);
+        }
+    }
+}
+
+HistoryRollupBucket PrintHistoryRollups::sum(HistoryRollupPeriod period, int64_t first_key,
+                                             int64_t last_key) const {
+    HistoryRollupBucket result;
+    const auto& buckets = buckets_[static_cast<size_t>(period)];
+    for (auto it = buckets.lower_bound(first_key); it != buckets.end() && it->first <= last_key;
+         ++it) {
+        result.merge(it->second);
+    }
+    return result;
+}
+
+std::vector<uint32_t> PrintHistoryRollups::job_counts(HistoryRollupPeriod period,
+                                                      int64_t first_key, int count) const {
+    std::vector<uint32_t> counts(static_cast<size_t>(std::max(count, 0)), 0);
+    const auto& buckets = buckets_[static_cast<size_t>(period)];
+    for (auto it = buckets.lower_bound(first_key);
+         it != buckets.end() && it->first < first_key + count; ++it) {
+        counts[static_cast<size_t>(it->first - first_key)] = it->second.job_count;
+    }
+    return counts;
+}
+
+bool PrintHistoryRollups::oldest_key(HistoryRollupPeriod period, int64_t& key) const {
+    const auto& buckets = buckets_[static_cast<size_t>(period)];
+    if (buckets.empty()) {
+        return false;
+    }
+    key = buckets.begin()->first;
+    return true;
+}
+
+int64_t PrintHistoryRollups::bucket_key(HistoryRollupPeriod period, double timestamp) {
+    if (period == HistoryRollupPeriod::HOUR) {
+        return static_cast<int64_t>(std::floor(timestamp / 3600.0));
+    }
+
+    std::tm tm = local_tm(timestamp);
+    if (period == HistoryRollupPeriod::MONTH) {
+        return static_cast<int64_t>(tm.tm_year + 1900) * 12 + tm.tm_mon;
+    }
+
+    int64_t day = days_from_civil(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1),
+                                  static_cast<unsigned>(tm.tm_mday));
+    if (period == HistoryRollupPeriod::DAY) {
+        return day;
+    }
+
+    // 1970-01-01 was a Thursday; shift so weeks start on Monday
+    return floor_div(day + 3, 7);
+}
+
+double PrintHistoryRollups::bucket_start(HistoryRollupPeriod period, int64_t key) {
+    int y = 0;
+    unsigned m = 0;
+    unsigned d = 0;
+
+    switch (period) {
+    case HistoryRollupPeriod::HOUR:
+        return static_cast<double>(key) * 3600.0;
+    case HistoryRollupPeriod::DAY:
+        civil_from_days(key, y, m, d);
+        break;
+    case HistoryRollupPeriod::WEEK:
+        civil_from_days(key * 7 - 3, y, m, d);
+        break;
+    case HistoryRollupPeriod::MONTH:
+        y = static_cast<int>(floor_div(key, 12));
+        m = static_cast<unsigned>(key - static_cast<int64_t>(y) * 12) + 1;
+        d = 1;
+        break;
+    }
+    return local_midnight(y, m, d);
+}
+
+std::vector<std::string> PrintHistoryRollups::split_filament_types(const std::string& types) {
+    std::vector<std::string> result;
+    size_t pos = 0;
+    while (pos <= types.size()) {
+        size_t sep = types.find(';', pos);
+        if (sep == std::string::npos) {
+            sep = types.size();
+        }
+
+        size_t start = types.find_first_not_of(" \t", pos);
+        if (start != std::string::npos && start < sep) {
+            size_t end = types.find_last_not_of(" \t", sep - 1);
+            result.push_back(types.substr(start, end - start + 1));
+        }
+        pos = sep + 1;
+    }
+    return result;
+}
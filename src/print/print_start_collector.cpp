@@ -10,66 +10,224 @@
 using json = nlohmann::json;
 
 // ============================================================================
-// STATIC PATTERN DEFINITIONS
+// KEYWORD MATCHING
 // ============================================================================
+// Hand-written equivalents of the case-insensitive regexes these replaced.
+// Matchers receive the line ASCII-lowercased once; gaps written `.?`/`.*` in
+// the original patterns never span a line break, as with std::regex.
+
+namespace {
+
+constexpr auto npos = std::string_view::npos;
+
+bool has(std::string_view s, std::string_view word) {
+    return s.find(word) != npos;
+}
+
+bool is_line_break(char c) {
+    return c == '\n' || c == '\r';
+}
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+bool is_word_char(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+/// words[k..] at `pos`, each optionally preceded by one character (`a.?b.?c`)
+bool near_from(std::string_view s, size_t pos, const std::string_view* words, size_t count) {
+    if (count == 0) {
+        return true;
+    }
+    for (size_t gap = 0; gap <= 1; ++gap) {
+        if (gap == 1 && (pos >= s.size() || is_line_break(s[pos]))) {
+            break;
+        }
+        size_t at = pos + gap;
+        if (s.compare(at, words[0].size(), words[0]) == 0 && at + words[0].size() <= s.size() &&
+            near_from(s, at + words[0].size(), words + 1, count - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// `a.?b` / `a.?b.?c`
+bool near(std::string_view s, std::initializer_list<std::string_view> words) {
+    const std::string_view* w = words.begin();
+    for (size_t p = s.find(w[0]); p != npos; p = s.find(w[0], p + 1)) {
+        if (near_from(s, p + w[0].size(), w + 1, words.size() - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// `a.*b`
+bool then(std::string_view s, std::string_view a, std::string_view b) {
+    for (size_t p = s.find(a); p != npos; p = s.find(a, p + 1)) {
+        size_t from = p + a.size();
+        size_t q = s.find(b, from);
+        if (q == npos) {
+            return false;
+        }
+        size_t brk = s.find_first_of("\r\n", from);
+        if (brk == npos || brk >= q) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Position after `a\s+`, or npos
+size_t after_spaced(std::string_view s, size_t p, std::string_view a) {
+    size_t i = p + a.size();
+    size_t start = i;
+    while (i < s.size() && is_space(s[i])) {
+        ++i;
+    }
+    return i > start ? i : npos;
+}
+
+/// `a\s+b`
+bool spaced(std::string_view s, std::string_view a, std::string_view b) {
+    for (size_t p = s.find(a); p != npos; p = s.find(a, p + 1)) {
+        size_t i = after_spaced(s, p, a);
+        if (i != npos && s.compare(i, b.size(), b) == 0 && i + b.size() <= s.size()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// `cmd\s+S[1-9]` (temperature command with a non-zero target)
+bool temp_command(std::string_view s, std::string_view cmd) {
+    for (size_t p = s.find(cmd); p != npos; p = s.find(cmd, p + 1)) {
+        size_t i = after_spaced(s, p, cmd);
+        if (i != npos && i + 1 < s.size() && s[i] == 's' && s[i + 1] >= '1' && s[i + 1] <= '9') {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// `LAYER:?\s*1\b`
+bool layer_one(std::string_view s) {
+    for (size_t p = s.find("layer"); p != npos; p = s.find("layer", p + 1)) {
+        size_t i = p + 5;
+        if (i < s.size() && s[i] == ':') {
+            ++i;
+        }
+        while (i < s.size() && is_space(s[i])) {
+            ++i;
+        }
+        if (i < s.size() && s[i] == '1' && (i + 1 == s.size() || !is_word_char(s[i + 1]))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// G28|Homing|Home All Axes|homing
+bool matches_homing(std::string_view s) {
+    return has(s, "g28") || has(s, "homing") || has(s, "home all axes");
+}
+
+// M190|M140\s+S[1-9]|Heating bed|Heat Bed|BED_TEMP|bed.*heat
+bool matches_heating_bed(std::string_view s) {
+    return has(s, "m190") || temp_command(s, "m140") || has(s, "heating bed") ||
+           has(s, "heat bed") || has(s, "bed_temp") || then(s, "bed", "heat");
+}
+
+// M109|M104\s+S[1-9]|Heating (nozzle|hotend|extruder)|EXTRUDER_TEMP
+bool matches_heating_nozzle(std::string_view s) {
+    return has(s, "m109") || temp_command(s, "m104") || has(s, "heating nozzle") ||
+           has(s, "heating hotend") || has(s, "heating extruder") || has(s, "extruder_temp");
+}
+
+// QUAD_GANTRY_LEVEL|quad.?gantry.?level|QGL
+bool matches_qgl(std::string_view s) {
+    return near(s, {"quad", "gantry", "level"}) || has(s, "qgl");
+}
+
+// Z_TILT_ADJUST|z.?tilt.?adjust
+bool matches_z_tilt(std::string_view s) {
+    return near(s, {"z", "tilt", "adjust"});
+}
+
+// BED_MESH_CALIBRATE|BED_MESH_PROFILE\s+LOAD=|Loading bed mesh|mesh.*load
+bool matches_bed_mesh(std::string_view s) {
+    return has(s, "bed_mesh_calibrate") || spaced(s, "bed_mesh_profile", "load=") ||
+           has(s, "loading bed mesh") || then(s, "mesh", "load");
+}
+
+// CLEAN_NOZZLE|NOZZLE_CLEAN|WIPE_NOZZLE|nozzle.?wipe|clean.?nozzle
+bool matches_cleaning(std::string_view s) {
+    return has(s, "nozzle_clean") || has(s, "wipe_nozzle") || near(s, {"nozzle", "wipe"}) ||
+           near(s, {"clean", "nozzle"});
+}
+
+// VORON_PURGE|LINE_PURGE|PURGE_LINE|Prime.?Line|Priming|KAMP_.*PURGE|purge.?line
+bool matches_purging(std::string_view s) {
+    return has(s, "voron_purge") || has(s, "line_purge") || near(s, {"prime", "line"}) ||
+           has(s, "priming") || then(s, "kamp_", "purge") || near(s, {"purge", "line"});
+}
+
+/// ASCII-lowercase into a per-thread buffer (valid until the next call on this thread)
+std::string_view lowercase(std::string_view line) {
+    thread_local std::string buffer;
+    buffer.assign(line.data(), line.size());
+    for (char& c : buffer) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return buffer;
+}
+
+// PRINT_START|START_PRINT|_PRINT_START
+bool lowered_is_print_start_marker(std::string_view s) {
+    return has(s, "print_start") || has(s, "start_print");
+}
+
+// SET_PRINT_STATS_INFO\s+CURRENT_LAYER=|LAYER:?\s*1\b|;LAYER:1|First layer|HELIX:READY
+bool lowered_is_completion_marker(std::string_view s) {
+    return spaced(s, "set_print_stats_info", "current_layer=") || layer_one(s) ||
+           has(s, ";layer:1") || has(s, "first layer") || has(s, "helix:ready");
+}
+
+} // namespace
 
 // Phase detection patterns with progress weights
 // Weights should roughly sum to 100% for typical PRINT_START macros
 const std::vector<PrintStartCollector::PhasePattern> PrintStartCollector::phase_patterns_ = {
     // Homing (usually first step)
-    {PrintStartPhase::HOMING, std::regex(R"(G28|Homing|Home All Axes|homing)", std::regex::icase),
-     "Homing...", 10},
+    {PrintStartPhase::HOMING, matches_homing, "Homing...", 10},
 
     // Heating - bed
-    {PrintStartPhase::HEATING_BED,
-     std::regex(R"(M190|M140\s+S[1-9]|Heating bed|Heat Bed|BED_TEMP|bed.*heat)", std::regex::icase),
-     "Heating Bed...", 20},
+    {PrintStartPhase::HEATING_BED, matches_heating_bed, "Heating Bed...", 20},
 
     // Heating - nozzle
-    {PrintStartPhase::HEATING_NOZZLE,
-     std::regex(R"(M109|M104\s+S[1-9]|Heating (nozzle|hotend|extruder)|EXTRUDER_TEMP)",
-                std::regex::icase),
-     "Heating Nozzle...", 20},
+    {PrintStartPhase::HEATING_NOZZLE, matches_heating_nozzle, "Heating Nozzle...", 20},
 
     // Quad gantry level
-    {PrintStartPhase::QGL,
-     std::regex(R"(QUAD_GANTRY_LEVEL|quad.?gantry.?level|QGL)", std::regex::icase),
-     "Leveling Gantry...", 15},
+    {PrintStartPhase::QGL, matches_qgl, "Leveling Gantry...", 15},
 
     // Z tilt adjust
-    {PrintStartPhase::Z_TILT, std::regex(R"(Z_TILT_ADJUST|z.?tilt.?adjust)", std::regex::icase),
-     "Z Tilt Adjust...", 15},
+    {PrintStartPhase::Z_TILT, matches_z_tilt, "Z Tilt Adjust...", 15},
 
     // Bed mesh
-    {PrintStartPhase::BED_MESH,
-     std::regex(R"(BED_MESH_CALIBRATE|BED_MESH_PROFILE\s+LOAD=|Loading bed mesh|mesh.*load)",
-                std::regex::icase),
-     "Loading Bed Mesh...", 10},
+    {PrintStartPhase::BED_MESH, matches_bed_mesh, "Loading Bed Mesh...", 10},
 
     // Nozzle cleaning
-    {PrintStartPhase::CLEANING,
-     std::regex(R"(CLEAN_NOZZLE|NOZZLE_CLEAN|WIPE_NOZZLE|nozzle.?wipe|clean.?nozzle)",
-                std::regex::icase),
-     "Cleaning Nozzle...", 5},
+    {PrintStartPhase::CLEANING, matches_cleaning, "Cleaning Nozzle...", 5},
 
     // Purge line
-    {PrintStartPhase::PURGING,
-     std::regex(R"(VORON_PURGE|LINE_PURGE|PURGE_LINE|Prime.?Line|Priming|KAMP_.*PURGE|purge.?line)",
-                std::regex::icase),
-     "Purging...", 5},
+    {PrintStartPhase::PURGING, matches_purging, "Purging...", 5},
 };
 
-// Pattern to detect PRINT_START macro invocation
-const std::regex
-    PrintStartCollector::print_start_pattern_(R"(PRINT_START|START_PRINT|_PRINT_START)",
-                                              std::regex::icase);
-
-// Pattern to detect print start completion (first layer indicator)
-// Includes HELIX:READY for our custom macro integration
-const std::regex PrintStartCollector::completion_pattern_(
-    R"(SET_PRINT_STATS_INFO\s+CURRENT_LAYER=|LAYER:?\s*1\b|;LAYER:1|First layer|HELIX:READY)",
-    std::regex::icase);
-
 // ============================================================================
 // CONSTRUCTOR / DESTRUCTOR
 // ============================================================================
@@ -108,14 +266,12 @@ void PrintStartCollector::start() {
     }
     fallbacks_enabled_.store(false); // Will be enabled after initial window
 
-    // Generate unique handler name for G-code response callback
-    static std::atomic<uint64_t> s_collector_id{0};
-    handler_name_ = "print_start_collector_" + std::to_string(++s_collector_id);
-
-    // Register for G-code responses (primary detection method)
+    // Register for G-code responses (primary detection method). Phase
+    // keywords can appear in any line, so this needs every line.
     auto self = shared_from_this();
-    client_.register_method_callback("notify_gcode_response", handler_name_,
-                                     [self](const json& msg) { self->on_gcode_response(msg); });
+    subscription_id_ = client_.gcode_responses().subscribe(
+        helix::gcode_line::ANY,
+        [self](const helix::GCodeResponseLine& line) { self->on_gcode_response(line); });
 
     // Register for printer status updates (fallback for printers with KAMP/custom macros)
     // This watches for _START_PRINT.print_started, START_PRINT.preparation_done, etc.
@@ -170,7 +326,7 @@ void PrintStartCollector::start() {
     // Set initial state
     state_.set_print_start_state(PrintStartPhase::INITIALIZING, "Preparing Print...", 0);
 
-    spdlog::info("[PrintStartCollector] Started monitoring (handler: {})", handler_name_);
+    spdlog::info("[PrintStartCollector] Started monitoring (subscription {})", subscription_id_);
 }
 
 void PrintStartCollector::stop() {
@@ -179,7 +335,7 @@ void PrintStartCollector::stop() {
     bool was_registered = registered_.exchange(false);
 
     if (was_registered) {
-        client_.unregister_method_callback("notify_gcode_response", handler_name_);
+        client_.gcode_responses().unsubscribe(subscription_id_);
         spdlog::debug("[PrintStartCollector] Unregistered G-code callback");
     }
 
@@ -323,35 +479,33 @@ void PrintStartCollector::check_fallback_completion() {
 // PRIVATE METHODS
 // ============================================================================
 
-void PrintStartCollector::on_gcode_response(const json& msg) {
+void PrintStartCollector::on_gcode_response(const helix::GCodeResponseLine& response) {
     if (!active_.load()) {
         return;
     }
 
-    // Parse notify_gcode_response format: {"method": "...", "params": ["line"]}
-    if (!msg.contains("params") || !msg["params"].is_array() || msg["params"].empty()) {
-        return;
-    }
-
-    const std::string& line = msg["params"][0].get_ref<const std::string&>();
+    const std::string_view line = response.text;
 
     // Skip empty lines and common noise
-    if (line.empty() || line == "ok") {
+    if (line.empty() || response.is(helix::gcode_line::ACK)) {
         return;
     }
 
     spdlog::trace("[PrintStartCollector] G-code: {}", line);
 
     // Check for HELIX:PHASE signals (highest priority - definitive signals from plugin/macros)
-    if (check_helix_phase_signal(line)) {
+    if (response.is(helix::gcode_line::HELIX_PHASE) && check_helix_phase_signal(line)) {
         return; // Signal handled
     }
 
+    // All keyword checks below work on one lowercased copy
+    const std::string_view lowered = lowercase(line);
+
     // Check for PRINT_START marker (once per session)
     bool should_set_initializing = false;
     {
         std::lock_guard<std::mutex> lock(state_mutex_);
-        if (!print_start_detected_ && is_print_start_marker(line)) {
+        if (!print_start_detected_ && lowered_is_print_start_marker(lowered)) {
             print_start_detected_ = true;
             should_set_initializing = true;
         }
@@ -363,7 +517,7 @@ void PrintStartCollector::on_gcode_response(const json& msg) {
     }
 
     // Check for completion (layer 1 indicator)
-    if (is_completion_marker(line)) {
+    if (lowered_is_completion_marker(lowered)) {
         update_phase(PrintStartPhase::COMPLETE, "Starting Print...");
         spdlog::info("[PrintStartCollector] Print start complete - layer 1 detected");
         // Note: The caller (main.cpp) should stop the collector when print state becomes PRINTING
@@ -371,12 +525,12 @@ void PrintStartCollector::on_gcode_response(const json& msg) {
     }
 
     // Check phase patterns
-    check_phase_patterns(line);
+    check_phase_patterns(lowered);
 }
 
-void PrintStartCollector::check_phase_patterns(const std::string& line) {
+void PrintStartCollector::check_phase_patterns(std::string_view lowered) {
     for (const auto& pattern : phase_patterns_) {
-        if (std::regex_search(line, pattern.pattern)) {
+        if (pattern.matches(lowered)) {
             // Only update if this is a new phase
             bool is_new_phase = false;
             {
@@ -397,7 +551,7 @@ void PrintStartCollector::check_phase_patterns(const std::string& line) {
     }
 }
 
-bool PrintStartCollector::check_helix_phase_signal(const std::string& line) {
+bool PrintStartCollector::check_helix_phase_signal(std::string_view line) {
     // Check for HELIX:PHASE:* signals (definitive markers from plugin/macros)
     static const char* HELIX_PHASE_PREFIX = "HELIX:PHASE:";
     constexpr size_t PREFIX_LEN = 12; // strlen("HELIX:PHASE:")
@@ -409,7 +563,7 @@ bool PrintStartCollector::check_helix_phase_signal(const std::string& line) {
     }
 
     // Extract the phase name
-    std::string phase_name = line.substr(pos + PREFIX_LEN);
+    std::string phase_name(line.substr(pos + PREFIX_LEN));
     // Trim trailing whitespace, quotes, etc.
     size_t end = phase_name.find_first_of(" \t\n\r\"'");
     if (end != std::string::npos) {
@@ -504,10 +658,20 @@ int PrintStartCollector::calculate_progress_locked() const {
     return std::min(total_weight, 95);
 }
 
-bool PrintStartCollector::is_print_start_marker(const std::string& line) const {
-    return std::regex_search(line, print_start_pattern_);
+PrintStartPhase PrintStartCollector::match_phase(std::string_view line) {
+    const std::string_view lowered = lowercase(line);
+    for (const auto& pattern : phase_patterns_) {
+        if (pattern.matches(lowered)) {
+            return pattern.phase;
+        }
+    }
+    return PrintStartPhase::IDLE;
+}
+
+bool PrintStartCollector::is_print_start_marker(std::string_view line) {
+    return lowered_is_print_start_marker(lowercase(line));
 }
 
-bool PrintStartCollector::is_completion_marker(const std::string& line) const {
-    return std::regex_search(line, completion_pattern_);
+bool PrintStartCollector::is_completion_marker(std::string_view line) {
+    return lowered_is_completion_marker(lowercase(line));
 }
@@ -10,6 +10,7 @@
 #include "ui_update_queue.h"
 
 #include "memory_monitor.h"
+#include "scoped_trace.h"
 
 #include <hv/hthreadpool.h>
 #include <spdlog/spdlog.h>
@@ -313,6 +314,7 @@ ProcessResult ThumbnailProcessor::do_process(const std::vector<uint8_t>& png_dat
                                              const std::string& source_path,
                                              const ThumbnailTarget& target,
                                              const std::string& cache_dir) {
+    HELIX_TRACE_SCOPE("thumbnail", "ThumbnailProcessor::do_process");
     ProcessResult result;
 
     if (png_data.empty()) {
@@ -53,6 +53,19 @@ static std::unique_ptr<AmsBackendMock> create_mock_with_features(int gate_count)
     return mock;
 }
 
+std::shared_ptr<const AmsSystemInfo> AmsBackend::get_system_snapshot() const {
+    auto snapshot = std::atomic_load(&snapshot_);
+    if (!snapshot) {
+        // Nothing published yet (no events emitted since construction)
+        snapshot = std::make_shared<const AmsSystemInfo>(get_system_info());
+    }
+    return snapshot;
+}
+
+void AmsBackend::publish_snapshot(const AmsSystemInfo& info) {
+    std::atomic_store(&snapshot_, std::make_shared<const AmsSystemInfo>(info));
+}
+
 std::unique_ptr<AmsBackend> AmsBackend::create(AmsType detected_type) {
     const auto* config = get_runtime_config();
 
@@ -161,6 +161,7 @@ void AmsBackendAfc::emit_event(const std::string& event, const std::string& data
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         cb = event_callback_;
+        publish_snapshot(system_info_);
     }
 
     if (cb) {
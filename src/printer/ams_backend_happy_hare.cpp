@@ -118,6 +118,7 @@ void AmsBackendHappyHare::emit_event(const std::string& event, const std::string
     {
         std::lock_guard<std::mutex> lock(mutex_);
         cb = event_callback_;
+        publish_snapshot(system_info_);
     }
 
     if (cb) {
@@ -1304,6 +1304,7 @@ void AmsBackendMock::emit_event(const std::string& event, const std::string& dat
     {
         std::lock_guard<std::mutex> lock(mutex_);
         cb = event_callback_;
+        publish_snapshot(system_info_);
     }
 
     if (cb) {
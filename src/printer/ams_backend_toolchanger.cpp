@@ -137,6 +137,7 @@ void AmsBackendToolChanger::emit_event(const std::string& event, const std::stri
     {
         std::lock_guard<std::mutex> lock(mutex_);
         cb = event_callback_;
+        publish_snapshot(system_info_);
     }
 
     if (cb) {
@@ -575,6 +576,8 @@ AmsError AmsBackendToolChanger::set_slot_info(int slot_index, const SlotInfo& in
         slot.total_weight_g = info.total_weight_g;
     }
 
+    // No event is emitted for local edits, so publish directly for AmsState's next sync
+    publish_snapshot(system_info_);
     return AmsErrorHelper::success();
 }
 
@@ -114,6 +114,11 @@ void AmsBackendValgACE::set_event_callback(EventCallback callback) {
 }
 
 void AmsBackendValgACE::emit_event(const std::string& event, const std::string& data) {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        publish_snapshot(system_info_);
+    }
+
     EventCallback cb;
     {
         std::lock_guard<std::mutex> lock(callback_mutex_);
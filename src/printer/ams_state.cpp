@@ -245,6 +245,16 @@ void AmsState::init_subjects(bool register_xml) {
             snprintf(name_buf, sizeof(name_buf), "ams_slot_%d_status", i);
             lv_xml_register_subject(nullptr, name_buf, &slot_statuses_[i]);
         }
+
+        lv_subject_init_int(&slot_versions_[i], 0);
+        subjects_.register_subject(&slot_versions_[i]);
+        if (register_xml) {
+            snprintf(name_buf, sizeof(name_buf), "ams_slot_%d_version", i);
+            lv_xml_register_subject(nullptr, name_buf, &slot_versions_[i]);
+        }
+
+        // Subjects start at SlotInfo defaults, so diff against those
+        applied_slots_[i] = SlotInfo{};
     }
 
     // Ask the factory for a backend. In mock mode, it returns a mock backend.
@@ -411,6 +421,13 @@ lv_subject_t* AmsState::get_slot_status_subject(int slot_index) {
     return &slot_statuses_[slot_index];
 }
 
+lv_subject_t* AmsState::get_slot_version_subject(int slot_index) {
+    if (slot_index < 0 || slot_index >= MAX_SLOTS) {
+        return nullptr;
+    }
+    return &slot_versions_[slot_index];
+}
+
 void AmsState::sync_from_backend() {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
@@ -418,7 +435,23 @@ void AmsState::sync_from_backend() {
         return;
     }
 
-    AmsSystemInfo info = backend_->get_system_info();
+    apply_system_info(backend_->get_system_info());
+}
+
+void AmsState::sync_from_snapshot() {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    if (!backend_) {
+        return;
+    }
+
+    // Keep our reference for the whole apply; the backend may publish a newer one meanwhile
+    std::shared_ptr<const AmsSystemInfo> snapshot = backend_->get_system_snapshot();
+    apply_system_info(*snapshot);
+}
+
+void AmsState::apply_system_info(const AmsSystemInfo& info) {
+    bool slots_changed = lv_subject_get_int(&ams_slot_count_) != info.total_slots;
 
     // Update system-level subjects
     lv_subject_set_int(&ams_type_, static_cast<int>(info.type));
@@ -463,23 +496,22 @@ void AmsState::sync_from_backend() {
     lv_subject_set_int(&path_error_segment_, static_cast<int>(backend_->infer_error_segment()));
     // Note: path_anim_progress_ is controlled by UI animation, not synced from backend
 
-    // Update per-slot subjects
-    for (int i = 0; i < std::min(info.total_slots, MAX_SLOTS); ++i) {
-        const SlotInfo* slot = info.get_slot_global(i);
-        if (slot) {
-            lv_subject_set_int(&slot_colors_[i], static_cast<int>(slot->color_rgb));
-            lv_subject_set_int(&slot_statuses_[i], static_cast<int>(slot->status));
+    // Update per-slot subjects, notifying only slots whose displayed data changed.
+    // Slots beyond total_slots are cleared back to defaults.
+    bool spoolman_links_changed = false;
+    for (int i = 0; i < MAX_SLOTS; ++i) {
+        const SlotInfo* slot = i < info.total_slots ? info.get_slot_global(i) : nullptr;
+        int previous_spoolman_id = applied_slots_[i].spoolman_id;
+        if (apply_slot(i, slot ? *slot : SlotInfo{})) {
+            slots_changed = true;
+            spoolman_links_changed |= applied_slots_[i].spoolman_id != previous_spoolman_id;
         }
     }
 
-    // Clear remaining slot subjects
-    for (int i = info.total_slots; i < MAX_SLOTS; ++i) {
-        lv_subject_set_int(&slot_colors_[i], static_cast<int>(AMS_DEFAULT_SLOT_COLOR));
-        lv_subject_set_int(&slot_statuses_[i], static_cast<int>(SlotStatus::UNKNOWN));
+    if (slots_changed) {
+        bump_slots_version();
     }
 
-    bump_slots_version();
-
     // Sync dryer state (for systems with integrated drying like ValgACE)
     sync_dryer_from_backend();
 
@@ -491,9 +523,30 @@ void AmsState::sync_from_backend() {
                   ams_action_to_string(info.action),
                   path_segment_to_string(backend_->get_filament_segment()));
 
-    // Refresh Spoolman weights now that slot data is available
-    // (this catches initial load and any re-syncs)
-    refresh_spoolman_weights();
+    // Refresh Spoolman weights when a slot was linked to a different spool
+    // (this catches initial load; polling and print state changes cover the rest)
+    if (spoolman_links_changed) {
+        refresh_spoolman_weights();
+    }
+}
+
+bool AmsState::apply_slot(int slot_index, const SlotInfo& slot) {
+    SlotInfo& applied = applied_slots_[slot_index];
+    if (applied.same_display_state(slot)) {
+        return false;
+    }
+
+    if (applied.color_rgb != slot.color_rgb) {
+        lv_subject_set_int(&slot_colors_[slot_index], static_cast<int>(slot.color_rgb));
+    }
+    if (applied.status != slot.status) {
+        lv_subject_set_int(&slot_statuses_[slot_index], static_cast<int>(slot.status));
+    }
+    applied = slot;
+
+    lv_subject_set_int(&slot_versions_[slot_index],
+                       lv_subject_get_int(&slot_versions_[slot_index]) + 1);
+    return true;
 }
 
 void AmsState::update_slot(int slot_index) {
@@ -504,9 +557,7 @@ void AmsState::update_slot(int slot_index) {
     }
 
     SlotInfo slot = backend_->get_slot_info(slot_index);
-    if (slot.slot_index >= 0) {
-        lv_subject_set_int(&slot_colors_[slot_index], static_cast<int>(slot.color_rgb));
-        lv_subject_set_int(&slot_statuses_[slot_index], static_cast<int>(slot.status));
+    if (slot.slot_index >= 0 && apply_slot(slot_index, slot)) {
         bump_slots_version();
 
         spdlog::trace("[AMS State] Updated slot {} - color=0x{:06X}, status={}", slot_index,
@@ -531,7 +582,7 @@ void AmsState::on_backend_event(const std::string& event, const std::string& dat
             }
 
             if (d->full_sync) {
-                AmsState::instance().sync_from_backend();
+                AmsState::instance().sync_from_snapshot();
             } else {
                 AmsState::instance().update_slot(d->slot_index);
             }
@@ -854,7 +905,7 @@ void AmsState::refresh_spoolman_weights() {
                         slot.remaining_weight_g = d->remaining_weight_g;
                         slot.total_weight_g = d->total_weight_g;
                         state.backend_->set_slot_info(d->slot_index, slot);
-                        state.bump_slots_version();
+                        state.update_slot(d->slot_index);
 
                         spdlog::trace("[AmsState] Updated slot {} weights: {:.0f}g / {:.0f}g",
                                       d->slot_index, d->remaining_weight_g, d->total_weight_g);
@@ -82,6 +82,23 @@ void PrinterFanState::update_from_status(const nlohmann::json& status) {
     }
 }
 
+void PrinterFanState::update_from_delta(const StatusDelta& delta) {
+    if (!delta.other.is_null()) {
+        update_from_status(delta.other);
+    }
+
+    // The decoder only types "fan" and the prefixes handled above
+    for (const auto& sample : delta.fans) {
+        if (!sample.has(FanSample::SPEED)) {
+            continue;
+        }
+        if (sample.object == "fan") {
+            lv_subject_set_int(&fan_speed_, units::to_percent(sample.speed));
+        }
+        update_fan_speed(sample.object, sample.speed);
+    }
+}
+
 void PrinterFanState::reset_for_testing() {
     if (!subjects_initialized_) {
         spdlog::debug(
@@ -123,6 +123,33 @@ void PrinterMotionState::update_from_status(const nlohmann::json& status) {
     }
 }
 
+void PrinterMotionState::update_from_delta(const StatusDelta& delta) {
+    if (!delta.other.is_null()) {
+        update_from_status(delta.other);
+    }
+
+    if (delta.has(StatusDelta::TOOLHEAD_POSITION) && delta.toolhead_position.size >= 3) {
+        const auto& pos = delta.toolhead_position.values;
+        lv_subject_set_int(&position_x_, helix::units::to_centimm(pos[0]));
+        lv_subject_set_int(&position_y_, helix::units::to_centimm(pos[1]));
+        lv_subject_set_int(&position_z_, helix::units::to_centimm(pos[2]));
+    }
+
+    if (delta.has(StatusDelta::GCODE_POSITION) && delta.gcode_position.size >= 3) {
+        const auto& pos = delta.gcode_position.values;
+        lv_subject_set_int(&gcode_position_x_, helix::units::to_centimm(pos[0]));
+        lv_subject_set_int(&gcode_position_y_, helix::units::to_centimm(pos[1]));
+        lv_subject_set_int(&gcode_position_z_, helix::units::to_centimm(pos[2]));
+    }
+
+    if (delta.has(StatusDelta::SPEED_FACTOR)) {
+        lv_subject_set_int(&speed_factor_, helix::units::to_percent(delta.speed_factor));
+    }
+    if (delta.has(StatusDelta::EXTRUDE_FACTOR)) {
+        lv_subject_set_int(&flow_factor_, helix::units::to_percent(delta.extrude_factor));
+    }
+}
+
 void PrinterMotionState::reset_for_testing() {
     if (!subjects_initialized_) {
         spdlog::debug(
@@ -17,10 +17,22 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 namespace helix {
 
+namespace {
+
+/// Table time that must pass before the pace correction is trusted
+constexpr float PACE_MIN_TABLE_SECONDS = 120.0f;
+
+/// Bounds on the pace correction, so one odd stretch cannot swing the estimate
+constexpr double PACE_MIN = 0.5;
+constexpr double PACE_MAX = 2.0;
+
+} // namespace
+
 PrinterPrintState::PrinterPrintState() {
     // Initialize string buffers
     std::memset(print_filename_buf_, 0, sizeof(print_filename_buf_));
@@ -97,6 +109,9 @@ void PrinterPrintState::reset_for_testing() {
     // Use SubjectManager for automatic subject cleanup
     subjects_.deinit_all();
     subjects_initialized_ = false;
+    time_table_.reset();
+    time_table_filename_.clear();
+    pace_anchor_duration_ = -1.0;
 }
 
 void PrinterPrintState::reset_for_new_print() {
@@ -109,6 +124,7 @@ void PrinterPrintState::reset_for_new_print() {
     lv_subject_set_int(&print_layer_current_, 0);
     lv_subject_set_int(&print_duration_, 0);
     lv_subject_set_int(&print_time_left_, 0);
+    pace_anchor_duration_ = -1.0;
     spdlog::debug("[PrinterPrintState] Reset print progress for new print");
 }
 
@@ -118,20 +134,7 @@ void PrinterPrintState::update_from_status(const nlohmann::json& status) {
         const auto& sdcard = status["virtual_sdcard"];
 
         if (sdcard.contains("progress") && sdcard["progress"].is_number()) {
-            int progress_pct = helix::units::json_to_percent(sdcard, "progress");
-
-            // Guard: Don't reset progress to 0 in terminal print states (Complete/Cancelled/Error)
-            // This preserves the 100% display when a print finishes successfully
-            auto current_state = static_cast<PrintJobState>(lv_subject_get_int(&print_state_enum_));
-            bool is_terminal_state = (current_state == PrintJobState::COMPLETE ||
-                                      current_state == PrintJobState::CANCELLED ||
-                                      current_state == PrintJobState::ERROR);
-
-            // Allow updates except: progress going backward in terminal state
-            int current_progress = lv_subject_get_int(&print_progress_);
-            if (!is_terminal_state || progress_pct >= current_progress) {
-                lv_subject_set_int(&print_progress_, progress_pct);
-            }
+            set_progress_from_ratio(sdcard["progress"].get<double>());
         }
     }
 
@@ -235,20 +238,111 @@ void PrinterPrintState::update_from_status(const nlohmann::json& status) {
 
         // Update print time tracking (elapsed and remaining)
         if (stats.contains("print_duration") && stats["print_duration"].is_number()) {
-            int elapsed_seconds = static_cast<int>(stats["print_duration"].get<double>());
-            lv_subject_set_int(&print_duration_, elapsed_seconds);
+            set_print_duration(stats["print_duration"].get<double>());
         }
 
         if (stats.contains("total_duration") && stats["total_duration"].is_number()) {
-            // total_duration is the estimated total time, calculate remaining
-            int total_seconds = static_cast<int>(stats["total_duration"].get<double>());
-            int elapsed_seconds = lv_subject_get_int(&print_duration_);
-            int remaining_seconds = std::max(0, total_seconds - elapsed_seconds);
-            lv_subject_set_int(&print_time_left_, remaining_seconds);
+            set_total_duration(stats["total_duration"].get<double>());
+        }
+    }
+
+    // After print_duration, which the time table's pace correction reads
+    if (status.contains("virtual_sdcard")) {
+        const auto& sdcard = status["virtual_sdcard"];
+        if (sdcard.contains("file_position") && sdcard["file_position"].is_number()) {
+            set_file_position(sdcard["file_position"].get<double>());
         }
     }
 }
 
+void PrinterPrintState::update_from_delta(const StatusDelta& delta) {
+    if (delta.has(StatusDelta::SDCARD_PROGRESS)) {
+        set_progress_from_ratio(delta.sdcard_progress);
+    }
+
+    if (!delta.other.is_null()) {
+        update_from_status(delta.other);
+    }
+
+    if (delta.has(StatusDelta::PRINT_DURATION)) {
+        set_print_duration(delta.print_duration);
+    }
+    if (delta.has(StatusDelta::TOTAL_DURATION)) {
+        set_total_duration(delta.total_duration);
+    }
+    if (delta.has(StatusDelta::FILE_POSITION)) {
+        set_file_position(delta.file_position);
+    }
+}
+
+void PrinterPrintState::set_progress_from_ratio(double progress) {
+    int progress_pct = helix::units::to_percent(progress);
+
+    // Guard: Don't reset progress to 0 in terminal print states (Complete/Cancelled/Error)
+    // This preserves the 100% display when a print finishes successfully
+    auto current_state = static_cast<PrintJobState>(lv_subject_get_int(&print_state_enum_));
+    bool is_terminal_state =
+        (current_state == PrintJobState::COMPLETE || current_state == PrintJobState::CANCELLED ||
+         current_state == PrintJobState::ERROR);
+
+    // Allow updates except: progress going backward in terminal state
+    int current_progress = lv_subject_get_int(&print_progress_);
+    if (!is_terminal_state || progress_pct >= current_progress) {
+        lv_subject_set_int(&print_progress_, progress_pct);
+    }
+}
+
+void PrinterPrintState::set_print_duration(double seconds) {
+    lv_subject_set_int(&print_duration_, static_cast<int>(seconds));
+}
+
+void PrinterPrintState::set_total_duration(double seconds) {
+    if (time_table_active()) {
+        return; // set_file_position() owns time left
+    }
+    // total_duration is the estimated total time, calculate remaining
+    int total_seconds = static_cast<int>(seconds);
+    int elapsed_seconds = lv_subject_get_int(&print_duration_);
+    int remaining_seconds = std::max(0, total_seconds - elapsed_seconds);
+    lv_subject_set_int(&print_time_left_, remaining_seconds);
+}
+
+bool PrinterPrintState::time_table_active() const {
+    if (!time_table_ || time_table_->empty() || time_table_filename_.empty()) {
+        return false;
+    }
+    const char* printing = lv_subject_get_string(const_cast<lv_subject_t*>(&print_filename_));
+    return printing && time_table_filename_ == printing;
+}
+
+void PrinterPrintState::set_file_position(double position) {
+    if (!time_table_active() || position < 0.0) {
+        return;
+    }
+    auto file_position = static_cast<uint64_t>(position);
+    float table_elapsed = time_table_->elapsed_at(file_position);
+    double duration = lv_subject_get_int(&print_duration_);
+
+    // Start the pace clock once the file is past its first moves, so heat-up
+    // and homing in the start macro (not in the table) do not count; restart
+    // it if print_duration went backwards (a new print of the same file)
+    if (table_elapsed > 0.0f && (pace_anchor_duration_ < 0.0 || duration < pace_anchor_duration_)) {
+        pace_anchor_duration_ = duration;
+        pace_anchor_elapsed_ = table_elapsed;
+    }
+
+    double pace = 1.0;
+    float table_delta = table_elapsed - pace_anchor_elapsed_;
+    if (pace_anchor_duration_ >= 0.0 && table_delta >= PACE_MIN_TABLE_SECONDS) {
+        pace = std::clamp((duration - pace_anchor_duration_) / table_delta, PACE_MIN, PACE_MAX);
+    }
+
+    int remaining = static_cast<int>(std::lround(time_table_->remaining_at(file_position) * pace));
+    if (lv_subject_get_int(&print_time_left_) != remaining) {
+        lv_subject_set_int(&print_time_left_, remaining);
+    }
+}
+
 void PrinterPrintState::update_print_show_progress() {
     // Combined subject for home panel progress card visibility
     // Show progress card only when: print is active AND not in print start phase
@@ -295,6 +389,18 @@ void PrinterPrintState::set_print_layer_total(int total) {
     lv_subject_set_int(&print_layer_total_, total);
 }
 
+void PrinterPrintState::set_print_time_table(
+    const std::string& filename, std::shared_ptr<const helix::gcode::PrintTimeTable> table) {
+    // Called from PrintStatusPanel's main-thread callback, like the thumbnail path
+    time_table_ = std::move(table);
+    time_table_filename_ = time_table_ ? filename : std::string();
+    pace_anchor_duration_ = -1.0;
+    if (time_table_) {
+        spdlog::info("[PrinterPrintState] Using print time table for {} (est. {:.0f}s)", filename,
+                     time_table_->total_s());
+    }
+}
+
 void PrinterPrintState::set_print_start_state(PrintStartPhase phase, const char* message,
                                               int progress) {
     spdlog::debug("[PrinterPrintState] Print start: phase={}, message='{}', progress={}%",
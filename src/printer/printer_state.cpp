@@ -29,6 +29,7 @@
 #include "moonraker_client.h" // For ConnectionState enum
 #include "probe_sensor_manager.h"
 #include "runtime_config.h"
+#include "scoped_trace.h"
 #include "unit_conversions.h"
 #include "width_sensor_manager.h"
 
@@ -312,20 +313,56 @@ void PrinterState::update_from_notification(const json& notification) {
     }
 }
 
+void PrinterState::update_from_status_delta(std::shared_ptr<const helix::StatusDelta> delta) {
+    if (!delta) {
+        return;
+    }
+
+    // CRITICAL: Defer to main thread, as in update_from_notification()
+    helix::async::invoke([this, delta = std::move(delta)]() {
+        if (lvgl_is_rendering()) {
+            spdlog::error("[PrinterState] async status update running during render phase!");
+        }
+        update_from_delta(*delta);
+    });
+}
+
 void PrinterState::update_from_status(const json& state) {
+    HELIX_TRACE_SCOPE("status", "PrinterState::update_from_status");
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    apply_status_locked(state, nullptr);
+}
+
+void PrinterState::update_from_delta(const helix::StatusDelta& delta) {
+    HELIX_TRACE_SCOPE("status", "PrinterState::update_from_delta");
     std::lock_guard<std::mutex> lock(state_mutex_);
+    apply_status_locked(delta.other, &delta);
+}
 
+void PrinterState::apply_status_locked(const json& state, const helix::StatusDelta* delta) {
     // Debug: Check if we're in render phase (this should never be true)
     LV_DEBUG_RENDER_STATE();
 
     // Delegate temperature updates to temperature state component
-    temperature_state_.update_from_status(state);
+    if (delta) {
+        temperature_state_.update_from_delta(*delta);
+    } else {
+        temperature_state_.update_from_status(state);
+    }
 
     // Delegate motion updates to motion state component
-    motion_state_.update_from_status(state);
+    if (delta) {
+        motion_state_.update_from_delta(*delta);
+    } else {
+        motion_state_.update_from_status(state);
+    }
 
     // Delegate print updates to print state component
-    print_domain_.update_from_status(state);
+    if (delta) {
+        print_domain_.update_from_delta(*delta);
+    } else {
+        print_domain_.update_from_status(state);
+    }
 
     // Note: Toolhead position, homed_axes, speed_factor, flow_factor, and gcode_z_offset
     // are now updated by motion_state_.update_from_status() above
@@ -341,7 +378,16 @@ void PrinterState::update_from_status(const json& state) {
     }
 
     // Delegate fan state updates to fan component
-    fan_state_.update_from_status(state);
+    if (delta) {
+        fan_state_.update_from_delta(*delta);
+    } else {
+        fan_state_.update_from_status(state);
+    }
+
+    // Everything below only reads untyped objects
+    if (delta && state.is_null()) {
+        return;
+    }
 
     // Delegate LED state updates to LED component
     led_state_component_.update_from_status(state);
@@ -401,7 +447,7 @@ void PrinterState::update_from_status(const json& state) {
     helix::sensors::AccelSensorManager::instance().update_from_status(state);
     helix::sensors::ColorSensorManager::instance().update_from_status(state);
 
-    // Cache full state for complex queries
+    // Cache state for complex queries (typed delta slots are not cached)
     json_state_.merge_patch(state);
 }
 
@@ -110,6 +110,36 @@ void PrinterTemperatureState::update_from_status(const nlohmann::json& status) {
     }
 }
 
+void PrinterTemperatureState::update_from_delta(const StatusDelta& delta) {
+    if (!delta.other.is_null()) {
+        update_from_status(delta.other);
+    }
+
+    for (const auto& sample : delta.thermals) {
+        if (sample.object == "extruder") {
+            if (sample.has(ThermalSample::TEMPERATURE)) {
+                lv_subject_set_int(&extruder_temp_,
+                                   helix::units::to_centidegrees(sample.temperature));
+                lv_subject_notify(&extruder_temp_); // Force notify for graph updates
+            }
+            if (sample.has(ThermalSample::TARGET)) {
+                lv_subject_set_int(&extruder_target_, helix::units::to_centidegrees(sample.target));
+            }
+        } else if (sample.object == "heater_bed") {
+            if (sample.has(ThermalSample::TEMPERATURE)) {
+                lv_subject_set_int(&bed_temp_, helix::units::to_centidegrees(sample.temperature));
+                lv_subject_notify(&bed_temp_); // Force notify for graph updates
+            }
+            if (sample.has(ThermalSample::TARGET)) {
+                lv_subject_set_int(&bed_target_, helix::units::to_centidegrees(sample.target));
+            }
+        } else if (!chamber_sensor_name_.empty() && sample.object == chamber_sensor_name_ &&
+                   sample.has(ThermalSample::TEMPERATURE)) {
+            lv_subject_set_int(&chamber_temp_, helix::units::to_centidegrees(sample.temperature));
+        }
+    }
+}
+
 void PrinterTemperatureState::reset_for_testing() {
     if (!subjects_initialized_) {
         spdlog::debug("[PrinterTemperatureState] reset_for_testing: subjects not initialized, "
@@ -16,68 +16,118 @@
 namespace helix {
 namespace mesh {
 
+namespace {
+
+/// Append a world-space vertex to the renderer's SoA arrays, returning its index
+uint32_t add_vertex(bed_mesh_renderer_t* renderer, double x, double y, double z) {
+    renderer->vertex_x.push_back(static_cast<float>(x));
+    renderer->vertex_y.push_back(static_cast<float>(y));
+    renderer->vertex_z.push_back(static_cast<float>(z));
+    return static_cast<uint32_t>(renderer->vertex_x.size() - 1);
+}
+
+/// Point a quad at grid cell (row, col) of a vertex grid and record its centroid
+void index_grid_quad(bed_mesh_renderer_t* renderer, bed_mesh_quad_3d_t& quad, uint32_t base,
+                     int grid_cols, int row, int col) {
+    auto index = [&](int r, int c) {
+        return base + static_cast<uint32_t>(r * grid_cols + c);
+    };
+
+    // Vertex order: [0]=BL, [1]=BR, [2]=TL, [3]=TR (see generate_mesh_quads)
+    // Grid row r+1 is the "bottom" (front) edge of cell r
+    quad.vertex[0] = index(row + 1, col);
+    quad.vertex[1] = index(row + 1, col + 1);
+    quad.vertex[2] = index(row, col);
+    quad.vertex[3] = index(row, col + 1);
+
+    float cx = 0.0f;
+    float cy = 0.0f;
+    float cz = 0.0f;
+    for (uint32_t v : quad.vertex) {
+        cx += renderer->vertex_x[v];
+        cy += renderer->vertex_y[v];
+        cz += renderer->vertex_z[v];
+    }
+    renderer->quad_center_x.push_back(cx * 0.25f);
+    renderer->quad_center_y.push_back(cy * 0.25f);
+    renderer->quad_center_z.push_back(cz * 0.25f);
+}
+
+/// angle_z quadrant (0-3) of a view direction's XY component
+int view_quadrant(const float dir[3]) {
+    return (dir[0] >= 0.0f ? 0 : 1) | (dir[1] >= 0.0f ? 0 : 2);
+}
+
+} // namespace
+
 void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
     if (!renderer || !renderer->has_mesh_data) {
         return;
     }
 
     renderer->quads.clear();
+    renderer->vertex_x.clear();
+    renderer->vertex_y.clear();
+    renderer->vertex_z.clear();
+    renderer->quad_center_x.clear();
+    renderer->quad_center_y.clear();
+    renderer->quad_center_z.clear();
+    renderer->draw_order.clear();
+    renderer->draw_order_quadrant = -1;
 
     // Pre-allocate capacity to avoid reallocations during generation
     // Number of quads = (rows-1) × (cols-1)
     int expected_quads = (renderer->rows - 1) * (renderer->cols - 1);
+    size_t mesh_vertices = static_cast<size_t>(renderer->rows * renderer->cols);
     renderer->quads.reserve(static_cast<size_t>(expected_quads));
+    renderer->vertex_x.reserve(mesh_vertices);
+    renderer->vertex_y.reserve(mesh_vertices);
+    renderer->vertex_z.reserve(mesh_vertices);
     helix::MemoryMonitor::log_now("bed_mesh_quads_reserved");
 
     // Use cached z_center (computed once in compute_mesh_bounds)
 
-    // Generate quads for each mesh cell
-    for (int row = 0; row < renderer->rows - 1; row++) {
-        for (int col = 0; col < renderer->cols - 1; col++) {
-            bed_mesh_quad_3d_t quad;
-
-            // Compute base X,Y positions
-            double base_x_0, base_x_1, base_y_0, base_y_1;
+    // Mesh grid vertices: each mesh point is converted to world space once and
+    // shared by up to 4 quads (previously every quad carried its own 4 copies)
+    std::vector<lv_color_t> mesh_colors(mesh_vertices);
+    for (int row = 0; row < renderer->rows; row++) {
+        for (int col = 0; col < renderer->cols; col++) {
+            double world_x, world_y;
 
             if (renderer->geometry_computed) {
                 // Mainsail-style: Position mesh within bed using mesh_area bounds
                 // Interpolate printer coordinates from mesh indices
-                double cols_minus_1 = static_cast<double>(renderer->cols - 1);
-                double rows_minus_1 = static_cast<double>(renderer->rows - 1);
-
-                double printer_x0 =
-                    renderer->mesh_area_min_x +
-                    col / cols_minus_1 * (renderer->mesh_area_max_x - renderer->mesh_area_min_x);
-                double printer_x1 = renderer->mesh_area_min_x +
-                                    (col + 1) / cols_minus_1 *
-                                        (renderer->mesh_area_max_x - renderer->mesh_area_min_x);
-                double printer_y0 =
-                    renderer->mesh_area_min_y +
-                    row / rows_minus_1 * (renderer->mesh_area_max_y - renderer->mesh_area_min_y);
-                double printer_y1 = renderer->mesh_area_min_y +
-                                    (row + 1) / rows_minus_1 *
-                                        (renderer->mesh_area_max_y - renderer->mesh_area_min_y);
+                double printer_x = mesh_index_to_printer_coord(
+                    col, renderer->cols - 1, renderer->mesh_area_min_x, renderer->mesh_area_max_x);
+                double printer_y = mesh_index_to_printer_coord(
+                    row, renderer->rows - 1, renderer->mesh_area_min_y, renderer->mesh_area_max_y);
 
                 // Convert printer coordinates to world space
-                base_x_0 = helix::mesh::printer_x_to_world_x(printer_x0, renderer->bed_center_x,
-                                                             renderer->coord_scale);
-                base_x_1 = helix::mesh::printer_x_to_world_x(printer_x1, renderer->bed_center_x,
-                                                             renderer->coord_scale);
-                base_y_0 = helix::mesh::printer_y_to_world_y(printer_y0, renderer->bed_center_y,
-                                                             renderer->coord_scale);
-                base_y_1 = helix::mesh::printer_y_to_world_y(printer_y1, renderer->bed_center_y,
-                                                             renderer->coord_scale);
+                world_x = helix::mesh::printer_x_to_world_x(printer_x, renderer->bed_center_x,
+                                                            renderer->coord_scale);
+                world_y = helix::mesh::printer_y_to_world_y(printer_y, renderer->bed_center_y,
+                                                            renderer->coord_scale);
             } else {
                 // Legacy: Index-based coordinates (centered around origin)
                 // Note: Y is inverted because mesh[0] = front edge
-                base_x_0 = helix::mesh::mesh_col_to_world_x(col, renderer->cols, BED_MESH_SCALE);
-                base_x_1 =
-                    helix::mesh::mesh_col_to_world_x(col + 1, renderer->cols, BED_MESH_SCALE);
-                base_y_0 = helix::mesh::mesh_row_to_world_y(row, renderer->rows, BED_MESH_SCALE);
-                base_y_1 =
-                    helix::mesh::mesh_row_to_world_y(row + 1, renderer->rows, BED_MESH_SCALE);
+                world_x = helix::mesh::mesh_col_to_world_x(col, renderer->cols, BED_MESH_SCALE);
+                world_y = helix::mesh::mesh_row_to_world_y(row, renderer->rows, BED_MESH_SCALE);
             }
 
+            double mesh_z = renderer->z_at(row, col);
+            uint32_t v = add_vertex(renderer, world_x, world_y,
+                                    helix::mesh::mesh_z_to_world_z(
+                                        mesh_z, renderer->cached_z_center,
+                                        renderer->view_state.z_scale));
+            mesh_colors[v] = bed_mesh_gradient_height_to_color(mesh_z, renderer->color_min_z,
+                                                               renderer->color_max_z);
+        }
+    }
+    renderer->mesh_vertex_count = renderer->vertex_x.size();
+
+    // Generate quads for each mesh cell
+    for (int row = 0; row < renderer->rows - 1; row++) {
+        for (int col = 0; col < renderer->cols - 1; col++) {
             /**
              * Quad vertex layout (view from above, looking down -Z axis):
              *
@@ -101,57 +151,22 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
              *
              * Winding order: Counter-clockwise (CCW) for front-facing
              */
-            quad.vertices[0].x = base_x_0;
-            quad.vertices[0].y = base_y_1;
-            quad.vertices[0].z = helix::mesh::mesh_z_to_world_z(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col)],
-                renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[0].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col)],
-                renderer->color_min_z, renderer->color_max_z);
-
-            quad.vertices[1].x = base_x_1;
-            quad.vertices[1].y = base_y_1;
-            quad.vertices[1].z = helix::mesh::mesh_z_to_world_z(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col + 1)],
-                renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[1].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col + 1)],
-                renderer->color_min_z, renderer->color_max_z);
-
-            quad.vertices[2].x = base_x_0;
-            quad.vertices[2].y = base_y_0;
-            quad.vertices[2].z = helix::mesh::mesh_z_to_world_z(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)],
-                renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[2].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)],
-                renderer->color_min_z, renderer->color_max_z);
-
-            quad.vertices[3].x = base_x_1;
-            quad.vertices[3].y = base_y_0;
-            quad.vertices[3].z = helix::mesh::mesh_z_to_world_z(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col + 1)],
-                renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[3].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col + 1)],
-                renderer->color_min_z, renderer->color_max_z);
+            bed_mesh_quad_3d_t quad{};
+            index_grid_quad(renderer, quad, 0, renderer->cols, row, col);
+            quad.opacity = LV_OPA_COVER; // Mesh quads are fully opaque
+
+            int red = 0, green = 0, blue = 0;
+            for (int i = 0; i < 4; i++) {
+                quad.colors[i] = mesh_colors[quad.vertex[i]];
+                red += quad.colors[i].red;
+                green += quad.colors[i].green;
+                blue += quad.colors[i].blue;
+            }
 
             // Compute center color for fast rendering
-            bed_mesh_rgb_t avg_color = {
-                static_cast<uint8_t>((quad.vertices[0].color.red + quad.vertices[1].color.red +
-                                      quad.vertices[2].color.red + quad.vertices[3].color.red) /
-                                     4),
-                static_cast<uint8_t>((quad.vertices[0].color.green + quad.vertices[1].color.green +
-                                      quad.vertices[2].color.green + quad.vertices[3].color.green) /
-                                     4),
-                static_cast<uint8_t>((quad.vertices[0].color.blue + quad.vertices[1].color.blue +
-                                      quad.vertices[2].color.blue + quad.vertices[3].color.blue) /
-                                     4)};
-            quad.center_color = lv_color_make(avg_color.r, avg_color.g, avg_color.b);
-
-            quad.avg_depth = 0.0;        // Will be computed during projection
-            quad.opacity = LV_OPA_COVER; // Mesh quads are fully opaque
+            quad.center_color = lv_color_make(static_cast<uint8_t>(red / 4),
+                                              static_cast<uint8_t>(green / 4),
+                                              static_cast<uint8_t>(blue / 4));
 
             renderer->quads.push_back(quad);
         }
@@ -170,10 +185,9 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
             static_cast<size_t>(center_row * (renderer->cols - 1) + center_col);
         if (center_quad_idx < renderer->quads.size()) {
             const auto& q = renderer->quads[center_quad_idx];
-            spdlog::debug(
-                "[QUAD_GEN] Center quad[{}] TL world_z={:.2f}, from mesh_z={:.4f}", center_quad_idx,
-                q.vertices[2].z,
-                renderer->mesh[static_cast<size_t>(center_row)][static_cast<size_t>(center_col)]);
+            spdlog::debug("[QUAD_GEN] Center quad[{}] TL world_z={:.2f}, from mesh_z={:.4f}",
+                          center_quad_idx, renderer->vertex_z[q.vertex[2]],
+                          renderer->z_at(center_row, center_col));
         }
     }
 
@@ -230,47 +244,44 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
             grid_spacing_y = BED_MESH_SCALE;
         }
 
-        // Generate plane quads covering the full bed
-        for (int row = 0; row < plane_rows - 1; row++) {
-            for (int col = 0; col < plane_cols - 1; col++) {
-                bed_mesh_quad_3d_t plane_quad;
-
-                // Compute printer coordinates for this cell
-                double printer_x0 = plane_min_x + col * grid_spacing_x;
-                double printer_x1 = plane_min_x + (col + 1) * grid_spacing_x;
-                double printer_y0 = plane_min_y + row * grid_spacing_y;
-                double printer_y1 = plane_min_y + (row + 1) * grid_spacing_y;
+        // Plane grid vertices (appended after the mesh vertices)
+        uint32_t plane_base = static_cast<uint32_t>(renderer->vertex_x.size());
+        for (int row = 0; row < plane_rows; row++) {
+            for (int col = 0; col < plane_cols; col++) {
+                // Compute printer coordinates for this grid point
+                double printer_x = plane_min_x + col * grid_spacing_x;
+                double printer_y = plane_min_y + row * grid_spacing_y;
 
                 // Convert to world coordinates
-                double base_x_0, base_x_1, base_y_0, base_y_1;
+                double world_x, world_y;
                 if (renderer->geometry_computed) {
-                    base_x_0 = helix::mesh::printer_x_to_world_x(printer_x0, renderer->bed_center_x,
-                                                                 renderer->coord_scale);
-                    base_x_1 = helix::mesh::printer_x_to_world_x(printer_x1, renderer->bed_center_x,
-                                                                 renderer->coord_scale);
-                    base_y_0 = helix::mesh::printer_y_to_world_y(printer_y0, renderer->bed_center_y,
-                                                                 renderer->coord_scale);
-                    base_y_1 = helix::mesh::printer_y_to_world_y(printer_y1, renderer->bed_center_y,
-                                                                 renderer->coord_scale);
+                    world_x = helix::mesh::printer_x_to_world_x(printer_x, renderer->bed_center_x,
+                                                                renderer->coord_scale);
+                    world_y = helix::mesh::printer_y_to_world_y(printer_y, renderer->bed_center_y,
+                                                                renderer->coord_scale);
                 } else {
                     // Legacy fallback
-                    base_x_0 = printer_x0 - plane_max_x / 2.0;
-                    base_x_1 = printer_x1 - plane_max_x / 2.0;
-                    base_y_0 = -(printer_y0 - plane_max_y / 2.0);
-                    base_y_1 = -(printer_y1 - plane_max_y / 2.0);
+                    world_x = printer_x - plane_max_x / 2.0;
+                    world_y = -(printer_y - plane_max_y / 2.0);
                 }
 
                 // All vertices at same Z (flat plane)
-                // Vertex layout matches mesh quads: [0]=BL, [1]=BR, [2]=TL, [3]=TR
-                plane_quad.vertices[0] = {base_x_0, base_y_1, plane_world_z, plane_color};
-                plane_quad.vertices[1] = {base_x_1, base_y_1, plane_world_z, plane_color};
-                plane_quad.vertices[2] = {base_x_0, base_y_0, plane_world_z, plane_color};
-                plane_quad.vertices[3] = {base_x_1, base_y_0, plane_world_z, plane_color};
+                add_vertex(renderer, world_x, world_y, plane_world_z);
+            }
+        }
 
-                plane_quad.center_color = plane_color;
-                plane_quad.avg_depth = 0.0; // Will be computed during projection
-                plane_quad.opacity = renderer->zero_plane_opacity; // Translucent
+        // Generate plane quads covering the full bed
+        // Vertex layout matches mesh quads: [0]=BL, [1]=BR, [2]=TL, [3]=TR
+        bed_mesh_quad_3d_t plane_quad{};
+        for (lv_color_t& color : plane_quad.colors) {
+            color = plane_color;
+        }
+        plane_quad.center_color = plane_color;
+        plane_quad.opacity = renderer->zero_plane_opacity; // Translucent
 
+        for (int row = 0; row < plane_rows - 1; row++) {
+            for (int col = 0; col < plane_cols - 1; col++) {
+                index_grid_quad(renderer, plane_quad, plane_base, plane_cols, row, col);
                 renderer->quads.push_back(plane_quad);
             }
         }
@@ -287,12 +298,72 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
         renderer->rows, renderer->cols);
 }
 
-void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads) {
-    std::sort(quads.begin(), quads.end(),
-              [](const bed_mesh_quad_3d_t& a, const bed_mesh_quad_3d_t& b) {
-                  // Descending order: furthest (largest depth) first
-                  return a.avg_depth > b.avg_depth;
-              });
+void update_draw_order(const float* center_x, const float* center_y, const float* center_z,
+                       size_t count, const float dir[3], bool full_sort, std::vector<float>& keys,
+                       std::vector<uint32_t>& order) {
+    // Key = how far toward the camera each centroid is (plain multiply-add loop, vectorizable)
+    keys.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = center_x[i] * dir[0] + center_y[i] * dir[1] + center_z[i] * dir[2];
+    }
+
+    auto further = [&keys](uint32_t a, uint32_t b) {
+        return keys[a] < keys[b];
+    };
+
+    if (full_sort || order.size() != count) {
+        order.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(order.begin(), order.end(), further);
+        return;
+    }
+
+    // Insertion sort: linear when the previous frame's order is nearly right
+    for (size_t i = 1; i < count; i++) {
+        uint32_t idx = order[i];
+        size_t j = i;
+        while (j > 0 && further(idx, order[j - 1])) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = idx;
+    }
+}
+
+void update_quad_draw_order(bed_mesh_renderer_t* renderer) {
+    if (!renderer) {
+        return;
+    }
+
+    // Toward-camera axis in world space (inverse of the projection's rotations):
+    // camera-space z = -x*sin_z*sin_x + y*cos_z*sin_x + z*cos_x, depth = distance - that
+    const bed_mesh_view_state_t& view = renderer->view_state;
+    float dir[3] = {
+        static_cast<float>(-view.cached_sin_z * view.cached_sin_x),
+        static_cast<float>(view.cached_cos_z * view.cached_sin_x),
+        static_cast<float>(view.cached_cos_x),
+    };
+
+    size_t count = renderer->quads.size();
+    if (renderer->draw_order.size() == count && dir[0] == renderer->draw_order_dir[0] &&
+        dir[1] == renderer->draw_order_dir[1] && dir[2] == renderer->draw_order_dir[2]) {
+        return; // View unchanged - order still valid
+    }
+
+    int quadrant = view_quadrant(dir);
+    bool full_sort = quadrant != renderer->draw_order_quadrant;
+
+    update_draw_order(renderer->quad_center_x.data(), renderer->quad_center_y.data(),
+                      renderer->quad_center_z.data(), count, dir, full_sort,
+                      renderer->draw_order_keys, renderer->draw_order);
+
+    renderer->draw_order_dir = {dir[0], dir[1], dir[2]};
+    renderer->draw_order_quadrant = quadrant;
+
+    spdlog::trace("[Bed Mesh Geometry] Draw order {} for {} quads",
+                  full_sort ? "rebuilt" : "repaired", count);
 }
 
 } // namespace mesh
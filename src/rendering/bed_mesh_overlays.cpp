@@ -106,7 +106,8 @@ namespace mesh {
 
 void render_grid_lines(lv_layer_t* layer, const bed_mesh_renderer_t* renderer, int canvas_width,
                        int canvas_height) {
-    if (!renderer || !renderer->has_mesh_data) {
+    if (!renderer || !renderer->has_mesh_data ||
+        renderer->projected_screen_x.size() < renderer->mesh_vertex_count) {
         return;
     }
 
@@ -119,16 +120,20 @@ void render_grid_lines(lv_layer_t* layer, const bed_mesh_renderer_t* renderer, i
 
     // Use cached projected screen coordinates (SOA arrays - already computed in render function)
     // This eliminates ~400 redundant projections for 20×20 mesh
-    const auto& screen_x = renderer->projected_screen_x;
-    const auto& screen_y = renderer->projected_screen_y;
+    // Mesh grid vertices come first, indexed row * cols + col
+    const int* screen_x = renderer->projected_screen_x.data();
+    const int* screen_y = renderer->projected_screen_y.data();
+    auto at = [cols = renderer->cols](int row, int col) {
+        return static_cast<size_t>(row * cols + col);
+    };
 
     // Draw horizontal grid lines (connect points in same row)
     for (int row = 0; row < renderer->rows; row++) {
         for (int col = 0; col < renderer->cols - 1; col++) {
-            int p1_x = screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int p1_y = screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int p2_x = screen_x[static_cast<size_t>(row)][static_cast<size_t>(col + 1)];
-            int p2_y = screen_y[static_cast<size_t>(row)][static_cast<size_t>(col + 1)];
+            int p1_x = screen_x[at(row, col)];
+            int p1_y = screen_y[at(row, col)];
+            int p2_x = screen_x[at(row, col + 1)];
+            int p2_y = screen_y[at(row, col + 1)];
 
             // Bounds check (allow some margin for partially visible lines)
             if (is_line_visible(p1_x, p1_y, p2_x, p2_y, canvas_width, canvas_height)) {
@@ -145,10 +150,10 @@ void render_grid_lines(lv_layer_t* layer, const bed_mesh_renderer_t* renderer, i
     // Draw vertical grid lines (connect points in same column)
     for (int col = 0; col < renderer->cols; col++) {
         for (int row = 0; row < renderer->rows - 1; row++) {
-            int p1_x = screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int p1_y = screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int p2_x = screen_x[static_cast<size_t>(row + 1)][static_cast<size_t>(col)];
-            int p2_y = screen_y[static_cast<size_t>(row + 1)][static_cast<size_t>(col)];
+            int p1_x = screen_x[at(row, col)];
+            int p1_y = screen_y[at(row, col)];
+            int p2_x = screen_x[at(row + 1, col)];
+            int p2_y = screen_y[at(row + 1, col)];
 
             // Bounds check
             if (is_line_visible(p1_x, p1_y, p2_x, p2_y, canvas_width, canvas_height)) {
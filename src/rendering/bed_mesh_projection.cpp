@@ -3,6 +3,8 @@
 
 #include "bed_mesh_projection.h"
 
+#include <cmath>
+
 bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, double z,
                                                          int canvas_width, int canvas_height,
                                                          const bed_mesh_view_state_t* view) {
@@ -52,3 +54,38 @@ bed_mesh_point_3d_t bed_mesh_projection_project_3d_to_2d(double x, double y, dou
 
     return result;
 }
+
+void bed_mesh_projection_project_batch(const float* x, const float* y, const float* z, size_t count,
+                                       int canvas_width, int canvas_height,
+                                       const bed_mesh_view_state_t* view, int* out_screen_x,
+                                       int* out_screen_y) {
+    // Hoist all per-frame constants out of the loop (see scalar version for the math)
+    const float cos_z = static_cast<float>(view->cached_cos_z);
+    const float sin_z = static_cast<float>(view->cached_sin_z);
+    const float cos_x = static_cast<float>(view->cached_cos_x);
+    const float sin_x = static_cast<float>(view->cached_sin_x);
+    const float camera_distance = static_cast<float>(view->camera_distance);
+    const float fov_scale = static_cast<float>(view->fov_scale);
+    constexpr float MIN_CAMERA_Z = 1.0f;
+
+    // Screen origin, including the integer centering/layer offsets
+    const float origin_x = static_cast<float>(canvas_width / 2);
+    const float origin_y = static_cast<float>(canvas_height * BED_MESH_Z_ORIGIN_VERTICAL_POS);
+    const int offset_x = view->center_offset_x + view->layer_offset_x;
+    const int offset_y = view->center_offset_y + view->layer_offset_y;
+
+    for (size_t i = 0; i < count; i++) {
+        float rotated_x = x[i] * cos_z + y[i] * sin_z;
+        float rotated_y = -x[i] * sin_z + y[i] * cos_z;
+
+        float final_y = rotated_y * cos_x - z[i] * sin_x;
+        float final_z = camera_distance - (rotated_y * sin_x + z[i] * cos_x);
+        // max(final_z, MIN_CAMERA_Z) written with fabs: a compare-and-select here
+        // blocks auto-vectorization unless -fno-trapping-math is set
+        final_z = 0.5f * (final_z + MIN_CAMERA_Z + std::fabs(final_z - MIN_CAMERA_Z));
+
+        float inv_z = fov_scale / final_z;
+        out_screen_x[i] = static_cast<int>(origin_x + rotated_x * inv_z) + offset_x;
+        out_screen_y[i] = static_cast<int>(origin_y + final_y * inv_z) + offset_y;
+    }
+}
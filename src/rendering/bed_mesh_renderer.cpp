@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <mutex>
@@ -50,8 +51,7 @@ static double compute_dynamic_z_scale(double z_range);
 static void update_trig_cache(bed_mesh_view_state_t* view_state);
 static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas_width,
                                        int canvas_height);
-static void project_and_cache_quads(bed_mesh_renderer_t* renderer, int canvas_width,
-                                    int canvas_height);
+static void project_and_cache_quads(bed_mesh_renderer_t* renderer);
 static void compute_projected_mesh_bounds(const bed_mesh_renderer_t* renderer, int* out_min_x,
                                           int* out_max_x, int* out_min_y, int* out_max_y);
 static void compute_centering_offset(int mesh_min_x, int mesh_max_x, int mesh_min_y, int mesh_max_y,
@@ -169,17 +169,29 @@ bool bed_mesh_renderer_set_mesh_data(bed_mesh_renderer_t* renderer, const float*
         return false;
     }
 
+    // Same mesh again (profile list refresh, re-activated panel): keep the
+    // existing quads and cached projections instead of rebuilding them
+    if (renderer->has_mesh_data && renderer->state != RendererState::ERROR &&
+        renderer->rows == rows && renderer->cols == cols) {
+        bool same = true;
+        for (int row = 0; row < rows && same; row++) {
+            same = std::equal(mesh[row], mesh[row] + cols,
+                              renderer->mesh.begin() + static_cast<std::ptrdiff_t>(row) * cols);
+        }
+        if (same) {
+            spdlog::trace("[Bed Mesh Renderer] Mesh data unchanged ({}x{}), keeping geometry",
+                          rows, cols);
+            return true;
+        }
+    }
+
     spdlog::debug("[Bed Mesh Renderer] Setting mesh data: {}x{} points", rows, cols);
 
-    // Allocate storage
-    renderer->mesh.clear();
-    renderer->mesh.resize(static_cast<size_t>(rows));
+    // Allocate storage (contiguous, row-major)
+    renderer->mesh.resize(static_cast<size_t>(rows) * static_cast<size_t>(cols));
     for (int row = 0; row < rows; row++) {
-        renderer->mesh[static_cast<size_t>(row)].resize(static_cast<size_t>(cols));
-        for (int col = 0; col < cols; col++) {
-            renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)] =
-                static_cast<double>(mesh[row][col]);
-        }
+        std::copy(mesh[row], mesh[row] + cols,
+                  renderer->mesh.begin() + static_cast<std::ptrdiff_t>(row) * cols);
     }
 
     renderer->rows = rows;
@@ -246,11 +258,22 @@ void bed_mesh_renderer_set_rotation(bed_mesh_renderer_t* renderer, double angle_
     }
 }
 
-void bed_mesh_renderer_set_bounds(bed_mesh_renderer_t* renderer, double bed_x_min, double bed_x_max,
+bool bed_mesh_renderer_set_bounds(bed_mesh_renderer_t* renderer, double bed_x_min, double bed_x_max,
                                   double bed_y_min, double bed_y_max, double mesh_x_min,
                                   double mesh_x_max, double mesh_y_min, double mesh_y_max) {
     if (!renderer) {
-        return;
+        return false;
+    }
+
+    // Same bounds again (mesh status update, build volume refresh): keep the
+    // quads and the user's zoom/centering instead of regenerating and re-fitting
+    if (renderer->has_bed_bounds && renderer->has_mesh_bounds &&
+        renderer->bed_min_x == bed_x_min && renderer->bed_max_x == bed_x_max &&
+        renderer->bed_min_y == bed_y_min && renderer->bed_max_y == bed_y_max &&
+        renderer->mesh_area_min_x == mesh_x_min && renderer->mesh_area_max_x == mesh_x_max &&
+        renderer->mesh_area_min_y == mesh_y_min && renderer->mesh_area_max_y == mesh_y_max) {
+        spdlog::trace("[Bed Mesh Renderer] Bounds unchanged, keeping geometry");
+        return false;
     }
 
     // Set bed bounds (full print bed area - used for grid/walls)
@@ -302,6 +325,7 @@ void bed_mesh_renderer_set_bounds(bed_mesh_renderer_t* renderer, double bed_x_mi
         helix::mesh::generate_mesh_quads(renderer);
         renderer->state = RendererState::MESH_LOADED;
     }
+    return true;
 }
 
 const bed_mesh_view_state_t* bed_mesh_renderer_get_view_state(bed_mesh_renderer_t* renderer) {
@@ -582,18 +606,9 @@ static void compute_mesh_bounds(bed_mesh_renderer_t* renderer) {
         return;
     }
 
-    double min_z = renderer->mesh[0][0];
-    double max_z = renderer->mesh[0][0];
-
-    for (int row = 0; row < renderer->rows; row++) {
-        for (int col = 0; col < renderer->cols; col++) {
-            double z = renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            if (z < min_z)
-                min_z = z;
-            if (z > max_z)
-                max_z = z;
-        }
-    }
+    auto [min_it, max_it] = std::minmax_element(renderer->mesh.begin(), renderer->mesh.end());
+    double min_z = *min_it;
+    double max_z = *max_it;
 
     renderer->mesh_min_z = min_z;
     renderer->mesh_max_z = max_z;
@@ -638,8 +653,9 @@ static inline void update_trig_cache(bed_mesh_view_state_t* view_state) {
 }
 
 /**
- * Project all mesh vertices to screen space and cache for reuse
- * Avoids redundant projections in grid/axis rendering (15-20% speedup)
+ * Project all vertices (mesh grid and zero plane) to screen space and cache for reuse
+ * Each shared vertex is projected once per pass instead of once per quad corner,
+ * in a single vectorizable loop over the float SOA arrays
  * @param renderer Renderer with mesh data
  * @param canvas_width Canvas width in pixels
  * @param canvas_height Canvas height in pixels
@@ -650,132 +666,55 @@ static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas
         return;
     }
 
-    // Resize SOA caches if needed (avoid reallocation on every frame)
-    if (renderer->projected_screen_x.size() != static_cast<size_t>(renderer->rows)) {
-        renderer->projected_screen_x.resize(static_cast<size_t>(renderer->rows));
-        renderer->projected_screen_y.resize(static_cast<size_t>(renderer->rows));
-    }
+    // Resize SOA caches if needed (no reallocation on every frame)
+    size_t count = renderer->vertex_x.size();
+    renderer->projected_screen_x.resize(count);
+    renderer->projected_screen_y.resize(count);
 
-    // Use cached z_center (computed once in compute_mesh_bounds)
+    bed_mesh_projection_project_batch(renderer->vertex_x.data(), renderer->vertex_y.data(),
+                                      renderer->vertex_z.data(), count, canvas_width,
+                                      canvas_height, &renderer->view_state,
+                                      renderer->projected_screen_x.data(),
+                                      renderer->projected_screen_y.data());
 
-    // Project all vertices once (projection handles centering internally)
-    for (int row = 0; row < renderer->rows; row++) {
-        if (renderer->projected_screen_x[static_cast<size_t>(row)].size() !=
-            static_cast<size_t>(renderer->cols)) {
-            renderer->projected_screen_x[static_cast<size_t>(row)].resize(
-                static_cast<size_t>(renderer->cols));
-            renderer->projected_screen_y[static_cast<size_t>(row)].resize(
-                static_cast<size_t>(renderer->cols));
-        }
-
-        for (int col = 0; col < renderer->cols; col++) {
-            // Convert mesh coordinates to world space
-            double world_x, world_y;
-
-            if (renderer->geometry_computed) {
-                // Mainsail-style: Position mesh within bed using mesh_area bounds
-                double cols_minus_1 = static_cast<double>(renderer->cols - 1);
-                double rows_minus_1 = static_cast<double>(renderer->rows - 1);
-
-                double printer_x =
-                    renderer->mesh_area_min_x +
-                    col / cols_minus_1 * (renderer->mesh_area_max_x - renderer->mesh_area_min_x);
-                double printer_y =
-                    renderer->mesh_area_min_y +
-                    row / rows_minus_1 * (renderer->mesh_area_max_y - renderer->mesh_area_min_y);
-
-                world_x = helix::mesh::printer_x_to_world_x(printer_x, renderer->bed_center_x,
-                                                            renderer->coord_scale);
-                world_y = helix::mesh::printer_y_to_world_y(printer_y, renderer->bed_center_y,
-                                                            renderer->coord_scale);
-            } else {
-                // Legacy: Index-based coordinates
-                world_x = helix::mesh::mesh_col_to_world_x(col, renderer->cols, BED_MESH_SCALE);
-                world_y = helix::mesh::mesh_row_to_world_y(row, renderer->rows, BED_MESH_SCALE);
-            }
-
-            double world_z = helix::mesh::mesh_z_to_world_z(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)],
-                renderer->cached_z_center, renderer->view_state.z_scale);
-
-            // Project to screen space and cache only screen coordinates (SOA)
-            bed_mesh_point_3d_t projected = bed_mesh_projection_project_3d_to_2d(
-                world_x, world_y, world_z, canvas_width, canvas_height, &renderer->view_state);
-
-            renderer->projected_screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)] =
-                projected.screen_x;
-            renderer->projected_screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)] =
-                projected.screen_y;
-
-            // DEBUG: Log sample point (center of mesh)
-            if (row == renderer->rows / 2 && col == renderer->cols / 2) {
-                spdlog::debug("[Bed Mesh Renderer] [GRID_VERTEX] mesh[{},{}] -> "
-                              "world({:.2f},{:.2f},{:.2f}) -> screen({},{})",
-                              row, col, world_x, world_y, world_z, projected.screen_x,
-                              projected.screen_y);
-            }
-        }
+    // DEBUG: Log sample point (center of mesh)
+    size_t center = static_cast<size_t>((renderer->rows / 2) * renderer->cols + renderer->cols / 2);
+    if (center < renderer->mesh_vertex_count) {
+        spdlog::debug("[Bed Mesh Renderer] [GRID_VERTEX] mesh[{},{}] -> "
+                      "world({:.2f},{:.2f},{:.2f}) -> screen({},{})",
+                      renderer->rows / 2, renderer->cols / 2, renderer->vertex_x[center],
+                      renderer->vertex_y[center], renderer->vertex_z[center],
+                      renderer->projected_screen_x[center], renderer->projected_screen_y[center]);
     }
 }
 
 /**
- * @brief Project all quad vertices to screen space and cache results
- *
- * Computes screen coordinates and depths for all vertices of all quads in a single pass.
- * This eliminates redundant projections - previously each quad was projected 3 times:
- * once for depth sorting, once for bounds tracking, and once during rendering.
+ * @brief Gather cached vertex projections into each quad's screen coordinates
  *
- * Must be called whenever view state changes (rotation, FOV, centering offset).
+ * Quads share vertices, so projection happens once per vertex in
+ * project_and_cache_vertices(); this only copies the results into the
+ * per-quad screen_x[]/screen_y[] arrays the rasterizer reads.
  *
- * @param renderer Renderer with quads already generated
- * @param canvas_width Canvas width in pixels
- * @param canvas_height Canvas height in pixels
+ * Must be called after the final project_and_cache_vertices() of the frame.
  *
- * Side effects:
- * - Updates quad.screen_x[], quad.screen_y[], quad.depths[] for all quads
- * - Updates quad.avg_depth for depth sorting
+ * @param renderer Renderer with quads generated and vertices projected
  */
-static void project_and_cache_quads(bed_mesh_renderer_t* renderer, int canvas_width,
-                                    int canvas_height) {
-    if (!renderer || renderer->quads.empty()) {
+static void project_and_cache_quads(bed_mesh_renderer_t* renderer) {
+    if (!renderer || renderer->quads.empty() ||
+        renderer->projected_screen_x.size() != renderer->vertex_x.size()) {
         return;
     }
 
+    const int* screen_x = renderer->projected_screen_x.data();
+    const int* screen_y = renderer->projected_screen_y.data();
     for (auto& quad : renderer->quads) {
-        double total_depth = 0.0;
-
         for (int i = 0; i < 4; i++) {
-            bed_mesh_point_3d_t projected = bed_mesh_projection_project_3d_to_2d(
-                quad.vertices[i].x, quad.vertices[i].y, quad.vertices[i].z, canvas_width,
-                canvas_height, &renderer->view_state);
-
-            quad.screen_x[i] = projected.screen_x;
-            quad.screen_y[i] = projected.screen_y;
-            quad.depths[i] = projected.depth;
-            total_depth += projected.depth;
-        }
-
-        quad.avg_depth = total_depth / 4.0;
-    }
-
-    // DEBUG: Log a sample quad vertex (TL of center quad corresponds to mesh center)
-    // For an NxN grid, center quad is at index ((N-1)/2 * (N-1) + (N-1)/2)
-    if (!renderer->quads.empty()) {
-        int center_row = (renderer->rows - 1) / 2;
-        int center_col = (renderer->cols - 1) / 2;
-        size_t center_quad_idx =
-            static_cast<size_t>(center_row * (renderer->cols - 1) + center_col);
-        if (center_quad_idx < renderer->quads.size()) {
-            const auto& q = renderer->quads[center_quad_idx];
-            // TL vertex (index 2) corresponds to mesh[row][col]
-            spdlog::debug("[Bed Mesh Renderer] [QUAD_VERTEX] quad[{}] TL -> "
-                          "world({:.2f},{:.2f},{:.2f}) -> screen({},{})",
-                          center_quad_idx, q.vertices[2].x, q.vertices[2].y, q.vertices[2].z,
-                          q.screen_x[2], q.screen_y[2]);
+            quad.screen_x[i] = screen_x[quad.vertex[i]];
+            quad.screen_y[i] = screen_y[quad.vertex[i]];
         }
     }
 
-    spdlog::trace("[Bed Mesh Renderer] [CACHE] Projected {} quads to screen space",
+    spdlog::trace("[Bed Mesh Renderer] [CACHE] Gathered screen coordinates for {} quads",
                   renderer->quads.size());
 }
 
@@ -801,17 +740,12 @@ static void compute_projected_mesh_bounds(const bed_mesh_renderer_t* renderer, i
     int min_x = INT_MAX, max_x = INT_MIN;
     int min_y = INT_MAX, max_y = INT_MIN;
 
-    for (int row = 0; row < renderer->rows; row++) {
-        for (int col = 0; col < renderer->cols; col++) {
-            int screen_x =
-                renderer->projected_screen_x[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            int screen_y =
-                renderer->projected_screen_y[static_cast<size_t>(row)][static_cast<size_t>(col)];
-            min_x = std::min(min_x, screen_x);
-            max_x = std::max(max_x, screen_x);
-            min_y = std::min(min_y, screen_y);
-            max_y = std::max(max_y, screen_y);
-        }
+    // Mesh grid only (the zero plane vertices follow it in the same arrays)
+    for (size_t i = 0; i < renderer->mesh_vertex_count; i++) {
+        min_x = std::min(min_x, renderer->projected_screen_x[i]);
+        max_x = std::max(max_x, renderer->projected_screen_x[i]);
+        min_y = std::min(min_y, renderer->projected_screen_y[i]);
+        max_y = std::max(max_y, renderer->projected_screen_y[i]);
     }
 
     *out_min_x = min_x;
@@ -1082,13 +1016,14 @@ static void render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer
     // DO NOT use clip_area dimensions here - they can be smaller during partial redraws
     // which corrupts the 3D projection math
 
-    // Project all quad vertices once and cache screen coordinates + depths
-    // This replaces 3 separate projection passes (depth calc, bounds tracking, rendering)
-    project_and_cache_quads(renderer, canvas_width, canvas_height);
+    // Copy projected vertex coordinates into the quads (vertices were projected
+    // once in prepare_render_frame - no per-quad projection)
+    project_and_cache_quads(renderer);
     auto t_project = std::chrono::high_resolution_clock::now();
 
-    // Sort quads by depth using cached avg_depth (painter's algorithm - furthest first)
-    helix::mesh::sort_quads_by_depth(renderer->quads);
+    // Back-to-front order from world-space centroids (painter's algorithm - furthest first).
+    // Only repaired when the view direction changed since the last frame.
+    helix::mesh::update_quad_draw_order(renderer);
     auto t_sort = std::chrono::high_resolution_clock::now();
 
     spdlog::trace("[Bed Mesh Renderer] Rendering {} quads with {} mode", renderer->quads.size(),
@@ -1111,21 +1046,22 @@ static void render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer
                   canvas_width, canvas_height);
 
     // DEBUG: Log first quad vertex positions using cached coordinates
-    if (!renderer->quads.empty()) {
-        const auto& first_quad = renderer->quads[0];
+    if (!renderer->draw_order.empty()) {
+        const auto& first_quad = renderer->quads[renderer->draw_order[0]];
         spdlog::trace("[Bed Mesh Renderer] [FIRST_QUAD] Vertices (world -> cached screen):");
         for (int i = 0; i < 4; i++) {
+            uint32_t v = first_quad.vertex[i];
             spdlog::trace(
                 "[Bed Mesh Renderer]   v{}: world=({:.2f},{:.2f},{:.2f}) -> screen=({},{})", i,
-                first_quad.vertices[i].x, first_quad.vertices[i].y, first_quad.vertices[i].z,
+                renderer->vertex_x[v], renderer->vertex_y[v], renderer->vertex_z[v],
                 first_quad.screen_x[i], first_quad.screen_y[i]);
         }
     }
 
-    // Render quads using cached screen coordinates
+    // Render quads back-to-front using cached screen coordinates
     bool use_gradient = !renderer->view_state.is_dragging;
-    for (const auto& quad : renderer->quads) {
-        render_quad(layer, quad, use_gradient);
+    for (uint32_t index : renderer->draw_order) {
+        render_quad(layer, renderer->quads[index], use_gradient);
     }
     auto t_rasterize = std::chrono::high_resolution_clock::now();
 
@@ -1271,9 +1207,9 @@ static void render_quad(lv_layer_t* layer, const bed_mesh_quad_3d_t& quad, bool
     // Triangle 1: [0]BL → [1]BR → [2]TL
     if (should_use_gradient) {
         helix::mesh::fill_triangle_gradient(
-            layer, quad.screen_x[0], quad.screen_y[0], quad.vertices[0].color, quad.screen_x[1],
-            quad.screen_y[1], quad.vertices[1].color, quad.screen_x[2], quad.screen_y[2],
-            quad.vertices[2].color, opacity);
+            layer, quad.screen_x[0], quad.screen_y[0], quad.colors[0], quad.screen_x[1],
+            quad.screen_y[1], quad.colors[1], quad.screen_x[2], quad.screen_y[2],
+            quad.colors[2], opacity);
     } else {
         helix::mesh::fill_triangle_solid(layer, quad.screen_x[0], quad.screen_y[0],
                                          quad.screen_x[1], quad.screen_y[1], quad.screen_x[2],
@@ -1283,9 +1219,9 @@ static void render_quad(lv_layer_t* layer, const bed_mesh_quad_3d_t& quad, bool
     // Triangle 2: [1]BR → [3]TR → [2]TL
     if (should_use_gradient) {
         helix::mesh::fill_triangle_gradient(
-            layer, quad.screen_x[1], quad.screen_y[1], quad.vertices[1].color, quad.screen_x[2],
-            quad.screen_y[2], quad.vertices[2].color, quad.screen_x[3], quad.screen_y[3],
-            quad.vertices[3].color, opacity);
+            layer, quad.screen_x[1], quad.screen_y[1], quad.colors[1], quad.screen_x[2],
+            quad.screen_y[2], quad.colors[2], quad.screen_x[3], quad.screen_y[3],
+            quad.colors[3], opacity);
     } else {
         helix::mesh::fill_triangle_solid(layer, quad.screen_x[1], quad.screen_y[1],
                                          quad.screen_x[2], quad.screen_y[2], quad.screen_x[3],
@@ -1416,14 +1352,10 @@ static void render_2d_heatmap(lv_layer_t* layer, bed_mesh_renderer_t* renderer,
     for (int row = 0; row < num_cells_y; row++) {
         for (int col = 0; col < num_cells_x; col++) {
             // Get Z values at the 4 corners of this cell
-            float z_tl = static_cast<float>(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)]);
-            float z_tr = static_cast<float>(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col + 1)]);
-            float z_bl = static_cast<float>(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col)]);
-            float z_br = static_cast<float>(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col + 1)]);
+            float z_tl = renderer->z_at(row, col);
+            float z_tr = renderer->z_at(row, col + 1);
+            float z_bl = renderer->z_at(row + 1, col);
+            float z_br = renderer->z_at(row + 1, col + 1);
             float z_center = (z_tl + z_tr + z_bl + z_br) / 4.0f;
 
             // Convert Z values to colors
@@ -1682,8 +1614,7 @@ bool bed_mesh_renderer_handle_touch(bed_mesh_renderer_t* renderer, int touch_x,
     // so cell indices directly map to mesh array indices for the corner Z value
     renderer->touched_row = row;
     renderer->touched_col = col;
-    renderer->touched_z =
-        static_cast<float>(renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)]);
+    renderer->touched_z = renderer->z_at(row, col);
     renderer->touch_valid = true;
 
     return true;
@@ -0,0 +1,848 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_analysis.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sys/stat.h>
+#include <type_traits>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// The ops detector stops at the first extrusion; this only bounds a file
+// whose preamble never gets there
+constexpr size_t PREAMBLE_MAX_BYTES = 1024 * 1024;
+
+// Same windows as extract_header_metadata()
+constexpr int METADATA_HEADER_LINES = 500;
+constexpr uint64_t METADATA_FOOTER_BYTES = 64 * 1024;
+
+// ============================================================================
+// Move tracking
+// ============================================================================
+
+/// Klipper's G-code move state (G90/G91, M82/M83, G92, F)
+struct MoveState {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float e = 0.0f;
+    float feedrate = 25.0f; ///< mm/s; Klipper's speed before the first F word
+    bool absolute_coord = true;
+    bool absolute_extrude = true;
+};
+
+/// Parse the leading command word ("G1", "M83", ...); false for comments and blanks
+bool parse_command(const std::string& line, char& letter, int& number, size_t& params_start) {
+    size_t i = line.find_first_not_of(" \t");
+    if (i == std::string::npos || i + 1 >= line.size()) {
+        return false;
+    }
+    letter = static_cast<char>(std::toupper(static_cast<unsigned char>(line[i])));
+    if (letter != 'G' && letter != 'M') {
+        return false;
+    }
+    char* end = nullptr;
+    long value = std::strtol(line.c_str() + i + 1, &end, 10);
+    if (end == line.c_str() + i + 1) {
+        return false;
+    }
+    // Subcodes (G29.1) are not moves or mode changes
+    if (*end == '.') {
+        return false;
+    }
+    number = static_cast<int>(value);
+    params_start = static_cast<size_t>(end - line.c_str());
+    return true;
+}
+
+/// Axis and feedrate words of a move; each flag says whether the word was present
+struct MoveParams {
+    float x = 0.0f, y = 0.0f, z = 0.0f, e = 0.0f, f = 0.0f;
+    bool has_x = false, has_y = false, has_z = false, has_e = false, has_f = false;
+};
+
+MoveParams parse_move_params(const std::string& line, size_t start) {
+    MoveParams p;
+    const char* s = line.c_str();
+    for (size_t i = start; i < line.size(); ++i) {
+        char c = s[i];
+        if (c == ';') {
+            break;
+        }
+        char axis = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        if (axis != 'X' && axis != 'Y' && axis != 'Z' && axis != 'E' && axis != 'F') {
+            continue;
+        }
+        char* end = nullptr;
+        float value = std::strtof(s + i + 1, &end);
+        if (end == s + i + 1) {
+            continue;
+        }
+        switch (axis) {
+        case 'X':
+            p.x = value;
+            p.has_x = true;
+            break;
+        case 'Y':
+            p.y = value;
+            p.has_y = true;
+            break;
+        case 'Z':
+            p.z = value;
+            p.has_z = true;
+            break;
+        case 'F':
+            p.f = value;
+            p.has_f = true;
+            break;
+        default:
+            p.e = value;
+            p.has_e = true;
+            break;
+        }
+        i = static_cast<size_t>(end - s) - 1;
+    }
+    return p;
+}
+
+/// Value of a single-letter word (G4 P500, M204 S3000) after the command
+bool find_word(const std::string& line, size_t start, char letter, float& value) {
+    const char* s = line.c_str();
+    for (size_t i = start; i < line.size() && s[i] != ';'; ++i) {
+        if (std::toupper(static_cast<unsigned char>(s[i])) != letter) {
+            continue;
+        }
+        char* end = nullptr;
+        float v = std::strtof(s + i + 1, &end);
+        if (end != s + i + 1) {
+            value = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Value of a Klipper-style NAME=value parameter
+bool find_named_param(const std::string& line, const char* name, float& value) {
+    std::string key = std::string(" ") + name + "=";
+    size_t pos = line.find(key);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    const char* start = line.c_str() + pos + key.size();
+    char* end = nullptr;
+    float v = std::strtof(start, &end);
+    if (end == start) {
+        return false;
+    }
+    value = v;
+    return true;
+}
+
+/// SET_VELOCITY_LIMIT in the file overrides the printer's limits from there on
+void apply_velocity_limit(const std::string& line, PrintTimeEstimator& timer) {
+    float value = 0.0f;
+    if (find_named_param(line, "VELOCITY", value)) {
+        timer.set_max_velocity(value);
+    }
+    if (find_named_param(line, "ACCEL", value)) {
+        timer.set_accel(value);
+    }
+    if (find_named_param(line, "SQUARE_CORNER_VELOCITY", value)) {
+        timer.set_square_corner_velocity(value);
+    }
+}
+
+/**
+ * @brief Apply one line to the move state
+ *
+ * Accumulates extrusion stats into @p layer (may be null) and feeds moves,
+ * dwells and acceleration changes to @p timer, attributed to @p offset and
+ * @p layer_index.
+ */
+void track_move(const std::string& line, MoveState& state, LayerExtrusionStats* layer,
+                PrintTimeEstimator& timer, uint64_t offset, uint32_t layer_index) {
+    char letter = 0;
+    int number = 0;
+    size_t params = 0;
+    if (!parse_command(line, letter, number, params)) {
+        size_t i = line.find_first_not_of(" \t");
+        if (i != std::string::npos && line.compare(i, 18, "SET_VELOCITY_LIMIT") == 0) {
+            apply_velocity_limit(line, timer);
+        }
+        return;
+    }
+
+    if (letter == 'M') {
+        if (number == 82) {
+            state.absolute_extrude = true;
+        } else if (number == 83) {
+            state.absolute_extrude = false;
+        } else if (number == 204) {
+            // Klipper: S sets the acceleration, otherwise the lower of P and T
+            float s = 0.0f, p = 0.0f, t = 0.0f;
+            if (find_word(line, params, 'S', s)) {
+                timer.set_accel(s);
+            } else if (find_word(line, params, 'P', p) && find_word(line, params, 'T', t)) {
+                timer.set_accel(std::min(p, t));
+            }
+        }
+        return;
+    }
+
+    switch (number) {
+    case 4: {
+        float value = 0.0f;
+        float seconds = 0.0f;
+        if (find_word(line, params, 'P', value)) {
+            seconds = value / 1000.0f;
+        } else if (find_word(line, params, 'S', value)) {
+            seconds = value;
+        }
+        timer.add_dwell(seconds, offset, layer_index);
+        return;
+    }
+    case 90:
+        state.absolute_coord = true;
+        return;
+    case 91:
+        state.absolute_coord = false;
+        return;
+    case 92: {
+        MoveParams p = parse_move_params(line, params);
+        if (p.has_x)
+            state.x = p.x;
+        if (p.has_y)
+            state.y = p.y;
+        if (p.has_z)
+            state.z = p.z;
+        if (p.has_e)
+            state.e = p.e;
+        return;
+    }
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+        break; // Arcs are treated as chords from start to end point
+    default:
+        return;
+    }
+
+    MoveParams p = parse_move_params(line, params);
+    if (p.has_f && p.f > 0.0f) {
+        state.feedrate = p.f / 60.0f;
+    }
+    float x = state.x, y = state.y, z = state.z, e = state.e;
+    if (p.has_x)
+        x = state.absolute_coord ? p.x : state.x + p.x;
+    if (p.has_y)
+        y = state.absolute_coord ? p.y : state.y + p.y;
+    if (p.has_z)
+        z = state.absolute_coord ? p.z : state.z + p.z;
+    if (p.has_e)
+        e = (state.absolute_coord && state.absolute_extrude) ? p.e : state.e + p.e;
+
+    float dist = std::hypot(x - state.x, y - state.y);
+    float de = e - state.e;
+
+    if (layer && dist > 0.0f) {
+        if (de > 0.0f) {
+            layer->extrusion_moves++;
+            layer->filament_mm += de;
+            layer->path_length_mm += dist;
+            layer->bounds.expand(glm::vec3(state.x, state.y, z));
+            layer->bounds.expand(glm::vec3(x, y, z));
+        } else {
+            layer->travel_moves++;
+            layer->travel_length_mm += dist;
+        }
+    }
+
+    timer.add_move(x - state.x, y - state.y, z - state.z, de, state.feedrate, offset,
+                   layer_index);
+
+    state.x = x;
+    state.y = y;
+    state.z = z;
+    state.e = e;
+}
+
+// ============================================================================
+// Cache file serialization
+// ============================================================================
+
+constexpr char CACHE_MAGIC[8] = {'H', 'X', 'G', 'C', 'A', 'N', 'A', 'L'};
+constexpr uint32_t CACHE_VERSION = 2;
+constexpr uint32_t CACHE_BYTE_ORDER = 0x01020304; // Rejects files from other-endian hosts
+constexpr uint32_t CACHE_END = 0x454E4421;        // "END!" - catches truncation
+
+class Writer {
+  public:
+    template <typename T> void pod(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "pod() needs a trivial type");
+        buf_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void str(const std::string& value) {
+        pod(static_cast<uint32_t>(value.size()));
+        buf_.append(value);
+    }
+
+    void aabb(const AABB& box) {
+        pod(box.min.x);
+        pod(box.min.y);
+        pod(box.min.z);
+        pod(box.max.x);
+        pod(box.max.y);
+        pod(box.max.z);
+    }
+
+    const std::string& data() const {
+        return buf_;
+    }
+
+  private:
+    std::string buf_;
+};
+
+class Reader {
+  public:
+    Reader(const char* data, size_t size) : p_(data), end_(data + size) {}
+
+    template <typename T> bool pod(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "pod() needs a trivial type");
+        if (static_cast<size_t>(end_ - p_) < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, p_, sizeof(T));
+        p_ += sizeof(T);
+        return true;
+    }
+
+    bool str(std::string& value) {
+        uint32_t len = 0;
+        if (!pod(len) || static_cast<size_t>(end_ - p_) < len) {
+            return false;
+        }
+        value.assign(p_, len);
+        p_ += len;
+        return true;
+    }
+
+    bool aabb(AABB& box) {
+        return pod(box.min.x) && pod(box.min.y) && pod(box.min.z) && pod(box.max.x) &&
+               pod(box.max.y) && pod(box.max.z);
+    }
+
+    /// Element count, rejected if the remaining bytes cannot possibly hold it
+    bool count(uint32_t& n, size_t min_element_size) {
+        return pod(n) && static_cast<size_t>(end_ - p_) / min_element_size >= n;
+    }
+
+    bool at_end() const {
+        return p_ == end_;
+    }
+
+  private:
+    const char* p_;
+    const char* end_;
+};
+
+void write_operation(Writer& w, const DetectedOperation& op) {
+    w.pod(static_cast<uint8_t>(op.type));
+    w.pod(static_cast<uint8_t>(op.embedding));
+    w.str(op.raw_line);
+    w.str(op.macro_name);
+    w.str(op.param_name);
+    w.str(op.param_value);
+    w.pod(static_cast<uint64_t>(op.line_number));
+    w.pod(static_cast<uint64_t>(op.byte_offset));
+}
+
+bool read_operation(Reader& r, DetectedOperation& op) {
+    uint8_t type = 0;
+    uint8_t embedding = 0;
+    uint64_t line_number = 0;
+    uint64_t byte_offset = 0;
+    if (!(r.pod(type) && r.pod(embedding) && r.str(op.raw_line) && r.str(op.macro_name) &&
+          r.str(op.param_name) && r.str(op.param_value) && r.pod(line_number) &&
+          r.pod(byte_offset))) {
+        return false;
+    }
+    op.type = static_cast<OperationType>(type);
+    op.embedding = static_cast<OperationEmbedding>(embedding);
+    op.line_number = static_cast<size_t>(line_number);
+    op.byte_offset = static_cast<size_t>(byte_offset);
+    return true;
+}
+
+void write_limits(Writer& w, const MachineLimits& l) {
+    w.pod(l.max_velocity);
+    w.pod(l.max_accel);
+    w.pod(l.max_accel_to_decel);
+    w.pod(l.square_corner_velocity);
+    w.pod(l.max_z_velocity);
+    w.pod(l.max_z_accel);
+}
+
+bool read_limits(Reader& r, MachineLimits& l) {
+    return r.pod(l.max_velocity) && r.pod(l.max_accel) && r.pod(l.max_accel_to_decel) &&
+           r.pod(l.square_corner_velocity) && r.pod(l.max_z_velocity) && r.pod(l.max_z_accel);
+}
+
+std::string serialize(const GCodeAnalysis& a) {
+    Writer w;
+    for (char c : CACHE_MAGIC) {
+        w.pod(c);
+    }
+    w.pod(CACHE_VERSION);
+    w.pod(CACHE_BYTE_ORDER);
+
+    w.str(a.key.path);
+    w.pod(a.key.file_size);
+    w.pod(a.key.mtime_ns);
+    write_limits(w, a.limits);
+
+    // Layer index
+    w.pod(static_cast<uint32_t>(a.layers.size()));
+    for (const auto& entry : a.layers) {
+        w.pod(entry);
+    }
+    const LayerIndexStats& s = a.index_stats;
+    w.pod(static_cast<uint64_t>(s.total_lines));
+    w.pod(static_cast<uint64_t>(s.total_bytes));
+    w.pod(s.min_z);
+    w.pod(s.max_z);
+    w.pod(static_cast<uint64_t>(s.extrusion_moves));
+    w.pod(static_cast<uint64_t>(s.travel_moves));
+    w.pod(s.build_time_ms);
+    w.str(s.filament_color);
+
+    // Objects
+    w.pod(static_cast<uint32_t>(a.objects.size()));
+    for (const auto& [name, obj] : a.objects) {
+        w.str(name);
+        w.pod(obj.center.x);
+        w.pod(obj.center.y);
+        w.pod(static_cast<uint32_t>(obj.polygon.size()));
+        for (const auto& pt : obj.polygon) {
+            w.pod(pt.x);
+            w.pod(pt.y);
+        }
+        w.aabb(obj.bounding_box);
+    }
+
+    // Operations
+    const ScanResult& ops = a.operations;
+    w.pod(static_cast<uint32_t>(ops.operations.size()));
+    for (const auto& op : ops.operations) {
+        write_operation(w, op);
+    }
+    w.pod(static_cast<uint64_t>(ops.lines_scanned));
+    w.pod(static_cast<uint64_t>(ops.bytes_scanned));
+    w.pod(static_cast<uint8_t>(ops.reached_limit));
+    w.pod(static_cast<uint8_t>(ops.reached_end));
+    w.pod(static_cast<uint8_t>(ops.print_start.found));
+    w.str(ops.print_start.macro_name);
+    w.str(ops.print_start.raw_line);
+    w.pod(static_cast<uint64_t>(ops.print_start.line_number));
+    w.pod(static_cast<uint64_t>(ops.print_start.byte_offset));
+
+    // Metadata
+    const GCodeHeaderMetadata& m = a.metadata;
+    w.str(m.filename);
+    w.pod(m.file_size);
+    w.pod(m.modified_time);
+    w.str(m.slicer);
+    w.str(m.slicer_version);
+    w.pod(m.estimated_time_seconds);
+    w.pod(m.filament_used_mm);
+    w.pod(m.filament_used_g);
+    w.str(m.filament_type);
+    w.pod(m.layer_count);
+    w.pod(m.first_layer_bed_temp);
+    w.pod(m.first_layer_nozzle_temp);
+    w.pod(static_cast<uint32_t>(m.tool_colors.size()));
+    for (const auto& color : m.tool_colors) {
+        w.str(color);
+    }
+
+    // Per-layer stats and preview bounds
+    w.pod(static_cast<uint32_t>(a.layer_stats.size()));
+    for (const auto& ls : a.layer_stats) {
+        w.pod(ls.extrusion_moves);
+        w.pod(ls.travel_moves);
+        w.pod(ls.filament_mm);
+        w.pod(ls.path_length_mm);
+        w.pod(ls.travel_length_mm);
+        w.pod(ls.duration_s);
+        w.aabb(ls.bounds);
+    }
+    w.aabb(a.extrusion_bounds);
+
+    // Print time table
+    w.pod(a.time_table.bucket_bytes);
+    w.pod(static_cast<uint32_t>(a.time_table.elapsed_s.size()));
+    for (float t : a.time_table.elapsed_s) {
+        w.pod(t);
+    }
+
+    w.pod(a.analysis_time_ms);
+
+    w.pod(CACHE_END);
+    return w.data();
+}
+
+bool deserialize(const std::string& data, GCodeAnalysis& a) {
+    Reader r(data.data(), data.size());
+
+    char magic[sizeof(CACHE_MAGIC)];
+    for (char& c : magic) {
+        if (!r.pod(c)) {
+            return false;
+        }
+    }
+    uint32_t version = 0;
+    uint32_t byte_order = 0;
+    if (std::memcmp(magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || !r.pod(version) ||
+        version != CACHE_VERSION || !r.pod(byte_order) || byte_order != CACHE_BYTE_ORDER) {
+        return false;
+    }
+
+    if (!(r.str(a.key.path) && r.pod(a.key.file_size) && r.pod(a.key.mtime_ns) &&
+          read_limits(r, a.limits))) {
+        return false;
+    }
+
+    // Layer index
+    uint32_t n = 0;
+    if (!r.count(n, sizeof(StreamingLayerEntry))) {
+        return false;
+    }
+    a.layers.resize(n);
+    for (auto& entry : a.layers) {
+        if (!r.pod(entry)) {
+            return false;
+        }
+    }
+    LayerIndexStats& s = a.index_stats;
+    uint64_t total_lines = 0, total_bytes = 0, extrusion_moves = 0, travel_moves = 0;
+    if (!(r.pod(total_lines) && r.pod(total_bytes) && r.pod(s.min_z) && r.pod(s.max_z) &&
+          r.pod(extrusion_moves) && r.pod(travel_moves) && r.pod(s.build_time_ms) &&
+          r.str(s.filament_color))) {
+        return false;
+    }
+    s.total_layers = a.layers.size();
+    s.total_lines = static_cast<size_t>(total_lines);
+    s.total_bytes = static_cast<size_t>(total_bytes);
+    s.extrusion_moves = static_cast<size_t>(extrusion_moves);
+    s.travel_moves = static_cast<size_t>(travel_moves);
+
+    // Objects
+    if (!r.count(n, 4)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+        GCodeObject obj;
+        uint32_t points = 0;
+        if (!(r.str(obj.name) && r.pod(obj.center.x) && r.pod(obj.center.y) &&
+              r.count(points, 2 * sizeof(float)))) {
+            return false;
+        }
+        obj.polygon.resize(points);
+        for (auto& pt : obj.polygon) {
+            if (!(r.pod(pt.x) && r.pod(pt.y))) {
+                return false;
+            }
+        }
+        if (!r.aabb(obj.bounding_box)) {
+            return false;
+        }
+        std::string name = obj.name;
+        a.objects.emplace(std::move(name), std::move(obj));
+    }
+
+    // Operations
+    ScanResult& ops = a.operations;
+    if (!r.count(n, 2)) {
+        return false;
+    }
+    ops.operations.resize(n);
+    for (auto& op : ops.operations) {
+        if (!read_operation(r, op)) {
+            return false;
+        }
+    }
+    uint64_t lines_scanned = 0, bytes_scanned = 0, ps_line = 0, ps_offset = 0;
+    uint8_t reached_limit = 0, reached_end = 0, ps_found = 0;
+    if (!(r.pod(lines_scanned) && r.pod(bytes_scanned) && r.pod(reached_limit) &&
+          r.pod(reached_end) && r.pod(ps_found) && r.str(ops.print_start.macro_name) &&
+          r.str(ops.print_start.raw_line) && r.pod(ps_line) && r.pod(ps_offset))) {
+        return false;
+    }
+    ops.lines_scanned = static_cast<size_t>(lines_scanned);
+    ops.bytes_scanned = static_cast<size_t>(bytes_scanned);
+    ops.reached_limit = reached_limit != 0;
+    ops.reached_end = reached_end != 0;
+    ops.print_start.found = ps_found != 0;
+    ops.print_start.line_number = static_cast<size_t>(ps_line);
+    ops.print_start.byte_offset = static_cast<size_t>(ps_offset);
+
+    // Metadata
+    GCodeHeaderMetadata& m = a.metadata;
+    if (!(r.str(m.filename) && r.pod(m.file_size) && r.pod(m.modified_time) && r.str(m.slicer) &&
+          r.str(m.slicer_version) && r.pod(m.estimated_time_seconds) &&
+          r.pod(m.filament_used_mm) && r.pod(m.filament_used_g) && r.str(m.filament_type) &&
+          r.pod(m.layer_count) && r.pod(m.first_layer_bed_temp) &&
+          r.pod(m.first_layer_nozzle_temp) && r.count(n, 4))) {
+        return false;
+    }
+    m.tool_colors.resize(n);
+    for (auto& color : m.tool_colors) {
+        if (!r.str(color)) {
+            return false;
+        }
+    }
+
+    // Per-layer stats and preview bounds
+    if (!r.count(n, sizeof(LayerExtrusionStats::extrusion_moves))) {
+        return false;
+    }
+    a.layer_stats.resize(n);
+    for (auto& ls : a.layer_stats) {
+        if (!(r.pod(ls.extrusion_moves) && r.pod(ls.travel_moves) && r.pod(ls.filament_mm) &&
+              r.pod(ls.path_length_mm) && r.pod(ls.travel_length_mm) && r.pod(ls.duration_s) &&
+              r.aabb(ls.bounds))) {
+            return false;
+        }
+    }
+    if (!r.aabb(a.extrusion_bounds)) {
+        return false;
+    }
+
+    // Print time table
+    if (!(r.pod(a.time_table.bucket_bytes) && r.count(n, sizeof(float)))) {
+        return false;
+    }
+    a.time_table.elapsed_s.resize(n);
+    for (float& t : a.time_table.elapsed_s) {
+        if (!r.pod(t)) {
+            return false;
+        }
+    }
+
+    uint32_t end_marker = 0;
+    return r.pod(a.analysis_time_ms) && r.pod(end_marker) && end_marker == CACHE_END &&
+           r.at_end();
+}
+
+} // anonymous namespace
+
+std::optional<GCodeFileKey> stat_gcode_file(const std::string& path) {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    GCodeFileKey key;
+    key.path = path;
+    key.file_size = static_cast<uint64_t>(size);
+    key.mtime_ns = static_cast<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count());
+    return key;
+}
+
+void GCodeAnalysis::restore_index(GCodeLayerIndex& index) const {
+    index.restore(key.path, layers, index_stats, objects);
+}
+
+std::optional<GCodeAnalysis> analyze_gcode_file(const std::string& path,
+                                                const MachineLimits& limits,
+                                                const std::atomic<bool>* cancel) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    auto key = stat_gcode_file(path);
+    if (!key) {
+        spdlog::warn("[GCodeAnalysis] Cannot stat {}", path);
+        return std::nullopt;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::warn("[GCodeAnalysis] Cannot open {}", path);
+        return std::nullopt;
+    }
+
+    GCodeAnalysis analysis;
+    analysis.key = *key;
+    analysis.limits = limits;
+
+    GCodeHeaderMetadata& metadata = analysis.metadata;
+    metadata.filename = path;
+    metadata.file_size = key->file_size;
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) == 0) {
+        metadata.modified_time = static_cast<double>(file_stat.st_mtime);
+    }
+
+    GCodeLayerIndex index;
+    index.begin_build(path, static_cast<size_t>(key->file_size));
+
+    MoveState moves;
+    PrintTimeEstimator timer(limits, key->file_size);
+    std::string preamble;
+    bool preamble_done = false;
+    bool header_done = false;
+    int header_lines = 0;
+    uint64_t offset = 0;
+
+    std::string line;
+    line.reserve(256);
+    while (std::getline(file, line)) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) {
+            spdlog::debug("[GCodeAnalysis] Cancelled analysis of {}", path);
+            return std::nullopt;
+        }
+        index.add_line(line);
+
+        // Slicer metadata: header comments up to the first command, then the footer
+        if (!header_done) {
+            if (!line.empty() && line[0] == ';') {
+                parse_header_metadata_line(line, metadata);
+            } else if (!line.empty() && (line[0] == 'G' || line[0] == 'M' || line[0] == 'T')) {
+                header_done = true;
+            }
+            if (++header_lines >= METADATA_HEADER_LINES) {
+                header_done = true;
+            }
+        } else if (!line.empty() && line[0] == ';' &&
+                   offset + METADATA_FOOTER_BYTES >= key->file_size) {
+            parse_header_metadata_line(line, metadata);
+        }
+
+        // Per-layer stats, attributed to the layer the index is currently in
+        size_t layer_count = index.get_layer_count();
+        if (layer_count > analysis.layer_stats.size()) {
+            analysis.layer_stats.resize(layer_count);
+        }
+        LayerExtrusionStats* layer =
+            layer_count > 0 ? &analysis.layer_stats[layer_count - 1] : nullptr;
+        uint32_t extrusions_before = layer ? layer->extrusion_moves : 0;
+        uint32_t layer_index = layer_count > 0 ? static_cast<uint32_t>(layer_count - 1)
+                                               : PrintTimeEstimator::NO_LAYER;
+        track_move(line, moves, layer, timer, offset, layer_index);
+
+        // Preamble for the ops detector, which stops at the first extrusion anyway
+        if (!preamble_done) {
+            preamble += line;
+            preamble += '\n';
+            bool extruded = layer && layer->extrusion_moves > extrusions_before;
+            preamble_done = extruded || preamble.size() >= PREAMBLE_MAX_BYTES;
+        }
+
+        offset += line.size() + 1;
+    }
+
+    index.finish_build();
+    analysis.layers = index.get_entries();
+    analysis.index_stats = index.get_stats();
+    analysis.objects = index.get_objects();
+    analysis.layer_stats.resize(analysis.layers.size());
+
+    timer.finish();
+    analysis.time_table = timer.table();
+    const auto& durations = timer.layer_durations();
+    for (size_t i = 0; i < durations.size() && i < analysis.layer_stats.size(); ++i) {
+        analysis.layer_stats[i].duration_s = durations[i];
+    }
+
+    for (const auto& layer : analysis.layer_stats) {
+        if (!layer.bounds.is_empty()) {
+            analysis.extrusion_bounds.expand(layer.bounds.min);
+            analysis.extrusion_bounds.expand(layer.bounds.max);
+        }
+    }
+
+    GCodeOpsDetector detector;
+    analysis.operations = detector.scan_content(preamble);
+
+    if (metadata.layer_count == 0) {
+        metadata.layer_count = static_cast<uint32_t>(analysis.layers.size());
+    }
+
+    auto end_time = std::chrono::steady_clock::now();
+    analysis.analysis_time_ms =
+        std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+    spdlog::info("[GCodeAnalysis] Analyzed {}: {} layers, {} objects, {} operations, "
+                 "est. {:.0f}s print, {:.1f}ms",
+                 path, analysis.layers.size(), analysis.objects.size(),
+                 analysis.operations.operations.size(), analysis.time_table.total_s(),
+                 analysis.analysis_time_ms);
+    return analysis;
+}
+
+bool save_gcode_analysis(const GCodeAnalysis& analysis, const std::string& cache_path) {
+    std::string data = serialize(analysis);
+    std::string tmp_path = cache_path + ".tmp";
+
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            spdlog::warn("[GCodeAnalysis] Cannot write cache file {}", tmp_path);
+            return false;
+        }
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!out) {
+            spdlog::warn("[GCodeAnalysis] Failed writing cache file {}", tmp_path);
+            out.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmp_path.c_str(), cache_path.c_str()) != 0) {
+        spdlog::warn("[GCodeAnalysis] Cannot move cache file into place: {}", cache_path);
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::optional<GCodeAnalysis> load_gcode_analysis(const std::string& cache_path) {
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in.is_open()) {
+        return std::nullopt;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    GCodeAnalysis analysis;
+    if (!deserialize(data, analysis)) {
+        spdlog::debug("[GCodeAnalysis] Ignoring unreadable cache file {}", cache_path);
+        return std::nullopt;
+    }
+    return analysis;
+}
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,319 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_analysis_service.h"
+
+#include "app_globals.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+/// FNV-1a of the path: cache file names must be stable across runs
+uint64_t path_hash(const std::string& path) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (char c : path) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x100000001B3ull;
+    }
+    return h;
+}
+
+/// Keep analysis from competing with the UI thread for CPU
+void lower_thread_priority() {
+#ifdef __linux__
+    // Linux applies nice values per thread
+    auto tid = static_cast<id_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, tid, 10) != 0) {
+        spdlog::debug("[GCodeAnalysisService] Could not lower worker priority");
+    }
+#endif
+}
+
+} // anonymous namespace
+
+GCodeAnalysisService& GCodeAnalysisService::instance() {
+    static GCodeAnalysisService instance(get_helix_cache_dir("gcode_analysis"));
+    return instance;
+}
+
+GCodeAnalysisService::GCodeAnalysisService(std::string cache_dir)
+    : cache_dir_(std::move(cache_dir)) {}
+
+GCodeAnalysisService::~GCodeAnalysisService() {
+    shutdown();
+}
+
+std::string GCodeAnalysisService::cache_path_for(const std::string& path) const {
+    if (cache_dir_.empty()) {
+        return "";
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin",
+                  static_cast<unsigned long long>(path_hash(path)));
+    return cache_dir_ + "/" + name;
+}
+
+bool GCodeAnalysisService::usable(const GCodeAnalysis& analysis, Freshness freshness,
+                                  const MachineLimits& limits) {
+    return freshness == Freshness::FILE || analysis.limits == limits;
+}
+
+GCodeAnalysisService::AnalysisPtr
+GCodeAnalysisService::find_in_memory(const GCodeFileKey& key, Freshness freshness,
+                                     const MachineLimits& limits) {
+    for (auto it = memory_.begin(); it != memory_.end(); ++it) {
+        if ((*it)->key == key && usable(**it, freshness, limits)) {
+            memory_.splice(memory_.begin(), memory_, it);
+            return memory_.front();
+        }
+    }
+    return nullptr;
+}
+
+void GCodeAnalysisService::remember(const AnalysisPtr& analysis) {
+    // Any older version of the same file is stale now
+    memory_.remove_if([&](const AnalysisPtr& a) { return a->key.path == analysis->key.path; });
+    memory_.push_front(analysis);
+    while (memory_.size() > MEMORY_ENTRIES) {
+        memory_.pop_back();
+    }
+}
+
+GCodeAnalysisService::AnalysisPtr
+GCodeAnalysisService::load_from_disk(const GCodeFileKey& key, Freshness freshness,
+                                     const MachineLimits& limits) {
+    std::string cache_path = cache_path_for(key.path);
+    if (cache_path.empty()) {
+        return nullptr;
+    }
+    auto loaded = load_gcode_analysis(cache_path);
+    if (!loaded || loaded->key != key || !usable(*loaded, freshness, limits)) {
+        return nullptr; // Missing, unreadable, an older version of the file, or other limits
+    }
+    spdlog::debug("[GCodeAnalysisService] Loaded cached analysis of {}", key.path);
+    return std::make_shared<const GCodeAnalysis>(std::move(*loaded));
+}
+
+void GCodeAnalysisService::store_to_disk(const GCodeAnalysis& analysis) {
+    std::string cache_path = cache_path_for(analysis.key.path);
+    if (cache_path.empty()) {
+        return;
+    }
+    if (save_gcode_analysis(analysis, cache_path)) {
+        prune_disk_cache();
+    }
+}
+
+void GCodeAnalysisService::prune_disk_cache() {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    std::vector<std::pair<fs::file_time_type, fs::path>> files;
+    for (const auto& entry : fs::directory_iterator(cache_dir_, ec)) {
+        if (entry.path().extension() == ".bin") {
+            files.emplace_back(entry.last_write_time(ec), entry.path());
+        }
+    }
+    if (files.size() <= MAX_CACHE_FILES) {
+        return;
+    }
+    std::sort(files.begin(), files.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = MAX_CACHE_FILES; i < files.size(); ++i) {
+        fs::remove(files[i].second, ec);
+    }
+    spdlog::debug("[GCodeAnalysisService] Pruned {} cache files",
+                  files.size() - MAX_CACHE_FILES);
+}
+
+GCodeAnalysisService::AnalysisPtr GCodeAnalysisService::get_cached(const std::string& path,
+                                                                   Freshness freshness) {
+    auto key = stat_gcode_file(path);
+    if (!key) {
+        return nullptr;
+    }
+    MachineLimits limits;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        limits = limits_;
+        if (auto hit = find_in_memory(*key, freshness, limits)) {
+            return hit;
+        }
+    }
+    auto loaded = load_from_disk(*key, freshness, limits);
+    if (loaded) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        remember(loaded);
+    }
+    return loaded;
+}
+
+GCodeAnalysisService::AnalysisPtr GCodeAnalysisService::analyze(const std::string& path,
+                                                                Freshness freshness) {
+    auto key = stat_gcode_file(path);
+    if (!key) {
+        spdlog::warn("[GCodeAnalysisService] Cannot analyze missing file {}", path);
+        return nullptr;
+    }
+
+    MachineLimits limits;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Another thread analyzing this path will leave its result in memory
+        in_flight_cv_.wait(lock, [&] { return in_flight_.count(path) == 0; });
+        limits = limits_;
+        if (auto hit = find_in_memory(*key, freshness, limits)) {
+            return hit;
+        }
+        in_flight_.insert(path);
+    }
+
+    AnalysisPtr result = load_from_disk(*key, freshness, limits);
+    bool analyzed = false;
+    if (!result) {
+        auto fresh = analyze_gcode_file(path, limits, &cancel_);
+        if (fresh) {
+            // Saved with the key taken before reading, so a file modified
+            // mid-pass is re-analyzed next time instead of trusted
+            fresh->key = *key;
+            store_to_disk(*fresh);
+            result = std::make_shared<const GCodeAnalysis>(std::move(*fresh));
+        }
+        analyzed = true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (analyzed) {
+            analysis_count_++;
+        }
+        if (result) {
+            remember(result);
+        }
+        in_flight_.erase(path);
+    }
+    in_flight_cv_.notify_all();
+    return result;
+}
+
+void GCodeAnalysisService::request(const std::string& path, Callback callback,
+                                   Freshness freshness) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            if (callback) {
+                callback(nullptr);
+            }
+            return;
+        }
+
+        auto it = std::find_if(queue_.begin(), queue_.end(),
+                               [&](const Job& job) { return job.path == path; });
+        if (it == queue_.end()) {
+            queue_.push_back(Job{path, freshness, {}});
+            it = std::prev(queue_.end());
+        } else if (freshness == Freshness::TIME_TABLE) {
+            it->freshness = freshness;
+        }
+        if (callback) {
+            it->callbacks.push_back(std::move(callback));
+        }
+        start_worker_locked();
+    }
+    queue_cv_.notify_one();
+}
+
+void GCodeAnalysisService::start_worker_locked() {
+    if (!worker_.joinable()) {
+        worker_ = std::thread([this] { worker_loop(); });
+    }
+}
+
+void GCodeAnalysisService::worker_loop() {
+    lower_thread_priority();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        queue_cv_.wait(lock, [this] { return shutdown_ || !queue_.empty(); });
+        if (shutdown_) {
+            break;
+        }
+
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        worker_busy_ = true;
+        lock.unlock();
+
+        AnalysisPtr result = analyze(job.path, job.freshness);
+        for (auto& callback : job.callbacks) {
+            callback(result);
+        }
+
+        lock.lock();
+        worker_busy_ = false;
+        if (queue_.empty()) {
+            idle_cv_.notify_all();
+        }
+    }
+
+    // Shutting down: answer what is left so callers are not left waiting
+    std::deque<Job> abandoned;
+    abandoned.swap(queue_);
+    lock.unlock();
+    for (auto& job : abandoned) {
+        for (auto& callback : job.callbacks) {
+            callback(nullptr);
+        }
+    }
+    idle_cv_.notify_all();
+}
+
+void GCodeAnalysisService::wait_for_idle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return shutdown_ || (queue_.empty() && !worker_busy_); });
+}
+
+void GCodeAnalysisService::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    cancel_.store(true, std::memory_order_relaxed); // Abandon a pass in progress
+    queue_cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    idle_cv_.notify_all();
+}
+
+void GCodeAnalysisService::set_machine_limits(const MachineLimits& limits) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    limits_ = limits;
+}
+
+MachineLimits GCodeAnalysisService::machine_limits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return limits_;
+}
+
+size_t GCodeAnalysisService::analysis_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return analysis_count_;
+}
+
+} // namespace gcode
+} // namespace helix
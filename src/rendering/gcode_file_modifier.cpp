@@ -4,22 +4,249 @@
 #include "gcode_file_modifier.h"
 
 #include "app_globals.h"
-#include "streaming_policy.h"
+#include "operation_patterns.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <memory>
 #include <random>
-#include <regex>
 #include <sstream>
-#include <unordered_map>
 
 namespace helix {
 namespace gcode {
 
+namespace {
+
+/// Read/copy granularity; bounds memory use regardless of file size
+constexpr size_t STREAM_CHUNK_SIZE = 256 * 1024;
+
+size_t last_line_of(const Modification& mod) {
+    return std::max(mod.line_number, mod.end_line_number);
+}
+
+/**
+ * @brief Replace every `NAME=<non-space run>` in a line, matching NAME case-insensitively
+ *
+ * Equivalent to regex_replace with `NAME=\S+` (icase), without building a regex.
+ */
+std::string replace_param_values(const std::string& line, const std::string& name,
+                                 const std::string& replacement) {
+    const std::string key = helix::to_upper(name) + "=";
+    const std::string upper_line = helix::to_upper(line);
+    auto is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+
+    std::string result;
+    size_t copied = 0;
+    for (size_t pos = upper_line.find(key); pos != std::string::npos;
+         pos = upper_line.find(key, pos + 1)) {
+        size_t value_start = pos + key.size();
+        size_t value_end = value_start;
+        while (value_end < line.size() && !is_space(line[value_end])) {
+            ++value_end;
+        }
+        if (value_end == value_start || pos < copied) {
+            continue; // No value, or inside a value already replaced
+        }
+        result.append(line, copied, pos - copied);
+        result += replacement;
+        copied = value_end;
+    }
+    result.append(line, copied, std::string::npos);
+    return result;
+}
+
+/// Split injected G-code into lines (std::getline semantics: no trailing empty line)
+std::vector<std::string> split_lines(const std::string& gcode) {
+    std::vector<std::string> lines;
+    std::istringstream ss(gcode);
+    std::string line;
+    while (std::getline(ss, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @brief Line reader over a stream with a fixed-size chunk buffer
+ *
+ * Tracks the byte offset of each line, and hands the unread remainder to
+ * copy_rest() once no more lines need to be inspected.
+ */
+class ChunkedLineReader {
+  public:
+    explicit ChunkedLineReader(std::istream& in)
+        : in_(in), buffer_(std::make_unique<char[]>(STREAM_CHUNK_SIZE)) {}
+
+    /**
+     * @brief Read the next line without its '\n'
+     * @return false at end of input
+     */
+    bool next_line(std::string& line, bool& has_newline) {
+        line.clear();
+        line_offset_ = offset_;
+        while (true) {
+            if (pos_ == end_ && !fill()) {
+                has_newline = false;
+                return !line.empty();
+            }
+            const char* start = buffer_.get() + pos_;
+            size_t available = end_ - pos_;
+            const void* newline = std::memchr(start, '\n', available);
+            size_t len = newline ? static_cast<size_t>(static_cast<const char*>(newline) - start)
+                                 : available;
+            line.append(start, len);
+            if (newline) {
+                pos_ += len + 1;
+                offset_ += len + 1;
+                has_newline = true;
+                return true;
+            }
+            pos_ = end_;
+            offset_ += len;
+        }
+    }
+
+    /// Byte offset of the line last returned by next_line()
+    [[nodiscard]] size_t line_offset() const {
+        return line_offset_;
+    }
+
+    /// Bytes consumed from the stream so far
+    [[nodiscard]] size_t offset() const {
+        return offset_;
+    }
+
+    /**
+     * @brief Copy everything not yet returned by next_line() to `out`
+     * @return Bytes copied
+     */
+    size_t copy_rest(std::ostream& out) {
+        size_t copied = 0;
+        do {
+            out.write(buffer_.get() + pos_, static_cast<std::streamsize>(end_ - pos_));
+            copied += end_ - pos_;
+            offset_ += end_ - pos_;
+            pos_ = end_;
+        } while (out && fill());
+        return copied;
+    }
+
+  private:
+    bool fill() {
+        in_.read(buffer_.get(), static_cast<std::streamsize>(STREAM_CHUNK_SIZE));
+        end_ = static_cast<size_t>(in_.gcount());
+        pos_ = 0;
+        return end_ > 0;
+    }
+
+    std::istream& in_;
+    std::unique_ptr<char[]> buffer_;
+    size_t pos_ = 0;
+    size_t end_ = 0;
+    size_t offset_ = 0;
+    size_t line_offset_ = 0;
+};
+
+/**
+ * @brief Walks modifications alongside the lines of the original file
+ *
+ * advance() must be called for lines 1, 2, 3, ... in order. Afterwards
+ * before()/edit()/after() describe what applies to that line.
+ */
+class ModificationCursor {
+  public:
+    explicit ModificationCursor(const std::vector<Modification>& mods) : mods_(mods) {
+        for (size_t i = 0; i < mods.size(); ++i) {
+            if (mods[i].line_number == 0) {
+                spdlog::warn("[GCodeFileModifier] Ignoring modification at line 0 (1-indexed)");
+                continue;
+            }
+            order_.push_back(i);
+            last_line_ = std::max(last_line_, last_line_of(mods[i]));
+        }
+        std::stable_sort(order_.begin(), order_.end(), [&mods](size_t a, size_t b) {
+            return mods[a].line_number < mods[b].line_number;
+        });
+    }
+
+    /// Last line any modification touches (0 if none)
+    [[nodiscard]] size_t last_line() const {
+        return last_line_;
+    }
+
+    void advance(size_t line_number, size_t line_offset) {
+        before_.clear();
+        after_.clear();
+        while (next_ < order_.size() && mods_[order_[next_]].line_number == line_number) {
+            size_t index = order_[next_++];
+            const Modification& mod = mods_[index];
+            if (mod.byte_offset != Modification::NO_BYTE_OFFSET && mod.byte_offset != line_offset) {
+                spdlog::warn("[GCodeFileModifier] Line {} is at byte {}, expected {} - file "
+                             "changed since it was scanned?",
+                             line_number, line_offset, mod.byte_offset);
+                ++offset_mismatches_;
+            }
+            if (mod.type == ModificationType::INJECT_BEFORE) {
+                before_.push_back(&mod);
+            } else if (mod.type == ModificationType::INJECT_AFTER) {
+                after_.push_back(&mod);
+            } else {
+                active_.push_back(index);
+            }
+        }
+
+        // Drop finished ranges; the earliest-added remaining edit wins
+        active_.erase(
+            std::remove_if(active_.begin(), active_.end(),
+                           [&](size_t i) { return last_line_of(mods_[i]) < line_number; }),
+            active_.end());
+        edit_ = nullptr;
+        if (!active_.empty()) {
+            edit_ = &mods_[*std::min_element(active_.begin(), active_.end())];
+        }
+    }
+
+    [[nodiscard]] const std::vector<const Modification*>& before() const {
+        return before_;
+    }
+    [[nodiscard]] const Modification* edit() const {
+        return edit_;
+    }
+    [[nodiscard]] const std::vector<const Modification*>& after() const {
+        return after_;
+    }
+    [[nodiscard]] size_t offset_mismatches() const {
+        return offset_mismatches_;
+    }
+
+    /// Warn about modifications past the end of a file with `line_count` lines
+    void warn_unreached(size_t line_count) const {
+        for (size_t i = next_; i < order_.size(); ++i) {
+            spdlog::warn("[GCodeFileModifier] Line {} out of range (file has {} lines)",
+                         mods_[order_[i]].line_number, line_count);
+        }
+    }
+
+  private:
+    const std::vector<Modification>& mods_;
+    std::vector<size_t> order_; ///< Indices sorted by line_number, ties in insertion order
+    size_t next_ = 0;
+    size_t last_line_ = 0;
+    std::vector<size_t> active_; ///< Range edits that started at or before the current line
+    std::vector<const Modification*> before_;
+    std::vector<const Modification*> after_;
+    const Modification* edit_ = nullptr;
+    size_t offset_mismatches_ = 0;
+};
+
+} // namespace
+
 // ============================================================================
 // GCodeFileModifier implementation
 // ============================================================================
@@ -32,132 +259,100 @@ void GCodeFileModifier::clear_modifications() {
     modifications_.clear();
 }
 
-void GCodeFileModifier::sort_modifications() {
-    // Sort by line number descending (process from end to start)
-    // This preserves line numbers for earlier modifications
-    std::sort(
-        modifications_.begin(), modifications_.end(),
-        [](const Modification& a, const Modification& b) { return a.line_number > b.line_number; });
-}
-
 std::string GCodeFileModifier::comment_out_line(const std::string& line,
                                                 const std::string& reason) {
+    bool has_cr = !line.empty() && line.back() == '\r';
     std::string result = "; ";
-    result += line;
+    result.append(line, 0, line.size() - (has_cr ? 1 : 0));
     if (!reason.empty()) {
         result += "  ; [HelixScreen: ";
         result += reason;
         result += "]";
     }
+    if (has_cr) {
+        result += '\r';
+    }
     return result;
 }
 
-void GCodeFileModifier::apply_single_modification(std::vector<std::string>& lines,
-                                                  const Modification& mod,
-                                                  ModificationResult& result) {
-    // Line numbers are 1-indexed, vector is 0-indexed
-    size_t idx = mod.line_number - 1;
+bool GCodeFileModifier::stream_modifications(std::istream& in, std::ostream& out,
+                                             ModificationResult& result) const {
+    ModificationCursor cursor(modifications_);
+    ChunkedLineReader reader(in);
 
-    if (idx >= lines.size()) {
-        spdlog::warn("[GCodeFileModifier] Line {} out of range (file has {} lines)",
-                     mod.line_number, lines.size());
-        return;
-    }
+    auto write = [&](const std::string& text) {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        result.modified_size += text.size();
+    };
 
-    size_t end_idx = (mod.end_line_number > 0) ? mod.end_line_number - 1 : idx;
-    if (end_idx >= lines.size()) {
-        end_idx = lines.size() - 1;
-    }
+    // Edited lines: split and rebuild. Lines between edits are re-emitted as-is.
+    std::string line;
+    bool has_newline = false;
+    size_t line_number = 0;
+    while (line_number < cursor.last_line() && reader.next_line(line, has_newline)) {
+        ++line_number;
+        cursor.advance(line_number, reader.line_offset());
+
+        bool wrote_line = false;
+        auto emit = [&](const std::string& text) {
+            if (wrote_line) {
+                write("\n");
+            }
+            write(text);
+            wrote_line = true;
+        };
+
+        for (const Modification* mod : cursor.before()) {
+            for (const auto& injected : split_lines(mod->gcode)) {
+                emit(injected);
+                result.lines_added++;
+            }
+        }
 
-    switch (mod.type) {
-    case ModificationType::COMMENT_OUT: {
-        // Comment out from idx to end_idx (inclusive)
-        for (size_t i = idx; i <= end_idx; ++i) {
+        const Modification* edit = cursor.edit();
+        if (!edit) {
+            emit(line);
+        } else if (edit->type == ModificationType::COMMENT_OUT) {
             // Skip if already a comment
-            if (!lines[i].empty() && lines[i][0] == ';') {
-                continue;
+            if (!line.empty() && line[0] == ';') {
+                emit(line);
+            } else {
+                emit(comment_out_line(line, edit->comment));
+                result.lines_modified++;
             }
-            lines[i] = comment_out_line(lines[i], mod.comment);
+        } else if (edit->type == ModificationType::REPLACE && edit->line_number == line_number) {
+            auto replacement = split_lines(edit->gcode);
+            for (const auto& replaced : replacement) {
+                emit(replaced);
+            }
+            result.lines_added += replacement.size();
+            result.lines_removed++;
             result.lines_modified++;
-        }
-        spdlog::debug("[GCodeFileModifier] Commented out lines {}-{}", mod.line_number,
-                      end_idx + 1);
-        break;
-    }
-
-    case ModificationType::DELETE: {
-        // Delete from idx to end_idx (inclusive)
-        size_t count = end_idx - idx + 1;
-        lines.erase(lines.begin() + static_cast<long>(idx),
-                    lines.begin() + static_cast<long>(end_idx + 1));
-        result.lines_removed += count;
-        spdlog::debug("[GCodeFileModifier] Deleted {} lines starting at {}", count,
-                      mod.line_number);
-        break;
-    }
-
-    case ModificationType::INJECT_BEFORE: {
-        // Split the gcode to inject into lines
-        std::vector<std::string> new_lines;
-        std::istringstream ss(mod.gcode);
-        std::string line;
-        while (std::getline(ss, line)) {
-            new_lines.push_back(line);
+        } else {
+            // DELETE, or a later line of a multi-line REPLACE
+            result.lines_removed++;
         }
 
-        // Insert before idx
-        lines.insert(lines.begin() + static_cast<long>(idx), new_lines.begin(), new_lines.end());
-        result.lines_added += new_lines.size();
-        spdlog::debug("[GCodeFileModifier] Injected {} lines before line {}", new_lines.size(),
-                      mod.line_number);
-        break;
-    }
-
-    case ModificationType::INJECT_AFTER: {
-        // Split the gcode to inject into lines
-        std::vector<std::string> new_lines;
-        std::istringstream ss(mod.gcode);
-        std::string line;
-        while (std::getline(ss, line)) {
-            new_lines.push_back(line);
+        for (const Modification* mod : cursor.after()) {
+            for (const auto& injected : split_lines(mod->gcode)) {
+                emit(injected);
+                result.lines_added++;
+            }
         }
 
-        // Insert after idx (at idx+1)
-        lines.insert(lines.begin() + static_cast<long>(idx + 1), new_lines.begin(),
-                     new_lines.end());
-        result.lines_added += new_lines.size();
-        spdlog::debug("[GCodeFileModifier] Injected {} lines after line {}", new_lines.size(),
-                      mod.line_number);
-        break;
-    }
-
-    case ModificationType::REPLACE: {
-        // Replace lines from idx to end_idx with new gcode
-        size_t count = end_idx - idx + 1;
-
-        // Split the replacement gcode into lines
-        std::vector<std::string> new_lines;
-        std::istringstream ss(mod.gcode);
-        std::string line;
-        while (std::getline(ss, line)) {
-            new_lines.push_back(line);
+        if (wrote_line && has_newline) {
+            write("\n");
         }
-
-        // Erase old lines
-        lines.erase(lines.begin() + static_cast<long>(idx),
-                    lines.begin() + static_cast<long>(end_idx + 1));
-
-        // Insert new lines
-        lines.insert(lines.begin() + static_cast<long>(idx), new_lines.begin(), new_lines.end());
-
-        result.lines_removed += count;
-        result.lines_added += new_lines.size();
-        result.lines_modified++;
-        spdlog::debug("[GCodeFileModifier] Replaced {} lines at {} with {} lines", count,
-                      mod.line_number, new_lines.size());
-        break;
     }
+
+    if (line_number < cursor.last_line()) {
+        cursor.warn_unreached(line_number);
     }
+
+    // Past the last edit: block copy, no line splitting
+    result.modified_size += reader.copy_rest(out);
+    result.original_size = reader.offset();
+    return static_cast<bool>(out);
 }
 
 std::string GCodeFileModifier::apply_to_content(const std::string& content) {
@@ -165,64 +360,25 @@ std::string GCodeFileModifier::apply_to_content(const std::string& content) {
         return content;
     }
 
-    // Split content into lines
-    std::vector<std::string> lines;
-    std::istringstream ss(content);
-    std::string line;
-    while (std::getline(ss, line)) {
-        lines.push_back(line);
-    }
-
-    // Sort modifications by line number (descending)
-    sort_modifications();
-
-    // Apply each modification
-    ModificationResult result;
-    for (const auto& mod : modifications_) {
-        apply_single_modification(lines, mod, result);
-    }
-
-    // Join lines back together
+    std::istringstream in(content);
     std::ostringstream out;
-    for (size_t i = 0; i < lines.size(); ++i) {
-        out << lines[i];
-        if (i + 1 < lines.size()) {
-            out << '\n';
-        }
+    ModificationResult result;
+    if (!stream_modifications(in, out, result)) {
+        return "";
     }
-
     return out.str();
 }
 
 ModificationResult GCodeFileModifier::apply(const std::filesystem::path& filepath) {
-    // Check file size to decide between buffered and streaming modes
-    std::error_code ec;
-    auto file_size = std::filesystem::file_size(filepath, ec);
-    if (ec) {
-        ModificationResult result;
-        result.success = false;
-        result.error_message = "Failed to get file size: " + filepath.string();
-        spdlog::error("[GCodeFileModifier] {}", result.error_message);
-        return result;
-    }
-
-    // Use centralized policy for streaming decisions
-    // This ensures consistent threshold behavior across all file operations
-    if (helix::StreamingPolicy::instance().should_stream(file_size)) {
-        spdlog::info("[GCodeFileModifier] File {} ({} MB) - streaming mode (threshold={}MB)",
-                     filepath.filename().string(), file_size / (1024 * 1024),
-                     helix::StreamingPolicy::instance().get_threshold_bytes() / (1024 * 1024));
-        return apply_streaming(filepath);
-    }
-
-    return apply_buffered(filepath);
+    // Streaming uses a fixed-size buffer, so there is no size-based mode switch
+    return apply_streaming(filepath);
 }
 
-ModificationResult GCodeFileModifier::apply_buffered(const std::filesystem::path& filepath) {
+ModificationResult GCodeFileModifier::apply_streaming(const std::filesystem::path& filepath) {
     ModificationResult result;
 
-    // Read original file
-    std::ifstream infile(filepath);
+    // Open input file
+    std::ifstream infile(filepath, std::ios::binary);
     if (!infile.is_open()) {
         result.success = false;
         result.error_message = "Failed to open file: " + filepath.string();
@@ -230,56 +386,11 @@ ModificationResult GCodeFileModifier::apply_buffered(const std::filesystem::path
         return result;
     }
 
-    // Read all lines
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(infile, line)) {
-        lines.push_back(line);
-        result.original_size += line.size() + 1; // +1 for newline
-    }
-    infile.close();
-
-    spdlog::info("[GCodeFileModifier] Loaded {} lines ({} bytes) from {}", lines.size(),
-                 result.original_size, filepath.filename().string());
-
-    if (modifications_.empty()) {
-        // No modifications - just copy to temp
-        result.success = true;
-        result.modified_path = generate_temp_path(filepath);
-
-        std::ofstream outfile(result.modified_path);
-        if (!outfile.is_open()) {
-            result.success = false;
-            result.error_message = "Failed to create temp file: " + result.modified_path;
-            return result;
-        }
-
-        for (size_t i = 0; i < lines.size(); ++i) {
-            outfile << lines[i];
-            if (i + 1 < lines.size()) {
-                outfile << '\n';
-            }
-        }
-        result.modified_size = result.original_size;
-        return result;
-    }
-
-    // Sort modifications by line number (descending)
-    sort_modifications();
-
-    spdlog::info("[GCodeFileModifier] Applying {} modifications (buffered mode)",
-                 modifications_.size());
-
-    // Apply each modification
-    for (const auto& mod : modifications_) {
-        apply_single_modification(lines, mod, result);
-    }
-
-    // Generate temp file path
+    // Generate output path
     result.modified_path = generate_temp_path(filepath);
 
-    // Write modified file
-    std::ofstream outfile(result.modified_path);
+    // Open output file
+    std::ofstream outfile(result.modified_path, std::ios::binary);
     if (!outfile.is_open()) {
         result.success = false;
         result.error_message = "Failed to create temp file: " + result.modified_path;
@@ -287,212 +398,132 @@ ModificationResult GCodeFileModifier::apply_buffered(const std::filesystem::path
         return result;
     }
 
-    for (size_t i = 0; i < lines.size(); ++i) {
-        outfile << lines[i];
-        result.modified_size += lines[i].size();
-        if (i + 1 < lines.size()) {
-            outfile << '\n';
-            result.modified_size++;
-        }
-    }
+    spdlog::info("[GCodeFileModifier] Processing {} in streaming mode ({} modifications)",
+                 filepath.filename().string(), modifications_.size());
+
+    bool written = stream_modifications(infile, outfile, result);
     outfile.close();
+    if (!written || outfile.fail()) {
+        result.success = false;
+        result.error_message = "Failed to write temp file: " + result.modified_path;
+        spdlog::error("[GCodeFileModifier] {}", result.error_message);
+        std::error_code ec;
+        std::filesystem::remove(result.modified_path, ec);
+        return result;
+    }
 
     result.success = true;
-    spdlog::info("[GCodeFileModifier] Created modified file: {} ({} bytes, +{} -{} lines changed)",
+    spdlog::info("[GCodeFileModifier] Streaming complete: {} ({} bytes, +{} -{} lines)",
                  result.modified_path, result.modified_size, result.lines_added,
                  result.lines_removed);
 
     return result;
 }
 
-std::unordered_map<size_t, Modification> GCodeFileModifier::build_streaming_lookup() const {
-    std::unordered_map<size_t, Modification> lookup;
-
-    for (const auto& mod : modifications_) {
-        // For range modifications, we create entries for each line but note
-        // that streaming mode has limitations with multi-line operations
-        size_t end_line = (mod.end_line_number > 0) ? mod.end_line_number : mod.line_number;
-
-        if (mod.end_line_number > 0 && mod.type != ModificationType::COMMENT_OUT &&
-            mod.type != ModificationType::DELETE) {
-            spdlog::warn("[GCodeFileModifier] Streaming mode: multi-line {} not fully supported, "
-                         "processing line {} only",
-                         static_cast<int>(mod.type), mod.line_number);
-            end_line = mod.line_number;
-        }
-
-        for (size_t line = mod.line_number; line <= end_line; ++line) {
-            // Create a modified copy for each line in the range
-            Modification line_mod = mod;
-            line_mod.line_number = line;
-            line_mod.end_line_number = 0; // Reset to single-line for streaming
-            lookup[line] = line_mod;
-        }
-    }
-
-    return lookup;
-}
-
-ModificationResult GCodeFileModifier::apply_streaming(const std::filesystem::path& filepath) {
+ModificationResult GCodeFileModifier::apply_in_place(const std::filesystem::path& filepath) {
     ModificationResult result;
+    result.modified_path = filepath.string();
 
-    // Open input file
-    std::ifstream infile(filepath);
-    if (!infile.is_open()) {
+    auto fail = [&result](std::string message) {
         result.success = false;
-        result.error_message = "Failed to open file: " + filepath.string();
-        spdlog::error("[GCodeFileModifier] {}", result.error_message);
+        result.error_message = std::move(message);
+        spdlog::debug("[GCodeFileModifier] In-place: {}", result.error_message);
         return result;
-    }
+    };
 
-    // Generate output path
-    result.modified_path = generate_temp_path(filepath);
+    for (const auto& mod : modifications_) {
+        bool single_line_replace = mod.type == ModificationType::REPLACE &&
+                                   last_line_of(mod) == mod.line_number &&
+                                   mod.gcode.find('\n') == std::string::npos;
+        if (mod.type != ModificationType::COMMENT_OUT && !single_line_replace) {
+            return fail("modification at line " + std::to_string(mod.line_number) +
+                        " changes the file size");
+        }
+    }
 
-    // Open output file
-    std::ofstream outfile(result.modified_path);
-    if (!outfile.is_open()) {
-        result.success = false;
-        result.error_message = "Failed to create temp file: " + result.modified_path;
+    std::fstream file(filepath, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        result.error_message = "Failed to open file: " + filepath.string();
         spdlog::error("[GCodeFileModifier] {}", result.error_message);
         return result;
     }
 
-    // Build lookup map for O(1) per-line checks
-    auto lookup = build_streaming_lookup();
-
-    spdlog::info("[GCodeFileModifier] Processing file in streaming mode ({} modifications)",
-                 modifications_.size());
-
-    // Process line by line
+    // Locate edited lines and build same-length patches before writing anything
+    struct Patch {
+        size_t offset;
+        std::string bytes;
+    };
+    std::vector<Patch> patches;
+    ModificationCursor cursor(modifications_);
+    ChunkedLineReader reader(file);
     std::string line;
+    bool has_newline = false;
     size_t line_number = 0;
-    bool first_line = true;
-
-    while (std::getline(infile, line)) {
-        line_number++;
-        result.original_size += line.size() + 1;
-
-        // Check if this line has a modification
-        auto it = lookup.find(line_number);
-        if (it != lookup.end()) {
-            const auto& mod = it->second;
-
-            switch (mod.type) {
-            case ModificationType::COMMENT_OUT: {
-                // Skip if already a comment
-                if (!line.empty() && line[0] == ';') {
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << line;
-                } else {
-                    std::string commented = comment_out_line(line, mod.comment);
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << commented;
-                    result.lines_modified++;
-                }
-                result.modified_size += line.size() + (first_line ? 0 : 1);
-                first_line = false;
-                break;
-            }
-
-            case ModificationType::DELETE: {
-                // Simply skip the line (don't write it)
-                result.lines_removed++;
-                // Note: we don't add to modified_size for deleted lines
-                break;
-            }
-
-            case ModificationType::INJECT_BEFORE: {
-                // Write injected content first
-                std::istringstream ss(mod.gcode);
-                std::string inject_line;
-                while (std::getline(ss, inject_line)) {
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << inject_line;
-                    result.modified_size += inject_line.size() + (first_line ? 0 : 1);
-                    result.lines_added++;
-                    first_line = false;
-                }
-                // Then write the original line
-                if (!first_line)
-                    outfile << '\n';
-                outfile << line;
-                result.modified_size += line.size() + 1;
-                first_line = false;
-                break;
-            }
-
-            case ModificationType::INJECT_AFTER: {
-                // Write original line first
-                if (!first_line)
-                    outfile << '\n';
-                outfile << line;
-                result.modified_size += line.size() + (first_line ? 0 : 1);
-                first_line = false;
-                // Then write injected content
-                std::istringstream ss(mod.gcode);
-                std::string inject_line;
-                while (std::getline(ss, inject_line)) {
-                    outfile << '\n';
-                    outfile << inject_line;
-                    result.modified_size += inject_line.size() + 1;
-                    result.lines_added++;
-                }
-                break;
-            }
+    while (line_number < cursor.last_line() && reader.next_line(line, has_newline)) {
+        ++line_number;
+        cursor.advance(line_number, reader.line_offset());
+        const Modification* edit = cursor.edit();
+        if (!edit) {
+            continue;
+        }
 
-            case ModificationType::REPLACE: {
-                // Write replacement content instead of original
-                std::istringstream ss(mod.gcode);
-                std::string replace_line;
-                bool first_replace = true;
-                while (std::getline(ss, replace_line)) {
-                    if (!first_line && !first_replace)
-                        outfile << '\n';
-                    if (!first_line && first_replace)
-                        outfile << '\n';
-                    outfile << replace_line;
-                    result.modified_size += replace_line.size() + (first_line ? 0 : 1);
-                    first_replace = false;
-                    first_line = false;
-                }
+        size_t content_size = line.size() - (!line.empty() && line.back() == '\r' ? 1 : 0);
+        if (edit->type == ModificationType::COMMENT_OUT) {
+            if (content_size > 0 && line[0] != ';') {
+                patches.push_back({reader.line_offset(), ";"});
                 result.lines_modified++;
-                break;
-            }
             }
         } else {
-            // No modification - write line as-is
-            if (!first_line)
-                outfile << '\n';
-            outfile << line;
-            result.modified_size += line.size() + (first_line ? 0 : 1);
-            first_line = false;
+            if (edit->gcode.size() > content_size) {
+                return fail("replacement for line " + std::to_string(line_number) +
+                            " is longer than the original");
+            }
+            std::string bytes = edit->gcode;
+            bytes.resize(content_size, ' ');
+            patches.push_back({reader.line_offset(), std::move(bytes)});
+            result.lines_modified++;
         }
     }
+    if (line_number < cursor.last_line()) {
+        cursor.warn_unreached(line_number);
+    }
+    if (cursor.offset_mismatches() > 0) {
+        return fail("byte offsets do not match the file");
+    }
 
-    infile.close();
-    outfile.close();
+    file.clear(); // Reading may have hit EOF
+    for (const auto& patch : patches) {
+        file.seekp(static_cast<std::streamoff>(patch.offset));
+        file.write(patch.bytes.data(), static_cast<std::streamsize>(patch.bytes.size()));
+    }
+    file.flush();
+    if (!file) {
+        result.error_message = "Failed to patch file: " + filepath.string();
+        spdlog::error("[GCodeFileModifier] {}", result.error_message);
+        return result;
+    }
 
+    std::error_code ec;
+    result.original_size = static_cast<size_t>(std::filesystem::file_size(filepath, ec));
+    result.modified_size = result.original_size;
     result.success = true;
-    spdlog::info("[GCodeFileModifier] Streaming complete: {} ({} bytes, +{} -{} lines)",
-                 result.modified_path, result.modified_size, result.lines_added,
-                 result.lines_removed);
-
+    spdlog::info("[GCodeFileModifier] Patched {} in place ({} lines modified)",
+                 filepath.filename().string(), result.lines_modified);
     return result;
 }
 
 bool GCodeFileModifier::disable_operation(const DetectedOperation& op) {
     switch (op.embedding) {
     case OperationEmbedding::DIRECT_COMMAND:
-    case OperationEmbedding::MACRO_CALL:
+    case OperationEmbedding::MACRO_CALL: {
         // Comment out the line containing the operation
-        add_modification(
-            Modification::comment_out(op.line_number, "Disabled " + op.display_name()));
+        auto mod = Modification::comment_out(op.line_number, "Disabled " + op.display_name());
+        mod.byte_offset = op.byte_offset;
+        add_modification(std::move(mod));
         spdlog::debug("[GCodeFileModifier] Will disable {} at line {}", op.display_name(),
                       op.line_number);
         return true;
+    }
 
     case OperationEmbedding::MACRO_PARAMETER:
         // Need to modify the parameter, not comment out the whole line
@@ -517,11 +548,7 @@ bool GCodeFileModifier::disable_macro_parameter(const DetectedOperation& op) {
         return false;
     }
 
-    // Build regex pattern to find PARAM_NAME=value (case-insensitive)
-    // Replace the value with 0 or FALSE
-    std::string pattern = op.param_name + R"(=\S+)";
-    std::regex re(pattern, std::regex_constants::icase);
-
+    // Replace every PARAM_NAME=value (case-insensitive) with 0 or FALSE
     // Determine replacement value
     std::string replacement = op.param_name + "=0";
 
@@ -533,11 +560,12 @@ bool GCodeFileModifier::disable_macro_parameter(const DetectedOperation& op) {
     }
 
     // Build the modified line
-    std::string modified_line = std::regex_replace(op.raw_line, re, replacement);
+    std::string modified_line = replace_param_values(op.raw_line, op.param_name, replacement);
 
     // Add a replacement modification
-    add_modification(
-        Modification::replace(op.line_number, modified_line, "Disabled " + op.param_name));
+    auto mod = Modification::replace(op.line_number, modified_line, "Disabled " + op.param_name);
+    mod.byte_offset = op.byte_offset;
+    add_modification(std::move(mod));
 
     spdlog::debug("[GCodeFileModifier] Will replace {} param at line {} with value 0/FALSE",
                   op.param_name, op.line_number);
@@ -568,8 +596,10 @@ bool GCodeFileModifier::add_print_start_skip_params(
     std::string modified_line = scan_result.print_start.with_skip_params(skip_params);
 
     // Create a REPLACE modification for the PRINT_START line
-    add_modification(Modification::replace(scan_result.print_start.line_number, modified_line,
-                                           "HelixScreen: Added skip parameters"));
+    auto mod = Modification::replace(scan_result.print_start.line_number, modified_line,
+                                     "HelixScreen: Added skip parameters");
+    mod.byte_offset = scan_result.print_start.byte_offset;
+    add_modification(std::move(mod));
 
     spdlog::info("[GCodeFileModifier] Adding skip params to {} at line {}: {}",
                  scan_result.print_start.macro_name, scan_result.print_start.line_number,
@@ -108,7 +108,11 @@ RibbonGeometry::RibbonGeometry(RibbonGeometry&& other) noexcept
       strip_layer_index(std::move(other.strip_layer_index)),
       layer_strip_ranges(std::move(other.layer_strip_ranges)),
       max_layer_index(other.max_layer_index), layer_bboxes(std::move(other.layer_bboxes)),
-      normal_cache(std::move(other.normal_cache)), color_cache(std::move(other.color_cache)),
+      object_names(std::move(other.object_names)),
+      strip_object_index(std::move(other.strip_object_index)),
+      object_strip_ranges(std::move(other.object_strip_ranges)),
+      filament_color_slot(other.filament_color_slot), normal_cache(std::move(other.normal_cache)),
+      color_cache(std::move(other.color_cache)),
       extrusion_triangle_count(other.extrusion_triangle_count),
       travel_triangle_count(other.travel_triangle_count), quantization(other.quantization) {}
 
@@ -124,6 +128,10 @@ RibbonGeometry& RibbonGeometry::operator=(RibbonGeometry&& other) noexcept {
         layer_strip_ranges = std::move(other.layer_strip_ranges);
         layer_bboxes = std::move(other.layer_bboxes);
         max_layer_index = other.max_layer_index;
+        object_names = std::move(other.object_names);
+        strip_object_index = std::move(other.strip_object_index);
+        object_strip_ranges = std::move(other.object_strip_ranges);
+        filament_color_slot = other.filament_color_slot;
         normal_cache = std::move(other.normal_cache);
         color_cache = std::move(other.color_cache);
         extrusion_triangle_count = other.extrusion_triangle_count;
@@ -133,6 +141,20 @@ RibbonGeometry& RibbonGeometry::operator=(RibbonGeometry&& other) noexcept {
     return *this;
 }
 
+size_t RibbonGeometry::memory_usage() const {
+    size_t object_ranges_bytes = 0;
+    for (const auto& ranges : object_strip_ranges) {
+        object_ranges_bytes += ranges.size() * sizeof(std::pair<size_t, size_t>);
+    }
+
+    return vertices.size() * sizeof(RibbonVertex) + indices.size() * sizeof(TriangleIndices) +
+           strips.size() * sizeof(TriangleStrip) + normal_palette.size() * sizeof(glm::vec3) +
+           color_palette.size() * sizeof(uint32_t) + strip_layer_index.size() * sizeof(uint16_t) +
+           layer_strip_ranges.size() * sizeof(std::pair<size_t, size_t>) +
+           layer_bboxes.size() * sizeof(AABB) + strip_object_index.size() * sizeof(uint16_t) +
+           object_ranges_bytes;
+}
+
 void RibbonGeometry::clear() {
     vertices.clear();
     indices.clear();
@@ -143,6 +165,10 @@ void RibbonGeometry::clear() {
     layer_strip_ranges.clear();
     layer_bboxes.clear();
     max_layer_index = 0;
+    object_names.clear();
+    strip_object_index.clear();
+    object_strip_ranges.clear();
+    filament_color_slot = -1;
 
     // Clear caches
     if (normal_cache) {
@@ -362,6 +388,9 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     // Layer tracking for ghost layer rendering
     // Temporary map to accumulate strips per layer, then convert to ranges
     std::unordered_map<uint16_t, std::vector<size_t>> layer_to_strip_indices;
+
+    // Object tracking for render-time highlight/exclude (name -> object slot)
+    std::unordered_map<std::string, uint16_t> object_slots;
     geometry.max_layer_index =
         gcode.layers.empty() ? 0 : static_cast<uint16_t>(gcode.layers.size() - 1);
 
@@ -444,6 +473,30 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
             layer_to_strip_indices[layer_idx].push_back(s);
         }
 
+        // Track which strips belong to which object (runs of consecutive strips)
+        uint16_t object_slot = RibbonGeometry::NO_OBJECT;
+        if (!segment.object_name.empty()) {
+            auto slot_it = object_slots.find(segment.object_name);
+            if (slot_it != object_slots.end()) {
+                object_slot = slot_it->second;
+            } else if (geometry.object_names.size() < RibbonGeometry::NO_OBJECT) {
+                object_slot = static_cast<uint16_t>(geometry.object_names.size());
+                object_slots.emplace(segment.object_name, object_slot);
+                geometry.object_names.push_back(segment.object_name);
+                geometry.object_strip_ranges.emplace_back();
+            }
+        }
+        geometry.strip_object_index.insert(geometry.strip_object_index.end(),
+                                           strips_after - strips_before, object_slot);
+        if (object_slot != RibbonGeometry::NO_OBJECT && strips_after > strips_before) {
+            auto& ranges = geometry.object_strip_ranges[object_slot];
+            if (!ranges.empty() && ranges.back().first + ranges.back().second == strips_before) {
+                ranges.back().second += strips_after - strips_before;
+            } else {
+                ranges.emplace_back(strips_before, strips_after - strips_before);
+            }
+        }
+
         // Store for next iteration
         prev_end_cap = end_cap;
         prev_end_pos = segment.end;
@@ -463,6 +516,19 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
 
     spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips",
                   geometry.layer_strip_ranges.size(), geometry.strips.size());
+    spdlog::debug("[GCode::Builder] Object tracking: {} objects", geometry.object_names.size());
+
+    // Remember which palette slot holds the filament color so the renderer can
+    // recolor it without a rebuild
+    if (!use_height_gradient_) {
+        uint32_t filament_rgb = (static_cast<uint32_t>(filament_r_) << 16) |
+                                (static_cast<uint32_t>(filament_g_) << 8) |
+                                static_cast<uint32_t>(filament_b_);
+        auto slot_it = geometry.color_cache->find(filament_rgb);
+        if (slot_it != geometry.color_cache->end()) {
+            geometry.filament_color_slot = slot_it->second;
+        }
+    }
 
     spdlog::trace("[GCode Geometry] Segment Y range: [{:.1f}, {:.1f}]", seg_y_min, seg_y_max);
 
@@ -703,19 +769,8 @@ GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, Ribbon
     const glm::vec3 perp_up = glm::normalize(glm::cross(right, dir));
 
     // Compute color
+    // Base color only: highlight/exclude tints are applied per object at render time
     uint32_t rgb = compute_segment_color(segment, quant.min_bounds.z, quant.max_bounds.z);
-    if (!highlighted_objects_.empty() && !segment.object_name.empty() &&
-        highlighted_objects_.count(segment.object_name) > 0) {
-        constexpr float HIGHLIGHT_BRIGHTNESS = 1.8f;
-        uint8_t r =
-            static_cast<uint8_t>(std::min(255.0f, ((rgb >> 16) & 0xFF) * HIGHLIGHT_BRIGHTNESS));
-        uint8_t g =
-            static_cast<uint8_t>(std::min(255.0f, ((rgb >> 8) & 0xFF) * HIGHLIGHT_BRIGHTNESS));
-        uint8_t b = static_cast<uint8_t>(std::min(255.0f, (rgb & 0xFF) * HIGHLIGHT_BRIGHTNESS));
-        rgb = (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) |
-              static_cast<uint32_t>(b);
-    }
-
     uint8_t color_idx = add_to_color_palette(geometry, rgb);
 
     // Face colors: one color per face (N faces total)
@@ -10,7 +10,6 @@
 #include <cmath>
 #include <cstring>
 #include <fstream>
-#include <limits>
 
 namespace helix {
 namespace gcode {
@@ -20,6 +19,9 @@ namespace {
 // Layer detection tolerance for Z changes
 constexpr float Z_EPSILON = 0.001f;
 
+// OrcaSlicer writes its metadata (filament color included) at the end of the file
+constexpr uint64_t FOOTER_COLOR_BYTES = 32768;
+
 // Extract float parameter from G-code line (e.g., "Z1.2" -> 1.2)
 bool extract_z_param(const char* line, size_t len, float& out_z) {
     // Find 'Z' parameter (case-insensitive)
@@ -67,6 +69,18 @@ bool is_movement_command(const char* line, size_t len) {
     return false;
 }
 
+// Check if line is an EXCLUDE_OBJECT_DEFINE command
+bool is_object_definition(const char* line, size_t len) {
+    static constexpr char DEFINE[] = "EXCLUDE_OBJECT_DEFINE";
+    static constexpr size_t DEFINE_LEN = sizeof(DEFINE) - 1;
+
+    size_t i = 0;
+    while (i < len && (line[i] == ' ' || line[i] == '\t')) {
+        ++i;
+    }
+    return len - i > DEFINE_LEN && std::strncmp(line + i, DEFINE, DEFINE_LEN) == 0;
+}
+
 // Check if line contains E parameter with positive value (extrusion)
 bool has_positive_extrusion(const char* line, size_t len) {
     for (size_t i = 0; i < len; ++i) {
@@ -184,156 +198,161 @@ bool is_layer_marker(const char* line, size_t len) {
 } // anonymous namespace
 
 bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
-    auto start_time = std::chrono::high_resolution_clock::now();
-
-    // Clear any previous data
-    entries_.clear();
-    stats_ = LayerIndexStats{};
-    source_path_ = filepath;
-
     std::ifstream file(filepath, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
+        clear();
+        source_path_ = filepath;
         spdlog::error("[LayerIndex] Failed to open file: {}", filepath);
         return false;
     }
 
     // Get file size
-    stats_.total_bytes = static_cast<size_t>(file.tellg());
+    auto file_size = static_cast<size_t>(file.tellg());
     file.seekg(0, std::ios::beg);
 
+    begin_build(filepath, file_size);
+
+    // Read line by line
+    std::string line;
+    line.reserve(256);
+    while (std::getline(file, line)) {
+        add_line(line);
+    }
+
+    return finish_build();
+}
+
+void GCodeLayerIndex::begin_build(const std::string& filepath, size_t file_size) {
+    // Clear any previous data
+    entries_.clear();
+    stats_ = LayerIndexStats{};
+    objects_.clear();
+    source_path_ = filepath;
+    build_ = BuildState{};
+    build_.start_time = std::chrono::steady_clock::now();
+    stats_.total_bytes = file_size;
+
     spdlog::debug("[LayerIndex] Building index for {} ({} bytes)", filepath, stats_.total_bytes);
 
     // Reserve estimated capacity (assume ~100 layers for now)
     entries_.reserve(100);
+}
 
-    // Read line by line
-    std::string line;
-    line.reserve(256);
+void GCodeLayerIndex::add_line(const std::string& line) {
+    size_t line_len = line.length();
+    uint64_t line_offset = build_.current_offset;
+    stats_.total_lines++;
 
-    float current_z = -std::numeric_limits<float>::infinity();
-    uint64_t current_layer_start = 0;
-    uint64_t current_offset = 0;
-    uint16_t current_layer_lines = 0;
-    bool use_layer_markers = false;
-    bool pending_layer_start = false;
-    bool first_layer_started = false;
+    // Check for layer marker
+    if (is_layer_marker(line.c_str(), line_len)) {
+        build_.use_layer_markers = true;
+        build_.pending_layer_start = true;
+        // We'll start the new layer when we see the next Z move
+    }
 
-    while (std::getline(file, line)) {
-        size_t line_len = line.length();
-        stats_.total_lines++;
-
-        // Check for layer marker
-        if (is_layer_marker(line.c_str(), line_len)) {
-            use_layer_markers = true;
-            pending_layer_start = true;
-            // We'll start the new layer when we see the next Z move
+    // Extract filament color from metadata (only if not already found).
+    // Slicers put it in the header (first ~1000 lines) or, like OrcaSlicer,
+    // in the footer metadata block (last 32KB).
+    if (stats_.filament_color.empty() &&
+        (stats_.total_lines < 1000 || line_offset + FOOTER_COLOR_BYTES >= stats_.total_bytes)) {
+        std::string color;
+        if (extract_filament_color(line.c_str(), line_len, color)) {
+            stats_.filament_color = color;
+            spdlog::debug("[LayerIndex] Found filament color: {}", color);
         }
+    }
 
-        // Extract filament color from metadata (only if not already found)
-        // Only check comment lines in the header (first ~1000 lines)
-        if (stats_.filament_color.empty() && stats_.total_lines < 1000) {
-            std::string color;
-            if (extract_filament_color(line.c_str(), line_len, color)) {
-                stats_.filament_color = color;
-                spdlog::debug("[LayerIndex] Found filament color: {}", color);
-            }
+    // Collect object definitions for picking (Klipper emits them in the header)
+    if (is_object_definition(line.c_str(), line_len)) {
+        size_t first = line.find_first_not_of(" \t");
+        size_t last = line.find_last_not_of(" \t\r");
+        GCodeObject obj;
+        if (GCodeParser::parse_object_definition(line.substr(first, last - first + 1), obj)) {
+            objects_[obj.name] = std::move(obj);
         }
+    }
 
-        // Check for movement commands
-        if (is_movement_command(line.c_str(), line_len)) {
-            float z;
-            if (extract_z_param(line.c_str(), line_len, z)) {
-                // Z change detected
-                bool is_new_layer = false;
-
-                if (use_layer_markers) {
-                    // Use marker-based layer detection
-                    if (pending_layer_start) {
-                        is_new_layer = true;
-                        pending_layer_start = false;
-                    }
-                } else {
-                    // Use Z-change based layer detection
-                    if (z > current_z + Z_EPSILON) {
-                        is_new_layer = true;
-                    }
+    // Check for movement commands
+    if (is_movement_command(line.c_str(), line_len)) {
+        float z;
+        if (extract_z_param(line.c_str(), line_len, z)) {
+            // Z change detected
+            bool is_new_layer = false;
+
+            if (build_.use_layer_markers) {
+                // Use marker-based layer detection
+                if (build_.pending_layer_start) {
+                    is_new_layer = true;
+                    build_.pending_layer_start = false;
                 }
+            } else {
+                // Use Z-change based layer detection
+                if (z > build_.current_z + Z_EPSILON) {
+                    is_new_layer = true;
+                }
+            }
 
-                if (is_new_layer) {
-                    // Finalize previous layer if any
-                    if (first_layer_started && current_layer_lines > 0) {
-                        StreamingLayerEntry& last = entries_.back();
-                        last.byte_length =
-                            static_cast<uint32_t>(current_offset - current_layer_start);
-                        last.line_count = current_layer_lines;
-                    }
-
-                    // Start new layer
-                    StreamingLayerEntry entry{};
-                    entry.file_offset = current_offset;
-                    entry.z_height = z;
-                    entry.byte_length = 0; // Will be filled when layer ends
-                    entry.line_count = 0;  // Will be filled when layer ends
-                    entry.flags = 0;
-                    entries_.push_back(entry);
-
-                    if (!first_layer_started) {
-                        stats_.min_z = z;
-                        first_layer_started = true;
-                    }
-                    stats_.max_z = z;
+            if (is_new_layer) {
+                // Finalize previous layer if any
+                if (build_.first_layer_started && build_.current_layer_lines > 0) {
+                    StreamingLayerEntry& last = entries_.back();
+                    last.byte_length =
+                        static_cast<uint32_t>(build_.current_offset - build_.current_layer_start);
+                    last.line_count = build_.current_layer_lines;
+                }
 
-                    current_z = z;
-                    current_layer_start = current_offset;
-                    current_layer_lines = 0;
+                // Start new layer
+                StreamingLayerEntry entry{};
+                entry.file_offset = build_.current_offset;
+                entry.z_height = z;
+                entry.byte_length = 0; // Will be filled when layer ends
+                entry.line_count = 0;  // Will be filled when layer ends
+                entry.flags = 0;
+                entries_.push_back(entry);
+
+                if (!build_.first_layer_started) {
+                    stats_.min_z = z;
+                    build_.first_layer_started = true;
                 }
-            }
+                stats_.max_z = z;
 
-            // Track extrusion vs travel
-            if (has_positive_extrusion(line.c_str(), line_len)) {
-                stats_.extrusion_moves++;
-            } else {
-                stats_.travel_moves++;
+                build_.current_z = z;
+                build_.current_layer_start = build_.current_offset;
+                build_.current_layer_lines = 0;
             }
         }
 
-        current_layer_lines++;
-        // Account for line length + newline character
-        current_offset += line_len + 1;
+        // Track extrusion vs travel
+        if (has_positive_extrusion(line.c_str(), line_len)) {
+            stats_.extrusion_moves++;
+        } else {
+            stats_.travel_moves++;
+        }
     }
 
+    build_.current_layer_lines++;
+    // Account for line length + newline character
+    build_.current_offset += line_len + 1;
+}
+
+bool GCodeLayerIndex::finish_build() {
     // Finalize last layer
-    if (first_layer_started && !entries_.empty()) {
+    if (build_.first_layer_started && !entries_.empty()) {
         StreamingLayerEntry& last = entries_.back();
-        last.byte_length = static_cast<uint32_t>(stats_.total_bytes - current_layer_start);
-        last.line_count = current_layer_lines;
+        last.byte_length = static_cast<uint32_t>(stats_.total_bytes - build_.current_layer_start);
+        last.line_count = build_.current_layer_lines;
     }
 
     stats_.total_layers = entries_.size();
 
-    // If no filament color found in header, scan the file footer (OrcaSlicer puts metadata at end)
-    if (stats_.filament_color.empty() && stats_.total_bytes > 0) {
-        // Read last 32KB of file to find metadata
-        size_t footer_size = std::min(stats_.total_bytes, size_t(32768));
-        file.clear();
-        file.seekg(-static_cast<std::streamoff>(footer_size), std::ios::end);
-
-        while (std::getline(file, line)) {
-            std::string color;
-            if (extract_filament_color(line.c_str(), line.length(), color)) {
-                stats_.filament_color = color;
-                spdlog::debug("[LayerIndex] Found filament color in footer: {}", color);
-                break;
-            }
-        }
-    }
-
-    auto end_time = std::chrono::high_resolution_clock::now();
-    stats_.build_time_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+    auto end_time = std::chrono::steady_clock::now();
+    stats_.build_time_ms =
+        std::chrono::duration<double, std::milli>(end_time - build_.start_time).count();
 
-    spdlog::info("[LayerIndex] Built index: {} layers, {} lines, Z=[{:.2f}, {:.2f}], {:.1f}ms",
-                 stats_.total_layers, stats_.total_lines, stats_.min_z, stats_.max_z,
-                 stats_.build_time_ms);
+    spdlog::info("[LayerIndex] Built index: {} layers, {} lines, {} objects, Z=[{:.2f}, {:.2f}], "
+                 "{:.1f}ms",
+                 stats_.total_layers, stats_.total_lines, objects_.size(), stats_.min_z,
+                 stats_.max_z, stats_.build_time_ms);
 
     spdlog::debug("[LayerIndex] Memory usage: {} bytes ({} bytes/layer)", memory_usage_bytes(),
                   entries_.empty() ? 0 : memory_usage_bytes() / entries_.size());
@@ -341,6 +360,17 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     return !entries_.empty();
 }
 
+void GCodeLayerIndex::restore(const std::string& filepath, std::vector<StreamingLayerEntry> entries,
+                              const LayerIndexStats& stats,
+                              std::map<std::string, GCodeObject> objects) {
+    entries_ = std::move(entries);
+    stats_ = stats;
+    stats_.total_layers = entries_.size();
+    objects_ = std::move(objects);
+    source_path_ = filepath;
+    build_ = BuildState{};
+}
+
 StreamingLayerEntry GCodeLayerIndex::get_entry(size_t layer_index) const {
     if (layer_index < entries_.size()) {
         return entries_[layer_index];
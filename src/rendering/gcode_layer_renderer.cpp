@@ -7,6 +7,7 @@
 #include "gcode_parser.h"
 #include "memory_monitor.h"
 #include "memory_utils.h"
+#include "scoped_trace.h"
 #include "theme_manager.h"
 
 #include <spdlog/spdlog.h>
@@ -47,6 +48,7 @@ GCodeLayerRenderer::~GCodeLayerRenderer() {
 void GCodeLayerRenderer::set_gcode(const ParsedGCodeFile* gcode) {
     gcode_ = gcode;
     streaming_controller_ = nullptr; // Clear streaming mode
+    picker_objects_ = nullptr;
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
@@ -61,6 +63,7 @@ void GCodeLayerRenderer::set_gcode(const ParsedGCodeFile* gcode) {
 void GCodeLayerRenderer::set_streaming_controller(GCodeStreamingController* controller) {
     streaming_controller_ = controller;
     gcode_ = nullptr; // Clear full-file mode
+    picker_objects_ = nullptr;
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
@@ -111,6 +114,35 @@ void GCodeLayerRenderer::set_content_offset_y(float offset_percent) {
     content_offset_y_percent_ = std::clamp(offset_percent, -1.0f, 1.0f);
 }
 
+// ============================================================================
+// Object Picking
+// ============================================================================
+
+std::optional<std::string> GCodeLayerRenderer::pick_object(const glm::vec2& canvas_pos) const {
+    const std::map<std::string, GCodeObject>* objects = nullptr;
+    if (streaming_controller_) {
+        objects = &streaming_controller_->get_objects();
+    } else if (gcode_) {
+        objects = &gcode_->objects;
+    }
+    if (!objects || !bounds_valid_) {
+        return std::nullopt;
+    }
+
+    // Streaming index objects carry no bounding box: extrude them over the whole print
+    if (picker_objects_ != objects || picker_object_count_ != objects->size()) {
+        object_picker_.build(*objects, bounds_min_z_, bounds_max_z_);
+        picker_objects_ = objects;
+        picker_object_count_ = objects->size();
+    }
+
+    TransformParams params = capture_transform_params();
+    return object_picker_.pick(canvas_pos, view_projection_raw(params),
+                               glm::vec2(static_cast<float>(params.canvas_width),
+                                         static_cast<float>(params.canvas_height)),
+                               bounds_min_z_, bounds_max_z_);
+}
+
 // ============================================================================
 // Colors
 // ============================================================================
@@ -1013,6 +1045,53 @@ GCodeLayerRenderer::TransformParams GCodeLayerRenderer::capture_transform_params
     };
 }
 
+glm::mat4 GCodeLayerRenderer::view_projection_raw(const TransformParams& params) {
+    // world_to_screen_raw() is affine in (x, y, z) - offset:
+    //   sx = scale * dot(right, d) + W/2,  sy = H/2 - scale * dot(up, d) + content offset
+    // 'forward' points away from the viewer and only orders depth for picking.
+    glm::vec3 right, up, forward;
+    switch (params.view_mode) {
+    case ViewMode::FRONT:
+        // 90° CCW, -45° horizontal rotation, 30° elevation (see world_to_screen_raw)
+        right = {0.7071f, -0.7071f, 0.0f};
+        up = {0.7071f * 0.5f, 0.7071f * 0.5f, 0.866f};
+        forward = {0.7071f * 0.866f, 0.7071f * 0.866f, -0.5f};
+        break;
+    case ViewMode::ISOMETRIC:
+        // Z does not reach the screen: rays are vertical
+        right = {0.7071f, -0.7071f, 0.0f};
+        up = {0.7071f * 0.5f, 0.7071f * 0.5f, 0.0f};
+        forward = {0.0f, 0.0f, -1.0f};
+        break;
+    case ViewMode::TOP_DOWN:
+    default:
+        right = {1.0f, 0.0f, 0.0f};
+        up = {0.0f, 1.0f, 0.0f};
+        forward = {0.0f, 0.0f, -1.0f};
+        break;
+    }
+
+    // Depth span mapped to NDC z [-1, 1]; anything on a printer bed fits
+    constexpr float DEPTH_RANGE_MM = 2000.0f;
+
+    const glm::vec3 offset(params.offset_x, params.offset_y, params.offset_z);
+    const glm::vec3 rows[3] = {
+        right * (2.0f * params.scale / static_cast<float>(params.canvas_width)),
+        up * (2.0f * params.scale / static_cast<float>(params.canvas_height)),
+        forward / DEPTH_RANGE_MM,
+    };
+    const float constants[3] = {0.0f, -2.0f * params.content_offset_y_percent, 0.0f};
+
+    glm::mat4 m(1.0f);
+    for (int row = 0; row < 3; ++row) {
+        m[0][row] = rows[row].x;
+        m[1][row] = rows[row].y;
+        m[2][row] = rows[row].z;
+        m[3][row] = constants[row] - glm::dot(rows[row], offset);
+    }
+    return m;
+}
+
 glm::ivec2 GCodeLayerRenderer::world_to_screen_raw(const TransformParams& params, float x, float y,
                                                    float z) {
     float sx, sy;
@@ -1208,6 +1287,9 @@ bool GCodeLayerRenderer::is_ghost_build_running() const {
 }
 
 void GCodeLayerRenderer::background_ghost_render_thread() {
+    helix::trace::set_thread_name("gcode-ghost");
+    HELIX_TRACE_SCOPE("gcode", "ghost_render");
+
     // Works with both full-file mode (gcode_) and streaming mode (streaming_controller_)
     if (!ghost_raw_buffer_ || (!gcode_ && !streaming_controller_)) {
         ghost_thread_running_.store(false);
@@ -0,0 +1,385 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_object_picker.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+constexpr float EPSILON = 1e-6f;
+
+/// Grid cells per axis: roughly two per object along each axis, capped
+constexpr int MAX_GRID_DIM = 32;
+
+/// Even-odd rule point-in-polygon test
+bool point_in_polygon(const glm::vec2& p, const std::vector<glm::vec2>& polygon) {
+    bool inside = false;
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+        const glm::vec2& a = polygon[i];
+        const glm::vec2& b = polygon[j];
+        if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+float cross2(const glm::vec2& a, const glm::vec2& b) {
+    return a.x * b.y - a.y * b.x;
+}
+
+/**
+ * @brief First parameter u in [0, 1] at which segment a->b touches the polygon
+ */
+std::optional<float> first_polygon_hit(const glm::vec2& a, const glm::vec2& b,
+                                       const std::vector<glm::vec2>& polygon) {
+    if (point_in_polygon(a, polygon)) {
+        return 0.0f;
+    }
+
+    glm::vec2 r = b - a;
+    std::optional<float> first;
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+        glm::vec2 q = polygon[j];
+        glm::vec2 s = polygon[i] - q;
+        float denom = cross2(r, s);
+        if (std::abs(denom) < EPSILON) {
+            continue; // Parallel edge: the ray crosses a neighbouring edge instead
+        }
+        float u = cross2(q - a, s) / denom;
+        float v = cross2(q - a, r) / denom;
+        if (u >= 0.0f && u <= 1.0f && v >= 0.0f && v <= 1.0f && (!first || u < *first)) {
+            first = u;
+        }
+    }
+    return first;
+}
+
+float distance_to_segment(const glm::vec2& p, const glm::vec2& a, const glm::vec2& b) {
+    glm::vec2 v = b - a;
+    float length_sq = glm::dot(v, v);
+    float t = (length_sq > EPSILON) ? std::clamp(glm::dot(p - a, v) / length_sq, 0.0f, 1.0f)
+                                    : 0.0f;
+    return glm::length(p - (a + t * v));
+}
+
+} // namespace
+
+// ============================================================================
+// Build
+// ============================================================================
+
+void ObjectPicker::build(const std::map<std::string, GCodeObject>& objects, float default_z_min,
+                         float default_z_max) {
+    clear();
+
+    glm::vec2 bounds_min(std::numeric_limits<float>::max());
+    glm::vec2 bounds_max(std::numeric_limits<float>::lowest());
+
+    for (const auto& [name, object] : objects) {
+        if (entries_.size() >= std::numeric_limits<uint16_t>::max()) {
+            spdlog::warn("[ObjectPicker] Too many objects, ignoring the rest");
+            break;
+        }
+
+        Entry entry;
+        entry.name = name;
+
+        // Footprint: EXCLUDE_OBJECT_DEFINE polygon, else the XY extent of the toolpaths
+        const AABB& bbox = object.bounding_box;
+        if (object.polygon.size() >= 3) {
+            entry.footprint = object.polygon;
+        } else if (!bbox.is_empty()) {
+            entry.footprint = {{bbox.min.x, bbox.min.y},
+                               {bbox.max.x, bbox.min.y},
+                               {bbox.max.x, bbox.max.y},
+                               {bbox.min.x, bbox.max.y}};
+        } else {
+            spdlog::debug("[ObjectPicker] Object '{}' has no polygon or bounds, not pickable",
+                          name);
+            continue;
+        }
+
+        entry.min = entry.footprint.front();
+        entry.max = entry.footprint.front();
+        for (const auto& point : entry.footprint) {
+            entry.min = glm::min(entry.min, point);
+            entry.max = glm::max(entry.max, point);
+        }
+
+        if (bbox.is_empty()) {
+            entry.z_min = default_z_min;
+            entry.z_max = default_z_max;
+        } else {
+            entry.z_min = bbox.min.z;
+            entry.z_max = bbox.max.z;
+        }
+
+        bounds_min = glm::min(bounds_min, entry.min);
+        bounds_max = glm::max(bounds_max, entry.max);
+        entries_.push_back(std::move(entry));
+    }
+
+    if (entries_.empty()) {
+        return;
+    }
+
+    int dim = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(entries_.size())))) * 2;
+    dim = std::clamp(dim, 1, MAX_GRID_DIM);
+    grid_cols_ = dim;
+    grid_rows_ = dim;
+    grid_min_ = bounds_min;
+    cell_size_ = glm::max((bounds_max - bounds_min) / static_cast<float>(dim), glm::vec2(0.001f));
+    cells_.assign(static_cast<size_t>(grid_cols_ * grid_rows_), {});
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        int x0, y0, x1, y1;
+        cell_range(entries_[i].min, entries_[i].max, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                cells_[static_cast<size_t>(y * grid_cols_ + x)].push_back(
+                    static_cast<uint16_t>(i));
+            }
+        }
+    }
+
+    spdlog::debug("[ObjectPicker] Indexed {} objects in {}x{} grid", entries_.size(), grid_cols_,
+                  grid_rows_);
+}
+
+bool ObjectPicker::sync(const ParsedGCodeFile& gcode) {
+    size_t object_count = gcode.objects.size() + gcode.segment_objects.size();
+    if (source_ == &gcode && source_filename_ == gcode.filename &&
+        source_object_count_ == object_count) {
+        return false;
+    }
+
+    const float z_min = gcode.global_bounding_box.min.z;
+    const float z_max = gcode.global_bounding_box.max.z;
+    if (gcode.segment_objects.empty()) {
+        build(gcode.objects, z_min, z_max);
+    } else {
+        // Files without EXCLUDE_OBJECT_DEFINE only name objects in their segments
+        std::map<std::string, GCodeObject> objects = gcode.objects;
+        objects.insert(gcode.segment_objects.begin(), gcode.segment_objects.end());
+        build(objects, z_min, z_max);
+    }
+    source_ = &gcode;
+    source_filename_ = gcode.filename;
+    source_object_count_ = object_count;
+    return true;
+}
+
+void ObjectPicker::clear() {
+    source_ = nullptr;
+    source_filename_.clear();
+    source_object_count_ = 0;
+    entries_.clear();
+    cells_.clear();
+    grid_cols_ = 0;
+    grid_rows_ = 0;
+}
+
+void ObjectPicker::cell_range(const glm::vec2& min, const glm::vec2& max, int& x0, int& y0,
+                              int& x1, int& y1) const {
+    auto to_cell = [](float value, float origin, float size, int count) {
+        float cell = std::floor((value - origin) / size);
+        return static_cast<int>(std::clamp(cell, 0.0f, static_cast<float>(count - 1)));
+    };
+    x0 = to_cell(min.x, grid_min_.x, cell_size_.x, grid_cols_);
+    x1 = to_cell(max.x, grid_min_.x, cell_size_.x, grid_cols_);
+    y0 = to_cell(min.y, grid_min_.y, cell_size_.y, grid_rows_);
+    y1 = to_cell(max.y, grid_min_.y, cell_size_.y, grid_rows_);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+std::optional<float> ObjectPicker::intersect(const Entry& entry, const glm::vec3& origin,
+                                             const glm::vec3& dir, float z_min,
+                                             float z_max) const {
+    float lo_z = std::max(z_min, entry.z_min);
+    float hi_z = std::min(z_max, entry.z_max);
+    if (lo_z > hi_z) {
+        return std::nullopt; // Object is entirely outside the visible layers
+    }
+
+    // Slab test against the prism's bounding box (t in [0, 1] spans near..far plane)
+    const glm::vec3 box_min(entry.min, lo_z);
+    const glm::vec3 box_max(entry.max, hi_z);
+    float t_enter = 0.0f;
+    float t_exit = 1.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (std::abs(dir[axis]) < EPSILON) {
+            if (origin[axis] < box_min[axis] || origin[axis] > box_max[axis]) {
+                return std::nullopt;
+            }
+            continue;
+        }
+        float t1 = (box_min[axis] - origin[axis]) / dir[axis];
+        float t2 = (box_max[axis] - origin[axis]) / dir[axis];
+        t_enter = std::max(t_enter, std::min(t1, t2));
+        t_exit = std::min(t_exit, std::max(t1, t2));
+        if (t_enter > t_exit) {
+            return std::nullopt;
+        }
+    }
+
+    // Within the box the prism's Z range is constant, so the exact hit is where
+    // the ray's XY shadow first enters the footprint
+    glm::vec2 a(origin + dir * t_enter);
+    glm::vec2 b(origin + dir * t_exit);
+    auto u = first_polygon_hit(a, b, entry.footprint);
+    if (!u) {
+        return std::nullopt;
+    }
+    return t_enter + *u * (t_exit - t_enter);
+}
+
+std::optional<std::string> ObjectPicker::pick(const glm::vec2& screen_pos,
+                                              const glm::mat4& view_projection,
+                                              const glm::vec2& viewport_size, float z_min,
+                                              float z_max, float threshold_px) const {
+    if (entries_.empty() || viewport_size.x <= 0.0f || viewport_size.y <= 0.0f) {
+        return std::nullopt;
+    }
+
+    // Unproject the tap to a ray from the near plane (t=0) to the far plane (t=1)
+    glm::mat4 inverse = glm::inverse(view_projection);
+    float ndc_x = 2.0f * screen_pos.x / viewport_size.x - 1.0f;
+    float ndc_y = 1.0f - 2.0f * screen_pos.y / viewport_size.y;
+    glm::vec4 near_h = inverse * glm::vec4(ndc_x, ndc_y, -1.0f, 1.0f);
+    glm::vec4 far_h = inverse * glm::vec4(ndc_x, ndc_y, 1.0f, 1.0f);
+    if (std::abs(near_h.w) < EPSILON || std::abs(far_h.w) < EPSILON) {
+        return std::nullopt;
+    }
+    glm::vec3 origin = glm::vec3(near_h) / near_h.w;
+    glm::vec3 dir = glm::vec3(far_h) / far_h.w - origin;
+
+    // Candidate objects: grid cells under the ray's XY shadow within the visible Z range
+    float t_lo = 0.0f;
+    float t_hi = 1.0f;
+    if (std::abs(dir.z) >= EPSILON) {
+        float t1 = (z_min - origin.z) / dir.z;
+        float t2 = (z_max - origin.z) / dir.z;
+        t_lo = std::max(t_lo, std::min(t1, t2));
+        t_hi = std::min(t_hi, std::max(t1, t2));
+    } else if (origin.z < z_min || origin.z > z_max) {
+        t_hi = -1.0f; // Horizontal ray outside the visible layers
+    }
+
+    std::optional<size_t> best;
+    float best_t = std::numeric_limits<float>::max();
+    if (t_lo <= t_hi) {
+        glm::vec2 a(origin + dir * t_lo);
+        glm::vec2 b(origin + dir * t_hi);
+        int x0, y0, x1, y1;
+        cell_range(glm::min(a, b), glm::max(a, b), x0, y0, x1, y1);
+
+        std::vector<bool> tested(entries_.size(), false);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                for (uint16_t index : cells_[static_cast<size_t>(y * grid_cols_ + x)]) {
+                    if (tested[index]) {
+                        continue;
+                    }
+                    tested[index] = true;
+                    auto t = intersect(entries_[index], origin, dir, z_min, z_max);
+                    if (t && *t < best_t) {
+                        best_t = *t;
+                        best = index;
+                    }
+                }
+            }
+        }
+    }
+
+    if (best) {
+        return entries_[*best].name;
+    }
+
+    // Near miss: closest outline (top face at the highest visible Z) within the threshold
+    float best_distance = threshold_px;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const Entry& entry = entries_[i];
+        float top_z = std::min(z_max, entry.z_max);
+        if (top_z < std::max(z_min, entry.z_min)) {
+            continue;
+        }
+
+        std::vector<std::optional<glm::vec2>> projected;
+        projected.reserve(entry.footprint.size());
+        for (const auto& point : entry.footprint) {
+            glm::vec4 clip = view_projection * glm::vec4(point, top_z, 1.0f);
+            if (clip.w < EPSILON) {
+                projected.emplace_back(); // Behind the camera
+                continue;
+            }
+            glm::vec2 ndc = glm::vec2(clip) / clip.w;
+            projected.emplace_back(glm::vec2((ndc.x + 1.0f) * 0.5f * viewport_size.x,
+                                             (1.0f - ndc.y) * 0.5f * viewport_size.y));
+        }
+
+        for (size_t k = 0, j = projected.size() - 1; k < projected.size(); j = k++) {
+            if (!projected[j] || !projected[k]) {
+                continue;
+            }
+            float distance = distance_to_segment(screen_pos, *projected[j], *projected[k]);
+            if (distance < best_distance) {
+                best_distance = distance;
+                best = i;
+            }
+        }
+    }
+
+    if (best) {
+        return entries_[*best].name;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> ObjectPicker::pick_at(const glm::vec2& bed_xy) const {
+    if (entries_.empty()) {
+        return std::nullopt;
+    }
+
+    int x0, y0, x1, y1;
+    cell_range(bed_xy, bed_xy, x0, y0, x1, y1);
+    for (uint16_t index : cells_[static_cast<size_t>(y0 * grid_cols_ + x0)]) {
+        const Entry& entry = entries_[index];
+        if (bed_xy.x >= entry.min.x && bed_xy.x <= entry.max.x && bed_xy.y >= entry.min.y &&
+            bed_xy.y <= entry.max.y && point_in_polygon(bed_xy, entry.footprint)) {
+            return entry.name;
+        }
+    }
+    return std::nullopt;
+}
+
+bool ObjectPicker::visible_z_range(const ParsedGCodeFile& gcode, int layer_start, int layer_end,
+                                   float& z_min, float& z_max) {
+    const int count = static_cast<int>(gcode.layers.size());
+    if (layer_end < 0 || layer_end >= count) {
+        layer_end = count - 1;
+    }
+    layer_start = std::max(layer_start, 0);
+    if (layer_start > layer_end) {
+        return false;
+    }
+
+    z_min = (layer_start > 0) ? gcode.layers[static_cast<size_t>(layer_start - 1)].z_height
+                              : std::min(0.0f, gcode.layers.front().z_height);
+    z_max = gcode.layers[static_cast<size_t>(layer_end)].z_height;
+    return true;
+}
+
+} // namespace gcode
+} // namespace helix
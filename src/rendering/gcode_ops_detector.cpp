@@ -156,37 +156,65 @@ ScanResult GCodeOpsDetector::scan_content(const std::string& content) const {
     return scan_stream(stream);
 }
 
+namespace {
+
+/// "; thumbnail begin 300x300 12345", "; thumbnail_JPG end", ...
+bool is_thumbnail_marker(const std::string& line, const char* keyword) {
+    return line.compare(0, 11, "; thumbnail") == 0 && line.find(keyword, 11) != std::string::npos;
+}
+
+} // namespace
+
 ScanResult GCodeOpsDetector::scan_stream(std::istream& stream) const {
     ScanResult result;
     std::string line;
     size_t line_number = 0;
     size_t byte_offset = 0;
 
+    // Embedded thumbnails are hundreds of base64 lines at the top of the file;
+    // they do not count towards the limits so they cannot hide START_PRINT
+    bool in_thumbnail = false;
+    size_t thumbnail_lines = 0;
+    size_t thumbnail_bytes = 0;
+
+    result.reached_end = true;
     while (std::getline(stream, line)) {
         line_number++;
 
+        if (in_thumbnail || is_thumbnail_marker(line, " begin")) {
+            in_thumbnail = !is_thumbnail_marker(line, " end");
+            thumbnail_lines++;
+            thumbnail_bytes += line.size() + 1;
+            byte_offset += line.size() + 1;
+            continue;
+        }
+
         // Check limits
-        if (byte_offset >= config_.max_scan_bytes) {
+        if (byte_offset - thumbnail_bytes >= config_.max_scan_bytes) {
             spdlog::debug("[GCodeOpsDetector] Reached byte limit at {} bytes", byte_offset);
             result.reached_limit = true;
+            result.reached_end = false;
             break;
         }
 
-        if (static_cast<int>(line_number) > config_.max_scan_lines) {
+        if (static_cast<int>(line_number - thumbnail_lines) > config_.max_scan_lines) {
             spdlog::debug("[GCodeOpsDetector] Reached line limit at line {}", line_number);
             result.reached_limit = true;
+            result.reached_end = false;
             break;
         }
 
         // Check for first extrusion (stop scanning)
         if (config_.stop_at_first_extrusion && is_first_extrusion(line)) {
             spdlog::debug("[GCodeOpsDetector] First extrusion at line {}, stopping", line_number);
+            result.reached_end = false;
             break;
         }
 
         // Check for layer marker (stop scanning)
         if (config_.stop_at_layer_marker && is_layer_marker(line)) {
             spdlog::debug("[GCodeOpsDetector] Layer marker at line {}, stopping", line_number);
+            result.reached_end = false;
             break;
         }
 
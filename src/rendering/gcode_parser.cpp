@@ -72,6 +72,7 @@ void GCodeParser::reset() {
     is_absolute_extrusion_ = true;
     layers_.clear();
     objects_.clear();
+    segment_objects_.clear();
     global_bounds_ = AABB();
     lines_parsed_ = 0;
     out_of_range_width_count_ = 0;
@@ -197,84 +198,98 @@ bool GCodeParser::parse_movement_command(const std::string& line) {
     return has_movement;
 }
 
-bool GCodeParser::parse_exclude_object_command(const std::string& line) {
+bool GCodeParser::parse_object_definition(const std::string& line, GCodeObject& out) {
     // EXCLUDE_OBJECT_DEFINE NAME=... CENTER=... POLYGON=...
-    if (line.find("EXCLUDE_OBJECT_DEFINE") == 0) {
-        std::string name;
-        if (!extract_string_param(line, "NAME", name)) {
-            return false;
-        }
+    if (line.find("EXCLUDE_OBJECT_DEFINE") != 0) {
+        return false;
+    }
 
-        GCodeObject obj;
-        obj.name = name;
-
-        // Extract CENTER (format: "X,Y")
-        std::string center_str;
-        if (extract_string_param(line, "CENTER", center_str)) {
-            size_t comma = center_str.find(',');
-            if (comma != std::string::npos) {
-                try {
-                    obj.center.x = std::stof(center_str.substr(0, comma));
-                    obj.center.y = std::stof(center_str.substr(comma + 1));
-                } catch (...) {
-                    // Internal parsing error - no user notification needed
-                    spdlog::debug("[GCode Parser] Failed to parse CENTER for object: {}", name);
-                }
+    std::string name;
+    if (!extract_string_param(line, "NAME", name)) {
+        return false;
+    }
+
+    GCodeObject obj;
+    obj.name = name;
+
+    // Extract CENTER (format: "X,Y")
+    std::string center_str;
+    if (extract_string_param(line, "CENTER", center_str)) {
+        size_t comma = center_str.find(',');
+        if (comma != std::string::npos) {
+            try {
+                obj.center.x = std::stof(center_str.substr(0, comma));
+                obj.center.y = std::stof(center_str.substr(comma + 1));
+            } catch (...) {
+                // Internal parsing error - no user notification needed
+                spdlog::debug("[GCode Parser] Failed to parse CENTER for object: {}", name);
             }
         }
+    }
 
-        // Extract POLYGON (format: "[[x1,y1],[x2,y2],...]")
-        // For now, we'll do basic parsing - full JSON parsing would be better
-        std::string polygon_str;
-        if (extract_string_param(line, "POLYGON", polygon_str)) {
-            // Simple extraction of number pairs
-            // Remove all whitespace first for easier parsing
-            polygon_str.erase(std::remove_if(polygon_str.begin(), polygon_str.end(), ::isspace),
-                              polygon_str.end());
-
-            // Skip outer opening bracket if present
-            size_t pos = 0;
-            if (!polygon_str.empty() && polygon_str[0] == '[') {
-                pos = 1;
-            }
+    // Extract POLYGON (format: "[[x1,y1],[x2,y2],...]")
+    // For now, we'll do basic parsing - full JSON parsing would be better
+    std::string polygon_str;
+    if (extract_string_param(line, "POLYGON", polygon_str)) {
+        // Simple extraction of number pairs
+        // Remove all whitespace first for easier parsing
+        polygon_str.erase(std::remove_if(polygon_str.begin(), polygon_str.end(), ::isspace),
+                          polygon_str.end());
 
-            while (pos < polygon_str.length()) {
-                // Find opening bracket for this point
-                if (polygon_str[pos] == '[') {
-                    pos++;
-                    // Extract x coordinate (everything until comma)
-                    size_t comma = polygon_str.find(',', pos);
-                    if (comma != std::string::npos) {
-                        try {
-                            float x = std::stof(polygon_str.substr(pos, comma - pos));
-                            pos = comma + 1;
-
-                            // Extract y coordinate (everything until closing bracket)
-                            size_t close = polygon_str.find(']', pos);
-                            if (close != std::string::npos) {
-                                float y = std::stof(polygon_str.substr(pos, close - pos));
-                                obj.polygon.push_back(glm::vec2(x, y));
-                                pos = close + 1;
-                                spdlog::trace("[GCode Parser] Parsed polygon point: ({}, {})", x,
-                                              y);
-                            } else {
-                                break;
-                            }
-                        } catch (...) {
+        // Skip outer opening bracket if present
+        size_t pos = 0;
+        if (!polygon_str.empty() && polygon_str[0] == '[') {
+            pos = 1;
+        }
+
+        while (pos < polygon_str.length()) {
+            // Find opening bracket for this point
+            if (polygon_str[pos] == '[') {
+                pos++;
+                // Extract x coordinate (everything until comma)
+                size_t comma = polygon_str.find(',', pos);
+                if (comma != std::string::npos) {
+                    try {
+                        float x = std::stof(polygon_str.substr(pos, comma - pos));
+                        pos = comma + 1;
+
+                        // Extract y coordinate (everything until closing bracket)
+                        size_t close = polygon_str.find(']', pos);
+                        if (close != std::string::npos) {
+                            float y = std::stof(polygon_str.substr(pos, close - pos));
+                            obj.polygon.push_back(glm::vec2(x, y));
+                            pos = close + 1;
+                            spdlog::trace("[GCode Parser] Parsed polygon point: ({}, {})", x, y);
+                        } else {
                             break;
                         }
-                    } else {
+                    } catch (...) {
                         break;
                     }
                 } else {
-                    pos++;
+                    break;
                 }
+            } else {
+                pos++;
             }
         }
+    }
 
-        objects_[name] = obj;
-        spdlog::debug("[GCode Parser] Defined object: {} at ({}, {})", name, obj.center.x,
+    out = std::move(obj);
+    return true;
+}
+
+bool GCodeParser::parse_exclude_object_command(const std::string& line) {
+    // EXCLUDE_OBJECT_DEFINE NAME=... CENTER=... POLYGON=...
+    if (line.find("EXCLUDE_OBJECT_DEFINE") == 0) {
+        GCodeObject obj;
+        if (!parse_object_definition(line, obj)) {
+            return false;
+        }
+
+        spdlog::debug("[GCode Parser] Defined object: {} at ({}, {})", obj.name, obj.center.x,
                       obj.center.y);
+        objects_[obj.name] = std::move(obj);
         return true;
     }
     // EXCLUDE_OBJECT_START NAME=...
@@ -787,6 +802,14 @@ void GCodeParser::add_segment(const glm::vec3& start, const glm::vec3& end, bool
                 current_object_, start.x, start.y, start.z, end.x, end.y, end.z);
         }
     }
+
+    // Objects without a definition are still pickable by their extruded extent
+    if (is_extrusion && !segment.object_name.empty() && objects_.count(segment.object_name) == 0) {
+        GCodeObject& object = segment_objects_[segment.object_name];
+        object.name = segment.object_name;
+        object.bounding_box.expand(start);
+        object.bounding_box.expand(end);
+    }
 }
 
 void GCodeParser::start_new_layer(float z) {
@@ -835,6 +858,7 @@ ParsedGCodeFile GCodeParser::finalize() {
     result.filename = "";
     result.layers = std::move(layers_);
     result.objects = std::move(objects_);
+    result.segment_objects = std::move(segment_objects_);
     result.global_bounding_box = global_bounds_;
 
     // Calculate statistics
@@ -1175,15 +1199,7 @@ std::string get_cached_thumbnail(const std::string& gcode_path, const std::strin
     return ""; // No thumbnail available
 }
 
-namespace {
-
-/**
- * @brief Parse a single metadata comment line and update metadata struct
- * @param line Comment line starting with ';'
- * @param metadata Metadata struct to update
- * @return true if line was a valid metadata comment
- */
-bool parse_metadata_line(const std::string& line, GCodeHeaderMetadata& metadata) {
+bool parse_header_metadata_line(const std::string& line, GCodeHeaderMetadata& metadata) {
     // Skip if not a comment line
     if (line.empty() || line[0] != ';') {
         return false;
@@ -1399,6 +1415,8 @@ bool parse_metadata_line(const std::string& line, GCodeHeaderMetadata& metadata)
     return true;
 }
 
+namespace {
+
 /**
  * @brief Read the last N bytes of a file and extract lines
  * @param filepath Path to the file
@@ -1478,7 +1496,7 @@ GCodeHeaderMetadata extract_header_metadata(const std::string& filepath) {
             continue;
         }
 
-        parse_metadata_line(line, metadata);
+        parse_header_metadata_line(line, metadata);
     }
 
     file.close();
@@ -1492,7 +1510,7 @@ GCodeHeaderMetadata extract_header_metadata(const std::string& filepath) {
         if (footer_line.empty() || footer_line[0] != ';') {
             continue;
         }
-        parse_metadata_line(footer_line, metadata);
+        parse_header_metadata_line(footer_line, metadata);
     }
 
     return metadata;
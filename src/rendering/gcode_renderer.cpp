@@ -468,74 +468,23 @@ void GCodeRenderer::draw_line(lv_layer_t* layer, const glm::vec2& p1, const glm:
 std::optional<std::string> GCodeRenderer::pick_object(const glm::vec2& screen_pos,
                                                       const ParsedGCodeFile& gcode,
                                                       const GCodeCamera& camera) const {
-    // Segment-based picking: find closest rendered segment to click point
-    // This works even without EXCLUDE_OBJECT metadata by checking segment.object_name
-
-    glm::mat4 transform = camera.get_view_projection_matrix();
-    float closest_distance = std::numeric_limits<float>::max();
-    std::optional<std::string> picked_object;
-
-    const float PICK_THRESHOLD = 15.0f; // pixels - how close to segment to register click
-
-    // Iterate through visible layers
-    int layer_start = options_.layer_start;
-    int layer_end =
-        (options_.layer_end < 0 || options_.layer_end >= static_cast<int>(gcode.layers.size()))
-            ? static_cast<int>(gcode.layers.size()) - 1
-            : options_.layer_end;
-
-    for (int layer_idx = layer_start; layer_idx <= layer_end; ++layer_idx) {
-        if (layer_idx < 0 || layer_idx >= static_cast<int>(gcode.layers.size())) {
-            continue;
-        }
-
-        const Layer& layer = gcode.layers[static_cast<size_t>(layer_idx)];
-
-        for (const auto& segment : layer.segments) {
-            // Only check segments that would be rendered
-            if (!should_render_segment(segment)) {
-                continue;
-            }
-
-            // Skip segments without object names
-            if (segment.object_name.empty()) {
-                continue;
-            }
-
-            // Project segment endpoints to screen space
-            auto start_screen = project_to_screen(segment.start, transform);
-            auto end_screen = project_to_screen(segment.end, transform);
-
-            // Skip if either endpoint is off-screen
-            if (!start_screen || !end_screen) {
-                continue;
-            }
-
-            // Calculate distance from click point to line segment
-            glm::vec2 v = *end_screen - *start_screen;
-            glm::vec2 w = screen_pos - *start_screen;
-
-            // Project click onto line segment (clamped to [0,1])
-            float segment_length_sq = glm::dot(v, v);
-            float t = (segment_length_sq > 0.0001f)
-                          ? std::clamp(glm::dot(w, v) / segment_length_sq, 0.0f, 1.0f)
-                          : 0.0f;
-
-            // Closest point on segment to click
-            glm::vec2 closest_point = *start_screen + t * v;
-
-            // Distance from click to closest point on segment
-            float dist = glm::length(screen_pos - closest_point);
+    // Objects are drawn by their extrusions; travels alone don't make them visible
+    if (!options_.show_extrusions) {
+        return std::nullopt;
+    }
 
-            // Update if this is the closest segment within threshold
-            if (dist < PICK_THRESHOLD && dist < closest_distance) {
-                closest_distance = dist;
-                picked_object = segment.object_name;
-            }
-        }
+    float z_min = 0.0f;
+    float z_max = 0.0f;
+    if (!ObjectPicker::visible_z_range(gcode, options_.layer_start, options_.layer_end, z_min,
+                                       z_max)) {
+        return std::nullopt;
     }
 
-    return picked_object;
+    object_picker_.sync(gcode);
+    return object_picker_.pick(
+        screen_pos, camera.get_view_projection_matrix(),
+        glm::vec2(static_cast<float>(viewport_width_), static_cast<float>(viewport_height_)),
+        z_min, z_max);
 }
 
 } // namespace gcode
@@ -3,8 +3,10 @@
 
 #include "gcode_streaming_controller.h"
 
+#include "gcode_analysis_service.h"
 #include "memory_monitor.h"
 #include "memory_utils.h"
+#include "scoped_trace.h"
 
 #include <spdlog/spdlog.h>
 
@@ -92,6 +94,7 @@ void BackgroundGhostBuilder::notify_user_request() {
 
 void BackgroundGhostBuilder::worker_thread() {
     spdlog::debug("[GhostBuilder] Worker thread started");
+    helix::trace::set_thread_name("gcode-ghost-builder");
 
     size_t total = total_layers_.load();
 
@@ -110,6 +113,7 @@ void BackgroundGhostBuilder::worker_thread() {
         }
 
         // Load layer segments - hold shared_ptr to keep data alive during callback
+        HELIX_TRACE_SCOPE("gcode", "ghost_layer");
         auto segments = controller_->get_layer_segments(i);
         if (segments && render_callback_) {
             render_callback_(i, *segments);
@@ -134,6 +138,7 @@ void BackgroundGhostBuilder::worker_thread() {
 
 // Static member initialization
 const LayerIndexStats GCodeStreamingController::empty_stats_{};
+const std::map<std::string, GCodeObject> GCodeStreamingController::empty_objects_{};
 
 // =============================================================================
 // Construction / Destruction
@@ -460,6 +465,13 @@ const LayerIndexStats& GCodeStreamingController::get_index_stats() const {
     return empty_stats_;
 }
 
+const std::map<std::string, GCodeObject>& GCodeStreamingController::get_objects() const {
+    if (index_.is_valid()) {
+        return index_.get_objects();
+    }
+    return empty_objects_;
+}
+
 size_t GCodeStreamingController::get_file_size() const {
     return data_source_ ? data_source_->file_size() : 0;
 }
@@ -588,7 +600,18 @@ bool GCodeStreamingController::build_index() {
     std::string file_path = data_source_->indexable_file_path();
 
     if (!file_path.empty()) {
-        return index_.build_from_file(file_path);
+        // Shared single-pass analysis: a file opened before (this session or
+        // an earlier one) restores its index from the analysis cache
+        auto analysis = GCodeAnalysisService::instance().analyze(file_path);
+        if (!analysis) {
+            return false;
+        }
+        analysis->restore_index(index_);
+
+        std::lock_guard<std::mutex> lock(metadata_mutex_);
+        header_metadata_ = std::make_unique<GCodeHeaderMetadata>(analysis->metadata);
+        metadata_extracted_ = true;
+        return !analysis->layers.empty();
     }
 
     // Sources without file path (e.g., MemoryDataSource) cannot be indexed
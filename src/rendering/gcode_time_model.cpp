@@ -0,0 +1,273 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_time_model.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+constexpr float MIN_MOVE_MM = 1e-6f;
+
+/// Smallest table spacing: finer than this only costs memory
+constexpr uint64_t MIN_BUCKET_BYTES = 1024;
+
+float limit_or(double value, double fallback) {
+    return static_cast<float>(value > 0.0 ? value : fallback);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// PrintTimeTable
+// ============================================================================
+
+float PrintTimeTable::elapsed_at(uint64_t file_position) const {
+    if (elapsed_s.empty() || bucket_bytes == 0) {
+        return 0.0f;
+    }
+    uint64_t k = file_position / bucket_bytes;
+    if (k + 1 >= elapsed_s.size()) {
+        return elapsed_s.back();
+    }
+    float frac = static_cast<float>(file_position - k * bucket_bytes) /
+                 static_cast<float>(bucket_bytes);
+    return elapsed_s[k] + (elapsed_s[k + 1] - elapsed_s[k]) * frac;
+}
+
+float PrintTimeTable::remaining_at(uint64_t file_position) const {
+    return std::max(0.0f, total_s() - elapsed_at(file_position));
+}
+
+// ============================================================================
+// PrintTimeEstimator
+// ============================================================================
+
+MachineLimits PrintTimeEstimator::default_limits() {
+    // Klipper's example printer.cfg values
+    MachineLimits limits;
+    limits.max_velocity = 300.0;
+    limits.max_accel = 3000.0;
+    limits.square_corner_velocity = 5.0;
+    limits.max_z_velocity = 15.0;
+    limits.max_z_accel = 100.0;
+    return limits;
+}
+
+PrintTimeEstimator::PrintTimeEstimator(const MachineLimits& limits, uint64_t file_size)
+    : file_size_(file_size) {
+    MachineLimits defaults = default_limits();
+    max_velocity_ = limit_or(limits.max_velocity, defaults.max_velocity);
+    max_accel_ = limit_or(limits.max_accel, defaults.max_accel);
+    max_z_velocity_ = limit_or(limits.max_z_velocity, defaults.max_z_velocity);
+    max_z_accel_ = limit_or(limits.max_z_accel, defaults.max_z_accel);
+    square_corner_velocity_ =
+        limit_or(limits.square_corner_velocity, defaults.square_corner_velocity);
+    update_junction_deviation();
+
+    uint64_t samples = MAX_TABLE_SAMPLES - 1;
+    table_.bucket_bytes = std::max(MIN_BUCKET_BYTES, (file_size + samples - 1) / samples);
+    table_.elapsed_s.reserve(static_cast<size_t>(file_size / table_.bucket_bytes) + 2);
+
+    for (auto* v : {&distance_, &accel_, &cruise_v2_, &junction_v2_}) {
+        v->reserve(LOOKAHEAD_MOVES);
+    }
+    offset_.reserve(LOOKAHEAD_MOVES);
+    layer_.reserve(LOOKAHEAD_MOVES);
+}
+
+void PrintTimeEstimator::update_junction_deviation() {
+    // Same as Klipper's toolhead: the deviation that makes a 90 degree corner
+    // run at square_corner_velocity
+    junction_deviation_ = square_corner_velocity_ * square_corner_velocity_ *
+                          (std::sqrt(2.0f) - 1.0f) / max_accel_;
+}
+
+void PrintTimeEstimator::set_accel(float accel) {
+    if (accel > 0.0f) {
+        max_accel_ = accel;
+        update_junction_deviation();
+    }
+}
+
+void PrintTimeEstimator::set_max_velocity(float velocity) {
+    if (velocity > 0.0f) {
+        max_velocity_ = velocity;
+    }
+}
+
+void PrintTimeEstimator::set_square_corner_velocity(float scv) {
+    if (scv >= 0.0f) {
+        square_corner_velocity_ = scv;
+        update_junction_deviation();
+    }
+}
+
+void PrintTimeEstimator::add_move(float dx, float dy, float dz, float de, float feedrate,
+                                  uint64_t file_offset, uint32_t layer) {
+    float xyz = std::sqrt(dx * dx + dy * dy + dz * dz);
+    bool kinematic = xyz >= MIN_MOVE_MM;
+    float distance = kinematic ? xyz : std::fabs(de);
+    if (distance < MIN_MOVE_MM || feedrate <= 0.0f) {
+        return;
+    }
+
+    float velocity = std::min(feedrate, max_velocity_);
+    float accel = max_accel_;
+    if (kinematic && dz != 0.0f) {
+        // Cartesian Z limits, scaled to the move's share of Z travel
+        float z_ratio = distance / std::fabs(dz);
+        velocity = std::min(velocity, max_z_velocity_ * z_ratio);
+        accel = std::min(accel, max_z_accel_ * z_ratio);
+    }
+    float cruise_v2 = velocity * velocity;
+
+    // Entry speed through the corner from the previous move (Klipper's
+    // "approximated centripetal velocity"); extrude-only moves start at rest
+    float junction_v2 = 0.0f;
+    float dir[3] = {0.0f, 0.0f, 0.0f};
+    if (kinematic) {
+        dir[0] = dx / distance;
+        dir[1] = dy / distance;
+        dir[2] = dz / distance;
+    }
+    if (kinematic && have_prev_) {
+        float cos_theta =
+            -(dir[0] * prev_dir_[0] + dir[1] * prev_dir_[1] + dir[2] * prev_dir_[2]);
+        float sin_theta_d2 = std::sqrt(std::max(0.5f * (1.0f - cos_theta), 0.0f));
+        float cos_theta_d2 = std::sqrt(std::max(0.5f * (1.0f + cos_theta), 0.0f));
+        junction_v2 = std::min(cruise_v2, prev_cruise_v2_);
+        float one_minus_sin_theta_d2 = 1.0f - sin_theta_d2;
+        if (one_minus_sin_theta_d2 > 0.0f && cos_theta_d2 > 0.0f) {
+            float r_jd = sin_theta_d2 / one_minus_sin_theta_d2;
+            float quarter_tan_theta_d2 = 0.25f * sin_theta_d2 / cos_theta_d2;
+            junction_v2 = std::min({junction_v2, r_jd * junction_deviation_ * accel,
+                                    r_jd * prev_junction_deviation_ * prev_accel_,
+                                    2.0f * distance * accel * quarter_tan_theta_d2,
+                                    2.0f * prev_distance_ * prev_accel_ * quarter_tan_theta_d2});
+        }
+    }
+
+    distance_.push_back(distance);
+    accel_.push_back(accel);
+    cruise_v2_.push_back(cruise_v2);
+    junction_v2_.push_back(junction_v2);
+    offset_.push_back(file_offset);
+    layer_.push_back(layer);
+
+    have_prev_ = kinematic;
+    if (kinematic) {
+        std::copy(dir, dir + 3, prev_dir_);
+        prev_cruise_v2_ = cruise_v2;
+        prev_accel_ = accel;
+        prev_distance_ = distance;
+        prev_junction_deviation_ = junction_deviation_;
+    }
+
+    if (distance_.size() >= LOOKAHEAD_MOVES) {
+        plan(false);
+    }
+}
+
+void PrintTimeEstimator::add_dwell(float seconds, uint64_t file_offset, uint32_t layer) {
+    plan(true);
+    if (seconds > 0.0f) {
+        commit(seconds, file_offset, layer);
+    }
+}
+
+void PrintTimeEstimator::plan(bool final_stop) {
+    const size_t n = distance_.size();
+    if (n == 0) {
+        return;
+    }
+    start_v2_.resize(n);
+    end_v2_.resize(n);
+    time_s_.resize(n);
+
+    const float* d = distance_.data();
+    const float* a = accel_.data();
+    const float* c2 = cruise_v2_.data();
+    float* s2 = start_v2_.data();
+    float* e2 = end_v2_.data();
+    float* t = time_s_.data();
+
+    // Backward: the fastest each move may start and still slow down for the
+    // rest of the buffer, which ends at rest
+    float next_start_v2 = 0.0f;
+    for (size_t i = n; i-- > 0;) {
+        e2[i] = next_start_v2;
+        s2[i] = std::min(junction_v2_[i], e2[i] + 2.0f * a[i] * d[i]);
+        next_start_v2 = s2[i];
+    }
+
+    // Forward: the fastest each move can reach from its entry speed
+    s2[0] = std::min(s2[0], carry_v2_);
+    for (size_t i = 0; i < n; ++i) {
+        e2[i] = std::min(e2[i], s2[i] + 2.0f * a[i] * d[i]);
+        if (i + 1 < n) {
+            s2[i + 1] = e2[i];
+        }
+    }
+
+    // Trapezoid duration of every move (branch-free so it vectorizes)
+    for (size_t i = 0; i < n; ++i) {
+        float peak_v2 = std::min(c2[i], 0.5f * (s2[i] + e2[i]) + a[i] * d[i]);
+        float peak_v = std::sqrt(peak_v2);
+        float ramp_d = (2.0f * peak_v2 - s2[i] - e2[i]) / (2.0f * a[i]);
+        float cruise_d = std::max(0.0f, d[i] - ramp_d);
+        t[i] = (2.0f * peak_v - std::sqrt(s2[i]) - std::sqrt(e2[i])) / a[i] + cruise_d / peak_v;
+    }
+
+    // Keep the tail: its end speeds depend on moves not read yet
+    size_t done = final_stop ? n : n - std::min(n, LOOKAHEAD_TAIL);
+    for (size_t i = 0; i < done; ++i) {
+        commit(t[i], offset_[i], layer_[i]);
+    }
+
+    if (final_stop) {
+        carry_v2_ = 0.0f;
+        have_prev_ = false;
+    } else if (done < n) {
+        carry_v2_ = s2[done];
+    }
+
+    auto drop = [done](auto& v) { v.erase(v.begin(), v.begin() + static_cast<long>(done)); };
+    drop(distance_);
+    drop(accel_);
+    drop(cruise_v2_);
+    drop(junction_v2_);
+    drop(offset_);
+    drop(layer_);
+}
+
+void PrintTimeEstimator::commit(float seconds, uint64_t file_offset, uint32_t layer) {
+    // Samples at or before this line's offset precede it
+    while (table_.elapsed_s.size() * table_.bucket_bytes <= file_offset) {
+        table_.elapsed_s.push_back(static_cast<float>(elapsed_));
+    }
+    elapsed_ += seconds;
+
+    if (layer != NO_LAYER) {
+        if (layer >= layer_durations_.size()) {
+            layer_durations_.resize(layer + 1, 0.0f);
+        }
+        layer_durations_[layer] += seconds;
+    }
+}
+
+void PrintTimeEstimator::finish() {
+    plan(true);
+    // Through the sample at or past the end of the file, which is the total
+    uint64_t last = (file_size_ + table_.bucket_bytes - 1) / table_.bucket_bytes;
+    while (table_.elapsed_s.size() <= last) {
+        table_.elapsed_s.push_back(static_cast<float>(elapsed_));
+    }
+}
+
+} // namespace gcode
+} // namespace helix
@@ -6,8 +6,10 @@
 #ifdef ENABLE_TINYGL_3D
 
 #include "config.h"
+#include "logging_init.h"
 #include "memory_monitor.h"
 #include "runtime_config.h"
+#include "ui_utils.h"
 
 #include <spdlog/spdlog.h>
 
@@ -23,6 +25,34 @@ extern "C" {
 namespace helix {
 namespace gcode {
 
+namespace {
+
+/// Highlighted objects are brightened to stand out from the rest of the model
+constexpr float HIGHLIGHT_BRIGHTNESS = 1.8f;
+
+/// Excluded objects are blended toward red and darkened
+constexpr uint32_t EXCLUDED_TINT_RGB = 0xD32F2F;
+constexpr float EXCLUDED_TINT_AMOUNT = 0.6f;
+constexpr float EXCLUDED_BRIGHTNESS = 0.6f;
+
+uint32_t scale_rgb(uint32_t rgb, float factor) {
+    auto channel = [factor](uint32_t c) {
+        return static_cast<uint32_t>(std::min(255.0f, static_cast<float>(c & 0xFF) * factor));
+    };
+    return (channel(rgb >> 16) << 16) | (channel(rgb >> 8) << 8) | channel(rgb);
+}
+
+uint32_t blend_rgb(uint32_t from, uint32_t to, float amount) {
+    auto channel = [from, to, amount](int shift) {
+        float a = static_cast<float>((from >> shift) & 0xFF);
+        float b = static_cast<float>((to >> shift) & 0xFF);
+        return static_cast<uint32_t>(a + (b - a) * amount) << shift;
+    };
+    return channel(16) | channel(8) | channel(0);
+}
+
+} // namespace
+
 GCodeTinyGLRenderer::GCodeTinyGLRenderer()
     : geometry_builder_(std::make_unique<GeometryBuilder>()) {
     // Set default configuration
@@ -114,6 +144,10 @@ void GCodeTinyGLRenderer::set_interaction_mode(bool interacting) {
 void GCodeTinyGLRenderer::set_filament_color(const std::string& hex_color) {
     geometry_builder_->set_filament_color(hex_color);
     geometry_builder_->set_use_height_gradient(false);
+
+    // Loaded geometry is recolored through its filament palette slot
+    filament_color_override_ = ui_parse_hex_color(hex_color);
+    invalidate_object_palettes();
 }
 
 void GCodeTinyGLRenderer::set_smooth_shading(bool enable) {
@@ -536,12 +570,6 @@ void GCodeTinyGLRenderer::build_geometry(const ParsedGCodeFile& gcode) {
                       show_extrusions_);
     }
 
-    // Configure highlighted objects (segments will be brightened)
-    geometry_builder_->set_highlighted_objects(highlighted_objects_);
-    if (!highlighted_objects_.empty()) {
-        spdlog::debug("[GCode TinyGL] Highlighting {} objects", highlighted_objects_.size());
-    }
-
     // Configure multi-color support: pass tool color palette from parsed G-code
     if (!gcode.tool_color_palette.empty()) {
         geometry_builder_->set_tool_color_palette(gcode.tool_color_palette);
@@ -552,6 +580,7 @@ void GCodeTinyGLRenderer::build_geometry(const ParsedGCodeFile& gcode) {
     // Build optimized ribbon geometry
     geometry_ = geometry_builder_->build(filtered_gcode, simplification_);
     current_gcode_filename_ = gcode.filename;
+    palettes_.dirty = true;
 
     const auto& stats = geometry_builder_->last_stats();
     spdlog::info("[GCode TinyGL] Geometry built: {} vertices, {} triangles, {:.2f} MB",
@@ -572,6 +601,7 @@ void GCodeTinyGLRenderer::set_prebuilt_geometry(std::unique_ptr<RibbonGeometry>
 
     geometry_ = std::move(*geometry); // Move the value from unique_ptr into optional
     current_gcode_filename_ = filename;
+    palettes_.dirty = true;
 
     // Invalidate cached framebuffer - new geometry requires full re-render
     framebuffer_valid_ = false;
@@ -598,6 +628,7 @@ void GCodeTinyGLRenderer::set_prebuilt_coarse_geometry(std::unique_ptr<RibbonGeo
         full_tris > 0 ? 100.0f * (1.0f - float(coarse_tris) / float(full_tris)) : 0.0f;
 
     coarse_geometry_ = std::move(*geometry);
+    coarse_palettes_.dirty = true;
 
     spdlog::info(
         "[GCode::Renderer] Coarse LOD geometry set: {} triangles ({:.0f}% reduction from full)",
@@ -613,9 +644,15 @@ void GCodeTinyGLRenderer::render_geometry(const GCodeCamera& camera) {
     // This gives much better frame rates than runtime layer skipping (Phase 1)
     // because the coarse geometry has actual merged/simplified triangles
     active_geometry_ = &(*geometry_);
+    ObjectPalettes* palettes = &palettes_;
     if (interaction_mode_ && use_lod_for_interaction_ && coarse_geometry_.has_value()) {
         active_geometry_ = &(*coarse_geometry_);
+        palettes = &coarse_palettes_;
+    }
+    if (palettes->dirty) {
+        update_object_palettes(*active_geometry_, *palettes);
     }
+    active_palettes_ = palettes;
 
     // Clear buffers
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -693,9 +730,18 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
     }
 
     // Helper lambda to render a single strip with given dim factor
-    auto render_strip = [this, dim_factor](size_t strip_idx) {
+    const auto& strip_objects = active_geometry_->strip_object_index;
+    auto render_strip = [this, dim_factor, &strip_objects](size_t strip_idx) {
         const auto& strip = active_geometry_->strips[strip_idx];
 
+        // Per-object palette (highlight/exclude tint)
+        uint8_t tint = ObjectPalettes::NORMAL;
+        if (strip_idx < strip_objects.size() &&
+            strip_objects[strip_idx] != RibbonGeometry::NO_OBJECT) {
+            tint = active_palettes_->object_tint[strip_objects[strip_idx]];
+        }
+        const auto& color_palette = active_palettes_->tinted[tint];
+
         glBegin(GL_TRIANGLE_STRIP);
         for (int j = 0; j < 4; j++) {
             const auto& vertex = active_geometry_->vertices[strip[static_cast<size_t>(j)]];
@@ -705,7 +751,7 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
             glNormal3f(normal.x, normal.y, normal.z);
 
             // Lookup color from palette and apply dimming
-            uint32_t color_rgb = active_geometry_->color_palette[vertex.color_index];
+            uint32_t color_rgb = color_palette[vertex.color_index];
             uint8_t r = (color_rgb >> 16) & 0xFF;
             uint8_t g = (color_rgb >> 8) & 0xFF;
             uint8_t b = color_rgb & 0xFF;
@@ -941,7 +987,7 @@ void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode
 
     // Draw camera debug info overlay (if verbose mode OR camera params set via CLI)
     const RuntimeConfig* config = get_runtime_config();
-    bool show_debug_overlay = spdlog::get_level() <= spdlog::level::debug ||
+    bool show_debug_overlay = helix::logging::output_level() <= spdlog::level::debug ||
                               config->gcode_camera_azimuth_set ||
                               config->gcode_camera_elevation_set || config->gcode_camera_zoom_set;
     if (show_debug_overlay) {
@@ -1044,36 +1090,75 @@ void GCodeTinyGLRenderer::set_highlighted_object(const std::string& name) {
 }
 
 void GCodeTinyGLRenderer::set_highlighted_objects(const std::unordered_set<std::string>& names) {
-    // Only rebuild if the highlighted objects actually changed
+    // Only re-render if the highlighted objects actually changed
     if (highlighted_objects_ != names) {
         highlighted_objects_ = names;
-        // Trigger geometry rebuild to apply/remove highlighting
-        geometry_.reset();
-        current_gcode_filename_.clear();
-        spdlog::debug("[GCode TinyGL] TinyGL: Highlighted objects changed ({} selected), geometry "
-                      "will rebuild",
+        invalidate_object_palettes();
+        spdlog::debug("[GCode TinyGL] TinyGL: Highlighted objects changed ({} selected)",
                       names.size());
     }
 }
 
 void GCodeTinyGLRenderer::set_excluded_objects(const std::unordered_set<std::string>& names) {
-    // Only rebuild if the excluded objects actually changed
+    // Only re-render if the excluded objects actually changed
     if (excluded_objects_ != names) {
         excluded_objects_ = names;
-        // Trigger geometry rebuild to apply excluded object coloring
-        geometry_.reset();
-        current_gcode_filename_.clear();
-        spdlog::debug(
-            "[GCode TinyGL] TinyGL: Excluded objects changed ({} excluded), geometry will rebuild",
-            names.size());
+        invalidate_object_palettes();
+        spdlog::debug("[GCode TinyGL] TinyGL: Excluded objects changed ({} excluded)",
+                      names.size());
     }
 }
 
+void GCodeTinyGLRenderer::invalidate_object_palettes() {
+    palettes_.dirty = true;
+    coarse_palettes_.dirty = true;
+    framebuffer_valid_ = false;
+}
+
+void GCodeTinyGLRenderer::update_object_palettes(const RibbonGeometry& geometry,
+                                                 ObjectPalettes& palettes) const {
+    auto& base = palettes.tinted[ObjectPalettes::NORMAL];
+    base = geometry.color_palette;
+    if (filament_color_override_ && geometry.filament_color_slot >= 0 &&
+        static_cast<size_t>(geometry.filament_color_slot) < base.size()) {
+        base[static_cast<size_t>(geometry.filament_color_slot)] = *filament_color_override_;
+    }
+
+    auto& highlighted = palettes.tinted[ObjectPalettes::HIGHLIGHTED];
+    auto& excluded = palettes.tinted[ObjectPalettes::EXCLUDED];
+    highlighted.resize(base.size());
+    excluded.resize(base.size());
+    for (size_t i = 0; i < base.size(); ++i) {
+        highlighted[i] = scale_rgb(base[i], HIGHLIGHT_BRIGHTNESS);
+        excluded[i] = scale_rgb(blend_rgb(base[i], EXCLUDED_TINT_RGB, EXCLUDED_TINT_AMOUNT),
+                                EXCLUDED_BRIGHTNESS);
+    }
+
+    // Excluded wins over highlighted: the object will not be printed either way
+    palettes.object_tint.resize(geometry.object_names.size());
+    for (size_t slot = 0; slot < geometry.object_names.size(); ++slot) {
+        const std::string& name = geometry.object_names[slot];
+        if (excluded_objects_.count(name) > 0) {
+            palettes.object_tint[slot] = ObjectPalettes::EXCLUDED;
+        } else if (highlighted_objects_.count(name) > 0) {
+            palettes.object_tint[slot] = ObjectPalettes::HIGHLIGHTED;
+        } else {
+            palettes.object_tint[slot] = ObjectPalettes::NORMAL;
+        }
+    }
+
+    palettes.dirty = false;
+}
+
 void GCodeTinyGLRenderer::reset_colors() {
     // Reset to default filament color mode
     geometry_builder_->set_use_height_gradient(false);
     brightness_factor_ = 1.0f;
     global_opacity_ = LV_OPA_100;
+    if (filament_color_override_) {
+        filament_color_override_.reset();
+        invalidate_object_palettes();
+    }
 }
 
 void GCodeTinyGLRenderer::set_global_opacity(lv_opa_t opacity) {
@@ -1114,90 +1199,22 @@ int GCodeTinyGLRenderer::get_max_layer_index() const {
 std::optional<std::string> GCodeTinyGLRenderer::pick_object(const glm::vec2& screen_pos,
                                                             const ParsedGCodeFile& gcode,
                                                             const GCodeCamera& camera) const {
-    // Segment-based picking: find closest rendered segment to click point
-    // Reuses same algorithm as GCodeRenderer for consistency
-
-    glm::mat4 transform = camera.get_view_projection_matrix();
-    float closest_distance = std::numeric_limits<float>::max();
-    std::optional<std::string> picked_object;
-
-    const float PICK_THRESHOLD = 15.0f; // pixels - how close to segment to register click
-
-    // Determine visible layer range
-    int layer_start = layer_start_;
-    int layer_end = (layer_end_ < 0 || layer_end_ >= static_cast<int>(gcode.layers.size()))
-                        ? static_cast<int>(gcode.layers.size()) - 1
-                        : layer_end_;
-
-    for (int layer_idx = layer_start; layer_idx <= layer_end; ++layer_idx) {
-        if (layer_idx < 0 || layer_idx >= static_cast<int>(gcode.layers.size())) {
-            continue;
-        }
-
-        const Layer& layer = gcode.layers[static_cast<size_t>(layer_idx)];
-
-        for (const auto& segment : layer.segments) {
-            // Only check extrusion segments (TinyGL doesn't render travels)
-            if (!segment.is_extrusion || !show_extrusions_) {
-                continue;
-            }
-
-            // Skip segments without object names
-            if (segment.object_name.empty()) {
-                continue;
-            }
-
-            // Project segment endpoints to screen space
-            // Use camera's projection helper (same as GCodeRenderer)
-            glm::vec4 start_clip = transform * glm::vec4(segment.start, 1.0f);
-            glm::vec4 end_clip = transform * glm::vec4(segment.end, 1.0f);
-
-            // Perspective divide
-            if (std::abs(start_clip.w) < 0.0001f || std::abs(end_clip.w) < 0.0001f) {
-                continue;
-            }
-
-            glm::vec3 start_ndc = glm::vec3(start_clip) / start_clip.w;
-            glm::vec3 end_ndc = glm::vec3(end_clip) / end_clip.w;
-
-            // Clip to NDC bounds [-1, 1]
-            if (start_ndc.x < -1.0f || start_ndc.x > 1.0f || start_ndc.y < -1.0f ||
-                start_ndc.y > 1.0f || end_ndc.x < -1.0f || end_ndc.x > 1.0f || end_ndc.y < -1.0f ||
-                end_ndc.y > 1.0f) {
-                continue; // Simplified: skip segments with any point outside view
-            }
-
-            // NDC to screen space
-            glm::vec2 start_screen((start_ndc.x + 1.0f) * 0.5f * viewport_width_,
-                                   (1.0f - start_ndc.y) * 0.5f * viewport_height_);
-            glm::vec2 end_screen((end_ndc.x + 1.0f) * 0.5f * viewport_width_,
-                                 (1.0f - end_ndc.y) * 0.5f * viewport_height_);
-
-            // Calculate distance from click point to line segment
-            glm::vec2 v = end_screen - start_screen;
-            glm::vec2 w = screen_pos - start_screen;
-
-            // Project click onto line segment (clamped to [0,1])
-            float segment_length_sq = glm::dot(v, v);
-            float t = (segment_length_sq > 0.0001f)
-                          ? std::clamp(glm::dot(w, v) / segment_length_sq, 0.0f, 1.0f)
-                          : 0.0f;
-
-            // Closest point on segment to click
-            glm::vec2 closest_point = start_screen + t * v;
-
-            // Distance from click to closest point on segment
-            float dist = glm::length(screen_pos - closest_point);
+    // TinyGL renders extrusions only; with those hidden there is nothing to pick
+    if (!show_extrusions_) {
+        return std::nullopt;
+    }
 
-            // Update if this is the closest segment within threshold
-            if (dist < PICK_THRESHOLD && dist < closest_distance) {
-                closest_distance = dist;
-                picked_object = segment.object_name;
-            }
-        }
+    float z_min = 0.0f;
+    float z_max = 0.0f;
+    if (!ObjectPicker::visible_z_range(gcode, layer_start_, layer_end_, z_min, z_max)) {
+        return std::nullopt;
     }
 
-    return picked_object;
+    object_picker_.sync(gcode);
+    return object_picker_.pick(
+        screen_pos, camera.get_view_projection_matrix(),
+        glm::vec2(static_cast<float>(viewport_width_), static_cast<float>(viewport_height_)),
+        z_min, z_max);
 }
 
 GCodeTinyGLRenderer::RenderingOptions GCodeTinyGLRenderer::get_options() const {
@@ -127,6 +127,8 @@ static void print_help(const char* program_name) {
     printf("  --log-file <path>    Log file path (when --log-dest=file)\n");
     printf("  -M, --memory-report  Log memory usage every 30 seconds (development)\n");
     printf("  --show-memory        Show memory stats overlay (press M to toggle)\n");
+    printf("  --trace[=path]       Record a Chrome/Perfetto trace, written at exit\n");
+    printf("                       (kill -USR2 toggles tracing / dumps at runtime)\n");
     printf("  --debug-subjects     Enable verbose subject debugging with stack traces\n");
     printf("  --moonraker <url>    Override Moonraker URL (e.g., ws://192.168.1.112:7125)\n");
     printf("  -h, --help           Show this help message\n");
@@ -616,6 +618,11 @@ bool parse_cli_args(int argc, char** argv, CliArgs& args, int& screen_width, int
             args.memory_report = true;
         } else if (strcmp(argv[i], "--show-memory") == 0) {
             args.show_memory = true;
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            args.trace = true;
+        } else if (strncmp(argv[i], "--trace=", 8) == 0) {
+            args.trace = true;
+            args.trace_path = argv[i] + 8;
         } else if (strcmp(argv[i], "--debug-subjects") == 0) {
             RuntimeConfig::set_debug_subjects(true);
         }
@@ -0,0 +1,209 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+#include "flight_recorder.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace helix {
+namespace logging {
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "flight recorder needs a lock-free 32-bit atomic in shared memory");
+
+/// File layout: this header, then `capacity` bytes of ring data
+struct FlightRecorder::Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t capacity; ///< Power of two
+    uint32_t pid;      ///< Writer process
+    std::atomic<uint32_t> wrapped; ///< Nonzero once the ring has been filled
+    std::atomic<uint32_t> head;    ///< Total bytes reserved (wraps; capacity divides 2^32)
+};
+
+namespace {
+
+constexpr char MAGIC[8] = {'H', 'X', 'F', 'L', 'I', 'G', 'H', 'T'};
+constexpr uint32_t VERSION = 1;
+
+size_t round_up_pow2(size_t n) {
+    size_t p = FlightRecorder::MIN_CAPACITY;
+    while (p < n && p < FlightRecorder::MAX_CAPACITY) {
+        p <<= 1;
+    }
+    return p;
+}
+
+} // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+std::unique_ptr<FlightRecorder> FlightRecorder::create(const std::string& path, size_t capacity) {
+    capacity = round_up_pow2(capacity);
+    size_t mapping_size = sizeof(Header) + capacity;
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(mapping_size)) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // Mapping keeps the file referenced
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto* header = new (mapping) Header{};
+    std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+    header->version = VERSION;
+    header->capacity = static_cast<uint32_t>(capacity);
+    header->pid = static_cast<uint32_t>(::getpid());
+    header->wrapped.store(0, std::memory_order_relaxed);
+    header->head.store(0, std::memory_order_release);
+
+    return std::unique_ptr<FlightRecorder>(new FlightRecorder(mapping, mapping_size));
+}
+
+FlightRecorder::FlightRecorder(void* mapping, size_t mapping_size)
+    : mapping_(mapping), mapping_size_(mapping_size) {
+    header_ = static_cast<Header*>(mapping);
+    data_ = static_cast<char*>(mapping) + sizeof(Header);
+    capacity_ = header_->capacity;
+}
+
+FlightRecorder::~FlightRecorder() {
+    // Contents stay in the file for the watchdog; only the mapping goes away
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+// ============================================================================
+// Writing
+// ============================================================================
+
+void FlightRecorder::write(std::string_view line) noexcept {
+    size_t len = std::min(line.size(), capacity_ / 4);
+    if (len == 0) {
+        return;
+    }
+
+    uint32_t pos = header_->head.fetch_add(static_cast<uint32_t>(len), std::memory_order_relaxed);
+    if (pos + len > capacity_ && header_->wrapped.load(std::memory_order_relaxed) == 0) {
+        header_->wrapped.store(1, std::memory_order_relaxed);
+    }
+    size_t offset = pos & (capacity_ - 1);
+    size_t first = std::min(len, capacity_ - offset);
+    std::memcpy(data_ + offset, line.data(), first);
+    if (first < len) {
+        std::memcpy(data_, line.data() + first, len - first);
+    }
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+std::string FlightRecorder::extract(const Header* header, const char* data) {
+    size_t capacity = header->capacity;
+    uint32_t head = header->head.load(std::memory_order_acquire);
+
+    std::string out;
+    if (header->wrapped.load(std::memory_order_relaxed) == 0) {
+        out.assign(data, std::min<size_t>(head, capacity));
+    } else {
+        size_t start = head & (capacity - 1);
+        out.reserve(capacity);
+        out.append(data + start, capacity - start);
+        out.append(data, start);
+
+        // Oldest line was partly overwritten
+        size_t newline = out.find('\n');
+        out.erase(0, newline == std::string::npos ? out.size() : newline + 1);
+    }
+
+    // Space reserved by a writer that died before copying stays zeroed
+    out.erase(std::remove(out.begin(), out.end(), '\0'), out.end());
+    return out;
+}
+
+std::string FlightRecorder::snapshot() const {
+    return extract(header_, data_);
+}
+
+bool FlightRecorder::read_file(const std::string& path, std::string& out, uint32_t* pid) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+
+    std::vector<char> buf(static_cast<size_t>(st.st_size));
+    size_t total = 0;
+    while (total < buf.size()) {
+        ssize_t n = ::read(fd, buf.data() + total, buf.size() - total);
+        if (n <= 0) {
+            break;
+        }
+        total += static_cast<size_t>(n);
+    }
+    ::close(fd);
+
+    // Parse the header field by field (the file is not a live atomic here)
+    const char* p = buf.data();
+    uint32_t version = 0;
+    uint32_t capacity = 0;
+    uint32_t writer_pid = 0;
+    std::memcpy(&version, p + offsetof(Header, version), sizeof(version));
+    std::memcpy(&capacity, p + offsetof(Header, capacity), sizeof(capacity));
+    std::memcpy(&writer_pid, p + offsetof(Header, pid), sizeof(writer_pid));
+    if (total != buf.size() || std::memcmp(p, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION ||
+        capacity < MIN_CAPACITY || (capacity & (capacity - 1)) != 0 ||
+        buf.size() < sizeof(Header) + capacity) {
+        return false;
+    }
+
+    Header header{};
+    header.capacity = capacity;
+    uint32_t wrapped = 0;
+    uint32_t head = 0;
+    std::memcpy(&wrapped, p + offsetof(Header, wrapped), sizeof(wrapped));
+    std::memcpy(&head, p + offsetof(Header, head), sizeof(head));
+    header.wrapped.store(wrapped, std::memory_order_relaxed);
+    header.head.store(head, std::memory_order_relaxed);
+
+    out = extract(&header, p + sizeof(Header));
+    if (pid) {
+        *pid = writer_pid;
+    }
+    return true;
+}
+
+std::string default_flight_recorder_path() {
+    struct stat st {};
+    if (::stat("/dev/shm", &st) == 0 && S_ISDIR(st.st_mode) && ::access("/dev/shm", W_OK) == 0) {
+        return "/dev/shm/helix-screen.flight";
+    }
+    return "/tmp/helix-screen.flight";
+}
+
+} // namespace logging
+} // namespace helix
@@ -0,0 +1,144 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "language_packs.h"
+
+#include "lvgl/src/others/translation/lv_translation.h"
+#include "lvgl/src/xml/lv_xml_translation.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace helix {
+
+LanguagePacks& LanguagePacks::instance() {
+    static LanguagePacks instance;
+    return instance;
+}
+
+// LVGL may already be torn down at static destruction, so the pack stays registered
+LanguagePacks::~LanguagePacks() = default;
+
+std::string LanguagePacks::catalog_path(const std::string& lang) const {
+    return catalog_dir_ + "/" + lang + ".bin";
+}
+
+bool LanguagePacks::set_language(const std::string& lang) {
+    if (!env_checked_) {
+        env_checked_ = true;
+        const char* env = std::getenv("HELIX_TRANSLATION_CATALOGS");
+        if (env && std::string(env) == "0") {
+            catalogs_disabled_ = true;
+            spdlog::info("[LanguagePacks] Catalogs disabled via HELIX_TRANSLATION_CATALOGS=0");
+        } else if (env && *env) {
+            catalog_dir_ = env;
+        }
+    }
+
+    language_ = lang;
+    bool loaded = false;
+
+    if (!catalogs_disabled_) {
+        TranslationCatalog next;
+        if (next.open(catalog_path(lang))) {
+            install_catalog(std::move(next), lang);
+            loaded = true;
+        } else {
+            spdlog::debug("[LanguagePacks] No catalog for '{}' in {}", lang, catalog_dir_);
+        }
+    }
+
+    if (!loaded) {
+        // Stop LVGL reading the old mapping before it goes away
+        blank_pack();
+        catalog_.close();
+        loaded = ensure_fallback_xml();
+    }
+
+    // Sends LV_EVENT_TRANSLATION_LANGUAGE_CHANGED so tagged widgets refresh
+    lv_translation_set_language(lang.c_str());
+    return loaded;
+}
+
+void LanguagePacks::install_catalog(TranslationCatalog&& catalog, const std::string& lang) {
+    // Identity entries are what LVGL returns for unknown tags anyway
+    size_t translated = 0;
+    for (size_t i = 0; i < catalog.size(); ++i) {
+        if (catalog.key_at(i) != catalog.value_at(i)) {
+            translated++;
+        }
+    }
+
+    bool register_pack = false;
+    if (!pack_ || pack_->tags.size() < translated + 1) {
+        if (pack_) {
+            spdlog::debug("[LanguagePacks] Catalog '{}' outgrew the LVGL pack, replacing it",
+                          lang);
+            blank_pack();
+            retired_packs_.push_back(std::move(pack_));
+        }
+        // Every generated catalog has the same key set, so sizing for all keys
+        // means later swaps always fit in place
+        pack_ = std::make_unique<StaticPack>();
+        pack_->tags.resize(catalog.size() + 1);
+        pack_->translations.resize(catalog.size() + 1);
+        register_pack = true;
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < catalog.size(); ++i) {
+        std::string_view key = catalog.key_at(i);
+        std::string_view value = catalog.value_at(i);
+        if (key != value) {
+            // Both views are NUL-terminated inside the mapping
+            pack_->tags[n] = key.data();
+            pack_->translations[n] = value.data();
+            n++;
+        }
+    }
+    pack_->tags[n] = nullptr;
+    pack_->translations[n] = nullptr;
+    std::strncpy(pack_->language, lang.c_str(), sizeof(pack_->language) - 1);
+
+    if (register_pack) {
+        lv_translation_add_static(pack_->languages, pack_->tags.data(),
+                                  pack_->translations.data());
+    }
+
+    spdlog::info("[LanguagePacks] Loaded '{}' catalog ({} of {} strings translated)", lang,
+                 translated, catalog.size());
+
+    // The pack now points at the new mapping; the old one can be unmapped
+    catalog_ = std::move(catalog);
+}
+
+void LanguagePacks::blank_pack() {
+    if (pack_) {
+        pack_->language[0] = '\0';
+        pack_->tags[0] = nullptr;
+    }
+}
+
+bool LanguagePacks::ensure_fallback_xml() {
+    if (fallback_xml_loaded_) {
+        return true;
+    }
+    if (lv_xml_register_translation_from_file(FALLBACK_XML) != LV_RESULT_OK) {
+        spdlog::warn("[LanguagePacks] Failed to load {} - UI will use English defaults",
+                     FALLBACK_XML);
+        return false;
+    }
+    fallback_xml_loaded_ = true;
+    spdlog::info("[LanguagePacks] Loaded all languages from {}", FALLBACK_XML);
+    return true;
+}
+
+void LanguagePacks::unload() {
+    blank_pack();
+    catalog_.close();
+}
+
+} // namespace helix
@@ -2,16 +2,25 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #include "logging_init.h"
 
+#include "flight_recorder.h"
 #include "lvgl_assert_handler.h"
 #include "lvgl_log_handler.h"
 
+#include <spdlog/async.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
+#include <iterator>
 #include <lvgl.h>
 #include <src/display/lv_display_private.h>
+#include <thread>
 #include <vector>
 
 // Define the global callback pointer for LVGL assert handler
@@ -29,6 +38,68 @@ namespace logging {
 
 namespace {
 
+/// Level of console/system sinks (the logger may run lower for the flight recorder)
+std::atomic<int> g_output_level{spdlog::level::warn};
+
+/// Async writer thread pool (null in sync mode)
+std::shared_ptr<spdlog::details::thread_pool> g_writer_pool;
+std::shared_ptr<spdlog::async_logger> g_writer;
+
+/**
+ * @brief Appends every message to the mmap'd FlightRecorder ring
+ *
+ * Runs inline on the logging thread: one small format into a stack buffer
+ * and a lock-free copy. The message itself was already formatted by the
+ * logger (spdlog formats all levels anyway while backtrace is enabled).
+ */
+class FlightRecorderSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+  public:
+    explicit FlightRecorderSink(std::unique_ptr<FlightRecorder> recorder)
+        : recorder_(std::move(recorder)) {}
+
+  protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      msg.time.time_since_epoch())
+                      .count();
+        spdlog::memory_buf_t buf;
+        fmt::format_to(std::back_inserter(buf), "{}.{:03} {} [{}] ", ms / 1000, ms % 1000,
+                       spdlog::level::to_short_c_str(msg.level), msg.thread_id);
+        buf.append(msg.payload.data(), msg.payload.data() + msg.payload.size());
+        buf.push_back('\n');
+        recorder_->write(std::string_view(buf.data(), buf.size()));
+    }
+
+    void flush_() override {}
+
+  private:
+    std::unique_ptr<FlightRecorder> recorder_;
+};
+
+/**
+ * @brief Hands messages to the async writer logger
+ *
+ * Lets the flight recorder stay synchronous while console/journal/file
+ * output moves to the writer thread.
+ */
+class AsyncForwardSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+  public:
+    explicit AsyncForwardSink(std::shared_ptr<spdlog::async_logger> writer)
+        : writer_(std::move(writer)) {}
+
+  protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override {
+        writer_->log(msg.time, msg.source, msg.level, msg.payload);
+    }
+
+    void flush_() override {
+        writer_->flush();
+    }
+
+  private:
+    std::shared_ptr<spdlog::async_logger> writer_;
+};
+
 /// Check if a path is writable (for file logging location selection)
 bool is_path_writable(const std::string& path) {
     // Check parent directory for new files, or file itself if exists
@@ -202,9 +273,53 @@ void init(const LogConfig& config) {
     // Add system sink
     add_system_sink(sinks, effective_target, config.file_path);
 
+    // Output sinks filter at the configured level; the logger may run lower
+    for (auto& sink : sinks) {
+        sink->set_level(config.level);
+    }
+    g_output_level = config.level;
+
+    std::vector<spdlog::sink_ptr> logger_sinks;
+    spdlog::level::level_enum logger_level = config.level;
+
+    // Flight recorder: trace-level ring in RAM that survives a crash
+    std::string recorder_path;
+    if (config.flight_recorder_kb > 0) {
+        recorder_path = config.flight_recorder_path.empty() ? default_flight_recorder_path()
+                                                            : config.flight_recorder_path;
+        auto recorder = FlightRecorder::create(recorder_path, config.flight_recorder_kb * 1024);
+        if (recorder) {
+            auto recorder_sink = std::make_shared<FlightRecorderSink>(std::move(recorder));
+            recorder_sink->set_level(config.flight_recorder_level);
+            logger_sinks.push_back(recorder_sink);
+            logger_level = std::min(logger_level, config.flight_recorder_level);
+        } else {
+            recorder_path.clear();
+        }
+    }
+
+    // Async: console/system sinks move to a writer thread so SD card and
+    // journal writes never block the LVGL or libhv threads
+    g_writer.reset();
+    g_writer_pool.reset();
+    if (config.async && !sinks.empty()) {
+        g_writer_pool = std::make_shared<spdlog::details::thread_pool>(
+            std::max<size_t>(config.async_queue_size, 64), 1);
+        g_writer = std::make_shared<spdlog::async_logger>(
+            "helix-writer", sinks.begin(), sinks.end(), g_writer_pool,
+            spdlog::async_overflow_policy::overrun_oldest);
+        g_writer->set_level(config.level);
+        auto forward = std::make_shared<AsyncForwardSink>(g_writer);
+        forward->set_level(config.level);
+        logger_sinks.push_back(forward);
+    } else {
+        logger_sinks.insert(logger_sinks.end(), sinks.begin(), sinks.end());
+    }
+
     // Create logger with all sinks
-    auto logger = std::make_shared<spdlog::logger>("helix", sinks.begin(), sinks.end());
-    logger->set_level(config.level);
+    auto logger =
+        std::make_shared<spdlog::logger>("helix", logger_sinks.begin(), logger_sinks.end());
+    logger->set_level(logger_level);
 
     // Set as default logger
     spdlog::set_default_logger(logger);
@@ -222,8 +337,29 @@ void init(const LogConfig& config) {
     // See Application::init_display() which calls register_lvgl_log_handler().
 
     // Log what we configured (at debug level so it's not noisy)
-    spdlog::debug("[Logging] Initialized: target={}, console={}, backtrace=32 messages",
-                  log_target_name(effective_target), config.enable_console ? "yes" : "no");
+    spdlog::debug("[Logging] Initialized: target={}, console={}, backtrace=32 messages, "
+                  "async={}, flight_recorder={}",
+                  log_target_name(effective_target), config.enable_console ? "yes" : "no",
+                  g_writer ? "yes" : "no", recorder_path.empty() ? "off" : recorder_path);
+}
+
+void shutdown() {
+    if (auto logger = spdlog::default_logger()) {
+        logger->flush();
+    }
+    if (!g_writer_pool) {
+        return;
+    }
+
+    // The flush request is queued behind every pending message; wait for the
+    // writer to drain (bounded so a wedged journal can't hang shutdown)
+    for (int i = 0; i < 200 && g_writer_pool->queue_size() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+spdlog::level::level_enum output_level() {
+    return static_cast<spdlog::level::level_enum>(g_output_level.load());
 }
 
 LogTarget parse_log_target(const std::string& str) {
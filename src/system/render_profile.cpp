@@ -0,0 +1,247 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file render_profile.cpp
+ * @brief Tier defaults, first-boot benchmark and persistence for RenderProfile
+ */
+
+#include "render_profile.h"
+
+#include "config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace helix {
+
+namespace {
+
+constexpr const char* CONFIG_PATH = "/display/render_profile";
+
+// Benchmark tile: a typical widget-sized area, small enough to stay in L2 on the Pi
+constexpr int TILE_W = 128;
+constexpr int TILE_H = 64;
+
+/**
+ * @brief Blend a translucent color over an ARGB8888 tile (what LVGL's SW fill does)
+ * @return Pixels blended
+ */
+size_t blend_tile(std::vector<uint32_t>& tile, uint32_t color, uint32_t opa) {
+    const uint32_t inv = 255 - opa;
+    const uint32_t src_rb = (color & 0x00FF00FF) * opa;
+    const uint32_t src_g = (color & 0x0000FF00) * opa;
+    for (uint32_t& px : tile) {
+        uint32_t rb = ((px & 0x00FF00FF) * inv + src_rb) >> 8;
+        uint32_t g = ((px & 0x0000FF00) * inv + src_g) >> 8;
+        px = 0xFF000000 | (rb & 0x00FF00FF) | (g & 0x0000FF00);
+    }
+    return tile.size();
+}
+
+/**
+ * @brief Blend repeatedly until the deadline
+ * @return Pixels blended
+ */
+size_t blend_until(std::chrono::steady_clock::time_point deadline, uint32_t seed) {
+    std::vector<uint32_t> tile(TILE_W * TILE_H, 0xFF202020 + seed);
+    size_t pixels = 0;
+    uint32_t color = 0x3366CC ^ seed;
+    while (std::chrono::steady_clock::now() < deadline) {
+        // Several passes per clock read so timing overhead stays negligible
+        for (int i = 0; i < 8; ++i) {
+            pixels += blend_tile(tile, color, 96 + (i * 16));
+            color = color * 1664525u + 1013904223u;
+        }
+    }
+    // Keep the result observable so the loop is not optimized away
+    volatile uint32_t sink = tile[seed % tile.size()];
+    (void)sink;
+    return pixels;
+}
+
+} // namespace
+
+// ============================================================================
+// Tier defaults and refinement
+// ============================================================================
+
+RenderProfile RenderProfile::for_tier(const PlatformCapabilities& caps) {
+    RenderProfile p;
+    p.tier = caps.tier;
+    p.cpu_cores = caps.cpu_cores;
+    int cores = std::max(1, caps.cpu_cores);
+
+    switch (caps.tier) {
+    case PlatformTier::EMBEDDED:
+        // AD5M/K1: every MB counts - keep LVGL's compiled-in minimal footprint
+        p.draw_units = 1;
+        p.image_cache_bytes = 0;
+        p.image_header_cache_count = 0;
+        break;
+
+    case PlatformTier::BASIC:
+        p.draw_units = std::min(cores, 2);
+        p.image_cache_bytes = 2 * 1024 * 1024;
+        p.image_header_cache_count = 32;
+        break;
+
+    case PlatformTier::STANDARD:
+        p.draw_units = std::min(cores, 4);
+        p.image_cache_bytes = 8 * 1024 * 1024;
+        p.image_header_cache_count = 64;
+        break;
+    }
+
+    return p;
+}
+
+void RenderProfile::refine(const RenderBenchmarkResult& result) {
+    benchmark = result;
+    calibrated = true;
+
+    // Each extra unit must buy at least ~half a core of real speedup
+    int scaled_units = static_cast<int>(std::lround(result.parallel_speedup));
+    draw_units = std::clamp(scaled_units, 1, draw_units);
+}
+
+void RenderProfile::clamp_draw_units(int compiled_units) {
+    draw_units = std::clamp(draw_units, 1, std::max(1, compiled_units));
+}
+
+bool RenderProfile::needs_recalibration(const PlatformCapabilities& caps) const {
+    // Same SD card moved to a different board, or cores hot-plugged/offlined
+    return !calibrated || caps.cpu_cores != cpu_cores || caps.tier != tier;
+}
+
+json RenderProfile::to_json() const {
+    return json{{"version", VERSION},
+                {"tier", platform_tier_to_string(tier)},
+                {"cpu_cores", cpu_cores},
+                {"draw_units", draw_units},
+                {"image_cache_bytes", image_cache_bytes},
+                {"image_header_cache_count", image_header_cache_count},
+                {"calibrated", calibrated},
+                {"single_thread_mpix_s", benchmark.single_thread_mpix_s},
+                {"parallel_speedup", benchmark.parallel_speedup},
+                {"threads_tested", benchmark.threads_tested}};
+}
+
+bool RenderProfile::from_json(const json& j, RenderProfile& out) {
+    if (!j.is_object() || j.value("version", 0) != VERSION) {
+        return false;
+    }
+
+    try {
+        RenderProfile p;
+        std::string tier_name = j.at("tier").get<std::string>();
+        if (tier_name == "standard") {
+            p.tier = PlatformTier::STANDARD;
+        } else if (tier_name == "basic") {
+            p.tier = PlatformTier::BASIC;
+        } else {
+            p.tier = PlatformTier::EMBEDDED;
+        }
+        p.cpu_cores = j.at("cpu_cores").get<int>();
+        p.draw_units = std::max(1, j.at("draw_units").get<int>());
+        p.image_cache_bytes = j.at("image_cache_bytes").get<size_t>();
+        p.image_header_cache_count = j.at("image_header_cache_count").get<uint32_t>();
+        p.calibrated = j.at("calibrated").get<bool>();
+        p.benchmark.single_thread_mpix_s = j.value("single_thread_mpix_s", 0.0);
+        p.benchmark.parallel_speedup = j.value("parallel_speedup", 1.0);
+        p.benchmark.threads_tested = j.value("threads_tested", 1);
+        out = p;
+        return true;
+    } catch (const json::exception& e) {
+        spdlog::warn("[RenderProfile] Ignoring malformed saved profile: {}", e.what());
+        return false;
+    }
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+RenderBenchmarkResult run_render_benchmark(int max_threads, int budget_ms) {
+    RenderBenchmarkResult result;
+    int threads = std::clamp(max_threads, 1, 8);
+    auto budget = std::chrono::milliseconds(std::max(1, budget_ms));
+
+    // Single-thread pass
+    auto start = std::chrono::steady_clock::now();
+    size_t single_pixels = blend_until(start + budget, 0);
+    double single_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double single_rate = single_pixels / std::max(single_s, 1e-6);
+    result.single_thread_mpix_s = single_rate / 1e6;
+    result.threads_tested = threads;
+
+    if (threads == 1) {
+        return result;
+    }
+
+    // Parallel pass: same work per thread, each on its own tile
+    std::atomic<size_t> total_pixels{0};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    start = std::chrono::steady_clock::now();
+    auto deadline = start + budget;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&total_pixels, deadline, t] {
+            total_pixels += blend_until(deadline, static_cast<uint32_t>(t + 1));
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    double parallel_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double parallel_rate = total_pixels.load() / std::max(parallel_s, 1e-6);
+    result.parallel_speedup = single_rate > 0.0 ? parallel_rate / single_rate : 1.0;
+
+    return result;
+}
+
+// ============================================================================
+// Selection and persistence
+// ============================================================================
+
+RenderProfile select_render_profile(const PlatformCapabilities& caps, Config* config) {
+    if (config) {
+        RenderProfile saved;
+        json stored = config->get<json>(CONFIG_PATH, json());
+        if (RenderProfile::from_json(stored, saved) && !saved.needs_recalibration(caps)) {
+            spdlog::info("[RenderProfile] Using saved profile: {} draw units, {} KB image cache",
+                         saved.draw_units, saved.image_cache_bytes / 1024);
+            return saved;
+        }
+    }
+
+    RenderProfile profile = RenderProfile::for_tier(caps);
+
+    // Single-core devices have nothing to learn from the parallel pass
+    RenderBenchmarkResult bench = run_render_benchmark(profile.draw_units);
+    profile.refine(bench);
+
+    spdlog::info("[RenderProfile] Calibrated ({} tier): {:.0f} Mpix/s, {:.1f}x on {} threads -> "
+                 "{} draw units",
+                 platform_tier_to_string(profile.tier), bench.single_thread_mpix_s,
+                 bench.parallel_speedup, bench.threads_tested, profile.draw_units);
+
+    if (config) {
+        config->set<json>(CONFIG_PATH, profile.to_json());
+        if (!config->save()) {
+            spdlog::warn("[RenderProfile] Failed to persist profile; will recalibrate next boot");
+        }
+    }
+
+    return profile;
+}
+
+} // namespace helix
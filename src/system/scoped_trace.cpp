@@ -0,0 +1,352 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file scoped_trace.cpp
+ * @brief Per-thread trace ring buffers and Chrome trace JSON export
+ */
+
+#include "scoped_trace.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <unistd.h>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+namespace helix::trace {
+
+namespace {
+
+static_assert((EVENTS_PER_THREAD & (EVENTS_PER_THREAD - 1)) == 0,
+              "EVENTS_PER_THREAD must be a power of two");
+
+/// Buffers of exited threads kept for the next dump (short-lived HTTP threads)
+constexpr size_t MAX_RETIRED_BUFFERS = 8;
+
+struct Event {
+    const char* category;
+    const char* name;
+    uint64_t start_us;
+    uint64_t dur_us;
+};
+
+/**
+ * @brief Single-writer ring of events owned by one thread
+ *
+ * The owning thread fills a slot and then publishes it by bumping head.
+ * Readers copy without locking and discard any slot the writer may have
+ * been overwriting meanwhile (see snapshot()).
+ */
+struct ThreadBuffer {
+    std::vector<Event> events = std::vector<Event>(EVENTS_PER_THREAD);
+    std::atomic<uint64_t> head{0};
+    std::atomic<bool> retired{false};
+    uint64_t tid = 0;
+    std::string name; ///< Guarded by g_registry_mutex
+
+    void push(const Event& event) noexcept {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        events[h & (EVENTS_PER_THREAD - 1)] = event;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    std::vector<Event> snapshot() const {
+        uint64_t end = head.load(std::memory_order_acquire);
+        uint64_t begin = end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0;
+
+        std::vector<Event> out;
+        out.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; ++i) {
+            out.push_back(events[i & (EVENTS_PER_THREAD - 1)]);
+        }
+
+        // Slots at or below (head - capacity) may have been rewritten during the copy
+        uint64_t after = head.load(std::memory_order_acquire);
+        uint64_t first_valid = after >= EVENTS_PER_THREAD ? after - EVENTS_PER_THREAD + 1 : 0;
+        if (first_valid > begin) {
+            size_t drop = static_cast<size_t>(std::min<uint64_t>(first_valid - begin, out.size()));
+            out.erase(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(drop));
+        }
+        return out;
+    }
+};
+
+std::mutex g_registry_mutex;
+std::vector<std::shared_ptr<ThreadBuffer>> g_buffers;
+std::unordered_set<std::string> g_interned;
+
+std::string g_dump_path;
+std::atomic<bool> g_signal_requested{false};
+bool g_initialized = false;
+
+const auto g_epoch = std::chrono::steady_clock::now();
+
+uint64_t current_tid() {
+#ifdef __linux__
+    return static_cast<uint64_t>(::syscall(SYS_gettid));
+#else
+    static std::atomic<uint64_t> next_tid{1};
+    return next_tid.fetch_add(1);
+#endif
+}
+
+/// Thread-local owner: marks the buffer retired when the thread exits
+struct ThreadSlot {
+    std::shared_ptr<ThreadBuffer> buffer; ///< Created on the first recorded event
+    std::string name;                     ///< Applied when the buffer is created
+
+    ~ThreadSlot() {
+        if (buffer) {
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadSlot t_slot;
+
+ThreadBuffer& thread_buffer() {
+    if (!t_slot.buffer) {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->tid = current_tid();
+        buffer->name = t_slot.name;
+
+        std::lock_guard<std::mutex> lock(g_registry_mutex);
+        // Forget the oldest exited threads beyond the retention limit
+        size_t retired = static_cast<size_t>(
+            std::count_if(g_buffers.begin(), g_buffers.end(),
+                          [](const auto& b) { return b->retired.load(); }));
+        auto it = g_buffers.begin();
+        while (it != g_buffers.end() && retired > MAX_RETIRED_BUFFERS) {
+            if ((*it)->retired.load()) {
+                it = g_buffers.erase(it);
+                --retired;
+            } else {
+                ++it;
+            }
+        }
+        g_buffers.push_back(buffer);
+        t_slot.buffer = std::move(buffer);
+    }
+    return *t_slot.buffer;
+}
+
+void append_json_string(std::string& out, std::string_view s) {
+    out += '"';
+    for (char c : s) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void sigusr2_handler(int /*signum*/) {
+    g_signal_requested.store(true, std::memory_order_release);
+}
+
+} // namespace
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void set_enabled(bool enabled) {
+    detail::g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t now_us() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - g_epoch)
+                                     .count());
+}
+
+void record(const char* category, const char* name, uint64_t start_us, uint64_t end_us) noexcept {
+    try {
+        thread_buffer().push({category, name, start_us, end_us - start_us});
+    } catch (...) {
+        // Out of memory creating the buffer: drop the event
+    }
+}
+
+const char* intern(std::string_view name) {
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    return g_interned.emplace(name).first->c_str();
+}
+
+void set_thread_name(std::string_view name) {
+    t_slot.name = std::string(name);
+    if (t_slot.buffer) {
+        std::lock_guard<std::mutex> lock(g_registry_mutex);
+        t_slot.buffer->name = t_slot.name;
+    }
+}
+
+void clear() {
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    // Live threads keep their buffers (still referenced by thread_local slots)
+    g_buffers.erase(std::remove_if(g_buffers.begin(), g_buffers.end(),
+                                   [](const auto& b) { return b->retired.load(); }),
+                    g_buffers.end());
+    for (auto& buffer : g_buffers) {
+        // Only the owner writes head; a racing push is harmless (one stale event)
+        buffer->head.store(0, std::memory_order_release);
+    }
+}
+
+// ============================================================================
+// Export
+// ============================================================================
+
+std::string to_chrome_json() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(g_registry_mutex);
+        buffers = g_buffers;
+        for (const auto& buffer : buffers) {
+            names.push_back(buffer->name);
+        }
+    }
+
+    const int pid = static_cast<int>(::getpid());
+    std::string out;
+    out.reserve(64 * 1024);
+    out += R"({"displayTimeUnit":"ms","traceEvents":[)";
+    out += R"({"ph":"M","name":"process_name","pid":)" + std::to_string(pid) +
+           R"(,"tid":0,"args":{"name":"helix-screen"}})";
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        const std::string tid = std::to_string(buffers[i]->tid);
+        if (!names[i].empty()) {
+            out += R"(,{"ph":"M","name":"thread_name","pid":)" + std::to_string(pid) +
+                   R"(,"tid":)" + tid + R"(,"args":{"name":)";
+            append_json_string(out, names[i]);
+            out += "}}";
+        }
+
+        for (const Event& event : buffers[i]->snapshot()) {
+            out += R"(,{"ph":"X","cat":)";
+            append_json_string(out, event.category ? event.category : "");
+            out += R"(,"name":)";
+            append_json_string(out, event.name ? event.name : "");
+            out += R"(,"ts":)" + std::to_string(event.start_us) + R"(,"dur":)" +
+                   std::to_string(event.dur_us) + R"(,"pid":)" + std::to_string(pid) +
+                   R"(,"tid":)" + tid + "}";
+        }
+    }
+
+    out += "]}";
+    return out;
+}
+
+bool write_chrome_trace(const std::string& path) {
+    std::string json = to_chrome_json();
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        if (!file) {
+            return false;
+        }
+    }
+    return std::rename(tmp_path.c_str(), path.c_str()) == 0;
+}
+
+std::string default_trace_path() {
+    return "/tmp/helix-trace-" + std::to_string(::getpid()) + ".json";
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void init(bool enable, const std::string& dump_path) {
+    if (g_initialized) {
+        spdlog::warn("[Trace] init() called multiple times");
+        return;
+    }
+    g_initialized = true;
+    g_dump_path = dump_path.empty() ? default_trace_path() : dump_path;
+
+    set_thread_name("main");
+    set_enabled(enable);
+
+    struct sigaction sa {};
+    sa.sa_handler = sigusr2_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    if (sigaction(SIGUSR2, &sa, nullptr) == 0) {
+        spdlog::debug("[Trace] SIGUSR2 handler installed (kill -USR2 {} to toggle/dump)",
+                      getpid());
+    }
+
+    if (enable) {
+        spdlog::info("[Trace] Tracing enabled, dump at exit to {}", g_dump_path);
+    }
+}
+
+void poll() {
+    if (!g_signal_requested.load(std::memory_order_relaxed) ||
+        !g_signal_requested.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+
+    if (!is_enabled()) {
+        set_enabled(true);
+        spdlog::info("[Trace] Tracing enabled by signal; send SIGUSR2 again to dump to {}",
+                     g_dump_path);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (write_chrome_trace(g_dump_path)) {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        spdlog::info("[Trace] Wrote {} ({}ms)", g_dump_path, ms);
+    } else {
+        spdlog::warn("[Trace] Failed to write {}", g_dump_path);
+    }
+}
+
+void shutdown() {
+    if (!g_initialized || !is_enabled()) {
+        return;
+    }
+    set_enabled(false);
+    if (write_chrome_trace(g_dump_path)) {
+        spdlog::info("[Trace] Wrote {}", g_dump_path);
+    } else {
+        spdlog::warn("[Trace] Failed to write {}", g_dump_path);
+    }
+}
+
+} // namespace helix::trace
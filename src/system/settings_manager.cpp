@@ -8,8 +8,7 @@
 #include "app_globals.h"
 #include "config.h"
 #include "display_manager.h"
-#include "lv_i18n_translations.h"
-#include "lvgl/src/others/translation/lv_translation.h"
+#include "language_packs.h"
 #include "moonraker_api.h"
 #include "moonraker_client.h"
 #include "printer_state.h"
@@ -592,17 +591,13 @@ void SettingsManager::set_language(const std::string& lang) {
     // 1. Update subject (UI reacts)
     lv_subject_set_int(&language_subject_, index);
 
-    // 2. Call LVGL translation API for hot-reload
+    // 2. Swap in the language's catalog for hot-reload
     // This sends LV_EVENT_TRANSLATION_LANGUAGE_CHANGED to all widgets
-    lv_translation_set_language(lang.c_str());
-
-    // 3. Sync lv_i18n system (for plural forms and runtime lookups)
-    int i18n_result = lv_i18n_set_locale(lang.c_str());
-    if (i18n_result != 0) {
-        spdlog::warn("[SettingsManager] Failed to set lv_i18n locale to '{}'", lang);
+    if (!helix::LanguagePacks::instance().set_language(lang)) {
+        spdlog::warn("[SettingsManager] No translations for '{}' - showing English", lang);
     }
 
-    // 4. Persist to config
+    // 3. Persist to config
     Config* config = Config::get_instance();
     config->set_language(lang);
     config->save();
@@ -0,0 +1,175 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "translation_catalog.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace helix {
+
+namespace {
+
+constexpr char CATALOG_MAGIC[8] = {'H', 'X', 'T', 'R', 'N', 'C', 'A', 'T'};
+constexpr size_t HEADER_SIZE = sizeof(CATALOG_MAGIC) + 6 * sizeof(uint32_t);
+
+uint32_t read_u32(const uint8_t* p) {
+    // Catalog is little-endian; assemble byte-wise so unaligned reads are safe on ARM
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+TranslationCatalog::~TranslationCatalog() {
+    close();
+}
+
+TranslationCatalog::TranslationCatalog(TranslationCatalog&& other) noexcept {
+    *this = std::move(other);
+}
+
+TranslationCatalog& TranslationCatalog::operator=(TranslationCatalog&& other) noexcept {
+    if (this != &other) {
+        close();
+        base_ = std::exchange(other.base_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+        entry_count_ = std::exchange(other.entry_count_, 0);
+        locale_offset_ = std::exchange(other.locale_offset_, 0);
+        strtab_offset_ = std::exchange(other.strtab_offset_, 0);
+        strtab_size_ = std::exchange(other.strtab_size_, 0);
+    }
+    return *this;
+}
+
+bool TranslationCatalog::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::debug("[TranslationCatalog] No catalog at {}", path);
+        return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_SIZE)) {
+        spdlog::warn("[TranslationCatalog] {} is too small to be a catalog", path);
+        ::close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapping stays valid after the descriptor is closed
+    if (mapped == MAP_FAILED) {
+        spdlog::warn("[TranslationCatalog] mmap failed for {}: {}", path, strerror(errno));
+        return false;
+    }
+
+    base_ = static_cast<const uint8_t*>(mapped);
+    length_ = static_cast<size_t>(st.st_size);
+
+    if (!validate()) {
+        spdlog::warn("[TranslationCatalog] {} is invalid or stale - ignoring", path);
+        close();
+        return false;
+    }
+
+    spdlog::debug("[TranslationCatalog] Mapped '{}' ({} strings, {} KB) from {}", locale(),
+                  entry_count_, length_ / 1024, path);
+    return true;
+}
+
+void TranslationCatalog::close() {
+    if (base_) {
+        munmap(const_cast<uint8_t*>(base_), length_);
+    }
+    base_ = nullptr;
+    length_ = 0;
+    entry_count_ = 0;
+    locale_offset_ = strtab_offset_ = strtab_size_ = 0;
+}
+
+bool TranslationCatalog::validate() {
+    if (std::memcmp(base_, CATALOG_MAGIC, sizeof(CATALOG_MAGIC)) != 0) {
+        return false;
+    }
+
+    const uint8_t* p = base_ + sizeof(CATALOG_MAGIC);
+    uint32_t version = read_u32(p);
+    entry_count_ = read_u32(p + 4);
+    locale_offset_ = read_u32(p + 8);
+    strtab_offset_ = read_u32(p + 12);
+    strtab_size_ = read_u32(p + 16);
+
+    if (version != FORMAT_VERSION) {
+        spdlog::warn("[TranslationCatalog] Version {} not supported (expected {})", version,
+                     FORMAT_VERSION);
+        return false;
+    }
+
+    // Use 64-bit math so crafted offsets can't overflow past the mapping
+    uint64_t tables_end = HEADER_SIZE + static_cast<uint64_t>(entry_count_) * sizeof(Entry);
+    if (tables_end > strtab_offset_ ||
+        static_cast<uint64_t>(strtab_offset_) + strtab_size_ > length_ ||
+        locale_offset_ >= strtab_size_ ||
+        std::memchr(base_ + strtab_offset_ + locale_offset_, '\0',
+                    strtab_size_ - locale_offset_) == nullptr) {
+        return false;
+    }
+
+    // Every string must be in range and NUL-terminated since LanguagePacks hands
+    // the raw pointers to LVGL.
+    const uint8_t* strtab = base_ + strtab_offset_;
+    for (size_t i = 0; i < entry_count_; ++i) {
+        const Entry* e = entry(i);
+        if (static_cast<uint64_t>(e->key_offset) + e->key_len >= strtab_size_ ||
+            static_cast<uint64_t>(e->value_offset) + e->value_len >= strtab_size_) {
+            return false;
+        }
+        if (strtab[e->key_offset + e->key_len] != '\0' ||
+            strtab[e->value_offset + e->value_len] != '\0') {
+            return false;
+        }
+    }
+    return true;
+}
+
+const TranslationCatalog::Entry* TranslationCatalog::entry(size_t index) const {
+    static_assert(sizeof(Entry) == 16, "Entry must match on-disk layout");
+    // Header is 32 bytes, so entries are 4-byte aligned relative to the
+    // page-aligned mapping.
+    return reinterpret_cast<const Entry*>(base_ + HEADER_SIZE) + index;
+}
+
+std::string_view TranslationCatalog::locale() const {
+    if (!base_) {
+        return {};
+    }
+    return reinterpret_cast<const char*>(base_ + strtab_offset_ + locale_offset_);
+}
+
+std::string_view TranslationCatalog::key_at(size_t index) const {
+    if (!base_ || index >= entry_count_) {
+        return {};
+    }
+    const Entry* e = entry(index);
+    return {reinterpret_cast<const char*>(base_ + strtab_offset_ + e->key_offset), e->key_len};
+}
+
+std::string_view TranslationCatalog::value_at(size_t index) const {
+    if (!base_ || index >= entry_count_) {
+        return {};
+    }
+    const Entry* e = entry(index);
+    return {reinterpret_cast<const char*>(base_ + strtab_offset_ + e->value_offset),
+            e->value_len};
+}
+
+} // namespace helix
@@ -0,0 +1,174 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "xml_component_bundle.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace helix {
+
+namespace {
+
+constexpr char BUNDLE_MAGIC[8] = {'H', 'X', 'M', 'L', 'B', 'N', 'D', 'L'};
+constexpr size_t HEADER_SIZE = sizeof(BUNDLE_MAGIC) + 6 * sizeof(uint32_t);
+
+uint32_t read_u32(const uint8_t* p) {
+    // Bundle is little-endian; assemble byte-wise so unaligned reads are safe on ARM
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+XmlComponentBundle::~XmlComponentBundle() {
+    close();
+}
+
+bool XmlComponentBundle::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::debug("[XmlBundle] No bundle at {}", path);
+        return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_SIZE)) {
+        spdlog::warn("[XmlBundle] {} is too small to be a bundle", path);
+        ::close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapping stays valid after the descriptor is closed
+    if (mapped == MAP_FAILED) {
+        spdlog::warn("[XmlBundle] mmap failed for {}: {}", path, strerror(errno));
+        return false;
+    }
+
+    base_ = static_cast<const uint8_t*>(mapped);
+    length_ = static_cast<size_t>(st.st_size);
+
+    if (!validate()) {
+        spdlog::warn("[XmlBundle] {} is invalid or stale - ignoring", path);
+        close();
+        return false;
+    }
+
+    spdlog::debug("[XmlBundle] Mapped {} components ({} KB) from {}", entry_count_,
+                  length_ / 1024, path);
+    return true;
+}
+
+void XmlComponentBundle::close() {
+    if (base_) {
+        munmap(const_cast<uint8_t*>(base_), length_);
+    }
+    base_ = nullptr;
+    length_ = 0;
+    entry_count_ = 0;
+    strtab_offset_ = strtab_size_ = data_offset_ = data_size_ = 0;
+}
+
+bool XmlComponentBundle::validate() {
+    if (std::memcmp(base_, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0) {
+        return false;
+    }
+
+    const uint8_t* p = base_ + sizeof(BUNDLE_MAGIC);
+    uint32_t version = read_u32(p);
+    entry_count_ = read_u32(p + 4);
+    strtab_offset_ = read_u32(p + 8);
+    strtab_size_ = read_u32(p + 12);
+    data_offset_ = read_u32(p + 16);
+    data_size_ = read_u32(p + 20);
+
+    if (version != FORMAT_VERSION) {
+        spdlog::warn("[XmlBundle] Version {} not supported (expected {})", version,
+                     FORMAT_VERSION);
+        return false;
+    }
+
+    // Use 64-bit math so crafted offsets can't overflow past the mapping
+    uint64_t entries_end = HEADER_SIZE + static_cast<uint64_t>(entry_count_) * sizeof(Entry);
+    if (entries_end > strtab_offset_ ||
+        static_cast<uint64_t>(strtab_offset_) + strtab_size_ > data_offset_ ||
+        static_cast<uint64_t>(data_offset_) + data_size_ > length_) {
+        return false;
+    }
+
+    // Every name and payload must be in range and NUL-terminated, since find()
+    // returns raw pointers into the mapping.
+    for (size_t i = 0; i < entry_count_; ++i) {
+        const Entry* e = entry(i);
+        if (static_cast<uint64_t>(e->name_offset) + e->name_len >= strtab_size_ ||
+            static_cast<uint64_t>(e->data_offset) + e->data_len >= data_size_) {
+            return false;
+        }
+        if (base_[strtab_offset_ + e->name_offset + e->name_len] != '\0' ||
+            base_[data_offset_ + e->data_offset + e->data_len] != '\0') {
+            return false;
+        }
+    }
+    return true;
+}
+
+const XmlComponentBundle::Entry* XmlComponentBundle::entry(size_t index) const {
+    static_assert(sizeof(Entry) == 16, "Entry must match on-disk layout");
+    // Header is 32 bytes and entries are 16, so entries are 4-byte aligned
+    // relative to the page-aligned mapping.
+    return reinterpret_cast<const Entry*>(base_ + HEADER_SIZE) + index;
+}
+
+std::string_view XmlComponentBundle::name_at(size_t index) const {
+    if (!base_ || index >= entry_count_) {
+        return {};
+    }
+    const Entry* e = entry(index);
+    return {reinterpret_cast<const char*>(base_ + strtab_offset_ + e->name_offset), e->name_len};
+}
+
+const char* XmlComponentBundle::find(std::string_view name) const {
+    if (!base_) {
+        return nullptr;
+    }
+
+    // Entries are sorted by name (bytewise) by the generator
+    size_t lo = 0;
+    size_t hi = entry_count_;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = name_at(mid).compare(name);
+        if (cmp == 0) {
+            return reinterpret_cast<const char*>(base_ + data_offset_ + entry(mid)->data_offset);
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return nullptr;
+}
+
+std::string_view XmlComponentBundle::component_name_from_path(std::string_view path) {
+    size_t slash = path.find_last_of("/:");
+    if (slash != std::string_view::npos) {
+        path.remove_prefix(slash + 1);
+    }
+    constexpr std::string_view ext = ".xml";
+    if (path.size() >= ext.size() && path.substr(path.size() - ext.size()) == ext) {
+        path.remove_suffix(ext.size());
+    }
+    return path;
+}
+
+} // namespace helix
@@ -3,10 +3,15 @@
 
 #include "temperature_history_manager.h"
 
+#include "unit_conversions.h"
+
 #include "spdlog/spdlog.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 // ============================================================================
 // Construction / Destruction
@@ -15,8 +20,8 @@
 TemperatureHistoryManager::TemperatureHistoryManager(PrinterState& printer_state)
     : printer_state_(printer_state) {
     // Pre-populate heater map with standard heaters
-    heaters_["extruder"] = HeaterHistory{};
-    heaters_["heater_bed"] = HeaterHistory{};
+    heaters_["extruder"] = TieredTempHistory{};
+    heaters_["heater_bed"] = TieredTempHistory{};
 
     // Subscribe to temperature subjects for automatic sample collection
     subscribe_to_subjects();
@@ -41,38 +46,7 @@ TemperatureHistoryManager::get_samples(const std::string& heater_name) const {
     if (it == heaters_.end()) {
         return {};
     }
-
-    const HeaterHistory& history = it->second;
-    std::vector<TempSample> result;
-    result.reserve(static_cast<size_t>(history.count));
-
-    if (history.count == 0) {
-        return result;
-    }
-
-    // Calculate where the oldest sample is
-    // If buffer is not full: oldest is at index 0
-    // If buffer is full: oldest is at write_index (next to be overwritten)
-    int oldest_index;
-    int num_samples;
-
-    if (history.count < HISTORY_SIZE) {
-        // Buffer not full yet - samples start at 0
-        oldest_index = 0;
-        num_samples = history.count;
-    } else {
-        // Buffer full - oldest is at current write position
-        oldest_index = history.write_index;
-        num_samples = HISTORY_SIZE;
-    }
-
-    // Copy samples in chronological order (oldest first)
-    for (int i = 0; i < num_samples; ++i) {
-        int idx = (oldest_index + i) % HISTORY_SIZE;
-        result.push_back(history.samples[static_cast<size_t>(idx)]);
-    }
-
-    return result;
+    return it->second.view(TempHistoryTier::FINE).to_vector();
 }
 
 std::vector<TempSample> TemperatureHistoryManager::get_samples_since(const std::string& heater_name,
@@ -83,37 +57,29 @@ std::vector<TempSample> TemperatureHistoryManager::get_samples_since(const std::
     if (it == heaters_.end()) {
         return {};
     }
+    return it->second.view(TempHistoryTier::FINE).since(since_ms).to_vector();
+}
 
-    const HeaterHistory& history = it->second;
-    if (history.count == 0) {
-        return {};
-    }
-
-    // Calculate where the oldest sample is
-    int oldest_index;
-    int num_samples;
+TempSampleView TemperatureHistoryManager::get_view(const std::string& heater_name,
+                                                   TempHistoryTier tier) const {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    if (history.count < HISTORY_SIZE) {
-        oldest_index = 0;
-        num_samples = history.count;
-    } else {
-        oldest_index = history.write_index;
-        num_samples = HISTORY_SIZE;
+    auto it = heaters_.find(heater_name);
+    if (it == heaters_.end()) {
+        return {};
     }
+    return it->second.view(tier);
+}
 
-    // Filter samples in chronological order, collecting only those after since_ms
-    std::vector<TempSample> result;
-    result.reserve(static_cast<size_t>(num_samples));
+TempSampleView TemperatureHistoryManager::get_view_for_span(const std::string& heater_name,
+                                                            int64_t span_ms) const {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    for (int i = 0; i < num_samples; ++i) {
-        int idx = (oldest_index + i) % HISTORY_SIZE;
-        const TempSample& sample = history.samples[static_cast<size_t>(idx)];
-        if (sample.timestamp_ms > since_ms) {
-            result.push_back(sample);
-        }
+    auto it = heaters_.find(heater_name);
+    if (it == heaters_.end()) {
+        return {};
     }
-
-    return result;
+    return it->second.view_for_span(span_ms);
 }
 
 std::vector<std::string> TemperatureHistoryManager::get_heater_names() const {
@@ -137,7 +103,206 @@ int TemperatureHistoryManager::get_sample_count(const std::string& heater_name)
         return 0;
     }
 
-    return std::min(it->second.count, HISTORY_SIZE);
+    return static_cast<int>(it->second.size(TempHistoryTier::FINE));
+}
+
+// ============================================================================
+// Discovered Heaters and Sensors
+// ============================================================================
+
+void TemperatureHistoryManager::set_tracked_sensors(const std::vector<std::string>& names) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& name : names) {
+        heaters_.try_emplace(name);
+    }
+    spdlog::debug("TemperatureHistoryManager: tracking {} heaters/sensors", heaters_.size());
+}
+
+void TemperatureHistoryManager::update_from_status(const nlohmann::json& status,
+                                                   int64_t timestamp_ms) {
+    if (!status.is_object()) {
+        return;
+    }
+
+    std::vector<std::string> updated;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (auto& [name, history] : heaters_) {
+            // Extruder and bed are sampled from PrinterState subjects
+            if (name == "extruder" || name == "heater_bed") {
+                continue;
+            }
+
+            auto obj = status.find(name);
+            if (obj == status.end() || !obj->is_object()) {
+                continue;
+            }
+
+            // Targets only exist on heaters and arrive only when they change
+            int& target_centi = cached_status_targets_[name];
+            target_centi = helix::units::json_to_centidegrees(*obj, "target", target_centi);
+
+            auto temp = obj->find("temperature");
+            if (temp == obj->end() || !temp->is_number()) {
+                continue;
+            }
+
+            TempSample sample;
+            sample.temp_centi = helix::units::json_to_centidegrees(*obj, "temperature");
+            sample.target_centi = target_centi;
+            sample.timestamp_ms = timestamp_ms;
+            if (history.add(sample)) {
+                updated.push_back(name);
+            }
+        }
+    }
+
+    for (const auto& name : updated) {
+        notify_observers(name);
+    }
+}
+
+void TemperatureHistoryManager::update_from_delta(const helix::StatusDelta& delta,
+                                                  int64_t timestamp_ms) {
+    if (!delta.other.is_null()) {
+        update_from_status(delta.other, timestamp_ms);
+    }
+    if (delta.thermals.empty()) {
+        return;
+    }
+
+    std::vector<std::string> updated;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (const auto& sample : delta.thermals) {
+            // Extruder and bed are sampled from PrinterState subjects
+            if (sample.object == "extruder" || sample.object == "heater_bed") {
+                continue;
+            }
+
+            auto it = heaters_.find(sample.object);
+            if (it == heaters_.end()) {
+                continue;
+            }
+
+            int& target_centi = cached_status_targets_[sample.object];
+            if (sample.has(helix::ThermalSample::TARGET)) {
+                target_centi = helix::units::to_centidegrees(sample.target);
+            }
+            if (!sample.has(helix::ThermalSample::TEMPERATURE)) {
+                continue;
+            }
+
+            TempSample temp;
+            temp.temp_centi = helix::units::to_centidegrees(sample.temperature);
+            temp.target_centi = target_centi;
+            temp.timestamp_ms = timestamp_ms;
+            if (it->second.add(temp)) {
+                updated.push_back(sample.object);
+            }
+        }
+    }
+
+    for (const auto& name : updated) {
+        notify_observers(name);
+    }
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'H', 'T', 'M', 'P', 'H', 'I', 'S', 'T'};
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+} // namespace
+
+bool TemperatureHistoryManager::save_snapshot(const std::string& path) const {
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            spdlog::warn("TemperatureHistoryManager: cannot write snapshot {}", tmp_path);
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto count = static_cast<uint32_t>(heaters_.size());
+        out.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        out.write(reinterpret_cast<const char*>(&SNAPSHOT_VERSION), sizeof(SNAPSHOT_VERSION));
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& [name, history] : heaters_) {
+            auto name_len = static_cast<uint32_t>(name.size());
+            out.write(reinterpret_cast<const char*>(&name_len), sizeof(name_len));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+            history.save(out);
+        }
+        if (!out.flush()) {
+            spdlog::warn("TemperatureHistoryManager: failed writing snapshot {}", tmp_path);
+            return false;
+        }
+    }
+
+    // Rename so a power cut mid-write never leaves a truncated snapshot
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        spdlog::warn("TemperatureHistoryManager: cannot replace snapshot {}", path);
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool TemperatureHistoryManager::load_snapshot(const std::string& path, int64_t now_ms) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    char magic[sizeof(SNAPSHOT_MAGIC)] = {};
+    uint32_t version = 0;
+    uint32_t count = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!in || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 ||
+        version != SNAPSHOT_VERSION) {
+        spdlog::warn("TemperatureHistoryManager: ignoring invalid snapshot {}", path);
+        return false;
+    }
+
+    // Parse everything before touching live history so a bad file changes nothing
+    int64_t drop_before_ms = now_ms - SNAPSHOT_MAX_AGE_MS;
+    std::vector<std::pair<std::string, TieredTempHistory>> loaded;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t name_len = 0;
+        if (!in.read(reinterpret_cast<char*>(&name_len), sizeof(name_len)) || name_len > 256) {
+            spdlog::warn("TemperatureHistoryManager: truncated snapshot {}", path);
+            return false;
+        }
+        std::string name(name_len, '\0');
+        in.read(name.data(), name_len);
+        TieredTempHistory history;
+        if (!in || !history.load(in, drop_before_ms)) {
+            spdlog::warn("TemperatureHistoryManager: truncated snapshot {}", path);
+            return false;
+        }
+        loaded.emplace_back(std::move(name), std::move(history));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [name, history] : loaded) {
+            heaters_[name] = std::move(history);
+        }
+    }
+
+    spdlog::info("TemperatureHistoryManager: restored {} heaters from {}", loaded.size(), path);
+    return true;
 }
 
 // ============================================================================
@@ -208,35 +373,13 @@ bool TemperatureHistoryManager::add_sample_for_testing(const std::string& heater
 
 bool TemperatureHistoryManager::add_sample_internal(const std::string& heater_name, int temp_centi,
                                                     int target_centi, int64_t timestamp_ms) {
-    // Get or create heater history
-    HeaterHistory& history = heaters_[heater_name];
-
-    // Throttle: reject if within SAMPLE_INTERVAL_MS of last sample
-    if (history.last_sample_ms > 0 &&
-        (timestamp_ms - history.last_sample_ms) < SAMPLE_INTERVAL_MS) {
-        return false;
-    }
-
-    // Store sample in circular buffer
     TempSample sample;
     sample.temp_centi = temp_centi;
     sample.target_centi = target_centi;
     sample.timestamp_ms = timestamp_ms;
 
-    history.samples[static_cast<size_t>(history.write_index)] = sample;
-
-    // Advance write index (circular)
-    history.write_index = (history.write_index + 1) % HISTORY_SIZE;
-
-    // Update count (capped at HISTORY_SIZE)
-    if (history.count < HISTORY_SIZE) {
-        history.count++;
-    }
-
-    // Update last sample time for throttling
-    history.last_sample_ms = timestamp_ms;
-
-    return true;
+    // Get or create heater history; throttles to SAMPLE_INTERVAL_MS
+    return heaters_[heater_name].add(sample);
 }
 
 // ============================================================================
@@ -349,7 +492,8 @@ int TemperatureHistoryManager::get_cached_target(const std::string& heater_name)
     } else if (heater_name == "heater_bed") {
         return cached_bed_target_;
     }
-    return 0;
+    auto it = cached_status_targets_.find(heater_name);
+    return it != cached_status_targets_.end() ? it->second : 0;
 }
 
 void TemperatureHistoryManager::set_cached_target(const std::string& heater_name,
@@ -358,6 +502,8 @@ void TemperatureHistoryManager::set_cached_target(const std::string& heater_name
         cached_extruder_target_ = target_centi;
     } else if (heater_name == "heater_bed") {
         cached_bed_target_ = target_centi;
+    } else {
+        cached_status_targets_[heater_name] = target_centi;
     }
 }
 
@@ -366,15 +512,15 @@ void TemperatureHistoryManager::update_recent_sample_target(const std::string& h
     std::lock_guard<std::mutex> lock(mutex_);
 
     auto it = heaters_.find(heater_name);
-    if (it == heaters_.end() || it->second.count == 0) {
+    if (it == heaters_.end()) {
         return;
     }
 
-    HeaterHistory& history = it->second;
-
-    // Find the most recent sample
-    int recent_idx = (history.write_index - 1 + HISTORY_SIZE) % HISTORY_SIZE;
-    TempSample& recent = history.samples[static_cast<size_t>(recent_idx)];
+    TempSample* recent_ptr = it->second.latest();
+    if (recent_ptr == nullptr) {
+        return;
+    }
+    TempSample& recent = *recent_ptr;
 
     // Check if it was stored recently (within RECENT_SAMPLE_WINDOW_MS)
     using namespace std::chrono;
@@ -0,0 +1,166 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "temperature_history_ring.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<TempSample>::value && sizeof(TempSample) == 16,
+              "TempSample is persisted as raw bytes");
+
+// ============================================================================
+// TempSampleView
+// ============================================================================
+
+TempSampleView TempSampleView::since(int64_t since_ms) const {
+    // First index with timestamp_ms > since_ms
+    size_t lo = 0;
+    size_t hi = size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if ((*this)[mid].timestamp_ms > since_ms) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    if (lo >= first_size_) {
+        size_t skip = lo - first_size_;
+        return {second_ + skip, second_size_ - skip, nullptr, 0};
+    }
+    return {first_ + lo, first_size_ - lo, second_, second_size_};
+}
+
+std::vector<TempSample> TempSampleView::to_vector() const {
+    std::vector<TempSample> result;
+    result.reserve(size());
+    result.insert(result.end(), first_, first_ + first_size_);
+    result.insert(result.end(), second_, second_ + second_size_);
+    return result;
+}
+
+// ============================================================================
+// TempSampleRing
+// ============================================================================
+
+void TempSampleRing::push(const TempSample& sample) {
+    if (capacity_ == 0) {
+        return;
+    }
+    if (samples_.size() < capacity_) {
+        samples_.push_back(sample);
+        return;
+    }
+    samples_[head_] = sample;
+    head_ = (head_ + 1) % capacity_;
+}
+
+void TempSampleRing::clear() {
+    samples_.clear();
+    head_ = 0;
+}
+
+TempSample* TempSampleRing::latest() {
+    if (samples_.empty()) {
+        return nullptr;
+    }
+    size_t newest = (head_ + samples_.size() - 1) % samples_.size();
+    return &samples_[newest];
+}
+
+TempSampleView TempSampleRing::view() const {
+    // head_ is 0 until the ring fills, so a growing ring is a single run
+    const TempSample* data = samples_.data();
+    return {data + head_, samples_.size() - head_, data, head_};
+}
+
+// ============================================================================
+// TieredTempHistory
+// ============================================================================
+
+TieredTempHistory::TieredTempHistory() {
+    for (size_t i = 0; i < TIER_COUNT; ++i) {
+        rings_[i] = TempSampleRing(TIERS[i].capacity);
+    }
+}
+
+bool TieredTempHistory::add(const TempSample& sample) {
+    if (last_sample_ms_ > 0 && (sample.timestamp_ms - last_sample_ms_) < TIERS[0].interval_ms) {
+        return false;
+    }
+    rings_[0].push(sample);
+    last_sample_ms_ = sample.timestamp_ms;
+
+    // Average into the coarser tiers; a bucket is emitted once a sample lands
+    // in the next one, stamped with its last sample's time
+    for (size_t i = 1; i < TIER_COUNT; ++i) {
+        Bucket& bucket = buckets_[i];
+        int64_t index = sample.timestamp_ms / TIERS[i].interval_ms;
+        if (bucket.count > 0 && index != bucket.index) {
+            TempSample averaged;
+            averaged.temp_centi = static_cast<int>(bucket.temp_sum / bucket.count);
+            averaged.target_centi = bucket.target_centi;
+            averaged.timestamp_ms = bucket.last_timestamp_ms;
+            rings_[i].push(averaged);
+            bucket = Bucket{};
+        }
+        bucket.index = index;
+        bucket.temp_sum += sample.temp_centi;
+        bucket.target_centi = sample.target_centi;
+        bucket.count++;
+        bucket.last_timestamp_ms = sample.timestamp_ms;
+    }
+    return true;
+}
+
+TempSampleView TieredTempHistory::view_for_span(int64_t span_ms) const {
+    for (size_t i = 0; i < TIER_COUNT; ++i) {
+        if (span_ms <= TIERS[i].interval_ms * static_cast<int64_t>(TIERS[i].capacity)) {
+            return rings_[i].view();
+        }
+    }
+    return rings_[TIER_COUNT - 1].view();
+}
+
+void TieredTempHistory::save(std::ostream& out) const {
+    for (const auto& ring : rings_) {
+        TempSampleView view = ring.view();
+        auto count = static_cast<uint32_t>(view.size());
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const TempSample& sample : view) {
+            out.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+        }
+    }
+}
+
+bool TieredTempHistory::load(std::istream& in, int64_t drop_before_ms) {
+    *this = TieredTempHistory();
+
+    for (size_t i = 0; i < TIER_COUNT; ++i) {
+        uint32_t count = 0;
+        if (!in.read(reinterpret_cast<char*>(&count), sizeof(count)) ||
+            count > TIERS[i].capacity) {
+            *this = TieredTempHistory();
+            return false;
+        }
+        for (uint32_t n = 0; n < count; ++n) {
+            TempSample sample;
+            if (!in.read(reinterpret_cast<char*>(&sample), sizeof(sample))) {
+                *this = TieredTempHistory();
+                return false;
+            }
+            if (sample.timestamp_ms > drop_before_ms) {
+                rings_[i].push(sample);
+            }
+        }
+    }
+
+    if (TempSample* latest = rings_[0].latest()) {
+        last_sample_ms_ = latest->timestamp_ms;
+    }
+    return true;
+}
@@ -5,6 +5,7 @@
 
 #include "ui_nav_manager.h"
 #include "ui_panel_common.h"
+#include "ui_utils.h"
 
 #include <spdlog/spdlog.h>
 
@@ -39,6 +40,20 @@ void OverlayBase::cleanup() {
     visible_ = false;
 }
 
+void OverlayBase::evict() {
+    if (!overlay_root_) {
+        return;
+    }
+    spdlog::debug("[{}] Evicting widget tree", get_name());
+
+    on_evict();
+    NavigationManager::instance().unregister_overlay_instance(overlay_root_);
+    NavigationManager::instance().unregister_overlay_close_callback(overlay_root_);
+    lv_obj_safe_delete(overlay_root_);
+    overlay_root_ = nullptr;
+    visible_ = false;
+}
+
 lv_obj_t* OverlayBase::create_overlay_from_xml(lv_obj_t* parent, const char* component_name) {
     if (!parent) {
         spdlog::error("[{}] Cannot create: null parent", get_name());
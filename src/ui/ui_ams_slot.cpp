@@ -18,6 +18,7 @@
 #include "lvgl/src/xml/parsers/lv_xml_obj_parser.h"
 #include "observer_factory.h"
 #include "theme_manager.h"
+#include "xml_registration.h"
 
 #include <spdlog/spdlog.h>
 
@@ -784,7 +785,7 @@ static void ams_slot_xml_apply(lv_xml_parser_state_t* state, const char** attrs)
 
 void ui_ams_slot_register(void) {
     // Register the XML component first (defines the structural template)
-    lv_xml_register_component_from_file("A:ui_xml/ams_slot_view.xml");
+    helix::register_xml_component("A:ui_xml/ams_slot_view.xml");
 
     // Register the custom widget (uses the XML template + adds dynamic behavior)
     lv_xml_register_widget("ams_slot", ams_slot_xml_create, ams_slot_xml_apply);
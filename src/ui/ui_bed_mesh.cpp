@@ -475,11 +475,11 @@ void ui_bed_mesh_set_bounds(lv_obj_t* widget, double bed_x_min, double bed_x_max
         return;
     }
 
-    bed_mesh_renderer_set_bounds(data->renderer, bed_x_min, bed_x_max, bed_y_min, bed_y_max,
-                                 mesh_x_min, mesh_x_max, mesh_y_min, mesh_y_max);
-
     // Request redraw to show updated bounds
-    ui_bed_mesh_redraw(widget);
+    if (bed_mesh_renderer_set_bounds(data->renderer, bed_x_min, bed_x_max, bed_y_min, bed_y_max,
+                                     mesh_x_min, mesh_x_max, mesh_y_min, mesh_y_max)) {
+        ui_bed_mesh_redraw(widget);
+    }
 }
 
 /**
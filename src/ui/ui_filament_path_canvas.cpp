@@ -141,6 +141,11 @@ struct FilamentPathData {
 
     // Theme-derived font
     const lv_font_t* label_font = nullptr;
+
+    // Retained static layer: lanes, hub, sensors and toolhead rendered offscreen once per
+    // state change. Frames then blit it and draw only the animated tip and heat glow.
+    lv_draw_buf_t* static_buf = nullptr;
+    bool static_dirty = true;
 };
 
 // Load theme-aware colors, fonts, and sizes
@@ -186,6 +191,12 @@ static FilamentPathData* get_data(lv_obj_t* obj) {
     return (it != s_registry.end()) ? it->second : nullptr;
 }
 
+// State baked into the static layer changed - re-render it on the next draw
+static void mark_static_dirty(lv_obj_t* obj, FilamentPathData* data) {
+    data->static_dirty = true;
+    lv_obj_invalidate(obj);
+}
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
@@ -609,17 +620,8 @@ static void draw_heat_glow(lv_layer_t* layer, int32_t cx, int32_t cy, int32_t ra
 // tool with its own extruder. Unlike hub/linear topologies where filaments
 // converge to a single toolhead, parallel topology shows separate paths.
 
-static void draw_parallel_topology(lv_event_t* e, FilamentPathData* data) {
-    lv_obj_t* obj = lv_event_get_target_obj(e);
-    lv_layer_t* layer = lv_event_get_layer(e);
-
-    // Get widget dimensions
-    lv_area_t obj_coords;
-    lv_obj_get_coords(obj, &obj_coords);
-    int32_t height = lv_area_get_height(&obj_coords);
-    int32_t x_off = obj_coords.x1;
-    int32_t y_off = obj_coords.y1;
-
+static void draw_parallel_topology(lv_layer_t* layer, FilamentPathData* data, int32_t x_off,
+                                   int32_t y_off, int32_t height) {
     // Layout ratios for parallel topology (adjusted for per-slot toolheads)
     constexpr float ENTRY_Y = -0.12f;   // Top entry (connects to spool)
     constexpr float TOOLHEAD_Y = 0.55f; // Toolhead position per slot
@@ -707,28 +709,17 @@ static void draw_parallel_topology(lv_event_t* e, FilamentPathData* data) {
 // Main Draw Callback
 // ============================================================================
 
-static void filament_path_draw_cb(lv_event_t* e) {
-    lv_obj_t* obj = lv_event_get_target_obj(e);
-    lv_layer_t* layer = lv_event_get_layer(e);
-    FilamentPathData* data = get_data(obj);
-    if (!data)
-        return;
-
+// Everything that only changes with widget state: lanes, bypass, hub, sensors, toolhead.
+// Drawn into the retained static layer, or directly while the error pulse animates it.
+static void draw_static_path(lv_layer_t* layer, FilamentPathData* data, int32_t x_off,
+                             int32_t y_off, int32_t width, int32_t height) {
     // For PARALLEL topology (tool changers), use dedicated drawing function
     // This shows independent toolheads per slot instead of converging to a hub
     if (data->topology == static_cast<int>(PathTopology::PARALLEL)) {
-        draw_parallel_topology(e, data);
+        draw_parallel_topology(layer, data, x_off, y_off, height);
         return;
     }
 
-    // Get widget dimensions
-    lv_area_t obj_coords;
-    lv_obj_get_coords(obj, &obj_coords);
-    int32_t width = lv_area_get_width(&obj_coords);
-    int32_t height = lv_area_get_height(&obj_coords);
-    int32_t x_off = obj_coords.x1;
-    int32_t y_off = obj_coords.y1;
-
     // Calculate Y positions
     int32_t entry_y = y_off + (int32_t)(height * ENTRY_Y_RATIO);
     int32_t prep_y = y_off + (int32_t)(height * PREP_Y_RATIO);
@@ -766,12 +757,6 @@ static void filament_path_draw_cb(lv_event_t* e) {
     PathSegment error_seg = static_cast<PathSegment>(data->error_segment);
     PathSegment fil_seg = static_cast<PathSegment>(data->filament_segment);
 
-    // Animation state
-    bool is_animating = data->segment_anim_active;
-    int anim_progress = data->anim_progress;
-    PathSegment prev_seg = static_cast<PathSegment>(data->prev_segment);
-    bool is_loading = (data->anim_direction == AnimDirection::LOADING);
-
     // ========================================================================
     // Draw lane lines (one per slot, from entry to merge point)
     // Shows all installed filaments' colors, not just the active slot
@@ -1004,21 +989,46 @@ static void filament_path_draw_cb(lv_event_t* e) {
                            noz_color, line_active);
 
         // Extruder/print head icon (responsive size)
-        // Draw nozzle first so heat glow can render on top
+        // Heat glow is drawn on top of it by draw_path_overlays()
         if (data->use_faceted_toolhead) {
             draw_nozzle_faceted(layer, center_x, nozzle_y, noz_color, data->extruder_scale);
         } else {
             draw_nozzle_bambu(layer, center_x, nozzle_y, noz_color, data->extruder_scale);
         }
+    }
+}
 
-        // Draw heat glow around nozzle tip when heating (after nozzle so glow is visible)
-        if (data->heat_active) {
-            // Nozzle tip is at the bottom of the extruder
-            int32_t tip_y = nozzle_y + data->extruder_scale * 3; // Bottom of nozzle
-            draw_heat_glow(layer, center_x, tip_y, sensor_r, data->heat_pulse_opa);
-        }
+// Per-frame elements drawn over the static layer: heat glow and animated filament tip
+static void draw_path_overlays(lv_layer_t* layer, FilamentPathData* data, int32_t x_off,
+                               int32_t y_off, int32_t width, int32_t height) {
+    // Tool changers have no shared nozzle or moving tip
+    if (data->topology == static_cast<int>(PathTopology::PARALLEL))
+        return;
+
+    int32_t entry_y = y_off + (int32_t)(height * ENTRY_Y_RATIO);
+    int32_t prep_y = y_off + (int32_t)(height * PREP_Y_RATIO);
+    int32_t merge_y = y_off + (int32_t)(height * MERGE_Y_RATIO);
+    int32_t hub_y = y_off + (int32_t)(height * HUB_Y_RATIO);
+    int32_t output_y = y_off + (int32_t)(height * OUTPUT_Y_RATIO);
+    int32_t toolhead_y = y_off + (int32_t)(height * TOOLHEAD_Y_RATIO);
+    int32_t nozzle_y = y_off + (int32_t)(height * NOZZLE_Y_RATIO);
+    int32_t center_x = x_off + width / 2;
+    int32_t sensor_r = data->sensor_radius;
+
+    // Draw heat glow around nozzle tip when heating (after nozzle so glow is visible)
+    if (data->heat_active) {
+        // Nozzle tip is at the bottom of the extruder
+        int32_t tip_y = nozzle_y + data->extruder_scale * 3; // Bottom of nozzle
+        draw_heat_glow(layer, center_x, tip_y, sensor_r, data->heat_pulse_opa);
     }
 
+    // Animation state
+    bool is_animating = data->segment_anim_active;
+    int anim_progress = data->anim_progress;
+    PathSegment prev_seg = static_cast<PathSegment>(data->prev_segment);
+    PathSegment fil_seg = static_cast<PathSegment>(data->filament_segment);
+    bool is_loading = (data->anim_direction == AnimDirection::LOADING);
+
     // ========================================================================
     // Draw animated filament tip (during segment transitions)
     // ========================================================================
@@ -1079,11 +1089,100 @@ static void filament_path_draw_cb(lv_event_t* e) {
         }
 
         // Draw the glowing filament tip
-        draw_filament_tip(layer, tip_x, tip_y, active_color, sensor_r);
+        draw_filament_tip(layer, tip_x, tip_y, lv_color_hex(data->filament_color), sensor_r);
     }
+}
+
+// Re-render the static layer into its offscreen buffer if state or size changed.
+// Returns false if the buffer could not be allocated (caller draws directly).
+static bool update_static_layer(FilamentPathData* data, int32_t width, int32_t height) {
+    if (data->static_buf && ((int32_t)data->static_buf->header.w != width ||
+                             (int32_t)data->static_buf->header.h != height)) {
+        lv_draw_buf_destroy(data->static_buf);
+        data->static_buf = nullptr;
+    }
+
+    if (!data->static_buf) {
+        data->static_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888,
+                                              LV_STRIDE_AUTO);
+        if (!data->static_buf) {
+            spdlog::warn("[FilamentPath] Failed to create {}x{} static layer, drawing directly",
+                         width, height);
+            return false;
+        }
+        data->static_dirty = true;
+        spdlog::debug("[FilamentPath] Created {}x{} static layer", width, height);
+    }
+
+    if (!data->static_dirty)
+        return true;
+
+    lv_draw_buf_clear(data->static_buf, nullptr);
+
+    // Offscreen layer over the buffer (same approach as GCodeLayerRenderer's ghost cache)
+    lv_layer_t static_layer;
+    lv_memzero(&static_layer, sizeof(static_layer));
+    static_layer.draw_buf = data->static_buf;
+    static_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    static_layer.buf_area.x1 = 0;
+    static_layer.buf_area.y1 = 0;
+    static_layer.buf_area.x2 = width - 1;
+    static_layer.buf_area.y2 = height - 1;
+    static_layer._clip_area = static_layer.buf_area;
+    static_layer.phy_clip_area = static_layer.buf_area;
+
+    draw_static_path(&static_layer, data, 0, 0, width, height);
+
+    // Dispatch pending draw tasks (equivalent to lv_canvas_finish_layer)
+    lv_draw_dispatch_wait_for_request();
+    while (static_layer.draw_task_head) {
+        lv_draw_dispatch_layer(nullptr, &static_layer);
+        if (static_layer.draw_task_head) {
+            lv_draw_dispatch_wait_for_request();
+        }
+    }
+
+    data->static_dirty = false;
+    spdlog::trace("[FilamentPath] Static layer rebuilt: slots={}, active={}, segment={}",
+                  data->slot_count, data->active_slot, data->filament_segment);
+    return true;
+}
+
+static void filament_path_draw_cb(lv_event_t* e) {
+    lv_obj_t* obj = lv_event_get_target_obj(e);
+    lv_layer_t* layer = lv_event_get_layer(e);
+    FilamentPathData* data = get_data(obj);
+    if (!data)
+        return;
+
+    // Get widget dimensions
+    lv_area_t obj_coords;
+    lv_obj_get_coords(obj, &obj_coords);
+    int32_t width = lv_area_get_width(&obj_coords);
+    int32_t height = lv_area_get_height(&obj_coords);
+    int32_t x_off = obj_coords.x1;
+    int32_t y_off = obj_coords.y1;
+    if (width <= 0 || height <= 0)
+        return;
+
+    // The error pulse recolors the static path every frame, so skip the cache while it runs.
+    // DRAW_POST is clipped to the widget bounds, so the cached layer covers everything that
+    // direct drawing would show.
+    if (!data->error_pulse_active && update_static_layer(data, width, height)) {
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = data->static_buf;
+        lv_area_t coords = {x_off, y_off, x_off + width - 1, y_off + height - 1};
+        lv_draw_image(layer, &dsc, &coords);
+    } else {
+        draw_static_path(layer, data, x_off, y_off, width, height);
+    }
+
+    draw_path_overlays(layer, data, x_off, y_off, width, height);
 
     spdlog::trace("[FilamentPath] Draw: slots={}, active={}, segment={}, anim={}", data->slot_count,
-                  data->active_slot, data->filament_segment, is_animating ? anim_progress : -1);
+                  data->active_slot, data->filament_segment,
+                  data->segment_anim_active ? data->anim_progress : -1);
 }
 
 // ============================================================================
@@ -1149,6 +1248,9 @@ static void filament_path_delete_cb(lv_event_t* e) {
             lv_anim_delete(obj, segment_anim_cb);
             lv_anim_delete(obj, error_pulse_anim_cb);
             lv_anim_delete(obj, heat_pulse_anim_cb);
+            if (data->static_buf) {
+                lv_draw_buf_destroy(data->static_buf);
+            }
         }
         s_registry.erase(it);
         // data automatically freed when unique_ptr goes out of scope
@@ -1244,7 +1346,7 @@ static void filament_path_xml_apply(lv_xml_parser_state_t* state, const char** a
     }
 
     if (needs_redraw) {
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1296,43 +1398,44 @@ lv_obj_t* ui_filament_path_canvas_create(lv_obj_t* parent) {
 
 void ui_filament_path_canvas_set_topology(lv_obj_t* obj, int topology) {
     auto* data = get_data(obj);
-    if (data) {
+    if (data && data->topology != topology) {
         data->topology = topology;
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
 void ui_filament_path_canvas_set_slot_count(lv_obj_t* obj, int count) {
     auto* data = get_data(obj);
-    if (data) {
-        data->slot_count = LV_CLAMP(count, 1, 16);
-        lv_obj_invalidate(obj);
+    int clamped = LV_CLAMP(count, 1, 16);
+    if (data && data->slot_count != clamped) {
+        data->slot_count = clamped;
+        mark_static_dirty(obj, data);
     }
 }
 
 void ui_filament_path_canvas_set_slot_overlap(lv_obj_t* obj, int32_t overlap) {
     auto* data = get_data(obj);
-    if (data) {
+    if (data && data->slot_overlap != LV_MAX(overlap, 0)) {
         data->slot_overlap = LV_MAX(overlap, 0);
         spdlog::trace("[FilamentPath] Slot overlap set to {}px", data->slot_overlap);
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
 void ui_filament_path_canvas_set_slot_width(lv_obj_t* obj, int32_t width) {
     auto* data = get_data(obj);
-    if (data) {
+    if (data && data->slot_width != LV_MAX(width, 20)) {
         data->slot_width = LV_MAX(width, 20); // Minimum 20px
         spdlog::trace("[FilamentPath] Slot width set to {}px", data->slot_width);
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
 void ui_filament_path_canvas_set_active_slot(lv_obj_t* obj, int slot) {
     auto* data = get_data(obj);
-    if (data) {
+    if (data && data->active_slot != slot) {
         data->active_slot = slot;
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1350,9 +1453,8 @@ void ui_filament_path_canvas_set_filament_segment(lv_obj_t* obj, int segment) {
         data->filament_segment = new_segment;
         spdlog::debug("[FilamentPath] Segment changed: {} -> {} (animating)", old_segment,
                       new_segment);
+        mark_static_dirty(obj, data);
     }
-
-    lv_obj_invalidate(obj);
 }
 
 void ui_filament_path_canvas_set_error_segment(lv_obj_t* obj, int segment) {
@@ -1376,7 +1478,9 @@ void ui_filament_path_canvas_set_error_segment(lv_obj_t* obj, int segment) {
         spdlog::debug("[FilamentPath] Error cleared - stopping pulse");
     }
 
-    lv_obj_invalidate(obj);
+    if (new_error != old_error) {
+        mark_static_dirty(obj, data);
+    }
 }
 
 void ui_filament_path_canvas_set_anim_progress(lv_obj_t* obj, int progress) {
@@ -1389,14 +1493,17 @@ void ui_filament_path_canvas_set_anim_progress(lv_obj_t* obj, int progress) {
 
 void ui_filament_path_canvas_set_filament_color(lv_obj_t* obj, uint32_t color) {
     auto* data = get_data(obj);
-    if (data) {
+    if (data && data->filament_color != color) {
         data->filament_color = color;
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
 void ui_filament_path_canvas_refresh(lv_obj_t* obj) {
-    lv_obj_invalidate(obj);
+    auto* data = get_data(obj);
+    if (data) {
+        mark_static_dirty(obj, data);
+    }
 }
 
 void ui_filament_path_canvas_set_slot_callback(lv_obj_t* obj, filament_path_slot_cb_t cb,
@@ -1419,6 +1526,7 @@ void ui_filament_path_canvas_animate_segment(lv_obj_t* obj, int from_segment, in
     if (from != to) {
         start_segment_animation(obj, data, from, to);
         data->filament_segment = to;
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1437,7 +1545,7 @@ void ui_filament_path_canvas_stop_animations(lv_obj_t* obj) {
 
     stop_segment_animation(obj, data);
     stop_error_pulse(obj, data);
-    lv_obj_invalidate(obj);
+    mark_static_dirty(obj, data);
 }
 
 void ui_filament_path_canvas_set_slot_filament(lv_obj_t* obj, int slot_index, int segment,
@@ -1454,7 +1562,7 @@ void ui_filament_path_canvas_set_slot_filament(lv_obj_t* obj, int slot_index, in
         state.color = color;
         spdlog::trace("[FilamentPath] Slot {} filament: segment={}, color=0x{:06X}", slot_index,
                       segment, color);
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1474,7 +1582,7 @@ void ui_filament_path_canvas_clear_slot_filaments(lv_obj_t* obj) {
 
     if (changed) {
         spdlog::trace("[FilamentPath] Cleared all slot filament states");
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1486,7 +1594,7 @@ void ui_filament_path_canvas_set_bypass_active(lv_obj_t* obj, bool active) {
     if (data->bypass_active != active) {
         data->bypass_active = active;
         spdlog::debug("[FilamentPath] Bypass mode: {}", active ? "active" : "inactive");
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
@@ -1507,7 +1615,7 @@ void ui_filament_path_canvas_set_faceted_toolhead(lv_obj_t* obj, bool faceted) {
     if (data->use_faceted_toolhead != faceted) {
         data->use_faceted_toolhead = faceted;
         spdlog::debug("[FilamentPath] Toolhead style: {}", faceted ? "faceted" : "bambu");
-        lv_obj_invalidate(obj);
+        mark_static_dirty(obj, data);
     }
 }
 
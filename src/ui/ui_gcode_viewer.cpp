@@ -12,6 +12,7 @@
 #include "gcode_streaming_config.h"
 #include "gcode_streaming_controller.h"
 #include "memory_utils.h"
+#include "scoped_trace.h"
 #include "theme_manager.h"
 
 #include <filesystem>
@@ -129,6 +130,7 @@ class GCodeViewerState {
 
         // Launch new thread
         build_thread_ = std::thread([this, func = std::move(build_func)]() {
+            helix::trace::set_thread_name("gcode-build");
             func();
             building_.store(false);
         });
@@ -690,7 +692,8 @@ static void gcode_viewer_release_cb(lv_event_t* e) {
     }
 
     // If movement was minimal, treat as click and try to pick object
-    if (dx < CLICK_THRESHOLD && dy < CLICK_THRESHOLD && st->gcode_file) {
+    if (dx < CLICK_THRESHOLD && dy < CLICK_THRESHOLD &&
+        (st->gcode_file || st->streaming_controller_)) {
         spdlog::debug("[GCode Viewer] Click detected at ({}, {})", point.x, point.y);
         const char* picked = ui_gcode_viewer_pick_object(obj, point.x, point.y);
 
@@ -1086,8 +1089,11 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                 helix::gcode::GCodeParser parser;
                 std::string line;
 
-                while (std::getline(file, line)) {
-                    parser.parse_line(line);
+                {
+                    HELIX_TRACE_SCOPE("gcode", "parse");
+                    while (std::getline(file, line)) {
+                        parser.parse_line(line);
+                    }
                 }
 
                 file.close();
@@ -1130,6 +1136,7 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
 
                     // Build full geometry only on non-constrained systems
                     if (!memory_constrained) {
+                        HELIX_TRACE_SCOPE("gcode", "build_geometry");
                         helix::gcode::GeometryBuilder builder;
                         configure_builder(builder);
 
@@ -1152,6 +1159,7 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                     // More aggressive simplification for better frame rate during drag
                     // 2.0mm tolerance gives ~55% fewer triangles - good balance of quality/speed
                     {
+                        HELIX_TRACE_SCOPE("gcode", "build_coarse_geometry");
                         helix::gcode::GeometryBuilder coarse_builder;
                         configure_builder(coarse_builder);
 
@@ -1925,7 +1933,7 @@ float ui_gcode_viewer_get_nozzle_diameter_mm(lv_obj_t* obj) {
 
 const char* ui_gcode_viewer_pick_object(lv_obj_t* obj, int x, int y) {
     gcode_viewer_state_t* st = get_state(obj);
-    if (!st || !st->gcode_file)
+    if (!st)
         return nullptr;
 
     // Convert screen coordinates to widget-local coordinates
@@ -1938,8 +1946,14 @@ const char* ui_gcode_viewer_pick_object(lv_obj_t* obj, int x, int y) {
     spdlog::debug("[GCode Viewer] pick_object screen=({}, {}), widget_pos=({}, {}), local=({}, {})",
                   x, y, widget_coords.x1, widget_coords.y1, local_x, local_y);
 
-    auto result =
-        st->renderer_->pick_object(glm::vec2(local_x, local_y), *st->gcode_file, *st->camera_);
+    // Pick against what is on screen: the 2D layer view also covers streaming mode
+    std::optional<std::string> result;
+    if (st->is_using_2d_mode() && st->layer_renderer_2d_) {
+        result = st->layer_renderer_2d_->pick_object(glm::vec2(local_x, local_y));
+    } else if (st->gcode_file && st->renderer_) {
+        result =
+            st->renderer_->pick_object(glm::vec2(local_x, local_y), *st->gcode_file, *st->camera_);
+    }
 
     if (result) {
         // Store in static buffer (safe for single-threaded LVGL)
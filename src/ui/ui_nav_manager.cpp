@@ -14,6 +14,7 @@
 #include "observer_factory.h"
 #include "overlay_base.h"
 #include "printer_state.h" // For KlippyState enum
+#include "scoped_trace.h"
 #include "settings_manager.h"
 #include "theme_manager.h"
 
@@ -136,6 +137,7 @@ void NavigationManager::overlay_slide_out_complete_cb(lv_anim_t* anim) {
         if (mgr.panel_instances_[mgr.active_panel_]) {
             spdlog::trace("[NavigationManager] Activating main panel {} after overlay closed",
                           static_cast<int>(mgr.active_panel_));
+            HELIX_TRACE_SCOPE_DYNAMIC("panel", mgr.panel_instances_[mgr.active_panel_]->get_name());
             mgr.panel_instances_[mgr.active_panel_]->on_activate();
         }
     } else if (mgr.panel_stack_.size() > 1) {
@@ -145,6 +147,7 @@ void NavigationManager::overlay_slide_out_complete_cb(lv_anim_t* anim) {
         if (overlay_it != mgr.overlay_instances_.end() && overlay_it->second) {
             spdlog::trace("[NavigationManager] Activating previous overlay {}",
                           overlay_it->second->get_name());
+            HELIX_TRACE_SCOPE_DYNAMIC("panel", overlay_it->second->get_name());
             overlay_it->second->on_activate();
         }
     }
@@ -225,6 +228,8 @@ void NavigationManager::overlay_animate_slide_out(lv_obj_t* panel) {
             if (mgr.panel_instances_[mgr.active_panel_]) {
                 spdlog::trace("[NavigationManager] Activating main panel {} after overlay closed",
                               static_cast<int>(mgr.active_panel_));
+                HELIX_TRACE_SCOPE_DYNAMIC("panel",
+                                          mgr.panel_instances_[mgr.active_panel_]->get_name());
                 mgr.panel_instances_[mgr.active_panel_]->on_activate();
             }
         } else if (mgr.panel_stack_.size() > 1) {
@@ -233,6 +238,7 @@ void NavigationManager::overlay_animate_slide_out(lv_obj_t* panel) {
             if (overlay_it != mgr.overlay_instances_.end() && overlay_it->second) {
                 spdlog::trace("[NavigationManager] Activating previous overlay {}",
                               overlay_it->second->get_name());
+                HELIX_TRACE_SCOPE_DYNAMIC("panel", overlay_it->second->get_name());
                 overlay_it->second->on_activate();
             }
         }
@@ -698,6 +704,7 @@ void NavigationManager::set_active(ui_panel_id_t panel_id) {
     if (panel_instances_[panel_id]) {
         spdlog::trace("[NavigationManager] Calling on_activate() for panel {}",
                       static_cast<int>(panel_id));
+        HELIX_TRACE_SCOPE_DYNAMIC("panel", panel_instances_[panel_id]->get_name());
         panel_instances_[panel_id]->on_activate();
     }
 }
@@ -752,6 +759,7 @@ void NavigationManager::activate_initial_panel() {
     if (panel_instances_[active_panel_]) {
         spdlog::debug("[NavigationManager] Activating initial panel {}",
                       static_cast<int>(active_panel_));
+        HELIX_TRACE_SCOPE_DYNAMIC("panel", panel_instances_[active_panel_]->get_name());
         panel_instances_[active_panel_]->on_activate();
     }
 }
@@ -778,6 +786,39 @@ void NavigationManager::unregister_overlay_instance(lv_obj_t* widget) {
                       (void*)widget);
         overlay_instances_.erase(it);
     }
+    evictable_overlays_.erase(widget);
+}
+
+void NavigationManager::register_evictable_overlay(lv_obj_t* overlay_panel,
+                                                   std::function<void()> evict) {
+    if (!overlay_panel || !evict) {
+        return;
+    }
+    evictable_overlays_[overlay_panel] = {std::move(evict), lv_tick_get()};
+    spdlog::trace("[NavigationManager] Registered evictable overlay {}", (void*)overlay_panel);
+}
+
+size_t NavigationManager::evict_cold_overlays(uint32_t min_idle_ms) {
+    // Collect first: evict callbacks unregister and delete the widgets
+    std::vector<std::function<void()>> to_evict;
+    for (auto it = evictable_overlays_.begin(); it != evictable_overlays_.end();) {
+        bool in_stack = std::find(panel_stack_.begin(), panel_stack_.end(), it->first) !=
+                        panel_stack_.end();
+        if (!in_stack && lv_tick_elaps(it->second.last_hidden_tick) >= min_idle_ms) {
+            to_evict.push_back(std::move(it->second.evict));
+            it = evictable_overlays_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto& evict : to_evict) {
+        evict();
+    }
+    if (!to_evict.empty()) {
+        spdlog::info("[NavigationManager] Evicted {} cold overlay(s)", to_evict.size());
+    }
+    return to_evict.size();
 }
 
 void NavigationManager::push_overlay(lv_obj_t* overlay_panel, bool hide_previous) {
@@ -858,6 +899,7 @@ void NavigationManager::push_overlay(lv_obj_t* overlay_panel, bool hide_previous
                          (void*)overlay_panel);
         } else if (it->second) {
             spdlog::trace("[NavigationManager] Activating overlay {}", it->second->get_name());
+            HELIX_TRACE_SCOPE_DYNAMIC("panel", it->second->get_name());
             it->second->on_activate();
         }
 
@@ -966,6 +1008,10 @@ bool NavigationManager::go_back() {
                 lv_obj_del(it->second);
                 mgr.overlay_backdrops_.erase(it);
             }
+            auto ev = mgr.evictable_overlays_.find(popped);
+            if (ev != mgr.evictable_overlays_.end()) {
+                ev->second.last_hidden_tick = lv_tick_get();
+            }
         }
 
         // Hide backdrop if no more overlays
@@ -1030,6 +1076,7 @@ void NavigationManager::shutdown() {
     // Note: The actual panel objects are destroyed via StaticPanelRegistry,
     // we just clear our tracking references here
     overlay_instances_.clear();
+    evictable_overlays_.clear();
 
     // Clear panel instances
     for (auto& panel : panel_instances_) {
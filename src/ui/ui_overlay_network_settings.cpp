@@ -17,6 +17,7 @@
 #include "static_panel_registry.h"
 #include "wifi_manager.h"
 #include "wifi_ui_utils.h"
+#include "xml_registration.h"
 
 #include <lvgl/lvgl.h>
 #include <spdlog/spdlog.h>
@@ -229,7 +230,7 @@ lv_obj_t* NetworkSettingsOverlay::create(lv_obj_t* parent_screen) {
     // Register wifi_network_item component first
     static bool network_item_registered = false;
     if (!network_item_registered) {
-        lv_xml_register_component_from_file("A:ui_xml/wifi_network_item.xml");
+        helix::register_xml_component("A:ui_xml/wifi_network_item.xml");
         network_item_registered = true;
         spdlog::debug("[NetworkSettingsOverlay] Registered wifi_network_item component");
     }
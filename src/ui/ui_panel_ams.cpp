@@ -37,6 +37,7 @@
 #include "static_panel_registry.h"
 #include "theme_manager.h"
 #include "wizard_config_paths.h"
+#include "xml_registration.h"
 
 #include <spdlog/spdlog.h>
 
@@ -139,17 +140,17 @@ static void ensure_ams_widgets_registered() {
 
     // Register XML components (dryer card must be registered before ams_panel since it's used
     // there)
-    lv_xml_register_component_from_file("A:ui_xml/ams_dryer_card.xml");
-    lv_xml_register_component_from_file("A:ui_xml/dryer_presets_modal.xml");
+    helix::register_xml_component("A:ui_xml/ams_dryer_card.xml");
+    helix::register_xml_component("A:ui_xml/dryer_presets_modal.xml");
     // NOTE: Old AMS settings panels removed - Device Operations overlay is registered in
     // xml_registration.cpp
-    lv_xml_register_component_from_file("A:ui_xml/ams_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/ams_context_menu.xml");
-    lv_xml_register_component_from_file("A:ui_xml/ams_slot_edit_popup.xml");
-    lv_xml_register_component_from_file("A:ui_xml/spoolman_spool_item.xml");
-    lv_xml_register_component_from_file("A:ui_xml/spoolman_picker_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/ams_edit_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/ams_loading_error_modal.xml");
+    helix::register_xml_component("A:ui_xml/ams_panel.xml");
+    helix::register_xml_component("A:ui_xml/ams_context_menu.xml");
+    helix::register_xml_component("A:ui_xml/ams_slot_edit_popup.xml");
+    helix::register_xml_component("A:ui_xml/spoolman_spool_item.xml");
+    helix::register_xml_component("A:ui_xml/spoolman_picker_modal.xml");
+    helix::register_xml_component("A:ui_xml/ams_edit_modal.xml");
+    helix::register_xml_component("A:ui_xml/ams_loading_error_modal.xml");
     // NOTE: color_picker.xml is registered at startup in xml_registration.cpp
 
     s_ams_widgets_registered = true;
@@ -559,6 +560,7 @@ void AmsPanel::create_slots(int count) {
 
         // Store reference and setup click handler
         slot_widgets_[i] = slot;
+        refreshed_slot_versions_[i] = -1;
         lv_obj_set_user_data(slot, reinterpret_cast<void*>(static_cast<intptr_t>(i)));
         lv_obj_add_event_cb(slot, on_slot_clicked, LV_EVENT_CLICKED, this);
     }
@@ -749,8 +751,9 @@ void AmsPanel::update_path_canvas_from_backend() {
         return;
     }
 
-    // Get system info for slot count and topology
-    AmsSystemInfo info = backend->get_system_info();
+    // Get system info for slot count and topology (lock-free; this runs on every state change)
+    std::shared_ptr<const AmsSystemInfo> snapshot = backend->get_system_snapshot();
+    const AmsSystemInfo& info = *snapshot;
 
     // Set slot count from backend
     ui_filament_path_canvas_set_slot_count(path_canvas_, info.total_slots);
@@ -771,9 +774,8 @@ void AmsPanel::update_path_canvas_from_backend() {
     ui_filament_path_canvas_set_error_segment(path_canvas_, static_cast<int>(error_seg));
 
     // Set filament color from current slot's filament
-    if (info.current_slot >= 0) {
-        SlotInfo slot_info = backend->get_slot_info(info.current_slot);
-        ui_filament_path_canvas_set_filament_color(path_canvas_, slot_info.color_rgb);
+    if (const SlotInfo* slot_info = info.get_slot_global(info.current_slot)) {
+        ui_filament_path_canvas_set_filament_color(path_canvas_, slot_info->color_rgb);
     }
 
     // Set per-slot filament states for all slots with filament
@@ -781,10 +783,10 @@ void AmsPanel::update_path_canvas_from_backend() {
     ui_filament_path_canvas_clear_slot_filaments(path_canvas_);
     for (int i = 0; i < info.total_slots; ++i) {
         PathSegment slot_seg = backend->get_slot_filament_segment(i);
-        if (slot_seg != PathSegment::NONE) {
-            SlotInfo slot_info = backend->get_slot_info(i);
+        const SlotInfo* slot_info = info.get_slot_global(i);
+        if (slot_seg != PathSegment::NONE && slot_info) {
             ui_filament_path_canvas_set_slot_filament(path_canvas_, i, static_cast<int>(slot_seg),
-                                                      slot_info.color_rgb);
+                                                      slot_info->color_rgb);
         }
     }
 
@@ -1201,6 +1203,14 @@ void AmsPanel::update_slot_colors() {
     int slot_count = lv_subject_get_int(AmsState::instance().get_slot_count_subject());
     AmsBackend* backend = AmsState::instance().get_backend();
 
+    // Labels depend on the slot count and everything comes from the backend, so
+    // per-slot versions only hold while both stay the same
+    if (slot_count != refreshed_slot_count_ || backend != refreshed_backend_) {
+        std::fill(refreshed_slot_versions_, refreshed_slot_versions_ + MAX_VISIBLE_SLOTS, -1);
+        refreshed_slot_count_ = slot_count;
+        refreshed_backend_ = backend;
+    }
+
     for (int i = 0; i < MAX_VISIBLE_SLOTS; ++i) {
         if (!slot_widgets_[i]) {
             continue;
@@ -1214,6 +1224,14 @@ void AmsPanel::update_slot_colors() {
 
         lv_obj_remove_flag(slot_widgets_[i], LV_OBJ_FLAG_HIDDEN);
 
+        // Skip slots whose data hasn't changed since this widget last refreshed
+        lv_subject_t* version_subject = AmsState::instance().get_slot_version_subject(i);
+        int version = version_subject ? lv_subject_get_int(version_subject) : -1;
+        if (version >= 0 && version == refreshed_slot_versions_[i]) {
+            continue;
+        }
+        refreshed_slot_versions_[i] = version;
+
         // Get slot color from AmsState subject
         lv_subject_t* color_subject = AmsState::instance().get_slot_color_subject(i);
         if (color_subject) {
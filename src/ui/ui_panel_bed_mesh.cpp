@@ -34,7 +34,6 @@
 
 #include <cstdio>
 #include <cstring>
-#include <limits>
 
 // ============================================================================
 // Forward declarations for static event callbacks
@@ -54,6 +53,14 @@ static void on_save_config_yes_cb(lv_event_t* e);
 static void on_emergency_stop_cb(lv_event_t* e);
 static void on_save_profile_cb(lv_event_t* e);
 
+// Mock-built profiles may not carry stats; anything parsed by MoonrakerAPI does
+static helix::BedMeshStats stats_for(const BedMeshProfile& mesh) {
+    if (mesh.stats.valid) {
+        return mesh.stats;
+    }
+    return helix::compute_bed_mesh_stats(mesh.probed_matrix, mesh.mesh_min, mesh.mesh_max);
+}
+
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
@@ -232,6 +239,7 @@ lv_obj_t* BedMeshPanel::create(lv_obj_t* parent) {
 
     // Find canvas widget
     canvas_ = lv_obj_find_by_name(overlay_content, "bed_mesh_canvas");
+    shown_mesh_hash_ = 0;
     if (!canvas_) {
         spdlog::error("[{}] Canvas widget 'bed_mesh_canvas' not found in XML", get_name());
         return overlay_root_;
@@ -426,17 +434,7 @@ float BedMeshPanel::calculate_profile_range(const std::string& profile_name) {
         return 0.0f;
     }
 
-    float min_z = std::numeric_limits<float>::max();
-    float max_z = std::numeric_limits<float>::lowest();
-
-    for (const auto& row : mesh->probed_matrix) {
-        for (float z : row) {
-            min_z = std::min(min_z, z);
-            max_z = std::max(max_z, z);
-        }
-    }
-
-    return max_z - min_z;
+    return stats_for(*mesh).range;
 }
 
 // ============================================================================
@@ -454,6 +452,15 @@ void BedMeshPanel::set_mesh_data(const std::vector<std::vector<float>>& mesh_dat
         return;
     }
 
+    float bounds_min[2] = {static_cast<float>(cached_mesh_min_x_),
+                           static_cast<float>(cached_mesh_min_y_)};
+    float bounds_max[2] = {static_cast<float>(cached_mesh_max_x_),
+                           static_cast<float>(cached_mesh_max_y_)};
+    render_mesh(mesh_data, helix::compute_bed_mesh_stats(mesh_data, bounds_min, bounds_max));
+}
+
+void BedMeshPanel::render_mesh(const std::vector<std::vector<float>>& mesh_data,
+                               const helix::BedMeshStats& stats) {
     int rows = static_cast<int>(mesh_data.size());
     int cols = static_cast<int>(mesh_data[0].size());
 
@@ -467,7 +474,7 @@ void BedMeshPanel::set_mesh_data(const std::vector<std::vector<float>>& mesh_dat
         return;
     }
 
-    update_info_subjects(mesh_data, cols, rows);
+    update_info_subjects(stats, cols, rows);
 }
 
 void BedMeshPanel::redraw() {
@@ -487,21 +494,19 @@ void BedMeshPanel::setup_moonraker_subscription() {
 
     auto alive = alive_; // Capture shared_ptr by value for destruction detection [L012]
 
-    SubscriptionId id =
-        api->get_client().register_notify_update([this, api, alive](nlohmann::json notification) {
+    SubscriptionId id = api->get_client().register_status_update(
+        [this, api, alive](const std::shared_ptr<const helix::StatusDelta>& delta) {
             // Check destruction flag FIRST - panel may have been deleted
             if (!alive->load()) {
                 return;
             }
 
-            // Check if this notification contains bed_mesh data BEFORE deferring to main thread
+            // Check if this update contains bed_mesh data BEFORE deferring to main thread
             // This avoids unnecessary context switches for unrelated notifications
-            if (!notification.contains("params") || !notification["params"].is_array() ||
-                notification["params"].empty()) {
-                return;
-            }
-            const nlohmann::json& params = notification["params"][0];
-            if (!params.contains("bed_mesh") || !params["bed_mesh"].is_object()) {
+            // (bed_mesh has no typed slot, so it is always in `other`)
+            const nlohmann::json& status = delta->other;
+            auto mesh_it = status.find("bed_mesh");
+            if (mesh_it == status.end() || !mesh_it->is_object()) {
                 return;
             }
 
@@ -573,7 +578,7 @@ void BedMeshPanel::refresh_bed_bounds() {
     // If we have pending mesh data, render it now that bounds are valid
     if (has_pending_mesh_data_) {
         spdlog::debug("[{}] Rendering deferred mesh data", get_name());
-        set_mesh_data(pending_mesh_data_);
+        render_mesh(pending_mesh_data_, mesh_stats_);
         pending_mesh_data_.clear();
         has_pending_mesh_data_ = false;
     }
@@ -583,6 +588,16 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     spdlog::debug("[{}] on_mesh_update_internal called, probed_matrix.size={}", get_name(),
                   mesh.probed_matrix.size());
 
+    // Every status update repeats the whole bed_mesh object; the canvas already shows this one
+    if (canvas_ && mesh.content_hash != 0 && mesh.content_hash == shown_mesh_hash_ &&
+        mesh.name == shown_mesh_name_ && mesh.mesh_min[0] == cached_mesh_min_x_ &&
+        mesh.mesh_max[0] == cached_mesh_max_x_ && mesh.mesh_min[1] == cached_mesh_min_y_ &&
+        mesh.mesh_max[1] == cached_mesh_max_y_) {
+        spdlog::trace("[{}] Active mesh unchanged, skipping update", get_name());
+        return;
+    }
+    shown_mesh_hash_ = 0;
+
     if (mesh.probed_matrix.empty()) {
         lv_subject_set_int(&bed_mesh_available_, 0);
         lv_subject_copy_string(&bed_mesh_dimensions_, "No mesh data");
@@ -601,54 +616,26 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     std::snprintf(dimensions_buf_, sizeof(dimensions_buf_), "%dx%d", mesh.x_count, mesh.y_count);
     lv_subject_copy_string(&bed_mesh_dimensions_, dimensions_buf_);
 
-    // Calculate Z range with coordinates
-    float min_z = std::numeric_limits<float>::max();
-    float max_z = std::numeric_limits<float>::lowest();
-    int min_row = 0, min_col = 0;
-    int max_row = 0, max_col = 0;
-
-    for (size_t row = 0; row < mesh.probed_matrix.size(); row++) {
-        for (size_t col = 0; col < mesh.probed_matrix[row].size(); col++) {
-            float z = mesh.probed_matrix[row][col];
-            if (z < min_z) {
-                min_z = z;
-                min_row = static_cast<int>(row);
-                min_col = static_cast<int>(col);
-            }
-            if (z > max_z) {
-                max_z = z;
-                max_row = static_cast<int>(row);
-                max_col = static_cast<int>(col);
-            }
-        }
-    }
-
-    // Convert mesh indices to actual printer coordinates using mesh_min/mesh_max
-    // Klipper's probed_matrix: row 0 = mesh_min[1], row N-1 = mesh_max[1]
-    float x_step =
-        (mesh.x_count > 1) ? (mesh.mesh_max[0] - mesh.mesh_min[0]) / (mesh.x_count - 1) : 0.0f;
-    float y_step =
-        (mesh.y_count > 1) ? (mesh.mesh_max[1] - mesh.mesh_min[1]) / (mesh.y_count - 1) : 0.0f;
-    float min_x = mesh.mesh_min[0] + min_col * x_step;
-    float min_y = mesh.mesh_min[1] + min_row * y_step;
-    float max_x = mesh.mesh_min[0] + max_col * x_step;
-    float max_y = mesh.mesh_min[1] + max_row * y_step;
+    // Stats are computed once per distinct mesh by MoonrakerAPI
+    mesh_stats_ = stats_for(mesh);
+    const helix::BedMeshStats& stats = mesh_stats_;
 
     // Update max label and value
-    std::snprintf(max_label_buf_, sizeof(max_label_buf_), "Max [%.1f, %.1f]", max_x, max_y);
+    std::snprintf(max_label_buf_, sizeof(max_label_buf_), "Max [%.1f, %.1f]", stats.max_x,
+                  stats.max_y);
     lv_subject_copy_string(&bed_mesh_max_label_, max_label_buf_);
-    helix::fmt::format_distance_mm(max_z, 3, max_value_buf_, sizeof(max_value_buf_));
+    helix::fmt::format_distance_mm(stats.max_z, 3, max_value_buf_, sizeof(max_value_buf_));
     lv_subject_copy_string(&bed_mesh_max_value_, max_value_buf_);
 
     // Update min label and value
-    std::snprintf(min_label_buf_, sizeof(min_label_buf_), "Min [%.1f, %.1f]", min_x, min_y);
+    std::snprintf(min_label_buf_, sizeof(min_label_buf_), "Min [%.1f, %.1f]", stats.min_x,
+                  stats.min_y);
     lv_subject_copy_string(&bed_mesh_min_label_, min_label_buf_);
-    helix::fmt::format_distance_mm(min_z, 3, min_value_buf_, sizeof(min_value_buf_));
+    helix::fmt::format_distance_mm(stats.min_z, 3, min_value_buf_, sizeof(min_value_buf_));
     lv_subject_copy_string(&bed_mesh_min_value_, min_value_buf_);
 
     // Update variance (range)
-    float variance = max_z - min_z;
-    helix::fmt::format_distance_mm(variance, 3, variance_buf_, sizeof(variance_buf_));
+    helix::fmt::format_distance_mm(stats.range, 3, variance_buf_, sizeof(variance_buf_));
     lv_subject_copy_string(&bed_mesh_variance_, variance_buf_);
 
     // Cache mesh bounds
@@ -668,7 +655,11 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     if (has_valid_build_volume) {
         // Build volume available - set bounds and render immediately
         refresh_bed_bounds();
-        set_mesh_data(mesh.probed_matrix);
+        render_mesh(mesh.probed_matrix, stats);
+        if (canvas_) {
+            shown_mesh_hash_ = mesh.content_hash;
+            shown_mesh_name_ = mesh.name;
+        }
     } else {
         // Build volume not yet available - defer rendering until it arrives
         pending_mesh_data_ = mesh.probed_matrix;
@@ -677,25 +668,14 @@ void BedMeshPanel::on_mesh_update_internal(const BedMeshProfile& mesh) {
     }
 
     spdlog::info("[{}] Mesh updated: {} ({}x{}, Z: {:.3f} to {:.3f})", get_name(), mesh.name,
-                 mesh.x_count, mesh.y_count, min_z, max_z);
+                 mesh.x_count, mesh.y_count, stats.min_z, stats.max_z);
 }
 
-void BedMeshPanel::update_info_subjects(const std::vector<std::vector<float>>& mesh_data, int cols,
-                                        int rows) {
+void BedMeshPanel::update_info_subjects(const helix::BedMeshStats& stats, int cols, int rows) {
     std::snprintf(dimensions_buf_, sizeof(dimensions_buf_), "%dx%d points", cols, rows);
     lv_subject_copy_string(&bed_mesh_dimensions_, dimensions_buf_);
 
-    float min_z = std::numeric_limits<float>::max();
-    float max_z = std::numeric_limits<float>::lowest();
-    for (const auto& row : mesh_data) {
-        for (float val : row) {
-            min_z = std::min(min_z, val);
-            max_z = std::max(max_z, val);
-        }
-    }
-
-    float variance = max_z - min_z;
-    std::snprintf(variance_buf_, sizeof(variance_buf_), "%.3f mm", variance);
+    std::snprintf(variance_buf_, sizeof(variance_buf_), "%.3f mm", stats.range);
     lv_subject_copy_string(&bed_mesh_variance_, variance_buf_);
 }
 
@@ -557,17 +557,6 @@ void init_zoffset_row_handler() {
     spdlog::debug("[ZOffsetCal] Row click callback registered");
 }
 
-void init_zoffset_event_callbacks() {
-    // NOTE: Event callbacks are now registered by init_subjects() in the global instance.
-    // This function is kept for backward compatibility but is effectively a no-op
-    // if init_subjects() has already been called.
-    auto& overlay = get_global_zoffset_cal_panel();
-    if (!overlay.are_subjects_initialized()) {
-        overlay.init_subjects();
-    }
-    spdlog::debug("[ZOffsetCal] Event callbacks registration verified");
-}
-
 /**
  * @brief Row click handler for opening Z-Offset calibration from Advanced panel
  *
@@ -280,6 +280,14 @@ void ConsolePanel::on_deactivate() {
     OverlayBase::on_deactivate();
 }
 
+void ConsolePanel::on_evict() {
+    // Entries are children of console_container_ and go with it
+    console_container_ = nullptr;
+    empty_state_ = nullptr;
+    status_label_ = nullptr;
+    gcode_input_ = nullptr;
+}
+
 // ============================================================================
 // Data Loading
 // ============================================================================
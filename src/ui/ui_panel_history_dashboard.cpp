@@ -23,8 +23,6 @@
 #include <algorithm>
 #include <cmath>
 #include <ctime>
-#include <map>
-#include <sstream>
 
 // ============================================================================
 // Global Instance
@@ -309,6 +307,19 @@ void HistoryDashboardPanel::on_deactivate() {
     OverlayBase::on_deactivate();
 }
 
+void HistoryDashboardPanel::on_evict() {
+    // Charts and bar rows are children of overlay_root_ and go with it
+    filter_day_ = filter_week_ = filter_month_ = filter_year_ = filter_all_ = nullptr;
+    stat_total_prints_ = stat_print_time_ = stat_filament_ = stat_success_rate_ = nullptr;
+    stats_grid_ = charts_section_ = empty_state_ = btn_view_history_ = nullptr;
+    trend_chart_container_ = nullptr;
+    trend_chart_ = nullptr;
+    trend_series_ = nullptr;
+    trend_period_label_ = nullptr;
+    filament_chart_container_ = nullptr;
+    filament_bar_rows_.clear();
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -348,46 +359,46 @@ void HistoryDashboardPanel::refresh_data() {
         return;
     }
 
-    // Calculate time range based on filter
-    double since = 0.0;
-    double now = static_cast<double>(std::time(nullptr));
+    TrendWindow window = get_trend_window();
+    const PrintHistoryRollups& rollups = history_manager_->get_rollups();
 
-    switch (current_filter_) {
-    case HistoryTimeFilter::DAY:
-        since = now - (24 * 60 * 60);
-        break;
-    case HistoryTimeFilter::WEEK:
-        since = now - (7 * 24 * 60 * 60);
-        break;
-    case HistoryTimeFilter::MONTH:
-        since = now - (30 * 24 * 60 * 60);
-        break;
-    case HistoryTimeFilter::YEAR:
-        since = now - (365 * 24 * 60 * 60);
-        break;
-    case HistoryTimeFilter::ALL_TIME:
-    default:
-        since = 0.0;
-        break;
+    // Sum pre-aggregated buckets rather than scanning the job list
+    HistoryRollupBucket stats;
+    if (current_filter_ == HistoryTimeFilter::ALL_TIME) {
+        stats = rollups.totals();
+    } else {
+        int64_t last_key = window.first_key + window.point_count * window.group - 1;
+        stats = rollups.sum(window.period, window.first_key, last_key);
     }
 
-    spdlog::debug("[{}] Filtering history since {} (filter={})", get_name(), since,
+    spdlog::debug("[{}] {} jobs in window (filter={})", get_name(), stats.job_count,
                   static_cast<int>(current_filter_));
 
-    // Get time-filtered jobs from manager (DRY: uses shared cache)
-    cached_jobs_ = history_manager_->get_jobs_since(since);
-    spdlog::info("[{}] Got {} jobs from manager (filter={})", get_name(), cached_jobs_.size(),
-                 static_cast<int>(current_filter_));
+    update_statistics(stats, window);
+}
+
+std::vector<PrintHistoryJob> HistoryDashboardPanel::get_filtered_jobs() const {
+    if (!history_manager_) {
+        return {};
+    }
+    return history_manager_->get_jobs_since(get_filter_since());
+}
 
-    update_statistics(cached_jobs_);
+double HistoryDashboardPanel::get_filter_since() const {
+    if (current_filter_ == HistoryTimeFilter::ALL_TIME) {
+        return 0.0;
+    }
+    TrendWindow window = get_trend_window();
+    return PrintHistoryRollups::bucket_start(window.period, window.first_key);
 }
 
-void HistoryDashboardPanel::update_statistics(const std::vector<PrintHistoryJob>& jobs) {
+void HistoryDashboardPanel::update_statistics(const HistoryRollupBucket& stats,
+                                              const TrendWindow& window) {
     // Update subject to drive XML bindings (0=no jobs, 1=has jobs)
     // XML bindings will automatically show/hide stats, charts, and empty state
-    lv_subject_set_int(&history_has_jobs_subject_, jobs.empty() ? 0 : 1);
+    lv_subject_set_int(&history_has_jobs_subject_, stats.job_count == 0 ? 0 : 1);
 
-    if (jobs.empty()) {
+    if (stats.job_count == 0) {
         // Clear stats via subjects (bindings will update UI automatically)
         lv_subject_copy_string(&stat_total_prints_subject_, "0");
         lv_subject_copy_string(&stat_print_time_subject_, "0h");
@@ -396,27 +407,11 @@ void HistoryDashboardPanel::update_statistics(const std::vector<PrintHistoryJob>
         return;
     }
 
-    // Calculate statistics
-    uint64_t total_prints = jobs.size();
-    double total_time = 0.0;
-    double total_filament = 0.0;
-    uint64_t completed_count = 0;
-
-    for (const auto& job : jobs) {
-        total_time += job.print_duration;
-        total_filament += job.filament_used;
-
-        if (job.status == PrintJobStatus::COMPLETED) {
-            completed_count++;
-        }
-    }
-
-    // Calculate success rate
-    double success_rate = 0.0;
-    if (total_prints > 0) {
-        success_rate =
-            (static_cast<double>(completed_count) / static_cast<double>(total_prints)) * 100.0;
-    }
+    uint64_t total_prints = stats.job_count;
+    double total_time = stats.print_duration;
+    double total_filament = stats.filament_mm;
+    double success_rate =
+        (static_cast<double>(stats.completed_count) / static_cast<double>(total_prints)) * 100.0;
 
     // Update stat subjects (bindings will update UI automatically)
     char buf[32];
@@ -433,8 +428,8 @@ void HistoryDashboardPanel::update_statistics(const std::vector<PrintHistoryJob>
     lv_subject_copy_string(&stat_success_rate_subject_, buf);
 
     // Update charts
-    update_trend_chart(jobs);
-    update_filament_chart(jobs);
+    update_trend_chart(window);
+    update_filament_chart(stats);
 
     spdlog::debug("[{}] Stats updated: {} prints, {} time, {} filament, {:.0f}% success",
                   get_name(), total_prints, format_duration(total_time),
@@ -492,7 +487,8 @@ void HistoryDashboardPanel::create_trend_chart() {
 
     // Use line chart type
     lv_chart_set_type(trend_chart_, LV_CHART_TYPE_LINE);
-    lv_chart_set_point_count(trend_chart_, static_cast<uint32_t>(get_trend_period_count()));
+    int point_count = get_trend_window().point_count;
+    lv_chart_set_point_count(trend_chart_, static_cast<uint32_t>(point_count));
 
     // Styling for a clean sparkline look
     lv_obj_set_style_bg_opa(trend_chart_, LV_OPA_0, LV_PART_MAIN);
@@ -519,11 +515,11 @@ void HistoryDashboardPanel::create_trend_chart() {
     }
 
     // Initialize with zero data
-    for (int i = 0; i < get_trend_period_count(); i++) {
+    for (int i = 0; i < point_count; i++) {
         lv_chart_set_next_value(trend_chart_, trend_series_, 0);
     }
 
-    spdlog::debug("[{}] Trend chart created with {} points", get_name(), get_trend_period_count());
+    spdlog::debug("[{}] Trend chart created with {} points", get_name(), point_count);
 }
 
 void HistoryDashboardPanel::create_filament_chart() {
@@ -536,64 +532,66 @@ void HistoryDashboardPanel::create_filament_chart() {
     spdlog::debug("[{}] Filament chart container ready for labeled bars", get_name());
 }
 
-int HistoryDashboardPanel::get_trend_period_count() const {
-    // Number of data points for trend based on time filter
-    switch (current_filter_) {
-    case HistoryTimeFilter::DAY:
-        return 24; // Hourly for day view
-    case HistoryTimeFilter::WEEK:
-        return 7; // Daily for week view
-    case HistoryTimeFilter::MONTH:
-        return 30; // Daily for month view
-    case HistoryTimeFilter::YEAR:
-        return 12; // Monthly for year view
-    case HistoryTimeFilter::ALL_TIME:
-    default:
-        return 12; // Monthly-like buckets for all time
-    }
-}
+HistoryDashboardPanel::TrendWindow HistoryDashboardPanel::get_trend_window() const {
+    double now = static_cast<double>(std::time(nullptr));
+    TrendWindow window;
 
-double HistoryDashboardPanel::get_trend_period_seconds() const {
-    // Seconds per time bucket based on current filter
     switch (current_filter_) {
     case HistoryTimeFilter::DAY:
-        return 60 * 60; // 1 hour
+        window.period = HistoryRollupPeriod::HOUR;
+        window.point_count = 24;
+        break;
     case HistoryTimeFilter::WEEK:
-        return 24 * 60 * 60; // 1 day
+        window.period = HistoryRollupPeriod::DAY;
+        window.point_count = 7;
+        break;
     case HistoryTimeFilter::MONTH:
-        return 24 * 60 * 60; // 1 day
+        window.period = HistoryRollupPeriod::DAY;
+        window.point_count = 30;
+        break;
     case HistoryTimeFilter::YEAR:
-        return 30 * 24 * 60 * 60; // ~1 month
+        window.period = HistoryRollupPeriod::MONTH;
+        window.point_count = 12;
+        break;
     case HistoryTimeFilter::ALL_TIME:
-    default:
-        return 24 * 60 * 60; // 1 day
+    default: {
+        // Finest granularity whose 12 buckets reach back to the oldest job
+        window.point_count = 12;
+        window.period = HistoryRollupPeriod::MONTH;
+        const PrintHistoryRollups* rollups =
+            history_manager_ ? &history_manager_->get_rollups() : nullptr;
+        for (HistoryRollupPeriod period : {HistoryRollupPeriod::DAY, HistoryRollupPeriod::WEEK}) {
+            int64_t oldest = 0;
+            if (!rollups || !rollups->oldest_key(period, oldest) ||
+                PrintHistoryRollups::bucket_key(period, now) - oldest < window.point_count) {
+                window.period = period;
+                break;
+            }
+        }
+
+        int64_t oldest_month = 0;
+        if (window.period == HistoryRollupPeriod::MONTH && rollups &&
+            rollups->oldest_key(HistoryRollupPeriod::MONTH, oldest_month)) {
+            int64_t months = PrintHistoryRollups::bucket_key(window.period, now) - oldest_month + 1;
+            window.group = static_cast<int>((months + window.point_count - 1) / window.point_count);
+            window.group = std::max(window.group, 1);
+        }
+        break;
     }
+    }
+
+    // Newest point ends with the bucket containing now
+    int64_t now_key = PrintHistoryRollups::bucket_key(window.period, now);
+    window.first_key = now_key - static_cast<int64_t>(window.point_count) * window.group + 1;
+    return window;
 }
 
-void HistoryDashboardPanel::update_trend_chart(const std::vector<PrintHistoryJob>& jobs) {
+void HistoryDashboardPanel::update_trend_chart(const TrendWindow& window) {
     if (!trend_chart_ || !trend_series_) {
         return;
     }
 
-    int period_count = get_trend_period_count();
-    double period_seconds = get_trend_period_seconds();
-    double now = static_cast<double>(std::time(nullptr));
-
-    // For ALL_TIME, calculate period dynamically from oldest job
-    if (current_filter_ == HistoryTimeFilter::ALL_TIME && !jobs.empty()) {
-        // Find oldest job
-        double oldest_time = now;
-        for (const auto& job : jobs) {
-            if (job.end_time < oldest_time && job.end_time > 0) {
-                oldest_time = job.end_time;
-            }
-        }
-        // Calculate span and divide by bucket count
-        double span = now - oldest_time;
-        if (span > 0) {
-            period_seconds = span / static_cast<double>(period_count);
-        }
-    }
+    int period_count = window.point_count;
 
     // Update period label text via subject (binding will update UI automatically)
     const char* period_text = "Last 7 days";
@@ -616,22 +614,12 @@ void HistoryDashboardPanel::update_trend_chart(const std::vector<PrintHistoryJob
     }
     lv_subject_copy_string(&trend_period_subject_, period_text);
 
-    // Count prints per period bucket
+    // Prints per chart point, oldest on the left
+    std::vector<uint32_t> bucket_counts = history_manager_->get_rollups().job_counts(
+        window.period, window.first_key, period_count * window.group);
     std::vector<int> counts(static_cast<size_t>(period_count), 0);
-
-    for (const auto& job : jobs) {
-        // Calculate which period bucket this job falls into
-        double age = now - job.end_time;
-        if (age < 0)
-            age = 0;
-
-        int bucket = static_cast<int>(age / period_seconds);
-        // Bucket 0 is most recent, bucket (period_count-1) is oldest
-        // We want to display oldest on left, newest on right
-        int display_bucket = period_count - 1 - bucket;
-        if (display_bucket >= 0 && display_bucket < period_count) {
-            counts[static_cast<size_t>(display_bucket)]++;
-        }
+    for (size_t i = 0; i < bucket_counts.size(); i++) {
+        counts[i / static_cast<size_t>(window.group)] += static_cast<int>(bucket_counts[i]);
     }
 
     // Find max for Y-axis scaling
@@ -661,7 +649,7 @@ void HistoryDashboardPanel::update_trend_chart(const std::vector<PrintHistoryJob
                   max_count);
 }
 
-void HistoryDashboardPanel::update_filament_chart(const std::vector<PrintHistoryJob>& jobs) {
+void HistoryDashboardPanel::update_filament_chart(const HistoryRollupBucket& stats) {
     if (!filament_chart_container_) {
         return;
     }
@@ -672,48 +660,19 @@ void HistoryDashboardPanel::update_filament_chart(const std::vector<PrintHistory
     }
     filament_bar_rows_.clear();
 
-    // Aggregate filament by type
-    std::map<std::string, double> filament_by_type;
-
-    for (const auto& job : jobs) {
-        if (job.filament_type.empty()) {
-            filament_by_type["Unknown"] += job.filament_used;
-            continue;
-        }
-
-        // Split semicolon-separated filament types (OrcaSlicer multi-extruder format)
-        std::vector<std::string> types;
-        std::stringstream ss(job.filament_type);
-        std::string item;
-        while (std::getline(ss, item, ';')) {
-            // Trim whitespace
-            size_t start = item.find_first_not_of(" \t");
-            size_t end = item.find_last_not_of(" \t");
-            if (start != std::string::npos) {
-                types.push_back(item.substr(start, end - start + 1));
-            }
-        }
-
-        if (types.empty()) {
-            filament_by_type["Unknown"] += job.filament_used;
-        } else {
-            // Distribute filament proportionally among all extruders
-            double per_extruder = job.filament_used / static_cast<double>(types.size());
-            for (const auto& type : types) {
-                filament_by_type[type.empty() ? "Unknown" : type] += per_extruder;
-            }
-        }
-    }
-
-    if (filament_by_type.empty()) {
+    if (stats.filament_by_type.empty()) {
         return;
     }
 
     // Sort by usage (highest first) and take top 4 (limited space in side panel)
-    std::vector<std::pair<std::string, double>> sorted_types(filament_by_type.begin(),
-                                                             filament_by_type.end());
-    std::sort(sorted_types.begin(), sorted_types.end(),
-              [](const auto& a, const auto& b) { return a.second > b.second; });
+    std::vector<std::pair<std::string, double>> sorted_types;
+    sorted_types.reserve(stats.filament_by_type.size());
+    for (const auto& usage : stats.filament_by_type) {
+        sorted_types.emplace_back(usage.type, usage.usage_mm);
+    }
+    std::sort(sorted_types.begin(), sorted_types.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second || (a.second == b.second && a.first < b.first);
+    });
 
     if (sorted_types.size() > 4) {
         sorted_types.resize(4);
@@ -882,7 +841,7 @@ void HistoryDashboardPanel::on_view_history_clicked(lv_event_t* e) {
 
     // Pass the cached jobs to avoid redundant API calls
     const auto& dashboard = get_global_history_dashboard_panel();
-    list_panel.set_jobs(dashboard.get_cached_jobs());
+    list_panel.set_jobs(dashboard.get_filtered_jobs());
 
     // Ensure subjects and callbacks are initialized
     if (!list_panel.are_subjects_initialized()) {
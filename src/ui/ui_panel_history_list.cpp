@@ -1231,6 +1231,11 @@ void HistoryListPanel::confirm_delete() {
             [this, job_id, filename]() {
                 spdlog::info("[{}] Job deleted: {} ({})", get_name(), filename, job_id);
 
+                // Moonraker doesn't announce deletions; keep the shared cache in sync
+                if (history_manager_) {
+                    history_manager_->remove_job(job_id);
+                }
+
                 // Remove from jobs_ and filtered_jobs_
                 jobs_.erase(std::remove_if(
                                 jobs_.begin(), jobs_.end(),
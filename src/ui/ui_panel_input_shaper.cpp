@@ -3,18 +3,25 @@
 
 #include "ui_panel_input_shaper.h"
 
+#include "ui_frequency_response_chart.h"
 #include "ui_modal.h"
 #include "ui_nav.h"
 #include "ui_nav_manager.h"
 #include "ui_toast.h"
 
+#include "config.h"
 #include "format_utils.h"
+#include "input_shaper_cache.h"
 #include "moonraker_api.h"
 #include "moonraker_client.h"
+#include "platform_capabilities.h"
+#include "shaper_analysis.h"
 #include "static_panel_registry.h"
+#include "theme_manager.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdio>
 
 // ============================================================================
@@ -58,6 +65,7 @@ InputShaperPanel::~InputShaperPanel() {
     status_label_ = nullptr;
     error_message_ = nullptr;
     recommendation_label_ = nullptr;
+    chart_container_ = nullptr;
 
     // Guard against static destruction order fiasco (spdlog may be gone)
     if (!StaticPanelRegistry::is_destroyed()) {
@@ -83,6 +91,11 @@ static void on_input_shaper_row_clicked(lv_event_t* e) {
     if (!panel.get_root()) {
         spdlog::debug("[InputShaper] Creating input shaper panel...");
 
+        // Initialize subjects BEFORE XML creation
+        if (!panel.are_subjects_initialized()) {
+            panel.init_subjects();
+        }
+
         // Set API references before create
         MoonrakerClient* client = get_moonraker_client();
         MoonrakerAPI* api = get_moonraker_api();
@@ -146,9 +159,11 @@ void ui_panel_input_shaper_register_callbacks() {
         get_global_input_shaper_panel().handle_help_clicked();
     });
 
-    // Initialize subjects BEFORE XML creation
-    auto& panel = get_global_input_shaper_panel();
-    panel.init_subjects();
+    lv_xml_register_event_cb(nullptr, "input_shaper_less_smoothing_cb", [](lv_event_t* /*e*/) {
+        get_global_input_shaper_panel().handle_less_smoothing_clicked();
+    });
+
+    // Subjects are created on first open (on_input_shaper_row_clicked), not here
 
     spdlog::debug("[InputShaper] Registered XML event callbacks");
 }
@@ -191,6 +206,7 @@ void InputShaperPanel::init_subjects() {
         UI_MANAGED_SUBJECT_STRING_N(shaper_vib_subjects_[i], shaper_vib_bufs_[i],
                                     SHAPER_VALUE_BUF_SIZE, "", vib_name, subjects_);
     }
+    UI_MANAGED_SUBJECT_INT(can_refit_subject_, 0, "input_shaper_can_refit", subjects_);
 
     subjects_initialized_ = true;
     spdlog::debug("[InputShaper] Subjects initialized and registered");
@@ -242,6 +258,15 @@ void InputShaperPanel::setup_widgets() {
     error_message_ = lv_obj_find_by_name(overlay_root_, "error_message");
     recommendation_label_ = lv_obj_find_by_name(overlay_root_, "recommendation_label");
 
+    // Spectrum chart; EMBEDDED tier has no chart mode, so the container stays hidden
+    chart_container_ = lv_obj_find_by_name(overlay_root_, "chart_container");
+    if (chart_container_) {
+        chart_ = ui_frequency_response_chart_create(chart_container_);
+        ui_frequency_response_chart_configure_for_platform(
+            chart_, helix::PlatformCapabilities::detect().tier);
+        lv_obj_add_flag(chart_container_, LV_OBJ_FLAG_HIDDEN);
+    }
+
     // Set initial state
     set_state(State::IDLE);
 
@@ -291,6 +316,8 @@ void InputShaperPanel::on_activate() {
     // Reset to idle state
     set_state(State::IDLE);
     clear_results();
+    clear_chart();
+    lv_subject_set_int(&can_refit_subject_, 0);
 
     // Auto-start calibration for testing (env var)
     if (std::getenv("INPUT_SHAPER_AUTO_START")) {
@@ -327,11 +354,19 @@ void InputShaperPanel::cleanup() {
     // Call base class to set cleanup_called_ flag
     OverlayBase::cleanup();
 
+    // Chart state is ours; its widgets are deleted with the container
+    if (chart_) {
+        ui_frequency_response_chart_destroy(chart_);
+        chart_ = nullptr;
+        chart_series_.clear();
+    }
+
     // Clear references
     parent_screen_ = nullptr;
     status_label_ = nullptr;
     error_message_ = nullptr;
     recommendation_label_ = nullptr;
+    chart_container_ = nullptr;
 }
 
 // ============================================================================
@@ -508,23 +543,59 @@ void InputShaperPanel::on_calibration_result(const InputShaperResult& result) {
     spdlog::info("[InputShaper] Calibration complete: {} @ {:.1f} Hz (vib: {:.1f}%)",
                  result.shaper_type, result.shaper_freq, result.vibrations);
 
+    show_result(result);
+    store_results();
+    set_state(State::RESULTS);
+}
+
+void InputShaperPanel::show_result(const InputShaperResult& result) {
     // Store recommendation
     recommended_type_ = result.shaper_type;
     recommended_freq_ = result.shaper_freq;
 
-    // Create a single result entry for display
-    // Note: The collector currently only provides the recommended shaper
-    // A future enhancement could collect all fitted shapers
-    ShaperFit fit;
-    fit.type = result.shaper_type;
-    fit.frequency = result.shaper_freq;
-    fit.vibrations = result.vibrations;
-    fit.smoothing = result.smoothing;
-    fit.is_recommended = true;
-    shaper_results_.push_back(fit);
+    // List every fitted shaper when available (on-device analysis and parsed
+    // SHAPER_CALIBRATE output), otherwise just the recommendation
+    shaper_results_.clear();
+    if (result.all_shapers.empty()) {
+        ShaperFit fit;
+        fit.type = result.shaper_type;
+        fit.frequency = result.shaper_freq;
+        fit.vibrations = result.vibrations;
+        fit.smoothing = result.smoothing;
+        fit.is_recommended = true;
+        shaper_results_.push_back(fit);
+    } else {
+        for (const auto& option : result.all_shapers) {
+            ShaperFit fit;
+            fit.type = option.type;
+            fit.frequency = option.frequency;
+            fit.vibrations = option.vibrations;
+            fit.smoothing = option.smoothing;
+            fit.is_recommended = option.type == result.shaper_type;
+            shaper_results_.push_back(fit);
+        }
+    }
 
     populate_results();
-    set_state(State::RESULTS);
+    update_chart(result);
+
+    // Only on-device analysis keeps the spectrum needed to re-fit
+    lv_subject_set_int(&can_refit_subject_, result.freq_response.empty() ? 0 : 1);
+}
+
+void InputShaperPanel::store_results() {
+    if (!calibrator_) {
+        return;
+    }
+    // Results are per printer; the Moonraker endpoint identifies it
+    auto* cfg = Config::get_instance();
+    std::string printer_id = cfg->get<std::string>(cfg->df() + "moonraker_host", "") + ":" +
+                             std::to_string(cfg->get<int>(cfg->df() + "moonraker_port", 7125));
+
+    helix::calibration::InputShaperCache cache;
+    if (!cache.save_results(calibrator_->get_results(), printer_id)) {
+        spdlog::warn("[InputShaper] Failed to cache calibration results");
+    }
 }
 
 void InputShaperPanel::on_calibration_error(const std::string& message) {
@@ -587,6 +658,79 @@ void InputShaperPanel::clear_results() {
     }
 }
 
+void InputShaperPanel::clear_chart() {
+    for (int id : chart_series_) {
+        ui_frequency_response_chart_remove_series(chart_, id);
+    }
+    chart_series_.clear();
+    if (chart_container_) {
+        lv_obj_add_flag(chart_container_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void InputShaperPanel::update_chart(const InputShaperResult& result) {
+    if (!chart_ || !ui_frequency_response_chart_is_chart_mode(chart_)) {
+        return;
+    }
+    clear_chart();
+    // SHAPER_CALIBRATE output carries no spectrum
+    if (result.freq_response.empty()) {
+        return;
+    }
+
+    std::vector<float> freqs;
+    std::vector<float> psd;
+    freqs.reserve(result.freq_response.size());
+    psd.reserve(result.freq_response.size());
+    for (const auto& [freq, amplitude] : result.freq_response) {
+        freqs.push_back(freq);
+        psd.push_back(amplitude);
+    }
+    auto peak = std::max_element(psd.begin(), psd.end());
+    if (*peak <= 0.0f) {
+        return;
+    }
+    ui_frequency_response_chart_set_freq_range(chart_, freqs.front(), freqs.back());
+    ui_frequency_response_chart_set_amplitude_range(chart_, 0.0f, *peak);
+
+    int psd_id = ui_frequency_response_chart_add_series(chart_, "PSD",
+                                                        theme_manager_get_color("primary"));
+    if (psd_id >= 0) {
+        chart_series_.push_back(psd_id);
+        ui_frequency_response_chart_set_data(chart_, psd_id, freqs.data(), psd.data(),
+                                             freqs.size());
+        ui_frequency_response_chart_mark_peak(chart_, psd_id,
+                                              freqs[static_cast<size_t>(peak - psd.begin())],
+                                              *peak);
+    }
+
+    // Vibrations each fitted shaper leaves; the recommendation stands out
+    std::vector<float> shaped(psd.size());
+    for (const auto& option : result.all_shapers) {
+        auto response =
+            helix::calibration::shaper_response(option.type, option.frequency, freqs);
+        if (response.size() != psd.size()) {
+            continue;
+        }
+        for (size_t i = 0; i < psd.size(); ++i) {
+            shaped[i] = psd[i] * response[i];
+        }
+        bool recommended = option.type == result.shaper_type;
+        int id = ui_frequency_response_chart_add_series(
+            chart_, option.type.c_str(),
+            theme_manager_get_color(recommended ? "success" : "text_muted"));
+        if (id >= 0) {
+            chart_series_.push_back(id);
+            ui_frequency_response_chart_set_data(chart_, id, freqs.data(), shaped.data(),
+                                                 freqs.size());
+        }
+    }
+
+    if (chart_container_) {
+        lv_obj_remove_flag(chart_container_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
 void InputShaperPanel::update_status_label(const std::string& text) {
     if (status_label_) {
         lv_label_set_text(status_label_, text.c_str());
@@ -631,6 +775,37 @@ void InputShaperPanel::handle_apply_clicked() {
     apply_recommendation();
 }
 
+void InputShaperPanel::handle_less_smoothing_clicked() {
+    if (state_ != State::RESULTS || !calibrator_) {
+        return;
+    }
+    const auto& results = calibrator_->get_results();
+    const InputShaperResult& current =
+        last_calibrated_axis_ == 'X' ? results.x_result : results.y_result;
+    float previous_smoothing = current.smoothing;
+    std::string previous_type = current.shaper_type;
+    float previous_freq = current.shaper_freq;
+
+    // Re-fit the stored spectrum with a smoothing cap; no new resonance test
+    helix::calibration::ShaperFitOptions options;
+    options.max_smoothing = previous_smoothing * LESS_SMOOTHING_FACTOR;
+    spdlog::debug("[InputShaper] Less Smoothing clicked - re-fitting with max smoothing {:.3f}",
+                  options.max_smoothing);
+    if (!calibrator_->refit(last_calibrated_axis_, options)) {
+        ui_toast_show(ToastSeverity::ERROR, "Re-fit failed - run the calibration again", 3000);
+        return;
+    }
+
+    const InputShaperResult& refitted =
+        last_calibrated_axis_ == 'X' ? results.x_result : results.y_result;
+    if (refitted.shaper_type == previous_type && refitted.shaper_freq == previous_freq) {
+        ui_toast_show(ToastSeverity::INFO, "No shaper with less smoothing", 2500);
+        return;
+    }
+    show_result(refitted);
+    store_results();
+}
+
 void InputShaperPanel::handle_close_clicked() {
     spdlog::debug("[InputShaper] Close clicked");
     clear_results();
@@ -148,6 +148,16 @@ void MacrosPanel::on_deactivate() {
     OverlayBase::on_deactivate();
 }
 
+void MacrosPanel::on_evict() {
+    // Cards are children of overlay_root_ and go with it
+    macro_entries_.clear();
+    macro_list_container_ = nullptr;
+    empty_state_container_ = nullptr;
+    status_label_ = nullptr;
+    system_toggle_ = nullptr;
+    show_system_macros_ = false; // Recreated toggle starts unchecked
+}
+
 // ============================================================================
 // Macro List Management
 // ============================================================================
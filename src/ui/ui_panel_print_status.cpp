@@ -21,10 +21,12 @@
 
 #include "abort_manager.h"
 #include "app_globals.h"
+#include "async_helpers.h"
 #include "config.h"
 #include "display_manager.h"
 #include "filament_sensor_manager.h"
 #include "format_utils.h"
+#include "gcode_analysis_service.h"
 #include "injection_point_manager.h"
 #include "memory_utils.h"
 #include "moonraker_api.h"
@@ -40,6 +42,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -191,6 +194,8 @@ void PrintStatusPanel::init_subjects() {
                               "print_progress_text", subjects_);
     UI_MANAGED_SUBJECT_STRING(layer_text_subject_, layer_text_buf_, "Layer 0 / 0",
                               "print_layer_text", subjects_);
+    UI_MANAGED_SUBJECT_STRING(layer_time_subject_, layer_time_buf_, "", "print_layer_time",
+                              subjects_);
     UI_MANAGED_SUBJECT_STRING(elapsed_subject_, elapsed_buf_, "0h 00m", "print_elapsed", subjects_);
     UI_MANAGED_SUBJECT_STRING(remaining_subject_, remaining_buf_, "0h 00m", "print_remaining",
                               subjects_);
@@ -673,6 +678,7 @@ void PrintStatusPanel::update_all_displays() {
     std::snprintf(layer_text_buf_, sizeof(layer_text_buf_), "Layer %d / %d", current_layer_,
                   total_layers_);
     lv_subject_copy_string(&layer_text_subject_, layer_text_buf_);
+    update_layer_time_display();
 
     // Time displays
     format_time(elapsed_seconds_, elapsed_buf_, sizeof(elapsed_buf_));
@@ -1094,6 +1100,9 @@ void PrintStatusPanel::on_print_state_changed(PrintJobState job_state) {
                 loaded_thumbnail_filename_.clear();
                 cached_thumbnail_path_.clear();
                 pending_gcode_filename_.clear();
+                fetching_gcode_filename_.clear();
+                viewer_waiting_filename_.clear();
+                layer_durations_.clear();
                 gcode_loaded_ = false;
                 cleanup_temp_gcode();
 
@@ -1263,6 +1272,7 @@ void PrintStatusPanel::on_print_layer_changed(int current_layer) {
     std::snprintf(layer_text_buf_, sizeof(layer_text_buf_), "Layer %d / %d", current_layer_,
                   total_layers_);
     lv_subject_copy_string(&layer_text_subject_, layer_text_buf_);
+    update_layer_time_display();
 
     // Update G-code viewer ghost layer if viewer is active and visible
     if (gcode_viewer_ && !lv_obj_has_flag(gcode_viewer_, LV_OBJ_FLAG_HIDDEN)) {
@@ -1722,16 +1732,40 @@ void PrintStatusPanel::load_gcode_for_viewing(const std::string& filename) {
         return;
     }
 
-    // Generate temp file path - check if we already have a cached copy
+    // Shares the download started for the print analysis, if any
+    viewer_waiting_filename_ = filename;
+    fetch_print_gcode(filename);
+}
+
+std::string PrintStatusPanel::gcode_temp_path(const std::string& filename) const {
     // Use persistent cache directory (not /tmp which may be RAM-backed on embedded)
     std::string cache_dir = get_helix_cache_dir("gcode_temp");
     if (cache_dir.empty()) {
-        spdlog::warn("[{}] No writable cache directory - skipping G-code preview", get_name());
-        show_gcode_viewer(false);
+        return "";
+    }
+    return cache_dir + "/print_view_" + std::to_string(std::hash<std::string>{}(filename)) +
+           ".gcode";
+}
+
+void PrintStatusPanel::fetch_print_gcode(const std::string& filename) {
+    if (!api_ || fetching_gcode_filename_ == filename) {
+        return; // Already fetching; the viewer is served when it completes
+    }
+
+    // The analysis reads the viewer's local copy, so it is off with the viewer
+    auto* cfg = Config::get_instance();
+    if (!cfg->get<bool>("/display/gcode_3d_enabled", true)) {
+        spdlog::debug("[{}] G-code rendering disabled via config - skipping download", get_name());
+        on_print_gcode_unavailable(filename);
+        return;
+    }
+
+    std::string temp_path = gcode_temp_path(filename);
+    if (temp_path.empty()) {
+        spdlog::warn("[{}] No writable cache directory - skipping G-code download", get_name());
+        on_print_gcode_unavailable(filename);
         return;
     }
-    std::string temp_path =
-        cache_dir + "/print_view_" + std::to_string(std::hash<std::string>{}(filename)) + ".gcode";
 
     // Check if file already exists and is non-empty (cached from previous session)
     std::ifstream cached_file(temp_path, std::ios::binary | std::ios::ate);
@@ -1743,18 +1777,25 @@ void PrintStatusPanel::load_gcode_for_viewing(const std::string& filename) {
         if (helix::is_gcode_2d_streaming_safe(cached_size)) {
             spdlog::info("[{}] Using cached G-code file ({} bytes): {}", get_name(), cached_size,
                          temp_path);
-            temp_gcode_path_ = temp_path;
-            load_gcode_file(temp_path.c_str());
-            return;
+            on_print_gcode_fetched(filename, temp_path);
         } else {
             spdlog::debug("[{}] Cached file too large for 2D streaming, removing", get_name());
             std::remove(temp_path.c_str());
+            on_print_gcode_unavailable(filename);
         }
+        return;
+    }
+
+    // Clean up previous temp file if any
+    if (!temp_gcode_path_.empty() && temp_gcode_path_ != temp_path) {
+        std::remove(temp_gcode_path_.c_str());
+        temp_gcode_path_.clear();
     }
 
     // Get file metadata to check size before downloading
     // This prevents OOM on memory-constrained devices like AD5M
     std::string metadata_filename = resolve_gcode_filename(filename);
+    fetching_gcode_filename_ = filename;
 
     // Capture alive flag for shutdown safety [L012]
     auto alive = m_alive;
@@ -1763,7 +1804,7 @@ void PrintStatusPanel::load_gcode_for_viewing(const std::string& filename) {
         metadata_filename,
         [this, alive, filename, temp_path](const FileMetadata& metadata) {
             // Abort if panel was destroyed during async operation
-            if (!alive->load()) {
+            if (!alive->load() || fetching_gcode_filename_ != filename) {
                 return;
             }
             // Check if 2D streaming rendering is safe for this file size + available RAM
@@ -1778,48 +1819,43 @@ void PrintStatusPanel::load_gcode_for_viewing(const std::string& filename) {
                     "[{}] G-code too large for 2D streaming: file={} bytes, available RAM={}MB "
                     "- using thumbnail only",
                     get_name(), metadata.size, mem.available_mb());
-                // Revert to thumbnail mode since rendering is not safe
-                show_gcode_viewer(false);
+                fetching_gcode_filename_.clear();
+                on_print_gcode_unavailable(filename);
                 return;
             }
 
             spdlog::debug("[{}] G-code size {} bytes - safe to render, streaming to disk...",
                           get_name(), metadata.size);
 
-            // Clean up previous temp file if any
-            if (!temp_gcode_path_.empty() && temp_gcode_path_ != temp_path) {
-                std::remove(temp_gcode_path_.c_str());
-                temp_gcode_path_.clear();
-            }
-
             // Stream download directly to disk (no memory spike)
             // For mock mode, this copies from test_gcodes/ directory
             // For real mode, this streams from Moonraker using libhv's chunked download
             api_->download_file_to_path(
                 "gcodes", filename, temp_path,
-                [this, alive, temp_path](const std::string& path) {
+                [this, alive, filename](const std::string& path) {
                     // Abort if panel was destroyed during download [L012]
                     if (!alive->load()) {
                         return;
                     }
-                    // Track the temp file for cleanup
-                    temp_gcode_path_ = path;
-
-                    spdlog::info("[{}] Streamed G-code to disk, loading into viewer: {}",
-                                 get_name(), path);
-
-                    // Load into the viewer widget
-                    load_gcode_file(path.c_str());
+                    if (fetching_gcode_filename_ != filename) {
+                        std::remove(path.c_str()); // Print ended or changed meanwhile
+                        return;
+                    }
+                    spdlog::info("[{}] Streamed G-code to disk: {}", get_name(), path);
+                    fetching_gcode_filename_.clear();
+                    on_print_gcode_fetched(filename, path);
                 },
                 [this, alive, filename](const MoonrakerError& err) {
                     // Abort if panel was destroyed during download [L012]
                     if (!alive->load()) {
                         return;
                     }
-                    spdlog::warn("[{}] Failed to stream G-code for viewing '{}': {}", get_name(),
-                                 filename, err.message);
-                    // Revert to thumbnail mode on download failure
-                    show_gcode_viewer(false);
+                    spdlog::warn("[{}] Failed to stream G-code '{}': {}", get_name(), filename,
+                                 err.message);
+                    if (fetching_gcode_filename_ == filename) {
+                        fetching_gcode_filename_.clear();
+                    }
+                    on_print_gcode_unavailable(filename);
                 });
         },
         [this, alive, filename](const MoonrakerError& err) {
@@ -1827,15 +1863,95 @@ void PrintStatusPanel::load_gcode_for_viewing(const std::string& filename) {
             if (!alive->load()) {
                 return;
             }
-            spdlog::debug("[{}] Failed to get G-code metadata for '{}': {} - skipping 3D render",
+            spdlog::debug("[{}] Failed to get G-code metadata for '{}': {} - skipping download",
                           get_name(), filename, err.message);
-            // Revert to thumbnail mode on metadata fetch failure
-            show_gcode_viewer(false);
+            if (fetching_gcode_filename_ == filename) {
+                fetching_gcode_filename_.clear();
+            }
+            on_print_gcode_unavailable(filename);
         },
         true // silent - don't trigger RPC_ERROR event/toast
     );
 }
 
+void PrintStatusPanel::on_print_gcode_unavailable(const std::string& filename) {
+    if (viewer_waiting_filename_ == filename) {
+        viewer_waiting_filename_.clear();
+        // Revert to thumbnail mode: nothing to render
+        show_gcode_viewer(false);
+    }
+}
+
+void PrintStatusPanel::on_print_gcode_fetched(const std::string& filename,
+                                              const std::string& path) {
+    // Track the temp file for cleanup
+    temp_gcode_path_ = path;
+    load_print_time_table(filename, path);
+
+    if (viewer_waiting_filename_ == filename) {
+        viewer_waiting_filename_.clear();
+        spdlog::info("[{}] Loading G-code into viewer: {}", get_name(), path);
+        load_gcode_file(path.c_str());
+    }
+}
+
+void PrintStatusPanel::load_print_time_table(const std::string& filename,
+                                             const std::string& path) {
+    // Planned with the configured limits set at discovery (defaults until then)
+    using helix::gcode::GCodeAnalysisService;
+    auto alive = m_alive;
+    GCodeAnalysisService::instance().request(
+        path,
+        [this, alive, filename](GCodeAnalysisService::AnalysisPtr a) {
+            if (!a || a->time_table.empty()) {
+                return;
+            }
+            // Moonraker counts printed layers; a Z move without extrusion
+            // (e.g. a z-hop) is timed with the layer before it
+            std::vector<float> durations;
+            for (const auto& stats : a->layer_stats) {
+                if (stats.extrusion_moves > 0 || durations.empty()) {
+                    durations.push_back(stats.duration_s);
+                } else {
+                    durations.back() += stats.duration_s;
+                }
+            }
+            // Aliasing pointer: keeps the analysis alive for its table
+            std::shared_ptr<const helix::gcode::PrintTimeTable> table(a, &a->time_table);
+            helix::async::invoke(
+                [this, alive, filename, table, durations = std::move(durations)]() mutable {
+                    if (!alive->load()) {
+                        return;
+                    }
+                    printer_state_.set_print_time_table(filename, table);
+                    layer_durations_ = std::move(durations);
+                    update_layer_time_display();
+                });
+        },
+        GCodeAnalysisService::Freshness::TIME_TABLE);
+}
+
+void PrintStatusPanel::update_layer_time_display() {
+    if (!subjects_initialized_) {
+        return;
+    }
+    // Map Moonraker's 1-based layer onto the analysis layers, like the viewer's ghost layer
+    layer_time_buf_[0] = '\0';
+    if (current_layer_ > 0 && !layer_durations_.empty()) {
+        size_t count = layer_durations_.size();
+        size_t index = static_cast<size_t>(current_layer_ - 1);
+        if (total_layers_ > 0) {
+            index = index * count / static_cast<size_t>(total_layers_);
+        }
+        if (index < count) {
+            int seconds = static_cast<int>(layer_durations_[index] + 0.5f);
+            std::snprintf(layer_time_buf_, sizeof(layer_time_buf_), "This layer ~%s",
+                          helix::fmt::duration(std::max(seconds, 1)).c_str());
+        }
+    }
+    lv_subject_copy_string(&layer_time_subject_, layer_time_buf_);
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -1863,6 +1979,11 @@ void PrintStatusPanel::set_filename(const char* filename) {
         spdlog::debug("[{}] Loading thumbnail for: {}", get_name(), effective_filename);
         load_thumbnail_for_file(effective_filename);
 
+        // Layer times and time left need the analysis even while the panel is hidden
+        layer_durations_.clear();
+        update_layer_time_display();
+        fetch_print_gcode(effective_filename);
+
         // G-code loading: immediate if panel active, deferred otherwise
         if (is_active_) {
             // Panel is already visible - load immediately instead of deferring
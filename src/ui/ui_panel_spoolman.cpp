@@ -140,6 +140,11 @@ void SpoolmanPanel::on_deactivate() {
     OverlayBase::on_deactivate();
 }
 
+void SpoolmanPanel::on_evict() {
+    // Rows are children of spool_list_ and go with it
+    spool_list_ = nullptr;
+}
+
 // ============================================================================
 // Data Loading
 // ============================================================================
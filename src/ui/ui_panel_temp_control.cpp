@@ -1090,7 +1090,8 @@ void TempControlPanel::replay_history_from_manager(ui_temp_graph_t* graph, int s
         return;
     }
 
-    auto samples = mgr->get_samples(heater_name);
+    // Main thread: view straight into the history ring, no copy
+    TempSampleView samples = mgr->get_view(heater_name);
     if (samples.empty()) {
         spdlog::debug("[TempPanel] No history samples from manager for {}", heater_name);
         return;
@@ -1222,7 +1223,7 @@ void TempControlPanel::replay_history_to_mini_graph() {
             return;
         }
 
-        auto samples = mgr->get_samples_since(heater_name, cutoff_ms);
+        TempSampleView samples = mgr->get_view(heater_name).since(cutoff_ms);
         if (samples.empty()) {
             return;
         }
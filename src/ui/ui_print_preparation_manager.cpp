@@ -16,6 +16,7 @@
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 #include <map>
@@ -414,23 +415,58 @@ void PrintPreparationManager::scan_file_for_operations(const std::string& filena
     spdlog::info("[PrintPreparationManager] Scanning G-code for embedded operations: {}",
                  file_path);
 
-    auto* self = this;
-    auto alive = alive_guard_; // Capture shared_ptr to detect destruction
-
-    // Use partial download - only first 200KB is needed for preamble scanning
+    // Use partial download - only the preamble is needed for scanning
     // (thumbnails + slicer metadata + START_PRINT call + any early G-code ops)
     // This avoids downloading multi-MB files just to scan the first few hundred lines
-    constexpr size_t SCAN_DOWNLOAD_LIMIT = 200 * 1024; // 200KB
+    scan_preamble(filename, file_path, SCAN_DOWNLOAD_LIMIT);
+}
+
+void PrintPreparationManager::scan_preamble(const std::string& filename,
+                                            const std::string& file_path, size_t window) {
+    auto* self = this;
+    auto alive = alive_guard_; // Capture shared_ptr to detect destruction
 
     api_->download_file_partial(
-        "gcodes", file_path, SCAN_DOWNLOAD_LIMIT,
+        "gcodes", file_path, window,
         // Success: parse content and cache result
         // NOTE: This callback runs on a background HTTP thread, so we must defer
         // shared state updates and LVGL calls to the main thread via lv_async_call
-        [self, alive, filename](const std::string& content) {
+        [self, alive, filename, file_path, window](const std::string& content) {
+            // A full window means the file continues; drop the cut-off last line
+            bool truncated = content.size() >= window;
+            size_t scan_end = content.size();
+            if (truncated) {
+                size_t last_newline = content.rfind('\n');
+                scan_end = last_newline == std::string::npos ? 0 : last_newline + 1;
+            }
+
             // Parse on background thread (safe - no shared state access)
             gcode::GCodeOpsDetector detector;
-            auto scan_result = detector.scan_content(content);
+            auto scan_result = detector.scan_content(content.substr(0, scan_end));
+
+            // Preamble continues past the window: fetch a larger one from the main thread
+            if (truncated && scan_result.reached_end && window < SCAN_DOWNLOAD_MAX) {
+                size_t next_window = std::min(window * 2, SCAN_DOWNLOAD_MAX);
+                spdlog::debug("[PrintPreparationManager] Preamble of {} exceeds {} bytes, "
+                              "retrying with {}", filename, window, next_window);
+                struct ScanRetryData {
+                    PrintPreparationManager* mgr;
+                    std::shared_ptr<bool> alive_guard;
+                    std::string filename;
+                    std::string file_path;
+                    size_t window;
+                };
+                ui_queue_update<ScanRetryData>(
+                    std::make_unique<ScanRetryData>(
+                        ScanRetryData{self, alive, filename, file_path, next_window}),
+                    [](ScanRetryData* d) {
+                        if (!d->alive_guard || !*d->alive_guard || !d->mgr->api_) {
+                            return;
+                        }
+                        d->mgr->scan_preamble(d->filename, d->file_path, d->window);
+                    });
+                return;
+            }
 
             // Log on background thread (spdlog is thread-safe)
             if (scan_result.operations.empty()) {
@@ -1298,14 +1334,19 @@ void PrintPreparationManager::modify_and_print_streaming(
                 }
             }
 
-            auto result = modifier.apply_streaming(local_download_path);
+            // The download is our own copy: patch it in place when every change keeps
+            // the file size (e.g. commenting out BED_MESH_CALIBRATE), else stream a copy
+            auto result = modifier.apply_in_place(local_download_path);
+            if (!result.success) {
+                result = modifier.apply_streaming(local_download_path);
 
-            // Clean up download file (no longer needed)
-            std::error_code ec;
-            std::filesystem::remove(local_download_path, ec);
-            if (ec) {
-                spdlog::warn("[PrintPreparationManager] Failed to clean up download file: {}",
-                             ec.message());
+                // Clean up download file (no longer needed)
+                std::error_code ec;
+                std::filesystem::remove(local_download_path, ec);
+                if (ec) {
+                    spdlog::warn("[PrintPreparationManager] Failed to clean up download file: {}",
+                                 ec.message());
+                }
             }
 
             if (!result.success) {
@@ -35,9 +35,45 @@ static constexpr uint32_t DEFAULT_COLOR = 0xE0E0E0; // Default white/light filam
 // - spool_body_shade: Back flange color (darker shade)
 // - spool_hub_top, spool_hub_bottom: Center hub gradient
 
+// Everything that affects a rendered spool. The fill level is reduced to the wound
+// filament's pixel radius, so fill levels that round to the same radius share a sprite.
+struct SpoolSpriteKey {
+    int32_t size = DEFAULT_SIZE;
+    uint32_t color = DEFAULT_COLOR;
+    int32_t filament_ry = 0; // 0 = empty spool
+    uint32_t body = 0;       // Theme colors (a theme switch yields new sprites)
+    uint32_t body_shade = 0;
+    uint32_t hub_top = 0;
+    uint32_t hub_bottom = 0;
+
+    bool operator==(const SpoolSpriteKey& other) const {
+        return size == other.size && color == other.color && filament_ry == other.filament_ry &&
+               body == other.body && body_shade == other.body_shade &&
+               hub_top == other.hub_top && hub_bottom == other.hub_bottom;
+    }
+};
+
+struct SpoolSpriteKeyHash {
+    size_t operator()(const SpoolSpriteKey& key) const {
+        size_t h = std::hash<uint32_t>{}(key.color);
+        for (uint32_t v : {static_cast<uint32_t>(key.size), static_cast<uint32_t>(key.filament_ry),
+                           key.body, key.body_shade, key.hub_top, key.hub_bottom}) {
+            h ^= std::hash<uint32_t>{}(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+};
+
+// Rendered spool image shared by every canvas showing the same key
+struct SpoolSprite {
+    SpoolSpriteKey key;
+    lv_draw_buf_t* draw_buf = nullptr;
+    bool rendered = false;
+};
+
 struct SpoolCanvasData {
     lv_obj_t* canvas = nullptr;
-    lv_draw_buf_t* draw_buf = nullptr;
+    std::shared_ptr<SpoolSprite> sprite;
     int32_t size = DEFAULT_SIZE;
     lv_color_t color = lv_color_hex(DEFAULT_COLOR);
     float fill_level = 1.0f;
@@ -45,6 +81,10 @@ struct SpoolCanvasData {
 
 static std::unordered_map<lv_obj_t*, SpoolCanvasData*> s_registry;
 
+// Live sprites; entries are removed when the last canvas using them lets go
+static std::unordered_map<SpoolSpriteKey, std::weak_ptr<SpoolSprite>, SpoolSpriteKeyHash>
+    s_sprites;
+
 static SpoolCanvasData* get_data(lv_obj_t* obj) {
     auto it = s_registry.find(obj);
     return (it != s_registry.end()) ? it->second : nullptr;
@@ -172,43 +212,105 @@ static void draw_ellipse_left_edge(lv_layer_t* layer, int32_t cx, int32_t cy, in
     }
 }
 
-static void redraw_spool(SpoolCanvasData* data) {
-    if (!data || !data->canvas || !data->draw_buf)
-        return;
+// Spool proportions shared by the sprite key and the renderer
+struct SpoolGeometry {
+    int32_t flange_ry;
+    int32_t flange_rx;
+    int32_t hub_ry;
+    int32_t hub_rx;
+    int32_t spool_width;
+    int32_t max_filament_ry;
+};
+
+static SpoolGeometry spool_geometry(int32_t size) {
+    SpoolGeometry g;
+    // Calculate dimensions - vertical radius and horizontal (compressed) radius
+    g.flange_ry = (int32_t)(size * FLANGE_RADIUS);        // Vertical radius
+    g.flange_rx = (int32_t)(g.flange_ry * ELLIPSE_RATIO); // Horizontal (narrower)
+    g.hub_ry = (int32_t)(size * HUB_RADIUS);
+    g.hub_rx = (int32_t)(g.hub_ry * ELLIPSE_RATIO);
+    g.spool_width = (int32_t)(size * SPOOL_DEPTH);
+    // Max filament is smaller than flange so flanges always show as "taller"
+    g.max_filament_ry = (int32_t)(g.flange_ry * 0.85f); // Flanges 15% taller than full filament
+    return g;
+}
+
+static SpoolSpriteKey make_sprite_key(const SpoolCanvasData* data) {
+    SpoolSpriteKey key;
+    key.size = data->size;
+    key.color = lv_color_to_u32(data->color) & 0xFFFFFF;
+
+    // Fill level determines wound filament radius
+    float fill = LV_CLAMP(data->fill_level, 0.0f, 1.0f);
+    if (fill > 0.01f) {
+        SpoolGeometry g = spool_geometry(data->size);
+        key.filament_ry = g.hub_ry + (int32_t)((g.max_filament_ry - g.hub_ry) * fill);
+    }
 
-    int32_t size = data->size;
+    // Colors (from theme tokens)
+    key.body = lv_color_to_u32(theme_manager_get_color("spool_body")) & 0xFFFFFF;
+    key.body_shade = lv_color_to_u32(theme_manager_get_color("spool_body_shade")) & 0xFFFFFF;
+    key.hub_top = lv_color_to_u32(theme_manager_get_color("spool_hub_top")) & 0xFFFFFF;
+    key.hub_bottom = lv_color_to_u32(theme_manager_get_color("spool_hub_bottom")) & 0xFFFFFF;
+    return key;
+}
+
+// Find the live sprite for key, or create an empty (not yet rendered) one
+static std::shared_ptr<SpoolSprite> acquire_sprite(const SpoolSpriteKey& key) {
+    auto it = s_sprites.find(key);
+    if (it != s_sprites.end()) {
+        if (auto sprite = it->second.lock()) {
+            return sprite;
+        }
+    }
+
+    lv_draw_buf_t* buf = lv_draw_buf_create(key.size, key.size, LV_COLOR_FORMAT_ARGB8888, 0);
+    if (!buf) {
+        return nullptr;
+    }
+
+    std::shared_ptr<SpoolSprite> sprite(new SpoolSprite{key, buf, false}, [](SpoolSprite* s) {
+        auto entry = s_sprites.find(s->key);
+        if (entry != s_sprites.end() && entry->second.expired()) {
+            s_sprites.erase(entry);
+        }
+        lv_draw_buf_destroy(s->draw_buf);
+        delete s;
+    });
+    s_sprites[key] = sprite;
+    return sprite;
+}
+
+// Render a spool into the canvas's current draw buffer
+static void render_spool(lv_obj_t* canvas, const SpoolSpriteKey& key) {
+    int32_t size = key.size;
     int32_t cy = size / 2; // Vertical center
 
-    // Calculate dimensions - vertical radius and horizontal (compressed) radius
-    int32_t flange_ry = (int32_t)(size * FLANGE_RADIUS);      // Vertical radius
-    int32_t flange_rx = (int32_t)(flange_ry * ELLIPSE_RATIO); // Horizontal (narrower)
-    int32_t hub_ry = (int32_t)(size * HUB_RADIUS);
-    int32_t hub_rx = (int32_t)(hub_ry * ELLIPSE_RATIO);
-    int32_t spool_width = (int32_t)(size * SPOOL_DEPTH);
+    SpoolGeometry g = spool_geometry(size);
+    int32_t flange_ry = g.flange_ry;
+    int32_t flange_rx = g.flange_rx;
+    int32_t hub_ry = g.hub_ry;
+    int32_t hub_rx = g.hub_rx;
+    int32_t spool_width = g.spool_width;
 
     // X positions for left (back) and right (front) flanges
     int32_t center_x = size / 2;
     int32_t left_x = center_x - spool_width / 2;  // Left side (back flange)
     int32_t right_x = center_x + spool_width / 2; // Right side (front flange)
 
-    // Fill level determines wound filament radius
-    // Max filament is smaller than flange so flanges always show as "taller"
-    float fill = LV_CLAMP(data->fill_level, 0.0f, 1.0f);
-    int32_t max_filament_ry = (int32_t)(flange_ry * 0.85f); // Flanges 15% taller than full filament
-    int32_t filament_ry = hub_ry + (int32_t)((max_filament_ry - hub_ry) * fill);
+    int32_t filament_ry = key.filament_ry;
     int32_t filament_rx = (int32_t)(filament_ry * ELLIPSE_RATIO);
 
-    // Colors (from theme tokens)
-    lv_color_t back_color = theme_manager_get_color("spool_body_shade");
-    lv_color_t front_color = theme_manager_get_color("spool_body");
-    lv_color_t filament_color = data->color;
+    lv_color_t back_color = lv_color_hex(key.body_shade);
+    lv_color_t front_color = lv_color_hex(key.body);
+    lv_color_t filament_color = lv_color_hex(key.color);
     lv_color_t filament_side = darken_color(filament_color, 30);
 
     // Clear canvas
-    lv_canvas_fill_bg(data->canvas, lv_color_black(), LV_OPA_TRANSP);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
 
     lv_layer_t layer;
-    lv_canvas_init_layer(data->canvas, &layer);
+    lv_canvas_init_layer(canvas, &layer);
 
     // ========================================
     // STEP 1: Draw BACK FLANGE (left side) with gradient + edge highlight
@@ -230,7 +332,7 @@ static void redraw_spool(SpoolCanvasData* data) {
     // Back ellipse + rectangle body + front ellipse
     // Gradient: lighter at top (lit), darker at bottom (shadow)
     // ========================================
-    if (fill > 0.01f) {
+    if (filament_ry > 0) {
         // Gradient colors for 3D lighting effect (stronger gradient)
         lv_color_t fil_light = lighten_color(filament_side, 70); // Top: much brighter
         lv_color_t fil_dark = darken_color(filament_side, 35);   // Bottom: darker
@@ -269,15 +371,38 @@ static void redraw_spool(SpoolCanvasData* data) {
     // STEP 4: Draw CENTER HOLE ellipse (hub)
     // Stronger gradient: dark at top (deep shadow), lighter at bottom (illuminated)
     // ========================================
-    lv_color_t hub_top =
-        theme_manager_get_color("spool_hub_top"); // Nearly black at top (deep in shadow)
-    lv_color_t hub_bottom =
-        theme_manager_get_color("spool_hub_bottom"); // Noticeably lighter at bottom (light hits it)
+    lv_color_t hub_top = lv_color_hex(key.hub_top);       // Nearly black at top (deep in shadow)
+    lv_color_t hub_bottom = lv_color_hex(key.hub_bottom); // Lighter at bottom (light hits it)
     draw_gradient_ellipse(&layer, right_x, cy, hub_rx, hub_ry, hub_top, hub_bottom);
 
-    lv_canvas_finish_layer(data->canvas, &layer);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+// Point the canvas at the sprite for its current state, rendering it only on a cache miss
+static void redraw_spool(SpoolCanvasData* data) {
+    if (!data || !data->canvas)
+        return;
+
+    SpoolSpriteKey key = make_sprite_key(data);
+    if (data->sprite && data->sprite->key == key)
+        return; // Already showing this spool
 
-    spdlog::trace("[SpoolCanvas] Redrawn: size={}, fill={:.0f}%", size, fill * 100.0f);
+    std::shared_ptr<SpoolSprite> sprite = acquire_sprite(key);
+    if (!sprite) {
+        spdlog::error("[SpoolCanvas] Failed to create draw buffer");
+        return;
+    }
+
+    lv_canvas_set_draw_buf(data->canvas, sprite->draw_buf);
+    if (!sprite->rendered) {
+        render_spool(data->canvas, key);
+        sprite->rendered = true;
+        spdlog::trace("[SpoolCanvas] Rendered sprite: size={}, filament_ry={} ({} cached)",
+                      key.size, key.filament_ry, s_sprites.size());
+    }
+
+    // Releases the previous sprite (freed if no other canvas shows it)
+    data->sprite = std::move(sprite);
 }
 
 static void spool_canvas_event_cb(lv_event_t* e) {
@@ -285,10 +410,8 @@ static void spool_canvas_event_cb(lv_event_t* e) {
         lv_obj_t* obj = lv_event_get_target_obj(e);
         auto it = s_registry.find(obj);
         if (it != s_registry.end()) {
+            // Sprite reference is released with data
             std::unique_ptr<SpoolCanvasData> data(it->second);
-            if (data && data->draw_buf) {
-                lv_draw_buf_destroy(data->draw_buf);
-            }
             lv_obj_set_user_data(obj, nullptr);
             s_registry.erase(it);
             // data automatically freed
@@ -310,13 +433,6 @@ static void* spool_canvas_xml_create(lv_xml_parser_state_t* state, const char**
     data_ptr->color = lv_color_hex(DEFAULT_COLOR);
     data_ptr->fill_level = 1.0f;
 
-    // Create draw buffer
-    data_ptr->draw_buf =
-        lv_draw_buf_create(data_ptr->size, data_ptr->size, LV_COLOR_FORMAT_ARGB8888, 0);
-    if (data_ptr->draw_buf) {
-        lv_canvas_set_draw_buf(canvas, data_ptr->draw_buf);
-    }
-
     lv_obj_set_size(canvas, data_ptr->size, data_ptr->size);
     s_registry[canvas] = data_ptr.get();
     lv_obj_add_event_cb(canvas, spool_canvas_event_cb, LV_EVENT_DELETE, nullptr);
@@ -360,16 +476,6 @@ static void spool_canvas_xml_apply(lv_xml_parser_state_t* state, const char** at
             int32_t new_size = atoi(value);
             if (new_size != data->size && new_size > 0) {
                 data->size = new_size;
-
-                // Recreate draw buffer with new size
-                if (data->draw_buf) {
-                    lv_draw_buf_destroy(data->draw_buf);
-                }
-                data->draw_buf =
-                    lv_draw_buf_create(new_size, new_size, LV_COLOR_FORMAT_ARGB8888, 0);
-                if (data->draw_buf) {
-                    lv_canvas_set_draw_buf(data->canvas, data->draw_buf);
-                }
                 lv_obj_set_size(data->canvas, new_size, new_size);
                 needs_redraw = true;
                 spdlog::debug("[SpoolCanvas] Set size={}", new_size);
@@ -410,16 +516,6 @@ lv_obj_t* ui_spool_canvas_create(lv_obj_t* parent, int32_t size) {
     data_ptr->color = lv_color_hex(DEFAULT_COLOR);
     data_ptr->fill_level = 1.0f;
 
-    // Create draw buffer
-    data_ptr->draw_buf = lv_draw_buf_create(size, size, LV_COLOR_FORMAT_ARGB8888, 0);
-    if (data_ptr->draw_buf) {
-        lv_canvas_set_draw_buf(canvas, data_ptr->draw_buf);
-    } else {
-        spdlog::error("[SpoolCanvas] Failed to create draw buffer");
-        lv_obj_safe_delete(canvas);
-        return nullptr;
-    }
-
     lv_obj_set_size(canvas, size, size);
     s_registry[canvas] = data_ptr.get();
     lv_obj_add_event_cb(canvas, spool_canvas_event_cb, LV_EVENT_DELETE, nullptr);
@@ -427,6 +523,10 @@ lv_obj_t* ui_spool_canvas_create(lv_obj_t* parent, int32_t size) {
     SpoolCanvasData* data = data_ptr.release();
 
     redraw_spool(data);
+    if (!data->sprite) {
+        lv_obj_safe_delete(canvas);
+        return nullptr;
+    }
 
     spdlog::debug("[SpoolCanvas] Created widget programmatically (size={})", size);
     return canvas;
@@ -78,12 +78,19 @@ static void update_all_cursor_positions(ui_temp_graph_t* graph) {
     }
 }
 
-// Event callback: Recalculate cursor positions when chart is resized
+static void apply_decimation(ui_temp_graph_t* graph);
+
+// Event callback: Recalculate cursor positions and decimation when chart is resized
 static void chart_resize_cb(lv_event_t* e) {
     lv_obj_t* chart = lv_event_get_target_obj(e);
     ui_temp_graph_t* graph = static_cast<ui_temp_graph_t*>(lv_obj_get_user_data(chart));
     if (graph) {
         update_all_cursor_positions(graph);
+
+        int32_t width = lv_obj_get_content_width(graph->chart);
+        if (ui_temp_graph_bucket_size(graph->point_count, width) != graph->bucket_size) {
+            apply_decimation(graph);
+        }
     }
 }
 
@@ -144,6 +151,126 @@ static void update_max_visible_temp(ui_temp_graph_t* graph) {
     graph->max_visible_temp = max_temp;
 }
 
+// Helper: Allocate (or reallocate) a series' raw sample ring, keeping the newest samples
+static void resize_raw_ring(ui_temp_series_meta_t* meta, int capacity) {
+    int32_t* values = static_cast<int32_t*>(calloc(static_cast<size_t>(capacity), sizeof(int32_t)));
+    if (!values) {
+        spdlog::error("[TempGraph] Failed to allocate raw sample buffer");
+        return;
+    }
+
+    // raw_head is only non-zero once the ring is full, so raw_count is the ring size here
+    int keep = meta->raw_count < capacity ? meta->raw_count : capacity;
+    int skip = meta->raw_count - keep;
+    for (int i = 0; i < keep; i++) {
+        values[i] = meta->raw_values[(meta->raw_head + skip + i) % meta->raw_count];
+    }
+    free(meta->raw_values);
+
+    meta->raw_values = values;
+    meta->raw_head = 0;
+    meta->raw_count = keep;
+}
+
+// Helper: Release a series' raw sample ring
+static void free_raw_ring(ui_temp_series_meta_t* meta) {
+    free(meta->raw_values);
+    meta->raw_values = nullptr;
+    meta->raw_head = 0;
+    meta->raw_count = 0;
+    meta->bucket = ui_temp_graph_bucket_t{};
+}
+
+// Helper: Append a sample to the raw ring (overwrites the oldest once full)
+static void push_raw(ui_temp_graph_t* graph, ui_temp_series_meta_t* meta, int32_t value) {
+    if (!meta->raw_values) {
+        return;
+    }
+    if (meta->raw_count < graph->point_count) {
+        meta->raw_values[meta->raw_count++] = value;
+    } else {
+        meta->raw_values[meta->raw_head] = value;
+        meta->raw_head = (meta->raw_head + 1) % graph->point_count;
+    }
+}
+
+// Helper: Re-decimate a series from its raw ring into the chart (resize, bulk load)
+static void rebuild_series(ui_temp_graph_t* graph, ui_temp_series_meta_t* meta) {
+    int count = meta->raw_count;
+    auto raw = std::make_unique<int32_t[]>(static_cast<size_t>(count > 0 ? count : 1));
+    for (int i = 0; i < count; i++) {
+        raw[i] = meta->raw_values[(meta->raw_head + i) % count];
+    }
+
+    auto points = std::make_unique<int32_t[]>(static_cast<size_t>(graph->chart_point_count));
+    int produced =
+        ui_temp_graph_decimate(raw.get(), count, graph->bucket_size, points.get(), &meta->bucket);
+    if (produced > graph->chart_point_count) {
+        produced = graph->chart_point_count; // Defensive: never overrun the chart
+    }
+
+    // Right-align so the newest point is at the right edge. Pad with the oldest sample
+    // (same as the first-value backfill) or POINT_NONE if there is no data yet.
+    // Writing a full cycle of next-values also realigns the shift start point.
+    int32_t pad = count > 0 ? raw[0] : LV_CHART_POINT_NONE;
+    for (int i = 0; i < graph->chart_point_count - produced; i++) {
+        lv_chart_set_next_value(graph->chart, meta->chart_series, pad);
+    }
+    for (int i = 0; i < produced; i++) {
+        lv_chart_set_next_value(graph->chart, meta->chart_series, points[i]);
+    }
+}
+
+// Helper: Recompute bucket size from the chart width and rebuild every series
+static void apply_decimation(ui_temp_graph_t* graph) {
+    int32_t width = lv_obj_get_content_width(graph->chart);
+    graph->bucket_size = ui_temp_graph_bucket_size(graph->point_count, width);
+    graph->chart_point_count =
+        ui_temp_graph_decimated_point_count(graph->point_count, graph->bucket_size);
+    lv_chart_set_point_count(graph->chart, static_cast<uint32_t>(graph->chart_point_count));
+
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        ui_temp_series_meta_t* meta = &graph->series_meta[i];
+        if (meta->chart_series) {
+            rebuild_series(graph, meta);
+        }
+    }
+
+    lv_chart_refresh(graph->chart);
+    update_max_visible_temp(graph);
+
+    spdlog::debug("[TempGraph] Decimation: {} samples -> {} chart points (bucket {}, width {}px)",
+                  graph->point_count, graph->chart_point_count, graph->bucket_size, width);
+}
+
+// Helper: Push one sample, updating only the newest chart bucket
+static void push_value(ui_temp_graph_t* graph, ui_temp_series_meta_t* meta, int32_t value) {
+    push_raw(graph, meta, value);
+
+    if (graph->bucket_size <= 1) {
+        lv_chart_set_next_value(graph->chart, meta->chart_series, value);
+        return;
+    }
+
+    bool new_bucket = ui_temp_graph_bucket_push(&meta->bucket, graph->bucket_size, value);
+    int32_t first = 0;
+    int32_t second = 0;
+    ui_temp_graph_bucket_points(&meta->bucket, &first, &second);
+
+    if (new_bucket) {
+        // Shift in two points; the oldest bucket scrolls off the left edge
+        lv_chart_set_next_value(graph->chart, meta->chart_series, first);
+        lv_chart_set_next_value(graph->chart, meta->chart_series, second);
+        return;
+    }
+
+    // Same bucket: rewrite the newest two points (just behind the shift write position)
+    auto cnt = static_cast<uint32_t>(graph->chart_point_count);
+    uint32_t start = lv_chart_get_x_start_point(graph->chart, meta->chart_series);
+    lv_chart_set_value_by_id(graph->chart, meta->chart_series, (start + cnt - 2) % cnt, first);
+    lv_chart_set_value_by_id(graph->chart, meta->chart_series, (start + cnt - 1) % cnt, second);
+}
+
 // LVGL 9 draw task callback for gradient fills under chart lines
 // Called for each draw task when LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS is set
 static void draw_task_cb(lv_event_t* e) {
@@ -588,6 +715,8 @@ ui_temp_graph_t* ui_temp_graph_create(lv_obj_t* parent) {
 
     // Initialize defaults
     graph->point_count = UI_TEMP_GRAPH_DEFAULT_POINTS;
+    graph->bucket_size = 1; // Not decimated until the chart is laid out
+    graph->chart_point_count = graph->point_count;
     graph->min_temp = UI_TEMP_GRAPH_DEFAULT_MIN_TEMP;
     graph->max_temp = UI_TEMP_GRAPH_DEFAULT_MAX_TEMP;
     graph->series_count = 0;
@@ -608,7 +737,7 @@ ui_temp_graph_t* ui_temp_graph_create(lv_obj_t* parent) {
     // Configure chart
     lv_chart_set_type(graph->chart, LV_CHART_TYPE_LINE);
     lv_chart_set_update_mode(graph->chart, LV_CHART_UPDATE_MODE_SHIFT);
-    lv_chart_set_point_count(graph->chart, static_cast<uint32_t>(graph->point_count));
+    lv_chart_set_point_count(graph->chart, static_cast<uint32_t>(graph->chart_point_count));
 
     // Set Y-axis range
     lv_chart_set_axis_range(graph->chart, LV_CHART_AXIS_PRIMARY_Y,
@@ -697,6 +826,9 @@ void ui_temp_graph_destroy(ui_temp_graph_t* graph) {
             lv_chart_remove_series(graph_ptr->chart, graph_ptr->series_meta[i].chart_series);
         }
     }
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        free_raw_ring(&graph_ptr->series_meta[i]);
+    }
 
     // Delete chart widget
     if (graph_ptr->chart) {
@@ -762,6 +894,7 @@ int ui_temp_graph_add_series(ui_temp_graph_t* graph, const char* name, lv_color_
     meta->gradient_bottom_opa = UI_TEMP_GRAPH_GRADIENT_BOTTOM_OPA;
     meta->gradient_top_opa = UI_TEMP_GRAPH_GRADIENT_TOP_OPA;
     meta->first_value_received = false;
+    resize_raw_ring(meta, graph->point_count);
 
     // Create target temperature cursor (horizontal dashed line, initially hidden)
     // Note: We don't use lv_chart_set_cursor_point because that binds the cursor
@@ -795,6 +928,7 @@ void ui_temp_graph_remove_series(ui_temp_graph_t* graph, int series_id) {
 
     // Remove chart series
     lv_chart_remove_series(graph->chart, meta->chart_series);
+    free_raw_ring(meta);
 
     // Clear metadata
     memset(meta, 0, sizeof(ui_temp_series_meta_t));
@@ -833,7 +967,7 @@ void ui_temp_graph_update_series(ui_temp_graph_t* graph, int series_id, float te
     }
 
     // Add point to series (shifts old data left)
-    lv_chart_set_next_value(graph->chart, meta->chart_series, (int32_t)temp);
+    push_value(graph, meta, static_cast<int32_t>(temp));
 
     // Update max visible temperature for gradient rendering
     update_max_visible_temp(graph);
@@ -874,7 +1008,7 @@ void ui_temp_graph_update_series_with_time(ui_temp_graph_t* graph, int series_id
     }
 
     // Add point to series (shifts old data left)
-    lv_chart_set_next_value(graph->chart, meta->chart_series, static_cast<int32_t>(temp));
+    push_value(graph, meta, static_cast<int32_t>(temp));
 
     // Update max visible temperature for gradient rendering
     update_max_visible_temp(graph);
@@ -889,26 +1023,14 @@ void ui_temp_graph_set_series_data(ui_temp_graph_t* graph, int series_id, const
         return;
     }
 
-    // Clear existing data before setting new values
-    lv_chart_set_all_values(graph->chart, meta->chart_series, LV_CHART_POINT_NONE);
-
-    // Convert float array to int32_t array for LVGL API (using RAII)
+    // Replace raw samples, then decimate them into the chart
     int points_to_copy = count > graph->point_count ? graph->point_count : count;
-    auto values = std::make_unique<int32_t[]>(static_cast<size_t>(points_to_copy));
-    if (!values) {
-        spdlog::error("[TempGraph] Failed to allocate conversion buffer");
-        return;
-    }
-
-    for (size_t i = 0; i < static_cast<size_t>(points_to_copy); i++) {
-        values[i] = static_cast<int32_t>(temps[i]);
+    meta->raw_head = 0;
+    meta->raw_count = 0;
+    for (int i = 0; i < points_to_copy; i++) {
+        push_raw(graph, meta, static_cast<int32_t>(temps[i]));
     }
-
-    // Set data using public API
-    lv_chart_set_series_values(graph->chart, meta->chart_series, values.get(),
-                               static_cast<size_t>(points_to_copy));
-
-    // values automatically freed via ~unique_ptr()
+    rebuild_series(graph, meta);
 
     lv_chart_refresh(graph->chart);
 
@@ -928,6 +1050,9 @@ void ui_temp_graph_clear(ui_temp_graph_t* graph) {
         ui_temp_series_meta_t* meta = &graph->series_meta[i];
         if (meta->chart_series) {
             lv_chart_set_all_values(graph->chart, meta->chart_series, LV_CHART_POINT_NONE);
+            meta->raw_head = 0;
+            meta->raw_count = 0;
+            meta->bucket = ui_temp_graph_bucket_t{};
         }
     }
 
@@ -948,6 +1073,9 @@ void ui_temp_graph_clear_series(ui_temp_graph_t* graph, int series_id) {
     }
 
     lv_chart_set_all_values(graph->chart, meta->chart_series, LV_CHART_POINT_NONE);
+    meta->raw_head = 0;
+    meta->raw_count = 0;
+    meta->bucket = ui_temp_graph_bucket_t{};
 
     lv_chart_refresh(graph->chart);
 
@@ -1026,8 +1154,15 @@ void ui_temp_graph_set_point_count(ui_temp_graph_t* graph, int count) {
         return;
     }
 
+    for (int i = 0; i < UI_TEMP_GRAPH_MAX_SERIES; i++) {
+        ui_temp_series_meta_t* meta = &graph->series_meta[i];
+        if (meta->chart_series) {
+            resize_raw_ring(meta, count);
+        }
+    }
+
     graph->point_count = count;
-    lv_chart_set_point_count(graph->chart, static_cast<uint32_t>(count));
+    apply_decimation(graph);
 
     spdlog::debug("[TempGraph] Point count set: {}", count);
 }
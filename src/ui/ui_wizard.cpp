@@ -182,6 +182,11 @@ static const char* get_step_subtitle_from_xml(int step) {
 static bool wizard_subjects_initialized = false;
 
 void ui_wizard_init_subjects() {
+    if (wizard_subjects_initialized) {
+        spdlog::debug("[Wizard] Subjects already initialized");
+        return;
+    }
+
     spdlog::debug("[Wizard] Initializing subjects");
 
     // Initialize subjects with defaults using managed macros for RAII cleanup
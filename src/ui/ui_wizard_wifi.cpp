@@ -17,6 +17,7 @@
 #include "static_panel_registry.h"
 #include "theme_manager.h"
 #include "wifi_manager.h"
+#include "xml_registration.h"
 
 #include <spdlog/spdlog.h>
 
@@ -799,7 +800,7 @@ lv_obj_t* WizardWifiStep::create(lv_obj_t* parent) {
     // Register wifi_network_item component first
     static bool network_item_registered = false;
     if (!network_item_registered) {
-        lv_xml_register_component_from_file("A:ui_xml/wifi_network_item.xml");
+        helix::register_xml_component("A:ui_xml/wifi_network_item.xml");
         network_item_registered = true;
         spdlog::debug("[{}] Registered wifi_network_item component", get_name());
     }
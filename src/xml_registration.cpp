@@ -19,10 +19,15 @@
 #include "ui_text.h"
 #include "ui_text_input.h"
 
+#include "helix_timing.h"
 #include "theme_manager.h"
+#include "xml_component_bundle.h"
 
 #include <spdlog/spdlog.h>
 
+#include <cstdlib>
+#include <string>
+
 #include <lvgl.h>
 
 namespace helix {
@@ -46,6 +51,56 @@ static void noop_event_callback(lv_event_t* /*e*/) {
 static lv_subject_t s_noop_subject;
 static bool s_noop_subject_initialized = false;
 
+/**
+ * Pre-built component bundle (assets/ui_xml.bundle), opened on first use.
+ * Stays mapped until deinit_xml_subjects() because some components (AMS panel)
+ * are registered lazily long after startup.
+ */
+static XmlComponentBundle s_bundle;
+static bool s_bundle_checked = false;
+static size_t s_bundle_hits = 0;
+static size_t s_file_loads = 0;
+
+/**
+ * Open the component bundle unless disabled.
+ *
+ * HELIX_XML_BUNDLE=0 forces loading from ui_xml/ (useful when editing XML on a
+ * device that has a bundle deployed); any other value overrides the path.
+ */
+static XmlComponentBundle& component_bundle() {
+    if (!s_bundle_checked) {
+        s_bundle_checked = true;
+        const char* env = std::getenv("HELIX_XML_BUNDLE");
+        if (env && std::string(env) == "0") {
+            spdlog::info("[XML Registration] Bundle disabled via HELIX_XML_BUNDLE=0");
+        } else if (s_bundle.open(env && *env ? env : XmlComponentBundle::DEFAULT_PATH)) {
+            spdlog::info("[XML Registration] Using component bundle ({} components)",
+                         s_bundle.size());
+        }
+    }
+    return s_bundle;
+}
+
+bool register_xml_component(const char* path) {
+    XmlComponentBundle& bundle = component_bundle();
+    if (bundle.is_open()) {
+        std::string name(XmlComponentBundle::component_name_from_path(path));
+        if (const char* xml = bundle.find(name)) {
+            if (lv_xml_component_register_from_data(name.c_str(), xml) == LV_RESULT_OK) {
+                s_bundle_hits++;
+                return true;
+            }
+            spdlog::warn("[XML Registration] Bundled '{}' failed to register, trying file",
+                         name);
+        } else {
+            spdlog::debug("[XML Registration] '{}' not in bundle, loading file", name);
+        }
+    }
+
+    s_file_loads++;
+    return lv_xml_register_component_from_file(path) == LV_RESULT_OK;
+}
+
 /**
  * Register responsive constants for color picker sizing based on screen dimensions
  * Call this BEFORE registering XML components that use the color picker
@@ -87,6 +142,7 @@ static void register_color_picker_responsive_constants() {
 
 void register_xml_components() {
     spdlog::debug("[XML Registration] Registering XML components...");
+    uint32_t start_ms = timing::get_ticks();
 
     // Register responsive constants (AFTER globals, BEFORE components that use them)
     ui_switch_register_responsive_constants();
@@ -116,173 +172,174 @@ void register_xml_components() {
     // registered lazily in ui_panel_ams.cpp when the AMS panel is first accessed
 
     // Spoolman components (MUST be after spool_canvas registration)
-    lv_xml_register_component_from_file("A:ui_xml/spoolman_spool_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/spoolman_panel.xml");
+    register_xml_component("A:ui_xml/spoolman_spool_row.xml");
+    register_xml_component("A:ui_xml/spoolman_panel.xml");
 
     // Core UI components
-    lv_xml_register_component_from_file("A:ui_xml/icon.xml");
-    lv_xml_register_component_from_file("A:ui_xml/filament_sensor_indicator.xml");
-    lv_xml_register_component_from_file("A:ui_xml/humidity_indicator.xml");
-    lv_xml_register_component_from_file("A:ui_xml/width_indicator.xml");
-    lv_xml_register_component_from_file("A:ui_xml/probe_indicator.xml");
-    lv_xml_register_component_from_file("A:ui_xml/filament_sensor_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/temp_display.xml");
-    lv_xml_register_component_from_file("A:ui_xml/header_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/overlay_backdrop.xml");
-    lv_xml_register_component_from_file("A:ui_xml/overlay_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/toast_notification.xml");
+    register_xml_component("A:ui_xml/icon.xml");
+    register_xml_component("A:ui_xml/filament_sensor_indicator.xml");
+    register_xml_component("A:ui_xml/humidity_indicator.xml");
+    register_xml_component("A:ui_xml/width_indicator.xml");
+    register_xml_component("A:ui_xml/probe_indicator.xml");
+    register_xml_component("A:ui_xml/filament_sensor_row.xml");
+    register_xml_component("A:ui_xml/temp_display.xml");
+    register_xml_component("A:ui_xml/header_bar.xml");
+    register_xml_component("A:ui_xml/overlay_backdrop.xml");
+    register_xml_component("A:ui_xml/overlay_panel.xml");
+    register_xml_component("A:ui_xml/toast_notification.xml");
 
     // Utility components (dividers, button rows, headers - used by modals and other components)
-    lv_xml_register_component_from_file("A:ui_xml/centered_column.xml");
-    lv_xml_register_component_from_file("A:ui_xml/divider_horizontal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/divider_vertical.xml");
-    lv_xml_register_component_from_file("A:ui_xml/modal_button_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/modal_header.xml");
-    lv_xml_register_component_from_file("A:ui_xml/empty_state.xml");
-    lv_xml_register_component_from_file("A:ui_xml/connecting_state.xml");
-    lv_xml_register_component_from_file("A:ui_xml/info_note.xml");
-    lv_xml_register_component_from_file("A:ui_xml/form_field.xml");
+    register_xml_component("A:ui_xml/centered_column.xml");
+    register_xml_component("A:ui_xml/divider_horizontal.xml");
+    register_xml_component("A:ui_xml/divider_vertical.xml");
+    register_xml_component("A:ui_xml/modal_button_row.xml");
+    register_xml_component("A:ui_xml/modal_header.xml");
+    register_xml_component("A:ui_xml/empty_state.xml");
+    register_xml_component("A:ui_xml/connecting_state.xml");
+    register_xml_component("A:ui_xml/info_note.xml");
+    register_xml_component("A:ui_xml/form_field.xml");
 
     // emergency_stop_button.xml removed - E-Stop buttons are now embedded in panels
-    lv_xml_register_component_from_file("A:ui_xml/estop_confirmation_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/klipper_recovery_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_cancel_confirm_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_completion_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/save_z_offset_modal.xml");
+    register_xml_component("A:ui_xml/estop_confirmation_dialog.xml");
+    register_xml_component("A:ui_xml/klipper_recovery_dialog.xml");
+    register_xml_component("A:ui_xml/print_cancel_confirm_modal.xml");
+    register_xml_component("A:ui_xml/print_completion_modal.xml");
+    register_xml_component("A:ui_xml/save_z_offset_modal.xml");
 
     // Notification history
-    lv_xml_register_component_from_file("A:ui_xml/notification_history_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/notification_history_item.xml");
+    register_xml_component("A:ui_xml/notification_history_panel.xml");
+    register_xml_component("A:ui_xml/notification_history_item.xml");
 
     // Modal dialogs
-    lv_xml_register_component_from_file("A:ui_xml/modal_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/numeric_keypad_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/runout_guidance_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/plugin_install_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/macro_enhance_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/action_prompt_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/color_picker.xml");
+    register_xml_component("A:ui_xml/modal_dialog.xml");
+    register_xml_component("A:ui_xml/numeric_keypad_panel.xml");
+    register_xml_component("A:ui_xml/runout_guidance_modal.xml");
+    register_xml_component("A:ui_xml/plugin_install_modal.xml");
+    register_xml_component("A:ui_xml/macro_enhance_modal.xml");
+    register_xml_component("A:ui_xml/action_prompt_modal.xml");
+    register_xml_component("A:ui_xml/color_picker.xml");
 
     // Print file components
-    lv_xml_register_component_from_file("A:ui_xml/print_file_card.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_file_list_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_file_detail.xml");
+    register_xml_component("A:ui_xml/print_file_card.xml");
+    register_xml_component("A:ui_xml/print_file_list_row.xml");
+    register_xml_component("A:ui_xml/print_file_detail.xml");
 
     // Main navigation and panels
-    lv_xml_register_component_from_file("A:ui_xml/navigation_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/home_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/controls_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/motion_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/nozzle_temp_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/bed_temp_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/extrusion_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/fan_dial.xml");
+    register_xml_component("A:ui_xml/navigation_bar.xml");
+    register_xml_component("A:ui_xml/home_panel.xml");
+    register_xml_component("A:ui_xml/controls_panel.xml");
+    register_xml_component("A:ui_xml/motion_panel.xml");
+    register_xml_component("A:ui_xml/nozzle_temp_panel.xml");
+    register_xml_component("A:ui_xml/bed_temp_panel.xml");
+    register_xml_component("A:ui_xml/extrusion_panel.xml");
+    register_xml_component("A:ui_xml/fan_dial.xml");
     register_fan_dial_callbacks(); // Register FanDial event callbacks
-    lv_xml_register_component_from_file("A:ui_xml/fan_status_card.xml");
-    lv_xml_register_component_from_file("A:ui_xml/fan_control_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/ams_current_tool.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_status_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_tune_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/filament_panel.xml");
+    register_xml_component("A:ui_xml/fan_status_card.xml");
+    register_xml_component("A:ui_xml/fan_control_overlay.xml");
+    register_xml_component("A:ui_xml/ams_current_tool.xml");
+    register_xml_component("A:ui_xml/print_status_panel.xml");
+    register_xml_component("A:ui_xml/print_tune_panel.xml");
+    register_xml_component("A:ui_xml/filament_panel.xml");
 
     // NOTE: AMS panel (ams_panel.xml) is registered lazily in ui_panel_ams.cpp
     // AMS Device Operations (accessed from Settings > AMS)
     helix::ui::get_ams_device_operations_overlay().register_callbacks();
-    lv_xml_register_component_from_file("A:ui_xml/ams_device_operations.xml");
+    register_xml_component("A:ui_xml/ams_device_operations.xml");
 
     // Spoolman Settings (accessed from Settings > Spoolman, future)
-    lv_xml_register_component_from_file("A:ui_xml/ams_settings_spoolman.xml");
+    register_xml_component("A:ui_xml/ams_settings_spoolman.xml");
 
     // Feature parity panels
-    lv_xml_register_component_from_file("A:ui_xml/macro_card.xml");
-    lv_xml_register_component_from_file("A:ui_xml/macro_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/console_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/power_device_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/power_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/screws_tilt_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/input_shaper_panel.xml");
+    register_xml_component("A:ui_xml/macro_card.xml");
+    register_xml_component("A:ui_xml/macro_panel.xml");
+    register_xml_component("A:ui_xml/console_panel.xml");
+    register_xml_component("A:ui_xml/power_device_row.xml");
+    register_xml_component("A:ui_xml/power_panel.xml");
+    register_xml_component("A:ui_xml/screws_tilt_panel.xml");
+    register_xml_component("A:ui_xml/input_shaper_panel.xml");
 
     // Print history panels
-    lv_xml_register_component_from_file("A:ui_xml/history_list_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/history_list_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/history_detail_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/history_dashboard_panel.xml");
+    register_xml_component("A:ui_xml/history_list_row.xml");
+    register_xml_component("A:ui_xml/history_list_panel.xml");
+    register_xml_component("A:ui_xml/history_detail_overlay.xml");
+    register_xml_component("A:ui_xml/history_dashboard_panel.xml");
 
     // Settings components (must be registered before settings_panel)
-    lv_xml_register_component_from_file("A:ui_xml/setting_section_header.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_toggle_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_dropdown_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_action_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_info_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/setting_slider_row.xml");
+    register_xml_component("A:ui_xml/setting_section_header.xml");
+    register_xml_component("A:ui_xml/setting_toggle_row.xml");
+    register_xml_component("A:ui_xml/setting_dropdown_row.xml");
+    register_xml_component("A:ui_xml/setting_action_row.xml");
+    register_xml_component("A:ui_xml/setting_info_row.xml");
+    register_xml_component("A:ui_xml/setting_slider_row.xml");
     register_settings_panel_callbacks(); // Register callbacks before XML parse [L013]
-    lv_xml_register_component_from_file("A:ui_xml/settings_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/restart_prompt_dialog.xml");
-    lv_xml_register_component_from_file("A:ui_xml/theme_restart_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/factory_reset_modal.xml");
+    register_xml_component("A:ui_xml/settings_panel.xml");
+    register_xml_component("A:ui_xml/restart_prompt_dialog.xml");
+    register_xml_component("A:ui_xml/theme_restart_modal.xml");
+    register_xml_component("A:ui_xml/factory_reset_modal.xml");
 
     // Calibration panels (overlays launched from settings)
-    lv_xml_register_component_from_file("A:ui_xml/calibration_zoffset_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/calibration_pid_panel.xml");
+    register_xml_component("A:ui_xml/calibration_zoffset_panel.xml");
+    register_xml_component("A:ui_xml/calibration_pid_panel.xml");
 
     // Bed mesh modals (must be registered before bed_mesh_panel which uses them)
-    lv_xml_register_component_from_file("A:ui_xml/bed_mesh_calibrate_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/bed_mesh_rename_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/bed_mesh_save_config_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/bed_mesh_panel.xml");
+    register_xml_component("A:ui_xml/bed_mesh_calibrate_modal.xml");
+    register_xml_component("A:ui_xml/bed_mesh_rename_modal.xml");
+    register_xml_component("A:ui_xml/bed_mesh_save_config_modal.xml");
+    register_xml_component("A:ui_xml/bed_mesh_panel.xml");
 
     // Settings overlay panels
-    lv_xml_register_component_from_file("A:ui_xml/display_settings_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/theme_editor_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/theme_preview_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/theme_save_as_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/sensors_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/macro_buttons_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/hardware_issue_row.xml");
-    lv_xml_register_component_from_file("A:ui_xml/hardware_health_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/network_settings_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/retraction_settings_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/machine_limits_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/timelapse_settings_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/touch_calibration_overlay.xml");
-    lv_xml_register_component_from_file("A:ui_xml/hidden_network_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/network_test_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/filament_preset_edit_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wifi_network_item.xml");
+    register_xml_component("A:ui_xml/display_settings_overlay.xml");
+    register_xml_component("A:ui_xml/theme_editor_overlay.xml");
+    register_xml_component("A:ui_xml/theme_preview_overlay.xml");
+    register_xml_component("A:ui_xml/theme_save_as_modal.xml");
+    register_xml_component("A:ui_xml/sensors_overlay.xml");
+    register_xml_component("A:ui_xml/macro_buttons_overlay.xml");
+    register_xml_component("A:ui_xml/hardware_issue_row.xml");
+    register_xml_component("A:ui_xml/hardware_health_overlay.xml");
+    register_xml_component("A:ui_xml/network_settings_overlay.xml");
+    register_xml_component("A:ui_xml/retraction_settings_overlay.xml");
+    register_xml_component("A:ui_xml/machine_limits_overlay.xml");
+    register_xml_component("A:ui_xml/timelapse_settings_overlay.xml");
+    register_xml_component("A:ui_xml/touch_calibration_overlay.xml");
+    register_xml_component("A:ui_xml/hidden_network_modal.xml");
+    register_xml_component("A:ui_xml/network_test_modal.xml");
+    register_xml_component("A:ui_xml/filament_preset_edit_modal.xml");
+    register_xml_component("A:ui_xml/wifi_network_item.xml");
 
     // Development tools
-    lv_xml_register_component_from_file("A:ui_xml/memory_stats_overlay.xml");
+    register_xml_component("A:ui_xml/memory_stats_overlay.xml");
 
     // Additional panels
-    lv_xml_register_component_from_file("A:ui_xml/advanced_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/test_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/print_select_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/gcode_test_panel.xml");
-    lv_xml_register_component_from_file("A:ui_xml/glyphs_panel.xml");
+    register_xml_component("A:ui_xml/advanced_panel.xml");
+    register_xml_component("A:ui_xml/test_panel.xml");
+    register_xml_component("A:ui_xml/print_select_panel.xml");
+    register_xml_component("A:ui_xml/gcode_test_panel.xml");
+    register_xml_component("A:ui_xml/glyphs_panel.xml");
 
     // App layout
-    lv_xml_register_component_from_file("A:ui_xml/app_layout.xml");
+    register_xml_component("A:ui_xml/app_layout.xml");
 
     // Wizard components
-    lv_xml_register_component_from_file("A:ui_xml/wizard_touch_calibration.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_header_bar.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_container.xml");
-    lv_xml_register_component_from_file("A:ui_xml/network_list_item.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wifi_password_modal.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_wifi_setup.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_connection.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_printer_identify.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_heater_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_fan_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_ams_identify.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_led_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_filament_sensor_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_probe_sensor_select.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_input_shaper.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_language_chooser.xml");
-    lv_xml_register_component_from_file("A:ui_xml/wizard_summary.xml");
-
-    spdlog::debug("[XML Registration] XML component registration complete");
+    register_xml_component("A:ui_xml/wizard_touch_calibration.xml");
+    register_xml_component("A:ui_xml/wizard_header_bar.xml");
+    register_xml_component("A:ui_xml/wizard_container.xml");
+    register_xml_component("A:ui_xml/network_list_item.xml");
+    register_xml_component("A:ui_xml/wifi_password_modal.xml");
+    register_xml_component("A:ui_xml/wizard_wifi_setup.xml");
+    register_xml_component("A:ui_xml/wizard_connection.xml");
+    register_xml_component("A:ui_xml/wizard_printer_identify.xml");
+    register_xml_component("A:ui_xml/wizard_heater_select.xml");
+    register_xml_component("A:ui_xml/wizard_fan_select.xml");
+    register_xml_component("A:ui_xml/wizard_ams_identify.xml");
+    register_xml_component("A:ui_xml/wizard_led_select.xml");
+    register_xml_component("A:ui_xml/wizard_filament_sensor_select.xml");
+    register_xml_component("A:ui_xml/wizard_probe_sensor_select.xml");
+    register_xml_component("A:ui_xml/wizard_input_shaper.xml");
+    register_xml_component("A:ui_xml/wizard_language_chooser.xml");
+    register_xml_component("A:ui_xml/wizard_summary.xml");
+
+    spdlog::info("[XML Registration] Registered components in {}ms ({} from bundle, {} from files)",
+                 timing::get_ticks() - start_ms, s_bundle_hits, s_file_loads);
 }
 
 void deinit_xml_subjects() {
@@ -291,6 +348,8 @@ void deinit_xml_subjects() {
         s_noop_subject_initialized = false;
         spdlog::debug("[XML Registration] No-op subject deinitialized");
     }
+    s_bundle.close();
+    s_bundle_checked = false;
 }
 
 } // namespace helix
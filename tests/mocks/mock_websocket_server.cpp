@@ -267,6 +267,18 @@ void MockWebSocketServer::send_notification_to(int channel_id, const std::string
     }
 }
 
+int MockWebSocketServer::send_raw(const std::string& frame) {
+    int sent = 0;
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+    for (auto& channel : channels_) {
+        if (channel->isConnected()) {
+            channel->send(frame);
+            sent++;
+        }
+    }
+    return sent;
+}
+
 void MockWebSocketServer::disconnect_all() {
     std::lock_guard<std::mutex> lock(channels_mutex_);
     for (auto& channel : channels_) {
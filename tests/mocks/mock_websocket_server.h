@@ -172,6 +172,14 @@ class MockWebSocketServer {
      */
     void send_notification_to(int channel_id, const std::string& method, const json& params);
 
+    /**
+     * @brief Send a preformatted frame to all connected clients, byte for byte
+     *
+     * @param frame Complete message (e.g., a recorded notification)
+     * @return Number of clients the frame was sent to
+     */
+    int send_raw(const std::string& frame);
+
     /**
      * @brief Disconnect all connected clients
      */
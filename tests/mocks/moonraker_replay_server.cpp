@@ -0,0 +1,182 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_replay_server.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+MoonrakerReplayServer::~MoonrakerReplayServer() {
+    stop();
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+bool MoonrakerReplayServer::load(const std::string& path) {
+    std::vector<helix::TrafficFrame> frames;
+    if (!helix::load_traffic_recording(path, frames) && frames.empty()) {
+        return false;
+    }
+    load_frames(frames);
+    return true;
+}
+
+void MoonrakerReplayServer::load_frames(const std::vector<helix::TrafficFrame>& frames) {
+    notifications_.clear();
+    responses_.clear();
+    response_cursor_.clear();
+
+    // Requests tell us which method each response id belongs to
+    std::map<uint64_t, std::string> request_methods;
+    bool have_first = false;
+    uint64_t first_notification_us = 0;
+
+    for (const auto& frame : frames) {
+        json j = json::parse(frame.payload, nullptr, false);
+        if (j.is_discarded() || !j.is_object()) {
+            continue;
+        }
+
+        if (frame.direction == helix::TrafficFrame::Direction::SENT) {
+            if (j.contains("id") && j["id"].is_number_unsigned() && j.contains("method")) {
+                request_methods[j["id"].get<uint64_t>()] = j["method"].get<std::string>();
+            }
+            continue;
+        }
+
+        if (j.contains("id")) {
+            auto it = j["id"].is_number_unsigned()
+                          ? request_methods.find(j["id"].get<uint64_t>())
+                          : request_methods.end();
+            if (it == request_methods.end()) {
+                continue; // Response to a request the recording missed
+            }
+            Response response;
+            if (j.contains("error")) {
+                response.is_error = true;
+                response.error_message = j["error"].value("message", "Recorded error");
+            } else {
+                response.result = j.value("result", json::object());
+            }
+            responses_[it->second].push_back(std::move(response));
+            continue;
+        }
+
+        if (!have_first) {
+            first_notification_us = frame.timestamp_us;
+            have_first = true;
+        }
+        notifications_.push_back(Notification{frame.timestamp_us - first_notification_us,
+                                              j.value("method", ""), frame.payload});
+    }
+
+    spdlog::info("[ReplayWS] Loaded {} notifications, responses for {} methods",
+                 notifications_.size(), responses_.size());
+}
+
+size_t MoonrakerReplayServer::response_method_count() const {
+    return responses_.size();
+}
+
+// ============================================================================
+// Server
+// ============================================================================
+
+int MoonrakerReplayServer::start(int port) {
+    for (const auto& [method, recorded] : responses_) {
+        const std::string name = method;
+        server_.on_method(name, [this, name](const json&) {
+            std::lock_guard<std::mutex> lock(responses_mutex_);
+            const auto& queue = responses_[name];
+            size_t& cursor = response_cursor_[name];
+            const Response& response = queue[std::min(cursor, queue.size() - 1)];
+            cursor++;
+            if (response.is_error) {
+                // MockWebSocketServer reports handler exceptions as JSON-RPC errors
+                throw std::runtime_error(response.error_message);
+            }
+            return response.result;
+        });
+    }
+    return server_.start(port);
+}
+
+void MoonrakerReplayServer::stop() {
+    stop_playback();
+    server_.stop();
+}
+
+// ============================================================================
+// Playback
+// ============================================================================
+
+void MoonrakerReplayServer::play(double speed) {
+    stop_playback();
+
+    {
+        std::lock_guard<std::mutex> lock(playback_mutex_);
+        send_times_.clear();
+        send_times_.reserve(notifications_.size());
+    }
+    frames_played_.store(0);
+    stop_requested_.store(false);
+    playing_.store(true);
+    playback_thread_ = std::thread([this, speed]() { playback_loop(speed); });
+}
+
+void MoonrakerReplayServer::playback_loop(double speed) {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& notification : notifications_) {
+        if (speed > 0.0) {
+            auto due = start + std::chrono::microseconds(static_cast<int64_t>(
+                                   static_cast<double>(notification.offset_us) / speed));
+            std::unique_lock<std::mutex> lock(playback_mutex_);
+            playback_cv_.wait_until(lock, due, [this]() { return stop_requested_.load(); });
+        }
+        if (stop_requested_.load()) {
+            break;
+        }
+
+        auto sent_at = std::chrono::steady_clock::now();
+        server_.send_raw(notification.frame);
+        {
+            std::lock_guard<std::mutex> lock(playback_mutex_);
+            send_times_.push_back(sent_at);
+        }
+        frames_played_++;
+    }
+
+    spdlog::debug("[ReplayWS] Played {} of {} notifications", frames_played_.load(),
+                  notifications_.size());
+    {
+        std::lock_guard<std::mutex> lock(playback_mutex_);
+        playing_.store(false);
+    }
+    playback_cv_.notify_all();
+}
+
+bool MoonrakerReplayServer::wait_until_done(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(playback_mutex_);
+    return playback_cv_.wait_for(lock, timeout, [this]() { return !playing_.load(); });
+}
+
+void MoonrakerReplayServer::stop_playback() {
+    {
+        std::lock_guard<std::mutex> lock(playback_mutex_);
+        stop_requested_.store(true);
+    }
+    playback_cv_.notify_all();
+    if (playback_thread_.joinable()) {
+        playback_thread_.join();
+    }
+}
+
+std::vector<std::chrono::steady_clock::time_point> MoonrakerReplayServer::send_times() const {
+    std::lock_guard<std::mutex> lock(playback_mutex_);
+    return send_times_;
+}
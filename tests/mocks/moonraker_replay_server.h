@@ -0,0 +1,171 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef MOONRAKER_REPLAY_SERVER_H
+#define MOONRAKER_REPLAY_SERVER_H
+
+/**
+ * @file moonraker_replay_server.h
+ * @brief Replays recorded Moonraker traffic to a real MoonrakerClient
+ *
+ * Built on MockWebSocketServer. A recording (see moonraker_traffic_recorder.h)
+ * is split into:
+ * - Responses: every recorded request method is answered with the results it
+ *   got during recording, in order (the last one repeats once exhausted).
+ * - Notifications: frames without an id, sent verbatim by play() at their
+ *   recorded offsets, scaled by a speed factor.
+ *
+ * @example
+ * MoonrakerReplayServer replay;
+ * replay.load("busy_print.hxtr");
+ * replay.start();
+ * client.connect(replay.url().c_str(), on_connected, on_disconnected);
+ * // ... discover / subscribe ...
+ * replay.play(10.0); // 10x speed
+ * replay.wait_until_done(std::chrono::seconds(30));
+ */
+
+#include "mock_websocket_server.h"
+#include "moonraker_traffic_recorder.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class MoonrakerReplayServer {
+  public:
+    /**
+     * @brief A recorded server-initiated frame
+     */
+    struct Notification {
+        uint64_t offset_us = 0; ///< Time since the first notification
+        std::string method;     ///< e.g. "notify_status_update"
+        std::string frame;      ///< Exact bytes Moonraker sent
+    };
+
+    MoonrakerReplayServer() = default;
+    ~MoonrakerReplayServer();
+
+    MoonrakerReplayServer(const MoonrakerReplayServer&) = delete;
+    MoonrakerReplayServer& operator=(const MoonrakerReplayServer&) = delete;
+
+    // =========================================================================
+    // Recording
+    // =========================================================================
+
+    /**
+     * @brief Load a recording file
+     * @return false if the file cannot be read (see load_traffic_recording())
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Use frames directly (e.g., built by a test)
+     */
+    void load_frames(const std::vector<helix::TrafficFrame>& frames);
+
+    const std::vector<Notification>& notifications() const {
+        return notifications_;
+    }
+
+    /**
+     * @brief Number of request methods that have recorded responses
+     */
+    size_t response_method_count() const;
+
+    // =========================================================================
+    // Server
+    // =========================================================================
+
+    /**
+     * @brief Start serving (registers the recorded responses)
+     * @param port Port to listen on (0 = ephemeral)
+     * @return Actual port, or -1 on failure
+     */
+    int start(int port = 0);
+
+    /**
+     * @brief Stop playback and the server
+     */
+    void stop();
+
+    std::string url() const {
+        return server_.url();
+    }
+
+    MockWebSocketServer& server() {
+        return server_;
+    }
+
+    // =========================================================================
+    // Playback
+    // =========================================================================
+
+    /**
+     * @brief Send the recorded notifications on a background thread
+     * @param speed Time scale (1.0 = recorded pace, 10.0 = 10x faster,
+     *              0 = as fast as possible)
+     */
+    void play(double speed = 1.0);
+
+    /**
+     * @brief Wait for playback to finish
+     * @return false on timeout
+     */
+    bool wait_until_done(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Abort playback (no-op if not playing)
+     */
+    void stop_playback();
+
+    bool is_playing() const {
+        return playing_.load();
+    }
+
+    /**
+     * @brief Notifications sent by the current or last play()
+     */
+    size_t frames_played() const {
+        return frames_played_.load();
+    }
+
+    /**
+     * @brief When each played notification went out (index-aligned with notifications())
+     */
+    std::vector<std::chrono::steady_clock::time_point> send_times() const;
+
+  private:
+    /// A recorded JSON-RPC response: either a result or an error
+    struct Response {
+        json result;
+        bool is_error = false;
+        std::string error_message;
+    };
+
+    void playback_loop(double speed);
+
+    MockWebSocketServer server_;
+
+    std::vector<Notification> notifications_;
+    std::map<std::string, std::deque<Response>> responses_;
+    std::map<std::string, size_t> response_cursor_;
+    std::mutex responses_mutex_;
+
+    std::thread playback_thread_;
+    std::atomic<bool> playing_{false};
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<size_t> frames_played_{0};
+    std::vector<std::chrono::steady_clock::time_point> send_times_;
+    mutable std::mutex playback_mutex_;
+    std::condition_variable playback_cv_;
+};
+
+#endif // MOONRAKER_REPLAY_SERVER_H
@@ -665,3 +665,18 @@ class TestIntegration:
 
         assert len(result.warnings) > 0
         assert any("Home" in w or "Cancel" in w for w in result.warnings)
+
+    def test_pipeline_skips_c_without_c_dir(self, tmp_path):
+        """lv_i18n C output is opt-in; the app uses per-language catalogs."""
+        from generate_translations import generate_all
+
+        yaml_dir = tmp_path / "translations"
+        yaml_dir.mkdir()
+        (yaml_dir / "en.yml").write_text("locale: en\ntranslations:\n  Home: Home\n")
+
+        xml_dir = tmp_path / "xml"
+        result = generate_all(yaml_dir=yaml_dir, xml_output_dir=xml_dir)
+
+        assert result.success
+        assert (xml_dir / "translations.xml").exists()
+        assert not list(tmp_path.rglob("lv_i18n_translations.*"))
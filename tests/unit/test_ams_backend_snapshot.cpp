@@ -0,0 +1,98 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ams_backend_mock.h"
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_ams_backend_snapshot.cpp
+ * @brief Unit tests for lock-free AMS system snapshots and slot diffing
+ *
+ * Backends publish an immutable AmsSystemInfo whenever they emit an event;
+ * AmsState reads it without taking the backend lock and only notifies slots
+ * whose displayed data changed (SlotInfo::same_display_state).
+ */
+
+TEST_CASE("AmsBackend snapshot falls back before first publish", "[ams][snapshot]") {
+    AmsBackendMock backend(4);
+
+    auto snapshot = backend.get_system_snapshot();
+    REQUIRE(snapshot != nullptr);
+    CHECK(snapshot->total_slots == 4);
+}
+
+TEST_CASE("AmsBackend publishes a new snapshot on each event", "[ams][snapshot]") {
+    AmsBackendMock backend(4);
+    backend.set_operation_delay(0);
+    REQUIRE(backend.start());
+
+    auto before = backend.get_system_snapshot();
+    REQUIRE(before != nullptr);
+    const SlotInfo* original = before->get_slot_global(1);
+    REQUIRE(original != nullptr);
+    uint32_t original_color = original->color_rgb;
+
+    SlotInfo edited = backend.get_slot_info(1);
+    edited.color_rgb = original_color ^ 0x00FFFFFF;
+    edited.material = "TPU";
+    REQUIRE(backend.set_slot_info(1, edited));
+
+    SECTION("new snapshot reflects the change") {
+        auto after = backend.get_system_snapshot();
+        REQUIRE(after != before);
+        CHECK(after->get_slot_global(1)->color_rgb == edited.color_rgb);
+        CHECK(after->get_slot_global(1)->material == "TPU");
+    }
+
+    SECTION("held snapshot is immutable") {
+        CHECK(before->get_slot_global(1)->color_rgb == original_color);
+        CHECK(before->get_slot_global(1)->material != "TPU");
+    }
+
+    SECTION("snapshot is shared until the next event") {
+        CHECK(backend.get_system_snapshot() == backend.get_system_snapshot());
+    }
+
+    backend.stop();
+}
+
+TEST_CASE("SlotInfo::same_display_state compares displayed fields", "[ams][snapshot]") {
+    SlotInfo a;
+    a.slot_index = 0;
+    a.global_index = 0;
+    a.status = SlotStatus::AVAILABLE;
+    a.color_rgb = 0xFF0000;
+    a.material = "PLA";
+    a.remaining_weight_g = 500.0f;
+    a.total_weight_g = 1000.0f;
+
+    SlotInfo b = a;
+    CHECK(a.same_display_state(b));
+
+    SECTION("index and temperature fields are not displayed") {
+        b.slot_index = 3;
+        b.nozzle_temp_min = 190;
+        CHECK(a.same_display_state(b));
+    }
+
+    SECTION("color change is detected") {
+        b.color_rgb = 0x00FF00;
+        CHECK_FALSE(a.same_display_state(b));
+    }
+
+    SECTION("status change is detected") {
+        b.status = SlotStatus::LOADED;
+        CHECK_FALSE(a.same_display_state(b));
+    }
+
+    SECTION("weight change is detected") {
+        b.remaining_weight_g = 480.0f;
+        CHECK_FALSE(a.same_display_state(b));
+    }
+
+    SECTION("tool mapping change is detected") {
+        b.mapped_tool = 2;
+        CHECK_FALSE(a.same_display_state(b));
+    }
+}
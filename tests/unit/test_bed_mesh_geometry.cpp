@@ -0,0 +1,138 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bed_mesh_geometry.h"
+#include "bed_mesh_projection.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::mesh;
+
+namespace {
+
+bed_mesh_view_state_t make_view(double angle_x, double angle_z) {
+    bed_mesh_view_state_t view{};
+    double x_rad = (angle_x + 90.0) * M_PI / 180.0;
+    double z_rad = angle_z * M_PI / 180.0;
+    view.cached_cos_x = std::cos(x_rad);
+    view.cached_sin_x = std::sin(x_rad);
+    view.cached_cos_z = std::cos(z_rad);
+    view.cached_sin_z = std::sin(z_rad);
+    view.camera_distance = 1500.0;
+    view.fov_scale = 420.0;
+    view.center_offset_x = 12;
+    view.center_offset_y = -7;
+    view.layer_offset_x = 136;
+    return view;
+}
+
+/// Toward-camera direction used by update_quad_draw_order()
+void view_dir(const bed_mesh_view_state_t& view, float dir[3]) {
+    dir[0] = static_cast<float>(-view.cached_sin_z * view.cached_sin_x);
+    dir[1] = static_cast<float>(view.cached_cos_z * view.cached_sin_x);
+    dir[2] = static_cast<float>(view.cached_cos_x);
+}
+
+/// 15x15 height field of quad centroids with a bump in the middle
+struct CenterGrid {
+    std::vector<float> x, y, z;
+
+    CenterGrid() {
+        for (int row = 0; row < 15; row++) {
+            for (int col = 0; col < 15; col++) {
+                x.push_back(static_cast<float>(col * 50 - 350));
+                y.push_back(static_cast<float>(350 - row * 50));
+                z.push_back(static_cast<float>(40.0 * std::exp(-((row - 7) * (row - 7) +
+                                                                 (col - 7) * (col - 7)) /
+                                                               10.0)));
+            }
+        }
+    }
+};
+
+/// Camera-space depth of a world point (larger = further)
+double depth_of(const bed_mesh_view_state_t& view, float x, float y, float z) {
+    return bed_mesh_projection_project_3d_to_2d(x, y, z, 800, 480, &view).depth;
+}
+
+} // namespace
+
+TEST_CASE("Bed Mesh Projection: batch kernel matches scalar projection", "[bed_mesh][projection]") {
+    std::vector<float> x, y, z;
+    for (int i = 0; i < 257; i++) {
+        x.push_back(static_cast<float>((i * 37) % 700 - 350));
+        y.push_back(static_cast<float>((i * 53) % 700 - 350));
+        z.push_back(static_cast<float>((i * 11) % 80 - 40));
+    }
+
+    for (double angle_z : {-45.0, 0.0, 30.0, 135.0, -170.0}) {
+        bed_mesh_view_state_t view = make_view(-25.0, angle_z);
+
+        std::vector<int> screen_x(x.size());
+        std::vector<int> screen_y(x.size());
+        bed_mesh_projection_project_batch(x.data(), y.data(), z.data(), x.size(), 800, 480, &view,
+                                          screen_x.data(), screen_y.data());
+
+        for (size_t i = 0; i < x.size(); i++) {
+            bed_mesh_point_3d_t expected =
+                bed_mesh_projection_project_3d_to_2d(x[i], y[i], z[i], 800, 480, &view);
+            // Single precision may round differently at pixel boundaries
+            CHECK(std::abs(screen_x[i] - expected.screen_x) <= 1);
+            CHECK(std::abs(screen_y[i] - expected.screen_y) <= 1);
+        }
+    }
+}
+
+TEST_CASE("Bed Mesh Geometry: draw order is back-to-front", "[bed_mesh][geometry]") {
+    CenterGrid grid;
+    bed_mesh_view_state_t view = make_view(-25.0, -45.0);
+    float dir[3];
+    view_dir(view, dir);
+
+    std::vector<float> keys;
+    std::vector<uint32_t> order;
+    update_draw_order(grid.x.data(), grid.y.data(), grid.z.data(), grid.x.size(), dir, true, keys,
+                      order);
+    REQUIRE(order.size() == grid.x.size());
+
+    // Same ordering the old projected average depth sort produced (furthest first)
+    for (size_t i = 1; i < order.size(); i++) {
+        double prev = depth_of(view, grid.x[order[i - 1]], grid.y[order[i - 1]],
+                               grid.z[order[i - 1]]);
+        double cur = depth_of(view, grid.x[order[i]], grid.y[order[i]], grid.z[order[i]]);
+        CHECK(prev >= cur - 1e-3);
+    }
+}
+
+TEST_CASE("Bed Mesh Geometry: incremental repair matches a full sort", "[bed_mesh][geometry]") {
+    CenterGrid grid;
+    std::vector<float> keys;
+    std::vector<uint32_t> order;
+
+    float dir[3];
+    view_dir(make_view(-25.0, -45.0), dir);
+    update_draw_order(grid.x.data(), grid.y.data(), grid.z.data(), grid.x.size(), dir, true, keys,
+                      order);
+
+    // Simulate a drag: small rotation steps, repairing the previous order each time
+    for (int step = 1; step <= 20; step++) {
+        view_dir(make_view(-25.0 - step * 0.5, -45.0 + step * 2.0), dir);
+        update_draw_order(grid.x.data(), grid.y.data(), grid.z.data(), grid.x.size(), dir, false,
+                          keys, order);
+
+        std::vector<float> fresh_keys;
+        std::vector<uint32_t> fresh;
+        update_draw_order(grid.x.data(), grid.y.data(), grid.z.data(), grid.x.size(), dir, true,
+                          fresh_keys, fresh);
+
+        REQUIRE(order.size() == fresh.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            // Ties may land in either order; the keys must match position by position
+            CHECK(keys[order[i]] == fresh_keys[fresh[i]]);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_bed_mesh_stats.cpp
+ * @brief Unit tests for compute_bed_mesh_stats()
+ */
+
+#include "../../include/bed_mesh_stats.h"
+
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+using Catch::Approx;
+
+TEST_CASE("compute_bed_mesh_stats finds extremes and their coordinates", "[bedmesh]") {
+    const float mesh_min[2] = {10.0f, 20.0f};
+    const float mesh_max[2] = {210.0f, 120.0f};
+    std::vector<std::vector<float>> matrix = {
+        {0.00f, 0.10f, 0.05f},
+        {-0.10f, 0.02f, 0.20f},
+    };
+
+    BedMeshStats stats = compute_bed_mesh_stats(matrix, mesh_min, mesh_max);
+
+    REQUIRE(stats.valid);
+    CHECK(stats.min_z == Approx(-0.10f));
+    CHECK(stats.max_z == Approx(0.20f));
+    CHECK(stats.range == Approx(0.30f));
+    CHECK(stats.mean == Approx(0.045f));
+    CHECK(stats.variance == Approx(0.0084583f).epsilon(1e-4));
+
+    // Row 0 is mesh_min Y, column 0 is mesh_min X
+    CHECK(stats.min_row == 1);
+    CHECK(stats.min_col == 0);
+    CHECK(stats.min_x == Approx(10.0f));
+    CHECK(stats.min_y == Approx(120.0f));
+    CHECK(stats.max_row == 1);
+    CHECK(stats.max_col == 2);
+    CHECK(stats.max_x == Approx(210.0f));
+    CHECK(stats.max_y == Approx(120.0f));
+}
+
+TEST_CASE("compute_bed_mesh_stats handles degenerate meshes", "[bedmesh]") {
+    const float mesh_min[2] = {0.0f, 0.0f};
+    const float mesh_max[2] = {100.0f, 100.0f};
+
+    SECTION("Empty matrix is invalid") {
+        CHECK_FALSE(compute_bed_mesh_stats({}, mesh_min, mesh_max).valid);
+        CHECK_FALSE(compute_bed_mesh_stats({{}, {}}, mesh_min, mesh_max).valid);
+    }
+
+    SECTION("Single point sits at mesh_min") {
+        BedMeshStats stats = compute_bed_mesh_stats({{0.25f}}, mesh_min, mesh_max);
+        REQUIRE(stats.valid);
+        CHECK(stats.range == 0.0f);
+        CHECK(stats.variance == 0.0f);
+        CHECK(stats.max_x == 0.0f);
+        CHECK(stats.max_y == 0.0f);
+    }
+
+    SECTION("Flat mesh reports the first point for min and max") {
+        BedMeshStats stats =
+            compute_bed_mesh_stats({{0.1f, 0.1f}, {0.1f, 0.1f}}, mesh_min, mesh_max);
+        CHECK(stats.range == 0.0f);
+        CHECK(stats.min_row == 0);
+        CHECK(stats.min_col == 0);
+        CHECK(stats.max_row == 0);
+        CHECK(stats.max_col == 0);
+    }
+}
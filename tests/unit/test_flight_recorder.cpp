@@ -0,0 +1,120 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "flight_recorder.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_flight_recorder.cpp
+ * @brief Unit tests for the mmap'd crash-surviving log ring buffer
+ */
+
+using helix::logging::FlightRecorder;
+
+namespace {
+
+std::string temp_recorder_path() {
+    return (std::filesystem::temp_directory_path() /
+            ("helix_flight_test_" + std::to_string(::getpid()) + ".flight"))
+        .string();
+}
+
+} // namespace
+
+TEST_CASE("FlightRecorder: records lines in order", "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    auto recorder = FlightRecorder::create(path, FlightRecorder::MIN_CAPACITY);
+    REQUIRE(recorder != nullptr);
+
+    recorder->write("first\n");
+    recorder->write("second\n");
+    CHECK(recorder->snapshot() == "first\nsecond\n");
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("FlightRecorder: capacity is rounded to a power of two", "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    auto recorder = FlightRecorder::create(path, 5000);
+    REQUIRE(recorder != nullptr);
+    CHECK(recorder->capacity() == 8192);
+
+    auto tiny = FlightRecorder::create(path, 1);
+    REQUIRE(tiny != nullptr);
+    CHECK(tiny->capacity() == FlightRecorder::MIN_CAPACITY);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("FlightRecorder: wraparound keeps newest whole lines", "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    auto recorder = FlightRecorder::create(path, FlightRecorder::MIN_CAPACITY);
+    REQUIRE(recorder != nullptr);
+
+    // 1000 lines of 10 bytes overflow a 4 KB ring several times
+    for (int i = 0; i < 1000; ++i) {
+        char line[16];
+        std::snprintf(line, sizeof(line), "line %04d\n", i);
+        recorder->write(line);
+    }
+
+    std::string text = recorder->snapshot();
+    CHECK(text.size() <= recorder->capacity());
+    CHECK(text.size() > recorder->capacity() - 20);
+    CHECK(text.rfind("line 0999\n") == text.size() - 10);
+    // Partial oldest line is dropped
+    CHECK(text.compare(0, 5, "line ") == 0);
+    CHECK(text.size() % 10 == 0);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("FlightRecorder: long lines are truncated", "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    auto recorder = FlightRecorder::create(path, FlightRecorder::MIN_CAPACITY);
+    REQUIRE(recorder != nullptr);
+
+    recorder->write(std::string(recorder->capacity(), 'x'));
+    CHECK(recorder->snapshot().size() == recorder->capacity() / 4);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("FlightRecorder: file is readable after the writer is gone",
+          "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    {
+        auto recorder = FlightRecorder::create(path, FlightRecorder::MIN_CAPACITY);
+        REQUIRE(recorder != nullptr);
+        recorder->write("before crash\n");
+    }
+
+    std::string text;
+    uint32_t pid = 0;
+    REQUIRE(FlightRecorder::read_file(path, text, &pid));
+    CHECK(text == "before crash\n");
+    CHECK(pid == static_cast<uint32_t>(::getpid()));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("FlightRecorder: rejects files that are not recorders", "[logging][flight_recorder]") {
+    std::string path = temp_recorder_path();
+    std::string text;
+
+    CHECK_FALSE(FlightRecorder::read_file(path + ".missing", text));
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(8192, 'z');
+    }
+    CHECK_FALSE(FlightRecorder::read_file(path, text));
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,324 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_gcode_analysis.cpp
+ * @brief Unit tests for analyze_gcode_file() and GCodeAnalysisService
+ */
+
+#include "../../include/gcode_analysis.h"
+#include "../../include/gcode_analysis_service.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+const char* SAMPLE_GCODE = "; generated by OrcaSlicer 2.3.1 on 2026-01-01\n"
+                           "; filament_type = PETG\n"
+                           "; total layer number = 2\n"
+                           "EXCLUDE_OBJECT_DEFINE NAME=cube CENTER=20,20 "
+                           "POLYGON=[[10,10],[30,10],[30,30],[10,30]]\n"
+                           "G28\n"
+                           "BED_MESH_CALIBRATE\n"
+                           "G90\n"
+                           "M83\n"
+                           "G1 Z0.2 F1000\n"
+                           "G1 X10 Y10 F6000\n"
+                           "G1 X30 Y10 E1.0\n"
+                           "G1 X30 Y30 E1.0\n"
+                           "G1 E-0.5\n"
+                           "G1 Z0.4\n"
+                           "G1 X10 Y30 E0.5\n"
+                           "G0 X50 Y50\n";
+
+std::string unique_path(const std::string& stem) {
+    static std::atomic<int> counter{0};
+    return std::filesystem::temp_directory_path().string() + "/" + stem + "_" +
+           std::to_string(counter++) + "_" + std::to_string(rand());
+}
+
+class TempGCodeFile {
+  public:
+    explicit TempGCodeFile(const std::string& content)
+        : path_(unique_path("test_gcode_analysis") + ".gcode") {
+        write(content);
+    }
+
+    ~TempGCodeFile() {
+        std::remove(path_.c_str());
+    }
+
+    void write(const std::string& content) {
+        std::ofstream file(path_, std::ios::trunc);
+        file << content;
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+class TempDir {
+  public:
+    TempDir() : path_(unique_path("test_gcode_analysis_cache")) {
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+} // namespace
+
+TEST_CASE("analyze_gcode_file collects everything in one pass", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+
+    auto analysis = analyze_gcode_file(file.path());
+    REQUIRE(analysis.has_value());
+
+    SECTION("Layer index and objects") {
+        REQUIRE(analysis->layers.size() == 2);
+        CHECK(analysis->layers[0].z_height == Approx(0.2f));
+        CHECK(analysis->layers[1].z_height == Approx(0.4f));
+        REQUIRE(analysis->objects.count("cube") == 1);
+        CHECK(analysis->objects.at("cube").polygon.size() == 4);
+
+        GCodeLayerIndex index;
+        analysis->restore_index(index);
+        CHECK(index.is_valid());
+        CHECK(index.get_layer_count() == 2);
+        CHECK(index.get_source_path() == file.path());
+        CHECK(index.get_objects().size() == 1);
+    }
+
+    SECTION("Pre-print operations and metadata") {
+        CHECK(analysis->operations.has_operation(OperationType::HOMING));
+        CHECK(analysis->operations.has_operation(OperationType::BED_MESH));
+        CHECK(analysis->metadata.slicer.find("OrcaSlicer") != std::string::npos);
+        CHECK(analysis->metadata.filament_type == "PETG");
+        CHECK(analysis->metadata.layer_count == 2);
+    }
+
+    SECTION("Per-layer extrusion stats") {
+        REQUIRE(analysis->layer_stats.size() == 2);
+        const auto& first = analysis->layer_stats[0];
+        CHECK(first.extrusion_moves == 2);
+        CHECK(first.travel_moves == 1);
+        CHECK(first.filament_mm == Approx(2.0f));
+        CHECK(first.path_length_mm == Approx(40.0f));
+        CHECK(first.bounds.min.x == Approx(10.0f));
+        CHECK(first.bounds.max.y == Approx(30.0f));
+
+        // Retract (-0.5) is neither an extrusion nor a travel
+        const auto& second = analysis->layer_stats[1];
+        CHECK(second.extrusion_moves == 1);
+        CHECK(second.travel_moves == 1);
+        CHECK(second.filament_mm == Approx(0.5f));
+
+        CHECK(analysis->extrusion_bounds.max.x == Approx(30.0f));
+        CHECK(analysis->extrusion_bounds.max.z == Approx(0.4f));
+    }
+
+    SECTION("Per-layer time estimates") {
+        REQUIRE(analysis->layer_stats.size() == 2);
+        float layers_total = 0.0f;
+        for (const auto& layer : analysis->layer_stats) {
+            CHECK(layer.duration_s > 0.0f);
+            layers_total += layer.duration_s;
+        }
+        // The travel to the first layer's start happens before the first layer
+        CHECK(analysis->time_table.total_s() > layers_total);
+    }
+}
+
+TEST_CASE("analyze_gcode_file estimates print time", "[gcode][analysis]") {
+    TempGCodeFile file("M204 S1000\n"
+                       "G1 X100 F6000\n"
+                       "G4 P500\n"
+                       "SET_VELOCITY_LIMIT VELOCITY=50\n"
+                       "G1 X0\n");
+
+    MachineLimits limits;
+    limits.max_velocity = 300.0;
+    limits.max_accel = 3000.0;
+    limits.square_corner_velocity = 5.0;
+
+    auto analysis = analyze_gcode_file(file.path(), limits);
+    REQUIRE(analysis.has_value());
+    CHECK(analysis->limits == limits);
+
+    // 100mm at 100 mm/s (1.1s with M204's 1000 mm/s^2), the dwell, then 100mm
+    // back at SET_VELOCITY_LIMIT's 50 mm/s (2.05s)
+    CHECK(analysis->time_table.total_s() == Approx(1.1f + 0.5f + 2.05f));
+    CHECK(analysis->time_table.elapsed_at(0) == 0.0f);
+}
+
+TEST_CASE("analyze_gcode_file rejects missing files", "[gcode][analysis]") {
+    CHECK_FALSE(analyze_gcode_file("/nonexistent/file.gcode").has_value());
+}
+
+TEST_CASE("analyze_gcode_file stops when cancelled", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+    std::atomic<bool> cancel{true};
+    CHECK_FALSE(analyze_gcode_file(file.path(), {}, &cancel).has_value());
+
+    cancel = false;
+    CHECK(analyze_gcode_file(file.path(), {}, &cancel).has_value());
+}
+
+TEST_CASE("GCodeAnalysis survives a cache round trip", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+    TempDir dir;
+    std::string cache_path = dir.path() + "/analysis.bin";
+
+    auto analysis = analyze_gcode_file(file.path());
+    REQUIRE(analysis.has_value());
+    REQUIRE(save_gcode_analysis(*analysis, cache_path));
+
+    auto loaded = load_gcode_analysis(cache_path);
+    REQUIRE(loaded.has_value());
+    CHECK(loaded->key == analysis->key);
+    REQUIRE(loaded->layers.size() == analysis->layers.size());
+    CHECK(loaded->layers[1].file_offset == analysis->layers[1].file_offset);
+    CHECK(loaded->index_stats.total_lines == analysis->index_stats.total_lines);
+    CHECK(loaded->objects.at("cube").center.x == Approx(20.0f));
+    CHECK(loaded->operations.operations.size() == analysis->operations.operations.size());
+    CHECK(loaded->metadata.filament_type == "PETG");
+    REQUIRE(loaded->layer_stats.size() == 2);
+    CHECK(loaded->layer_stats[0].filament_mm == Approx(2.0f));
+    CHECK(loaded->extrusion_bounds.max.x == Approx(30.0f));
+    CHECK(loaded->layer_stats[1].duration_s == analysis->layer_stats[1].duration_s);
+    CHECK(loaded->time_table.bucket_bytes == analysis->time_table.bucket_bytes);
+    CHECK(loaded->time_table.elapsed_s == analysis->time_table.elapsed_s);
+    CHECK(loaded->limits == analysis->limits);
+
+    SECTION("Truncated cache files are rejected") {
+        std::filesystem::resize_file(cache_path, std::filesystem::file_size(cache_path) / 2);
+        CHECK_FALSE(load_gcode_analysis(cache_path).has_value());
+    }
+}
+
+TEST_CASE("GCodeAnalysisService analyzes each file version once", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+    TempDir dir;
+
+    {
+        GCodeAnalysisService service(dir.path());
+        auto first = service.analyze(file.path());
+        REQUIRE(first);
+        CHECK(service.analysis_count() == 1);
+        CHECK(std::filesystem::exists(service.cache_path_for(file.path())));
+
+        auto again = service.analyze(file.path());
+        CHECK(again == first);
+        CHECK(service.analysis_count() == 1);
+    }
+
+    SECTION("A new session reads the disk cache") {
+        GCodeAnalysisService service(dir.path());
+        auto cached = service.get_cached(file.path());
+        REQUIRE(cached);
+        CHECK(cached->layers.size() == 2);
+        CHECK(service.analyze(file.path()));
+        CHECK(service.analysis_count() == 0);
+    }
+
+    SECTION("A modified file is analyzed again") {
+        file.write(std::string(SAMPLE_GCODE) + "G1 Z0.6\nG1 X20 Y20 E1\n");
+
+        GCodeAnalysisService service(dir.path());
+        CHECK_FALSE(service.get_cached(file.path()));
+        auto fresh = service.analyze(file.path());
+        REQUIRE(fresh);
+        CHECK(fresh->layers.size() == 3);
+        CHECK(service.analysis_count() == 1);
+    }
+
+    SECTION("New printer limits only invalidate the time estimate") {
+        GCodeAnalysisService service(dir.path());
+        MachineLimits limits;
+        limits.max_velocity = 150.0;
+        limits.max_accel = 1500.0;
+        service.set_machine_limits(limits);
+
+        // Layer index and metadata do not depend on the limits
+        auto cached = service.get_cached(file.path());
+        REQUIRE(cached);
+        CHECK_FALSE(cached->limits == limits);
+        CHECK(service.analyze(file.path()) == cached);
+        CHECK(service.analysis_count() == 0);
+
+        using Freshness = GCodeAnalysisService::Freshness;
+        CHECK_FALSE(service.get_cached(file.path(), Freshness::TIME_TABLE));
+        auto replanned = service.analyze(file.path(), Freshness::TIME_TABLE);
+        REQUIRE(replanned);
+        CHECK(replanned->limits == limits);
+        CHECK(service.analysis_count() == 1);
+        CHECK(service.get_cached(file.path(), Freshness::TIME_TABLE) == replanned);
+        CHECK(service.analyze(file.path()) == replanned);
+    }
+}
+
+TEST_CASE("GCodeAnalysisService answers background requests", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+    GCodeAnalysisService service("");
+
+    std::atomic<int> answered{0};
+    std::atomic<size_t> layers{0};
+    auto callback = [&](GCodeAnalysisService::AnalysisPtr analysis) {
+        if (analysis) {
+            layers = analysis->layers.size();
+        }
+        answered++;
+    };
+
+    // Both requests are answered; the second is merged or served from memory
+    service.request(file.path(), callback);
+    service.request(file.path(), callback);
+    service.wait_for_idle();
+
+    CHECK(answered == 2);
+    CHECK(layers == 2);
+    CHECK(service.analysis_count() == 1);
+
+    service.request("/nonexistent/file.gcode", callback);
+    service.wait_for_idle();
+    CHECK(answered == 3);
+}
+
+TEST_CASE("GCodeAnalysisService stops analyzing after shutdown", "[gcode][analysis]") {
+    TempGCodeFile file(SAMPLE_GCODE);
+    TempDir dir;
+    GCodeAnalysisService service(dir.path());
+    service.shutdown();
+
+    CHECK_FALSE(service.analyze(file.path()));
+    CHECK_FALSE(std::filesystem::exists(service.cache_path_for(file.path())));
+
+    bool answered = false;
+    service.request(file.path(), [&](GCodeAnalysisService::AnalysisPtr analysis) {
+        CHECK_FALSE(analysis);
+        answered = true;
+    });
+    CHECK(answered);
+}
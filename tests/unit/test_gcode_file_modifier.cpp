@@ -4,6 +4,7 @@
 #include "gcode_file_modifier.h"
 #include "gcode_ops_detector.h"
 
+#include <chrono>
 #include <fstream>
 
 #include "../catch_amalgamated.hpp"
@@ -331,9 +332,11 @@ TEST_CASE("GCodeFileModifier - Edge cases", "[gcode][modifier][edge]") {
         std::string content = "G28\nBED_MESH\nG1\n";
         std::string result = modifier.apply_to_content(content);
 
-        // Should have proper newlines
-        size_t newline_count = std::count(result.begin(), result.end(), '\n');
-        REQUIRE(newline_count == 2); // Two newlines for three lines
+        // Unmodified bytes (including the final newline) are copied as-is
+        REQUIRE(result == "G28\n; BED_MESH\nG1\n");
+
+        // CRLF: the comment goes before the '\r', a missing final newline stays missing
+        REQUIRE(modifier.apply_to_content("G28\r\nBED_MESH\r\nG1") == "G28\r\n; BED_MESH\r\nG1");
     }
 }
 
@@ -532,19 +535,16 @@ TEST_CASE("GCodeFileModifier - Streaming replace line", "[gcode][modifier][strea
 
 TEST_CASE("GCodeFileModifier - Auto-select streaming for large files",
           "[gcode][modifier][streaming]") {
-    // This test verifies that apply() selects the appropriate mode based on file size
-    // We can't easily create a 5MB test file, so we test the logic path
+    // apply() streams every file through the same fixed-size buffer
 
     GCodeFileModifier modifier;
 
-    // Create a small file (should use buffered mode)
     std::string small_path = "/tmp/helix_small_test.gcode";
     {
         std::ofstream out(small_path);
         out << "G28\nG1 X0\n";
     }
 
-    // apply() should succeed and use buffered mode (we can verify by log if needed)
     auto result = modifier.apply(small_path);
     REQUIRE(result.success);
 
@@ -555,6 +555,167 @@ TEST_CASE("GCodeFileModifier - Auto-select streaming for large files",
     }
 }
 
+TEST_CASE("GCodeFileModifier - Streaming multi-line operations", "[gcode][modifier][streaming]") {
+    GCodeFileModifier modifier;
+    std::string content = "L1\nL2\nL3\nL4\nL5\nL6\n";
+
+    SECTION("Range comment-out, delete and replace") {
+        modifier.add_modification(Modification::comment_out_range(1, 2));
+        modifier.add_modification({ModificationType::DELETE, 3, 4, "", ""});
+        modifier.add_modification({ModificationType::REPLACE, 5, 6, "R1\nR2\nR3", ""});
+
+        REQUIRE(modifier.apply_to_content(content) == "; L1\n; L2\nR1\nR2\nR3\n");
+    }
+
+    SECTION("Injections around edited lines keep their order") {
+        modifier.add_modification(Modification::inject_after(2, "A"));
+        modifier.add_modification(Modification::inject_before(2, "B1"));
+        modifier.add_modification(Modification::comment_out(2));
+        modifier.add_modification(Modification::inject_before(2, "B2"));
+
+        REQUIRE(modifier.apply_to_content(content) == "L1\nB1\nB2\n; L2\nA\nL3\nL4\nL5\nL6\n");
+    }
+
+    SECTION("First-added edit wins on overlapping lines") {
+        modifier.add_modification(Modification::replace(3, "R3"));
+        modifier.add_modification(Modification::comment_out_range(2, 4));
+
+        REQUIRE(modifier.apply_to_content(content) == "L1\n; L2\nR3\n; L4\nL5\nL6\n");
+    }
+
+    SECTION("Injecting after a last line without newline") {
+        modifier.add_modification(Modification::inject_after(2, "END"));
+        REQUIRE(modifier.apply_to_content("L1\nL2") == "L1\nL2\nEND");
+    }
+}
+
+TEST_CASE("GCodeFileModifier - Streaming copies large files unchanged past the last edit",
+          "[gcode][modifier][streaming]") {
+    std::string test_path = "/tmp/helix_stream_test_large.gcode";
+    std::string body;
+    for (int i = 0; i < 40000; ++i) {
+        body += "G1 X" + std::to_string(i % 200) + " Y" + std::to_string(i % 150) + " E0.05\n";
+    }
+    {
+        std::ofstream out(test_path, std::ios::binary);
+        out << "G28\nBED_MESH_CALIBRATE\n" << body;
+    }
+
+    GCodeFileModifier modifier;
+    modifier.add_modification(Modification::comment_out(2));
+    auto result = modifier.apply_streaming(test_path);
+    REQUIRE(result.success);
+    CHECK(result.original_size == body.size() + 23);
+    CHECK(result.modified_size == result.original_size + 2);
+
+    std::ifstream in(result.modified_path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    CHECK(content == "G28\n; BED_MESH_CALIBRATE\n" + body);
+
+    std::filesystem::remove(test_path);
+    std::filesystem::remove(result.modified_path);
+}
+
+TEST_CASE("GCodeFileModifier - In-place patching", "[gcode][modifier][in_place]") {
+    std::string test_path = "/tmp/helix_in_place_test.gcode";
+    auto write_file = [&](const std::string& text) {
+        std::ofstream out(test_path, std::ios::binary);
+        out << text;
+    };
+    auto read_file = [&]() {
+        std::ifstream in(test_path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    };
+    GCodeOpsDetector detector;
+    GCodeFileModifier modifier;
+
+    SECTION("Comments out a detected operation without changing the size") {
+        std::string content = "G28\nBED_MESH_CALIBRATE\r\n; already\nG1 X0\n";
+        write_file(content);
+        auto scan = detector.scan_content(content);
+        modifier.disable_operations(scan, {OperationType::BED_MESH});
+        modifier.add_modification(Modification::comment_out(3));
+
+        auto result = modifier.apply_in_place(test_path);
+        REQUIRE(result.success);
+        CHECK(result.modified_path == test_path);
+        CHECK(result.lines_modified == 1);
+        CHECK(read_file() == "G28\n;ED_MESH_CALIBRATE\r\n; already\nG1 X0\n");
+    }
+
+    SECTION("Shorter replacement is padded with spaces") {
+        std::string content = "G28\nSTART_PRINT BED=60 FORCE_LEVELING=1\nG1 X0\n";
+        write_file(content);
+        auto scan = detector.scan_content(content);
+        auto op = scan.get_operation(OperationType::BED_MESH);
+        REQUIRE(op.has_value());
+        REQUIRE(modifier.disable_macro_parameter(*op));
+
+        auto result = modifier.apply_in_place(test_path);
+        REQUIRE(result.success);
+        CHECK(read_file() == "G28\nSTART_PRINT BED=60 FORCE_LEVELING=0\nG1 X0\n");
+    }
+
+    SECTION("Size-changing modifications leave the file untouched") {
+        std::string content = "G28\nPRINT_START BED=60\nG1 X0\n";
+        write_file(content);
+
+        SECTION("Longer replacement") {
+            modifier.add_modification(Modification::replace(2, "PRINT_START BED=60 SKIP_QGL=1"));
+        }
+        SECTION("Injection") {
+            modifier.add_modification(Modification::inject_before(2, "G90"));
+        }
+        SECTION("Stale byte offset") {
+            auto mod = Modification::comment_out(2);
+            mod.byte_offset = 7;
+            modifier.add_modification(mod);
+        }
+
+        auto result = modifier.apply_in_place(test_path);
+        CHECK_FALSE(result.success);
+        CHECK_FALSE(result.error_message.empty());
+        CHECK(read_file() == content);
+    }
+
+    std::filesystem::remove(test_path);
+}
+
+TEST_CASE("GCodeFileModifier - Benchmark streaming copy vs in-place patch",
+          "[.benchmark][gcode][modifier]") {
+    std::string test_path = "/tmp/helix_modifier_bench.gcode";
+    {
+        std::ofstream out(test_path, std::ios::binary);
+        out << "G28\nBED_MESH_CALIBRATE\n";
+        std::string line = "G1 X100.000 Y100.000 E0.04000 ; extrusion move\n";
+        for (size_t written = 0; written < 200u * 1024 * 1024; written += line.size()) {
+            out << line;
+        }
+    }
+
+    GCodeFileModifier modifier;
+    modifier.add_modification(Modification::comment_out(2, "Disabled"));
+
+    auto start = std::chrono::steady_clock::now();
+    auto copied = modifier.apply_streaming(test_path);
+    auto copy_time = std::chrono::steady_clock::now() - start;
+    REQUIRE(copied.success);
+
+    start = std::chrono::steady_clock::now();
+    auto patched = modifier.apply_in_place(test_path);
+    auto patch_time = std::chrono::steady_clock::now() - start;
+    REQUIRE(patched.success);
+
+    auto to_ms = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+    };
+    WARN("200 MB streaming copy: " << to_ms(copy_time) << " ms");
+    WARN("200 MB in-place patch: " << to_ms(patch_time) << " ms");
+
+    std::filesystem::remove(copied.modified_path);
+    std::filesystem::remove(test_path);
+}
+
 // ============================================================================
 // PrintStartCallInfo Tests (Phase 5C)
 // ============================================================================
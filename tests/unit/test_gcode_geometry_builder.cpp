@@ -4,6 +4,8 @@
 #include "gcode_geometry_builder.h"
 #include "gcode_parser.h"
 
+#include <algorithm>
+
 #include "../catch_amalgamated.hpp"
 
 using namespace helix::gcode;
@@ -670,6 +672,65 @@ TEST_CASE("Geometry Builder: Geometry generation - very short segment",
     REQUIRE(geometry.vertices.size() > 0);
 }
 
+TEST_CASE("Geometry Builder: Geometry generation - per-object strip tracking",
+          "[gcode][geometry][generation][objects]") {
+    GeometryBuilder builder;
+    builder.set_filament_color("#ED1C24");
+
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(100, 100, 10);
+
+    // Two layers, each printing part_a, then part_b, then an unnamed purge line
+    for (int l = 0; l < 2; l++) {
+        Layer layer;
+        layer.z_height = 0.2f * (l + 1);
+        const char* names[] = {"part_a", "part_b", ""};
+        for (int o = 0; o < 3; o++) {
+            ToolpathSegment seg;
+            seg.start = glm::vec3(o * 30.0f, 0, layer.z_height);
+            seg.end = glm::vec3(o * 30.0f + 10.0f, 0, layer.z_height);
+            seg.is_extrusion = true;
+            seg.extrusion_amount = 1.0f;
+            seg.width = 0.4f;
+            seg.object_name = names[o];
+            layer.segments.push_back(seg);
+        }
+        gcode.layers.push_back(layer);
+    }
+
+    SimplificationOptions options;
+    options.enable_merging = false;
+    RibbonGeometry geometry = builder.build(gcode, options);
+
+    REQUIRE(geometry.object_names == std::vector<std::string>{"part_a", "part_b"});
+    REQUIRE(geometry.strip_object_index.size() == geometry.strips.size());
+    REQUIRE(geometry.object_strip_ranges.size() == 2);
+
+    // One run per object per layer, and runs cover exactly the strips tagged with the slot
+    for (uint16_t slot = 0; slot < 2; slot++) {
+        const auto& ranges = geometry.object_strip_ranges[slot];
+        REQUIRE(ranges.size() == 2);
+        size_t covered = 0;
+        for (const auto& [first, count] : ranges) {
+            for (size_t s = first; s < first + count; s++) {
+                REQUIRE(geometry.strip_object_index[s] == slot);
+            }
+            covered += count;
+        }
+        size_t tagged = std::count(geometry.strip_object_index.begin(),
+                                   geometry.strip_object_index.end(), slot);
+        REQUIRE(covered == tagged);
+    }
+    REQUIRE(std::count(geometry.strip_object_index.begin(), geometry.strip_object_index.end(),
+                       RibbonGeometry::NO_OBJECT) > 0);
+
+    // Colors are object-independent, so every object shares the filament palette slot
+    REQUIRE(geometry.color_palette.size() == 1);
+    REQUIRE(geometry.filament_color_slot == 0);
+    REQUIRE(geometry.color_palette[0] == 0xED1C24);
+}
+
 // ============================================================================
 // GeometryBuilder - Configuration Tests
 // ============================================================================
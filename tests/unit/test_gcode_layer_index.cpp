@@ -172,6 +172,29 @@ G1 X30 E0.6
     REQUIRE(index.get_layer_z(2) == Approx(0.6f));
 }
 
+TEST_CASE("GCodeLayerIndex - Object definitions", "[gcode][layer_index]") {
+    std::string gcode = "EXCLUDE_OBJECT_DEFINE NAME=cube CENTER=20,20 "
+                        "POLYGON=[[10,10],[30,10],[30,30],[10,30]]\r\n"
+                        "  EXCLUDE_OBJECT_DEFINE NAME=ring CENTER=60,20\n"
+                        "EXCLUDE_OBJECT_START NAME=cube\n"
+                        "G1 Z0.2 E0.1\n"
+                        "G1 Z0.4 E0.2\n";
+
+    TempGCodeFile file(gcode);
+    GCodeLayerIndex index;
+    REQUIRE(index.build_from_file(file.path()));
+
+    const auto& objects = index.get_objects();
+    REQUIRE(objects.size() == 2);
+    REQUIRE(objects.count("cube") == 1);
+    CHECK(objects.at("cube").polygon.size() == 4);
+    CHECK(objects.at("cube").polygon[2].y == Approx(30.0f));
+    CHECK(objects.at("ring").center.x == Approx(60.0f));
+
+    index.clear();
+    CHECK(index.get_objects().empty());
+}
+
 TEST_CASE("GCodeLayerIndex - Real file", "[gcode][layer_index][integration]") {
     // Test with the real benchy file if it exists
     std::ifstream check("assets/test_gcodes/3DBenchy.gcode");
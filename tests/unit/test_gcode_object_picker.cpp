@@ -0,0 +1,221 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_object_picker.h"
+
+#include <chrono>
+#include <glm/gtc/matrix_transform.hpp>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+constexpr float VIEWPORT = 400.0f;
+
+GCodeObject square_object(const std::string& name, float x, float y, float size, float height) {
+    GCodeObject obj;
+    obj.name = name;
+    obj.center = {x + size / 2, y + size / 2};
+    obj.polygon = {{x, y}, {x + size, y}, {x + size, y + size}, {x, y + size}};
+    obj.bounding_box.expand({x, y, 0.2f});
+    obj.bounding_box.expand({x + size, y + size, height});
+    return obj;
+}
+
+/// Camera straight above the bed, looking down at its center
+glm::mat4 top_down_view() {
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 1.0f, 1000.0f);
+    glm::mat4 view =
+        glm::lookAt(glm::vec3(100.0f, 100.0f, 300.0f), glm::vec3(100.0f, 100.0f, 0.0f),
+                    glm::vec3(0.0f, 1.0f, 0.0f));
+    return projection * view;
+}
+
+/// Screen position of a bed point under a view (what the renderer would draw)
+glm::vec2 project(const glm::mat4& vp, const glm::vec3& point) {
+    glm::vec4 clip = vp * glm::vec4(point, 1.0f);
+    glm::vec2 ndc = glm::vec2(clip) / clip.w;
+    return {(ndc.x + 1.0f) * 0.5f * VIEWPORT, (1.0f - ndc.y) * 0.5f * VIEWPORT};
+}
+
+} // namespace
+
+TEST_CASE("ObjectPicker: picks the object under the tap", "[gcode][picker]") {
+    std::map<std::string, GCodeObject> objects;
+    objects["left"] = square_object("left", 40, 90, 20, 10);
+    objects["right"] = square_object("right", 140, 90, 20, 10);
+
+    ObjectPicker picker;
+    picker.build(objects, 0.0f, 10.0f);
+    REQUIRE(picker.size() == 2);
+
+    glm::mat4 vp = top_down_view();
+    glm::vec2 viewport(VIEWPORT, VIEWPORT);
+
+    SECTION("Direct hits") {
+        CHECK(picker.pick(project(vp, {50, 100, 10}), vp, viewport, 0.0f, 10.0f) == "left");
+        CHECK(picker.pick(project(vp, {150, 100, 10}), vp, viewport, 0.0f, 10.0f) == "right");
+    }
+
+    SECTION("Empty bed picks nothing") {
+        CHECK_FALSE(picker.pick(project(vp, {100, 100, 0}), vp, viewport, 0.0f, 10.0f));
+    }
+
+    SECTION("Near miss within the pixel threshold") {
+        glm::vec2 edge = project(vp, {60, 100, 10});
+        CHECK(picker.pick(edge + glm::vec2(5.0f, 0.0f), vp, viewport, 0.0f, 10.0f) == "left");
+        CHECK_FALSE(picker.pick(edge + glm::vec2(40.0f, 0.0f), vp, viewport, 0.0f, 10.0f));
+    }
+
+    SECTION("Objects above the visible layers are not pickable") {
+        objects["tall"] = square_object("tall", 90, 20, 20, 50);
+        picker.build(objects, 0.0f, 50.0f);
+        glm::vec2 tap = project(vp, {100, 30, 50});
+        CHECK(picker.pick(tap, vp, viewport, 0.0f, 50.0f) == "tall");
+        CHECK(picker.pick(tap, vp, viewport, 20.0f, 50.0f) == "tall");
+        CHECK(picker.pick(project(vp, {50, 100, 10}), vp, viewport, 20.0f, 50.0f) != "left");
+    }
+}
+
+TEST_CASE("ObjectPicker: nearest object wins when footprints overlap on screen",
+          "[gcode][picker]") {
+    // A tall object in front of a short one, seen from a low angle
+    std::map<std::string, GCodeObject> objects;
+    objects["front_tall"] = square_object("front_tall", 90, 60, 20, 60);
+    objects["back_short"] = square_object("back_short", 90, 120, 20, 5);
+
+    ObjectPicker picker;
+    picker.build(objects, 0.0f, 60.0f);
+
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 1.0f, 1000.0f);
+    glm::mat4 view = glm::lookAt(glm::vec3(100.0f, -150.0f, 40.0f),
+                                 glm::vec3(100.0f, 130.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+    glm::mat4 vp = projection * view;
+
+    // The line of sight to the short object's top passes through the tall one
+    glm::vec2 tap = project(vp, {100, 130, 5});
+    CHECK(picker.pick(tap, vp, glm::vec2(VIEWPORT), 0.0f, 60.0f) == "front_tall");
+}
+
+TEST_CASE("ObjectPicker: works from object metadata alone", "[gcode][picker]") {
+    SECTION("Non-rectangular polygon") {
+        GCodeObject triangle;
+        triangle.polygon = {{0, 0}, {100, 0}, {0, 100}};
+        std::map<std::string, GCodeObject> objects{{"triangle", triangle}};
+
+        ObjectPicker picker;
+        picker.build(objects, 0.0f, 5.0f); // No bounding box: default Z range
+        CHECK(picker.pick_at({10, 10}) == "triangle");
+        CHECK_FALSE(picker.pick_at({80, 80}));
+    }
+
+    SECTION("Bounding box when segments were cleared of polygon data") {
+        GCodeObject obj;
+        obj.bounding_box.expand({10, 10, 0.2f});
+        obj.bounding_box.expand({30, 20, 4.0f});
+        std::map<std::string, GCodeObject> objects{{"box", obj}};
+
+        ObjectPicker picker;
+        picker.build(objects, 0.0f, 4.0f);
+        CHECK(picker.pick_at({20, 15}) == "box");
+        CHECK_FALSE(picker.pick_at({20, 25}));
+    }
+
+    SECTION("Objects with no geometry are skipped") {
+        std::map<std::string, GCodeObject> objects{{"ghost", GCodeObject{}}};
+        ObjectPicker picker;
+        picker.build(objects, 0.0f, 4.0f);
+        CHECK(picker.empty());
+        CHECK_FALSE(picker.pick({0, 0}, glm::mat4(1.0f), glm::vec2(VIEWPORT), 0.0f, 4.0f));
+    }
+}
+
+TEST_CASE("ObjectPicker: parsed file helpers", "[gcode][picker]") {
+    ParsedGCodeFile gcode;
+    gcode.filename = "plate.gcode";
+    for (float z : {0.2f, 0.4f, 0.6f}) {
+        Layer layer;
+        layer.z_height = z;
+        gcode.layers.push_back(layer);
+    }
+    gcode.objects["cube"] = square_object("cube", 10, 10, 20, 0.6f);
+
+    SECTION("Index is rebuilt only when the file changes") {
+        ObjectPicker picker;
+        CHECK(picker.sync(gcode));
+        CHECK_FALSE(picker.sync(gcode));
+        CHECK(picker.pick_at({20, 20}) == "cube");
+
+        gcode.objects["ring"] = square_object("ring", 50, 10, 20, 0.6f);
+        CHECK(picker.sync(gcode));
+        CHECK(picker.size() == 2);
+    }
+
+    SECTION("Visible Z range follows the layer range") {
+        float z_min = 0.0f;
+        float z_max = 0.0f;
+        REQUIRE(ObjectPicker::visible_z_range(gcode, 0, -1, z_min, z_max));
+        CHECK(z_min == Catch::Approx(0.0f));
+        CHECK(z_max == Catch::Approx(0.6f));
+
+        REQUIRE(ObjectPicker::visible_z_range(gcode, 1, 1, z_min, z_max));
+        CHECK(z_min == Catch::Approx(0.2f));
+        CHECK(z_max == Catch::Approx(0.4f));
+
+        CHECK_FALSE(ObjectPicker::visible_z_range(ParsedGCodeFile{}, 0, -1, z_min, z_max));
+    }
+}
+
+TEST_CASE("ObjectPicker: objects without EXCLUDE_OBJECT_DEFINE", "[gcode][picker]") {
+    GCodeParser parser;
+    for (const char* line :
+         {"G90", "M82", "G1 Z0.2 F3000", "EXCLUDE_OBJECT_START NAME=cube", "G1 X10 Y10",
+          "G1 X30 Y10 E1", "G1 X30 Y30 E2", "G1 X10 Y30 E3", "EXCLUDE_OBJECT_END NAME=cube",
+          "G1 X60 Y10", "EXCLUDE_OBJECT_START NAME=disc", "G1 X80 Y10 E4", "G1 X80 Y30 E5",
+          "EXCLUDE_OBJECT_END NAME=disc"}) {
+        parser.parse_line(line);
+    }
+    ParsedGCodeFile gcode = parser.finalize();
+    gcode.filename = "undefined_objects.gcode";
+
+    CHECK(gcode.objects.empty());
+    REQUIRE(gcode.segment_objects.size() == 2);
+
+    // Picking still works once the segments are gone
+    gcode.clear_segments();
+    ObjectPicker picker;
+    CHECK(picker.sync(gcode));
+    CHECK(picker.size() == 2);
+    CHECK(picker.pick_at({20, 20}) == "cube");
+    CHECK(picker.pick_at({70, 20}) == "disc");
+    CHECK_FALSE(picker.pick_at({45, 20}));
+}
+
+TEST_CASE("ObjectPicker: benchmark 40-object plate", "[.benchmark][gcode][picker]") {
+    std::map<std::string, GCodeObject> objects;
+    for (int i = 0; i < 40; ++i) {
+        std::string name = "part_" + std::to_string(i);
+        objects[name] = square_object(name, 10.0f + (i % 8) * 24.0f, 10.0f + (i / 8) * 36.0f,
+                                      18.0f, 15.0f);
+    }
+
+    ObjectPicker picker;
+    picker.build(objects, 0.0f, 15.0f);
+    glm::mat4 vp = top_down_view();
+
+    constexpr int TAPS = 10000;
+    int hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TAPS; ++i) {
+        glm::vec2 tap(static_cast<float>(i % 400), static_cast<float>((i * 7) % 400));
+        hits += picker.pick(tap, vp, glm::vec2(VIEWPORT), 0.0f, 15.0f) ? 1 : 0;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK(hits > 0);
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    WARN("pick: " << ns / TAPS << " ns/tap (" << hits << "/" << TAPS << " hits)");
+}
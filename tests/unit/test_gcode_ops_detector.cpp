@@ -184,6 +184,38 @@ TEST_CASE("GCodeOpsDetector - Scanning limits", "[gcode][ops]") {
         REQUIRE(result.reached_limit);
         REQUIRE_FALSE(result.has_operation(OperationType::BED_MESH));
     }
+
+    SECTION("Thumbnail blocks do not count towards limits") {
+        std::string content = "; thumbnail begin 300x300 2000\n";
+        for (int i = 0; i < 40; i++) {
+            content += "; iVBORw0KGgoAAAANSUhEUgAAASwAAAEsCAYAAAB5fY51AAAAOXRFWHRTb2Z0\n";
+        }
+        content += "; thumbnail end\n"
+                   "; thumbnail_JPG begin 32x32 500\n"
+                   "; /9j/4AAQSkZJRgABAQAAAQABAAD\n"
+                   "; thumbnail_JPG end\n"
+                   "BED_MESH_CALIBRATE\n";
+
+        auto result = detector.scan_content(content);
+
+        REQUIRE_FALSE(result.reached_limit);
+        REQUIRE(result.has_operation(OperationType::BED_MESH));
+        auto op = result.get_operation(OperationType::BED_MESH);
+        REQUIRE(op.has_value());
+        CHECK(op->line_number == 46);
+        CHECK(op->byte_offset == content.size() - std::string("BED_MESH_CALIBRATE\n").size());
+    }
+
+    SECTION("Reports whether the input ended before a stop condition") {
+        CHECK(detector.scan_content("G28\nBED_MESH_CALIBRATE\n").reached_end);
+        CHECK_FALSE(detector.scan_content("G28\nG1 X10 E0.5\n").reached_end);
+
+        std::string long_comments;
+        for (int i = 0; i < 20; i++) {
+            long_comments += "; comment line\n";
+        }
+        CHECK_FALSE(detector.scan_content(long_comments).reached_end);
+    }
 }
 
 // ============================================================================
@@ -0,0 +1,317 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_response_dispatcher.h"
+
+#include <chrono>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_gcode_response_dispatcher.cpp
+ * @brief Tests for the shared notify_gcode_response classifier and router
+ *
+ * The parsers replaced std::regex captures in the calibration collectors, so
+ * the expectations below mirror what those regexes extracted.
+ */
+
+using namespace helix;
+using Catch::Approx;
+
+// ============================================================================
+// Classification
+// ============================================================================
+
+TEST_CASE("GCodeResponseDispatcher: classifies console lines", "[gcode_response][dispatcher]") {
+    using namespace gcode_line;
+
+    CHECK(classify_gcode_line("ok") == ACK);
+    CHECK(classify_gcode_line("ok ") == 0);
+    CHECK(classify_gcode_line("") == 0);
+
+    CHECK(classify_gcode_line("!! Move out of range") == KLIPPER_ERROR);
+    CHECK(classify_gcode_line("Error: ADXL345 not found") == (KLIPPER_ERROR | MENTIONS_ERROR));
+    CHECK(classify_gcode_line("// probe error: timeout") ==
+          (COMMENT | KLIPPER_ERROR | MENTIONS_ERROR));
+    CHECK(classify_gcode_line("Error in macro") == MENTIONS_ERROR);
+    CHECK(classify_gcode_line("// Unknown command:\"SCREWS_TILT_CALCULATE\"") ==
+          (COMMENT | UNKNOWN_COMMAND));
+
+    CHECK(classify_gcode_line(
+              "Fitted shaper 'mzv' frequency = 36.7 Hz (vibrations = 7.2%, smoothing ~= 0.140)") ==
+          FITTED_SHAPER);
+    CHECK(classify_gcode_line("Recommended shaper is mzv @ 36.7 Hz") == RECOMMENDED_SHAPER);
+    CHECK(classify_gcode_line("axes_noise = 0.012345") == AXES_NOISE);
+    CHECK(classify_gcode_line("Writing raw accelerometer data to /tmp/raw_data_x.csv file") ==
+          RAW_DATA_FILE);
+    CHECK(classify_gcode_line("// Probing point 5/25") == (COMMENT | PROBE_PROGRESS));
+    CHECK(classify_gcode_line("Probe point 5 of 25") == PROBE_PROGRESS);
+    CHECK(classify_gcode_line("Mesh Bed Leveling Complete") == MESH_COMPLETE);
+    CHECK(classify_gcode_line("// Mesh bed leveling complete") == (COMMENT | MESH_COMPLETE));
+    CHECK(classify_gcode_line("RESPOND MSG=HELIX:PHASE:HOMING") == HELIX_PHASE);
+
+    // Unrelated traffic carries no bits, so it never reaches specific subscribers
+    CHECK(classify_gcode_line("B:60.0 /60.0 T0:210.0 /210.0") == 0);
+    CHECK(classify_gcode_line("// probe at 150.000,150.000 is z=2.012500") == COMMENT);
+}
+
+// ============================================================================
+// Value parsers
+// ============================================================================
+
+TEST_CASE("GCodeResponseDispatcher: decimal parsing", "[gcode_response][parsers]") {
+    float value = 0.0f;
+
+    std::string_view text = "36.7 Hz";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == Approx(36.7f));
+    CHECK(text == " Hz");
+
+    text = "0.012345";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == Approx(0.012345f));
+    CHECK(text.empty());
+
+    text = "5";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == 5.0f);
+
+    text = ".5";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == 0.5f);
+
+    // [\d.]+ consumes the whole run; std::stof stopped at the second dot
+    text = "1.2.3)";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == Approx(1.2f));
+    CHECK(text == ")");
+
+    text = "0.1234567890123456789012";
+    REQUIRE(parse_decimal(text, value));
+    CHECK(value == Approx(0.123456789f));
+
+    text = "Hz";
+    CHECK_FALSE(parse_decimal(text, value));
+    CHECK(text == "Hz");
+
+    text = "-1.5";
+    CHECK_FALSE(parse_decimal(text, value));
+}
+
+TEST_CASE("GCodeResponseDispatcher: shaper line parsers", "[gcode_response][parsers]") {
+    FittedShaperLine fit;
+    REQUIRE(parse_fitted_shaper(
+        "Fitted shaper '2hump_ei' frequency = 61.4 Hz (vibrations = 0.0%, smoothing ~= 0.073)",
+        fit));
+    CHECK(fit.type == "2hump_ei");
+    CHECK(fit.frequency == Approx(61.4f));
+    CHECK(fit.vibrations == 0.0f);
+    CHECK(fit.smoothing == Approx(0.073f));
+
+    CHECK_FALSE(parse_fitted_shaper("Fitted shaper 'mzv' frequency = 36.7 Hz", fit));
+    CHECK_FALSE(parse_fitted_shaper("Fitted shaper '' frequency = 1 Hz (vibrations = 1%, "
+                                    "smoothing ~= 1)",
+                                    fit));
+
+    std::string type;
+    float freq = 0.0f;
+    REQUIRE(parse_recommended_shaper("Recommended shaper is mzv @ 36.7 Hz", type, freq));
+    CHECK(type == "mzv");
+    CHECK(freq == Approx(36.7f));
+    REQUIRE(parse_recommended_shaper("Recommended shaper_type_x = ei, shaper_freq_x = 48.0 Hz. "
+                                     "Recommended shaper is ei @ 48.0 Hz",
+                                     type, freq));
+    CHECK(type == "ei");
+    CHECK_FALSE(parse_recommended_shaper("Recommended shaper is mzv", type, freq));
+
+    float noise = 0.0f;
+    REQUIRE(parse_axes_noise("axes_noise = 0.012345", noise));
+    CHECK(noise == Approx(0.012345f));
+    REQUIRE(parse_axes_noise("Measured axes_noise=42.5", noise));
+    CHECK(noise == Approx(42.5f));
+    CHECK_FALSE(parse_axes_noise("axes_noise: 1.0", noise));
+
+    std::string path;
+    REQUIRE(parse_raw_data_path(
+        "Writing raw accelerometer data to /tmp/raw_data_x_helix.csv file", path));
+    CHECK(path == "/tmp/raw_data_x_helix.csv");
+    CHECK_FALSE(parse_raw_data_path("Writing raw accelerometer data to /tmp/x.csv", path));
+}
+
+TEST_CASE("GCodeResponseDispatcher: probe progress parser", "[gcode_response][parsers]") {
+    int current = 0;
+    int total = 0;
+
+    REQUIRE(parse_probe_progress("// Probing point 5/25", current, total));
+    CHECK(current == 5);
+    CHECK(total == 25);
+
+    REQUIRE(parse_probe_progress("Probe point 7 of 49", current, total));
+    CHECK(current == 7);
+    CHECK(total == 49);
+
+    REQUIRE(parse_probe_progress("Probing point 3 / 9", current, total));
+    CHECK(current == 3);
+    CHECK(total == 9);
+
+    CHECK_FALSE(parse_probe_progress("Probing point 5", current, total));
+    CHECK_FALSE(parse_probe_progress("Probing point 5 ofx 25", current, total));
+    CHECK_FALSE(parse_probe_progress("Probing point -5/25", current, total));
+}
+
+// ============================================================================
+// Routing
+// ============================================================================
+
+TEST_CASE("GCodeResponseDispatcher: routes lines by kind", "[gcode_response][dispatcher]") {
+    GCodeResponseDispatcher dispatcher;
+    std::vector<std::string> shaper_lines;
+    std::vector<std::string> all_lines;
+
+    auto shaper_id = dispatcher.subscribe(
+        gcode_line::FITTED_SHAPER | gcode_line::RECOMMENDED_SHAPER,
+        [&](const GCodeResponseLine& line) { shaper_lines.emplace_back(line.text); });
+    dispatcher.subscribe(gcode_line::ANY,
+                         [&](const GCodeResponseLine& line) { all_lines.emplace_back(line.text); });
+    REQUIRE(dispatcher.subscriber_count() == 2);
+
+    dispatcher.dispatch("ok");
+    dispatcher.dispatch("Recommended shaper is mzv @ 36.7 Hz");
+    dispatcher.dispatch("B:60.0 /60.0");
+
+    REQUIRE(shaper_lines.size() == 1);
+    CHECK(shaper_lines[0] == "Recommended shaper is mzv @ 36.7 Hz");
+    CHECK(all_lines.size() == 3);
+
+    CHECK(dispatcher.unsubscribe(shaper_id));
+    CHECK_FALSE(dispatcher.unsubscribe(shaper_id));
+    dispatcher.dispatch("Recommended shaper is ei @ 48.0 Hz");
+    CHECK(shaper_lines.size() == 1);
+    CHECK(all_lines.size() == 4);
+}
+
+TEST_CASE("GCodeResponseDispatcher: handlers may unsubscribe themselves",
+          "[gcode_response][dispatcher]") {
+    GCodeResponseDispatcher dispatcher;
+    int calls = 0;
+    GCodeResponseDispatcher::SubscriptionId id = 0;
+    id = dispatcher.subscribe(gcode_line::MESH_COMPLETE, [&](const GCodeResponseLine&) {
+        ++calls;
+        dispatcher.unsubscribe(id);
+    });
+
+    int other_calls = 0;
+    dispatcher.subscribe(gcode_line::MESH_COMPLETE,
+                         [&](const GCodeResponseLine&) { ++other_calls; });
+
+    dispatcher.dispatch("Mesh Bed Leveling Complete");
+    dispatcher.dispatch("Mesh Bed Leveling Complete");
+    CHECK(calls == 1);
+    CHECK(other_calls == 2);
+    CHECK(dispatcher.subscriber_count() == 1);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+namespace {
+
+/// Console output of PROBE_ACCURACY followed by SHAPER_CALIBRATE
+std::vector<std::string> calibration_console_log() {
+    std::vector<std::string> lines;
+    for (int i = 0; i < 200; ++i) {
+        lines.push_back("// probe at 150.000,150.000 is z=2.0" + std::to_string(10000 + i));
+        lines.push_back("ok");
+    }
+    lines.push_back("// probe accuracy results: maximum 2.015000, minimum 2.010000, range "
+                    "0.005000, average 2.012500, median 2.012500, standard deviation 0.001500");
+    lines.push_back("B:60.0 /60.0 T0:210.0 /210.0");
+    lines.push_back("Writing raw accelerometer data to /tmp/raw_data_x_helix.csv file");
+    lines.push_back("Fitted shaper 'zv' frequency = 59.0 Hz (vibrations = 5.3%, smoothing ~= "
+                    "0.057)");
+    lines.push_back("Fitted shaper 'mzv' frequency = 36.7 Hz (vibrations = 7.2%, smoothing ~= "
+                    "0.140)");
+    lines.push_back("Fitted shaper 'ei' frequency = 48.0 Hz (vibrations = 0.0%, smoothing ~= "
+                    "0.119)");
+    lines.push_back("Recommended shaper is mzv @ 36.7 Hz");
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("GCodeResponseDispatcher: benchmark vs per-collector regex",
+          "[.benchmark][gcode_response]") {
+    const auto log = calibration_console_log();
+    constexpr int REPEATS = 200;
+
+    // Baseline: three collectors active, each running its own checks per line
+    const std::regex fitted(
+        R"(Fitted shaper '(\w+)' frequency = ([\d.]+) Hz \(vibrations = ([\d.]+)%, smoothing ~= ([\d.]+)\))");
+    const std::regex recommended(R"(Recommended shaper is (\w+) @ ([\d.]+) Hz)");
+    const std::regex noise(R"(axes_noise\s*=\s*([\d.]+))");
+    const std::regex probe(R"(Prob(?:ing point|e point) (\d+)[/\s]+(?:of\s+)?(\d+))");
+
+    size_t baseline_hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        for (const auto& line : log) {
+            std::smatch match;
+            if (std::regex_search(line, match, fitted) ||
+                std::regex_search(line, match, recommended)) {
+                ++baseline_hits;
+            }
+            if (std::regex_search(line, match, noise)) {
+                ++baseline_hits;
+            }
+            if (std::regex_search(line, match, probe)) {
+                ++baseline_hits;
+            }
+        }
+    }
+    auto baseline = std::chrono::steady_clock::now() - start;
+
+    GCodeResponseDispatcher dispatcher;
+    size_t dispatched_hits = 0;
+    dispatcher.subscribe(gcode_line::FITTED_SHAPER | gcode_line::RECOMMENDED_SHAPER,
+                         [&](const GCodeResponseLine& line) {
+                             FittedShaperLine fit;
+                             std::string type;
+                             float freq = 0.0f;
+                             if (parse_fitted_shaper(line.text, fit) ||
+                                 parse_recommended_shaper(line.text, type, freq)) {
+                                 ++dispatched_hits;
+                             }
+                         });
+    dispatcher.subscribe(gcode_line::AXES_NOISE, [&](const GCodeResponseLine& line) {
+        float value = 0.0f;
+        dispatched_hits += parse_axes_noise(line.text, value) ? 1 : 0;
+    });
+    dispatcher.subscribe(gcode_line::PROBE_PROGRESS, [&](const GCodeResponseLine& line) {
+        int current = 0;
+        int total = 0;
+        dispatched_hits += parse_probe_progress(line.text, current, total) ? 1 : 0;
+    });
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        for (const auto& line : log) {
+            dispatcher.dispatch(line);
+        }
+    }
+    auto dispatched = std::chrono::steady_clock::now() - start;
+
+    CHECK(dispatched_hits == baseline_hits);
+
+    auto to_us = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    };
+    double lines = static_cast<double>(log.size()) * REPEATS;
+    WARN("regex per collector: " << to_us(baseline) << " us ("
+                                 << to_us(baseline) * 1000.0 / lines << " ns/line)");
+    WARN("dispatcher:          " << to_us(dispatched) << " us ("
+                                 << to_us(dispatched) * 1000.0 / lines << " ns/line)");
+}
@@ -0,0 +1,137 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_gcode_time_model.cpp
+ * @brief Unit tests for PrintTimeEstimator and PrintTimeTable
+ */
+
+#include "../../include/gcode_time_model.h"
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+MachineLimits test_limits() {
+    MachineLimits limits;
+    limits.max_velocity = 300.0;
+    limits.max_accel = 1000.0;
+    limits.square_corner_velocity = 5.0;
+    limits.max_z_velocity = 10.0;
+    limits.max_z_accel = 100.0;
+    return limits;
+}
+
+} // namespace
+
+TEST_CASE("PrintTimeEstimator plans trapezoidal moves", "[gcode][time_model]") {
+    PrintTimeEstimator timer(test_limits(), 10000);
+
+    SECTION("Single move accelerates, cruises and stops") {
+        // 100 mm/s at 1000 mm/s^2: 5mm ramps of 0.1s each, 90mm cruise
+        timer.add_move(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0, 0);
+        timer.finish();
+        CHECK(timer.table().total_s() == Approx(1.1f));
+    }
+
+    SECTION("Collinear moves do not slow down at the junction") {
+        timer.add_move(50.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0, 0);
+        timer.add_move(50.0f, 0.0f, 0.0f, 0.0f, 100.0f, 20, 0);
+        timer.finish();
+        CHECK(timer.table().total_s() == Approx(1.1f));
+    }
+
+    SECTION("Square corners slow to square_corner_velocity") {
+        timer.add_move(50.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0, 0);
+        timer.add_move(0.0f, 50.0f, 0.0f, 0.0f, 100.0f, 20, 0);
+        timer.finish();
+        // Each leg: 0.1s up to speed, 0.095s down to 5 mm/s (or up from it), 40.0125mm cruise
+        CHECK(timer.table().total_s() == Approx(2.0f * (0.1f + 0.095f + 0.400125f)));
+    }
+
+    SECTION("Reversals stop the toolhead") {
+        timer.add_move(50.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0, 0);
+        timer.add_move(-50.0f, 0.0f, 0.0f, 0.0f, 100.0f, 20, 0);
+        timer.finish();
+        CHECK(timer.table().total_s() == Approx(1.2f));
+    }
+
+    SECTION("Feedrate is capped by max_velocity") {
+        timer.set_max_velocity(50.0f);
+        timer.add_move(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0, 0);
+        timer.finish();
+        // 1.25mm ramps of 0.05s each, 97.5mm cruise at 50 mm/s
+        CHECK(timer.table().total_s() == Approx(0.1f + 1.95f));
+    }
+
+    SECTION("Z moves use the Z limits") {
+        timer.add_move(0.0f, 0.0f, 10.0f, 0.0f, 100.0f, 0, 0);
+        timer.finish();
+        // 10 mm/s at 100 mm/s^2: 0.5mm ramps of 0.1s each, 9mm cruise
+        CHECK(timer.table().total_s() == Approx(1.1f));
+    }
+}
+
+TEST_CASE("PrintTimeEstimator plans across lookahead batches", "[gcode][time_model]") {
+    PrintTimeEstimator timer(test_limits(), 100000);
+
+    // 2000 collinear 1mm moves plan like one 2000mm move
+    for (int i = 0; i < 2000; ++i) {
+        timer.add_move(1.0f, 0.0f, 0.0f, 0.0f, 100.0f, static_cast<uint64_t>(i) * 20, 0);
+    }
+    timer.finish();
+    CHECK(timer.table().total_s() == Approx(20.1f).epsilon(1e-4));
+}
+
+TEST_CASE("PrintTimeEstimator attributes time to layers and file positions",
+          "[gcode][time_model]") {
+    // Small files get the minimum sample spacing of 1KB; lines start on samples
+    PrintTimeEstimator timer(test_limits(), 4096);
+
+    timer.add_move(0.0f, 0.0f, 0.0f, 1.0f, 10.0f, 0, PrintTimeEstimator::NO_LAYER);
+    timer.add_move(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 1024, 0);
+    timer.add_dwell(2.0f, 2048, 0);
+    timer.add_move(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 3072, 1);
+    timer.finish();
+
+    // Extrude-only priming move: 1mm at 10 mm/s with 0.01s ramps
+    float prime = 0.11f;
+    const PrintTimeTable& table = timer.table();
+    CHECK(table.total_s() == Approx(prime + 1.1f + 2.0f + 1.1f));
+
+    const auto& layers = timer.layer_durations();
+    REQUIRE(layers.size() == 2);
+    CHECK(layers[0] == Approx(3.1f));
+    CHECK(layers[1] == Approx(1.1f));
+
+    SECTION("Elapsed time at file positions") {
+        CHECK(table.elapsed_at(0) == 0.0f);
+        REQUIRE(table.bucket_bytes == 1024);
+        CHECK(table.elapsed_at(1024) == Approx(prime));
+        CHECK(table.elapsed_at(3072) == Approx(prime + 3.1f));
+        CHECK(table.remaining_at(3072) == Approx(1.1f));
+        CHECK(table.remaining_at(1000000) == 0.0f);
+    }
+
+    SECTION("Positions between samples interpolate") {
+        float a = table.elapsed_at(table.bucket_bytes);
+        float b = table.elapsed_at(2 * table.bucket_bytes);
+        CHECK(table.elapsed_at(table.bucket_bytes + table.bucket_bytes / 2) ==
+              Approx((a + b) / 2.0f));
+    }
+}
+
+TEST_CASE("PrintTimeTable stays small for large files", "[gcode][time_model]") {
+    uint64_t file_size = 500ull * 1024 * 1024;
+    PrintTimeEstimator timer(MachineLimits{}, file_size);
+    timer.add_move(10.0f, 0.0f, 0.0f, 0.0f, 100.0f, file_size - 100, 0);
+    timer.finish();
+
+    const PrintTimeTable& table = timer.table();
+    CHECK(table.elapsed_s.size() <= PrintTimeEstimator::MAX_TABLE_SAMPLES + 1);
+    CHECK(table.elapsed_at(file_size / 2) == 0.0f);
+    CHECK(table.total_s() > 0.0f);
+}
@@ -612,6 +612,32 @@ TEST_CASE("InputShaperCalibrator is movable", "[calibrator][input_shaper][move]"
     CHECK(calibrator3.get_state() == InputShaperCalibrator::State::IDLE);
 }
 
+// ============================================================================
+// Local Analysis Tests
+// ============================================================================
+
+TEST_CASE("InputShaperCalibrator local analysis defaults off without API",
+          "[calibrator][input_shaper][local]") {
+    InputShaperCalibrator calibrator;
+    CHECK_FALSE(calibrator.local_analysis());
+
+    calibrator.set_local_analysis(true);
+    CHECK(calibrator.local_analysis());
+
+    InputShaperCalibrator moved = std::move(calibrator);
+    CHECK(moved.local_analysis());
+}
+
+TEST_CASE("InputShaperCalibrator refit requires a stored spectrum",
+          "[calibrator][input_shaper][local]") {
+    InputShaperCalibrator calibrator;
+    ShaperFitOptions options;
+    options.max_smoothing = 0.1f;
+
+    CHECK_FALSE(calibrator.refit('X', options));
+    CHECK_FALSE(calibrator.refit('Z', options));
+}
+
 // ============================================================================
 // Integration Scenario Tests
 // ============================================================================
@@ -9,6 +9,7 @@
  * - PrinterHardware guessing (guess_bed_heater, guess_hotend_heater, guess_bed_sensor,
  *   guess_hotend_sensor, guess_part_cooling_fan, guess_main_led_strip)
  * - Bed mesh operations (get_active_bed_mesh, get_bed_mesh_profiles, has_bed_mesh)
+ * - Bed mesh parse cache (update_bed_mesh skips unchanged meshes)
  * - Object exclusion (get_excluded_objects, get_available_objects)
  */
 
@@ -290,6 +291,102 @@ TEST_CASE_METHOD(MoonrakerAPIDomainTestFixture,
     // This test verifies the API method signature is correct
 }
 
+// ============================================================================
+// Bed Mesh Parse Cache Tests
+// ============================================================================
+
+namespace {
+
+json make_bed_mesh_status(float offset) {
+    json points = json::array();
+    for (int y = 0; y < 3; ++y) {
+        json row = json::array();
+        for (int x = 0; x < 3; ++x) {
+            row.push_back(0.01 * (x + y) + offset);
+        }
+        points.push_back(row);
+    }
+    json params = {{"min_x", 10.0}, {"min_y", 20.0}, {"max_x", 210.0},
+                   {"max_y", 220.0}, {"x_count", 3},  {"y_count", 3}};
+    return {{"profile_name", "default"},
+            {"probed_matrix", points},
+            {"mesh_min", {10.0, 20.0}},
+            {"mesh_max", {210.0, 220.0}},
+            {"profiles",
+             {{"default", {{"points", points}, {"mesh_params", params}}},
+              {"hot", {{"points", points}, {"mesh_params", params}}}}}};
+}
+
+} // namespace
+
+TEST_CASE_METHOD(MoonrakerAPIDomainTestFixture,
+                 "MoonrakerAPI::update_bed_mesh parses each distinct mesh once",
+                 "[api][bedmesh]") {
+    json status = make_bed_mesh_status(0.0f);
+    size_t base = api->bed_mesh_parse_count();
+
+    api->update_bed_mesh(status);
+    // Active mesh plus two stored profiles
+    REQUIRE(api->bed_mesh_parse_count() == base + 3);
+
+    const BedMeshProfile* active = api->get_active_bed_mesh();
+    const BedMeshProfile* hot = api->get_bed_mesh_profile("hot");
+    REQUIRE(active != nullptr);
+    REQUIRE(hot != nullptr);
+    CHECK(active->stats.valid);
+    CHECK(active->stats.min_z == Catch::Approx(0.0f));
+    CHECK(active->stats.max_z == Catch::Approx(0.04f));
+    CHECK(active->stats.range == Catch::Approx(0.04f));
+    CHECK(active->stats.max_x == Catch::Approx(210.0f));
+    CHECK(active->stats.max_y == Catch::Approx(220.0f));
+    CHECK(hot->stats.range == Catch::Approx(0.04f));
+
+    SECTION("Repeated status is not re-parsed") {
+        api->update_bed_mesh(status);
+        api->update_bed_mesh(json::parse(status.dump()));
+        CHECK(api->bed_mesh_parse_count() == base + 3);
+        // Unchanged profiles stay where they were
+        CHECK(api->get_bed_mesh_profile("hot") == hot);
+    }
+
+    SECTION("Integer-valued JSON hashes like its float form") {
+        json ints = status;
+        ints["profiles"]["hot"]["mesh_params"]["min_x"] = 10;
+        api->update_bed_mesh(ints);
+        CHECK(api->bed_mesh_parse_count() == base + 3);
+    }
+
+    SECTION("Only the changed profile is re-parsed") {
+        json changed = status;
+        changed["profiles"]["hot"] = make_bed_mesh_status(0.5f)["profiles"]["hot"];
+        api->update_bed_mesh(changed);
+        CHECK(api->bed_mesh_parse_count() == base + 4);
+
+        const BedMeshProfile* updated = api->get_bed_mesh_profile("hot");
+        REQUIRE(updated != nullptr);
+        CHECK(updated->stats.min_z == Catch::Approx(0.5f));
+        CHECK(api->get_active_bed_mesh()->stats.min_z == Catch::Approx(0.0f));
+    }
+
+    SECTION("Deleted profiles are dropped") {
+        json removed = status;
+        removed["profiles"].erase("hot");
+        api->update_bed_mesh(removed);
+        CHECK(api->bed_mesh_parse_count() == base + 3);
+        CHECK(api->get_bed_mesh_profile("hot") == nullptr);
+        CHECK(api->get_bed_mesh_profiles() == std::vector<std::string>{"default"});
+    }
+
+    SECTION("New active matrix recomputes stats") {
+        json remeshed = status;
+        remeshed["probed_matrix"][1][1] = -0.2;
+        api->update_bed_mesh(remeshed);
+        CHECK(api->bed_mesh_parse_count() == base + 4);
+        CHECK(api->get_active_bed_mesh()->stats.min_z == Catch::Approx(-0.2f));
+        CHECK(api->get_active_bed_mesh()->stats.min_x == Catch::Approx(110.0f));
+    }
+}
+
 // ============================================================================
 // Domain Service Interface Compliance Tests
 // ============================================================================
@@ -0,0 +1,377 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "../../include/moonraker_client.h"
+#include "../../include/moonraker_traffic_recorder.h"
+#include "../mocks/moonraker_replay_server.h"
+#include "../ui_test_utils.h"
+#include "hv/EventLoopThread.h"
+#include "memory_utils.h"
+#include "printer_state.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_moonraker_traffic_replay.cpp
+ * @brief Traffic recording format, replay server, and the replay benchmark
+ *
+ * The benchmark replays a busy print (synthetic by default, or a real capture
+ * from HELIX_REPLAY_FILE, recorded with HELIX_RECORD_TRAFFIC) through a real
+ * MoonrakerClient and applies each status update to PrinterState the way
+ * MoonrakerManager does: queued from the websocket thread, drained on the UI
+ * thread, then lv_timer_handler(). Run with `make test-replay-benchmark`.
+ */
+
+using namespace std::chrono;
+using helix::TrafficFrame;
+
+namespace {
+
+std::string temp_path(const char* name) {
+    return "/tmp/" + std::string(name) + "_" + std::to_string(rand()) + ".hxtr";
+}
+
+TrafficFrame make_frame(uint64_t timestamp_us, TrafficFrame::Direction direction,
+                        const json& payload) {
+    return TrafficFrame{timestamp_us, direction, payload.dump()};
+}
+
+/// A busy print: printer.info handshake, then status updates every 4 ms
+std::vector<TrafficFrame> synthetic_session(int status_frames) {
+    std::vector<TrafficFrame> frames;
+    frames.push_back(make_frame(0, TrafficFrame::Direction::SENT,
+                                {{"jsonrpc", "2.0"}, {"method", "printer.info"}, {"id", 1}}));
+    frames.push_back(make_frame(
+        1500, TrafficFrame::Direction::RECEIVED,
+        {{"jsonrpc", "2.0"}, {"result", {{"state", "ready"}, {"hostname", "replay"}}}, {"id", 1}}));
+
+    for (int i = 0; i < status_frames; ++i) {
+        double t = i * 0.004;
+        json status = {
+            {"extruder", {{"temperature", 214.0 + (i % 20) * 0.1}, {"power", 0.4}}},
+            {"heater_bed", {{"temperature", 60.0 + (i % 7) * 0.01}, {"power", 0.3}}},
+            {"toolhead", {{"position", {100.0 + (i % 50), 80.0 + (i % 30), 3.2, 1500.0 + i}}}},
+            {"gcode_move", {{"gcode_position", {100.0 + (i % 50), 80.0, 3.2, 1500.0 + i}}}},
+            {"virtual_sdcard", {{"progress", i / static_cast<double>(status_frames)}}},
+            {"print_stats", {{"print_duration", 1800.0 + t}}},
+        };
+        if (i % 25 == 0) {
+            status["fan"] = {{"speed", 0.5 + (i % 3) * 0.1}};
+        }
+        frames.push_back(make_frame(2000 + static_cast<uint64_t>(i) * 4000,
+                                    TrafficFrame::Direction::RECEIVED,
+                                    {{"jsonrpc", "2.0"},
+                                     {"method", "notify_status_update"},
+                                     {"params", {status, 5000.0 + t}}}));
+
+        if (i % 100 == 50) {
+            frames.push_back(make_frame(2000 + static_cast<uint64_t>(i) * 4000 + 10,
+                                        TrafficFrame::Direction::RECEIVED,
+                                        {{"jsonrpc", "2.0"},
+                                         {"method", "notify_gcode_response"},
+                                         {"params", {"// Layer change"}}}));
+        }
+    }
+    return frames;
+}
+
+/// Client on its own event loop, connected to a replay server
+class ReplayFixture {
+  public:
+    ReplayFixture() {
+        loop_thread_ = std::make_shared<hv::EventLoopThread>();
+        loop_thread_->start();
+        client_ = std::make_unique<MoonrakerClient>(loop_thread_->loop());
+        client_->set_connection_timeout(2000);
+        client_->set_default_request_timeout(2000);
+        client_->setReconnect(nullptr);
+    }
+
+    ~ReplayFixture() {
+        replay_.stop_playback();
+        loop_thread_->stop();
+        loop_thread_->join();
+        client_.reset();
+        replay_.stop();
+    }
+
+    bool connect() {
+        if (replay_.start() <= 0) {
+            return false;
+        }
+        std::atomic<bool> connected{false};
+        client_->connect(
+            replay_.url().c_str(), [&connected]() { connected = true; }, []() {});
+        for (int i = 0; i < 50 && !connected; i++) {
+            std::this_thread::sleep_for(milliseconds(100));
+        }
+        return connected;
+    }
+
+    MoonrakerReplayServer replay_;
+    std::shared_ptr<hv::EventLoopThread> loop_thread_;
+    std::unique_ptr<MoonrakerClient> client_;
+};
+
+size_t heap_in_use() {
+#ifdef __GLIBC__
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// Recording format
+// ============================================================================
+
+TEST_CASE("TrafficRecorder: recordings round-trip", "[moonraker][replay]") {
+    std::string path = temp_path("traffic_roundtrip");
+
+    helix::TrafficRecorder recorder;
+    REQUIRE(recorder.open(path));
+    recorder.record(TrafficFrame::Direction::SENT, R"({"method":"printer.info","id":1})");
+    recorder.record(TrafficFrame::Direction::RECEIVED, R"({"result":{},"id":1})");
+    recorder.record(TrafficFrame::Direction::RECEIVED, std::string(70000, 'x')); // Long varint
+    recorder.record(TrafficFrame::Direction::RECEIVED, "");
+    CHECK(recorder.frame_count() == 4);
+    recorder.close();
+    recorder.record(TrafficFrame::Direction::RECEIVED, "after close"); // Ignored
+
+    std::vector<TrafficFrame> frames;
+    REQUIRE(helix::load_traffic_recording(path, frames));
+    REQUIRE(frames.size() == 4);
+    CHECK(frames[0].direction == TrafficFrame::Direction::SENT);
+    CHECK(frames[0].payload == R"({"method":"printer.info","id":1})");
+    CHECK(frames[1].direction == TrafficFrame::Direction::RECEIVED);
+    CHECK(frames[2].payload.size() == 70000);
+    CHECK(frames[3].payload.empty());
+    for (size_t i = 1; i < frames.size(); ++i) {
+        CHECK(frames[i].timestamp_us >= frames[i - 1].timestamp_us);
+    }
+
+    SECTION("Truncated file keeps the complete frames") {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream(path, std::ios::binary | std::ios::trunc)
+            .write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 5000));
+
+        CHECK_FALSE(helix::load_traffic_recording(path, frames));
+        CHECK(frames.size() == 2);
+    }
+
+    SECTION("Other files are rejected") {
+        std::ofstream(path, std::ios::trunc) << "G1 X10 Y10\n";
+        CHECK_FALSE(helix::load_traffic_recording(path, frames));
+        CHECK_FALSE(helix::load_traffic_recording("/nonexistent/session.hxtr", frames));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("MoonrakerReplayServer: splits responses from notifications", "[moonraker][replay]") {
+    MoonrakerReplayServer replay;
+    replay.load_frames(synthetic_session(200));
+
+    CHECK(replay.response_method_count() == 1);
+    REQUIRE(replay.notifications().size() == 202); // 200 status + 2 gcode responses
+    CHECK(replay.notifications().front().offset_us == 0);
+    CHECK(replay.notifications().front().method == "notify_status_update");
+    CHECK(replay.notifications().back().offset_us == 199 * 4000);
+}
+
+// ============================================================================
+// Replay through MoonrakerClient
+// ============================================================================
+
+TEST_CASE_METHOD(ReplayFixture, "MoonrakerReplayServer: replays a session to the client",
+                 "[moonraker][replay][eventloop][slow]") {
+    replay_.load_frames(synthetic_session(300));
+    REQUIRE(connect());
+
+    std::atomic<int> status_updates{0};
+    std::atomic<int> gcode_responses{0};
+    client_->register_status_update(
+        [&](const std::shared_ptr<const helix::StatusDelta>&) { status_updates++; });
+    client_->register_method_callback("notify_gcode_response", "replay_test",
+                                      [&](json) { gcode_responses++; });
+
+    // Requests get the recorded answer
+    std::atomic<bool> answered{false};
+    std::string hostname;
+    client_->send_jsonrpc("printer.info", json::object(), [&](json response) {
+        hostname = response["result"].value("hostname", "");
+        answered = true;
+    });
+    for (int i = 0; i < 50 && !answered; i++) {
+        std::this_thread::sleep_for(milliseconds(20));
+    }
+    REQUIRE(answered);
+    CHECK(hostname == "replay");
+
+    // 1.2 s of recorded traffic at 20x
+    replay_.play(20.0);
+    REQUIRE(replay_.wait_until_done(seconds(10)));
+    CHECK(replay_.frames_played() == replay_.notifications().size());
+
+    for (int i = 0; i < 50 && status_updates < 300; i++) {
+        std::this_thread::sleep_for(milliseconds(20));
+    }
+    CHECK(status_updates == 300);
+    CHECK(gcode_responses == 3);
+}
+
+TEST_CASE_METHOD(ReplayFixture, "MoonrakerClient: recorded traffic replays identically",
+                 "[moonraker][replay][eventloop][slow]") {
+    replay_.load_frames(synthetic_session(50));
+    REQUIRE(connect());
+
+    std::string path = temp_path("traffic_capture");
+    REQUIRE(client_->start_traffic_recording(path));
+
+    std::atomic<bool> answered{false};
+    client_->send_jsonrpc("printer.info", json::object(), [&](json) { answered = true; });
+    replay_.play(0.0);
+    REQUIRE(replay_.wait_until_done(seconds(10)));
+    for (int i = 0; i < 50 && !answered; i++) {
+        std::this_thread::sleep_for(milliseconds(20));
+    }
+    std::this_thread::sleep_for(milliseconds(200)); // Let the client drain its socket
+    client_->stop_traffic_recording();
+
+    // The capture holds the request, its response and every notification verbatim
+    MoonrakerReplayServer captured;
+    REQUIRE(captured.load(path));
+    CHECK(captured.response_method_count() == 1);
+    REQUIRE(captured.notifications().size() == replay_.notifications().size());
+    CHECK(captured.notifications().back().frame == replay_.notifications().back().frame);
+
+    std::remove(path.c_str());
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+TEST_CASE_METHOD(ReplayFixture, "MoonrakerReplay: benchmark status path under load",
+                 "[.benchmark][moonraker][replay]") {
+    lv_init_safe();
+    PrinterState& state = get_printer_state();
+    state.init_subjects();
+
+    const char* replay_file = std::getenv("HELIX_REPLAY_FILE");
+    if (replay_file) {
+        REQUIRE(replay_.load(replay_file));
+    } else {
+        replay_.load_frames(synthetic_session(5000)); // 20 s of printing
+    }
+    REQUIRE(connect());
+
+    // Same hand-off as MoonrakerManager: websocket thread queues, UI thread applies
+    struct Received {
+        std::shared_ptr<const helix::StatusDelta> delta;
+        steady_clock::time_point at;
+    };
+    std::mutex queue_mutex;
+    std::vector<Received> queue;
+    client_->register_status_update([&](const std::shared_ptr<const helix::StatusDelta>& delta) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back({delta, steady_clock::now()});
+    });
+
+    size_t status_frames = std::count_if(
+        replay_.notifications().begin(), replay_.notifications().end(),
+        [](const auto& n) { return n.method == "notify_status_update"; });
+
+    int64_t rss_before_kb = 0;
+    int64_t hwm_kb = 0;
+    helix::read_memory_stats(rss_before_kb, hwm_kb);
+    size_t heap_before = heap_in_use();
+
+    // Speed defaults to 10x; HELIX_REPLAY_SPEED=0 floods as fast as possible
+    const char* speed_env = std::getenv("HELIX_REPLAY_SPEED");
+    double speed = speed_env ? std::atof(speed_env) : 10.0;
+
+    std::vector<double> receive_latency_us; // server send -> client callback
+    std::vector<double> frame_ms;           // one UI loop iteration (drain + timers)
+    std::vector<steady_clock::time_point> receive_times;
+    size_t applied = 0;
+
+    replay_.play(speed);
+    auto deadline = steady_clock::now() + seconds(120);
+    while (applied < status_frames && steady_clock::now() < deadline) {
+        std::vector<Received> batch;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            batch.swap(queue);
+        }
+
+        auto frame_start = steady_clock::now();
+        for (const auto& received : batch) {
+            state.update_from_delta(*received.delta);
+            receive_times.push_back(received.at);
+        }
+        lv_timer_handler();
+        auto frame_end = steady_clock::now();
+
+        if (!batch.empty()) {
+            frame_ms.push_back(duration<double, std::milli>(frame_end - frame_start).count());
+            applied += batch.size();
+        }
+        std::this_thread::sleep_for(milliseconds(5)); // ~200 Hz UI loop
+    }
+    REQUIRE(replay_.wait_until_done(seconds(10)));
+    CHECK(applied == status_frames);
+
+    // Pair status frames with their send times (notifications are sent in order)
+    auto sent = replay_.send_times();
+    size_t status_index = 0;
+    for (size_t i = 0; i < sent.size() && status_index < receive_times.size(); ++i) {
+        if (replay_.notifications()[i].method != "notify_status_update") {
+            continue;
+        }
+        receive_latency_us.push_back(
+            duration<double, std::micro>(receive_times[status_index++] - sent[i]).count());
+    }
+
+    int64_t rss_after_kb = 0;
+    helix::read_memory_stats(rss_after_kb, hwm_kb);
+    long long heap_delta = static_cast<long long>(heap_in_use()) -
+                           static_cast<long long>(heap_before);
+
+    auto percentile = [](std::vector<double> values, double p) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[static_cast<size_t>(p * static_cast<double>(values.size() - 1))];
+    };
+
+    WARN("Replayed " << status_frames << " status frames of " << replay_.notifications().size()
+                     << " notifications at " << speed << "x");
+    WARN("Dispatch latency (us): p50=" << percentile(receive_latency_us, 0.5)
+                                       << " p99=" << percentile(receive_latency_us, 0.99)
+                                       << " max=" << percentile(receive_latency_us, 1.0));
+    WARN("UI frame (ms): p50=" << percentile(frame_ms, 0.5) << " p99="
+                               << percentile(frame_ms, 0.99) << " max="
+                               << percentile(frame_ms, 1.0) << " over " << frame_ms.size()
+                               << " frames");
+    WARN("RSS: " << rss_before_kb << " -> " << rss_after_kb << " kB (peak " << hwm_kb
+                 << " kB), heap in use delta: " << heap_delta / 1024 << " kB");
+}
@@ -318,3 +318,34 @@ TEST_CASE_METHOD(NavbarIconTestFixture, "Overlay registration accepts IPanelLife
     // Cleanup
     lv_obj_delete(test_overlay);
 }
+
+TEST_CASE_METHOD(NavbarIconTestFixture, "Cold evictable overlays are evicted once",
+                 "[navigation][overlay]") {
+    auto& nav = NavigationManager::instance();
+    lv_obj_t* test_overlay = lv_obj_create(test_screen());
+    REQUIRE(test_overlay != nullptr);
+
+    int evict_count = 0;
+    nav.register_evictable_overlay(test_overlay, [&evict_count]() { evict_count++; });
+
+    SECTION("Recently registered overlay is not cold yet") {
+        CHECK(nav.evict_cold_overlays(60000) == 0);
+        CHECK(evict_count == 0);
+        nav.unregister_overlay_instance(test_overlay);
+    }
+
+    SECTION("Idle overlay is evicted and forgotten") {
+        CHECK(nav.evict_cold_overlays(0) == 1);
+        CHECK(evict_count == 1);
+        CHECK(nav.evict_cold_overlays(0) == 0);
+        CHECK(evict_count == 1);
+    }
+
+    SECTION("Unregistering the overlay drops its evict callback") {
+        nav.unregister_overlay_instance(test_overlay);
+        CHECK(nav.evict_cold_overlays(0) == 0);
+        CHECK(evict_count == 0);
+    }
+
+    lv_obj_delete(test_overlay);
+}
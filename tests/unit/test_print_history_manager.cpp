@@ -20,8 +20,11 @@
 #include "../../lvgl/lvgl.h"
 #include "../ui_test_utils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <thread>
 #include <vector>
 
@@ -335,6 +338,144 @@ TEST_CASE_METHOD(HistoryManagerTestFixture, "PrintHistoryManager can re-fetch af
     REQUIRE_FALSE(manager_->get_jobs().empty());
 }
 
+// ============================================================================
+// Incremental Sync / Persistence Tests
+// ============================================================================
+
+TEST_CASE_METHOD(HistoryManagerTestFixture, "PrintHistoryManager re-fetch merges by job_id",
+                 "[history_manager][sync]") {
+    REQUIRE(manager_->sync_since() == 0.0); // Empty cache: full fetch
+
+    manager_->fetch();
+    REQUIRE(wait_for_loaded());
+    size_t job_count = manager_->get_jobs().size();
+    REQUIRE(job_count > 0);
+    REQUIRE(manager_->get_rollups().totals().job_count == job_count);
+
+    // Next fetch only asks for jobs from the newest cached one onwards
+    double newest = 0.0;
+    for (const auto& job : manager_->get_jobs()) {
+        newest = std::max(newest, job.start_time);
+    }
+    REQUIRE(manager_->sync_since() > 0.0);
+    REQUIRE(manager_->sync_since() <= newest);
+
+    manager_->invalidate();
+    manager_->fetch();
+    REQUIRE(wait_for_loaded());
+
+    // Overlapping jobs replace their cached copies instead of duplicating
+    REQUIRE(manager_->get_jobs().size() == job_count);
+    REQUIRE(manager_->get_rollups().totals().job_count == job_count);
+}
+
+TEST_CASE_METHOD(HistoryManagerTestFixture, "PrintHistoryManager remove_job updates all views",
+                 "[history_manager][sync]") {
+    manager_->fetch();
+    REQUIRE(wait_for_loaded());
+    size_t job_count = manager_->get_jobs().size();
+    REQUIRE(job_count > 0);
+
+    int callback_count = 0;
+    HistoryChangedCallback callback = [&callback_count]() { callback_count++; };
+    manager_->add_observer(&callback);
+
+    std::string job_id = manager_->get_jobs().front().job_id;
+    manager_->remove_job(job_id);
+
+    REQUIRE(manager_->get_jobs().size() == job_count - 1);
+    REQUIRE(manager_->get_rollups().totals().job_count == job_count - 1);
+    REQUIRE(callback_count == 1);
+
+    // Unknown job is ignored
+    manager_->remove_job("no_such_job");
+    REQUIRE(callback_count == 1);
+
+    manager_->remove_observer(&callback);
+}
+
+TEST_CASE_METHOD(HistoryManagerTestFixture, "PrintHistoryManager persists the job cache",
+                 "[history_manager][sync]") {
+    std::string path =
+        (std::filesystem::temp_directory_path() / "helix_test_history.json").string();
+    std::filesystem::remove(path);
+
+    REQUIRE_FALSE(manager_->set_cache_file(path, "printer-a"));
+    manager_->fetch();
+    REQUIRE(wait_for_loaded());
+    size_t job_count = manager_->get_jobs().size();
+    REQUIRE(std::filesystem::exists(path));
+
+    SECTION("restored for the same printer") {
+        PrintHistoryManager restored(nullptr, nullptr);
+        REQUIRE(restored.set_cache_file(path, "printer-a"));
+        REQUIRE(restored.is_loaded());
+        REQUIRE(restored.get_jobs().size() == job_count);
+        REQUIRE(restored.get_rollups().totals().job_count == job_count);
+        REQUIRE(restored.get_filename_stats().size() == manager_->get_filename_stats().size());
+        REQUIRE(restored.get_jobs().front().job_id == manager_->get_jobs().front().job_id);
+    }
+
+    SECTION("discarded for another printer") {
+        PrintHistoryManager other(nullptr, nullptr);
+        REQUIRE_FALSE(other.set_cache_file(path, "printer-b"));
+        REQUIRE_FALSE(other.is_loaded());
+        REQUIRE(other.get_jobs().empty());
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE_METHOD(HistoryManagerTestFixture, "PrintHistoryManager full sync drops deleted jobs",
+                 "[history_manager][sync]") {
+    std::string path =
+        (std::filesystem::temp_directory_path() / "helix_test_history_deleted.json").string();
+
+    // A cached job that another client deleted from Moonraker's history
+    auto restore_deleted_job = [&]() {
+        {
+            std::ofstream out(path, std::ios::trunc);
+            out << R"({"version": 1, "source": "printer-a", "jobs": [)"
+                << R"({"job_id": "deleted_elsewhere", "filename": "gone.gcode",)"
+                << R"( "status": 1, "start_time": 1000.0}]})";
+        }
+        REQUIRE(manager_->set_cache_file(path, "printer-a"));
+    };
+    auto has_deleted_job = [&]() {
+        const auto& jobs = manager_->get_jobs();
+        return std::any_of(jobs.begin(), jobs.end(), [](const PrintHistoryJob& j) {
+            return j.job_id == "deleted_elsewhere";
+        });
+    };
+
+    // The first fetch after startup is a full sync, even with a restored cache
+    restore_deleted_job();
+    manager_->fetch();
+    REQUIRE(wait_for_loaded());
+    REQUIRE_FALSE(manager_->get_jobs().empty());
+    REQUIRE_FALSE(has_deleted_job());
+
+    SECTION("incremental fetches keep it") {
+        restore_deleted_job();
+        manager_->invalidate();
+        manager_->fetch();
+        REQUIRE(wait_for_loaded());
+        REQUIRE(has_deleted_job());
+    }
+
+    SECTION("a requested full sync drops it") {
+        restore_deleted_job();
+        manager_->request_full_sync();
+        manager_->invalidate();
+        manager_->fetch();
+        REQUIRE(wait_for_loaded());
+        REQUIRE_FALSE(has_deleted_job());
+        REQUIRE(manager_->get_rollups().totals().job_count == manager_->get_jobs().size());
+    }
+
+    std::filesystem::remove(path);
+}
+
 // ============================================================================
 // Edge Case Tests
 // ============================================================================
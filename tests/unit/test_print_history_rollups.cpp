@@ -0,0 +1,152 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "print_history_rollups.h"
+
+#include <algorithm>
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_print_history_rollups.cpp
+ * @brief Unit tests for time-bucketed print history rollups
+ */
+
+namespace {
+
+// 2025-06-18 12:00:00 UTC: mid-day, mid-week, mid-month in any timezone offset < 12h
+constexpr double BASE_TIME = 1750248000.0;
+constexpr double HOUR = 3600.0;
+constexpr double DAY = 24 * HOUR;
+
+PrintHistoryJob make_job(const std::string& id, double start, PrintJobStatus status,
+                         double filament_mm, const std::string& type = "PLA") {
+    PrintHistoryJob job;
+    job.job_id = id;
+    job.filename = id + ".gcode";
+    job.status = status;
+    job.start_time = start;
+    job.end_time = start + HOUR;
+    job.print_duration = HOUR;
+    job.filament_used = filament_mm;
+    job.filament_type = type;
+    return job;
+}
+
+const FilamentUsageByType* find_type(const HistoryRollupBucket& bucket, const std::string& type) {
+    auto it = std::find_if(bucket.filament_by_type.begin(), bucket.filament_by_type.end(),
+                           [&type](const FilamentUsageByType& u) { return u.type == type; });
+    return it == bucket.filament_by_type.end() ? nullptr : &*it;
+}
+
+} // namespace
+
+TEST_CASE("PrintHistoryRollups: bucket keys are consecutive", "[history][rollups]") {
+    int64_t day = PrintHistoryRollups::bucket_key(HistoryRollupPeriod::DAY, BASE_TIME);
+    CHECK(PrintHistoryRollups::bucket_key(HistoryRollupPeriod::DAY, BASE_TIME + DAY) == day + 1);
+    CHECK(PrintHistoryRollups::bucket_key(HistoryRollupPeriod::DAY, BASE_TIME - DAY) == day - 1);
+
+    int64_t hour = PrintHistoryRollups::bucket_key(HistoryRollupPeriod::HOUR, BASE_TIME);
+    CHECK(PrintHistoryRollups::bucket_key(HistoryRollupPeriod::HOUR, BASE_TIME + HOUR) ==
+          hour + 1);
+
+    int64_t week = PrintHistoryRollups::bucket_key(HistoryRollupPeriod::WEEK, BASE_TIME);
+    CHECK(PrintHistoryRollups::bucket_key(HistoryRollupPeriod::WEEK, BASE_TIME + 7 * DAY) ==
+          week + 1);
+
+    int64_t month = PrintHistoryRollups::bucket_key(HistoryRollupPeriod::MONTH, BASE_TIME);
+    CHECK(PrintHistoryRollups::bucket_key(HistoryRollupPeriod::MONTH, BASE_TIME + 31 * DAY) ==
+          month + 1);
+}
+
+TEST_CASE("PrintHistoryRollups: bucket_start round-trips", "[history][rollups]") {
+    for (auto period : {HistoryRollupPeriod::HOUR, HistoryRollupPeriod::DAY,
+                        HistoryRollupPeriod::WEEK, HistoryRollupPeriod::MONTH}) {
+        int64_t key = PrintHistoryRollups::bucket_key(period, BASE_TIME);
+        double start = PrintHistoryRollups::bucket_start(period, key);
+        CHECK(start <= BASE_TIME);
+        CHECK(PrintHistoryRollups::bucket_key(period, start) == key);
+        CHECK(PrintHistoryRollups::bucket_key(period, start - 1.0) == key - 1);
+    }
+}
+
+TEST_CASE("PrintHistoryRollups: sums jobs into buckets", "[history][rollups]") {
+    PrintHistoryRollups rollups;
+    rollups.add(make_job("a", BASE_TIME, PrintJobStatus::COMPLETED, 1000.0));
+    rollups.add(make_job("b", BASE_TIME + HOUR, PrintJobStatus::CANCELLED, 500.0));
+    rollups.add(make_job("c", BASE_TIME - 3 * DAY, PrintJobStatus::COMPLETED, 2000.0, "PETG"));
+
+    CHECK(rollups.totals().job_count == 3);
+    CHECK(rollups.totals().completed_count == 2);
+    CHECK(rollups.totals().filament_mm == Catch::Approx(3500.0));
+
+    int64_t today = PrintHistoryRollups::bucket_key(HistoryRollupPeriod::DAY, BASE_TIME);
+    HistoryRollupBucket day = rollups.sum(HistoryRollupPeriod::DAY, today, today);
+    CHECK(day.job_count == 2);
+    CHECK(day.completed_count == 1);
+    CHECK(day.print_duration == Catch::Approx(2 * HOUR));
+    REQUIRE(find_type(day, "PLA") != nullptr);
+    CHECK(find_type(day, "PETG") == nullptr);
+
+    HistoryRollupBucket week = rollups.sum(HistoryRollupPeriod::DAY, today - 6, today);
+    CHECK(week.job_count == 3);
+    REQUIRE(find_type(week, "PETG") != nullptr);
+    CHECK(find_type(week, "PETG")->usage_mm == Catch::Approx(2000.0));
+
+    std::vector<uint32_t> counts = rollups.job_counts(HistoryRollupPeriod::DAY, today - 3, 4);
+    CHECK(counts == std::vector<uint32_t>{1, 0, 0, 2});
+
+    int64_t oldest = 0;
+    REQUIRE(rollups.oldest_key(HistoryRollupPeriod::DAY, oldest));
+    CHECK(oldest == today - 3);
+}
+
+TEST_CASE("PrintHistoryRollups: remove undoes add", "[history][rollups]") {
+    PrintHistoryRollups rollups;
+    PrintHistoryJob running = make_job("a", BASE_TIME, PrintJobStatus::IN_PROGRESS, 100.0);
+    rollups.add(running);
+    rollups.add(make_job("b", BASE_TIME - DAY, PrintJobStatus::COMPLETED, 800.0));
+
+    // In-progress job finishes: swap its contribution
+    PrintHistoryJob finished = running;
+    finished.status = PrintJobStatus::COMPLETED;
+    finished.filament_used = 900.0;
+    rollups.remove(running);
+    rollups.add(finished);
+
+    CHECK(rollups.totals().job_count == 2);
+    CHECK(rollups.totals().completed_count == 2);
+    CHECK(rollups.totals().filament_mm == Catch::Approx(1700.0));
+
+    SECTION("removing the only job in a bucket drops the bucket") {
+        rollups.remove(make_job("b", BASE_TIME - DAY, PrintJobStatus::COMPLETED, 800.0));
+        int64_t oldest = 0;
+        REQUIRE(rollups.oldest_key(HistoryRollupPeriod::DAY, oldest));
+        CHECK(oldest == PrintHistoryRollups::bucket_key(HistoryRollupPeriod::DAY, BASE_TIME));
+    }
+
+    SECTION("rebuild matches incremental updates") {
+        PrintHistoryRollups rebuilt;
+        rebuilt.rebuild({finished, make_job("b", BASE_TIME - DAY, PrintJobStatus::COMPLETED,
+                                            800.0)});
+        CHECK(rebuilt.totals().job_count == rollups.totals().job_count);
+        CHECK(rebuilt.totals().filament_mm == Catch::Approx(rollups.totals().filament_mm));
+    }
+}
+
+TEST_CASE("PrintHistoryRollups: multi-extruder filament is split", "[history][rollups]") {
+    PrintHistoryRollups rollups;
+    rollups.add(make_job("a", BASE_TIME, PrintJobStatus::COMPLETED, 1000.0, " PLA ; PETG;"));
+    rollups.add(make_job("b", BASE_TIME, PrintJobStatus::COMPLETED, 300.0, ""));
+
+    const auto& totals = rollups.totals();
+    REQUIRE(find_type(totals, "PLA") != nullptr);
+    REQUIRE(find_type(totals, "PETG") != nullptr);
+    REQUIRE(find_type(totals, "Unknown") != nullptr);
+    CHECK(find_type(totals, "PLA")->usage_mm == Catch::Approx(500.0));
+    CHECK(find_type(totals, "PETG")->usage_mm == Catch::Approx(500.0));
+    CHECK(find_type(totals, "Unknown")->usage_mm == Catch::Approx(300.0));
+
+    CHECK(PrintHistoryRollups::split_filament_types(";;").empty());
+    CHECK(PrintHistoryRollups::split_filament_types("ABS") == std::vector<std::string>{"ABS"});
+}
@@ -820,6 +820,89 @@ TEST_CASE("HELIX:PHASE signals work with surrounding text", "[print][collector][
     }
 }
 
+// ============================================================================
+// Keyword Matchers vs Original Regexes
+// ============================================================================
+// PrintStartCollector matches with lowercase keyword checks instead of
+// std::regex; these must agree with the regexes they replaced.
+
+TEST_CASE("PrintStart: keyword matchers agree with original regexes",
+          "[print][collector][patterns]") {
+    const auto icase = std::regex::icase;
+    const std::vector<std::pair<PrintStartPhase, std::regex>> phase_regexes = {
+        {PrintStartPhase::HOMING, std::regex(R"(G28|Homing|Home All Axes|homing)", icase)},
+        {PrintStartPhase::HEATING_BED,
+         std::regex(R"(M190|M140\s+S[1-9]|Heating bed|Heat Bed|BED_TEMP|bed.*heat)", icase)},
+        {PrintStartPhase::HEATING_NOZZLE,
+         std::regex(R"(M109|M104\s+S[1-9]|Heating (nozzle|hotend|extruder)|EXTRUDER_TEMP)",
+                    icase)},
+        {PrintStartPhase::QGL, std::regex(R"(QUAD_GANTRY_LEVEL|quad.?gantry.?level|QGL)", icase)},
+        {PrintStartPhase::Z_TILT, std::regex(R"(Z_TILT_ADJUST|z.?tilt.?adjust)", icase)},
+        {PrintStartPhase::BED_MESH,
+         std::regex(R"(BED_MESH_CALIBRATE|BED_MESH_PROFILE\s+LOAD=|Loading bed mesh|mesh.*load)",
+                    icase)},
+        {PrintStartPhase::CLEANING,
+         std::regex(R"(CLEAN_NOZZLE|NOZZLE_CLEAN|WIPE_NOZZLE|nozzle.?wipe|clean.?nozzle)", icase)},
+        {PrintStartPhase::PURGING,
+         std::regex(
+             R"(VORON_PURGE|LINE_PURGE|PURGE_LINE|Prime.?Line|Priming|KAMP_.*PURGE|purge.?line)",
+             icase)},
+    };
+    const std::regex start_regex(R"(PRINT_START|START_PRINT|_PRINT_START)", icase);
+    const std::regex completion_regex(
+        R"(SET_PRINT_STATS_INFO\s+CURRENT_LAYER=|LAYER:?\s*1\b|;LAYER:1|First layer|HELIX:READY)",
+        icase);
+
+    const std::vector<std::string> lines = {
+        "G28", "g28 z", "Homing X Y", "// Home All Axes", "M190 S60", "M140 S0", "M140  S65",
+        "M140\tS1", "Heating bed to 60", "BED_TEMP=60", "bed is heating", "bed\nheat",
+        "M109 S210", "M104 S0", "M104 S215", "Heating hotend", "EXTRUDER_TEMP=250",
+        "QUAD_GANTRY_LEVEL", "quad gantry level", "quadxxgantry", "qgl done", "Z_TILT_ADJUST",
+        "z tilt adjust", "ztiltadjust", "z  tilt", "BED_MESH_CALIBRATE ADAPTIVE=1",
+        "BED_MESH_PROFILE LOAD=default", "BED_MESH_PROFILE LOAD =x", "Loading bed mesh",
+        "mesh: loaded", "mesh\rload", "CLEAN_NOZZLE", "nozzle wipe", "nozzle  wipe",
+        "clean_nozzle", "VORON_PURGE", "LINE_PURGE", "Prime Line", "Priming", "KAMP_ADAPTIVE_PURGE",
+        "purge_line", "purge\nline", "START_PRINT BED_TEMP=110", "_PRINT_START", "PRINTS_TART",
+        "SET_PRINT_STATS_INFO CURRENT_LAYER=1", "SET_PRINT_STATS_INFO", "LAYER: 1", "LAYER:1",
+        "LAYER 1", "layer1", "LAYER:10", "LAYER: 1_", "LAYER: 1.", ";LAYER:1", "First layer",
+        "HELIX:READY", "ok", "", "// Klipper state: Ready", "echo: Unknown command", "B:60.0 /60.0",
+        "T0:210.0 /210.0 B:60.0 /60.0"};
+
+    for (const auto& line : lines) {
+        CAPTURE(line);
+        PrintStartPhase expected = PrintStartPhase::IDLE;
+        for (const auto& [phase, regex] : phase_regexes) {
+            if (std::regex_search(line, regex)) {
+                expected = phase;
+                break;
+            }
+        }
+        CHECK(PrintStartCollector::match_phase(line) == expected);
+        CHECK(PrintStartCollector::is_print_start_marker(line) ==
+              std::regex_search(line, start_regex));
+        CHECK(PrintStartCollector::is_completion_marker(line) ==
+              std::regex_search(line, completion_regex));
+    }
+}
+
+TEST_CASE_METHOD(PrintStartCollectorHeaterFixture,
+                 "PrintStartCollector: console lines reach the collector via the dispatcher",
+                 "[print][collector][dispatcher]") {
+    collector().start();
+    REQUIRE(client().gcode_responses().subscriber_count() == 1);
+
+    client().dispatch_gcode_response("HELIX:PHASE:HOMING");
+    drain_async_updates();
+    CHECK(get_current_phase() == PrintStartPhase::HOMING);
+
+    client().dispatch_gcode_response("M190 S60");
+    drain_async_updates();
+    CHECK(get_current_phase() == PrintStartPhase::HEATING_BED);
+
+    collector().stop();
+    CHECK(client().gcode_responses().subscriber_count() == 0);
+}
+
 // ============================================================================
 // AREA B: Proactive Heater Detection Tests
 // ============================================================================
@@ -764,6 +764,57 @@ TEST_CASE("Print characterization: time tracking from JSON", "[characterization]
     }
 }
 
+TEST_CASE("Print characterization: time left from print time table",
+          "[characterization][print][time]") {
+    lv_init_safe();
+
+    PrinterState& state = get_printer_state();
+    state.reset_for_testing();
+    state.init_subjects(false);
+
+    // 3000-byte file, 100s of printing per 1000 bytes
+    auto table = std::make_shared<helix::gcode::PrintTimeTable>();
+    table->bucket_bytes = 1000;
+    table->elapsed_s = {0.0f, 100.0f, 200.0f, 300.0f};
+    state.set_print_time_table("benchy.gcode", table);
+
+    SECTION("time_left follows file_position through the table") {
+        json status = {{"print_stats", {{"filename", "benchy.gcode"}, {"print_duration", 50.0}}},
+                       {"virtual_sdcard", {{"file_position", 1500}}}};
+        state.update_from_status(status);
+        REQUIRE(lv_subject_get_int(state.get_print_time_left_subject()) == 150);
+
+        // total_duration no longer drives time left
+        json status2 = {{"print_stats", {{"total_duration", 9000.0}}}};
+        state.update_from_status(status2);
+        REQUIRE(lv_subject_get_int(state.get_print_time_left_subject()) == 150);
+    }
+
+    SECTION("time_left scales with the measured pace") {
+        json status = {{"print_stats", {{"filename", "benchy.gcode"}, {"print_duration", 50.0}}},
+                       {"virtual_sdcard", {{"file_position", 1500}}}};
+        state.update_from_status(status);
+
+        // 140s of table time took 280s: the rest is expected to run twice as long
+        json status2 = {{"print_stats", {{"print_duration", 330.0}}},
+                        {"virtual_sdcard", {{"file_position", 2900}}}};
+        state.update_from_status(status2);
+        REQUIRE(lv_subject_get_int(state.get_print_time_left_subject()) == 20);
+    }
+
+    SECTION("table for another file is ignored") {
+        json status = {{"print_stats",
+                        {{"filename", "other.gcode"},
+                         {"print_duration", 1800.0},
+                         {"total_duration", 5400.0}}},
+                       {"virtual_sdcard", {{"file_position", 1500}}}};
+        state.update_from_status(status);
+        REQUIRE(lv_subject_get_int(state.get_print_time_left_subject()) == 3600);
+    }
+
+    state.set_print_time_table("", nullptr);
+}
+
 // ============================================================================
 // Print Start Phase Tests
 // ============================================================================
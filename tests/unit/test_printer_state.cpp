@@ -837,6 +837,42 @@ TEST_CASE("PrinterState: Complete printing state update", "[state][integration]"
     REQUIRE(lv_subject_get_int(state.get_fan_speed_subject()) == 50);
 }
 
+TEST_CASE("PrinterState: Decoded status delta matches JSON update", "[state][integration]") {
+    lv_init_safe();
+    PrinterState& state = get_printer_state();
+    state.init_subjects();
+
+    json status = {{"extruder", {{"temperature", 215.5}, {"target", 215.0}}},
+                   {"heater_bed", {{"temperature", 65.2}, {"target", 65.0}}},
+                   {"virtual_sdcard", {{"progress", 0.42}}},
+                   {"print_stats", {{"state", "printing"}, {"filename", "delta.gcode"}}},
+                   {"toolhead", {{"position", {25.0, 37.5, 4.2, 100.0}}, {"homed_axes", "xy"}}},
+                   {"gcode_move", {{"speed_factor", 1.5}, {"extrude_factor", 0.95}}},
+                   {"fan", {{"speed", 0.25}}}};
+    std::string frame = json{{"jsonrpc", "2.0"},
+                             {"method", "notify_status_update"},
+                             {"params", {status, 1234.0}}}
+                            .dump();
+
+    helix::StatusDelta delta;
+    REQUIRE(helix::decode_status_notification(frame, delta));
+    state.update_from_delta(delta);
+
+    // Typed slots
+    REQUIRE(lv_subject_get_int(state.get_extruder_temp_subject()) == 2155);
+    REQUIRE(lv_subject_get_int(state.get_bed_target_subject()) == 650);
+    REQUIRE(lv_subject_get_int(state.get_print_progress_subject()) == 42);
+    REQUIRE(lv_subject_get_int(state.get_position_y_subject()) == 3750);
+    REQUIRE(lv_subject_get_int(state.get_speed_factor_subject()) == 150);
+    REQUIRE(lv_subject_get_int(state.get_flow_factor_subject()) == 95);
+    REQUIRE(lv_subject_get_int(state.get_fan_speed_subject()) == 25);
+    // Untyped remainder
+    REQUIRE(std::string(lv_subject_get_string(state.get_print_state_subject())) == "printing");
+    REQUIRE(std::string(lv_subject_get_string(state.get_print_filename_subject())) ==
+            "delta.gcode");
+    REQUIRE(std::string(lv_subject_get_string(state.get_homed_axes_subject())) == "xy");
+}
+
 // ============================================================================
 // PrintJobState Enum Tests
 // ============================================================================
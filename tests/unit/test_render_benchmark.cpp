@@ -0,0 +1,594 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_render_benchmark.cpp
+ * @brief Headless draw-cost benchmark for the custom canvases and panels
+ *
+ * MainLoopHandler's benchmark mode reports whole-app FPS, and tests/tinygl covers
+ * the 3D rasterizer, but nothing measures what our own widgets cost to draw.
+ * Each scene here is built on the LVGLUITestFixture screen at 480x320, 800x480
+ * and 1024x600, then rendered offscreen with lv_snapshot (independent of the
+ * fixture's 800x480 display) once per frame after a small state change that
+ * mirrors what the panel does at runtime (rotate, scroll, new sample, ...).
+ *
+ * Results go to a JSON file for tracking over time:
+ * - HELIX_RENDER_BENCH_OUT: output path (default render_benchmark.json)
+ * - HELIX_RENDER_BENCH_FRAMES: measured frames per scene (default 60)
+ * - HELIX_RENDER_BENCH_SCENES: comma-separated scene filter (default all)
+ *
+ * Run with `make test-render-benchmark`. The benchmark links into its own
+ * binary (helix-render-benchmark), not helix-tests; see allocation counting.
+ */
+
+#include "ui_ams_slot.h"
+#include "ui_bed_mesh.h"
+#include "ui_filament_path_canvas.h"
+#include "ui_frequency_response_chart.h"
+#include "ui_gcode_viewer.h"
+#include "ui_panel_print_select.h"
+#include "ui_print_select_card_view.h"
+#include "ui_temp_graph.h"
+
+#include "../lvgl_ui_test_fixture.h"
+#include "ams_state.h"
+#include "ams_types.h"
+#include "gcode_parser.h"
+#include "platform_capabilities.h"
+#include "print_file_data.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+#include "hv/json.hpp"
+
+using json = nlohmann::json;
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+// lv_malloc uses the C library allocator (LV_STDLIB_CLIB), so counting at the
+// malloc level sees LVGL draw tasks and layers as well as our own containers.
+// Interposing malloc applies to the whole binary, which is why this file is
+// built as helix-render-benchmark instead of into helix-tests. Sanitizers
+// bring their own allocator (GCC defines __SANITIZE_*, clang only reports
+// them through __has_feature), so sanitized builds skip the counting.
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define HELIX_RENDER_BENCH_SANITIZED 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) ||                         \
+    __has_feature(memory_sanitizer)
+#define HELIX_RENDER_BENCH_SANITIZED 1
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(HELIX_RENDER_BENCH_SANITIZED)
+#define HELIX_RENDER_BENCH_COUNT_ALLOCS 1
+#endif
+
+#ifdef HELIX_RENDER_BENCH_COUNT_ALLOCS
+constexpr bool COUNTS_ALLOCS = true;
+static std::atomic<uint64_t> g_alloc_count{0};
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) noexcept {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+}
+#else
+constexpr bool COUNTS_ALLOCS = false;
+#endif
+
+namespace {
+
+/// Allocations so far, or 0 where they cannot be counted
+uint64_t alloc_count() {
+#ifdef HELIX_RENDER_BENCH_COUNT_ALLOCS
+    return g_alloc_count.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+// ============================================================================
+// Scenes
+// ============================================================================
+
+struct Resolution {
+    const char* name;
+    int width;
+    int height;
+};
+
+constexpr Resolution RESOLUTIONS[] = {
+    {"480x320", 480, 320},
+    {"800x480", 800, 480},
+    {"1024x600", 1024, 600},
+};
+
+constexpr int WARMUP_FRAMES = 5;
+
+/**
+ * @brief A built scene: per-frame state change and cleanup
+ *
+ * step() runs before every rendered frame. teardown() releases anything the
+ * scene owns outside the LVGL tree; the root object is deleted afterwards.
+ */
+struct SceneInstance {
+    std::function<void(int frame)> step = [](int) {};
+    std::function<void()> teardown = []() {};
+};
+
+struct Scene {
+    const char* name;
+    std::function<SceneInstance(lv_obj_t* root)> build;
+};
+
+/// Plausible warped bed: bowl plus a tilt, in mm
+std::vector<std::vector<float>> synthetic_mesh(int rows, int cols) {
+    std::vector<std::vector<float>> mesh(rows, std::vector<float>(cols));
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            float x = static_cast<float>(c) / static_cast<float>(cols - 1) - 0.5f;
+            float y = static_cast<float>(r) / static_cast<float>(rows - 1) - 0.5f;
+            mesh[r][c] = 0.25f * (x * x + y * y) + 0.05f * x - 0.03f * y;
+        }
+    }
+    return mesh;
+}
+
+SceneInstance build_bed_mesh(lv_obj_t* root, bed_mesh_render_mode_t mode) {
+    lv_obj_t* canvas = static_cast<lv_obj_t*>(lv_xml_create(root, "bed_mesh", nullptr));
+    REQUIRE(canvas != nullptr);
+    lv_obj_set_size(canvas, lv_pct(100), lv_pct(100));
+    lv_obj_update_layout(root);
+
+    auto mesh = synthetic_mesh(15, 15);
+    std::vector<const float*> rows;
+    for (const auto& row : mesh) {
+        rows.push_back(row.data());
+    }
+    ui_bed_mesh_set_bounds(canvas, 0, 250, 0, 250, 10, 240, 10, 240);
+    REQUIRE(ui_bed_mesh_set_data(canvas, rows.data(), 15, 15));
+    ui_bed_mesh_set_render_mode(canvas, mode);
+
+    SceneInstance scene;
+    scene.step = [canvas](int frame) {
+        // Orbiting drag, like a finger on the 3D view
+        ui_bed_mesh_set_rotation(canvas, BED_MESH_ROTATION_X_DEFAULT,
+                                 (BED_MESH_ROTATION_Z_DEFAULT + frame * 3) % 360);
+    };
+    return scene;
+}
+
+SceneInstance build_temp_graph(lv_obj_t* root) {
+    ui_temp_graph_t* graph = ui_temp_graph_create(root);
+    REQUIRE(graph != nullptr);
+    lv_obj_set_size(ui_temp_graph_get_chart(graph), lv_pct(100), lv_pct(100));
+    ui_temp_graph_set_temp_range(graph, 0, 300);
+    ui_temp_graph_set_y_axis(graph, 50, true);
+
+    struct Series {
+        const char* name;
+        uint32_t color;
+        float target;
+    };
+    const Series series[] = {
+        {"Nozzle", 0xFF5722, 215.0f}, {"Bed", 0x2196F3, 60.0f}, {"Chamber", 0x4CAF50, 40.0f}};
+
+    // Full history: the graph has been open for the whole display window
+    std::vector<int> ids;
+    std::vector<float> temps(UI_TEMP_GRAPH_DEFAULT_POINTS);
+    for (const auto& s : series) {
+        int id = ui_temp_graph_add_series(graph, s.name, lv_color_hex(s.color));
+        REQUIRE(id >= 0);
+        for (size_t i = 0; i < temps.size(); ++i) {
+            float t = static_cast<float>(i);
+            temps[i] = s.target * (1.0f - std::exp(-t / 120.0f)) + 1.5f * std::sin(t / 7.0f);
+        }
+        ui_temp_graph_set_series_data(graph, id, temps.data(), static_cast<int>(temps.size()));
+        ui_temp_graph_set_series_target(graph, id, s.target, true);
+        ids.push_back(id);
+    }
+
+    SceneInstance scene;
+    scene.step = [graph, ids, targets = std::vector<float>{215.0f, 60.0f, 40.0f}](int frame) {
+        // One new sample per series, as the 1 Hz temperature update does
+        for (size_t i = 0; i < ids.size(); ++i) {
+            float jitter = 1.5f * std::sin(static_cast<float>(frame + static_cast<int>(i)));
+            ui_temp_graph_update_series(graph, ids[i], targets[i] + jitter);
+        }
+    };
+    scene.teardown = [graph]() { ui_temp_graph_destroy(graph); };
+    return scene;
+}
+
+/// Slot width and overlap the AMS panel uses for @p count slots across @p available_width
+void ams_slot_sizing(int32_t available_width, int count, int32_t& slot_width, int32_t& overlap) {
+    if (count > 4) {
+        constexpr float overlap_ratio = 0.5f;
+        slot_width = static_cast<int32_t>(available_width /
+                                          (count * (1.0f - overlap_ratio) + overlap_ratio));
+        overlap = static_cast<int32_t>(slot_width * overlap_ratio);
+    } else {
+        slot_width = available_width / count;
+        overlap = 0;
+    }
+}
+
+lv_obj_t* create_path_canvas(lv_obj_t* parent, int slot_count, int32_t slot_width,
+                             int32_t overlap) {
+    lv_obj_t* canvas = ui_filament_path_canvas_create(parent);
+    REQUIRE(canvas != nullptr);
+    ui_filament_path_canvas_set_slot_count(canvas, slot_count);
+    ui_filament_path_canvas_set_slot_width(canvas, slot_width);
+    ui_filament_path_canvas_set_slot_overlap(canvas, overlap);
+    for (int i = 0; i < slot_count; ++i) {
+        uint32_t color = 0x202020u + static_cast<uint32_t>(i) * 0x0F0A05u;
+        ui_filament_path_canvas_set_slot_filament(canvas, i,
+                                                  static_cast<int>(PathSegment::PREP), color);
+    }
+    ui_filament_path_canvas_set_active_slot(canvas, 2);
+    ui_filament_path_canvas_set_filament_color(canvas, 0xE53935);
+    ui_filament_path_canvas_set_filament_segment(canvas, static_cast<int>(PathSegment::NOZZLE));
+    return canvas;
+}
+
+SceneInstance build_filament_path(lv_obj_t* root) {
+    constexpr int SLOTS = 16;
+    int32_t slot_width = 0;
+    int32_t overlap = 0;
+    ams_slot_sizing(lv_obj_get_content_width(root), SLOTS, slot_width, overlap);
+
+    lv_obj_t* canvas = create_path_canvas(root, SLOTS, slot_width, overlap);
+    lv_obj_set_size(canvas, lv_pct(100), lv_pct(100));
+
+    SceneInstance scene;
+    scene.step = [canvas](int frame) {
+        // Mid-load animation: the gradient moves down the active lane
+        ui_filament_path_canvas_set_anim_progress(canvas, (frame * 5) % 101);
+    };
+    return scene;
+}
+
+SceneInstance build_ams_panel(lv_obj_t* root) {
+    constexpr int SLOTS = 16;
+    ui_ams_slot_register();
+
+    // Same structure as ams_panel's slot area: overlapping slot row over the path canvas
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+    lv_obj_t* slot_grid = lv_obj_create(root);
+    lv_obj_remove_style_all(slot_grid);
+    lv_obj_set_size(slot_grid, lv_pct(100), lv_pct(45));
+    lv_obj_set_flex_flow(slot_grid, LV_FLEX_FLOW_ROW);
+    lv_obj_update_layout(root);
+
+    int32_t slot_width = 0;
+    int32_t overlap = 0;
+    ams_slot_sizing(lv_obj_get_content_width(root), SLOTS, slot_width, overlap);
+    lv_obj_set_style_pad_column(slot_grid, -overlap, LV_PART_MAIN);
+
+    std::vector<lv_obj_t*> slots;
+    for (int i = 0; i < SLOTS; ++i) {
+        lv_obj_t* slot = static_cast<lv_obj_t*>(lv_xml_create(slot_grid, "ams_slot", nullptr));
+        REQUIRE(slot != nullptr);
+        ui_ams_slot_set_index(slot, i);
+        ui_ams_slot_set_layout_info(slot, i, SLOTS);
+        ui_ams_slot_set_fill_level(slot, 0.2f + 0.05f * static_cast<float>(i));
+        lv_obj_set_width(slot, slot_width);
+        lv_obj_set_height(slot, lv_pct(100));
+        slots.push_back(slot);
+    }
+
+    lv_obj_t* canvas = create_path_canvas(root, SLOTS, slot_width, overlap);
+    lv_obj_set_width(canvas, lv_pct(100));
+    lv_obj_set_flex_grow(canvas, 1);
+
+    SceneInstance scene;
+    scene.step = [canvas, slots](int frame) {
+        // Tool change sweep: a different slot becomes active each frame
+        int active = frame % static_cast<int>(slots.size());
+        ui_filament_path_canvas_set_active_slot(canvas, active);
+        ui_ams_slot_set_fill_level(slots[active], static_cast<float>(frame % 10) / 10.0f);
+    };
+    return scene;
+}
+
+/// 3DBenchy parsed once per run; each viewer gets its own copy
+const helix::gcode::ParsedGCodeFile* benchy() {
+    static std::unique_ptr<helix::gcode::ParsedGCodeFile> parsed;
+    if (!parsed) {
+        std::ifstream in("assets/test_gcodes/3DBenchy.gcode");
+        if (!in.good()) {
+            return nullptr;
+        }
+        helix::gcode::GCodeParser parser;
+        std::string line;
+        while (std::getline(in, line)) {
+            parser.parse_line(line);
+        }
+        parsed = std::make_unique<helix::gcode::ParsedGCodeFile>(parser.finalize());
+    }
+    return parsed.get();
+}
+
+SceneInstance build_gcode_layers(lv_obj_t* root) {
+    const auto* gcode = benchy();
+    REQUIRE(gcode != nullptr);
+
+    lv_obj_t* viewer = ui_gcode_viewer_create(root);
+    REQUIRE(viewer != nullptr);
+    lv_obj_set_size(viewer, lv_pct(100), lv_pct(100));
+    ui_gcode_viewer_set_render_mode(viewer, GCODE_VIEWER_RENDER_2D_LAYER);
+    ui_gcode_viewer_set_gcode_data(viewer, new helix::gcode::ParsedGCodeFile(*gcode));
+
+    SceneInstance scene;
+    scene.step = [viewer, layers = static_cast<int>(gcode->layers.size())](int frame) {
+        // Print status view: one more layer printed each frame
+        ui_gcode_viewer_set_print_progress(viewer, frame % layers);
+    };
+    return scene;
+}
+
+SceneInstance build_frequency_response(lv_obj_t* root) {
+    ui_frequency_response_chart_t* chart = ui_frequency_response_chart_create(root);
+    REQUIRE(chart != nullptr);
+    lv_obj_set_size(ui_frequency_response_chart_get_obj(chart), lv_pct(100), lv_pct(100));
+    ui_frequency_response_chart_configure_for_platform(chart, helix::PlatformTier::STANDARD);
+    ui_frequency_response_chart_set_freq_range(chart, 0, 200);
+    ui_frequency_response_chart_set_amplitude_range(chart, 0, 1e5f);
+
+    // Calibration result: X and Y resonance plus the chosen shaper's residual
+    struct Axis {
+        const char* name;
+        uint32_t color;
+        float peak_hz;
+    };
+    const Axis axes[] = {
+        {"X", 0xE53935, 48.0f}, {"Y", 0x1E88E5, 39.0f}, {"Shaper", 0x43A047, 44.0f}};
+
+    constexpr size_t POINTS = 400;
+    std::vector<float> freqs(POINTS);
+    std::vector<float> amps(POINTS);
+    for (const auto& axis : axes) {
+        int id = ui_frequency_response_chart_add_series(chart, axis.name, lv_color_hex(axis.color));
+        REQUIRE(id >= 0);
+        for (size_t i = 0; i < POINTS; ++i) {
+            freqs[i] = 200.0f * static_cast<float>(i) / static_cast<float>(POINTS - 1);
+            float d = (freqs[i] - axis.peak_hz) / 6.0f;
+            amps[i] = 9e4f / (1.0f + d * d) + 2e3f;
+        }
+        ui_frequency_response_chart_set_data(chart, id, freqs.data(), amps.data(), POINTS);
+        ui_frequency_response_chart_mark_peak(chart, id, axis.peak_hz, 9.2e4f);
+    }
+
+    SceneInstance scene;
+    lv_obj_t* obj = ui_frequency_response_chart_get_obj(chart);
+    scene.step = [obj](int) { lv_obj_invalidate(obj); };
+    scene.teardown = [chart]() { ui_frequency_response_chart_destroy(chart); };
+    return scene;
+}
+
+SceneInstance build_print_select_cards(lv_obj_t* root) {
+    constexpr int GAP = 8;
+
+    // Matches print_select_panel's card container: wrapping rows, vertical scroll
+    lv_obj_t* container = lv_obj_create(root);
+    lv_obj_set_size(container, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(container, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_gap(container, GAP, LV_PART_MAIN);
+    lv_obj_update_layout(root);
+
+    // PrintSelectPanel::calculate_card_dimensions() without the top bar
+    int32_t width = lv_obj_get_content_width(container);
+    int32_t height = lv_obj_get_content_height(container);
+    CardDimensions dims{1, height >= helix::ui::PrintSelectCardView::ROW_3_MIN_HEIGHT ? 3 : 2,
+                        helix::ui::PrintSelectCardView::MIN_WIDTH, 0};
+    dims.card_height = (height - GAP / 2) / dims.num_rows - GAP;
+    for (int cols = 10; cols >= 1; --cols) {
+        int card_width = (width - (cols - 1) * GAP) / cols;
+        if (card_width >= helix::ui::PrintSelectCardView::MIN_WIDTH &&
+            card_width <= helix::ui::PrintSelectCardView::MAX_WIDTH) {
+            dims.num_columns = cols;
+            dims.card_width = card_width;
+            break;
+        }
+    }
+
+    auto files = std::make_shared<std::vector<PrintFileData>>(200);
+    for (size_t i = 0; i < files->size(); ++i) {
+        PrintFileData& file = (*files)[i];
+        file.filename = "benchmark_part_" + std::to_string(i) + ".gcode";
+        file.thumbnail_path = helix::ui::PrintSelectCardView::get_default_thumbnail();
+        file.print_time_str = std::to_string(30 + i % 90) + "m";
+        file.filament_str = std::to_string(5 + i % 40) + "g";
+        file.metadata_fetched = true;
+    }
+
+    auto view = std::make_shared<helix::ui::PrintSelectCardView>();
+    REQUIRE(view->setup(
+        container, [](size_t) {}, [](size_t, size_t) {}));
+    view->populate(*files, dims);
+
+    SceneInstance scene;
+    scene.step = [container, view, files, dims](int frame) {
+        // Steady scroll through the list, recycling pool cards as rows change
+        int32_t row = dims.card_height + GAP;
+        int32_t rows = static_cast<int32_t>(files->size()) / dims.num_columns;
+        lv_obj_scroll_to_y(container, (frame * row / 4) % (rows * row), LV_ANIM_OFF);
+        view->update_visible(*files, dims);
+    };
+    scene.teardown = [view]() { view->cleanup(); };
+    return scene;
+}
+
+const std::vector<Scene>& scenes() {
+    static const std::vector<Scene> all = {
+        {"bed_mesh_3d",
+         [](lv_obj_t* root) { return build_bed_mesh(root, BED_MESH_RENDER_MODE_FORCE_3D); }},
+        {"bed_mesh_2d",
+         [](lv_obj_t* root) { return build_bed_mesh(root, BED_MESH_RENDER_MODE_FORCE_2D); }},
+        {"temp_graph", build_temp_graph},
+        {"ams_panel_16", build_ams_panel},
+        {"filament_path", build_filament_path},
+        {"gcode_layers", build_gcode_layers},
+        {"frequency_response", build_frequency_response},
+        {"print_select_cards", build_print_select_cards},
+    };
+    return all;
+}
+
+bool scene_selected(const char* name) {
+    const char* filter = std::getenv("HELIX_RENDER_BENCH_SCENES");
+    if (!filter || !*filter) {
+        return true;
+    }
+    std::stringstream ss(filter);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[static_cast<size_t>(p * static_cast<double>(values.size() - 1))];
+}
+
+json summarize(const std::vector<double>& values) {
+    double sum = 0.0;
+    for (double v : values) {
+        sum += v;
+    }
+    return {{"mean", values.empty() ? 0.0 : sum / static_cast<double>(values.size())},
+            {"p50", percentile(values, 0.5)},
+            {"p90", percentile(values, 0.9)},
+            {"p99", percentile(values, 0.99)},
+            {"max", percentile(values, 1.0)}};
+}
+
+} // namespace
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+TEST_CASE_METHOD(LVGLUITestFixture, "Render benchmark: custom canvases and panels",
+                 "[.benchmark][render]") {
+    const char* frames_env = std::getenv("HELIX_RENDER_BENCH_FRAMES");
+    const int frames = frames_env ? std::max(1, std::atoi(frames_env)) : 60;
+    const char* out_env = std::getenv("HELIX_RENDER_BENCH_OUT");
+    const std::string out_path = out_env ? out_env : "render_benchmark.json";
+    const lv_color_format_t cf = LV_COLOR_FORMAT_NATIVE;
+
+    // ams_slot binds to AmsState subjects; released once every scene is deleted
+    AmsState::instance().init_subjects(false);
+
+    json results = json::array();
+
+    for (const auto& scene : scenes()) {
+        if (!scene_selected(scene.name)) {
+            continue;
+        }
+        for (const auto& res : RESOLUTIONS) {
+            INFO(scene.name << " @ " << res.name);
+
+            lv_obj_t* root = lv_obj_create(test_screen());
+            lv_obj_set_size(root, res.width, res.height);
+            lv_obj_set_style_pad_all(root, 0, LV_PART_MAIN);
+            lv_obj_set_style_border_width(root, 0, LV_PART_MAIN);
+            lv_obj_remove_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+            lv_obj_update_layout(root);
+
+            SceneInstance instance = scene.build(root);
+            process_lvgl(50); // Let deferred size/data handlers settle
+
+            lv_obj_update_layout(root);
+            lv_draw_buf_t* buf = lv_snapshot_create_draw_buf(root, cf);
+            REQUIRE(buf != nullptr);
+
+            std::vector<double> frame_ms;
+            std::vector<double> allocs;
+            frame_ms.reserve(static_cast<size_t>(frames));
+            allocs.reserve(static_cast<size_t>(frames));
+
+            for (int frame = 0; frame < WARMUP_FRAMES + frames; ++frame) {
+                uint64_t allocs_before = alloc_count();
+                auto start = std::chrono::steady_clock::now();
+
+                instance.step(frame);
+                lv_obj_update_layout(root);
+                REQUIRE(lv_snapshot_take_to_draw_buf(root, cf, buf) == LV_RESULT_OK);
+
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                uint64_t allocs_after = alloc_count();
+                if (frame < WARMUP_FRAMES) {
+                    continue;
+                }
+                frame_ms.push_back(
+                    std::chrono::duration<double, std::milli>(elapsed).count());
+                allocs.push_back(static_cast<double>(allocs_after - allocs_before));
+            }
+
+            lv_draw_buf_destroy(buf);
+            instance.teardown();
+            lv_obj_delete(root);
+            process_lvgl(10);
+
+            json entry = {{"scene", scene.name},     {"resolution", res.name},
+                          {"width", res.width},      {"height", res.height},
+                          {"frames", frames},        {"frame_ms", summarize(frame_ms)},
+                          {"allocs_per_frame", COUNTS_ALLOCS ? summarize(allocs) : json()}};
+            WARN(scene.name << " @ " << res.name << ": p50=" << entry["frame_ms"]["p50"]
+                            << " ms p99=" << entry["frame_ms"]["p99"] << " ms");
+            results.push_back(std::move(entry));
+        }
+    }
+
+    AmsState::instance().deinit_subjects();
+
+    json report = {{"benchmark", "render"},
+                   {"bits_per_pixel", lv_color_format_get_bpp(cf)},
+                   {"warmup_frames", WARMUP_FRAMES},
+                   {"allocs_counted", COUNTS_ALLOCS},
+                   {"results", results}};
+
+    std::ofstream out(out_path);
+    REQUIRE(out.good());
+    out << report.dump(2) << "\n";
+    spdlog::info("[RenderBenchmark] Wrote {} results to {}", results.size(), out_path);
+}
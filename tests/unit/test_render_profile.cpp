@@ -0,0 +1,105 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "render_profile.h"
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_render_profile.cpp
+ * @brief Unit tests for tier-based render profiles and benchmark refinement
+ */
+
+using namespace helix;
+
+TEST_CASE("RenderProfile: tier defaults", "[render_profile]") {
+    SECTION("AD5M keeps a minimal footprint") {
+        auto caps = PlatformCapabilities::from_metrics(110, 1, 0.0f);
+        auto profile = RenderProfile::for_tier(caps);
+        CHECK(profile.tier == PlatformTier::EMBEDDED);
+        CHECK(profile.draw_units == 1);
+        CHECK(profile.image_cache_bytes == 0);
+        CHECK(profile.image_header_cache_count == 0);
+    }
+
+    SECTION("Pi 3 gets two draw units and a small cache") {
+        auto caps = PlatformCapabilities::from_metrics(1024, 4, 38.0f);
+        auto profile = RenderProfile::for_tier(caps);
+        CHECK(profile.tier == PlatformTier::BASIC);
+        CHECK(profile.draw_units == 2);
+        CHECK(profile.image_cache_bytes > 0);
+    }
+
+    SECTION("Pi 5 uses all its cores") {
+        auto caps = PlatformCapabilities::from_metrics(8192, 4, 108.0f);
+        auto profile = RenderProfile::for_tier(caps);
+        CHECK(profile.tier == PlatformTier::STANDARD);
+        CHECK(profile.draw_units == 4);
+    }
+}
+
+TEST_CASE("RenderProfile: benchmark refinement", "[render_profile]") {
+    auto caps = PlatformCapabilities::from_metrics(8192, 4, 108.0f);
+
+    SECTION("Good scaling keeps every unit") {
+        auto profile = RenderProfile::for_tier(caps);
+        profile.refine({400.0, 3.7, 4});
+        CHECK(profile.calibrated);
+        CHECK(profile.draw_units == 4);
+    }
+
+    SECTION("Poor scaling drops units") {
+        auto profile = RenderProfile::for_tier(caps);
+        profile.refine({400.0, 1.6, 4});
+        CHECK(profile.draw_units == 2);
+    }
+
+    SECTION("Speedup never adds units beyond the tier") {
+        auto profile = RenderProfile::for_tier(PlatformCapabilities::from_metrics(1024, 4, 38.0f));
+        profile.refine({400.0, 3.9, 2});
+        CHECK(profile.draw_units == 2);
+    }
+
+    SECTION("Build ceiling clamps draw units") {
+        auto profile = RenderProfile::for_tier(caps);
+        profile.clamp_draw_units(1);
+        CHECK(profile.draw_units == 1);
+    }
+}
+
+TEST_CASE("RenderProfile: persistence", "[render_profile]") {
+    auto caps = PlatformCapabilities::from_metrics(8192, 4, 108.0f);
+    auto profile = RenderProfile::for_tier(caps);
+    profile.refine({120.0, 2.2, 4});
+
+    RenderProfile restored;
+    REQUIRE(RenderProfile::from_json(profile.to_json(), restored));
+    CHECK(restored.tier == PlatformTier::STANDARD);
+    CHECK(restored.draw_units == profile.draw_units);
+    CHECK(restored.image_cache_bytes == profile.image_cache_bytes);
+    CHECK(restored.image_header_cache_count == profile.image_header_cache_count);
+    CHECK(restored.benchmark.parallel_speedup == Catch::Approx(2.2));
+    CHECK_FALSE(restored.needs_recalibration(caps));
+
+    SECTION("Different board triggers recalibration") {
+        CHECK(restored.needs_recalibration(PlatformCapabilities::from_metrics(8192, 8, 0.0f)));
+    }
+
+    SECTION("Old version is rejected") {
+        auto j = profile.to_json();
+        j["version"] = RenderProfile::VERSION - 1;
+        CHECK_FALSE(RenderProfile::from_json(j, restored));
+    }
+
+    SECTION("Malformed entry is rejected") {
+        nlohmann::json j = {{"version", RenderProfile::VERSION}, {"tier", "standard"}};
+        CHECK_FALSE(RenderProfile::from_json(j, restored));
+    }
+}
+
+TEST_CASE("RenderProfile: benchmark measures throughput", "[render_profile][slow]") {
+    auto result = run_render_benchmark(2, 5);
+    CHECK(result.single_thread_mpix_s > 0.0);
+    CHECK(result.parallel_speedup > 0.0);
+    CHECK(result.threads_tested == 2);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "scoped_trace.h"
+
+#include <json.hpp> // nlohmann/json from libhv
+#include <string>
+#include <thread>
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_scoped_trace.cpp
+ * @brief Unit tests for scoped tracing and Chrome trace export
+ */
+
+using json = nlohmann::json;
+
+namespace {
+
+/// Complete ("X") events with the given name
+std::vector<json> find_events(const json& trace, const std::string& name) {
+    std::vector<json> out;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "X" && event["name"] == name) {
+            out.push_back(event);
+        }
+    }
+    return out;
+}
+
+/// Enables tracing for one test and restores a clean state afterwards
+struct TraceFixture {
+    TraceFixture() {
+        helix::trace::clear();
+        helix::trace::set_enabled(true);
+    }
+    ~TraceFixture() {
+        helix::trace::set_enabled(false);
+        helix::trace::clear();
+    }
+};
+
+} // namespace
+
+TEST_CASE_METHOD(TraceFixture, "Trace: scopes become complete events", "[trace]") {
+    {
+        HELIX_TRACE_SCOPE("test", "outer");
+        HELIX_TRACE_SCOPE("test", "inner");
+    }
+
+    json trace = json::parse(helix::trace::to_chrome_json());
+    auto outer = find_events(trace, "outer");
+    auto inner = find_events(trace, "inner");
+    REQUIRE(outer.size() == 1);
+    REQUIRE(inner.size() == 1);
+    CHECK(outer[0]["cat"] == "test");
+    CHECK(outer[0]["tid"] == inner[0]["tid"]);
+    // Inner span nests inside outer
+    CHECK(inner[0]["ts"].get<uint64_t>() >= outer[0]["ts"].get<uint64_t>());
+    CHECK(inner[0]["ts"].get<uint64_t>() + inner[0]["dur"].get<uint64_t>() <=
+          outer[0]["ts"].get<uint64_t>() + outer[0]["dur"].get<uint64_t>());
+}
+
+TEST_CASE_METHOD(TraceFixture, "Trace: nothing is recorded while disabled", "[trace]") {
+    helix::trace::set_enabled(false);
+    {
+        HELIX_TRACE_SCOPE("test", "hidden");
+    }
+    json trace = json::parse(helix::trace::to_chrome_json());
+    CHECK(find_events(trace, "hidden").empty());
+}
+
+TEST_CASE_METHOD(TraceFixture, "Trace: end() closes a scope early", "[trace]") {
+    helix::trace::Scope scope("test", "early");
+    scope.end();
+    scope.end(); // Idempotent
+
+    json trace = json::parse(helix::trace::to_chrome_json());
+    CHECK(find_events(trace, "early").size() == 1);
+}
+
+TEST_CASE_METHOD(TraceFixture, "Trace: ring keeps the newest events", "[trace]") {
+    for (size_t i = 0; i < helix::trace::EVENTS_PER_THREAD + 100; ++i) {
+        HELIX_TRACE_SCOPE("test", "spin");
+    }
+    {
+        HELIX_TRACE_SCOPE("test", "last");
+    }
+
+    json trace = json::parse(helix::trace::to_chrome_json());
+    CHECK(find_events(trace, "last").size() == 1);
+    CHECK(find_events(trace, "spin").size() < helix::trace::EVENTS_PER_THREAD);
+}
+
+TEST_CASE_METHOD(TraceFixture, "Trace: other threads get their own named track", "[trace]") {
+    std::thread worker([] {
+        helix::trace::set_thread_name("worker \"1\"");
+        HELIX_TRACE_SCOPE_DYNAMIC("test", std::string("dynamic-") + "name");
+    });
+    worker.join();
+    {
+        HELIX_TRACE_SCOPE("test", "main-side");
+    }
+
+    json trace = json::parse(helix::trace::to_chrome_json());
+    auto dynamic = find_events(trace, "dynamic-name");
+    auto main_side = find_events(trace, "main-side");
+    REQUIRE(dynamic.size() == 1);
+    REQUIRE(main_side.size() == 1);
+    CHECK(dynamic[0]["tid"] != main_side[0]["tid"]);
+
+    bool named = false;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "M" && event["name"] == "thread_name" &&
+            event["tid"] == dynamic[0]["tid"]) {
+            named = event["args"]["name"] == "worker \"1\"";
+        }
+    }
+    CHECK(named);
+}
@@ -0,0 +1,306 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "shaper_analysis.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../catch_amalgamated.hpp"
+
+#include <json.hpp> // nlohmann/json from libhv
+
+/**
+ * @file test_shaper_analysis.cpp
+ * @brief Tests for the on-device resonance analysis engine
+ *
+ * Reference values in assets/test_resonances were produced by a NumPy port of
+ * Klipper's shaper_calibrate.py (scripts/gen_resonance_reference.py).
+ */
+
+using namespace helix::calibration;
+using Catch::Approx;
+using json = nlohmann::json;
+
+namespace {
+
+const char* SAMPLE_CSV = "assets/test_resonances/raw_data_x_helix.csv";
+const char* SAMPLE_REFERENCE = "assets/test_resonances/raw_data_x_helix.reference.json";
+
+bool load_reference(json& out) {
+    std::ifstream file(SAMPLE_REFERENCE);
+    if (!file.good()) {
+        return false;
+    }
+    out = json::parse(file);
+    return true;
+}
+
+/// Samples of a pure tone on X with constant gravity on Z
+AccelSamples make_tone(double freq, double fs, double seconds) {
+    AccelSamples samples;
+    auto n = static_cast<size_t>(fs * seconds);
+    for (size_t i = 0; i < n; ++i) {
+        double t = static_cast<double>(i) / fs;
+        samples.x.push_back(static_cast<float>(1000.0 * std::sin(2.0 * M_PI * freq * t)));
+        samples.y.push_back(0.0f);
+        samples.z.push_back(9810.0f);
+    }
+    samples.first_time = 100.0;
+    samples.last_time = 100.0 + static_cast<double>(n - 1) / fs;
+    return samples;
+}
+
+} // namespace
+
+// ============================================================================
+// CSV parsing
+// ============================================================================
+
+TEST_CASE("ShaperAnalysis: parses raw accelerometer CSV", "[calibration][shaper_analysis]") {
+    AccelSamples samples;
+    std::string error;
+
+    SECTION("Header, blank lines, CRLF and exponents") {
+        std::string csv = "#time,accel_x,accel_y,accel_z\r\n"
+                          "10.000000,1.5,-2.25,9810.000\r\n"
+                          "\n"
+                          "10.000313, -1e2 ,+3.0E-1,9809.5\n"
+                          "10.000625,0,0,9810";
+        REQUIRE(parse_accel_csv(csv, samples, &error));
+        REQUIRE(samples.size() == 3);
+        CHECK(samples.first_time == Approx(10.0));
+        CHECK(samples.last_time == Approx(10.000625));
+        CHECK(samples.x[0] == 1.5f);
+        CHECK(samples.y[0] == -2.25f);
+        CHECK(samples.x[1] == -100.0f);
+        CHECK(samples.y[1] == Approx(0.3f));
+        CHECK(samples.z[2] == 9810.0f);
+    }
+
+    SECTION("Rejects rows with missing columns") {
+        std::string csv = "#time,accel_x,accel_y,accel_z\n"
+                          "10.0,1,2,3\n"
+                          "10.1,1,2\n";
+        REQUIRE_FALSE(parse_accel_csv(csv, samples, &error));
+        CHECK(error.find("line 3") != std::string::npos);
+    }
+
+    SECTION("Rejects Klipper's PSD output format") {
+        std::string csv = "freq,psdx,psdy,psdz,psdxyz\n5.0,1,2,3,6\n";
+        REQUIRE_FALSE(parse_accel_csv(csv, samples, &error));
+    }
+
+    SECTION("Rejects files without samples") {
+        REQUIRE_FALSE(parse_accel_csv("#time,accel_x,accel_y,accel_z\n", samples, &error));
+    }
+}
+
+TEST_CASE("ShaperAnalysis: streaming load matches in-memory parse",
+          "[calibration][shaper_analysis]") {
+    std::ifstream file(SAMPLE_CSV, std::ios::binary);
+    if (!file.good()) {
+        SKIP("Sample capture not found (run from project root)");
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+
+    AccelSamples parsed;
+    AccelSamples loaded;
+    REQUIRE(parse_accel_csv(text.str(), parsed));
+    REQUIRE(load_accel_csv(SAMPLE_CSV, loaded));
+
+    REQUIRE(loaded.size() == parsed.size());
+    CHECK(loaded.size() == 6400);
+    CHECK(loaded.first_time == parsed.first_time);
+    CHECK(loaded.last_time == parsed.last_time);
+    CHECK(loaded.x == parsed.x);
+    CHECK(loaded.z == parsed.z);
+
+    std::string error;
+    CHECK_FALSE(load_accel_csv("/nonexistent/raw_data.csv", loaded, &error));
+    CHECK_FALSE(error.empty());
+}
+
+// ============================================================================
+// Spectrum
+// ============================================================================
+
+TEST_CASE("ShaperAnalysis: PSD peak lands on the excited frequency",
+          "[calibration][shaper_analysis]") {
+    ResonanceSpectrum spectrum;
+    REQUIRE(compute_spectrum(make_tone(55.0, 3200.0, 3.0), spectrum));
+
+    REQUIRE(spectrum.freqs.size() == 1025); // 2048-sample window at 3200 Hz
+    CHECK(spectrum.freqs[1] == Approx(3200.0 / 2048.0).epsilon(1e-3));
+
+    size_t peak = 0;
+    for (size_t k = 1; k < spectrum.psd_x.size(); ++k) {
+        if (spectrum.psd_x[k] > spectrum.psd_x[peak]) {
+            peak = k;
+        }
+    }
+    CHECK(spectrum.freqs[peak] == Approx(55.0).margin(3200.0 / 2048.0));
+
+    // Constant gravity is removed by per-window detrending
+    CHECK(spectrum.psd_z[0] < spectrum.psd_x[peak] * 1e-6f);
+
+    // Too short for a single window
+    ResonanceSpectrum short_spectrum;
+    CHECK_FALSE(compute_spectrum(make_tone(55.0, 3200.0, 0.5), short_spectrum));
+}
+
+TEST_CASE("ShaperAnalysis: spectrum matches Klipper reference", "[calibration][shaper_analysis]") {
+    json reference;
+    if (!load_reference(reference)) {
+        SKIP("Reference data not found (run from project root)");
+    }
+
+    AccelSamples samples;
+    REQUIRE(load_accel_csv(SAMPLE_CSV, samples));
+    ResonanceSpectrum spectrum;
+    REQUIRE(compute_spectrum(samples, spectrum));
+    normalize_spectrum(spectrum);
+
+    const auto& freqs = reference["freqs"];
+    const auto& psd_sum = reference["psd_sum"];
+    const auto& psd_x = reference["psd_x"];
+    REQUIRE(spectrum.freqs.size() == static_cast<size_t>(reference["window_size"]) / 2 + 1);
+
+    double psd_max = 0.0;
+    for (const auto& v : psd_sum) {
+        psd_max = std::max(psd_max, v.get<double>());
+    }
+    for (size_t k = 0; k < freqs.size(); ++k) {
+        INFO("bin " << k << " (" << freqs[k].get<double>() << " Hz)");
+        CHECK(spectrum.freqs[k] == Approx(freqs[k].get<double>()).epsilon(1e-6));
+        CHECK(spectrum.psd_sum[k] ==
+              Approx(psd_sum[k].get<double>()).epsilon(1e-3).margin(psd_max * 1e-6));
+        CHECK(spectrum.psd_x[k] ==
+              Approx(psd_x[k].get<double>()).epsilon(1e-3).margin(psd_max * 1e-6));
+    }
+}
+
+TEST_CASE("ShaperAnalysis: merging averages captures", "[calibration][shaper_analysis]") {
+    ResonanceSpectrum a;
+    ResonanceSpectrum b;
+    REQUIRE(compute_spectrum(make_tone(40.0, 3200.0, 2.0), a));
+    REQUIRE(compute_spectrum(make_tone(80.0, 3200.0, 2.0), b));
+
+    ResonanceSpectrum merged;
+    merge_spectrum(merged, a);
+    merge_spectrum(merged, b);
+    REQUIRE(merged.data_sets == 2);
+    for (size_t k = 0; k < merged.freqs.size(); k += 37) {
+        CHECK(merged.psd_x[k] == Approx((a.psd_x[k] + b.psd_x[k]) / 2.0f).epsilon(1e-5));
+    }
+
+    // Different sample rate: interpolated onto the first capture's bins
+    ResonanceSpectrum c;
+    REQUIRE(compute_spectrum(make_tone(80.0, 3000.0, 2.0), c));
+    merge_spectrum(merged, c);
+    CHECK(merged.data_sets == 3);
+    CHECK(merged.freqs == a.freqs);
+}
+
+// ============================================================================
+// Shaper fitting
+// ============================================================================
+
+TEST_CASE("ShaperAnalysis: fitted shapers match Klipper reference",
+          "[calibration][shaper_analysis]") {
+    json reference;
+    if (!load_reference(reference)) {
+        SKIP("Reference data not found (run from project root)");
+    }
+
+    InputShaperResult result;
+    std::string error;
+    REQUIRE(analyze_resonance_files('X', {SAMPLE_CSV}, {}, result, &error));
+
+    const auto& shapers = reference["shapers"];
+    REQUIRE(result.all_shapers.size() == shapers.size());
+    for (size_t i = 0; i < shapers.size(); ++i) {
+        const auto& expected = shapers[i];
+        const auto& actual = result.all_shapers[i];
+        INFO("shaper " << expected["type"].get<std::string>());
+        CHECK(actual.type == expected["type"].get<std::string>());
+        CHECK(actual.frequency == Approx(expected["freq"].get<double>()).margin(1e-3));
+        CHECK(actual.vibrations ==
+              Approx(expected["vibrs"].get<double>() * 100.0).margin(0.05));
+        CHECK(actual.smoothing == Approx(expected["smoothing"].get<double>()).epsilon(1e-4));
+        CHECK(actual.max_accel ==
+              Approx(std::round(expected["max_accel"].get<double>() / 100.0) * 100.0));
+    }
+
+    CHECK(result.axis == 'X');
+    CHECK(result.shaper_type == reference["recommended"].get<std::string>());
+    REQUIRE_FALSE(result.freq_response.empty());
+    CHECK(result.freq_response.size() == reference["freqs"].size());
+    CHECK(result.freq_response.back().first <= 200.0f);
+
+    SECTION("Max smoothing limits the recommendation") {
+        ShaperFitOptions options;
+        options.max_smoothing = 0.1f;
+        InputShaperResult limited;
+        REQUIRE(analyze_resonance_files('X', {SAMPLE_CSV}, options, limited, &error));
+        CHECK(limited.shaper_type ==
+              reference["recommended_max_smoothing_0_1"].get<std::string>());
+    }
+}
+
+TEST_CASE("ShaperAnalysis: stored result can be re-fitted", "[calibration][shaper_analysis]") {
+    std::ifstream check(SAMPLE_CSV);
+    if (!check.good()) {
+        SKIP("Sample capture not found (run from project root)");
+    }
+
+    InputShaperResult original;
+    REQUIRE(analyze_resonance_files('Y', {SAMPLE_CSV}, {}, original));
+
+    ResonanceSpectrum spectrum = spectrum_from_result(original);
+    InputShaperResult refit = fit_shapers('Y', spectrum);
+    CHECK(refit.shaper_type == original.shaper_type);
+    CHECK(refit.shaper_freq == original.shaper_freq);
+    REQUIRE(refit.all_shapers.size() == original.all_shapers.size());
+    for (size_t i = 0; i < refit.all_shapers.size(); ++i) {
+        CHECK(refit.all_shapers[i].frequency == original.all_shapers[i].frequency);
+    }
+
+    ShaperFitOptions options;
+    options.max_smoothing = 0.08f;
+    InputShaperResult sharp = fit_shapers('Y', spectrum, options);
+    REQUIRE(sharp.is_valid());
+    for (const auto& shaper : sharp.all_shapers) {
+        INFO(shaper.type);
+        CHECK(shaper.smoothing <= 0.08f + 1e-6f);
+    }
+
+    CHECK_FALSE(fit_shapers('Y', ResonanceSpectrum{}).is_valid());
+}
+
+TEST_CASE("ShaperAnalysis: smoothing metric", "[calibration][shaper_analysis]") {
+    // Higher frequency shapers are shorter and smooth less
+    CHECK(shaper_smoothing("mzv", 60.0) < shaper_smoothing("mzv", 40.0));
+    // More impulses smooth more at the same frequency
+    CHECK(shaper_smoothing("zv", 50.0) < shaper_smoothing("ei", 50.0));
+    CHECK(shaper_smoothing("ei", 50.0) < shaper_smoothing("3hump_ei", 50.0));
+    CHECK(shaper_smoothing("bogus", 50.0) < 0.0);
+}
+
+TEST_CASE("ShaperAnalysis: shaper response", "[calibration][shaper_analysis]") {
+    std::vector<float> freqs = {0.0f, 20.0f, 50.0f, 150.0f};
+    auto response = shaper_response("mzv", 50.0, freqs);
+    REQUIRE(response.size() == freqs.size());
+    // Passes slow motion through, cancels around its own frequency
+    CHECK(response[0] == Approx(1.0f).margin(1e-4));
+    CHECK(response[2] < 0.1f);
+    CHECK(response[2] < response[1]);
+    for (float r : response) {
+        CHECK(r >= 0.0f);
+        CHECK(r <= 1.0f + 1e-4f);
+    }
+    CHECK(shaper_response("bogus", 50.0, freqs).empty());
+}
@@ -0,0 +1,229 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "status_delta.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+/**
+ * @file test_status_delta.cpp
+ * @brief Tests for the SAX notify_status_update decoder
+ *
+ * Whatever the decoder puts in typed slots or `other`, to_status_json() must
+ * give back exactly what json::parse produced for params[0], since JSON
+ * subscribers are fed from it.
+ */
+
+using namespace helix;
+using json = nlohmann::json;
+
+namespace {
+
+std::string frame_for(const json& status, double eventtime = 1234.5) {
+    return json{{"jsonrpc", "2.0"},
+                {"method", "notify_status_update"},
+                {"params", json::array({status, eventtime})}}
+        .dump();
+}
+
+/// Status batch as Klipper sends it while printing
+json printing_status() {
+    return {
+        {"extruder", {{"temperature", 214.87}, {"power", 0.42}}},
+        {"heater_bed", {{"temperature", 60.02}, {"target", 60.0}, {"power", 0.31}}},
+        {"temperature_sensor chamber", {{"temperature", 38.5}}},
+        {"toolhead", {{"position", {120.5, 98.25, 3.4, 1520.75}}}},
+        {"gcode_move", {{"gcode_position", {120.5, 98.25, 3.2, 1520.75}}, {"speed_factor", 1.0}}},
+        {"virtual_sdcard", {{"progress", 0.4213}, {"file_position", 1234567}}},
+        {"print_stats",
+         {{"print_duration", 1804.2}, {"total_duration", 1900.7}, {"filament_used", 2210.3}}},
+        {"fan", {{"speed", 0.8}, {"rpm", nullptr}}},
+        {"heater_fan hotend_fan", {{"speed", 1.0}}},
+        {"idle_timeout", {{"printing_time", 1900.1}}},
+    };
+}
+
+void check_round_trip(const json& status) {
+    StatusDelta delta;
+    REQUIRE(decode_status_notification(frame_for(status), delta));
+    CHECK(delta.to_status_json() == status);
+}
+
+} // namespace
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+TEST_CASE("StatusDelta: hot fields are decoded into typed slots", "[status_delta]") {
+    StatusDelta delta;
+    REQUIRE(decode_status_notification(frame_for(printing_status()), delta));
+
+    CHECK(delta.eventtime == Catch::Approx(1234.5));
+    CHECK(delta.has(StatusDelta::TOOLHEAD_POSITION));
+    REQUIRE(delta.toolhead_position.size == 4);
+    CHECK(delta.toolhead_position.values[2] == Catch::Approx(3.4));
+    CHECK(delta.gcode_position.values[2] == Catch::Approx(3.2));
+    CHECK(delta.speed_factor == Catch::Approx(1.0));
+    CHECK_FALSE(delta.has(StatusDelta::EXTRUDE_FACTOR));
+    CHECK(delta.sdcard_progress == Catch::Approx(0.4213));
+    CHECK(delta.print_duration == Catch::Approx(1804.2));
+    CHECK(delta.total_duration == Catch::Approx(1900.7));
+
+    const ThermalSample* extruder = delta.find_thermal("extruder");
+    REQUIRE(extruder != nullptr);
+    CHECK(extruder->temperature == Catch::Approx(214.87));
+    CHECK_FALSE(extruder->has(ThermalSample::TARGET));
+    REQUIRE(delta.find_thermal("temperature_sensor chamber") != nullptr);
+    CHECK(delta.find_thermal("heater_generic dryer") == nullptr);
+
+    REQUIRE(delta.fans.size() == 2);
+    CHECK(delta.fans[0].object == "fan");
+    CHECK(delta.fans[0].speed == Catch::Approx(0.8));
+    CHECK_FALSE(delta.fans[0].has(FanSample::RPM));
+
+    // The only untyped value: a tachometer-less fan reports rpm null
+    CHECK(delta.other == json{{"fan", {{"rpm", nullptr}}}});
+}
+
+TEST_CASE("StatusDelta: untyped fields fall back to JSON", "[status_delta]") {
+    SECTION("Typical print batch") {
+        check_round_trip(printing_status());
+    }
+
+    SECTION("Unknown objects and nested values") {
+        json status = {
+            {"print_stats",
+             {{"state", "printing"},
+              {"filename", "benchy.gcode"},
+              {"info", {{"current_layer", 12}, {"total_layer", 240}}}}},
+            {"exclude_object",
+             {{"excluded_objects", {"part_1", "part_2"}}, {"objects", json::array()}}},
+            {"bme280 enclosure", {{"temperature", 31.2}, {"humidity", 40.1}}},
+            {"extruder_stepper belted", {{"pressure_advance", 0.04}}},
+            {"webhooks", {{"state", "ready"}, {"state_message", "Printer is ready"}}},
+            {"toolhead", {{"homed_axes", "xyz"}, {"kinematics", "corexy"}}},
+        };
+        check_round_trip(status);
+
+        StatusDelta delta;
+        REQUIRE(decode_status_notification(frame_for(status), delta));
+        CHECK(delta.thermals.empty());
+        CHECK(delta.fields == 0);
+    }
+
+    SECTION("Position with nulls before homing") {
+        json status = {{"toolhead", {{"position", {0.0, 0.0, nullptr, 0.0}}}}};
+        check_round_trip(status);
+
+        StatusDelta delta;
+        REQUIRE(decode_status_notification(frame_for(status), delta));
+        CHECK_FALSE(delta.has(StatusDelta::TOOLHEAD_POSITION));
+        CHECK(delta.other["toolhead"]["position"].size() == 4);
+    }
+
+    SECTION("Non-object values and empty objects") {
+        check_round_trip({{"gcode_macro PRINT_START", json::object()},
+                          {"strange", 5},
+                          {"list", {1, "two", {{"three", 3}}}}});
+    }
+
+    SECTION("Typed fields alongside untyped ones of the same object") {
+        check_round_trip({{"extruder",
+                           {{"temperature", 200.5},
+                            {"target", 210.0},
+                            {"can_extrude", true},
+                            {"pressure_advance", 0.035}}},
+                          {"temperature_fan exhaust", {{"temperature", 40.0}, {"speed", 0.5}}}});
+    }
+}
+
+TEST_CASE("StatusDelta: other frames are rejected", "[status_delta]") {
+    StatusDelta delta;
+
+    SECTION("Responses") {
+        json status = {{"extruder", {{"temperature", 20.0}}}};
+        std::string response =
+            json{{"jsonrpc", "2.0"}, {"result", {{"status", status}}}, {"id", 42}}.dump();
+        CHECK_FALSE(decode_status_notification(response, delta));
+    }
+
+    SECTION("Other notifications") {
+        std::string gcode = json{{"jsonrpc", "2.0"},
+                                 {"method", "notify_gcode_response"},
+                                 {"params", {"// notify_status_update"}}}
+                                .dump();
+        CHECK_FALSE(decode_status_notification(gcode, delta));
+    }
+
+    SECTION("Malformed or truncated frames") {
+        std::string frame = frame_for(printing_status());
+        CHECK_FALSE(decode_status_notification(frame.substr(0, frame.size() / 2), delta));
+        CHECK_FALSE(decode_status_notification(
+            R"({"jsonrpc": "2.0", "method": "notify_status_update", "params": ["oops"]})",
+            delta));
+    }
+
+    SECTION("Key order does not matter") {
+        std::string frame = R"({"params": [{"fan": {"speed": 0.5}}, 7.0],)"
+                            R"( "method": "notify_status_update", "jsonrpc": "2.0"})";
+        REQUIRE(decode_status_notification(frame, delta));
+        REQUIRE(delta.fans.size() == 1);
+        CHECK(delta.eventtime == Catch::Approx(7.0));
+    }
+}
+
+TEST_CASE("StatusDelta: notification JSON matches the wire format", "[status_delta]") {
+    StatusDelta delta;
+    REQUIRE(decode_status_notification(frame_for(printing_status(), 99.0), delta));
+
+    json notification = delta.to_notification_json();
+    CHECK(notification["method"] == "notify_status_update");
+    CHECK(notification["params"][0] == printing_status());
+    CHECK(notification["params"][1] == 99.0);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+TEST_CASE("StatusDelta: benchmark vs json::parse", "[.benchmark][status_delta]") {
+    const std::string frame = frame_for(printing_status());
+    constexpr int REPEATS = 20000;
+
+    // Baseline: DOM parse, then read the same fields the typed slots hold
+    double dom_sum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEATS; ++i) {
+        json j = json::parse(frame);
+        const json& status = j["params"][0];
+        dom_sum += status["extruder"]["temperature"].get<double>() +
+                   status["toolhead"]["position"][2].get<double>() +
+                   status["virtual_sdcard"]["progress"].get<double>();
+    }
+    auto dom = std::chrono::steady_clock::now() - start;
+
+    double sax_sum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEATS; ++i) {
+        StatusDelta delta;
+        decode_status_notification(frame, delta);
+        sax_sum += delta.thermals[0].temperature + delta.toolhead_position.values[2] +
+                   delta.sdcard_progress;
+    }
+    auto sax = std::chrono::steady_clock::now() - start;
+
+    CHECK(sax_sum == Catch::Approx(dom_sum));
+
+    auto to_us = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    };
+    WARN("json::parse: " << to_us(dom) << " us (" << to_us(dom) * 1000.0 / REPEATS
+                         << " ns/frame)");
+    WARN("SAX decode:  " << to_us(sax) << " us (" << to_us(sax) * 1000.0 / REPEATS
+                         << " ns/frame)");
+}
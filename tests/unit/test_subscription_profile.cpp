@@ -0,0 +1,108 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "subscription_profile.h"
+
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+using json = nlohmann::json;
+
+namespace {
+
+SubscriptionProfile make_base() {
+    SubscriptionProfile base;
+    base.name = "base";
+    base.add("print_stats");
+    base.add("toolhead", {"position", "homed_axes"});
+    return base;
+}
+
+} // namespace
+
+// ============================================================================
+// SubscriptionProfile
+// ============================================================================
+
+TEST_CASE("SubscriptionProfile: objects JSON uses null for all fields", "[subscription]") {
+    SubscriptionProfile profile = make_base();
+    json objects = profile.to_objects_json();
+
+    REQUIRE(objects.size() == 2);
+    CHECK(objects["print_stats"].is_null());
+    CHECK(objects["toolhead"] == json::array({"homed_axes", "position"}));
+}
+
+TEST_CASE("SubscriptionProfile: adding an object again widens its fields", "[subscription]") {
+    SubscriptionProfile profile = make_base();
+
+    SECTION("Field lists are unioned without duplicates") {
+        profile.add("toolhead", {"kinematics", "position"});
+        CHECK(profile.objects["toolhead"] ==
+              std::vector<std::string>{"homed_axes", "kinematics", "position"});
+    }
+
+    SECTION("All fields wins over a field list, either way round") {
+        profile.add("toolhead");
+        CHECK(profile.objects["toolhead"].empty());
+
+        profile.add("print_stats", {"state"});
+        CHECK(profile.objects["print_stats"].empty());
+    }
+}
+
+// ============================================================================
+// SubscriptionManager
+// ============================================================================
+
+TEST_CASE("SubscriptionManager: base profile follows the connection", "[subscription]") {
+    SubscriptionManager manager;
+
+    SECTION("Nothing is subscribed before discovery") {
+        CHECK(manager.objects().empty());
+        CHECK(manager.profile_name() == "none");
+    }
+
+    SECTION("Discovery installs the base profile") {
+        manager.set_base(make_base());
+        json objects = manager.objects();
+        REQUIRE(objects.size() == 2);
+        CHECK(objects["toolhead"] == json::array({"homed_axes", "position"}));
+        CHECK(manager.profile_name() == "base");
+    }
+
+    SECTION("Lost connection drops the base until discovery runs again") {
+        manager.set_base(make_base());
+        manager.clear_base();
+        CHECK(manager.objects().empty());
+        CHECK(manager.profile_name() == "none");
+    }
+}
+
+TEST_CASE("SubscriptionManager: traffic is accounted per profile", "[subscription]") {
+    SubscriptionManager manager;
+
+    manager.record_update(30);
+    manager.set_base(make_base());
+    manager.record_update(100);
+    manager.record_update(50);
+
+    auto traffic = manager.take_traffic();
+    REQUIRE(traffic.size() == 2);
+    CHECK(traffic[0].profile == "base");
+    CHECK(traffic[0].messages == 2);
+    CHECK(traffic[0].bytes == 150);
+    CHECK(traffic[0].seconds >= 0.0);
+    CHECK(traffic[1].profile == "none");
+    CHECK(traffic[1].messages == 1);
+    CHECK(traffic[1].bytes == 30);
+
+    // Counters reset after each report
+    manager.record_update(10);
+    traffic = manager.take_traffic();
+    REQUIRE(traffic.size() == 1);
+    CHECK(traffic[0].profile == "base");
+    CHECK(traffic[0].bytes == 10);
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_temp_graph_decimation.cpp
+ * @brief Unit tests for min/max decimation of temperature graph series
+ */
+
+#include "../../include/ui_temp_graph_decimation.h"
+
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+TEST_CASE("Temp graph bucket size targets ~2 points per pixel", "[ui][temp_graph]") {
+    // Not laid out yet, or already fits: no decimation
+    CHECK(ui_temp_graph_bucket_size(1200, 0) == 1);
+    CHECK(ui_temp_graph_bucket_size(1200, 600) == 1);
+    CHECK(ui_temp_graph_bucket_size(1200, 800) == 1);
+
+    CHECK(ui_temp_graph_bucket_size(1200, 400) == 3);
+    CHECK(ui_temp_graph_decimated_point_count(1200, 3) == 800);
+
+    CHECK(ui_temp_graph_bucket_size(1200, 150) == 8);
+    CHECK(ui_temp_graph_decimated_point_count(1200, 8) == 300);
+
+    // Uneven split rounds up so the whole window still fits
+    CHECK(ui_temp_graph_bucket_size(1200, 350) == 4);
+    CHECK(ui_temp_graph_decimated_point_count(1199, 4) == 600);
+    CHECK(ui_temp_graph_decimated_point_count(1200, 1) == 1200);
+}
+
+TEST_CASE("Temp graph bucket emits min and max in time order", "[ui][temp_graph]") {
+    ui_temp_graph_bucket_t bucket{};
+    int32_t first = 0;
+    int32_t second = 0;
+
+    REQUIRE(ui_temp_graph_bucket_push(&bucket, 4, 200));
+    REQUIRE_FALSE(ui_temp_graph_bucket_push(&bucket, 4, 250));
+    REQUIRE_FALSE(ui_temp_graph_bucket_push(&bucket, 4, 180));
+    ui_temp_graph_bucket_points(&bucket, &first, &second);
+    CHECK(first == 250); // Peak came before the dip
+    CHECK(second == 180);
+
+    REQUIRE_FALSE(ui_temp_graph_bucket_push(&bucket, 4, 190));
+    CHECK(bucket.count == 4);
+
+    // Fifth sample starts a new bucket
+    REQUIRE(ui_temp_graph_bucket_push(&bucket, 4, 210));
+    ui_temp_graph_bucket_points(&bucket, &first, &second);
+    CHECK(first == 210);
+    CHECK(second == 210);
+
+    REQUIRE_FALSE(ui_temp_graph_bucket_push(&bucket, 4, 230));
+    ui_temp_graph_bucket_points(&bucket, &first, &second);
+    CHECK(first == 210); // Rising: min first
+    CHECK(second == 230);
+}
+
+TEST_CASE("Temp graph decimation preserves single-sample spikes", "[ui][temp_graph]") {
+    std::vector<int32_t> values(1200, 210);
+    values[437] = 290; // Runaway spike
+    values[901] = 150; // Fan blast dip
+
+    const int bucket_size = 8;
+    std::vector<int32_t> out(
+        static_cast<size_t>(ui_temp_graph_decimated_point_count(1200, bucket_size)));
+    ui_temp_graph_bucket_t bucket{};
+    int produced = ui_temp_graph_decimate(values.data(), static_cast<int>(values.size()),
+                                          bucket_size, out.data(), &bucket);
+
+    REQUIRE(produced == 300);
+    int spikes = 0;
+    int dips = 0;
+    for (int32_t v : out) {
+        spikes += v == 290;
+        dips += v == 150;
+    }
+    CHECK(spikes == 1);
+    CHECK(dips == 1);
+    CHECK(out[2 * (437 / bucket_size) + 1] == 290);
+    CHECK(out[2 * (901 / bucket_size) + 1] == 150);
+}
+
+TEST_CASE("Temp graph bulk decimation matches incremental pushes", "[ui][temp_graph]") {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 103; i++) {
+        values.push_back(200 + (i * 37) % 23 - (i % 5 == 0 ? 15 : 0));
+    }
+
+    const int bucket_size = 5;
+    std::vector<int32_t> bulk(static_cast<size_t>(
+        ui_temp_graph_decimated_point_count(static_cast<int>(values.size()), bucket_size)));
+    ui_temp_graph_bucket_t bulk_bucket{};
+    int produced = ui_temp_graph_decimate(values.data(), static_cast<int>(values.size()),
+                                          bucket_size, bulk.data(), &bulk_bucket);
+    REQUIRE(produced == static_cast<int>(bulk.size()));
+
+    std::vector<int32_t> incremental;
+    ui_temp_graph_bucket_t bucket{};
+    for (int32_t v : values) {
+        if (ui_temp_graph_bucket_push(&bucket, bucket_size, v)) {
+            incremental.resize(incremental.size() + 2);
+        }
+        ui_temp_graph_bucket_points(&bucket, &incremental[incremental.size() - 2],
+                                    &incremental[incremental.size() - 1]);
+    }
+
+    CHECK(incremental == bulk);
+    CHECK(bulk_bucket.count == 103 % bucket_size);
+
+    SECTION("Bucket size 1 copies through") {
+        std::vector<int32_t> copy(values.size());
+        ui_temp_graph_bucket_t unused{};
+        REQUIRE(ui_temp_graph_decimate(values.data(), static_cast<int>(values.size()), 1,
+                                       copy.data(), &unused) == static_cast<int>(values.size()));
+        CHECK(copy == values);
+    }
+}
@@ -22,8 +22,12 @@
 #include "../../lvgl/lvgl.h"
 #include "../ui_test_utils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <mutex>
 #include <string>
@@ -541,3 +545,110 @@ TEST_CASE_METHOD(TemperatureHistoryManagerTestFixture,
     REQUIRE(callback1_count.load() == 1); // Unchanged
     REQUIRE(callback2_count.load() == 2); // Incremented
 }
+
+// ============================================================================
+// Test Case: Discovered Sensors
+// ============================================================================
+
+TEST_CASE_METHOD(TemperatureHistoryManagerTestFixture,
+                 "TemperatureHistoryManager records tracked sensors from status updates",
+                 "[temperature_history]") {
+    manager_->set_tracked_sensors({"heater_generic chamber", "temperature_sensor mcu_temp"});
+
+    auto names = manager_->get_heater_names();
+    REQUIRE(std::find(names.begin(), names.end(), "temperature_sensor mcu_temp") != names.end());
+
+    int64_t ts = now_ms();
+    nlohmann::json status = {
+        {"heater_generic chamber", {{"temperature", 41.25}, {"target", 50.0}}},
+        {"temperature_sensor mcu_temp", {{"temperature", 38.5}}},
+        {"temperature_sensor untracked", {{"temperature", 20.0}}},
+        {"extruder", {{"temperature", 210.0}}}, // Subject-driven, ignored here
+    };
+    manager_->update_from_status(status, ts);
+
+    // Target is remembered when a later update only carries temperature
+    manager_->update_from_status({{"heater_generic chamber", {{"temperature", 42.0}}}}, ts + 1000);
+
+    TempSampleView chamber = manager_->get_view("heater_generic chamber");
+    REQUIRE(chamber.size() == 2);
+    CHECK(chamber[0].temp_centi == 412);
+    CHECK(chamber[1].temp_centi == 420);
+    CHECK(chamber[1].target_centi == 500);
+
+    CHECK(manager_->get_sample_count("temperature_sensor mcu_temp") == 1);
+    CHECK(manager_->get_sample_count("temperature_sensor untracked") == 0);
+    CHECK(manager_->get_sample_count("extruder") == 0);
+}
+
+TEST_CASE_METHOD(TemperatureHistoryManagerTestFixture,
+                 "TemperatureHistoryManager records tracked sensors from status deltas",
+                 "[temperature_history]") {
+    manager_->set_tracked_sensors({"heater_generic chamber"});
+
+    helix::StatusDelta delta;
+    helix::ThermalSample chamber_sample;
+    chamber_sample.object = "heater_generic chamber";
+    chamber_sample.fields = helix::ThermalSample::TEMPERATURE | helix::ThermalSample::TARGET;
+    chamber_sample.temperature = 41.25;
+    chamber_sample.target = 50.0;
+    delta.thermals.push_back(chamber_sample);
+
+    int64_t ts = now_ms();
+    manager_->update_from_delta(delta, ts);
+
+    // Untyped objects in `other` are recorded too
+    helix::StatusDelta untyped;
+    untyped.other = {{"heater_generic chamber", {{"temperature", 42.0}}}};
+    manager_->update_from_delta(untyped, ts + 1000);
+
+    TempSampleView chamber = manager_->get_view("heater_generic chamber");
+    REQUIRE(chamber.size() == 2);
+    CHECK(chamber[0].temp_centi == 412);
+    CHECK(chamber[1].temp_centi == 420);
+    CHECK(chamber[1].target_centi == 500);
+}
+
+// ============================================================================
+// Test Case: Snapshot Persistence
+// ============================================================================
+
+TEST_CASE_METHOD(TemperatureHistoryManagerTestFixture,
+                 "TemperatureHistoryManager restores history from a snapshot",
+                 "[temperature_history]") {
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("helix_temp_history_test_" + std::to_string(now_ms()) + ".bin"))
+                           .string();
+
+    int64_t ts = now_ms() - 10000;
+    for (int i = 0; i < 5; ++i) {
+        manager_->add_sample_for_testing("extruder", 2000 + i, 2100, ts + i * 1000);
+    }
+    manager_->add_sample_for_testing("heater_bed", 600, 600, ts);
+    REQUIRE(manager_->save_snapshot(path));
+
+    TemperatureHistoryManager restored(printer_state_);
+
+    SECTION("Recent samples come back") {
+        REQUIRE(restored.load_snapshot(path, now_ms()));
+        auto samples = restored.get_samples("extruder");
+        REQUIRE(samples.size() == 5);
+        CHECK(samples.back().temp_centi == 2004);
+        CHECK(restored.get_sample_count("heater_bed") == 1);
+    }
+
+    SECTION("Samples older than a day are dropped") {
+        int64_t next_day = ts + TemperatureHistoryManager::SNAPSHOT_MAX_AGE_MS + 2000;
+        REQUIRE(restored.load_snapshot(path, next_day));
+        CHECK(restored.get_sample_count("extruder") == 2);
+    }
+
+    SECTION("Missing or corrupt files are ignored") {
+        CHECK_FALSE(restored.load_snapshot(path + ".missing", now_ms()));
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a snapshot";
+        CHECK_FALSE(restored.load_snapshot(path, now_ms()));
+        CHECK(restored.get_sample_count("extruder") == 0);
+    }
+
+    std::remove(path.c_str());
+}
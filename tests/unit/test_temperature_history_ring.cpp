@@ -0,0 +1,144 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_temperature_history_ring.cpp
+ * @brief Unit tests for the tiered temperature history rings and views
+ */
+
+#include "../../include/temperature_history_ring.h"
+
+#include <sstream>
+
+#include "../catch_amalgamated.hpp"
+
+namespace {
+
+TempSample make_sample(int temp_centi, int64_t timestamp_ms, int target_centi = 0) {
+    TempSample s;
+    s.temp_centi = temp_centi;
+    s.target_centi = target_centi;
+    s.timestamp_ms = timestamp_ms;
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("TempSampleRing view stitches wrapped storage oldest first", "[temperature_history]") {
+    TempSampleRing ring(4);
+    CHECK(ring.view().empty());
+    CHECK(ring.latest() == nullptr);
+
+    for (int i = 0; i < 6; ++i) {
+        ring.push(make_sample(i, i * 1000));
+    }
+
+    REQUIRE(ring.size() == 4);
+    TempSampleView view = ring.view();
+    REQUIRE(view.size() == 4);
+    CHECK(view[0].temp_centi == 2);
+    CHECK(view[3].temp_centi == 5);
+    CHECK(view.back().temp_centi == 5);
+    CHECK(ring.latest()->temp_centi == 5);
+
+    int expected = 2;
+    for (const TempSample& s : view) {
+        CHECK(s.temp_centi == expected++);
+    }
+    CHECK(view.to_vector().size() == 4);
+}
+
+TEST_CASE("TempSampleView::since returns the newer suffix", "[temperature_history]") {
+    TempSampleRing ring(5);
+    for (int i = 0; i < 7; ++i) {
+        ring.push(make_sample(i, i * 1000));
+    }
+    // Ring holds 2..6 split across the wrap point
+    TempSampleView view = ring.view();
+
+    CHECK(view.since(-1).size() == 5);
+    CHECK(view.since(2000).size() == 4);
+    CHECK(view.since(2000)[0].temp_centi == 3);
+    CHECK(view.since(4500).size() == 2);
+    CHECK(view.since(4500)[0].temp_centi == 5);
+    CHECK(view.since(6000).empty());
+}
+
+TEST_CASE("TieredTempHistory throttles and averages into coarser tiers",
+          "[temperature_history]") {
+    TieredTempHistory history;
+    const int64_t base = 1'700'000'040'000; // multiple of 60 s
+
+    REQUIRE(history.add(make_sample(100, base, 500)));
+    CHECK_FALSE(history.add(make_sample(999, base + 500)));
+
+    // 2 minutes at 1 Hz: temps 100..219
+    for (int i = 1; i < 120; ++i) {
+        REQUIRE(history.add(make_sample(100 + i, base + i * 1000, 500)));
+    }
+    // Close the second minute bucket
+    REQUIRE(history.add(make_sample(0, base + 120 * 1000, 500)));
+
+    CHECK(history.size(TempHistoryTier::FINE) == 121);
+    CHECK(history.size(TempHistoryTier::MEDIUM) == 12);
+    CHECK(history.size(TempHistoryTier::COARSE) == 2);
+
+    TempSampleView medium = history.view(TempHistoryTier::MEDIUM);
+    CHECK(medium[0].temp_centi == 104); // avg of 100..109 (integer)
+    CHECK(medium[0].timestamp_ms == base + 9000);
+    CHECK(medium[0].target_centi == 500);
+
+    TempSampleView coarse = history.view(TempHistoryTier::COARSE);
+    CHECK(coarse[0].temp_centi == 129); // avg of 100..159
+    CHECK(coarse[1].temp_centi == 189); // avg of 160..219
+}
+
+TEST_CASE("TieredTempHistory picks the finest tier that covers a span", "[temperature_history]") {
+    TieredTempHistory history;
+    for (int i = 0; i < 30; ++i) {
+        history.add(make_sample(i, 1000 + i * 1000));
+    }
+
+    // 10 min fits FINE, 3 h fits MEDIUM, anything longer falls back to COARSE
+    CHECK(history.view_for_span(10 * 60 * 1000).size() == 30);
+    CHECK(history.view_for_span(3LL * 60 * 60 * 1000).size() ==
+          history.size(TempHistoryTier::MEDIUM));
+    CHECK(history.view_for_span(48LL * 60 * 60 * 1000).size() ==
+          history.size(TempHistoryTier::COARSE));
+}
+
+TEST_CASE("TieredTempHistory save/load round trip", "[temperature_history]") {
+    TieredTempHistory history;
+    for (int i = 0; i < 200; ++i) {
+        history.add(make_sample(2000 + i, 60000 + i * 1000, 2100));
+    }
+
+    std::stringstream stream;
+    history.save(stream);
+
+    SECTION("All samples restored") {
+        TieredTempHistory restored;
+        REQUIRE(restored.load(stream, 0));
+        CHECK(restored.size(TempHistoryTier::FINE) == 200);
+        CHECK(restored.size(TempHistoryTier::MEDIUM) == history.size(TempHistoryTier::MEDIUM));
+        CHECK(restored.view(TempHistoryTier::FINE).back().temp_centi == 2199);
+        CHECK(restored.last_sample_ms() == history.last_sample_ms());
+
+        // Throttling continues from the restored sample
+        CHECK_FALSE(restored.add(make_sample(0, restored.last_sample_ms() + 10)));
+    }
+
+    SECTION("Old samples dropped") {
+        TieredTempHistory restored;
+        REQUIRE(restored.load(stream, 60000 + 149 * 1000));
+        CHECK(restored.size(TempHistoryTier::FINE) == 50);
+    }
+
+    SECTION("Truncated input rejected") {
+        std::string data = stream.str();
+        std::stringstream truncated(data.substr(0, data.size() / 2));
+        TieredTempHistory restored;
+        CHECK_FALSE(restored.load(truncated, 0));
+        CHECK(restored.size(TempHistoryTier::FINE) == 0);
+    }
+}
@@ -0,0 +1,212 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_translation_catalog.cpp
+ * @brief Unit tests for the per-language translation catalog reader
+ *
+ * Catalogs are written by a small helper that mirrors
+ * scripts/gen_translation_catalogs.py, so these tests also pin the on-disk
+ * format the generator must produce.
+ */
+
+#include "../../include/translation_catalog.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+namespace fs = std::filesystem;
+
+using namespace helix;
+
+namespace {
+
+void put_u32(std::string& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+}
+
+/// Serialize a catalog exactly like scripts/gen_translation_catalogs.py
+std::string make_catalog(const std::string& locale,
+                         const std::map<std::string, std::string>& translations,
+                         uint32_t version = TranslationCatalog::FORMAT_VERSION) {
+    // std::map iterates in key byte order, matching the generator's sort
+    const size_t n = translations.size();
+
+    std::string strtab = locale;
+    strtab.push_back('\0');
+    std::string entries;
+    for (const auto& [key, value] : translations) {
+        uint32_t key_offset = static_cast<uint32_t>(strtab.size());
+        strtab += key;
+        strtab.push_back('\0');
+        uint32_t value_offset = key_offset;
+        if (value != key) {
+            value_offset = static_cast<uint32_t>(strtab.size());
+            strtab += value;
+            strtab.push_back('\0');
+        }
+        put_u32(entries, key_offset);
+        put_u32(entries, static_cast<uint32_t>(key.size()));
+        put_u32(entries, value_offset);
+        put_u32(entries, static_cast<uint32_t>(value.size()));
+    }
+
+    std::string out = "HXTRNCAT";
+    put_u32(out, version);
+    put_u32(out, static_cast<uint32_t>(n));
+    put_u32(out, 0); // locale_offset
+    put_u32(out, static_cast<uint32_t>(32 + n * 16));
+    put_u32(out, static_cast<uint32_t>(strtab.size()));
+    put_u32(out, 0);
+    return out + entries + strtab;
+}
+
+class CatalogFixture {
+  public:
+    CatalogFixture() {
+        dir_ = fs::temp_directory_path() /
+               ("helix_translation_catalog_test_" +
+                std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        fs::create_directories(dir_);
+    }
+
+    ~CatalogFixture() {
+        std::error_code ec;
+        fs::remove_all(dir_, ec);
+    }
+
+    std::string write(const std::string& contents, const std::string& name = "de.bin") {
+        std::string path = (dir_ / name).string();
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+  private:
+    fs::path dir_;
+};
+
+} // namespace
+
+TEST_CASE_METHOD(CatalogFixture, "TranslationCatalog reads entries in key order",
+                 "[assets][i18n]") {
+    std::string path = write(make_catalog("de", {{"Settings", "Einstellungen"},
+                                                 {"Cancel", "Abbrechen"},
+                                                 {"OK", "OK"},
+                                                 {"Home", "Startseite"}}));
+
+    TranslationCatalog catalog;
+    REQUIRE(catalog.open(path));
+    CHECK(catalog.locale() == "de");
+    REQUIRE(catalog.size() == 4);
+
+    CHECK(catalog.key_at(0) == "Cancel");
+    CHECK(catalog.value_at(0) == "Abbrechen");
+    CHECK(catalog.key_at(1) == "Home");
+    CHECK(catalog.value_at(1) == "Startseite");
+    CHECK(catalog.key_at(3) == "Settings");
+    CHECK(catalog.value_at(3) == "Einstellungen");
+
+    // Untranslated keys map to themselves (sharing the key's bytes)
+    CHECK(catalog.key_at(2) == "OK");
+    CHECK(catalog.value_at(2).data() == catalog.key_at(2).data());
+
+    // Views are NUL-terminated so LVGL can use them directly
+    CHECK(catalog.key_at(0).data()[catalog.key_at(0).size()] == '\0');
+    CHECK(catalog.value_at(0).data()[catalog.value_at(0).size()] == '\0');
+
+    CHECK(catalog.key_at(4).empty());
+    CHECK(catalog.value_at(4).empty());
+
+    catalog.close();
+    CHECK_FALSE(catalog.is_open());
+    CHECK(catalog.locale().empty());
+    CHECK(catalog.size() == 0);
+    CHECK(catalog.key_at(0).empty());
+}
+
+TEST_CASE_METHOD(CatalogFixture, "TranslationCatalog reads large catalogs", "[assets][i18n]") {
+    std::map<std::string, std::string> translations;
+    for (int i = 0; i < 1000; ++i) {
+        translations["Label " + std::to_string(i)] = "Etikett " + std::to_string(i);
+    }
+    translations["Überhitzung"] = "Перегрев";
+
+    TranslationCatalog catalog;
+    REQUIRE(catalog.open(write(make_catalog("ru", translations))));
+    REQUIRE(catalog.size() == translations.size());
+
+    size_t i = 0;
+    for (const auto& [key, value] : translations) {
+        CHECK(catalog.key_at(i) == key);
+        CHECK(catalog.value_at(i) == value);
+        i++;
+    }
+}
+
+TEST_CASE_METHOD(CatalogFixture, "TranslationCatalog rejects invalid files", "[assets][i18n]") {
+    TranslationCatalog catalog;
+    const std::map<std::string, std::string> one = {{"Home", "Startseite"}};
+
+    SECTION("Missing file") {
+        CHECK_FALSE(catalog.open("/nonexistent/de.bin"));
+    }
+
+    SECTION("Truncated header") {
+        CHECK_FALSE(catalog.open(write("HXTRNCAT")));
+    }
+
+    SECTION("Wrong magic") {
+        std::string data = make_catalog("de", one);
+        data[0] = 'X';
+        CHECK_FALSE(catalog.open(write(data)));
+    }
+
+    SECTION("Unsupported version") {
+        CHECK_FALSE(catalog.open(write(make_catalog("de", one, 99))));
+    }
+
+    SECTION("String missing NUL terminator") {
+        std::string data = make_catalog("de", one);
+        data.back() = 'n';
+        CHECK_FALSE(catalog.open(write(data)));
+    }
+
+    SECTION("Entry offset past end of strings") {
+        std::string data = make_catalog("de", one);
+        data[32 + 8] = 0x7F; // value_offset of the only entry
+        CHECK_FALSE(catalog.open(write(data)));
+    }
+
+    SECTION("Strings overlapping the entry table") {
+        std::string data = make_catalog("de", one);
+        data[20] = 32; // strtab_offset pointing at the first entry
+        CHECK_FALSE(catalog.open(write(data)));
+    }
+
+    CHECK_FALSE(catalog.is_open());
+}
+
+TEST_CASE_METHOD(CatalogFixture, "TranslationCatalog swaps languages", "[assets][i18n]") {
+    TranslationCatalog catalog;
+    REQUIRE(catalog.open(write(make_catalog("de", {{"Home", "Startseite"}}), "de.bin")));
+
+    // Move-assign keeps the new mapping and releases the old one
+    TranslationCatalog next;
+    REQUIRE(next.open(write(make_catalog("fr", {{"Home", "Accueil"}}), "fr.bin")));
+    catalog = std::move(next);
+    CHECK_FALSE(next.is_open());
+    CHECK(catalog.locale() == "fr");
+    CHECK(catalog.value_at(0) == "Accueil");
+
+    // Reopening replaces the mapping in place
+    REQUIRE(catalog.open(write(make_catalog("es", {{"Home", "Inicio"}}), "es.bin")));
+    CHECK(catalog.locale() == "es");
+    CHECK(catalog.value_at(0) == "Inicio");
+}
@@ -0,0 +1,169 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_xml_component_bundle.cpp
+ * @brief Unit tests for the pre-built XML component bundle reader
+ *
+ * Bundles are written by a small helper that mirrors scripts/gen_xml_bundle.py,
+ * so these tests also pin the on-disk format the generator must produce.
+ */
+
+#include "../../include/xml_component_bundle.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+namespace fs = std::filesystem;
+
+using namespace helix;
+
+namespace {
+
+void put_u32(std::string& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+}
+
+/// Serialize components exactly like scripts/gen_xml_bundle.py (input must be sorted)
+std::string make_bundle(const std::vector<std::pair<std::string, std::string>>& components,
+                        uint32_t version = XmlComponentBundle::FORMAT_VERSION) {
+    std::string strtab, data, entries;
+    for (const auto& [name, xml] : components) {
+        put_u32(entries, static_cast<uint32_t>(strtab.size()));
+        put_u32(entries, static_cast<uint32_t>(name.size()));
+        put_u32(entries, static_cast<uint32_t>(data.size()));
+        put_u32(entries, static_cast<uint32_t>(xml.size()));
+        strtab += name;
+        strtab.push_back('\0');
+        data += xml;
+        data.push_back('\0');
+    }
+
+    uint32_t strtab_offset = 32 + static_cast<uint32_t>(entries.size());
+    uint32_t data_offset = strtab_offset + static_cast<uint32_t>(strtab.size());
+
+    std::string out = "HXMLBNDL";
+    put_u32(out, version);
+    put_u32(out, static_cast<uint32_t>(components.size()));
+    put_u32(out, strtab_offset);
+    put_u32(out, static_cast<uint32_t>(strtab.size()));
+    put_u32(out, data_offset);
+    put_u32(out, static_cast<uint32_t>(data.size()));
+    return out + entries + strtab + data;
+}
+
+class BundleFixture {
+  public:
+    BundleFixture() {
+        dir_ = fs::temp_directory_path() /
+               ("helix_xml_bundle_test_" +
+                std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        fs::create_directories(dir_);
+    }
+
+    ~BundleFixture() {
+        std::error_code ec;
+        fs::remove_all(dir_, ec);
+    }
+
+    std::string write(const std::string& contents) {
+        std::string path = (dir_ / "ui_xml.bundle").string();
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+  private:
+    fs::path dir_;
+};
+
+} // namespace
+
+TEST_CASE_METHOD(BundleFixture, "XmlComponentBundle finds components by name", "[assets][xml]") {
+    std::string path = write(make_bundle({{"header_bar", "<component><view/></component>"},
+                                          {"home_panel", "<component><lv_obj/></component>"},
+                                          {"icon", "<component/>"}}));
+
+    XmlComponentBundle bundle;
+    REQUIRE(bundle.open(path));
+    REQUIRE(bundle.size() == 3);
+    CHECK(bundle.name_at(0) == "header_bar");
+    CHECK(bundle.name_at(2) == "icon");
+    CHECK(bundle.name_at(3).empty());
+
+    const char* xml = bundle.find("home_panel");
+    REQUIRE(xml != nullptr);
+    CHECK(std::string(xml) == "<component><lv_obj/></component>");
+    CHECK(std::string(bundle.find("icon")) == "<component/>");
+    CHECK(bundle.find("header_bar") != nullptr);
+
+    CHECK(bundle.find("missing") == nullptr);
+    CHECK(bundle.find("home") == nullptr);
+    CHECK(bundle.find("") == nullptr);
+
+    bundle.close();
+    CHECK_FALSE(bundle.is_open());
+    CHECK(bundle.find("home_panel") == nullptr);
+}
+
+TEST_CASE_METHOD(BundleFixture, "XmlComponentBundle rejects invalid files", "[assets][xml]") {
+    XmlComponentBundle bundle;
+
+    SECTION("Missing file") {
+        CHECK_FALSE(bundle.open("/nonexistent/ui_xml.bundle"));
+    }
+
+    SECTION("Truncated header") {
+        CHECK_FALSE(bundle.open(write("HXMLBNDL")));
+    }
+
+    SECTION("Wrong magic") {
+        std::string data = make_bundle({{"icon", "<component/>"}});
+        data[0] = 'X';
+        CHECK_FALSE(bundle.open(write(data)));
+    }
+
+    SECTION("Unsupported version") {
+        CHECK_FALSE(bundle.open(write(make_bundle({{"icon", "<component/>"}}, 99))));
+    }
+
+    SECTION("Payload missing NUL terminator") {
+        std::string data = make_bundle({{"icon", "<component/>"}});
+        data.back() = '>';
+        CHECK_FALSE(bundle.open(write(data)));
+    }
+
+    SECTION("Entry offset past end of data") {
+        std::string data = make_bundle({{"icon", "<component/>"}});
+        data[32 + 8] = 0x7F; // data_offset of first entry
+        CHECK_FALSE(bundle.open(write(data)));
+    }
+
+    CHECK_FALSE(bundle.is_open());
+}
+
+TEST_CASE_METHOD(BundleFixture, "XmlComponentBundle reopen replaces previous mapping",
+                 "[assets][xml]") {
+    XmlComponentBundle bundle;
+    REQUIRE(bundle.open(write(make_bundle({{"a", "<a/>"}}))));
+    REQUIRE(bundle.open(write(make_bundle({{"b", "<b/>"}, {"c", "<c/>"}}))));
+    CHECK(bundle.size() == 2);
+    CHECK(bundle.find("a") == nullptr);
+    CHECK(std::string(bundle.find("c")) == "<c/>");
+}
+
+TEST_CASE("XmlComponentBundle derives component names from paths", "[assets][xml]") {
+    CHECK(XmlComponentBundle::component_name_from_path("A:ui_xml/home_panel.xml") ==
+          "home_panel");
+    CHECK(XmlComponentBundle::component_name_from_path("A:globals.xml") == "globals");
+    CHECK(XmlComponentBundle::component_name_from_path("ui_xml/icon.xml") == "icon");
+    CHECK(XmlComponentBundle::component_name_from_path("icon") == "icon");
+}